@@ -100,6 +100,16 @@ struct ffxOverrideVersion
     uint64_t versionId;  ///< Id of version to use. Must be a value returned from a query in ffxQueryDescGetVersions.versionIds array.
 };
 
+// Opt in to sharing the backend (descriptor heaps, constant buffers and scratch memory) with other contexts on the same device.
+// On DX12 the contexts also share compiled pipelines. Resources are not shared: they carry each context's history.
+// Contexts sharing a backend must be dispatched from the same thread.
+#define FFX_API_CREATE_CONTEXT_DESC_TYPE_SHARED_BACKEND 6u
+struct ffxCreateContextDescSharedBackend
+{
+    ffxCreateContextDescHeader header;
+    uint32_t maxContexts;  ///< Number of effect contexts a shared backend is sized for when one has to be created. Contexts join an existing shared backend while it has room.
+};
+
 // Memory allocation function. Must return a valid pointer to at least size bytes of memory aligned to hold any type.
 // May return null to indicate failure. Standard library malloc fulfills this requirement.
 typedef void* (*ffxAlloc)(void* pUserData, uint64_t size);
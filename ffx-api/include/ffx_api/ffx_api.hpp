@@ -138,6 +138,9 @@ struct struct_type<ffxOverrideVersion> : std::integral_constant<uint64_t, FFX_AP
 template<>
 struct struct_type<ffxQueryDescGetVersions> : std::integral_constant<uint64_t, FFX_API_QUERY_DESC_TYPE_GET_VERSIONS> {};
 
+template<>
+struct struct_type<ffxCreateContextDescSharedBackend> : std::integral_constant<uint64_t, FFX_API_CREATE_CONTEXT_DESC_TYPE_SHARED_BACKEND> {};
+
 template <class Inner, uint64_t type = struct_type<Inner>::value>
 struct InitHelper : public Inner
 {
@@ -157,6 +160,9 @@ struct CreateContextDescOverrideVersion : public InitHelper<ffxOverrideVersion>
 struct QueryDescGetVersions : public InitHelper<ffxQueryDescGetVersions>
 {};
 
+struct CreateContextDescSharedBackend : public InitHelper<ffxCreateContextDescSharedBackend>
+{};
+
 template<class T>
 const T* DynamicCast(const ffxApiHeader *hdr)
 {
@@ -240,3 +240,12 @@ typedef struct FfxApiSwapchainFramePacingTuning
     uint32_t hybridSpinTime;  //How long to spin if allowHybridSpin is true. Measured in timer resolution units. Not recommended to go below 2. Will result in frequent overshoots. Default is 2.
     bool     allowWaitForSingleObjectOnFence; //Allows WaitForSingleObject instead of spinning for fence value. Default is false.
 } FfxApiSwapchainFramePacingTuning;
+
+//enum values match FfxSwapchainFrameTimePredictor
+enum FfxApiSwapchainFrameTimePredictor
+{
+    FFX_API_SWAPCHAIN_FRAMETIME_PREDICTOR_MOVING_AVERAGE      = 0, ///< Mean and standard deviation of the last 10 frames. Default.
+    FFX_API_SWAPCHAIN_FRAMETIME_PREDICTOR_EXPONENTIAL_AVERAGE = 1, ///< Exponentially weighted mean and standard deviation, reacts faster to load changes.
+    FFX_API_SWAPCHAIN_FRAMETIME_PREDICTOR_MEDIAN              = 2, ///< Median and median absolute deviation of the last 9 frames, ignores isolated spikes and paces frame times alternating between two costs evenly.
+    FFX_API_SWAPCHAIN_FRAMETIME_PREDICTOR_PERCENTILE          = 3, ///< Low percentile of the last 32 frames, chosen from the variance factor. Adds the least latency, but paces alternating frame times unevenly.
+};
@@ -104,6 +104,7 @@ enum FfxApiConfigureFrameGenerationSwapChainKeyVK
 {
     FFX_API_CONFIGURE_FG_SWAPCHAIN_KEY_WAITCALLBACK = 0,                     ///< Sets FfxWaitCallbackFunc
     FFX_API_CONFIGURE_FG_SWAPCHAIN_KEY_FRAMEPACINGTUNING = 2,                ///< Sets FfxApiSwapchainFramePacingTuning casted from ptr
+    FFX_API_CONFIGURE_FG_SWAPCHAIN_KEY_FRAMETIMEPREDICTOR = 3,               ///< Sets FfxApiSwapchainFrameTimePredictor pointed to by ptr
 };
 
 #define FFX_API_QUERY_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_GPU_MEMORY_USAGE_VK 0x00040009u
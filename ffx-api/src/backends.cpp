@@ -22,6 +22,9 @@
 
 #include "backends.h"
 
+#include <array>
+#include <mutex>
+
 #ifdef FFX_BACKEND_DX12
 #include <ffx_api/dx12/ffx_api_dx12.h>
 #include <FidelityFX/host/backends/dx12/ffx_dx12.h>
@@ -31,54 +34,154 @@
 #include <FidelityFX/host/backends/vk/ffx_vk.h>
 #endif // #ifdef FFX_BACKEND_VK
 
-ffxReturnCode_t CreateBackend(const ffxCreateContextDescHeader *desc, bool& backendFound, FfxInterface *iface, size_t contexts, Allocator& alloc)
+// A backend shared by contexts on one device. Its scratch memory is freed with the allocator of the context that created it,
+// so the callbacks are copied, not referenced.
+struct SharedBackend
+{
+    void*                  nativeDevice;
+    FfxInterface           iface;
+    size_t                 capacity;      // effect contexts the backend was created for
+    size_t                 usedContexts;  // effect contexts reserved by live ffx-api contexts
+    ffxAllocationCallbacks allocCb;
+    bool                   hasAllocCb;
+};
+
+static std::array<SharedBackend, 16> sharedBackends = {};
+static std::mutex                    sharedBackendMutex;
+
+static ffxReturnCode_t CreateBackendInterface(const ffxApiHeader* backendDesc, FfxInterface* iface, size_t contexts, Allocator& alloc)
 {
-    for (const auto* it = desc->pNext; it; it = it->pNext)
+    switch (backendDesc->type)
     {
-        switch (it->type)
-        {
 #ifdef FFX_BACKEND_DX12
-        case FFX_API_CREATE_CONTEXT_DESC_TYPE_BACKEND_DX12:
+    case FFX_API_CREATE_CONTEXT_DESC_TYPE_BACKEND_DX12:
+    {
+        const auto *dx12Desc = reinterpret_cast<const ffxCreateBackendDX12Desc*>(backendDesc);
+        FfxDevice device = ffxGetDeviceDX12(dx12Desc->device);
+        size_t scratchBufferSize = ffxGetScratchMemorySizeDX12(contexts);
+        void* scratchBuffer = alloc.alloc(scratchBufferSize);
+        VERIFY(scratchBuffer, FFX_API_RETURN_ERROR_MEMORY);
+        memset(scratchBuffer, 0, scratchBufferSize);
+        TRY2(ffxGetInterfaceDX12(iface, device, scratchBuffer, scratchBufferSize, contexts));
+        break;
+    }
+#elif FFX_BACKEND_VK
+    case FFX_API_CREATE_CONTEXT_DESC_TYPE_BACKEND_VK:
+    {
+        const auto *vkDesc = reinterpret_cast<const ffxCreateBackendVKDesc*>(backendDesc);
+        VkDeviceContext deviceContext = { vkDesc->vkDevice, vkDesc->vkPhysicalDevice, vkDesc->vkDeviceProcAddr };
+        FfxDevice device = ffxGetDeviceVK(&deviceContext);
+        size_t scratchBufferSize = ffxGetScratchMemorySizeVK(vkDesc->vkPhysicalDevice, contexts);
+        void* scratchBuffer = alloc.alloc(scratchBufferSize);
+        VERIFY(scratchBuffer, FFX_API_RETURN_ERROR_MEMORY);
+        memset(scratchBuffer, 0, scratchBufferSize);
+        TRY2(ffxGetInterfaceVK(iface, device, scratchBuffer, scratchBufferSize, contexts));
+        break;
+    }
+#endif // FFX_BACKEND_DX12
+    }
+    return FFX_API_RETURN_OK;
+}
+
+static void* GetNativeDevice(const ffxApiHeader* backendDesc)
+{
+#ifdef FFX_BACKEND_DX12
+    if (backendDesc->type == FFX_API_CREATE_CONTEXT_DESC_TYPE_BACKEND_DX12)
+        return reinterpret_cast<const ffxCreateBackendDX12Desc*>(backendDesc)->device;
+#elif FFX_BACKEND_VK
+    if (backendDesc->type == FFX_API_CREATE_CONTEXT_DESC_TYPE_BACKEND_VK)
+        return reinterpret_cast<const ffxCreateBackendVKDesc*>(backendDesc)->vkDevice;
+#endif // FFX_BACKEND_DX12
+    return nullptr;
+}
+
+static ffxReturnCode_t AcquireSharedBackend(const ffxApiHeader* backendDesc, const ffxCreateContextDescSharedBackend* sharedDesc, FfxInterface* iface, size_t contexts, Allocator& alloc)
+{
+    std::lock_guard<std::mutex> lock(sharedBackendMutex);
+
+    void*          nativeDevice = GetNativeDevice(backendDesc);
+    SharedBackend* freeSlot     = nullptr;
+    for (auto& shared : sharedBackends)
+    {
+        if (shared.usedContexts == 0)
         {
-            // check for double backend just to make sure.
-            if (backendFound)
-                return FFX_API_RETURN_ERROR;
-            backendFound = true;
-
-            const auto *backendDesc = reinterpret_cast<const ffxCreateBackendDX12Desc*>(it);
-            FfxDevice device = ffxGetDeviceDX12(backendDesc->device);
-            size_t scratchBufferSize = ffxGetScratchMemorySizeDX12(contexts);
-            void* scratchBuffer = alloc.alloc(scratchBufferSize);
-            memset(scratchBuffer, 0, scratchBufferSize);
-            TRY2(ffxGetInterfaceDX12(iface, device, scratchBuffer, scratchBufferSize, contexts));
-            break;
+            freeSlot = freeSlot ? freeSlot : &shared;
         }
-#elif FFX_BACKEND_VK
-        case FFX_API_CREATE_CONTEXT_DESC_TYPE_BACKEND_VK:
+        else if (shared.nativeDevice == nativeDevice && shared.usedContexts + contexts <= shared.capacity)
         {
-            // check for double backend just to make sure.
-            if (backendFound)
-                return FFX_API_RETURN_ERROR;
-            backendFound = true;
-
-            const auto *backendDesc = reinterpret_cast<const ffxCreateBackendVKDesc*>(it);
-            VkDeviceContext deviceContext = { backendDesc->vkDevice, backendDesc->vkPhysicalDevice, backendDesc->vkDeviceProcAddr };
-            FfxDevice device = ffxGetDeviceVK(&deviceContext);
-            size_t scratchBufferSize = ffxGetScratchMemorySizeVK(backendDesc->vkPhysicalDevice, contexts);
-            void* scratchBuffer = alloc.alloc(scratchBufferSize);
-            memset(scratchBuffer, 0, scratchBufferSize);
-            TRY2(ffxGetInterfaceVK(iface, device, scratchBuffer, scratchBufferSize, contexts));
-            break;
+            shared.usedContexts += contexts;
+            *iface = shared.iface;
+            return FFX_API_RETURN_OK;
         }
+    }
+
+    // pool is full, the context gets a backend of its own
+    if (!freeSlot)
+        return CreateBackendInterface(backendDesc, iface, contexts, alloc);
+
+    const size_t capacity = sharedDesc->maxContexts > contexts ? sharedDesc->maxContexts : contexts;
+    TRY(CreateBackendInterface(backendDesc, iface, capacity, alloc));
+
+    freeSlot->nativeDevice = nativeDevice;
+    freeSlot->iface        = *iface;
+    freeSlot->capacity     = capacity;
+    freeSlot->usedContexts = contexts;
+    freeSlot->hasAllocCb   = alloc.cb != nullptr;
+    freeSlot->allocCb      = alloc.cb ? *alloc.cb : ffxAllocationCallbacks{};
+    return FFX_API_RETURN_OK;
+}
+
+ffxReturnCode_t CreateBackend(const ffxCreateContextDescHeader *desc, bool& backendFound, FfxInterface *iface, size_t contexts, Allocator& alloc, bool shareable)
+{
+    const DescChain chain{desc->pNext};
+#ifdef FFX_BACKEND_DX12
+    const DescSlot backendSlot = DescSlot::BackendDX12;
+#else
+    const DescSlot backendSlot = DescSlot::BackendVK;
 #endif // FFX_BACKEND_DX12
+
+    const ffxApiHeader* backendDesc = chain.Get(backendSlot);
+    if (!backendDesc)
+        return FFX_API_RETURN_OK;
+
+    // check for double backend just to make sure.
+    if (backendFound || chain.Count(backendSlot) > 1)
+        return FFX_API_RETURN_ERROR;
+    backendFound = true;
+
+    const auto* sharedDesc = chain.Get<ffxCreateContextDescSharedBackend>();
+
+    if (shareable && sharedDesc)
+        return AcquireSharedBackend(backendDesc, sharedDesc, iface, contexts, alloc);
+
+    return CreateBackendInterface(backendDesc, iface, contexts, alloc);
+}
+
+void ReleaseBackend(FfxInterface* iface, size_t contexts, Allocator& alloc)
+{
+    {
+        std::lock_guard<std::mutex> lock(sharedBackendMutex);
+        for (auto& shared : sharedBackends)
+        {
+            if (shared.usedContexts > 0 && shared.iface.scratchBuffer == iface->scratchBuffer)
+            {
+                shared.usedContexts -= contexts;
+                if (shared.usedContexts == 0)
+                {
+                    Allocator{shared.hasAllocCb ? &shared.allocCb : nullptr}.dealloc(shared.iface.scratchBuffer);
+                    shared = {};
+                }
+                return;
+            }
         }
     }
-    return FFX_API_RETURN_OK;
+
+    alloc.dealloc(iface->scratchBuffer);
 }
 
-void* GetDevice(const ffxApiHeader* desc)
+void* GetDevice(const DescChain& chain)
 {
-    for (const auto* it = desc; it; it = it->pNext)
+    if (const auto* it = chain.Root())
     {
         switch (it->type)
         {
@@ -87,10 +190,6 @@ void* GetDevice(const ffxApiHeader* desc)
             return reinterpret_cast<const ffxQueryDescGetVersions*>(it)->device;
         }
 #ifdef FFX_BACKEND_DX12
-        case FFX_API_CREATE_CONTEXT_DESC_TYPE_BACKEND_DX12:
-        {
-            return reinterpret_cast<const ffxCreateBackendDX12Desc*>(it)->device;
-        }
         case FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_FOR_HWND_DX12:
         {
             ID3D12Device* device = nullptr;
@@ -112,14 +211,14 @@ void* GetDevice(const ffxApiHeader* desc)
             device->Release();
             return device;
         }
-#endif
-#ifdef FFX_BACKEND_VK
-        case FFX_API_CREATE_CONTEXT_DESC_TYPE_BACKEND_VK:
-        {
-            return nullptr; // no idea what to return for now.
-        }
 #endif
         }
     }
+
+#ifdef FFX_BACKEND_DX12
+    if (const auto* backendDesc = chain.Get<ffxCreateBackendDX12Desc>())
+        return backendDesc->device;
+#endif
+    // for Vulkan backends there is no idea what to return for now.
     return nullptr;
 }
@@ -22,17 +22,23 @@
 
 #pragma once
 #include "ffx_provider.h"
+#include "ffx_desc_chain.h"
 #include <ffx_api/ffx_api.hpp>
 #include <FidelityFx/host/ffx_interface.h>
 
-ffxReturnCode_t CreateBackend(const ffxCreateContextDescHeader* desc, bool& backendFound, FfxInterface* iface, size_t contexts, Allocator& alloc);
+// Creates a backend for the backend desc chained to desc. With shareable set and an ffxCreateContextDescSharedBackend chained,
+// the backend is instead taken from a pool of backends shared by contexts on the same device.
+ffxReturnCode_t CreateBackend(const ffxCreateContextDescHeader* desc, bool& backendFound, FfxInterface* iface, size_t contexts, Allocator& alloc, bool shareable = false);
 
-inline ffxReturnCode_t MustCreateBackend(const ffxCreateContextDescHeader* desc, FfxInterface* iface, size_t contexts, Allocator& alloc)
+inline ffxReturnCode_t MustCreateBackend(const ffxCreateContextDescHeader* desc, FfxInterface* iface, size_t contexts, Allocator& alloc, bool shareable = false)
 {
     bool backendFound = false;
-    TRY(CreateBackend(desc, backendFound, iface, contexts, alloc));
+    TRY(CreateBackend(desc, backendFound, iface, contexts, alloc, shareable));
     VERIFY(backendFound, FFX_API_RETURN_ERROR);
     return FFX_API_RETURN_OK;
 }
 
-void* GetDevice(const ffxApiHeader* desc);
+// Frees a backend created by CreateBackend, or returns its contexts to the pool if it is shared.
+void ReleaseBackend(FfxInterface* iface, size_t contexts, Allocator& alloc);
+
+void* GetDevice(const DescChain& chain);
@@ -26,14 +26,11 @@
 #include "ffx_provider.h"
 #include "backends.h"
 
-static uint64_t GetVersionOverride(const ffxApiHeader* header)
+static uint64_t GetVersionOverride(const DescChain& chain)
 {
-    for (auto it = header; it; it = it->pNext)
+    if (auto versionDesc = chain.Get<ffxOverrideVersion>())
     {
-        if (auto versionDesc = ffx::DynamicCast<ffxOverrideVersion>(it))
-        {
-            return versionDesc->versionId;
-        }
+        return versionDesc->versionId;
     }
     return 0;
 }
@@ -45,7 +42,8 @@ FFX_API_ENTRY ffxReturnCode_t ffxCreateContext(ffxContext* context, ffxCreateCon
 
     *context = nullptr;
 
-    const ffxProvider* provider = GetffxProvider(desc->type, GetVersionOverride(desc), GetDevice(desc));
+    const DescChain chain{desc};
+    const ffxProvider* provider = GetffxProvider(desc->type, GetVersionOverride(chain), GetDevice(chain));
     VERIFY(provider != nullptr, FFX_API_RETURN_NO_PROVIDER);
     
     Allocator alloc{memCb};
@@ -88,12 +86,13 @@ FFX_API_ENTRY ffxReturnCode_t ffxQuery(ffxContext* context, ffxQueryDescHeader*
             }
             return FFX_API_RETURN_OK;
         }
-        else if (auto provider = GetffxProvider(header->type, GetVersionOverride(header), GetDevice(header)))
-        {
-            return provider->Query(nullptr, header);
-        }
         else
         {
+            const DescChain chain{header};
+            if (auto provider = GetffxProvider(header->type, GetVersionOverride(chain), GetDevice(chain)))
+            {
+                return provider->Query(nullptr, header);
+            }
             return FFX_API_RETURN_NO_PROVIDER;
         }
     }
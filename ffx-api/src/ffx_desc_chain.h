@@ -0,0 +1,148 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <ffx_api/ffx_api.hpp>
+#include <ffx_api/ffx_framegeneration.hpp>
+#ifdef FFX_BACKEND_DX12
+#include <ffx_api/dx12/ffx_api_dx12.hpp>
+#endif // FFX_BACKEND_DX12
+#ifdef FFX_BACKEND_VK
+#include <ffx_api/vk/ffx_api_vk.hpp>
+#endif // #ifdef FFX_BACKEND_VK
+
+#include <stdint.h>
+
+// Extension structs a descriptor chain is decoded into. Each has one slot in DescChain.
+enum class DescSlot : uint32_t
+{
+    OverrideVersion,
+    SharedBackend,
+    BackendDX12,
+    BackendVK,
+    FrameGenerationHudless,
+    FrameGenerationDistortionField,
+    FrameGenerationSwapChainModeVK,
+
+    Count,
+    Unknown = Count,
+};
+
+static constexpr DescSlot GetDescSlot(uint64_t type)
+{
+    switch (type)
+    {
+    case FFX_API_DESC_TYPE_OVERRIDE_VERSION:                                     return DescSlot::OverrideVersion;
+    case FFX_API_CREATE_CONTEXT_DESC_TYPE_SHARED_BACKEND:                        return DescSlot::SharedBackend;
+#ifdef FFX_BACKEND_DX12
+    case FFX_API_CREATE_CONTEXT_DESC_TYPE_BACKEND_DX12:                          return DescSlot::BackendDX12;
+#endif // FFX_BACKEND_DX12
+#ifdef FFX_BACKEND_VK
+    case FFX_API_CREATE_CONTEXT_DESC_TYPE_BACKEND_VK:                            return DescSlot::BackendVK;
+    case FFX_API_CREATE_CONTEXT_DESC_TYPE_FGSWAPCHAIN_MODE_VK:                   return DescSlot::FrameGenerationSwapChainModeVK;
+#endif // #ifdef FFX_BACKEND_VK
+    case FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATION_HUDLESS:               return DescSlot::FrameGenerationHudless;
+    case FFX_API_CONFIGURE_DESC_TYPE_FRAMEGENERATION_REGISTERDISTORTIONRESOURCE: return DescSlot::FrameGenerationDistortionField;
+    default:                                                                     return DescSlot::Unknown;
+    }
+}
+
+// Decodes a descriptor and its pNext chain in a single pass into a table on the stack, so extension structs are then
+// looked up by slot instead of walking the chain again for each one. Chains longer than MaxLength are cut short, which
+// also bounds the walk over a chain that links back into itself.
+class DescChain
+{
+public:
+    static constexpr uint32_t MaxLength = 32;
+
+    explicit DescChain(const ffxApiHeader* root)
+    {
+        for (const ffxApiHeader* it = root; it; it = it->pNext)
+        {
+            if (length == MaxLength)
+            {
+                truncated = true;
+                break;
+            }
+            headers[length++] = it;
+
+            const uint32_t slot = static_cast<uint32_t>(GetDescSlot(it->type));
+            if (slot < static_cast<uint32_t>(DescSlot::Count))
+            {
+                // the first occurrence wins, later ones are only counted for validation
+                if (!slotCounts[slot]++)
+                    slots[slot] = it;
+            }
+        }
+    }
+
+    // The descriptor the chain was decoded from.
+    const ffxApiHeader* Root() const
+    {
+        return length ? headers[0] : nullptr;
+    }
+
+    // Returns the first extension struct of type T in the chain, or null.
+    template<class T>
+    const T* Get() const
+    {
+        constexpr DescSlot slot = GetDescSlot(ffx::struct_type<T>::value);
+        static_assert(slot != DescSlot::Unknown, "descriptor type has no slot in DescChain");
+        return reinterpret_cast<const T*>(slots[static_cast<uint32_t>(slot)]);
+    }
+
+    const ffxApiHeader* Get(DescSlot slot) const
+    {
+        return slots[static_cast<uint32_t>(slot)];
+    }
+
+    // Number of times a slot's type occurs in the chain.
+    uint32_t Count(DescSlot slot) const
+    {
+        return slotCounts[static_cast<uint32_t>(slot)];
+    }
+
+    uint32_t Length() const
+    {
+        return length;
+    }
+
+    const ffxApiHeader* operator[](uint32_t index) const
+    {
+        return headers[index];
+    }
+
+    // True if the chain had more than MaxLength headers or was cyclic.
+    bool IsTruncated() const
+    {
+        return truncated;
+    }
+
+private:
+    // Only the first length headers are written or read. Zeroing the rest cost more than decoding a short chain.
+    const ffxApiHeader* headers[MaxLength];
+    const ffxApiHeader* slots[static_cast<uint32_t>(DescSlot::Count)]      = {};
+    uint32_t            slotCounts[static_cast<uint32_t>(DescSlot::Count)] = {};
+    uint32_t            length                                             = 0;
+    bool                truncated                                          = false;
+};
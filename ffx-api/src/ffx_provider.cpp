@@ -28,6 +28,8 @@
 #include "ffx_provider_external.h"
 
 #include <array>
+#include <atomic>
+#include <mutex>
 #include <optional>
 
 #include <d3d12.h>
@@ -55,6 +57,29 @@ static constexpr size_t providerCount = _countof(providers);
 
 static std::array<std::optional<ffxProviderExternal>, 10> externalProviders = {};
 
+// Descriptor types the driver has already been asked to provide for.
+static std::array<uint64_t, 32> discoveredDescTypes = {};
+static size_t                   discoveredDescTypeCount = 0;
+
+// Providers resolved by GetffxProvider, so repeated lookups skip the driver query, the scans over all providers and
+// the lock. Entries are appended under providerMutex and published by the release of the count, and never change
+// afterwards, so they are read without the lock. A new external provider may take precedence over earlier
+// resolutions, so it starts a new generation, and entries of older generations are skipped. Once the table is full,
+// lookups take the locked path.
+struct ResolvedProvider
+{
+    ffxStructType_t    descType;
+    uint64_t           overrideId;
+    const ffxProvider* provider;
+    uint32_t           generation;
+};
+static std::array<ResolvedProvider, 64> resolvedProviders = {};
+static std::atomic<size_t>              resolvedProviderCount{0};
+static std::atomic<uint32_t>            resolvedProviderGeneration{0};
+
+// Guards the external provider list, the discovered descriptor types and the appending of resolved providers.
+static std::mutex providerMutex;
+
 MIDL_INTERFACE("b58d6601-7401-4234-8180-6febfc0e484c")
 IAmdExtFfxApi : public IUnknown
 {
@@ -71,13 +96,21 @@ struct ExternalProviderData
 };
 #define FFX_EXTERNAL_PROVIDER_STRUCT_VERSION 1u
 
-void GetExternalProviders(ID3D12Device* device, uint64_t descType)
+// Asks the driver once per descriptor type for a provider. Returns false if the driver could not be asked yet, because
+// no device has been seen. Must be called with providerMutex held.
+static bool GetExternalProviders(ID3D12Device* device, uint64_t descType)
 {
     static IAmdExtFfxApi* apiExtension = nullptr;
+    static bool ranOnce = false;
+
+    for (size_t i = 0; i < discoveredDescTypeCount; ++i)
+    {
+        if (discoveredDescTypes[i] == descType)
+            return true;
+    }
 
     if (nullptr != device)
     {
-        static bool ranOnce = false;
         if (!ranOnce)
         {
             ranOnce = true;
@@ -103,6 +136,15 @@ void GetExternalProviders(ID3D12Device* device, uint64_t descType)
         }
     }
 
+    // without a device the driver extension can't be created yet, so ask again on a later call
+    if (!ranOnce)
+        return false;
+
+    if (discoveredDescTypeCount < discoveredDescTypes.size())
+    {
+        discoveredDescTypes[discoveredDescTypeCount++] = descType;
+    }
+
     if (apiExtension)
     {
         ExternalProviderData data;
@@ -110,7 +152,7 @@ void GetExternalProviders(ID3D12Device* device, uint64_t descType)
         data.descType = descType;
         HRESULT hr = apiExtension->UpdateFfxApiProvider(&data, sizeof(data));
         if (hr != S_OK)
-            return;
+            return true;
 
         for (auto& slot : externalProviders)
         {
@@ -124,18 +166,19 @@ void GetExternalProviders(ID3D12Device* device, uint64_t descType)
                 // first free slot. slots are filled start to end and never released.
                 // we do not have this provider yet, add it to the list.
                 slot = ffxProviderExternal{data.provider};
+
+                // it may take precedence over providers resolved earlier
+                resolvedProviderGeneration.fetch_add(1, std::memory_order_release);
                 break;
             }
         }
     }
-    
+
+    return true;
 }
 
-const ffxProvider* GetffxProvider(ffxStructType_t descType, uint64_t overrideId, void* device)
+static const ffxProvider* FindProvider(ffxStructType_t descType, uint64_t overrideId)
 {
-    // check driver-side providers
-    GetExternalProviders(reinterpret_cast<ID3D12Device*>(device), descType);
-
     for (const auto& provider : externalProviders)
     {
         if (provider.has_value())
@@ -154,6 +197,35 @@ const ffxProvider* GetffxProvider(ffxStructType_t descType, uint64_t overrideId,
     return nullptr;
 }
 
+const ffxProvider* GetffxProvider(ffxStructType_t descType, uint64_t overrideId, void* device)
+{
+    const uint32_t generation = resolvedProviderGeneration.load(std::memory_order_acquire);
+    const size_t   count      = resolvedProviderCount.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const ResolvedProvider& resolved = resolvedProviders[i];
+        if (resolved.generation == generation && resolved.descType == descType && resolved.overrideId == overrideId)
+            return resolved.provider;
+    }
+
+    std::lock_guard<std::mutex> lock(providerMutex);
+
+    // check driver-side providers
+    const bool discovered = GetExternalProviders(reinterpret_cast<ID3D12Device*>(device), descType);
+
+    const ffxProvider* provider = FindProvider(descType, overrideId);
+
+    // only once the driver has been asked, or a later call with a device would never ask it
+    const size_t appendIndex = resolvedProviderCount.load(std::memory_order_relaxed);
+    if (provider && discovered && appendIndex < resolvedProviders.size())
+    {
+        resolvedProviders[appendIndex] = {descType, overrideId, provider, resolvedProviderGeneration.load(std::memory_order_relaxed)};
+        resolvedProviderCount.store(appendIndex + 1, std::memory_order_release);
+    }
+
+    return provider;
+}
+
 const ffxProvider* GetAssociatedProvider(ffxContext* context)
 {
     const InternalContextHeader* hdr = (const InternalContextHeader*)(*context);
@@ -170,6 +242,8 @@ uint64_t GetProviderVersions(ffxStructType_t descType, void* device, uint64_t ca
 {
     uint64_t count = 0;
 
+    std::lock_guard<std::mutex> lock(providerMutex);
+
     // check driver-side providers
     GetExternalProviders(reinterpret_cast<ID3D12Device*>(device), descType);
 
@@ -121,12 +121,9 @@ ffxReturnCode_t ffxProvider_FrameGeneration::CreateContext(ffxContext* context,
             fiDescription.displaySize.height      = desc->displaySize.height;
             fiDescription.backBufferFormat = ConvertEnum<FfxSurfaceFormat>(desc->backBufferFormat);
             fiDescription.previousInterpolationSourceFormat = ConvertEnum<FfxSurfaceFormat>(desc->backBufferFormat);
-            for (auto it = header; it; it = it->pNext)
+            if (auto descHudless = DescChain{header}.Get<ffxCreateContextDescFrameGenerationHudless>())
             {
-                if (auto descHudless = ffx::DynamicCast<ffxCreateContextDescFrameGenerationHudless>(it))
-                {
-                    fiDescription.previousInterpolationSourceFormat = ConvertEnum<FfxSurfaceFormat>(descHudless->hudlessBackBufferFormat);
-                }
+                fiDescription.previousInterpolationSourceFormat = ConvertEnum<FfxSurfaceFormat>(descHudless->hudlessBackBufferFormat);
             }
             // set up Frameinterpolation
             TRY2(ffxFrameInterpolationContextCreate(&internal_context->fiContext, &fiDescription));
@@ -204,8 +201,8 @@ ffxReturnCode_t ffxProvider_FrameGeneration::DestroyContext(ffxContext* context,
         TRY2(internal_context->backendInterfaceShared.fpDestroyBackendContext(&internal_context->backendInterfaceShared, internal_context->effectContextIdShared));
     }
 
-    alloc.dealloc(internal_context->backendInterfaceFi.scratchBuffer);
-    alloc.dealloc(internal_context->backendInterfaceShared.scratchBuffer);
+    ReleaseBackend(&internal_context->backendInterfaceFi, 2, alloc);
+    ReleaseBackend(&internal_context->backendInterfaceShared, 1, alloc);
     alloc.dealloc(internal_context);
 
     return FFX_API_RETURN_OK;
@@ -348,14 +345,11 @@ ffxReturnCode_t ffxProvider_FrameGeneration::Configure(ffxContext* context, cons
         }
 
         internal_context->distortionField = FfxResource({});
-        for (auto it = header; it; it = it->pNext)
+        if (auto distortionFieldDesc = DescChain{header}.Get<ffxConfigureDescFrameGenerationRegisterDistortionFieldResource>())
         {
-            if (auto distortionFieldDesc = ffx::DynamicCast<ffxConfigureDescFrameGenerationRegisterDistortionFieldResource>(it))
+            if (distortionFieldDesc->distortionField.resource)
             {
-                if (distortionFieldDesc->distortionField.resource)
-                {
-                    internal_context->distortionField = Convert(distortionFieldDesc->distortionField);
-                }
+                internal_context->distortionField = Convert(distortionFieldDesc->distortionField);
             }
         }
 
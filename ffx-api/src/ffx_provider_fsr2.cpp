@@ -84,7 +84,7 @@ ffxReturnCode_t ffxProvider_FSR2::CreateContext(ffxContext* context, ffxCreateCo
         VERIFY(internal_context, FFX_API_RETURN_ERROR_MEMORY);
         internal_context->header.provider = this;
 
-        TRY(MustCreateBackend(header, &internal_context->backendInterface, FFX_FSR2_CONTEXT_COUNT, alloc));
+        TRY(MustCreateBackend(header, &internal_context->backendInterface, FFX_FSR2_CONTEXT_COUNT, alloc, true));
 
         FfxFsr2ContextDescription initializationParameters = {0};
         initializationParameters.backendInterface          = internal_context->backendInterface;
@@ -120,7 +120,7 @@ ffxReturnCode_t ffxProvider_FSR2::DestroyContext(ffxContext* context, Allocator&
 
     TRY2(ffxFsr2ContextDestroy(&internal_context->context));
 
-    alloc.dealloc(internal_context->backendInterface.scratchBuffer);
+    ReleaseBackend(&internal_context->backendInterface, FFX_FSR2_CONTEXT_COUNT, alloc);
     alloc.dealloc(internal_context);
 
     return FFX_API_RETURN_OK;
@@ -82,6 +82,7 @@ struct InternalFsr3UpscalerUContext
     InternalContextHeader   header;
     FfxInterface            backendInterface;
     FfxResourceInternal     sharedResources[FFX_FSR3_RESOURCE_IDENTIFIER_COUNT];
+    uint32_t                effectContextIdShared;
     FfxFsr3UpscalerContext  context;
     ffxApiMessage           fpMessage;
 };
@@ -96,16 +97,17 @@ ffxReturnCode_t ffxProvider_FSR3Upscale::CreateContext(ffxContext* context, ffxC
         if (desc->fpMessage)
         {
 #ifdef FFX_BACKEND_DX12
-            Validator{desc->fpMessage, header}.AcceptExtensions({FFX_API_CREATE_CONTEXT_DESC_TYPE_BACKEND_DX12, FFX_API_DESC_TYPE_OVERRIDE_VERSION});
+            Validator{desc->fpMessage, header}.AcceptExtensions({FFX_API_CREATE_CONTEXT_DESC_TYPE_BACKEND_DX12, FFX_API_DESC_TYPE_OVERRIDE_VERSION, FFX_API_CREATE_CONTEXT_DESC_TYPE_SHARED_BACKEND});
 #elif FFX_BACKEND_VK
-            Validator{ desc->fpMessage, header }.AcceptExtensions({ FFX_API_CREATE_CONTEXT_DESC_TYPE_BACKEND_VK, FFX_API_DESC_TYPE_OVERRIDE_VERSION });
+            Validator{ desc->fpMessage, header }.AcceptExtensions({ FFX_API_CREATE_CONTEXT_DESC_TYPE_BACKEND_VK, FFX_API_DESC_TYPE_OVERRIDE_VERSION, FFX_API_CREATE_CONTEXT_DESC_TYPE_SHARED_BACKEND });
 #endif // FFX_BACKEND_DX12
         }
         InternalFsr3UpscalerUContext* internal_context = alloc.construct<InternalFsr3UpscalerUContext>();
         VERIFY(internal_context, FFX_API_RETURN_ERROR_MEMORY);
         internal_context->header.provider = this;
 
-        TRY(MustCreateBackend(header, &internal_context->backendInterface, 1, alloc));
+        // one effect context for the upscaler, one for the shared resources, so they stay separate when the backend is shared with other contexts
+        TRY(MustCreateBackend(header, &internal_context->backendInterface, 2, alloc, true));
 
         FfxFsr3UpscalerContextDescription initializationParameters = {0};
         initializationParameters.backendInterface = internal_context->backendInterface;
@@ -125,6 +127,8 @@ ffxReturnCode_t ffxProvider_FSR3Upscale::CreateContext(ffxContext* context, ffxC
 
         // set up FSR3Upscaler "shared" resources (no resource sharing in the upscaler provider though, since providers are fully independent and we can't guarantee all upscale providers will be compatible with other effects)
         {
+            TRY2(internal_context->backendInterface.fpCreateBackendContext(&internal_context->backendInterface, FFX_EFFECT_SHAREDAPIBACKEND, nullptr, &internal_context->effectContextIdShared));
+
             FfxFsr3UpscalerSharedResourceDescriptions fs3UpscalerResourceDescs = {};
             TRY2(ffxFsr3UpscalerGetSharedResourceDescriptions(&internal_context->context, &fs3UpscalerResourceDescs));
 
@@ -134,7 +138,7 @@ ffxReturnCode_t ffxProvider_FSR3Upscale::CreateContext(ffxContext* context, ffxC
                 TRY2(internal_context->backendInterface.fpCreateResource(
                     &internal_context->backendInterface,
                     &dilD,
-                    0,
+                    internal_context->effectContextIdShared,
                     &internal_context->sharedResources[FFX_FSR3_RESOURCE_IDENTIFIER_DILATED_DEPTH_0]));
 
                 FfxCreateResourceDescription dilMVs = fs3UpscalerResourceDescs.dilatedMotionVectors;
@@ -142,7 +146,7 @@ ffxReturnCode_t ffxProvider_FSR3Upscale::CreateContext(ffxContext* context, ffxC
                 TRY2(internal_context->backendInterface.fpCreateResource(
                     &internal_context->backendInterface,
                     &dilMVs,
-                    0,
+                    internal_context->effectContextIdShared,
                     &internal_context->sharedResources[FFX_FSR3_RESOURCE_IDENTIFIER_DILATED_MOTION_VECTORS_0]));
 
                 FfxCreateResourceDescription recND = fs3UpscalerResourceDescs.reconstructedPrevNearestDepth;
@@ -150,7 +154,7 @@ ffxReturnCode_t ffxProvider_FSR3Upscale::CreateContext(ffxContext* context, ffxC
                 TRY2(internal_context->backendInterface.fpCreateResource(
                     &internal_context->backendInterface,
                     &recND,
-                    0,
+                    internal_context->effectContextIdShared,
                     &internal_context->sharedResources[FFX_FSR3_RESOURCE_IDENTIFIER_RECONSTRUCTED_PREVIOUS_NEAREST_DEPTH_0]));
             }
         }
@@ -174,12 +178,14 @@ ffxReturnCode_t ffxProvider_FSR3Upscale::DestroyContext(ffxContext* context, All
     for (FfxUInt32 i = 0; i < FFX_FSR3_RESOURCE_IDENTIFIER_COUNT; i++)
     {
         TRY2(internal_context->backendInterface.fpDestroyResource(
-            &internal_context->backendInterface, internal_context->sharedResources[i], 0));
+            &internal_context->backendInterface, internal_context->sharedResources[i], internal_context->effectContextIdShared));
     }
 
+    TRY2(internal_context->backendInterface.fpDestroyBackendContext(&internal_context->backendInterface, internal_context->effectContextIdShared));
+
     TRY2(ffxFsr3UpscalerContextDestroy(&internal_context->context));
 
-    alloc.dealloc(internal_context->backendInterface.scratchBuffer);
+    ReleaseBackend(&internal_context->backendInterface, 2, alloc);
     alloc.dealloc(internal_context);
     
     return FFX_API_RETURN_OK;
@@ -32,7 +32,8 @@
 #include <ffx_api/ffx_framegeneration.h>
 #include <ffx_api/ffx_upscale.h>
 
-#include <unordered_map>
+#include "ffx_desc_chain.h"
+
 #include <algorithm>
 #include <sstream>
 
@@ -40,56 +41,93 @@
 
 #ifdef FFXAPI_VALIDATION
 
-static std::unordered_map<uint64_t, const char*> EnumNameMap{
-#ifdef FFX_BACKEND_DX12
-    MAP_ENUM_NAME(FFX_API_CONFIGURE_DESC_TYPE_FRAMEGENERATION),
-    MAP_ENUM_NAME(FFX_API_CONFIGURE_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_REGISTERUIRESOURCE_DX12),
+struct EnumName
+{
+    uint64_t    value;
+    const char* name;
+};
+
+static constexpr EnumName EnumNames[] = {
     MAP_ENUM_NAME(FFX_API_CONFIGURE_DESC_TYPE_GLOBALDEBUG1),
-    MAP_ENUM_NAME(FFX_API_CREATE_CONTEXT_DESC_TYPE_BACKEND_DX12),
-    MAP_ENUM_NAME(FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATION),
-    MAP_ENUM_NAME(FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_DX12),
-    MAP_ENUM_NAME(FFX_API_CREATE_CONTEXT_DESC_TYPE_UPSCALE),
     MAP_ENUM_NAME(FFX_API_QUERY_DESC_TYPE_GET_VERSIONS),
-    MAP_ENUM_NAME(FFX_API_QUERY_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_INTERPOLATIONCOMMANDLIST_DX12),
-    MAP_ENUM_NAME(FFX_API_QUERY_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_INTERPOLATIONTEXTURE_DX12),
-    MAP_ENUM_NAME(FFX_API_QUERY_DESC_TYPE_UPSCALE_GETJITTEROFFSET),
-    MAP_ENUM_NAME(FFX_API_QUERY_DESC_TYPE_UPSCALE_GETJITTERPHASECOUNT),
-    MAP_ENUM_NAME(FFX_API_QUERY_DESC_TYPE_UPSCALE_GETRENDERRESOLUTIONFROMQUALITYMODE),
-    MAP_ENUM_NAME(FFX_API_QUERY_DESC_TYPE_UPSCALE_GETUPSCALERATIOFROMQUALITYMODE),
+    MAP_ENUM_NAME(FFX_API_DESC_TYPE_OVERRIDE_VERSION),
+    MAP_ENUM_NAME(FFX_API_CREATE_CONTEXT_DESC_TYPE_SHARED_BACKEND),
+    MAP_ENUM_NAME(FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATION),
+    MAP_ENUM_NAME(FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATION_HUDLESS),
+    MAP_ENUM_NAME(FFX_API_CALLBACK_DESC_TYPE_FRAMEGENERATION_PRESENT),
+    MAP_ENUM_NAME(FFX_API_CONFIGURE_DESC_TYPE_FRAMEGENERATION),
+    MAP_ENUM_NAME(FFX_API_CONFIGURE_DESC_TYPE_FRAMEGENERATION_KEYVALUE),
+    MAP_ENUM_NAME(FFX_API_CONFIGURE_DESC_TYPE_FRAMEGENERATION_REGISTERDISTORTIONRESOURCE),
     MAP_ENUM_NAME(FFX_API_DISPATCH_DESC_TYPE_FRAMEGENERATION),
     MAP_ENUM_NAME(FFX_API_DISPATCH_DESC_TYPE_FRAMEGENERATION_PREPARE),
-    MAP_ENUM_NAME(FFX_API_DISPATCH_DESC_TYPE_UPSCALE_GENERATEREACTIVEMASK),
-    MAP_ENUM_NAME(FFX_API_DISPATCH_DESC_TYPE_UPSCALE),
+    MAP_ENUM_NAME(FFX_API_QUERY_DESC_TYPE_FRAMEGENERATION_GPU_MEMORY_USAGE),
+    MAP_ENUM_NAME(FFX_API_CREATE_CONTEXT_DESC_TYPE_UPSCALE),
     MAP_ENUM_NAME(FFX_API_CONFIGURE_DESC_TYPE_UPSCALE_KEYVALUE),
-#elif FFX_BACKEND_VK
-    MAP_ENUM_NAME(FFX_API_CONFIGURE_DESC_TYPE_FG),
-    MAP_ENUM_NAME(FFX_API_CONFIGURE_DESC_TYPE_FGSWAPCHAIN_REGISTERUIRESOURCE_VK),
-    MAP_ENUM_NAME(FFX_API_CONFIGURE_DESC_TYPE_GLOBALDEBUG1),
+    MAP_ENUM_NAME(FFX_API_DISPATCH_DESC_TYPE_UPSCALE),
+    MAP_ENUM_NAME(FFX_API_DISPATCH_DESC_TYPE_UPSCALE_GENERATEREACTIVEMASK),
+    MAP_ENUM_NAME(FFX_API_QUERY_DESC_TYPE_UPSCALE_GETUPSCALERATIOFROMQUALITYMODE),
+    MAP_ENUM_NAME(FFX_API_QUERY_DESC_TYPE_UPSCALE_GETRENDERRESOLUTIONFROMQUALITYMODE),
+    MAP_ENUM_NAME(FFX_API_QUERY_DESC_TYPE_UPSCALE_GETJITTERPHASECOUNT),
+    MAP_ENUM_NAME(FFX_API_QUERY_DESC_TYPE_UPSCALE_GETJITTEROFFSET),
+    MAP_ENUM_NAME(FFX_API_QUERY_DESC_TYPE_UPSCALE_GPU_MEMORY_USAGE),
+#ifdef FFX_BACKEND_DX12
+    MAP_ENUM_NAME(FFX_API_CREATE_CONTEXT_DESC_TYPE_BACKEND_DX12),
+    MAP_ENUM_NAME(FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_WRAP_DX12),
+    MAP_ENUM_NAME(FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_NEW_DX12),
+    MAP_ENUM_NAME(FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_FOR_HWND_DX12),
+    MAP_ENUM_NAME(FFX_API_CONFIGURE_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_REGISTERUIRESOURCE_DX12),
+    MAP_ENUM_NAME(FFX_API_CONFIGURE_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_KEYVALUE_DX12),
+    MAP_ENUM_NAME(FFX_API_QUERY_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_INTERPOLATIONCOMMANDLIST_DX12),
+    MAP_ENUM_NAME(FFX_API_QUERY_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_INTERPOLATIONTEXTURE_DX12),
+    MAP_ENUM_NAME(FFX_API_QUERY_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_GPU_MEMORY_USAGE_DX12),
+    MAP_ENUM_NAME(FFX_API_DISPATCH_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_WAIT_FOR_PRESENTS_DX12),
+#endif // FFX_BACKEND_DX12
+#ifdef FFX_BACKEND_VK
     MAP_ENUM_NAME(FFX_API_CREATE_CONTEXT_DESC_TYPE_BACKEND_VK),
-    MAP_ENUM_NAME(FFX_API_CREATE_CONTEXT_DESC_TYPE_FG),
     MAP_ENUM_NAME(FFX_API_CREATE_CONTEXT_DESC_TYPE_FGSWAPCHAIN_VK),
-    MAP_ENUM_NAME(FFX_API_CREATE_CONTEXT_DESC_TYPE_FSR_UPSCALE),
-    MAP_ENUM_NAME(FFX_API_QUERY_DESC_TYPE_GET_VERSIONS),
-    MAP_ENUM_NAME(FFX_API_QUERY_DESC_TYPE_FGSWAPCHAIN_FUNCTIONS_VK),
+    MAP_ENUM_NAME(FFX_API_CREATE_CONTEXT_DESC_TYPE_FGSWAPCHAIN_MODE_VK),
+    MAP_ENUM_NAME(FFX_API_CONFIGURE_DESC_TYPE_FGSWAPCHAIN_REGISTERUIRESOURCE_VK),
+    MAP_ENUM_NAME(FFX_API_CONFIGURE_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_KEYVALUE_VK),
     MAP_ENUM_NAME(FFX_API_QUERY_DESC_TYPE_FGSWAPCHAIN_INTERPOLATIONCOMMANDLIST_VK),
-    MAP_ENUM_NAME(FFX_API_QUERY_DESC_TYPE_FGSWAPCHAIN_INTERPOLATIONTEXTURE_DX12),
     MAP_ENUM_NAME(FFX_API_QUERY_DESC_TYPE_FGSWAPCHAIN_INTERPOLATIONTEXTURE_VK),
-    MAP_ENUM_NAME(FFX_API_QUERY_DESC_TYPE_FSR_GETJITTEROFFSET),
-    MAP_ENUM_NAME(FFX_API_QUERY_DESC_TYPE_FSR_GETJITTERPHASECOUNT),
-    MAP_ENUM_NAME(FFX_API_QUERY_DESC_TYPE_FSR_GETRENDERRESOLUTIONFROMQUALITYMODE),
-    MAP_ENUM_NAME(FFX_API_QUERY_DESC_TYPE_FSR_GETUPSCALERATIOFROMQUALITYMODE),
-    MAP_ENUM_NAME(FFX_API_DISPATCH_DESC_TYPE_FG),
-    MAP_ENUM_NAME(FFX_API_DISPATCH_DESC_TYPE_FG_PREPARE),
-    MAP_ENUM_NAME(FFX_API_DISPATCH_DESC_TYPE_FSR_GENERATEREACTIVEMASK),
-    MAP_ENUM_NAME(FFX_API_DISPATCH_DESC_TYPE_FSR_UPSCALE),
-#endif // FFX_BACKEND_VK
+    MAP_ENUM_NAME(FFX_API_QUERY_DESC_TYPE_FGSWAPCHAIN_FUNCTIONS_VK),
+    MAP_ENUM_NAME(FFX_API_QUERY_DESC_TYPE_FRAMEGENERATIONSWAPCHAIN_GPU_MEMORY_USAGE_VK),
+    MAP_ENUM_NAME(FFX_API_DISPATCH_DESC_TYPE_FGSWAPCHAIN_WAIT_FOR_PRESENTS_VK),
+#endif // #ifdef FFX_BACKEND_VK
 };
 
+static constexpr bool HasUniqueValues()
+{
+    for (size_t i = 0; i < _countof(EnumNames); ++i)
+    {
+        for (size_t j = i + 1; j < _countof(EnumNames); ++j)
+        {
+            if (EnumNames[i].value == EnumNames[j].value)
+                return false;
+        }
+    }
+    return true;
+}
+static_assert(HasUniqueValues(), "descriptor types in EnumNames must be unique");
+
 static const char* GetEnumName(uint64_t value)
 {
-    auto it = EnumNameMap.find(value);
-    if (it == EnumNameMap.end()) return "INVALID_ENUM";
-    return it->second;
+    for (const auto& entry : EnumNames)
+    {
+        if (entry.value == value)
+            return entry.name;
+    }
+    return "INVALID_ENUM";
+}
+
+static void WarnIfTruncated(ffxApiMessage callback, const DescChain& chain)
+{
+    if (chain.IsTruncated())
+    {
+        std::wostringstream message{};
+        message << "After header " << GetEnumName(chain.Root()->type) << ": chain is cyclic or longer than " << DescChain::MaxLength << " headers, ignoring the rest";
+        callback(FFX_API_MESSAGE_TYPE_WARNING, message.str().c_str());
+    }
 }
 
 #endif
@@ -97,13 +135,15 @@ static const char* GetEnumName(uint64_t value)
 Validator& Validator::NoExtensions()
 {
 #ifdef FFXAPI_VALIDATION
-    for (auto *it = header->pNext; it; it = it->pNext)
+    const DescChain chain{header};
+    for (uint32_t i = 1; i < chain.Length(); ++i)
     {
         // invalid extension!
         std::wostringstream message{};
-        message << "After header " << GetEnumName(header->type) << ": ignoring unexpected extension " << GetEnumName(it->type);
+        message << "After header " << GetEnumName(header->type) << ": ignoring unexpected extension " << GetEnumName(chain[i]->type);
         callback(FFX_API_MESSAGE_TYPE_WARNING, message.str().c_str());
     }
+    WarnIfTruncated(callback, chain);
 #endif
     return *this;
 }
@@ -111,35 +151,39 @@ Validator& Validator::NoExtensions()
 Validator& Validator::AcceptExtensions(std::initializer_list<uint64_t> extensionsOnce, std::initializer_list<uint64_t> extensionsMany)
 {
 #ifdef FFXAPI_VALIDATION
-    std::vector<bool> seenOnce(extsOnce.size(), false);
-    for (auto *it = header->pNext; it; it = it->pNext)
+    const DescChain chain{header};
+    bool seenOnce[DescChain::MaxLength] = {};
+    for (uint32_t i = 1; i < chain.Length(); ++i)
     {
-        bool canHave = extsMany.end() == std::find(extsMany.begin(), extsMany.end(), it->type);
+        const uint64_t type = chain[i]->type;
+        bool canHave = extensionsMany.end() != std::find(extensionsMany.begin(), extensionsMany.end(), type);
         if (!canHave)
         {
-            auto it_once = std::find(extsOnce.begin(), extsOnce.end(), it->type);
-            if (it_once != extsOnce.end())
+            auto it_once = std::find(extensionsOnce.begin(), extensionsOnce.end(), type);
+            if (it_once != extensionsOnce.end())
             {
                 canHave = true; // prevent error further down even if present more than once.
-                auto idx = std::distance(extsOnce.begin(), it_once);
-                if (seenOnce[idx])
+                auto idx = std::distance(extensionsOnce.begin(), it_once);
+                if (idx < DescChain::MaxLength && seenOnce[idx])
                 {
                     // extension present more than once!
                     std::wostringstream message{};
-                    message << "After header " << GetEnumName(header->type) << ": extension " << GetEnumName(it->type) << " present more than once";
+                    message << "After header " << GetEnumName(header->type) << ": extension " << GetEnumName(type) << " present more than once";
                     callback(FFX_API_MESSAGE_TYPE_WARNING, message.str().c_str());
                 }
-                seenOnce[idx] = true;
+                if (idx < DescChain::MaxLength)
+                    seenOnce[idx] = true;
             }
         }
         if (!canHave)
         {
             // invalid extension!
             std::wostringstream message{};
-            message << "After header " << GetEnumName(header->type) << ": ignoring unexpected extension " << GetEnumName(it->type);
+            message << "After header " << GetEnumName(header->type) << ": ignoring unexpected extension " << GetEnumName(type);
             callback(FFX_API_MESSAGE_TYPE_WARNING, message.str().c_str());
         }
     }
+    WarnIfTruncated(callback, chain);
 #endif
 
     return *this;
@@ -21,6 +21,7 @@
 // THE SOFTWARE.
 
 #include "ffx_provider_framegenerationswapchain_vk.h"
+#include "../ffx_desc_chain.h"
 #include <ffx_api/ffx_framegeneration.hpp>
 #include <ffx_api/vk/ffx_api_vk.hpp>
 #include <FidelityFX/host/backends/vk/ffx_vk.h>
@@ -129,15 +130,12 @@ ffxReturnCode_t ffxProvider_FrameGenerationSwapChain_VK::CreateContext(ffxContex
         internal_context->frameInterpolationInfo.compositionMode = VK_COMPOSITION_MODE_NOT_FORCED_FFX;
 
         // get the extensions
-        for (auto it = header->pNext; it != nullptr; it = it->pNext)
+        if (auto mode = DescChain{header->pNext}.Get<ffxCreateContextDescFrameGenerationSwapChainModeVK>())
         {
-            if (auto mode = ffx::DynamicCast<ffxCreateContextDescFrameGenerationSwapChainModeVK>(it))
-            {
-                if (mode->composeOnPresentQueue)
-                    internal_context->frameInterpolationInfo.compositionMode = VK_COMPOSITION_MODE_PRESENT_QUEUE_FFX;
-                else
-                    internal_context->frameInterpolationInfo.compositionMode = VK_COMPOSITION_MODE_GAME_QUEUE_FFX;
-            }
+            if (mode->composeOnPresentQueue)
+                internal_context->frameInterpolationInfo.compositionMode = VK_COMPOSITION_MODE_PRESENT_QUEUE_FFX;
+            else
+                internal_context->frameInterpolationInfo.compositionMode = VK_COMPOSITION_MODE_GAME_QUEUE_FFX;
         }
 
         FfxSwapchain swapChain = ffxGetSwapchainVK(*desc->swapchain);
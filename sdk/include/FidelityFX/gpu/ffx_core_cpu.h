@@ -20,6 +20,8 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#include <math.h>  // sqrt, floor and the other math functions used below
+
 /// A define for a true value in a boolean expression.
 ///
 /// @ingroup CPUTypes
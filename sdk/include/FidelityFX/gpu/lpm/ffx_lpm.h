@@ -146,8 +146,24 @@ FFX_STATIC void LpmSetupOut(FfxUInt32 i, FfxUInt32x4 v)
 }
 #endif  // #if defined(LPM_NO_SETUP)
 
+#if defined(FFX_CPU) && defined(LPM_SETUP_OUT_CTL)
+// With LPM_SETUP_OUT_CTL defined, the CPU FfxCalculateLpmConsts takes the control block to fill as its first parameter
+// instead of reporting it through LpmSetupOut, so callers need no shared state to route the output.
+FFX_STATIC void LpmSetupOutCtl(FfxUInt32 ctl[24 * 4], FfxUInt32 i, FfxUInt32x4 v)
+{
+    for (FfxUInt32 j = 0; j < 4; ++j)
+        ctl[i * 4 + j] = v[j];
+}
+#define FFX_LPM_SETUP_OUT_PARAM FfxUInt32 ctl[24 * 4],
+#define FFX_LPM_SETUP_OUT(i, v) LpmSetupOutCtl(ctl, i, v)
+#else
+#define FFX_LPM_SETUP_OUT_PARAM
+#define FFX_LPM_SETUP_OUT(i, v) LpmSetupOut(i, v)
+#endif  // #if defined(FFX_CPU) && defined(LPM_SETUP_OUT_CTL)
+
 /// Setup required constant values for LPM (works on CPU or GPU).
-/// Output goes to the user-defined LpmSetupOut() function.
+/// Output goes to the user-defined LpmSetupOut() function, or on the CPU to
+/// the leading <c><i>ctl</i></c> parameter when <c><i>LPM_SETUP_OUT_CTL</i></c> is defined.
 ///
 /// @param [in] shoulder             Use optional extra shoulderContrast tuning (set to false if shoulderContrast is 1.0).
 /// @param [in] con                  Use first RGB conversion matrix, if 'soft' then 'con' must be true also.
@@ -178,6 +194,8 @@ FFX_STATIC void LpmSetupOut(FfxUInt32 i, FfxUInt32x4 v)
 ///
 /// @ingroup FfxGPULpm
 FFX_STATIC void FfxCalculateLpmConsts(
+    FFX_LPM_SETUP_OUT_PARAM
+
     // Path control.
     FfxBoolean shoulder,  // Use optional extra shoulderContrast tuning (set to false if shoulderContrast is 1.0).
 
@@ -340,70 +358,70 @@ FFX_STATIC void FfxCalculateLpmConsts(
     map0[1] = ffxAsUInt32(saturation[1]);
     map0[2] = ffxAsUInt32(saturation[2]);
     map0[3] = ffxAsUInt32(contrast);
-    LpmSetupOut(0, map0);
+    FFX_LPM_SETUP_OUT(0, map0);
 
     FfxUInt32x4 map1;
     map1[0] = ffxAsUInt32(toneScaleBias[0]);
     map1[1] = ffxAsUInt32(toneScaleBias[1]);
     map1[2] = ffxAsUInt32(lumaT[0]);
     map1[3] = ffxAsUInt32(lumaT[1]);
-    LpmSetupOut(1, map1);
+    FFX_LPM_SETUP_OUT(1, map1);
 
     FfxUInt32x4 map2;
     map2[0] = ffxAsUInt32(lumaT[2]);
     map2[1] = ffxAsUInt32(crosstalk[0]);
     map2[2] = ffxAsUInt32(crosstalk[1]);
     map2[3] = ffxAsUInt32(crosstalk[2]);
-    LpmSetupOut(2, map2);
+    FFX_LPM_SETUP_OUT(2, map2);
 
     FfxUInt32x4 map3;
     map3[0] = ffxAsUInt32(rcpLumaT[0]);
     map3[1] = ffxAsUInt32(rcpLumaT[1]);
     map3[2] = ffxAsUInt32(rcpLumaT[2]);
     map3[3] = ffxAsUInt32(con2R[0]);
-    LpmSetupOut(3, map3);
+    FFX_LPM_SETUP_OUT(3, map3);
 
     FfxUInt32x4 map4;
     map4[0] = ffxAsUInt32(con2R[1]);
     map4[1] = ffxAsUInt32(con2R[2]);
     map4[2] = ffxAsUInt32(con2G[0]);
     map4[3] = ffxAsUInt32(con2G[1]);
-    LpmSetupOut(4, map4);
+    FFX_LPM_SETUP_OUT(4, map4);
 
     FfxUInt32x4 map5;
     map5[0] = ffxAsUInt32(con2G[2]);
     map5[1] = ffxAsUInt32(con2B[0]);
     map5[2] = ffxAsUInt32(con2B[1]);
     map5[3] = ffxAsUInt32(con2B[2]);
-    LpmSetupOut(5, map5);
+    FFX_LPM_SETUP_OUT(5, map5);
 
     FfxUInt32x4 map6;
     map6[0] = ffxAsUInt32(shoulderContrast);
     map6[1] = ffxAsUInt32(lumaW[0]);
     map6[2] = ffxAsUInt32(lumaW[1]);
     map6[3] = ffxAsUInt32(lumaW[2]);
-    LpmSetupOut(6, map6);
+    FFX_LPM_SETUP_OUT(6, map6);
 
     FfxUInt32x4 map7;
     map7[0] = ffxAsUInt32(softGap2[0]);
     map7[1] = ffxAsUInt32(softGap2[1]);
     map7[2] = ffxAsUInt32(conR[0]);
     map7[3] = ffxAsUInt32(conR[1]);
-    LpmSetupOut(7, map7);
+    FFX_LPM_SETUP_OUT(7, map7);
 
     FfxUInt32x4 map8;
     map8[0] = ffxAsUInt32(conR[2]);
     map8[1] = ffxAsUInt32(conG[0]);
     map8[2] = ffxAsUInt32(conG[1]);
     map8[3] = ffxAsUInt32(conG[2]);
-    LpmSetupOut(8, map8);
+    FFX_LPM_SETUP_OUT(8, map8);
 
     FfxUInt32x4 map9;
     map9[0] = ffxAsUInt32(conB[0]);
     map9[1] = ffxAsUInt32(conB[1]);
     map9[2] = ffxAsUInt32(conB[2]);
     map9[3] = ffxAsUInt32(0);
-    LpmSetupOut(9, map9);
+    FFX_LPM_SETUP_OUT(9, map9);
 
     // Packed 16-bit part of control block.
     FfxUInt32x4  map16;
@@ -423,7 +441,7 @@ FFX_STATIC void FfxCalculateLpmConsts(
     map16[1]  = ffxPackHalf2x16(map16y);
     map16[2]  = ffxPackHalf2x16(map16z);
     map16[3]  = ffxPackHalf2x16(map16w);
-    LpmSetupOut(16, map16);
+    FFX_LPM_SETUP_OUT(16, map16);
 
     FfxUInt32x4  map17;
     FfxFloat32x2 map17x;
@@ -442,7 +460,7 @@ FFX_STATIC void FfxCalculateLpmConsts(
     map17[1]  = ffxPackHalf2x16(map17y);
     map17[2]  = ffxPackHalf2x16(map17z);
     map17[3]  = ffxPackHalf2x16(map17w);
-    LpmSetupOut(17, map17);
+    FFX_LPM_SETUP_OUT(17, map17);
 
     FfxUInt32x4  map18;
     FfxFloat32x2 map18x;
@@ -461,7 +479,7 @@ FFX_STATIC void FfxCalculateLpmConsts(
     map18[1]  = ffxPackHalf2x16(map18y);
     map18[2]  = ffxPackHalf2x16(map18z);
     map18[3]  = ffxPackHalf2x16(map18w);
-    LpmSetupOut(18, map18);
+    FFX_LPM_SETUP_OUT(18, map18);
 
     FfxUInt32x4  map19;
     FfxFloat32x2 map19x;
@@ -480,7 +498,7 @@ FFX_STATIC void FfxCalculateLpmConsts(
     map19[1]  = ffxPackHalf2x16(map19y);
     map19[2]  = ffxPackHalf2x16(map19z);
     map19[3]  = ffxPackHalf2x16(map19w);
-    LpmSetupOut(19, map19);
+    FFX_LPM_SETUP_OUT(19, map19);
 
     FfxUInt32x4  map20;
     FfxFloat32x2 map20x;
@@ -499,9 +517,12 @@ FFX_STATIC void FfxCalculateLpmConsts(
     map20[1]  = ffxPackHalf2x16(map20y);
     map20[2]  = ffxPackHalf2x16(map20z);
     map20[3]  = ffxPackHalf2x16(map20w);
-    LpmSetupOut(20, map20);
+    FFX_LPM_SETUP_OUT(20, map20);
 }
 
+#undef FFX_LPM_SETUP_OUT_PARAM
+#undef FFX_LPM_SETUP_OUT
+
 //==============================================================================================================================
 //                                                 HDR10 RANGE LIMITING SCALAR
 //------------------------------------------------------------------------------------------------------------------------------
@@ -82,6 +82,23 @@ FFX_API FfxErrorCode ffxGetInterfaceDX12(
     size_t scratchBufferSize, 
     size_t maxContexts);
 
+/// Query the occupancy of the backend's fallback constant buffer ring.
+///
+/// The ring serves constant buffer uploads for all effect contexts when no
+/// allocator was registered through <c><i>fpRegisterConstantBufferAllocator</i></c>.
+/// All fields are zero until the first effect context is created.
+///
+/// @param [in] backendInterface            A pointer to a <c><i>FfxInterface</i></c> populated by <c><i>ffxGetInterfaceDX12</i></c>.
+/// @param [out] statistics                 A pointer to a <c><i>FfxConstantRingStatistics</i></c> receiving the current occupancy.
+///
+/// @retval
+/// FFX_OK                                  The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER               The <c><i>backendInterface</i></c> or <c><i>statistics</i></c> pointer was <c><i>NULL</i></c>.
+///
+/// @ingroup DX12Backend
+FFX_API FfxErrorCode ffxGetConstantRingStatisticsDX12(FfxInterface* backendInterface, FfxConstantRingStatistics* statistics);
+
 /// Create a <c><i>FfxCommandList</i></c> from a <c><i>ID3D12CommandList</i></c>.
 ///
 /// @param [in] cmdList                     A pointer to the DirectX12 command list.
@@ -314,6 +331,7 @@ typedef enum FfxFrameInterpolationSwapchainConfigureKey
 {
     FFX_FI_SWAPCHAIN_CONFIGURE_KEY_WAITCALLBACK = 0,
     FFX_FI_SWAPCHAIN_CONFIGURE_KEY_FRAMEPACINGTUNING = 2,
+    FFX_FI_SWAPCHAIN_CONFIGURE_KEY_FRAMETIMEPREDICTOR = 3,
 } FfxFrameInterpolationSwapchainConfigureKey;
 
 /// Configures <c><i>FfxSwapchain</i></c> via KeyValue API post <c><i>FfxSwapchain</i></c> context creation
@@ -0,0 +1,226 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+/// @defgroup NullBackend Null Backend
+/// FidelityFX SDK headless backend implementation. It records the work effects submit instead of
+/// executing it on a GPU, so the host-side cost of any effect can be measured on machines without one.
+/// 
+/// @ingroup Backends
+
+#pragma once
+
+#include <FidelityFX/host/ffx_interface.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // #if defined(__cplusplus)
+
+/// The maximum number of characters of a job label kept in a recorded command.
+///
+/// @ingroup NullBackend
+#define FFX_NULL_COMMAND_LABEL_LENGTH   (32)
+
+/// An enumeration of the commands recorded by the null backend.
+///
+/// @ingroup NullBackend
+typedef enum FfxNullCommandType {
+
+    FFX_NULL_COMMAND_DISPATCH = 0,                  ///< A compute dispatch with direct dimensions.
+    FFX_NULL_COMMAND_DISPATCH_INDIRECT,             ///< A compute dispatch reading its dimensions from a buffer.
+    FFX_NULL_COMMAND_COPY,                          ///< A copy between two resources.
+    FFX_NULL_COMMAND_CLEAR_FLOAT,                   ///< A clear of a resource.
+    FFX_NULL_COMMAND_DISCARD,                       ///< A discard of a resource.
+    FFX_NULL_COMMAND_BARRIER,                       ///< A resource state transition or UAV barrier.
+    FFX_NULL_COMMAND_BREADCRUMBS_WRITE              ///< A write of an AMD FidelityFX Breadcrumbs Library marker.
+} FfxNullCommandType;
+
+/// A single command recorded by the null backend.
+///
+/// @ingroup NullBackend
+typedef struct FfxNullCommand {
+
+    FfxNullCommandType              type;                                   ///< The type of the command, selects the valid member of the union.
+    uint32_t                        effectContextId;                        ///< The backend context of the effect which recorded the command.
+    wchar_t                         label[FFX_NULL_COMMAND_LABEL_LENGTH];   ///< The (truncated) label of the job the command was recorded for.
+
+    union {
+        struct {
+            const FfxPipelineState* pipeline;                               ///< The pipeline dispatched. Only valid while the effect keeps it alive.
+            uint32_t                dimensions[3];                          ///< The dispatch dimensions, zero for indirect dispatches.
+            FfxResourceInternal     cmdArgument;                            ///< The indirect argument buffer of indirect dispatches.
+            uint32_t                srvCount;                               ///< The number of texture and buffer SRVs bound.
+            uint32_t                uavCount;                               ///< The number of texture and buffer UAVs bound.
+            uint32_t                constantBufferCount;                    ///< The number of constant buffers bound.
+            uint32_t                constantBufferBytes;                    ///< The number of constant bytes uploaded for the dispatch.
+        } dispatch;
+
+        struct {
+            FfxResourceInternal     src;                                    ///< The source resource.
+            FfxResourceInternal     dst;                                    ///< The destination resource.
+            uint32_t                size;                                   ///< The number of bytes copied, zero for the whole resource.
+        } copy;
+
+        struct {
+            FfxResourceInternal     target;                                 ///< The resource cleared or discarded.
+            float                   color[4];                               ///< The clear color.
+        } clear;
+
+        struct {
+            FfxResourceInternal     resource;                               ///< The resource transitioned.
+            FfxResourceStates       stateBefore;                            ///< The state before the barrier.
+            FfxResourceStates       stateAfter;                             ///< The state after the barrier, equal to <c><i>stateBefore</i></c> for UAV barriers.
+        } barrier;
+
+        struct {
+            uint64_t                gpuLocation;                            ///< The address the marker was written to.
+            uint32_t                value;                                  ///< The marker value.
+            bool                    isBegin;                                ///< <c><i>true</i></c> for opening markers.
+        } breadcrumbs;
+    };
+} FfxNullCommand;
+
+/// A stream of commands recorded by the null backend. Acts as the command list of the backend.
+///
+/// Commands are appended until <c><i>commandCapacity</i></c> is reached, after which they are only counted in
+/// <c><i>droppedCommandCount</i></c>. Resetting <c><i>commandCount</i></c> to zero starts a new recording.
+///
+/// @ingroup NullBackend
+typedef struct FfxNullCommandStream {
+
+    FfxNullCommand*                 commands;                               ///< Application owned storage for the recorded commands.
+    uint32_t                        commandCapacity;                        ///< The number of commands <c><i>commands</i></c> can hold.
+    uint32_t                        commandCount;                           ///< The number of commands recorded.
+    uint32_t                        droppedCommandCount;                    ///< The number of commands that did not fit in <c><i>commands</i></c>.
+} FfxNullCommandStream;
+
+/// Counters of the work submitted to the null backend since it was created or its statistics were last reset.
+///
+/// @ingroup NullBackend
+typedef struct FfxNullBackendStatistics {
+
+    uint64_t                        resourcesCreated;                       ///< Calls to <c><i>fpCreateResource</i></c>, including internal upload resources.
+    uint64_t                        resourcesRegistered;                    ///< Calls to <c><i>fpRegisterResource</i></c> with a non-null resource.
+    uint64_t                        staticResourcesRegistered;              ///< Calls to <c><i>fpRegisterStaticResource</i></c>.
+    uint64_t                        pipelinesCreated;                       ///< Calls to <c><i>fpCreatePipeline</i></c>.
+    uint64_t                        jobsScheduled;                          ///< Calls to <c><i>fpScheduleGpuJob</i></c>.
+    uint64_t                        jobsExecuted;                           ///< Jobs executed by <c><i>fpExecuteGpuJobs</i></c>.
+    uint64_t                        executeCalls;                           ///< Calls to <c><i>fpExecuteGpuJobs</i></c>.
+    uint64_t                        dispatches;                             ///< Direct and indirect dispatches recorded.
+    uint64_t                        barriers;                               ///< Barriers recorded.
+    uint64_t                        constantBufferUploads;                  ///< Calls to <c><i>fpStageConstantBufferDataFunc</i></c>.
+    uint64_t                        constantBufferBytes;                    ///< Bytes staged through <c><i>fpStageConstantBufferDataFunc</i></c>.
+    uint32_t                        maxScheduledJobs;                       ///< The largest number of jobs queued at once.
+    uint64_t                        pipelinesCompiled;                      ///< Pipelines created that could not share the objects of an earlier pipeline on the backend.
+} FfxNullBackendStatistics;
+
+/// Query how much memory is required for the null backend's scratch buffer.
+/// 
+/// @param [in] maxContexts                 The maximum number of simultaneous effect contexts that will share the backend.
+///                                         (Note that some effects contain internal contexts which count towards this maximum)
+///
+/// @returns
+/// The size (in bytes) of the required scratch memory buffer for the null backend.
+/// @ingroup NullBackend
+FFX_API size_t ffxGetScratchMemorySizeNull(size_t maxContexts);
+
+/// Populate an interface with pointers for the null backend.
+///
+/// The null backend has no device. The interface's <c><i>device</i></c> is set to a non-null handle owned by the
+/// backend so effects accept it.
+///
+/// Pipelines are reflected from the same shader blobs as the DX12 backend, so effects see identical bindings.
+///
+/// @param [out] backendInterface           A pointer to a <c><i>FfxInterface</i></c> structure to populate with pointers.
+/// @param [in] scratchBuffer               A pointer to a buffer of memory which can be used by the null backend.
+/// @param [in] scratchBufferSize           The size (in bytes) of the buffer pointed to by <c><i>scratchBuffer</i></c>.
+/// @param [in] maxContexts                 The maximum number of simultaneous effect contexts that will share the backend.
+///                                         (Note that some effects contain internal contexts which count towards this maximum)
+/// @param [in] deviceCapabilities          (optional) The capabilities reported to effects, to select the shader permutations to measure.
+///                                         Shader model 6.6 with wave32/64 and FP16 support is reported when <c><i>NULL</i></c>.
+///
+/// @retval
+/// FFX_OK                                  The operation completed successfully.
+/// @retval
+/// FFX_ERROR_CODE_INVALID_POINTER          The <c><i>interface</i></c> pointer was <c><i>NULL</i></c>.
+///
+/// @ingroup NullBackend
+FFX_API FfxErrorCode ffxGetInterfaceNull(
+    FfxInterface* backendInterface,
+    void* scratchBuffer,
+    size_t scratchBufferSize,
+    size_t maxContexts,
+    const FfxDeviceCapabilities* deviceCapabilities);
+
+/// Create a <c><i>FfxCommandList</i></c> from a <c><i>FfxNullCommandStream</i></c>.
+///
+/// @param [in] commandStream               A pointer to the stream commands will be recorded into.
+///
+/// @returns
+/// An abstract FidelityFX command list.
+///
+/// @ingroup NullBackend
+FFX_API FfxCommandList ffxGetCommandListNull(FfxNullCommandStream* commandStream);
+
+/// Create a <c><i>FfxResource</i></c> standing in for an application resource.
+///
+/// The null backend never dereferences application resources, any non-null <c><i>handle</i></c> identifies one.
+///
+/// @param [in] handle                      A non-null value identifying the resource.
+/// @param [in] ffxResDescription           An <c><i>FfxResourceDescription</i></c> for the resource representation.
+/// @param [in] state                       The state the resource is currently in.
+///
+/// @returns
+/// An abstract FidelityFX resource.
+///
+/// @ingroup NullBackend
+FFX_API FfxResource ffxGetResourceNull(void*                  handle,
+                                       FfxResourceDescription ffxResDescription,
+                                       FfxResourceStates      state);
+
+/// Read the counters of the work submitted to the null backend.
+///
+/// @param [in] backendInterface            A pointer to a <c><i>FfxInterface</i></c> populated by <c><i>ffxGetInterfaceNull</i></c>.
+/// @param [out] statistics                 A pointer to the structure receiving the counters.
+///
+/// @retval
+/// FFX_OK                                  The operation completed successfully.
+/// @retval
+/// FFX_ERROR_CODE_INVALID_POINTER          One of the pointers was <c><i>NULL</i></c>.
+///
+/// @ingroup NullBackend
+FFX_API FfxErrorCode ffxGetStatisticsNull(const FfxInterface* backendInterface, FfxNullBackendStatistics* statistics);
+
+/// Reset the counters of the work submitted to the null backend.
+///
+/// @param [in] backendInterface            A pointer to a <c><i>FfxInterface</i></c> populated by <c><i>ffxGetInterfaceNull</i></c>.
+///
+/// @retval
+/// FFX_OK                                  The operation completed successfully.
+/// @retval
+/// FFX_ERROR_CODE_INVALID_POINTER          The <c><i>backendInterface</i></c> pointer was <c><i>NULL</i></c>.
+///
+/// @ingroup NullBackend
+FFX_API FfxErrorCode ffxResetStatisticsNull(const FfxInterface* backendInterface);
+
+#if defined(__cplusplus)
+}
+#endif // #if defined(__cplusplus)
@@ -124,6 +124,101 @@ FFX_API FfxErrorCode ffxGetInterfaceVK(
     size_t scratchBufferSize, 
     size_t maxContexts);
 
+/// Seed the backend's pipeline cache with data previously returned by <c><i>ffxGetPipelineCacheDataVK</i></c>.
+///
+/// If no effect context is currently alive, the data is not copied: the
+/// backend refers to it until the first context is created, and initializes
+/// the pipeline cache from it then. It must stay valid until that point, or
+/// until <c><i>ffxSetPipelineCacheDataVK</i></c> is called again. Otherwise the
+/// data is merged into the live cache right away. Data produced by a different
+/// driver or device is silently ignored. Passing <c><i>NULL</i></c> data while
+/// no context is alive forgets any data referred to.
+///
+/// Must not be called concurrently with effect context creation or destruction.
+///
+/// @param [in] backendInterface            A pointer to a <c><i>FfxInterface</i></c> populated by <c><i>ffxGetInterfaceVK</i></c>.
+/// @param [in] data                        A pointer to the serialized pipeline cache, or <c><i>NULL</i></c>.
+/// @param [in] dataSize                    The size (in bytes) of the buffer pointed to by <c><i>data</i></c>.
+///
+/// @retval
+/// FFX_OK                                  The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER               The <c><i>backendInterface</i></c> pointer was <c><i>NULL</i></c>.
+/// @retval
+/// FFX_ERROR_BACKEND_API_ERROR             The data could not be merged into the live pipeline cache.
+///
+/// @ingroup VKBackend
+FFX_API FfxErrorCode ffxSetPipelineCacheDataVK(FfxInterface* backendInterface, const void* data, size_t dataSize);
+
+/// Provide memory to retain the backend's pipeline cache in while no effect context is alive.
+///
+/// When the last effect context is destroyed, the pipeline cache is serialized
+/// into this storage, and the next context creation initializes its cache from
+/// it, so destroying and recreating effects reuses their compiled pipelines.
+/// A cache larger than the storage is retained only partially, as allowed by
+/// <c><i>vkGetPipelineCacheData</i></c>. Without storage the backend allocates
+/// nothing: the cache is dropped along with the last context, and applications
+/// wanting to keep it call <c><i>ffxGetPipelineCacheDataVK</i></c> first.
+///
+/// The storage must stay valid until it is replaced, or until the backend
+/// interface is reinitialized with <c><i>ffxGetInterfaceVK</i></c>. Passing
+/// <c><i>NULL</i></c> stops retaining the cache, and forgets any data retained.
+///
+/// Must not be called concurrently with effect context creation or destruction.
+///
+/// @param [in] backendInterface            A pointer to a <c><i>FfxInterface</i></c> populated by <c><i>ffxGetInterfaceVK</i></c>.
+/// @param [in] storage                     A pointer to the memory to retain the pipeline cache in, or <c><i>NULL</i></c>.
+/// @param [in] storageSize                 The size (in bytes) of the memory pointed to by <c><i>storage</i></c>.
+///
+/// @retval
+/// FFX_OK                                  The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER               The <c><i>backendInterface</i></c> pointer was <c><i>NULL</i></c>.
+///
+/// @ingroup VKBackend
+FFX_API FfxErrorCode ffxSetPipelineCacheStorageVK(FfxInterface* backendInterface, void* storage, size_t storageSize);
+
+/// Serialize the backend's pipeline cache so it can be restored with <c><i>ffxSetPipelineCacheDataVK</i></c>.
+///
+/// Follows <c><i>vkGetPipelineCacheData</i></c> semantics: if <c><i>data</i></c> is
+/// <c><i>NULL</i></c>, <c><i>dataSize</i></c> receives the required size. If no
+/// effect context is alive, the data the next context would be created from is
+/// returned: the data set with <c><i>ffxSetPipelineCacheDataVK</i></c>, or the
+/// cache retained in the storage set with <c><i>ffxSetPipelineCacheStorageVK</i></c>.
+///
+/// @param [in] backendInterface            A pointer to a <c><i>FfxInterface</i></c> populated by <c><i>ffxGetInterfaceVK</i></c>.
+/// @param [out] data                       A pointer to a buffer receiving the serialized cache, or <c><i>NULL</i></c>.
+/// @param [inout] dataSize                 The size (in bytes) of <c><i>data</i></c>; receives the number of bytes written.
+///
+/// @retval
+/// FFX_OK                                  The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER               The <c><i>backendInterface</i></c> or <c><i>dataSize</i></c> pointer was <c><i>NULL</i></c>.
+/// @retval
+/// FFX_ERROR_INSUFFICIENT_MEMORY           The buffer was too small to hold the whole cache.
+/// @retval
+/// FFX_ERROR_BACKEND_API_ERROR             The pipeline cache could not be read.
+///
+/// @ingroup VKBackend
+FFX_API FfxErrorCode ffxGetPipelineCacheDataVK(FfxInterface* backendInterface, void* data, size_t* dataSize);
+
+/// Query the occupancy of the backend's fallback constant buffer ring.
+///
+/// The ring serves constant buffer uploads for all effect contexts when no
+/// allocator was registered through <c><i>fpRegisterConstantBufferAllocator</i></c>.
+/// All fields are zero until the first effect context is created.
+///
+/// @param [in] backendInterface            A pointer to a <c><i>FfxInterface</i></c> populated by <c><i>ffxGetInterfaceVK</i></c>.
+/// @param [out] statistics                 A pointer to a <c><i>FfxConstantRingStatistics</i></c> receiving the current occupancy.
+///
+/// @retval
+/// FFX_OK                                  The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER               The <c><i>backendInterface</i></c> or <c><i>statistics</i></c> pointer was <c><i>NULL</i></c>.
+///
+/// @ingroup VKBackend
+FFX_API FfxErrorCode ffxGetConstantRingStatisticsVK(FfxInterface* backendInterface, FfxConstantRingStatistics* statistics);
+
 /// Create a <c><i>FfxCommandList</i></c> from a <c><i>VkCommandBuffer</i></c>.
 ///
 /// @param [in] cmdBuf                      A pointer to the Vulkan command buffer.
@@ -314,6 +409,7 @@ typedef enum FfxFrameInterpolationSwapchainConfigureKey
 {
     FFX_FI_SWAPCHAIN_CONFIGURE_KEY_WAITCALLBACK = 0,
     FFX_FI_SWAPCHAIN_CONFIGURE_KEY_FRAMEPACINGTUNING = 2,
+    FFX_FI_SWAPCHAIN_CONFIGURE_KEY_FRAMETIMEPREDICTOR = 3,
 } FfxFrameInterpolationSwapchainConfigureKey;
 
 /// Configures <c><i>FfxSwapchain</i></c> via KeyValue API post <c><i>FfxSwapchain</i></c> context creation
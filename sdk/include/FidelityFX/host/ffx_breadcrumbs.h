@@ -196,6 +196,7 @@ typedef enum FfxBreadcrumbsInitializationFlagBits {
     FFX_BREADCRUMBS_PRINT_SKIP_DEVICE_INFO        = (1<<6),   ///< A bit indicating that no info about active GPU will be printed into outpus status.
     FFX_BREADCRUMBS_PRINT_SKIP_PIPELINE_INFO      = (1<<7),   ///< A bit indicating no info about pipelines used for commands recorded between markers will be printed into output status.
     FFX_BREADCRUMBS_ENABLE_THREAD_SYNCHRONIZATION = (1<<8),   ///< A bit indicating if internal synchronization should be applied (when using Breadcrumbs concurrently from multiple threads).
+    FFX_BREADCRUMBS_RESERVE_MARKERS_PER_LIST      = (1<<9),   ///< A bit indicating that every command list will reserve a range of markers in memory block for itself, so markers of concurrently recorded command lists synchronize only when their range is used up.
 } FfxBreadcrumbsInitializationFlagBits;
 
 /// Type of currently recorded marker, purely informational.
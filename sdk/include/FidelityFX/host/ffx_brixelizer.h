@@ -27,7 +27,7 @@
 /// The size of the context specified in 32bit values.
 ///
 /// @ingroup ffxBrixelizer
-#define FFX_BRIXELIZER_CONTEXT_SIZE            (5938838)
+#define FFX_BRIXELIZER_CONTEXT_SIZE            (8265540)
 
 /// The size of the update description specified in 32bit values.
 ///
@@ -88,6 +88,7 @@ typedef struct FfxBrixelizerContextDescription {
     FfxBrixelizerContextFlags       flags;                                        ///< A combination of <c><i>FfxBrixelizerContextFlags</i></c> specifying options for the context.
     FfxBrixelizerCascadeDescription cascadeDescs[FFX_BRIXELIZER_MAX_CASCADES];    ///< Parameters describing each of the cascades, see <c><i>FfxBrixelizerCascadeDescription</i></c>.
     FfxInterface                    backendInterface;                             ///< An implementation of the FidelityFX backend for use with Brixelizer.
+    float                           dynamicInstanceMotionThreshold;               ///< The distance in world units a tracked dynamic instance must move before it is voxelized again. With a threshold of 0 dynamic cascades hold the same voxels as when rebuilt every update, but updates which do not rebuild them submit invalidations of the changed regions and the instances near them instead of every instance. See <c><i>FfxBrixelizerInstanceDescription::dynamicInstanceKey</i></c>.
 } FfxBrixelizerContextDescription;
 
 /// Flags used for setting which AABBs to draw in a debug visualization of Brixelizer
@@ -131,6 +132,14 @@ typedef struct FfxBrixelizerStats {
     FfxBrixelizerContextStats contextStats;         ///< The statistics for the Brixelizer context.
 } FfxBrixelizerStats;
 
+/// Policies for choosing which cascade to update each frame.
+///
+/// @ingroup ffxBrixelizer
+typedef enum FfxBrixelizerCascadeSchedulingMode {
+    FFX_BRIXELIZER_CASCADE_SCHEDULING_ROUND_ROBIN = 0,  ///< Update cascades in the fixed order of <c><i>ffxBrixelizerRawGetCascadeToUpdate</i></c>.
+    FFX_BRIXELIZER_CASCADE_SCHEDULING_COST_AWARE  = 1,  ///< Update the cascade that is most out of date relative to its cost with <c><i>ffxBrixelizerRawGetCascadeToUpdateByCost</i></c>.
+} FfxBrixelizerCascadeSchedulingMode;
+
 /// A structure encapsulating the parameters used for computing an update by the
 /// Brixelizer context.
 ///
@@ -146,6 +155,8 @@ typedef struct FfxBrixelizerUpdateDescription {
     uint32_t                                    maxBricksPerBake;             ///< The maximum number of bricks to be updated.
     size_t                                     *outScratchBufferSize;         ///< An optional pointer to a <c><i>size_t</i></c> to receive the size of the GPU scratch buffer needed to process the update.
     FfxBrixelizerStats                         *outStats;                     ///< An optional pointer to an <c><i>FfxBrixelizerStats</i></c> struct to receive statistics for the update. Note, stats read back after a call to update do not correspond to the same frame that the stats were requested, as reading of stats requires readback from GPU buffers which is performed with a delay.
+    FfxBrixelizerCascadeSchedulingMode          cascadeSchedulingMode;        ///< The policy for choosing the cascade to update. See <c><i>FfxBrixelizerCascadeSchedulingMode</i></c>.
+    uint32_t                                    maxJobsPerUpdate;             ///< The budget of jobs for an update used by <c><i>FFX_BRIXELIZER_CASCADE_SCHEDULING_COST_AWARE</i></c>, or 0 for no limit.
 } FfxBrixelizerUpdateDescription;
 
 /// A structure generated by Brixelizer from an <c><i>FfxBrixelizerUpdateDescription</i></c> structure
@@ -184,6 +195,7 @@ typedef struct FfxBrixelizerInstanceDescription {
     FfxSurfaceFormat            vertexFormat;         ///< The format of vertices in the vertex buffer. Accepted values are FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT and FFX_SURFACE_FORMAT_R32G32B32_FLOAT.
 
     FfxBrixelizerInstanceFlags  flags;                ///< Flags specifying properties of the instance. See <c><i>FfxBrixelizerInstanceFlags</i></c>.
+    uint64_t                    dynamicInstanceKey;   ///< An optional non-zero key identifying a dynamic instance across frames. Keyed instances which have not moved further than <c><i>dynamicInstanceMotionThreshold</i></c> are not voxelized again. Instances with deforming geometry or a key of 0 cause the dynamic cascades to be rebuilt on their next update.
 
     FfxBrixelizerInstanceID    *outInstanceID;        ///< A pointer to an <c><i>FfxBrixelizerInstanceID</i></c> storing the ID of the created instance.
 } FfxBrixelizerInstanceDescription;
@@ -294,6 +294,19 @@ typedef struct FfxBrixelizerRawInstanceDescription
     FfxBrixelizerInstanceID  *outInstanceID;        ///< A pointer to an <c><i>FfxBrixelizerInstanceID</i></c> to be filled with the instance ID assigned for the instance.
 } FfxBrixelizerRawInstanceDescription;
 
+/// A structure describing the state of a cascade, used to choose which cascade to update with
+/// <c><i>ffxBrixelizerRawGetCascadeToUpdateByCost</i></c>.
+///
+/// @ingroup ffxBrixelizer
+typedef struct FfxBrixelizerRawCascadeSchedulingInfo
+{
+    float    displacement;           ///< The distance in voxels the cascade has moved since it was last updated.
+    uint32_t pendingInvalidations;   ///< The number of invalidations waiting to be applied to the cascade.
+    uint32_t dirtyInstances;         ///< The number of instances overlapping the cascade which need to be voxelized again.
+    uint32_t framesSinceUpdate;      ///< The number of frames since the cascade was last updated.
+    uint32_t estimatedCost;          ///< The estimated cost of updating the cascade, in the same unit as the budget.
+} FfxBrixelizerRawCascadeSchedulingInfo;
+
 
 /// Get the size in bytes needed for an <c><i>FfxBrixelizerRawContext</i></c> struct.
 /// Note that this function is provided for consistency, and the size of the
@@ -659,6 +672,23 @@ FFX_API FfxErrorCode ffxBrixelizerRawContextRegisterScratchBuffer(FfxBrixelizerR
 /// @ingroup ffxBrixelizer
 FFX_API uint32_t     ffxBrixelizerRawGetCascadeToUpdate(uint32_t frameIndex, uint32_t maxCascades);
 
+/// Get the index of the cascade to update by scoring how out of date each cascade is against the cost of
+/// updating it. Cascades are scored by how far they have moved in voxels, their pending invalidations and
+/// dirty instances, weighted by the number of frames since they were last updated. The highest scoring cascade
+/// whose estimated cost fits within <c><i>budget</i></c> is chosen, or the highest scoring cascade if none fit.
+/// A cascade which has gone as many frames without an update as it does with <c><i>ffxBrixelizerRawGetCascadeToUpdate</i></c>
+/// (2 frames for cascade 0, doubling with each cascade up to <c><i>1 << (maxCascades - 1)</i></c>) is always chosen,
+/// the most detailed first when several are due.
+///
+/// @param [in] cascadeInfos                    An array of <c><i>maxCascades</i></c> <c><i>FfxBrixelizerRawCascadeSchedulingInfo</i></c> structs describing each cascade.
+/// @param [in] maxCascades                     The total number of cascades.
+/// @param [in] budget                          The maximum cost of an update in the unit of <c><i>estimatedCost</i></c>, or 0 for no limit.
+///
+/// @retval                                     The index of the cascade to update.
+///
+/// @ingroup ffxBrixelizer
+FFX_API uint32_t     ffxBrixelizerRawGetCascadeToUpdateByCost(const FfxBrixelizerRawCascadeSchedulingInfo* cascadeInfos, uint32_t maxCascades, uint32_t budget);
+
 /// Check whether an <c><i>FfxResource</i></c> is <c><i>NULL</i></c>.
 ///
 /// @param [in] resource                        An <c><i>FfxResource</i></c> to check for nullness.
@@ -183,8 +183,12 @@
 
 /// The size of the context specified in 32bit values.
 ///
+/// Was 301054 before SDK 1.1.3, where the <c><i>FfxInterface</i></c> embedded in the
+/// context description grew by <c><i>fpCreatePipelines</i></c>. Contexts are not
+/// binary compatible with earlier builds.
+///
 /// @ingroup FfxCacao
-#define FFX_CACAO_CONTEXT_SIZE (301054)
+#define FFX_CACAO_CONTEXT_SIZE (301056)
 
 /// FidelityFX CACAO context count.
 ///
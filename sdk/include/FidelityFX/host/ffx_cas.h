@@ -56,8 +56,12 @@
 
 /// The size of the context specified in 32bit values.
 ///
+/// Was 9206 before SDK 1.1.3, where the <c><i>FfxInterface</i></c> embedded in the
+/// context description grew by <c><i>fpCreatePipelines</i></c>. Contexts are not
+/// binary compatible with earlier builds.
+///
 /// @ingroup ffxCas
-#define FFX_CAS_CONTEXT_SIZE (9206)
+#define FFX_CAS_CONTEXT_SIZE (9208)
 
 #if defined(__cplusplus)
 extern "C" {
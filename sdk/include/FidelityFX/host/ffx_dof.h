@@ -57,8 +57,12 @@
 
 /// The size of the context specified in 32bit values.
 ///
+/// Was 45674 before SDK 1.1.3, where the <c><i>FfxInterface</i></c> embedded in the
+/// context description grew by <c><i>fpCreatePipelines</i></c>. Contexts are not
+/// binary compatible with earlier builds.
+///
 /// @ingroup ffxDof
-#define FFX_DOF_CONTEXT_SIZE  (45674)
+#define FFX_DOF_CONTEXT_SIZE  (45676)
 
 #if defined(__cplusplus)
 extern "C" {
@@ -56,8 +56,12 @@
 
 /// The size of the context specified in 32bit values.
 ///
+/// Was 27448 before SDK 1.1.3, where the <c><i>FfxInterface</i></c> embedded in the
+/// context description grew by <c><i>fpCreatePipelines</i></c>. Contexts are not
+/// binary compatible with earlier builds.
+///
 /// @ingroup ffxFsr1
-#define FFX_FSR1_CONTEXT_SIZE       (27448)
+#define FFX_FSR1_CONTEXT_SIZE       (27450)
 
 #if defined(__cplusplus)
 extern "C" {
@@ -393,6 +393,43 @@ typedef FfxErrorCode (*FfxCreatePipelineFunc)(
     FfxUInt32 effectContextId,
     FfxPipelineState* outPipeline);
 
+/// A structure describing one pipeline of a batch passed to <c><i>FfxCreatePipelinesFunc</i></c>.
+///
+/// @ingroup FfxInterface
+typedef struct FfxPipelineCreateDescription
+{
+    FfxPass                         pass;                   ///< The identifier for the pass.
+    uint32_t                        permutationOptions;     ///< The permutation options used to select the shader blob.
+    const FfxPipelineDescription*   pipelineDescription;    ///< A pointer to a <c><i>FfxPipelineDescription</i></c> describing the pipeline to be created.
+    FfxPipelineState*               outPipeline;            ///< A pointer to a <c><i>FfxPipelineState</i></c> structure which should be populated.
+} FfxPipelineCreateDescription;
+
+/// Create a batch of independent render pipelines for one effect.
+///
+/// Equivalent to calling <c><i>FfxCreatePipelineFunc</i></c> for each entry,
+/// but allows the backend to compile the pipelines concurrently. Every
+/// <c><i>pipelineDescription</i></c> and <c><i>outPipeline</i></c> must remain
+/// valid until the call returns.
+///
+/// @param [in] backendInterface                    A pointer to the backend interface.
+/// @param [in] effect                              The effect the pipelines belong to.
+/// @param [in] pipelineCreateDescriptions          An array of <c><i>FfxPipelineCreateDescription</i></c> structures.
+/// @param [in] pipelineCount                       The number of entries in <c><i>pipelineCreateDescriptions</i></c>.
+/// @param [in] effectContextId                     The context space to be used for the effect in question.
+///
+/// @retval
+/// FFX_OK                                          The operation completed successfully.
+/// @retval
+/// Anything else                                   The operation failed.
+///
+/// @ingroup FfxInterface
+typedef FfxErrorCode (*FfxCreatePipelinesFunc)(
+    FfxInterface* backendInterface,
+    FfxEffect effect,
+    const FfxPipelineCreateDescription* pipelineCreateDescriptions,
+    uint32_t pipelineCount,
+    FfxUInt32 effectContextId);
+
 typedef FfxErrorCode(*FfxGetPermutationBlobByIndexFunc)(FfxEffect effectId,
     FfxPass passId,
     FfxBindStage bindStage,
@@ -590,6 +627,7 @@ typedef void(*FfxRegisterConstantBufferAllocatorFunc)(FfxInterface* backendInter
 ///   - <c><i>FfxGetResourceDescriptionFunc</i></c>
 ///   - <c><i>FfxDestroyResourceFunc</i></c>
 ///   - <c><i>FfxCreatePipelineFunc</i></c>
+///   - <c><i>FfxCreatePipelinesFunc</i></c>
 ///   - <c><i>FfxDestroyPipelineFunc</i></c>
 ///   - <c><i>FfxScheduleGpuJobFunc</i></c>
 ///   - <c><i>FfxExecuteGpuJobsFunc</i></c>
@@ -656,6 +694,11 @@ typedef struct FfxInterface {
     size_t                             scratchBufferSize;             ///< Size of the buffer pointed to by <c><i>scratchBuffer</i></c>.
     FfxDevice                          device;                        ///< A backend specific device
 
+    // Added after the FidelityFX SDK 1.1 members to keep their offsets unchanged. This still grows FfxInterface by one
+    // pointer, and with it every effect context description and context embedding one, so binaries built against
+    // earlier headers (including custom backends) have to be rebuilt. See docs/whats-new/index.md.
+    FfxCreatePipelinesFunc             fpCreatePipelines;             ///< A callback function to create a batch of pipelines. May be <c><i>NULL</i></c> for custom backends.
+
 } FfxInterface;
 
 #if defined(__cplusplus)
@@ -56,8 +56,12 @@
 
 /// The size of the context specified in 32bit values.
 ///
+/// Was 9300 before SDK 1.1.3, where the context started keeping the inputs its
+/// constants were set up from, so steady dispatches can reuse them. Contexts are
+/// not binary compatible with earlier builds.
+///
 /// @ingroup FfxLpm
-#define FFX_LPM_CONTEXT_SIZE (9300)
+#define FFX_LPM_CONTEXT_SIZE (9324)
 
 #if defined(__cplusplus)
 extern "C" {
@@ -156,6 +160,48 @@ typedef struct FfxLpmDispatchDescription
     float             displayMaxLuminance;
 } FfxLpmDispatchDescription;
 
+/// The tone and gamut mapping constants consumed by <c><i>ffxLpmFilterCpu</i></c>.
+///
+/// Set up by <c><i>ffxLpmCalculateCpuConstants</i></c> from the same inputs, and
+/// with the same <c><i>FfxCalculateLpmConsts</i></c> call, as the constants of
+/// a GPU dispatch. Can be reused for any number of images.
+///
+/// @ingroup FfxLpm
+typedef struct FfxLpmCpuConstants
+{
+    uint32_t ctl[24 * 4];   ///< The control block written by <c><i>FfxCalculateLpmConsts</i></c>.
+    uint32_t shoulder;      ///< Use optional extra shoulderContrast tuning.
+    uint32_t con;           ///< Use first RGB conversion matrix.
+    uint32_t soft;          ///< Use soft gamut mapping.
+    uint32_t con2;          ///< Use last RGB conversion matrix.
+    uint32_t clip;          ///< Use clipping in last conversion matrix.
+    uint32_t scaleOnly;     ///< Scale only for last conversion matrix.
+    uint32_t displayMode;   ///< The <c><i>FfxLpmDisplayMode</i></c> the output is encoded for.
+    uint32_t pad;
+} FfxLpmCpuConstants;
+
+/// A structure encapsulating the parameters for filtering an image on the CPU
+/// with <c><i>ffxLpmFilterCpu</i></c>.
+///
+/// Images are tightly packed RGBA 32-bit float pixels, rows may be padded.
+/// Input is linear color, output is encoded the same way as the GPU filter
+/// encodes it for the display mode (gamma 2.2 for LDR, ST2084 for the 2084
+/// modes, linear otherwise). Alpha is passed through. The input and output
+/// may be the same image.
+///
+/// @ingroup FfxLpm
+typedef struct FfxLpmCpuFilterDescription
+{
+    const FfxLpmCpuConstants*   constants;          ///< The constants from <c><i>ffxLpmCalculateCpuConstants</i></c>.
+    const float*                input;              ///< The first pixel of the linear RGBA input image.
+    float*                      output;             ///< The first pixel of the RGBA output image.
+    uint32_t                    width;              ///< The width of both images in pixels.
+    uint32_t                    height;             ///< The height of both images in pixels.
+    size_t                      inputRowPitch;      ///< The distance between input rows in bytes, 0 if rows are tightly packed.
+    size_t                      outputRowPitch;     ///< The distance between output rows in bytes, 0 if rows are tightly packed.
+    uint32_t                    threadCount;        ///< The number of threads to filter with, 0 to use every hardware thread.
+} FfxLpmCpuFilterDescription;
+
 /// A structure encapsulating the FidelityFX Luma Preserving 1.0 context.
 ///
 /// This sets up an object which contains all persistent internal data and
@@ -232,6 +278,41 @@ FFX_API FfxErrorCode ffxLpmContextDispatch(FfxLpmContext* pContext, const FfxLpm
 /// @ingroup FfxLpm
 FFX_API FfxErrorCode ffxLpmContextDestroy(FfxLpmContext* pContext);
 
+/// Sets up the constants for filtering images on the CPU.
+///
+/// Only the tone and gamut mapping members of <c><i>pDispatchDescription</i></c>
+/// are used, the command list and resources are ignored.
+///
+/// @param [out] pConstants              A pointer to a <c><i>FfxLpmCpuConstants</i></c> structure to populate.
+/// @param [in]  pDispatchDescription    A pointer to a <c><i>FfxLpmDispatchDescription</i></c> structure.
+///
+/// @retval
+/// FFX_OK                              The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER           The operation failed because either <c><i>pConstants</i></c> or <c><i>pDispatchDescription</i></c> was <c><i>NULL</i></c>.
+///
+/// @ingroup FfxLpm
+FFX_API FfxErrorCode ffxLpmCalculateCpuConstants(FfxLpmCpuConstants* pConstants, const FfxLpmDispatchDescription* pDispatchDescription);
+
+/// Tone and gamut maps an image on the CPU.
+///
+/// Produces the same result as a GPU dispatch of the 32-bit LPM filter, up to
+/// the precision of the vectorized transcendental functions. Uses AVX2, SSE2
+/// or NEON depending on what the SDK was compiled for, and splits the image in
+/// bands of rows over <c><i>threadCount</i></c> threads.
+///
+/// @param [in]  pFilterDescription      A pointer to a <c><i>FfxLpmCpuFilterDescription</i></c> structure.
+///
+/// @retval
+/// FFX_OK                              The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER           The operation failed because <c><i>pFilterDescription</i></c>, its constants or one of its images was <c><i>NULL</i></c>.
+/// @retval
+/// FFX_ERROR_INVALID_ARGUMENT          The operation failed because a row pitch is smaller than a row of pixels.
+///
+/// @ingroup FfxLpm
+FFX_API FfxErrorCode ffxLpmFilterCpu(const FfxLpmCpuFilterDescription* pFilterDescription);
+
 /// Sets up the constant buffer data necessary for LPM compute
 /// 
 /// @param [in] incon                   
@@ -56,8 +56,12 @@
 
 /// The size of the context specified in 32bit values.
 ///
+/// Was 373794 before SDK 1.1.3, where the <c><i>FfxInterface</i></c> embedded in the
+/// context description grew by <c><i>fpCreatePipelines</i></c>. Contexts are not
+/// binary compatible with earlier builds.
+///
 /// @ingroup FfxParallelSort
-#define FFX_PARALLELSORT_CONTEXT_SIZE      (373794)
+#define FFX_PARALLELSORT_CONTEXT_SIZE      (373796)
 
 #if defined(__cplusplus)
 extern "C" {
@@ -55,8 +55,12 @@
 
 /// The size of the context specified in 32bit values.
 ///
+/// Was 118914 before SDK 1.1.3, where the <c><i>FfxInterface</i></c> embedded in the
+/// context description grew by <c><i>fpCreatePipelines</i></c>. Contexts are not
+/// binary compatible with earlier builds.
+///
 /// @ingroup FfxSssr
-#define FFX_SSSR_CONTEXT_SIZE (118914)
+#define FFX_SSSR_CONTEXT_SIZE (118916)
 
 #if defined(__cplusplus)
 extern "C" {
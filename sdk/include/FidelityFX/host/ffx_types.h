@@ -469,6 +469,7 @@ typedef enum FfxGpuJobType {
     FFX_GPU_JOB_BARRIER = 3,                        ///< The GPU job is performing a barrier.
 
     FFX_GPU_JOB_DISCARD = 4,                        ///< The GPU job is performing a floating-point clear.
+    FFX_GPU_JOB_COMPUTE_COMPACT = 5,                ///< The GPU job is performing a compute dispatch described by a <c><i>FfxCompactComputeJobDescription</i></c>. Only scheduled on backends reporting <c><i>compactComputeJobsSupported</i></c>.
 
 } FfxGpuJobType;
 
@@ -665,6 +666,7 @@ typedef struct FfxDeviceCapabilities {
     bool                            bufferMarkerSupported;                      ///< The device supports AMD buffer markers.
     bool                            extendedSynchronizationSupported;           ///< The device supports extended synchronization mechanism.
     bool                            shaderStorageBufferArrayNonUniformIndexing; ///< The device supports shader storage buffer array non uniform indexing.
+    bool                            compactComputeJobsSupported;                ///< The backend executes <c><i>FFX_GPU_JOB_COMPUTE_COMPACT</i></c> jobs.
 } FfxDeviceCapabilities;
 
 /// A structure encapsulating a 2-dimensional point, using 32bit unsigned integers.
@@ -1090,6 +1092,33 @@ typedef struct FfxComputeJobDescription {
 #endif
 } FfxComputeJobDescription;
 
+/// A structure describing a compute render job by reference.
+///
+/// Unlike <c><i>FfxComputeJobDescription</i></c>, the pipeline (and with it the
+/// binding layout) is referenced rather than copied, and only the resource slots the
+/// pipeline actually uses are provided, as dense arrays in pipeline binding order
+/// (i.e. <c><i>srvTextures[i]</i></c> is bound to <c><i>pipeline->srvTextureBindings[i]</i></c>).
+/// Each array must hold the matching <c><i>pipeline</i></c> count of entries and may
+/// be <c><i>NULL</i></c> when that count is zero.
+///
+/// The resource arrays are copied by the backend when the job is scheduled, so they
+/// may live on the caller's stack. The pipeline must remain valid until the job
+/// has been executed.
+///
+/// @ingroup SDKTypes
+typedef struct FfxCompactComputeJobDescription {
+
+    const FfxPipelineState*         pipeline;                               ///< Compute pipeline for the render job.
+    uint32_t                        dimensions[3];                          ///< Dispatch dimensions.
+    FfxResourceInternal             cmdArgument;                            ///< Dispatch indirect cmd argument buffer
+    uint32_t                        cmdArgumentOffset;                      ///< Dispatch indirect offset within the cmd argument buffer
+    const FfxTextureSRV*            srvTextures;                            ///< <c><i>pipeline->srvTextureCount</i></c> SRV texture resources.
+    const FfxBufferSRV*             srvBuffers;                             ///< <c><i>pipeline->srvBufferCount</i></c> SRV buffer resources.
+    const FfxTextureUAV*            uavTextures;                            ///< <c><i>pipeline->uavTextureCount</i></c> UAV texture resources.
+    const FfxBufferUAV*             uavBuffers;                             ///< <c><i>pipeline->uavBufferCount</i></c> UAV buffer resources.
+    const FfxConstantBuffer*        cbs;                                    ///< <c><i>pipeline->constCount</i></c> constant buffers.
+} FfxCompactComputeJobDescription;
+
 typedef struct FfxRasterJobDescription
 {
     FfxPipelineState                pipeline;                               ///< Raster pipeline for the render job.
@@ -1133,6 +1162,7 @@ typedef struct FfxGpuJobDescription{
         FfxClearFloatJobDescription clearJobDescriptor;                     ///< Clear job descriptor. Valid when <c><i>jobType</i></c> is <c><i>FFX_RENDER_JOB_CLEAR_FLOAT</i></c>.
         FfxCopyJobDescription       copyJobDescriptor;                      ///< Copy job descriptor. Valid when <c><i>jobType</i></c> is <c><i>FFX_RENDER_JOB_COPY</i></c>.
         FfxComputeJobDescription    computeJobDescriptor;                   ///< Compute job descriptor. Valid when <c><i>jobType</i></c> is <c><i>FFX_RENDER_JOB_COMPUTE</i></c>.
+        FfxCompactComputeJobDescription compactComputeJobDescriptor;        ///< Compact compute job descriptor. Valid when <c><i>jobType</i></c> is <c><i>FFX_GPU_JOB_COMPUTE_COMPACT</i></c>.
         FfxRasterJobDescription     rasterJobDescriptor;
         FfxBarrierDescription       barrierDescriptor;
         FfxDiscardJobDescription    discardJobDescriptor;
@@ -1285,6 +1315,21 @@ typedef struct FfxEffectMemoryUsage
     uint64_t aliasableUsageInBytes;
 } FfxEffectMemoryUsage;
 
+/// Occupancy of a backend's fallback constant buffer ring.
+///
+/// @ingroup SDKTypes
+typedef struct FfxConstantRingStatistics
+{
+    uint64_t capacityInBytes;           ///< Size of the ring.
+    uint64_t blockSizeInBytes;          ///< Granularity at which effect contexts claim ring space.
+    uint32_t blockCount;                ///< Number of blocks in the ring.
+    uint32_t blocksInFlight;            ///< Blocks written within the last <c><i>FFX_MAX_QUEUED_FRAMES</i></c> frames of their effect context.
+    uint64_t allocationCount;           ///< Number of constant buffer allocations served.
+    uint64_t allocatedBytes;            ///< Bytes handed out, including alignment padding.
+    uint64_t stallCount;                ///< Number of times the ring ran out of retired blocks and the backend waited for the GPU.
+    uint64_t failedAllocationCount;     ///< Allocations that could not be served without overwriting in-flight constants.
+} FfxConstantRingStatistics;
+
 //struct definition matches FfxApiSwapchainFramePacingTuning
 typedef struct FfxSwapchainFramePacingTuning
 {
@@ -1295,6 +1340,15 @@ typedef struct FfxSwapchainFramePacingTuning
     bool     allowWaitForSingleObjectOnFence; //Allows to call WaitForSingleObject() instead of spinning for fence value.
 } FfxSwapchainFramePacingTuning;
 
+//enum values match FfxApiSwapchainFrameTimePredictor
+typedef enum FfxSwapchainFrameTimePredictor
+{
+    FFX_SWAPCHAIN_FRAMETIME_PREDICTOR_MOVING_AVERAGE      = 0, ///< Mean and standard deviation of the last 10 frames. The default.
+    FFX_SWAPCHAIN_FRAMETIME_PREDICTOR_EXPONENTIAL_AVERAGE = 1, ///< Exponentially weighted mean and standard deviation, reacts faster to load changes.
+    FFX_SWAPCHAIN_FRAMETIME_PREDICTOR_MEDIAN              = 2, ///< Median and median absolute deviation of the last 9 frames, ignores isolated spikes and paces frame times alternating between two costs evenly.
+    FFX_SWAPCHAIN_FRAMETIME_PREDICTOR_PERCENTILE          = 3, ///< Low percentile of the last 32 frames, chosen from the variance factor. Adds the least latency, but paces alternating frame times unevenly.
+} FfxSwapchainFrameTimePredictor;
+
 #ifdef __cplusplus
 }
 #endif  // #ifdef __cplusplus
@@ -23,6 +23,7 @@
 #pragma once
 
 #include <FidelityFX/host/ffx_types.h>
+#include <type_traits>
 
 /// @defgroup Utils Utilities
 /// Utility Macros used by the FidelityFX SDK
@@ -188,3 +189,23 @@ inline uint8_t ffxCountBitsSet(uint32_t val) noexcept
     return static_cast<uint8_t>(((c >> 16) + c) & 0x0000FFFF);
 #endif
 }
+
+/// Hashes the name of a shader resource binding (32-bit FNV-1a over its code units).
+///
+/// Effects use these hashes to resolve their resource bindings without comparing
+/// names. Binding names are ASCII, so narrow and wide strings of the same name
+/// hash to the same value.
+///
+/// @param [in] name Null terminated binding name.
+///
+/// @return The hash of the name.
+///
+/// @ingroup Utils
+template<typename CharType>
+constexpr uint32_t ffxHashResourceBindingName(const CharType* name) noexcept
+{
+    uint32_t hash = 2166136261u;
+    for (; *name; ++name)
+        hash = (hash ^ static_cast<uint32_t>(static_cast<typename std::make_unsigned<CharType>::type>(*name))) * 16777619u;
+    return hash;
+}
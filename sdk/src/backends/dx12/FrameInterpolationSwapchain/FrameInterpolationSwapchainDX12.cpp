@@ -88,6 +88,12 @@ FfxErrorCode ffxConfigureFrameInterpolationSwapchainDX12(FfxSwapchain gameSwapCh
                     framinterpolationSwapchain->setFramePacingTuning(static_cast<FfxSwapchainFramePacingTuning*>(valuePtr));
                 }
             break;
+            case FFX_FI_SWAPCHAIN_CONFIGURE_KEY_FRAMETIMEPREDICTOR:
+                if (valuePtr != nullptr)
+                {
+                    framinterpolationSwapchain->setFrameTimePredictor(*static_cast<FfxSwapchainFrameTimePredictor*>(valuePtr));
+                }
+            break;
         }
         SafeRelease(framinterpolationSwapchain);
 
@@ -424,6 +430,8 @@ DWORD WINAPI presenterThread(LPVOID param)
         TIMECAPS timerCaps;
         timerCaps.wPeriodMin = UNKNOWN_TIMER_RESOlUTION; //Default to unknown to prevent sleep without guarantees.
 
+        FfxPreciseWait preciseWait{};
+
         presenter->previousPresentQpc = 0;
 
         while (!presenter->shutdown)
@@ -473,7 +481,7 @@ DWORD WINAPI presenterThread(LPVOID param)
                             // pacing without composition
                             waitForFenceValue(presenter->compositionFenceGPU, frameInfo.presentIndex);
                             uint64_t targetQpc = presenter->previousPresentQpc + frameInfo.presentQpcDelta;
-                            waitForPerformanceCount(targetQpc, qpcFrequency, timerCaps.wPeriodMin, presenter->hybridSpinTime);
+                            waitForPerformanceCount(preciseWait, targetQpc, qpcFrequency, timerCaps.wPeriodMin, presenter->hybridSpinTime);
 
                             int64_t currentPresentQPC;
                             QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&currentPresentQPC));
@@ -509,9 +517,8 @@ DWORD WINAPI interpolationThread(LPVOID param)
             SetThreadPriority(presenterThreadHandle, THREAD_PRIORITY_HIGHEST);
             SetThreadDescription(presenterThreadHandle, L"AMD FSR Presenter Thread");
 
-            SimpleMovingAverage<10, double> frameTime{};
+            FfxFramePacer framePacer{};
 
-            int64_t previousQpc = 0;
             int64_t previousDelta = 0;
             int64_t qpcFrequency;
             QueryPerformanceFrequency(reinterpret_cast<LARGE_INTEGER*>(&qpcFrequency)); 
@@ -563,25 +570,8 @@ DWORD WINAPI interpolationThread(LPVOID param)
                     int64_t currentQpc = 0;
                     QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&currentQpc));
 
-                    const double deltaQpc = double(currentQpc - previousQpc) * (previousQpc > 0);
-                    previousQpc           = currentQpc;
-
-                    // reset pacing averaging if delta > 10 fps,
-                    const float fTimeoutInSeconds       = 0.1f;
-                    double      deltaQpcResetThreashold = double(qpcFrequency * fTimeoutInSeconds);
-                    if ((deltaQpc > deltaQpcResetThreashold) || presenter->resetTimer)
-                    {
-                        frameTime.reset();
-                    }
-                    else
-                    {
-                        frameTime.update(deltaQpc);
-                    }
-
-                    // set presentation time: reduce based on variance and subract safety margin so we don't lock on a framerate lower than necessary
-                    int64_t qpcSafetyMargin         = int64_t(qpcFrequency * presenter->safetyMarginInSec);
-                    const int64_t conservativeAvg   = int64_t(frameTime.getAverage() * 0.5 - frameTime.getVariance() * presenter->varianceFactor);
-                    const int64_t deltaToUse        = conservativeAvg > qpcSafetyMargin ? (conservativeAvg - qpcSafetyMargin) : 0;
+                    const int64_t deltaToUse = framePacer.update(currentQpc, qpcFrequency, presenter->resetTimer, presenter->safetyMarginInSec, presenter->varianceFactor,
+                                                                 FfxSwapchainFrameTimePredictor(presenter->frameTimePredictor));
                     entry.frames[PacingData::FrameType::Interpolated_1].presentQpcDelta = deltaToUse;
                     entry.frames[PacingData::FrameType::Real].presentQpcDelta           = deltaToUse;
                     previousDelta                                                       = deltaToUse;
@@ -1234,6 +1224,11 @@ void FrameInterpolationSwapChainDX12::setFramePacingTuning(const FfxSwapchainFra
     presentInfo.allowWaitForSingleObjectOnFence = framePacingTuning->allowWaitForSingleObjectOnFence;
 }
 
+void FrameInterpolationSwapChainDX12::setFrameTimePredictor(FfxSwapchainFrameTimePredictor predictor)
+{
+    presentInfo.frameTimePredictor = predictor;
+}
+
 void FrameInterpolationSwapChainDX12::GetGpuMemoryUsage(FfxEffectMemoryUsage* vramUsage)
 {
     vramUsage->totalUsageInBytes = totalUsageInBytes;
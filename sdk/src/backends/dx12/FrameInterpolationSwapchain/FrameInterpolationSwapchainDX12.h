@@ -117,6 +117,7 @@ typedef struct FrameinterpolationPresentInfo
     volatile bool       allowHybridSpin         = false;
     volatile uint32_t   hybridSpinTime          = 2; //Measured in system timer resolution units. Default is 2. Below 1 will frequently result in overshoot. Overshoots stop showing up >=2.
     volatile bool       allowWaitForSingleObjectOnFence = false;
+    volatile uint32_t   frameTimePredictor      = FFX_SWAPCHAIN_FRAMETIME_PREDICTOR_MOVING_AVERAGE;
     
     FfxWaitCallbackFunc waitCallback            = nullptr;
 
@@ -234,6 +235,7 @@ public:
     void registerUiResource(FfxResource uiResource, uint32_t flags);
     void setWaitCallback(FfxWaitCallbackFunc waitCallbackFunc);
     void setFramePacingTuning(const FfxSwapchainFramePacingTuning* framePacingTuning);
+    void setFrameTimePredictor(FfxSwapchainFrameTimePredictor predictor);
 
     void GetGpuMemoryUsage(FfxEffectMemoryUsage * vramUsage);
 
@@ -43,33 +43,35 @@ IDXGIFactory* getDXGIFactoryFromSwapChain(IDXGISwapChain* swapChain)
     return factory;
 }
 
-void waitForPerformanceCount(const int64_t targetCount, const int64_t frequency, const UINT timerResolution, const UINT spinTime)
+static int64_t getPerformanceCount(void*)
 {
     int64_t currentCount;
     QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&currentCount));
-    if (currentCount >= targetCount)
-        return;
-        
-    double millis = static_cast<double>(((targetCount - currentCount) * 1000000) / frequency) / 1000.;
-
-    //Sleep if safe, to free up cores.
-    while (timerResolution != UNKNOWN_TIMER_RESOlUTION && millis > spinTime * timerResolution)
-    {
-        MMRESULT result = timeBeginPeriod(timerResolution);           //Request 1ms timer resolution from OS. Necessary to prevent overshooting sleep.
-        if (result != TIMERR_NOERROR)
-            break; //Can't guarantee sleep precision.              
-        Sleep(static_cast<DWORD>((millis - timerResolution*spinTime)));  //End sleep a few timer resolution units early to prevent overshooting.
-        timeEndPeriod(timerResolution);
+    return currentCount;
+}
 
-        QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&currentCount));
+static bool sleepWithTimerResolution(void*, uint32_t milliseconds, uint32_t timerResolution)
+{
+    MMRESULT result = timeBeginPeriod(timerResolution);           //Request 1ms timer resolution from OS. Necessary to prevent overshooting sleep.
+    if (result != TIMERR_NOERROR)
+        return false;
+    Sleep(static_cast<DWORD>(milliseconds));
+    timeEndPeriod(timerResolution);
+    return true;
+}
 
-        millis = static_cast<double>(((targetCount - currentCount) * 1000000) / frequency) / 1000.;
-    }
+FfxFramePacingTimer getPerformanceCounterTimer(const int64_t frequency)
+{
+    FfxFramePacingTimer timer = {};
+    timer.frequency           = frequency;
+    timer.getCount            = getPerformanceCount;
+    timer.sleep               = sleepWithTimerResolution;
+    return timer;
+}
 
-    do
-    {
-        QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&currentCount));
-    } while (currentCount < targetCount);
+FfxFramePacingWaitStats waitForPerformanceCount(FfxPreciseWait& preciseWait, const int64_t targetCount, const int64_t frequency, const UINT timerResolution, const UINT spinTime)
+{
+    return preciseWait.waitForCount(getPerformanceCounterTimer(frequency), targetCount, timerResolution, spinTime);
 }
 
 bool waitForFenceValue(ID3D12Fence* fence, UINT64 value, DWORD dwMilliseconds, FfxWaitCallbackFunc waitCallback, const bool waitForSingleObjectOnFence)
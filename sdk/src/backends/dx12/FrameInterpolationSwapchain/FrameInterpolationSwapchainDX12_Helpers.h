@@ -30,15 +30,17 @@
 #include <synchapi.h>
 
 #include <FidelityFX/host/ffx_assert.h>
+#include <ffx_frame_pacing.h>
 
 typedef int32_t FfxErrorCode;
 typedef FfxErrorCode(*FfxWaitCallbackFunc)(wchar_t* fenceName, uint64_t fenceValueToWaitFor);
 
-constexpr UINT UNKNOWN_TIMER_RESOlUTION = 0;  //Timer resolution is not known. 
+constexpr UINT UNKNOWN_TIMER_RESOlUTION = FFX_FRAME_PACING_UNKNOWN_TIMER_RESOLUTION;  //Timer resolution is not known. 
 
 IDXGIFactory*           getDXGIFactoryFromSwapChain(IDXGISwapChain* swapChain);
 bool                    isExclusiveFullscreen(IDXGISwapChain* swapChain);
-void                    waitForPerformanceCount(const int64_t targetCount, const int64_t frequency, const UINT timerResolution, const UINT spinTime);
+FfxFramePacingTimer     getPerformanceCounterTimer(const int64_t frequency);
+FfxFramePacingWaitStats waitForPerformanceCount(FfxPreciseWait& preciseWait, const int64_t targetCount, const int64_t frequency, const UINT timerResolution, const UINT spinTime);
 bool                    waitForFenceValue(ID3D12Fence* fence, UINT64 value, DWORD dwMilliseconds = INFINITE, FfxWaitCallbackFunc waitCallback = nullptr, const bool waitForSingleObjectOnFence = false);
 bool                    isTearingSupported(IDXGIFactory* dxgiFactory);
 bool                    getMonitorLuminanceRange(IDXGISwapChain* swapChain, float* outMinLuminance, float* outMaxLuminance);
@@ -300,65 +302,3 @@ public:
     }
 };
 
-template <const int Size, typename Type = double>
-struct SimpleMovingAverage
-{
-    Type                    history[Size] = {};
-    unsigned int            idx           = 0;
-    unsigned int            updateCount   = 0;
-
-    Type getAverage()
-    {
-        if (updateCount < Size)
-            return 0.0;
-
-        Type          average    = 0.f;
-        unsigned int  iterations = (updateCount >= Size) ? Size : updateCount;
-        
-        if (iterations > 0)
-        {
-            for (size_t i = 0; i < iterations; i++)
-            {
-                average += history[i];
-            }
-            average /= iterations;
-        }
-
-        return average;
-    }
-
-    Type getVariance()
-    {
-        if (updateCount < Size)
-            return 0.0;
-
-        Type average  = getAverage();
-        Type variance = 0.f;
-        unsigned int iterations = (updateCount >= Size) ? Size : updateCount;
-
-        if (iterations > 0)
-        {
-            for (size_t i = 0; i < iterations; i++)
-            {
-                variance += (history[i] - average) * (history[i] - average);
-            }
-            variance /= iterations;
-        }
-
-        return sqrt(variance);
-    }
-
-    void reset()
-    {
-        updateCount = 0;
-        idx         = 0;
-    }
-
-    void update(Type newValue)
-    {
-        history[idx] = newValue;
-        idx          = (idx + 1) % Size;
-        updateCount++;
-    }
-};
-
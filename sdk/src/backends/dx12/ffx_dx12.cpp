@@ -26,7 +26,10 @@
 #include <FidelityFX/host/backends/dx12/ffx_dx12.h>
 #include <FidelityFX/host/backends/dx12/d3dx12.h>
 #include <ffx_shader_blobs.h>
+#include <ffx_compute_job.h>
 #include <ffx_breadcrumbs_list.h>
+#include <ffx_constant_ring.h>
+#include <ffx_pipeline_cache.h>
 #include <codecvt>  // convert string to wstring
 #include <memoryapi.h> // for VirtualAlloc
 #include <mutex>
@@ -82,6 +85,7 @@ FfxErrorCode RegisterStaticResourceDX12(FfxInterface* backendInterface, const Ff
 FfxResourceDescription GetResourceDescriptorDX12(FfxInterface* backendInterface, FfxResourceInternal resource);
 FfxErrorCode StageConstantBufferDataDX12(FfxInterface* backendInterface, void* data, FfxUInt32 size, FfxConstantBuffer* constantBuffer);
 FfxErrorCode CreatePipelineDX12(FfxInterface* backendInterface, FfxEffect effect, FfxPass passId, uint32_t permutationOptions, const FfxPipelineDescription*  desc, FfxUInt32 effectContextId, FfxPipelineState* outPass);
+FfxErrorCode CreatePipelinesDX12(FfxInterface* backendInterface, FfxEffect effect, const FfxPipelineCreateDescription* descs, uint32_t count, FfxUInt32 effectContextId);
 FfxErrorCode DestroyPipelineDX12(FfxInterface* backendInterface, FfxPipelineState* pipeline, FfxUInt32 effectContextId);
 FfxErrorCode ScheduleGpuJobDX12(FfxInterface* backendInterface, const FfxGpuJobDescription* job);
 FfxErrorCode ExecuteGpuJobsDX12(FfxInterface* backendInterface, FfxCommandList commandList, FfxUInt32 effectContextId);
@@ -181,12 +185,16 @@ typedef struct BackendContext_DX12 {
     EffectContext*              pEffectContexts;
 
     // Allocation defaults
-    FfxConstantAllocation       FallbackConstantAllocator(void* data, FfxUInt64 dataSize);
+    FfxConstantAllocation       FallbackConstantAllocator(void* data, FfxUInt64 dataSize, FfxUInt32 effectContextId);
     void*                       constantBufferMem;
     ID3D12Resource*             constantBufferResource;
     uint32_t                    constantBufferSize;
-    uint32_t                    constantBufferOffset;
-    std::mutex                  constantBufferMutex;
+    std::once_flag              constantBufferCreated;
+    FfxConstantRing             constantRing;
+    void*                       pConstantRingContexts;
+
+    // Pipeline objects shared by the effect contexts
+    FfxSharedPipelineCache      pipelineCache;
 
 } BackendContext_DX12;
 
@@ -217,8 +225,10 @@ FFX_API size_t ffxGetScratchMemorySizeDX12(size_t maxContexts)
     uint32_t contextArraySize           = FFX_ALIGN_UP(maxContexts * sizeof(BackendContext_DX12::EffectContext), sizeof(uint32_t));
     uint32_t stagingRingBufferArraySize = FFX_ALIGN_UP(maxContexts * FFX_CONSTANT_BUFFER_RING_BUFFER_SIZE, sizeof(uint32_t));
     uint32_t gpuJobDescArraySize        = FFX_ALIGN_UP(maxContexts * FFX_MAX_GPU_JOBS * sizeof(FfxGpuJobDescription), sizeof(uint32_t));
+    uint32_t constantRingContextArraySize = uint32_t(FfxConstantRing::getContextMemorySize(maxContexts));
 
-    return FFX_ALIGN_UP(sizeof(BackendContext_DX12) + resourceArraySize + contextArraySize + stagingRingBufferArraySize + gpuJobDescArraySize, sizeof(uint64_t));
+    return FFX_ALIGN_UP(sizeof(BackendContext_DX12) + resourceArraySize + contextArraySize + stagingRingBufferArraySize + gpuJobDescArraySize +
+                            constantRingContextArraySize, sizeof(uint64_t));
 }
 
 // Create a FfxDevice from a ID3D12Device*
@@ -263,6 +273,7 @@ FfxErrorCode ffxGetInterfaceDX12(
     backendInterface->fpGetResourceDescription = GetResourceDescriptorDX12;
     backendInterface->fpStageConstantBufferDataFunc = StageConstantBufferDataDX12;
     backendInterface->fpCreatePipeline = CreatePipelineDX12;
+    backendInterface->fpCreatePipelines = CreatePipelinesDX12;
     backendInterface->fpGetPermutationBlobByIndex = ffxGetPermutationBlobByIndex;
     backendInterface->fpDestroyPipeline = DestroyPipelineDX12;
     backendInterface->fpScheduleGpuJob = ScheduleGpuJobDX12;
@@ -301,6 +312,17 @@ FfxErrorCode ffxGetInterfaceDX12(
     return FFX_OK;
 }
 
+FfxErrorCode ffxGetConstantRingStatisticsDX12(FfxInterface* backendInterface, FfxConstantRingStatistics* statistics)
+{
+    FFX_RETURN_ON_ERROR(backendInterface, FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(statistics, FFX_ERROR_INVALID_POINTER);
+
+    BackendContext_DX12* backendContext = (BackendContext_DX12*)backendInterface->scratchBuffer;
+    backendContext->constantRing.getStatistics(statistics);
+
+    return FFX_OK;
+}
+
 FfxCommandList ffxGetCommandListDX12(ID3D12CommandList* cmdList)
 {
     FFX_ASSERT(NULL != cmdList);
@@ -380,16 +402,12 @@ void TIF(HRESULT result)
     }
 }
 
-FfxConstantAllocation BackendContext_DX12::FallbackConstantAllocator(void* data, FfxUInt64 dataSize)
+FfxConstantAllocation BackendContext_DX12::FallbackConstantAllocator(void* data, FfxUInt64 dataSize, FfxUInt32 effectContextId)
 {
     FfxConstantAllocation allocation;
-    std::lock_guard<std::mutex> cbLock{ constantBufferMutex };
-
-    if (!constantBufferMem)
-    {
-        // create dynamic ring buffer for constant uploads
-        constantBufferSize = FFX_ALIGN_UP(FFX_BUFFER_SIZE, 256) * maxEffectContexts * FFX_MAX_PASS_COUNT * FFX_MAX_QUEUED_FRAMES; // Size aligned to 256
 
+    std::call_once(constantBufferCreated, [this]() {
+        // create dynamic ring buffer for constant uploads, sized in CreateBackendContextDX12
         CD3DX12_RESOURCE_DESC constDesc = CD3DX12_RESOURCE_DESC::Buffer(constantBufferSize);
         CD3DX12_HEAP_PROPERTIES heap(D3D12_HEAP_TYPE_UPLOAD);
         TIF(device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE,
@@ -400,24 +418,22 @@ FfxConstantAllocation BackendContext_DX12::FallbackConstantAllocator(void* data,
         // map it
         TIF(constantBufferResource->Map(0, nullptr,
             (void**)&constantBufferMem));
-        constantBufferOffset = 0;
-    }
+    });
 
     FFX_ASSERT(constantBufferMem);
 
-    uint32_t size = FFX_ALIGN_UP(dataSize, 256);
-
-    // wrap as needed 
-    if (constantBufferOffset + size >= constantBufferSize)
-        constantBufferOffset = 0;
-
-    void* pBuffer = (void*)((uint8_t*)(constantBufferMem)+constantBufferOffset);
-    memcpy(pBuffer, data, (size_t)dataSize);
-
-    D3D12_GPU_VIRTUAL_ADDRESS bufferViewDesc = constantBufferResource->GetGPUVirtualAddress() + constantBufferOffset;
+    // The backend has no access to the application's queues, so it cannot wait for in-flight constants to retire
+    uint64_t offset = constantRing.allocate(effectContextId, dataSize);
+    FFX_ASSERT_MESSAGE(offset != FFX_CONSTANT_RING_INVALID_OFFSET, "FFXInterface: DX12: Out of constant buffer memory.");
+    if (offset != FFX_CONSTANT_RING_INVALID_OFFSET)
+    {
+        void* pBuffer = (void*)((uint8_t*)(constantBufferMem) + offset);
+        memcpy(pBuffer, data, (size_t)dataSize);
+    }
+    else
+        offset = 0;
 
-    // update the offset
-    constantBufferOffset += size;
+    D3D12_GPU_VIRTUAL_ADDRESS bufferViewDesc = constantBufferResource->GetGPUVirtualAddress() + offset;
 
     allocation.resource = FfxResource(); // Not needed for directx
     allocation.handle = FfxUInt64(bufferViewDesc);
@@ -985,7 +1001,8 @@ FfxErrorCode CreateBackendContextDX12(FfxInterface* backendInterface, FfxEffect
     // Set things up if this is the first invocation
     if (!backendContext->refCount) {
 
-        new (&backendContext->constantBufferMutex) std::mutex();
+        new (&backendContext->constantBufferCreated) std::once_flag();
+        new (&backendContext->constantRing) FfxConstantRing();
 
         if (dx12Device != NULL) {
 
@@ -999,8 +1016,14 @@ FfxErrorCode CreateBackendContextDX12(FfxInterface* backendInterface, FfxEffect
         uint32_t stagingRingBufferArraySize = FFX_ALIGN_UP(backendContext->maxEffectContexts * FFX_CONSTANT_BUFFER_RING_BUFFER_SIZE, sizeof(uint32_t));
         uint32_t contextArraySize = FFX_ALIGN_UP(backendContext->maxEffectContexts * sizeof(BackendContext_DX12::EffectContext), sizeof(uint32_t));
 
+        uint32_t constantRingContextArraySize = uint32_t(FfxConstantRing::getContextMemorySize(backendContext->maxEffectContexts));
+
         uint8_t* pMem = (uint8_t*)((BackendContext_DX12*)(backendContext + 1));
 
+        // Map constant ring context array first as it holds 64-bit atomics (initialized along with the constant buffer)
+        backendContext->pConstantRingContexts = pMem;
+        pMem += constantRingContextArraySize;
+
         // Map gpu job array
         backendContext->pGpuJobs = (FfxGpuJobDescription*)pMem;
         memset(backendContext->pGpuJobs, 0, gpuJobDescArraySize);
@@ -1020,6 +1043,10 @@ FfxErrorCode CreateBackendContextDX12(FfxInterface* backendInterface, FfxEffect
         backendContext->pEffectContexts = reinterpret_cast<BackendContext_DX12::EffectContext*>(pMem);
         memset(backendContext->pEffectContexts, 0, contextArraySize);
 
+        // The constant buffer itself is only created on first use, but its ring is ready for every context
+        backendContext->constantBufferSize = FFX_ALIGN_UP(FFX_BUFFER_SIZE, 256) * backendContext->maxEffectContexts * FFX_MAX_PASS_COUNT * FFX_MAX_QUEUED_FRAMES; // Size aligned to 256
+        backendContext->constantRing.initialize(backendContext->constantBufferSize, 256, backendContext->maxEffectContexts, backendContext->pConstantRingContexts);
+
         // CPUVisible
         D3D12_DESCRIPTOR_HEAP_DESC descHeap;
         descHeap.NumDescriptors = FFX_MAX_RESOURCE_COUNT * backendContext->maxEffectContexts;
@@ -1214,6 +1241,7 @@ FfxErrorCode GetDeviceCapabilitiesDX12(FfxInterface* backendInterface, FfxDevice
     deviceCapabilities->bufferMarkerSupported = false;
     deviceCapabilities->extendedSynchronizationSupported = false;
     deviceCapabilities->shaderStorageBufferArrayNonUniformIndexing = true;
+    deviceCapabilities->compactComputeJobsSupported = true;
 
     return FFX_OK;
 }
@@ -1235,6 +1263,9 @@ FfxErrorCode DestroyBackendContextDX12(FfxInterface* backendInterface, FfxUInt32
         }
     }
 
+    // the context's constants are no longer in flight
+    backendContext->constantRing.releaseContext(effectContextId);
+
     // Free up for use by another context
     effectContext.nextStaticResource = 0;
     effectContext.active = false;
@@ -1250,9 +1281,17 @@ FfxErrorCode DestroyBackendContextDX12(FfxInterface* backendInterface, FfxUInt32
             backendContext->constantBufferResource->Unmap(0, nullptr);
             backendContext->constantBufferResource->Release();
             backendContext->constantBufferMem = nullptr;
-            backendContext->constantBufferOffset = 0;
             backendContext->constantBufferSize = 0;
         }
+        new (&backendContext->constantRing) FfxConstantRing();
+
+        // drop the references held by the pipeline cache
+        backendContext->pipelineCache.clear([](FfxSharedPipeline& entry) {
+            reinterpret_cast<ID3D12RootSignature*>(entry.rootSignature)->Release();
+            if (entry.cmdSignature)
+                reinterpret_cast<ID3D12CommandSignature*>(entry.cmdSignature)->Release();
+            reinterpret_cast<ID3D12PipelineState*>(entry.pipeline)->Release();
+        });
 
         backendContext->gpuJobCount             = 0;
         backendContext->barrierCount            = 0;
@@ -2029,6 +2068,9 @@ FfxErrorCode UnregisterResourcesDX12(FfxInterface* backendInterface, FfxCommandL
     effectContext.nextDynamicResource      = (effectContextId * FFX_MAX_RESOURCE_COUNT) + FFX_MAX_RESOURCE_COUNT - 1;
     effectContext.nextDynamicUavDescriptor = (effectContextId * FFX_MAX_RESOURCE_COUNT) + FFX_MAX_RESOURCE_COUNT - 1;
 
+    // constants written this frame retire FFX_MAX_QUEUED_FRAMES frames from now
+    backendContext->constantRing.endFrame(effectContextId);
+
     return FFX_OK;
 }
 
@@ -2397,6 +2439,12 @@ FfxErrorCode CreatePipelineDX12(
     FfxShaderBlob shaderBlob = { };
     backendInterface->fpGetPermutationBlobByIndex(effect, pass, FFX_BIND_COMPUTE_SHADER_STAGE, permutationOptions, &shaderBlob);
     FFX_ASSERT(shaderBlob.data && shaderBlob.size);
+    FfxScopedPermutationBlob scopedShaderBlob = { &shaderBlob };
+
+    // Effect contexts sharing the backend reuse the objects of an identical pipeline, only its bindings are reflected again
+    FfxSharedPipeline        key            = {};
+    const bool               shareable      = FfxSharedPipelineCache::makeKey(effect, pass, permutationOptions, pipelineDescription, key);
+    const FfxSharedPipeline* sharedPipeline = shareable ? backendContext->pipelineCache.find(key) : nullptr;
 
     int32_t staticTextureSrvCount = 0;
     int32_t staticBufferSrvCount  = 0;
@@ -2706,7 +2754,11 @@ FfxErrorCode CreatePipelineDX12(
         //Do not pass hD3D12 handle to the FreeLibrary function, as GetModuleHandle will not increment refcount
         HMODULE d3d12ModuleHandle = GetModuleHandleW(L"D3D12.dll");
 
-        if (NULL != d3d12ModuleHandle) {
+        if (sharedPipeline) {
+
+            outPipeline->rootSignature = sharedPipeline->rootSignature;
+            reinterpret_cast<ID3D12RootSignature*>(outPipeline->rootSignature)->AddRef();
+        } else if (NULL != d3d12ModuleHandle) {
 
             D3D12SerializeRootSignatureType dx12SerializeRootSignatureType = (D3D12SerializeRootSignatureType)GetProcAddress(d3d12ModuleHandle, "D3D12SerializeRootSignature");
 
@@ -2746,7 +2798,13 @@ FfxErrorCode CreatePipelineDX12(
     ID3D12RootSignature* dx12RootSignature = reinterpret_cast<ID3D12RootSignature*>(outPipeline->rootSignature);
 
     // Only set the command signature if this is setup as an indirect workload
-    if (pipelineDescription->indirectWorkload)
+    if (sharedPipeline)
+    {
+        outPipeline->cmdSignature = sharedPipeline->cmdSignature;
+        if (outPipeline->cmdSignature)
+            reinterpret_cast<ID3D12CommandSignature*>(outPipeline->cmdSignature)->AddRef();
+    }
+    else if (pipelineDescription->indirectWorkload)
     {
         D3D12_INDIRECT_ARGUMENT_DESC argumentDescs = { D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH };
         D3D12_COMMAND_SIGNATURE_DESC commandSignatureDesc = {};
@@ -2918,6 +2976,14 @@ FfxErrorCode CreatePipelineDX12(
     //outPipeline->samplerCount      = shaderBlob.samplerCount;
     //outPipeline->rtAccelStructCount= shaderBlob.rtAccelStructCount;
         
+    if (sharedPipeline)
+    {
+        outPipeline->pipeline = sharedPipeline->pipeline;
+        reinterpret_cast<ID3D12PipelineState*>(outPipeline->pipeline)->AddRef();
+        wcscpy_s(outPipeline->name, pipelineDescription->name);
+        return FFX_OK;
+    }
+
     // create the PSO
     D3D12_COMPUTE_PIPELINE_STATE_DESC dx12PipelineStateDescription = {};
     dx12PipelineStateDescription.Flags = D3D12_PIPELINE_STATE_FLAG_NONE;
@@ -2932,6 +2998,39 @@ FfxErrorCode CreatePipelineDX12(
     reinterpret_cast<ID3D12PipelineState*>(outPipeline->pipeline)->SetName(pipelineDescription->name);
     wcscpy_s(outPipeline->name, pipelineDescription->name);
 
+    // keep a reference in the cache for the next effect context creating this pipeline
+    if (shareable)
+    {
+        if (FfxSharedPipeline* entry = backendContext->pipelineCache.insert(key))
+        {
+            entry->rootSignature = outPipeline->rootSignature;
+            entry->cmdSignature  = outPipeline->cmdSignature;
+            entry->pipeline      = outPipeline->pipeline;
+            reinterpret_cast<ID3D12RootSignature*>(entry->rootSignature)->AddRef();
+            if (entry->cmdSignature)
+                reinterpret_cast<ID3D12CommandSignature*>(entry->cmdSignature)->AddRef();
+            reinterpret_cast<ID3D12PipelineState*>(entry->pipeline)->AddRef();
+        }
+    }
+
+    return FFX_OK;
+}
+
+FfxErrorCode CreatePipelinesDX12(
+    FfxInterface* backendInterface,
+    FfxEffect effect,
+    const FfxPipelineCreateDescription* pipelineCreateDescriptions,
+    uint32_t pipelineCount,
+    FfxUInt32 effectContextId)
+{
+    FFX_ASSERT(NULL != pipelineCreateDescriptions || !pipelineCount);
+
+    for (uint32_t i = 0; i < pipelineCount; ++i)
+    {
+        const FfxPipelineCreateDescription& desc = pipelineCreateDescriptions[i];
+        FFX_VALIDATE(CreatePipelineDX12(backendInterface, effect, desc.pass, desc.permutationOptions, desc.pipelineDescription, effectContextId, desc.outPipeline));
+    }
+
     return FFX_OK;
 }
 
@@ -2981,14 +3080,17 @@ FfxErrorCode ScheduleGpuJobDX12(
 
     FFX_ASSERT(backendContext->gpuJobCount < FFX_MAX_GPU_JOBS);
 
-    backendContext->pGpuJobs[backendContext->gpuJobCount] = *job;
+    if (job->jobType == FFX_GPU_JOB_COMPUTE_COMPACT)
+        ffxStoreCompactComputeJob(&backendContext->pGpuJobs[backendContext->gpuJobCount], job);
+    else
+        backendContext->pGpuJobs[backendContext->gpuJobCount] = *job;
     backendContext->gpuJobCount++;
 
     return FFX_OK;
 }
 
 static FfxErrorCode executeGpuJobCompute(BackendContext_DX12*       backendContext,
-                                         FfxGpuJobDescription*      job,
+                                         FfxComputeJobView&         job,
                                          ID3D12GraphicsCommandList* dx12CommandList,
                                          FfxUInt32                  effectContextId)
 {
@@ -2998,7 +3100,7 @@ static FfxErrorCode executeGpuJobCompute(BackendContext_DX12*       backendConte
     ID3D12DescriptorHeap* dx12DescriptorHeap = reinterpret_cast<ID3D12DescriptorHeap*>(backendContext->descRingBuffer);
 
     // set root signature
-    ID3D12RootSignature* dx12RootSignature = reinterpret_cast<ID3D12RootSignature*>(job->computeJobDescriptor.pipeline.rootSignature);
+    ID3D12RootSignature* dx12RootSignature = reinterpret_cast<ID3D12RootSignature*>(job.pipeline->rootSignature);
     dx12CommandList->SetComputeRootSignature(dx12RootSignature);
 
     // set descriptor heap
@@ -3009,21 +3111,21 @@ static FfxErrorCode executeGpuJobCompute(BackendContext_DX12*       backendConte
     // bind texture & buffer UAVs (note the binding order here MUST match the root signature mapping order from CreatePipeline!)
     {
         // Set a baseline minimal value
-        uint32_t maximumUavIndex = job->computeJobDescriptor.pipeline.uavTextureCount + job->computeJobDescriptor.pipeline.uavBufferCount;
+        uint32_t maximumUavIndex = job.pipeline->uavTextureCount + job.pipeline->uavBufferCount;
 
-        for (uint32_t uavTextureBinding = 0; uavTextureBinding < job->computeJobDescriptor.pipeline.uavTextureCount; uavTextureBinding++)
+        for (uint32_t uavTextureBinding = 0; uavTextureBinding < job.pipeline->uavTextureCount; uavTextureBinding++)
         {
-            uint32_t slotIndex = job->computeJobDescriptor.pipeline.uavTextureBindings[uavTextureBinding].slotIndex +
-                                 job->computeJobDescriptor.pipeline.uavTextureBindings[uavTextureBinding].arrayIndex;
+            uint32_t slotIndex = job.pipeline->uavTextureBindings[uavTextureBinding].slotIndex +
+                                 job.pipeline->uavTextureBindings[uavTextureBinding].arrayIndex;
 
             if (slotIndex > maximumUavIndex)
                 maximumUavIndex = slotIndex;
         }
 
-        for (uint32_t uavBufferBinding = 0; uavBufferBinding < job->computeJobDescriptor.pipeline.uavBufferCount; uavBufferBinding++)
+        for (uint32_t uavBufferBinding = 0; uavBufferBinding < job.pipeline->uavBufferCount; uavBufferBinding++)
         {
-            uint32_t slotIndex = job->computeJobDescriptor.pipeline.uavBufferBindings[uavBufferBinding].slotIndex +
-                                 job->computeJobDescriptor.pipeline.uavTextureBindings[uavBufferBinding].arrayIndex;
+            uint32_t slotIndex = job.pipeline->uavBufferBindings[uavBufferBinding].slotIndex +
+                                 job.pipeline->uavTextureBindings[uavBufferBinding].arrayIndex;
 
             if (slotIndex > maximumUavIndex)
                 maximumUavIndex = slotIndex;
@@ -3039,15 +3141,15 @@ static FfxErrorCode executeGpuJobCompute(BackendContext_DX12*       backendConte
             gpuView.ptr += backendContext->descRingBufferBase * dx12Device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 
             // Set Texture UAVs
-            for (uint32_t currentPipelineUavIndex = 0; currentPipelineUavIndex < job->computeJobDescriptor.pipeline.uavTextureCount; ++currentPipelineUavIndex) {
+            for (uint32_t currentPipelineUavIndex = 0; currentPipelineUavIndex < job.pipeline->uavTextureCount; ++currentPipelineUavIndex) {
 
-                addBarrier(backendContext, &job->computeJobDescriptor.uavTextures[currentPipelineUavIndex].resource, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+                addBarrier(backendContext, &job.uavTextures[currentPipelineUavIndex].resource, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
 
-                const FfxResourceBinding binding = job->computeJobDescriptor.pipeline.uavTextureBindings[currentPipelineUavIndex];
+                const FfxResourceBinding binding = job.pipeline->uavTextureBindings[currentPipelineUavIndex];
 
                 // source: UAV of resource to bind
-                const uint32_t resourceIndex = job->computeJobDescriptor.uavTextures[currentPipelineUavIndex].resource.internalIndex;
-                const uint32_t uavIndex = backendContext->pResources[resourceIndex].uavDescIndex + job->computeJobDescriptor.uavTextures[currentPipelineUavIndex].mip;
+                const uint32_t resourceIndex = job.uavTextures[currentPipelineUavIndex].resource.internalIndex;
+                const uint32_t uavIndex = backendContext->pResources[resourceIndex].uavDescIndex + job.uavTextures[currentPipelineUavIndex].mip;
 
                 // where to bind it
                 const uint32_t currentUavResourceIndex = binding.slotIndex + binding.arrayIndex;
@@ -3064,15 +3166,15 @@ static FfxErrorCode executeGpuJobCompute(BackendContext_DX12*       backendConte
             }
 
             // Set Buffer UAVs
-            for (uint32_t currentPipelineUavIndex = 0; currentPipelineUavIndex < job->computeJobDescriptor.pipeline.uavBufferCount; ++currentPipelineUavIndex) {
+            for (uint32_t currentPipelineUavIndex = 0; currentPipelineUavIndex < job.pipeline->uavBufferCount; ++currentPipelineUavIndex) {
                 
                 // continue if this is a null resource.
-                if (job->computeJobDescriptor.uavBuffers[currentPipelineUavIndex].resource.internalIndex == 0)
+                if (job.uavBuffers[currentPipelineUavIndex].resource.internalIndex == 0)
                     continue;
 
-                addBarrier(backendContext, &job->computeJobDescriptor.uavBuffers[currentPipelineUavIndex].resource, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+                addBarrier(backendContext, &job.uavBuffers[currentPipelineUavIndex].resource, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
 
-                const FfxResourceBinding binding = job->computeJobDescriptor.pipeline.uavBufferBindings[currentPipelineUavIndex];
+                const FfxResourceBinding binding = job.pipeline->uavBufferBindings[currentPipelineUavIndex];
 
                 // where to bind it
                 const uint32_t currentUavResourceIndex = binding.slotIndex + binding.arrayIndex;
@@ -3081,21 +3183,21 @@ static FfxErrorCode executeGpuJobCompute(BackendContext_DX12*       backendConte
                 cpuView.ptr += backendContext->descRingBufferBase * dx12Device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
                 cpuView.ptr += currentUavResourceIndex * dx12Device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 
-                if (job->computeJobDescriptor.uavBuffers[currentPipelineUavIndex].size > 0)
+                if (job.uavBuffers[currentPipelineUavIndex].size > 0)
                 {
                     // if size is non-zero create a dynamic descriptor directly on the GPU heap
-                    ID3D12Resource* buffer = getDX12ResourcePtr(backendContext, job->computeJobDescriptor.uavBuffers[currentPipelineUavIndex].resource.internalIndex);
+                    ID3D12Resource* buffer = getDX12ResourcePtr(backendContext, job.uavBuffers[currentPipelineUavIndex].resource.internalIndex);
                     FFX_ASSERT(buffer != NULL);
 
                     D3D12_UNORDERED_ACCESS_VIEW_DESC dx12UavDescription = {};
 
-                    bool     isStructured = job->computeJobDescriptor.uavBuffers[currentPipelineUavIndex].stride > 0;
-                    uint32_t stride       = isStructured ? job->computeJobDescriptor.uavBuffers[currentPipelineUavIndex].stride : sizeof(uint32_t);
+                    bool     isStructured = job.uavBuffers[currentPipelineUavIndex].stride > 0;
+                    uint32_t stride       = isStructured ? job.uavBuffers[currentPipelineUavIndex].stride : sizeof(uint32_t);
 
                     dx12UavDescription.Format                      = isStructured ? DXGI_FORMAT_UNKNOWN : DXGI_FORMAT_R32_TYPELESS;
                     dx12UavDescription.ViewDimension               = D3D12_UAV_DIMENSION_BUFFER;
-                    dx12UavDescription.Buffer.FirstElement         = job->computeJobDescriptor.uavBuffers[currentPipelineUavIndex].offset / stride;
-                    dx12UavDescription.Buffer.NumElements          = job->computeJobDescriptor.uavBuffers[currentPipelineUavIndex].size / stride;
+                    dx12UavDescription.Buffer.FirstElement         = job.uavBuffers[currentPipelineUavIndex].offset / stride;
+                    dx12UavDescription.Buffer.NumElements          = job.uavBuffers[currentPipelineUavIndex].size / stride;
                     dx12UavDescription.Buffer.StructureByteStride  = isStructured ? stride : 0;
                     dx12UavDescription.Buffer.CounterOffsetInBytes = 0;
                     dx12UavDescription.Buffer.Flags                = isStructured ? D3D12_BUFFER_UAV_FLAG_NONE : D3D12_BUFFER_UAV_FLAG_RAW;
@@ -3105,7 +3207,7 @@ static FfxErrorCode executeGpuJobCompute(BackendContext_DX12*       backendConte
                 else
                 {
                     // if size is zero assume it is a static descriptor and copy it from the CPU heap
-                    const uint32_t resourceIndex = job->computeJobDescriptor.uavBuffers[currentPipelineUavIndex].resource.internalIndex;
+                    const uint32_t resourceIndex = job.uavBuffers[currentPipelineUavIndex].resource.internalIndex;
           
                     const uint32_t uavIndex  = backendContext->pResources[resourceIndex].uavDescIndex;
 
@@ -3125,21 +3227,21 @@ static FfxErrorCode executeGpuJobCompute(BackendContext_DX12*       backendConte
     // bind texture & buffer SRVs
     {
         // Set a baseline minimal value
-        uint32_t maximumSrvIndex = job->computeJobDescriptor.pipeline.srvTextureCount + job->computeJobDescriptor.pipeline.srvBufferCount;
+        uint32_t maximumSrvIndex = job.pipeline->srvTextureCount + job.pipeline->srvBufferCount;
 
-        for (uint32_t srvTextureBinding = 0; srvTextureBinding < job->computeJobDescriptor.pipeline.srvTextureCount; srvTextureBinding++)
+        for (uint32_t srvTextureBinding = 0; srvTextureBinding < job.pipeline->srvTextureCount; srvTextureBinding++)
         {
-            uint32_t slotIndex = job->computeJobDescriptor.pipeline.srvTextureBindings[srvTextureBinding].slotIndex +
-                                 job->computeJobDescriptor.pipeline.srvTextureBindings[srvTextureBinding].arrayIndex;
+            uint32_t slotIndex = job.pipeline->srvTextureBindings[srvTextureBinding].slotIndex +
+                                 job.pipeline->srvTextureBindings[srvTextureBinding].arrayIndex;
 
             if (slotIndex > maximumSrvIndex)
                 maximumSrvIndex = slotIndex;
         }
 
-        for (uint32_t srvBufferBinding = 0; srvBufferBinding < job->computeJobDescriptor.pipeline.srvBufferCount; srvBufferBinding++)
+        for (uint32_t srvBufferBinding = 0; srvBufferBinding < job.pipeline->srvBufferCount; srvBufferBinding++)
         {
-            uint32_t slotIndex = job->computeJobDescriptor.pipeline.srvBufferBindings[srvBufferBinding].slotIndex +
-                                 job->computeJobDescriptor.pipeline.srvTextureBindings[srvBufferBinding].arrayIndex;
+            uint32_t slotIndex = job.pipeline->srvBufferBindings[srvBufferBinding].slotIndex +
+                                 job.pipeline->srvTextureBindings[srvBufferBinding].arrayIndex;
 
             if (slotIndex > maximumSrvIndex)
                 maximumSrvIndex = slotIndex;
@@ -3156,17 +3258,17 @@ static FfxErrorCode executeGpuJobCompute(BackendContext_DX12*       backendConte
             D3D12_GPU_DESCRIPTOR_HANDLE gpuView = dx12DescriptorHeap->GetGPUDescriptorHandleForHeapStart();
             gpuView.ptr += backendContext->descRingBufferBase * dx12Device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 
-            for (uint32_t currentPipelineSrvIndex = 0; currentPipelineSrvIndex < job->computeJobDescriptor.pipeline.srvTextureCount; ++currentPipelineSrvIndex)
+            for (uint32_t currentPipelineSrvIndex = 0; currentPipelineSrvIndex < job.pipeline->srvTextureCount; ++currentPipelineSrvIndex)
             {
-                if (job->computeJobDescriptor.srvTextures[currentPipelineSrvIndex].resource.internalIndex == 0)
+                if (job.srvTextures[currentPipelineSrvIndex].resource.internalIndex == 0)
                     break;
 
-                addBarrier(backendContext, &job->computeJobDescriptor.srvTextures[currentPipelineSrvIndex].resource, FFX_RESOURCE_STATE_COMPUTE_READ);
+                addBarrier(backendContext, &job.srvTextures[currentPipelineSrvIndex].resource, FFX_RESOURCE_STATE_COMPUTE_READ);
 
-                const FfxResourceBinding binding = job->computeJobDescriptor.pipeline.srvTextureBindings[currentPipelineSrvIndex];
+                const FfxResourceBinding binding = job.pipeline->srvTextureBindings[currentPipelineSrvIndex];
 
                 // source: SRV of resource to bind
-                const uint32_t              resourceIndex = job->computeJobDescriptor.srvTextures[currentPipelineSrvIndex].resource.internalIndex;
+                const uint32_t              resourceIndex = job.srvTextures[currentPipelineSrvIndex].resource.internalIndex;
                 D3D12_CPU_DESCRIPTOR_HANDLE srcHandle     = backendContext->descHeapSrvCpu->GetCPUDescriptorHandleForHeapStart();
                 srcHandle.ptr += resourceIndex * dx12Device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 
@@ -3181,15 +3283,15 @@ static FfxErrorCode executeGpuJobCompute(BackendContext_DX12*       backendConte
             }
 
             // Set Buffer SRVs
-            for (uint32_t currentPipelineSrvIndex = 0; currentPipelineSrvIndex < job->computeJobDescriptor.pipeline.srvBufferCount; ++currentPipelineSrvIndex)
+            for (uint32_t currentPipelineSrvIndex = 0; currentPipelineSrvIndex < job.pipeline->srvBufferCount; ++currentPipelineSrvIndex)
             {
                 // continue if this is a null resource.
-                if (job->computeJobDescriptor.srvBuffers[currentPipelineSrvIndex].resource.internalIndex == 0)
+                if (job.srvBuffers[currentPipelineSrvIndex].resource.internalIndex == 0)
                     continue;
 
-                addBarrier(backendContext, &job->computeJobDescriptor.srvBuffers[currentPipelineSrvIndex].resource, FFX_RESOURCE_STATE_COMPUTE_READ);
+                addBarrier(backendContext, &job.srvBuffers[currentPipelineSrvIndex].resource, FFX_RESOURCE_STATE_COMPUTE_READ);
 
-                const FfxResourceBinding binding = job->computeJobDescriptor.pipeline.srvBufferBindings[currentPipelineSrvIndex];
+                const FfxResourceBinding binding = job.pipeline->srvBufferBindings[currentPipelineSrvIndex];
 
                 // where to bind it
                 const uint32_t currentSrvResourceIndex = binding.slotIndex + binding.arrayIndex;
@@ -3198,21 +3300,21 @@ static FfxErrorCode executeGpuJobCompute(BackendContext_DX12*       backendConte
                 cpuView.ptr += backendContext->descRingBufferBase * dx12Device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
                 cpuView.ptr += currentSrvResourceIndex * dx12Device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 
-                if (job->computeJobDescriptor.srvBuffers[currentPipelineSrvIndex].size > 0)
+                if (job.srvBuffers[currentPipelineSrvIndex].size > 0)
                 {
                     // if size is non-zero create a dynamic descriptor directly on the GPU heap
-                    ID3D12Resource* buffer = getDX12ResourcePtr(backendContext, job->computeJobDescriptor.srvBuffers[currentPipelineSrvIndex].resource.internalIndex);
+                    ID3D12Resource* buffer = getDX12ResourcePtr(backendContext, job.srvBuffers[currentPipelineSrvIndex].resource.internalIndex);
                     FFX_ASSERT(buffer != NULL);
 
                     D3D12_SHADER_RESOURCE_VIEW_DESC dx12SrvDescription = {};
 
-                    bool     isStructured = job->computeJobDescriptor.srvBuffers[currentPipelineSrvIndex].stride > 0;
-                    uint32_t stride       = isStructured ? job->computeJobDescriptor.srvBuffers[currentPipelineSrvIndex].stride : sizeof(uint32_t);
+                    bool     isStructured = job.srvBuffers[currentPipelineSrvIndex].stride > 0;
+                    uint32_t stride       = isStructured ? job.srvBuffers[currentPipelineSrvIndex].stride : sizeof(uint32_t);
 
                     dx12SrvDescription.Format                     = isStructured ? DXGI_FORMAT_UNKNOWN : DXGI_FORMAT_R32_TYPELESS;
                     dx12SrvDescription.ViewDimension              = D3D12_SRV_DIMENSION_BUFFER;
-                    dx12SrvDescription.Buffer.FirstElement        = job->computeJobDescriptor.srvBuffers[currentPipelineSrvIndex].offset / stride;
-                    dx12SrvDescription.Buffer.NumElements         = job->computeJobDescriptor.srvBuffers[currentPipelineSrvIndex].size / stride;
+                    dx12SrvDescription.Buffer.FirstElement        = job.srvBuffers[currentPipelineSrvIndex].offset / stride;
+                    dx12SrvDescription.Buffer.NumElements         = job.srvBuffers[currentPipelineSrvIndex].size / stride;
                     dx12SrvDescription.Buffer.StructureByteStride = isStructured ? stride : 0;
                     dx12SrvDescription.Buffer.Flags               = isStructured ? D3D12_BUFFER_SRV_FLAG_NONE : D3D12_BUFFER_SRV_FLAG_RAW;
                     dx12SrvDescription.Shader4ComponentMapping    = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
@@ -3222,7 +3324,7 @@ static FfxErrorCode executeGpuJobCompute(BackendContext_DX12*       backendConte
                 else
                 {
                     // source: SRV of buffer to bind
-                    const uint32_t resourceIndex = job->computeJobDescriptor.srvBuffers[currentPipelineSrvIndex].resource.internalIndex;
+                    const uint32_t resourceIndex = job.srvBuffers[currentPipelineSrvIndex].resource.internalIndex;
 
                     D3D12_CPU_DESCRIPTOR_HANDLE srcHandle = backendContext->descHeapSrvCpu->GetCPUDescriptorHandleForHeapStart();
                     srcHandle.ptr += resourceIndex * dx12Device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
@@ -3240,7 +3342,7 @@ static FfxErrorCode executeGpuJobCompute(BackendContext_DX12*       backendConte
     BackendContext_DX12::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
 
     // bind static texture srv table
-    if (job->computeJobDescriptor.pipeline.staticTextureSrvCount > 0)
+    if (job.pipeline->staticTextureSrvCount > 0)
     {
         D3D12_GPU_DESCRIPTOR_HANDLE gpuView = dx12DescriptorHeap->GetGPUDescriptorHandleForHeapStart();
         gpuView.ptr += effectContext.bindlessTextureSrvHeapStart * dx12Device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
@@ -3249,7 +3351,7 @@ static FfxErrorCode executeGpuJobCompute(BackendContext_DX12*       backendConte
     }
 
     // bind static buffer srv table
-    if (job->computeJobDescriptor.pipeline.staticBufferSrvCount > 0)
+    if (job.pipeline->staticBufferSrvCount > 0)
     {
         D3D12_GPU_DESCRIPTOR_HANDLE gpuView = dx12DescriptorHeap->GetGPUDescriptorHandleForHeapStart();
         gpuView.ptr += effectContext.bindlessBufferSrvHeapStart * dx12Device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
@@ -3258,7 +3360,7 @@ static FfxErrorCode executeGpuJobCompute(BackendContext_DX12*       backendConte
     }
 
     // bind static texture uav table
-    if (job->computeJobDescriptor.pipeline.staticTextureUavCount > 0)
+    if (job.pipeline->staticTextureUavCount > 0)
     {
         D3D12_GPU_DESCRIPTOR_HANDLE gpuView = dx12DescriptorHeap->GetGPUDescriptorHandleForHeapStart();
         gpuView.ptr += effectContext.bindlessTextureUavHeapStart * dx12Device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
@@ -3267,7 +3369,7 @@ static FfxErrorCode executeGpuJobCompute(BackendContext_DX12*       backendConte
     }
 
     // bind static buffer uav table
-    if (job->computeJobDescriptor.pipeline.staticBufferUavCount > 0)
+    if (job.pipeline->staticBufferUavCount > 0)
     {
         D3D12_GPU_DESCRIPTOR_HANDLE gpuView = dx12DescriptorHeap->GetGPUDescriptorHandleForHeapStart();
         gpuView.ptr += effectContext.bindlessBufferUavHeapStart * dx12Device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
@@ -3276,30 +3378,30 @@ static FfxErrorCode executeGpuJobCompute(BackendContext_DX12*       backendConte
     }
 
     // If we are dispatching indirectly, transition the argument resource to indirect argument
-    if (job->computeJobDescriptor.pipeline.cmdSignature)
+    if (job.pipeline->cmdSignature)
     {
-        addBarrier(backendContext, &job->computeJobDescriptor.cmdArgument, FFX_RESOURCE_STATE_INDIRECT_ARGUMENT);
+        addBarrier(backendContext, &job.cmdArgument, FFX_RESOURCE_STATE_INDIRECT_ARGUMENT);
     }
 
     flushBarriers(backendContext, dx12CommandList);
 
     // bind pipeline
-    ID3D12PipelineState* dx12PipelineStateObject = reinterpret_cast<ID3D12PipelineState*>(job->computeJobDescriptor.pipeline.pipeline);
+    ID3D12PipelineState* dx12PipelineStateObject = reinterpret_cast<ID3D12PipelineState*>(job.pipeline->pipeline);
     dx12CommandList->SetPipelineState(dx12PipelineStateObject);
 
     // copy data to constant buffer and bind
     {
-        for (uint32_t currentRootConstantIndex = 0; currentRootConstantIndex < job->computeJobDescriptor.pipeline.constCount; ++currentRootConstantIndex) {
+        for (uint32_t currentRootConstantIndex = 0; currentRootConstantIndex < job.pipeline->constCount; ++currentRootConstantIndex) {
 
             // If we have a constant buffer allocator, use that, otherwise use the default backend allocator
             FfxConstantAllocation allocation;
             if (s_fpConstantAllocator)
             {
-                allocation = s_fpConstantAllocator(job->computeJobDescriptor.cbs[currentRootConstantIndex].data, job->computeJobDescriptor.cbs[currentRootConstantIndex].num32BitEntries * sizeof(uint32_t));
+                allocation = s_fpConstantAllocator(job.cbs[currentRootConstantIndex].data, job.cbs[currentRootConstantIndex].num32BitEntries * sizeof(uint32_t));
             }
             else
             {
-                allocation = backendContext->FallbackConstantAllocator(job->computeJobDescriptor.cbs[currentRootConstantIndex].data, job->computeJobDescriptor.cbs[currentRootConstantIndex].num32BitEntries * sizeof(uint32_t));
+                allocation = backendContext->FallbackConstantAllocator(job.cbs[currentRootConstantIndex].data, job.cbs[currentRootConstantIndex].num32BitEntries * sizeof(uint32_t), effectContextId);
             }
 
             D3D12_GPU_VIRTUAL_ADDRESS bufferViewDesc = D3D12_GPU_VIRTUAL_ADDRESS(allocation.handle);
@@ -3308,16 +3410,16 @@ static FfxErrorCode executeGpuJobCompute(BackendContext_DX12*       backendConte
     }
 
     // Dispatch (or dispatch indirect)
-    if (job->computeJobDescriptor.pipeline.cmdSignature)
+    if (job.pipeline->cmdSignature)
     {
-        const uint32_t resourceIndex = job->computeJobDescriptor.cmdArgument.internalIndex;
+        const uint32_t resourceIndex = job.cmdArgument.internalIndex;
         ID3D12Resource* pResource = backendContext->pResources[resourceIndex].resourcePtr;
 
-        dx12CommandList->ExecuteIndirect(reinterpret_cast<ID3D12CommandSignature*>(job->computeJobDescriptor.pipeline.cmdSignature), 1, pResource, job->computeJobDescriptor.cmdArgumentOffset, nullptr, 0);
+        dx12CommandList->ExecuteIndirect(reinterpret_cast<ID3D12CommandSignature*>(job.pipeline->cmdSignature), 1, pResource, job.cmdArgumentOffset, nullptr, 0);
     }
     else
     {
-        dx12CommandList->Dispatch(job->computeJobDescriptor.dimensions[0], job->computeJobDescriptor.dimensions[1], job->computeJobDescriptor.dimensions[2]);
+        dx12CommandList->Dispatch(job.dimensions[0], job.dimensions[1], job.dimensions[2]);
     }
 
     return FFX_OK;
@@ -3461,8 +3563,9 @@ FfxErrorCode ExecuteGpuJobsDX12(
         FfxGpuJobDescription* GpuJob = &backendContext->pGpuJobs[currentGpuJobIndex];        
 
         // If we have a label for the job, drop a marker for it
-        if (GpuJob->jobLabel[0]) {
-            beginMarkerDX12(backendContext, dx12CommandList, GpuJob->jobLabel);
+        const wchar_t* jobLabel = ffxGetGpuJobLabel(GpuJob);
+        if (jobLabel[0]) {
+            beginMarkerDX12(backendContext, dx12CommandList, jobLabel);
         }
 
         switch (GpuJob->jobType) {
@@ -3476,8 +3579,12 @@ FfxErrorCode ExecuteGpuJobsDX12(
                 break;
 
             case FFX_GPU_JOB_COMPUTE:
-                errorCode = executeGpuJobCompute(backendContext, GpuJob, dx12CommandList, effectContextId);
+            case FFX_GPU_JOB_COMPUTE_COMPACT:
+            {
+                FfxComputeJobView computeJob = ffxGetComputeJobView(GpuJob);
+                errorCode = executeGpuJobCompute(backendContext, computeJob, dx12CommandList, effectContextId);
                 break;
+            }
 
             case FFX_GPU_JOB_BARRIER:
                 errorCode = executeGpuJobBarrier(backendContext, GpuJob, dx12CommandList);
@@ -3491,7 +3598,7 @@ FfxErrorCode ExecuteGpuJobsDX12(
                 break;
         }
 
-        if (GpuJob->jobLabel[0]) {
+        if (jobLabel[0]) {
             endMarkerDX12(backendContext, dx12CommandList);
         }
     }
@@ -0,0 +1,1260 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <FidelityFX/host/ffx_interface.h>
+#include <FidelityFX/host/ffx_util.h>
+#include <FidelityFX/host/ffx_assert.h>
+#include <FidelityFX/host/backends/null/ffx_null.h>
+#include <ffx_shader_blobs.h>
+#include <ffx_compute_job.h>
+#include <ffx_breadcrumbs_list.h>
+#include <ffx_pipeline_cache.h>
+#include <stdlib.h> // malloc, free
+#include <string.h>
+
+// prototypes for functions in the interface
+FfxVersionNumber GetSDKVersionNull(FfxInterface* backendInterface);
+FfxErrorCode GetEffectGpuMemoryUsageNull(FfxInterface* backendInterface, FfxUInt32 effectContextId, FfxEffectMemoryUsage* outVramUsage);
+FfxErrorCode CreateBackendContextNull(FfxInterface* backendInterface, FfxEffect effect, FfxEffectBindlessConfig* bindlessConfig, FfxUInt32* effectContextId);
+FfxErrorCode GetDeviceCapabilitiesNull(FfxInterface* backendInterface, FfxDeviceCapabilities* deviceCapabilities);
+FfxErrorCode DestroyBackendContextNull(FfxInterface* backendInterface, FfxUInt32 effectContextId);
+FfxErrorCode CreateResourceNull(FfxInterface* backendInterface, const FfxCreateResourceDescription* desc, FfxUInt32 effectContextId, FfxResourceInternal* outTexture);
+FfxErrorCode DestroyResourceNull(FfxInterface* backendInterface, FfxResourceInternal resource, FfxUInt32 effectContextId);
+FfxErrorCode MapResourceNull(FfxInterface* backendInterface, FfxResourceInternal resource, void** ptr);
+FfxErrorCode UnmapResourceNull(FfxInterface* backendInterface, FfxResourceInternal resource);
+FfxErrorCode RegisterResourceNull(FfxInterface* backendInterface, const FfxResource* inResource, FfxUInt32 effectContextId, FfxResourceInternal* outResourceInternal);
+FfxResource GetResourceNull(FfxInterface* backendInterface, FfxResourceInternal resource);
+FfxErrorCode UnregisterResourcesNull(FfxInterface* backendInterface, FfxCommandList commandList, FfxUInt32 effectContextId);
+FfxErrorCode RegisterStaticResourceNull(FfxInterface* backendInterface, const FfxStaticResourceDescription* desc, FfxUInt32 effectContextId);
+FfxResourceDescription GetResourceDescriptorNull(FfxInterface* backendInterface, FfxResourceInternal resource);
+FfxErrorCode StageConstantBufferDataNull(FfxInterface* backendInterface, void* data, FfxUInt32 size, FfxConstantBuffer* constantBuffer);
+FfxErrorCode CreatePipelineNull(FfxInterface* backendInterface, FfxEffect effect, FfxPass passId, uint32_t permutationOptions, const FfxPipelineDescription* desc, FfxUInt32 effectContextId, FfxPipelineState* outPass);
+FfxErrorCode CreatePipelinesNull(FfxInterface* backendInterface, FfxEffect effect, const FfxPipelineCreateDescription* descs, uint32_t count, FfxUInt32 effectContextId);
+FfxErrorCode DestroyPipelineNull(FfxInterface* backendInterface, FfxPipelineState* pipeline, FfxUInt32 effectContextId);
+FfxErrorCode ScheduleGpuJobNull(FfxInterface* backendInterface, const FfxGpuJobDescription* job);
+FfxErrorCode ExecuteGpuJobsNull(FfxInterface* backendInterface, FfxCommandList commandList, FfxUInt32 effectContextId);
+FfxErrorCode BreadcrumbsAllocBlockNull(FfxInterface* backendInterface, uint64_t blockBytes, FfxBreadcrumbsBlockData* blockData);
+void BreadcrumbsFreeBlockNull(FfxInterface* backendInterface, FfxBreadcrumbsBlockData* blockData);
+void BreadcrumbsWriteNull(FfxInterface* backendInterface, FfxCommandList commandList, uint32_t value, uint64_t gpuLocation, void* gpuBuffer, bool isBegin);
+void BreadcrumbsPrintDeviceInfoNull(FfxInterface* backendInterface, FfxAllocationCallbacks* allocs, bool extendedInfo, char** printBuffer, size_t* printSize);
+void RegisterConstantBufferAllocatorNull(FfxInterface* backendInterface, FfxConstantBufferAllocator fpConstantAllocator);
+
+typedef struct BackendContext_Null {
+
+    // store for resources
+    typedef struct Resource
+    {
+        void*                   resourcePtr;            // application handle, or a backend owned token for created resources
+        void*                   hostMemory;             // CPU memory standing in for mappable buffers
+        FfxResourceDescription  resourceDescription;
+        FfxResourceStates       initialState;
+        FfxResourceStates       currentState;
+        uint64_t                sizeInBytes;
+    } Resource;
+
+    uint32_t refCount;
+    uint32_t maxEffectContexts;
+
+    FfxDeviceCapabilities       deviceCapabilities;
+
+    FfxGpuJobDescription*       pGpuJobs;
+    uint32_t                    gpuJobCount;
+
+    uint8_t*                    pStagingRingBuffer;
+    uint32_t                    stagingRingBufferBase;
+
+    FfxConstantBufferAllocator  fpConstantAllocator;
+
+    // Commands recorded past the capacity of a stream are written here and discarded
+    FfxNullCommand              droppedCommand;
+
+    FfxNullBackendStatistics    statistics;
+
+    // Pipelines shared by the effect contexts, the entries themselves serve as the handles
+    FfxSharedPipelineCache      pipelineCache;
+
+    typedef struct alignas(32) EffectContext {
+
+        // Effect identifier -- used for various resource callbacks to application
+        FfxEffect           effectId;
+
+        // Resource allocation
+        uint32_t            nextStaticResource;
+        uint32_t            nextDynamicResource;
+
+        // Usage
+        bool                active;
+
+        // Estimated VRAM usage
+        FfxEffectMemoryUsage vramUsage;
+
+    } EffectContext;
+
+    // Resource holder
+    Resource*                   pResources;
+    EffectContext*              pEffectContexts;
+
+} BackendContext_Null;
+
+FFX_API size_t ffxGetScratchMemorySizeNull(size_t maxContexts)
+{
+    uint32_t resourceArraySize          = FFX_ALIGN_UP(maxContexts * FFX_MAX_RESOURCE_COUNT * sizeof(BackendContext_Null::Resource), sizeof(uint64_t));
+    uint32_t contextArraySize           = FFX_ALIGN_UP(maxContexts * sizeof(BackendContext_Null::EffectContext), sizeof(uint32_t));
+    uint32_t stagingRingBufferArraySize = FFX_ALIGN_UP(maxContexts * FFX_CONSTANT_BUFFER_RING_BUFFER_SIZE, sizeof(uint32_t));
+    uint32_t gpuJobDescArraySize        = FFX_ALIGN_UP(maxContexts * FFX_MAX_GPU_JOBS * sizeof(FfxGpuJobDescription), sizeof(uint32_t));
+
+    return FFX_ALIGN_UP(sizeof(BackendContext_Null) + resourceArraySize + contextArraySize + stagingRingBufferArraySize + gpuJobDescArraySize, sizeof(uint64_t));
+}
+
+// populate interface with null backend pointers.
+FfxErrorCode ffxGetInterfaceNull(
+    FfxInterface* backendInterface,
+    void* scratchBuffer,
+    size_t scratchBufferSize,
+    size_t maxContexts,
+    const FfxDeviceCapabilities* deviceCapabilities) {
+
+    FFX_RETURN_ON_ERROR(
+        backendInterface,
+        FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(
+        scratchBuffer,
+        FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(
+        scratchBufferSize >= ffxGetScratchMemorySizeNull(maxContexts),
+        FFX_ERROR_INSUFFICIENT_MEMORY);
+
+    backendInterface->fpGetSDKVersion = GetSDKVersionNull;
+    backendInterface->fpGetEffectGpuMemoryUsage = GetEffectGpuMemoryUsageNull;
+    backendInterface->fpCreateBackendContext = CreateBackendContextNull;
+    backendInterface->fpGetDeviceCapabilities = GetDeviceCapabilitiesNull;
+    backendInterface->fpDestroyBackendContext = DestroyBackendContextNull;
+    backendInterface->fpCreateResource = CreateResourceNull;
+    backendInterface->fpDestroyResource = DestroyResourceNull;
+    backendInterface->fpMapResource = MapResourceNull;
+    backendInterface->fpUnmapResource = UnmapResourceNull;
+    backendInterface->fpGetResource = GetResourceNull;
+    backendInterface->fpRegisterResource = RegisterResourceNull;
+    backendInterface->fpUnregisterResources = UnregisterResourcesNull;
+    backendInterface->fpRegisterStaticResource = RegisterStaticResourceNull;
+    backendInterface->fpGetResourceDescription = GetResourceDescriptorNull;
+    backendInterface->fpStageConstantBufferDataFunc = StageConstantBufferDataNull;
+    backendInterface->fpCreatePipeline = CreatePipelineNull;
+    backendInterface->fpCreatePipelines = CreatePipelinesNull;
+    backendInterface->fpGetPermutationBlobByIndex = ffxGetPermutationBlobByIndex;
+    backendInterface->fpDestroyPipeline = DestroyPipelineNull;
+    backendInterface->fpScheduleGpuJob = ScheduleGpuJobNull;
+    backendInterface->fpExecuteGpuJobs = ExecuteGpuJobsNull;
+    backendInterface->fpBreadcrumbsAllocBlock = BreadcrumbsAllocBlockNull;
+    backendInterface->fpBreadcrumbsFreeBlock = BreadcrumbsFreeBlockNull;
+    backendInterface->fpBreadcrumbsWrite = BreadcrumbsWriteNull;
+    backendInterface->fpBreadcrumbsPrintDeviceInfo = BreadcrumbsPrintDeviceInfoNull;
+    backendInterface->fpSwapChainConfigureFrameGeneration = 0;
+    backendInterface->fpRegisterConstantBufferAllocator = RegisterConstantBufferAllocatorNull;
+
+    // Memory assignments
+    backendInterface->scratchBuffer = scratchBuffer;
+    backendInterface->scratchBufferSize = scratchBufferSize;
+
+    BackendContext_Null* backendContext = (BackendContext_Null*)backendInterface->scratchBuffer;
+
+    FFX_RETURN_ON_ERROR(
+        !backendContext->refCount,
+        FFX_ERROR_BACKEND_API_ERROR);
+
+    // Clear everything out
+    memset(backendContext, 0, sizeof(*backendContext));
+
+    // There is no device, hand out the backend context so effects see a valid handle
+    backendInterface->device = backendContext;
+
+    if (deviceCapabilities) {
+
+        backendContext->deviceCapabilities = *deviceCapabilities;
+    }
+    else {
+
+        backendContext->deviceCapabilities.maximumSupportedShaderModel = FFX_SHADER_MODEL_6_6;
+        backendContext->deviceCapabilities.waveLaneCountMin = 32;
+        backendContext->deviceCapabilities.waveLaneCountMax = 64;
+        backendContext->deviceCapabilities.fp16Supported = true;
+        backendContext->deviceCapabilities.dedicatedAllocationSupported = true;
+        backendContext->deviceCapabilities.shaderStorageBufferArrayNonUniformIndexing = true;
+    }
+
+    // Assign the max number of contexts we'll be using
+    backendContext->maxEffectContexts = (uint32_t)maxContexts;
+
+    return FFX_OK;
+}
+
+FfxCommandList ffxGetCommandListNull(FfxNullCommandStream* commandStream)
+{
+    FFX_ASSERT(NULL != commandStream);
+    return reinterpret_cast<FfxCommandList>(commandStream);
+}
+
+FfxResource ffxGetResourceNull(void* handle, FfxResourceDescription ffxResDescription, FfxResourceStates state)
+{
+    FfxResource resource = {};
+    resource.resource    = handle;
+    resource.state       = state;
+    resource.description = ffxResDescription;
+
+    return resource;
+}
+
+FfxErrorCode ffxGetStatisticsNull(const FfxInterface* backendInterface, FfxNullBackendStatistics* statistics)
+{
+    FFX_RETURN_ON_ERROR(
+        backendInterface && backendInterface->scratchBuffer,
+        FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(
+        statistics,
+        FFX_ERROR_INVALID_POINTER);
+
+    const BackendContext_Null* backendContext = (const BackendContext_Null*)backendInterface->scratchBuffer;
+    *statistics = backendContext->statistics;
+
+    return FFX_OK;
+}
+
+FfxErrorCode ffxResetStatisticsNull(const FfxInterface* backendInterface)
+{
+    FFX_RETURN_ON_ERROR(
+        backendInterface && backendInterface->scratchBuffer,
+        FFX_ERROR_INVALID_POINTER);
+
+    BackendContext_Null* backendContext = (BackendContext_Null*)backendInterface->scratchBuffer;
+    memset(&backendContext->statistics, 0, sizeof(backendContext->statistics));
+
+    return FFX_OK;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// helpers
+
+static void copyLabel(wchar_t* dst, size_t dstLength, const wchar_t* src)
+{
+    size_t i = 0;
+    for (; src && src[i] && i < dstLength - 1; ++i)
+        dst[i] = src[i];
+    dst[i] = L'\0';
+}
+
+// Binding names are plain ASCII, widen them without going through the platform's code page conversion
+static void widenBindingName(wchar_t* dst, size_t dstLength, const char* src)
+{
+    size_t i = 0;
+    for (; src && src[i] && i < dstLength - 1; ++i)
+        dst[i] = wchar_t(static_cast<unsigned char>(src[i]));
+    dst[i] = L'\0';
+}
+
+static uint32_t getSurfaceFormatBytesPerTexel(FfxSurfaceFormat format)
+{
+    switch (format)
+    {
+    case FFX_SURFACE_FORMAT_R32G32B32A32_TYPELESS:
+    case FFX_SURFACE_FORMAT_R32G32B32A32_UINT:
+    case FFX_SURFACE_FORMAT_R32G32B32A32_FLOAT:
+        return 16;
+    case FFX_SURFACE_FORMAT_R32G32B32_FLOAT:
+        return 12;
+    case FFX_SURFACE_FORMAT_R16G16B16A16_TYPELESS:
+    case FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT:
+    case FFX_SURFACE_FORMAT_R32G32_TYPELESS:
+    case FFX_SURFACE_FORMAT_R32G32_FLOAT:
+        return 8;
+    case FFX_SURFACE_FORMAT_R16_TYPELESS:
+    case FFX_SURFACE_FORMAT_R16_FLOAT:
+    case FFX_SURFACE_FORMAT_R16_UINT:
+    case FFX_SURFACE_FORMAT_R16_UNORM:
+    case FFX_SURFACE_FORMAT_R16_SNORM:
+    case FFX_SURFACE_FORMAT_R8G8_TYPELESS:
+    case FFX_SURFACE_FORMAT_R8G8_UNORM:
+    case FFX_SURFACE_FORMAT_R8G8_UINT:
+        return 2;
+    case FFX_SURFACE_FORMAT_R8_TYPELESS:
+    case FFX_SURFACE_FORMAT_R8_UINT:
+    case FFX_SURFACE_FORMAT_R8_UNORM:
+        return 1;
+    default:
+        return 4;
+    }
+}
+
+// Estimate of the memory a resource would occupy on a GPU, without any alignment or tiling overhead
+static uint64_t getResourceSizeInBytes(const FfxResourceDescription& description)
+{
+    if (description.type == FFX_RESOURCE_TYPE_BUFFER)
+        return description.size;
+
+    const uint64_t bytesPerTexel = getSurfaceFormatBytesPerTexel(description.format);
+    const uint32_t mipCount      = description.mipCount ? description.mipCount : 1;
+
+    uint64_t size = 0;
+    for (uint32_t mip = 0; mip < mipCount; ++mip)
+    {
+        uint64_t width  = FFX_MAXIMUM(description.width >> mip, 1u);
+        uint64_t height = description.type == FFX_RESOURCE_TYPE_TEXTURE1D ? 1 : FFX_MAXIMUM(description.height >> mip, 1u);
+        uint64_t depth  = description.type == FFX_RESOURCE_TYPE_TEXTURE3D ? FFX_MAXIMUM(description.depth >> mip, 1u) : FFX_MAXIMUM(description.depth, 1u);
+        size += width * height * depth * bytesPerTexel;
+    }
+
+    return size;
+}
+
+// Append a command to the stream, or to the backend's discard slot once the stream is full
+static FfxNullCommand* recordCommand(BackendContext_Null* backendContext,
+                                     FfxNullCommandStream* commandStream,
+                                     FfxNullCommandType    type,
+                                     FfxUInt32             effectContextId,
+                                     const wchar_t*        label)
+{
+    FfxNullCommand* command = &backendContext->droppedCommand;
+
+    if (commandStream->commandCount < commandStream->commandCapacity)
+        command = &commandStream->commands[commandStream->commandCount++];
+    else
+        ++commandStream->droppedCommandCount;
+
+    command->type            = type;
+    command->effectContextId = effectContextId;
+    copyLabel(command->label, FFX_NULL_COMMAND_LABEL_LENGTH, label);
+
+    return command;
+}
+
+static void addBarrier(BackendContext_Null*  backendContext,
+                       FfxNullCommandStream* commandStream,
+                       FfxUInt32             effectContextId,
+                       const wchar_t*        label,
+                       FfxResourceInternal*  resource,
+                       FfxResourceStates     newState)
+{
+    FFX_ASSERT(NULL != backendContext);
+    FFX_ASSERT(NULL != resource);
+
+    FfxResourceStates* currentState = &backendContext->pResources[resource->internalIndex].currentState;
+
+    // Same rules as the DX12 backend: transition when the state changes, UAV barrier between unordered accesses
+    if ((*currentState & newState) != newState || newState == FFX_RESOURCE_STATE_UNORDERED_ACCESS) {
+
+        FfxNullCommand* command = recordCommand(backendContext, commandStream, FFX_NULL_COMMAND_BARRIER, effectContextId, label);
+        command->barrier.resource    = *resource;
+        command->barrier.stateBefore = *currentState;
+        command->barrier.stateAfter  = newState;
+
+        *currentState = newState;
+        ++backendContext->statistics.barriers;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Null back end implementation
+
+FfxUInt32 GetSDKVersionNull(FfxInterface*)
+{
+    return FFX_SDK_MAKE_VERSION(FFX_SDK_VERSION_MAJOR, FFX_SDK_VERSION_MINOR, FFX_SDK_VERSION_PATCH);
+}
+
+FfxErrorCode GetEffectGpuMemoryUsageNull(FfxInterface* backendInterface, FfxUInt32 effectContextId, FfxEffectMemoryUsage* outVramUsage)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    FFX_ASSERT(NULL != outVramUsage);
+
+    BackendContext_Null*                backendContext = (BackendContext_Null*)backendInterface->scratchBuffer;
+    BackendContext_Null::EffectContext& effectContext  = backendContext->pEffectContexts[effectContextId];
+
+    *outVramUsage = effectContext.vramUsage;
+
+    return FFX_OK;
+}
+
+// initialize the null backend
+FfxErrorCode CreateBackendContextNull(FfxInterface* backendInterface, FfxEffect effect, FfxEffectBindlessConfig*, FfxUInt32* effectContextId)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    FFX_ASSERT(NULL != effectContextId);
+
+    BackendContext_Null* backendContext = (BackendContext_Null*)backendInterface->scratchBuffer;
+
+    // Set things up if this is the first invocation
+    if (!backendContext->refCount) {
+
+        // Map all of our pointers
+        uint32_t gpuJobDescArraySize = FFX_ALIGN_UP(backendContext->maxEffectContexts * FFX_MAX_GPU_JOBS * sizeof(FfxGpuJobDescription), sizeof(uint32_t));
+        uint32_t resourceArraySize = FFX_ALIGN_UP(backendContext->maxEffectContexts * FFX_MAX_RESOURCE_COUNT * sizeof(BackendContext_Null::Resource), sizeof(uint64_t));
+        uint32_t stagingRingBufferArraySize = FFX_ALIGN_UP(backendContext->maxEffectContexts * FFX_CONSTANT_BUFFER_RING_BUFFER_SIZE, sizeof(uint32_t));
+        uint32_t contextArraySize = FFX_ALIGN_UP(backendContext->maxEffectContexts * sizeof(BackendContext_Null::EffectContext), sizeof(uint32_t));
+
+        uint8_t* pMem = (uint8_t*)((BackendContext_Null*)(backendContext + 1));
+
+        // Map gpu job array
+        backendContext->pGpuJobs = (FfxGpuJobDescription*)pMem;
+        memset(backendContext->pGpuJobs, 0, gpuJobDescArraySize);
+        pMem += gpuJobDescArraySize;
+
+        // Map the resources
+        backendContext->pResources = (BackendContext_Null::Resource*)(pMem);
+        memset(backendContext->pResources, 0, resourceArraySize);
+        pMem += resourceArraySize;
+
+        // Map the staging buffer
+        backendContext->pStagingRingBuffer = (uint8_t*)(pMem);
+        memset(backendContext->pStagingRingBuffer, 0, stagingRingBufferArraySize);
+        pMem += stagingRingBufferArraySize;
+
+        // Map the effect contexts
+        backendContext->pEffectContexts = reinterpret_cast<BackendContext_Null::EffectContext*>(pMem);
+        memset(backendContext->pEffectContexts, 0, contextArraySize);
+    }
+
+    // Get an available context id
+    for (uint32_t i = 0; i < backendContext->maxEffectContexts; ++i) {
+        if (!backendContext->pEffectContexts[i].active) {
+            *effectContextId = i;
+
+            // Reset everything accordingly
+            BackendContext_Null::EffectContext& effectContext = backendContext->pEffectContexts[i];
+            effectContext.active = true;
+            effectContext.effectId = effect;
+            effectContext.nextStaticResource = (i * FFX_MAX_RESOURCE_COUNT) + 1;
+            effectContext.nextDynamicResource = (i * FFX_MAX_RESOURCE_COUNT) + FFX_MAX_RESOURCE_COUNT - 1;
+            effectContext.vramUsage = {};
+
+            // Increment the ref count
+            ++backendContext->refCount;
+
+            return FFX_OK;
+        }
+    }
+
+    return FFX_ERROR_OUT_OF_MEMORY;
+}
+
+FfxErrorCode GetDeviceCapabilitiesNull(FfxInterface* backendInterface, FfxDeviceCapabilities* deviceCapabilities)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    FFX_ASSERT(NULL != deviceCapabilities);
+
+    BackendContext_Null* backendContext = (BackendContext_Null*)backendInterface->scratchBuffer;
+    *deviceCapabilities = backendContext->deviceCapabilities;
+
+    // a backend feature rather than a device one, so not overridable by the caller
+    deviceCapabilities->compactComputeJobsSupported = true;
+
+    return FFX_OK;
+}
+
+// deinitialize the null backend
+FfxErrorCode DestroyBackendContextNull(FfxInterface* backendInterface, FfxUInt32 effectContextId)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    BackendContext_Null* backendContext = (BackendContext_Null*)backendInterface->scratchBuffer;
+    FFX_ASSERT(backendContext->refCount > 0);
+
+    // Delete any resources allocated by this context
+    BackendContext_Null::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
+    for (uint32_t currentStaticResourceIndex = effectContextId * FFX_MAX_RESOURCE_COUNT; currentStaticResourceIndex < (uint32_t)effectContext.nextStaticResource; ++currentStaticResourceIndex) {
+        if (backendContext->pResources[currentStaticResourceIndex].resourcePtr) {
+            FFX_ASSERT_MESSAGE(false, "FFXInterface: Null: SDK Resource was not destroyed prior to destroying the backend context. There is a resource leak.");
+            FfxResourceInternal internalResource = { (int32_t)currentStaticResourceIndex };
+            DestroyResourceNull(backendInterface, internalResource, effectContextId);
+        }
+    }
+
+    // Free up for use by another context
+    effectContext.nextStaticResource = 0;
+    effectContext.active = false;
+
+    // Decrement ref count
+    --backendContext->refCount;
+
+    if (!backendContext->refCount) {
+
+        backendContext->gpuJobCount = 0;
+        backendContext->stagingRingBufferBase = 0;
+
+        // There are no API objects to release
+        backendContext->pipelineCache.clear([](FfxSharedPipeline&) {});
+    }
+
+    return FFX_OK;
+}
+
+// create a internal resource that will stay alive until effect gets shut down
+FfxErrorCode CreateResourceNull(
+    FfxInterface* backendInterface,
+    const FfxCreateResourceDescription* createResourceDescription,
+    FfxUInt32 effectContextId,
+    FfxResourceInternal* outTexture)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    FFX_ASSERT(NULL != createResourceDescription);
+    FFX_ASSERT(NULL != outTexture);
+    FFX_ASSERT_MESSAGE(createResourceDescription->initData.type != FFX_RESOURCE_INIT_DATA_TYPE_INVALID,
+                       "InitData type cannot be FFX_RESOURCE_INIT_DATA_TYPE_INVALID. Please explicitly specify the resource initialization type.");
+
+    BackendContext_Null* backendContext = (BackendContext_Null*)backendInterface->scratchBuffer;
+    BackendContext_Null::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
+
+    FFX_ASSERT(effectContext.nextStaticResource + 1 < effectContext.nextDynamicResource);
+
+    outTexture->internalIndex = effectContext.nextStaticResource++;
+    BackendContext_Null::Resource* backendResource = &backendContext->pResources[outTexture->internalIndex];
+    backendResource->resourceDescription = createResourceDescription->resourceDescription;
+    backendResource->initialState        = createResourceDescription->initialState;
+    backendResource->currentState        = createResourceDescription->initialState;
+    backendResource->sizeInBytes         = getResourceSizeInBytes(createResourceDescription->resourceDescription);
+    backendResource->hostMemory          = nullptr;
+
+    // Upload and readback buffers are mapped by effects, so they get real memory behind them
+    if (createResourceDescription->heapType != FFX_HEAP_TYPE_DEFAULT && createResourceDescription->resourceDescription.type == FFX_RESOURCE_TYPE_BUFFER) {
+
+        backendResource->hostMemory = malloc(size_t(backendResource->sizeInBytes));
+        FFX_RETURN_ON_ERROR(
+            backendResource->hostMemory,
+            FFX_ERROR_OUT_OF_MEMORY);
+    }
+
+    // Any non-null handle identifies the resource
+    backendResource->resourcePtr = backendResource->hostMemory ? backendResource->hostMemory : backendResource;
+
+    ++backendContext->statistics.resourcesCreated;
+
+    const FfxResourceInitData& initData = createResourceDescription->initData;
+
+    if (createResourceDescription->heapType == FFX_HEAP_TYPE_UPLOAD && backendResource->hostMemory) {
+
+        // Upload resources are initialized directly
+        if (initData.type == FFX_RESOURCE_INIT_DATA_TYPE_BUFFER)
+            memcpy(backendResource->hostMemory, initData.buffer, FFX_MINIMUM(size_t(backendResource->sizeInBytes), initData.size));
+        else if (initData.type == FFX_RESOURCE_INIT_DATA_TYPE_VALUE)
+            memset(backendResource->hostMemory, initData.value, FFX_MINIMUM(size_t(backendResource->sizeInBytes), initData.size));
+    }
+    else if (initData.type != FFX_RESOURCE_INIT_DATA_TYPE_UNINITIALIZED) {
+
+        // create upload resource and upload job, the same work the GPU backends do
+        FfxResourceInternal copySrc;
+        FfxCreateResourceDescription uploadDescription = { *createResourceDescription };
+        uploadDescription.heapType = FFX_HEAP_TYPE_UPLOAD;
+        uploadDescription.resourceDescription.type = FFX_RESOURCE_TYPE_BUFFER;
+        uploadDescription.resourceDescription.size = uint32_t(FFX_MAXIMUM(initData.size, size_t(1)));
+        uploadDescription.resourceDescription.usage = FFX_RESOURCE_USAGE_READ_ONLY;
+        uploadDescription.initialState = FFX_RESOURCE_STATE_GENERIC_READ;
+
+        FFX_VALIDATE(backendInterface->fpCreateResource(backendInterface, &uploadDescription, effectContextId, &copySrc));
+
+        // setup the upload job
+        FfxGpuJobDescription copyJob  = { FFX_GPU_JOB_COPY, L"Resource Initialization Copy" };
+        copyJob.copyJobDescriptor.src = copySrc;
+        copyJob.copyJobDescriptor.dst = *outTexture;
+        copyJob.copyJobDescriptor.srcOffset = 0;
+        copyJob.copyJobDescriptor.dstOffset = 0;
+        copyJob.copyJobDescriptor.size      = 0;
+
+        backendInterface->fpScheduleGpuJob(backendInterface, &copyJob);
+    }
+
+    effectContext.vramUsage.totalUsageInBytes += backendResource->sizeInBytes;
+    if ((createResourceDescription->resourceDescription.flags & FFX_RESOURCE_FLAGS_ALIASABLE) == FFX_RESOURCE_FLAGS_ALIASABLE)
+    {
+        effectContext.vramUsage.aliasableUsageInBytes += backendResource->sizeInBytes;
+    }
+
+    return FFX_OK;
+}
+
+FfxErrorCode DestroyResourceNull(
+    FfxInterface* backendInterface,
+    FfxResourceInternal resource,
+    FfxUInt32 effectContextId)
+{
+    FFX_ASSERT(NULL != backendInterface);
+
+    BackendContext_Null* backendContext = (BackendContext_Null*)backendInterface->scratchBuffer;
+    BackendContext_Null::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
+    if ((resource.internalIndex >= int32_t(effectContextId * FFX_MAX_RESOURCE_COUNT)) && (resource.internalIndex < int32_t(effectContext.nextStaticResource))) {
+
+        BackendContext_Null::Resource* backendResource = &backendContext->pResources[resource.internalIndex];
+        if (backendResource->resourcePtr) {
+
+            // update effect memory usage
+            effectContext.vramUsage.totalUsageInBytes -= backendResource->sizeInBytes;
+            if ((backendResource->resourceDescription.flags & FFX_RESOURCE_FLAGS_ALIASABLE) == FFX_RESOURCE_FLAGS_ALIASABLE)
+            {
+                effectContext.vramUsage.aliasableUsageInBytes -= backendResource->sizeInBytes;
+            }
+
+            free(backendResource->hostMemory);
+            backendResource->hostMemory  = nullptr;
+            backendResource->resourcePtr = nullptr;
+        }
+
+        return FFX_OK;
+    }
+
+    return FFX_ERROR_OUT_OF_RANGE;
+}
+
+FfxErrorCode MapResourceNull(FfxInterface* backendInterface, FfxResourceInternal resource, void** ptr)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    FFX_ASSERT(NULL != ptr);
+
+    BackendContext_Null* backendContext = (BackendContext_Null*)backendInterface->scratchBuffer;
+
+    *ptr = backendContext->pResources[resource.internalIndex].hostMemory;
+    if (!*ptr)
+        return FFX_ERROR_BACKEND_API_ERROR;
+
+    return FFX_OK;
+}
+
+FfxErrorCode UnmapResourceNull(FfxInterface* backendInterface, FfxResourceInternal)
+{
+    FFX_ASSERT(NULL != backendInterface);
+
+    return FFX_OK;
+}
+
+FfxErrorCode RegisterResourceNull(
+    FfxInterface* backendInterface,
+    const FfxResource* inFfxResource,
+    FfxUInt32 effectContextId,
+    FfxResourceInternal* outFfxResourceInternal)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    FFX_ASSERT(NULL != inFfxResource);
+    FFX_ASSERT(NULL != outFfxResourceInternal);
+
+    BackendContext_Null* backendContext = (BackendContext_Null*)(backendInterface->scratchBuffer);
+    BackendContext_Null::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
+
+    if (inFfxResource->resource == nullptr) {
+
+        outFfxResourceInternal->internalIndex = 0; // Always maps to FFX_<feature>_RESOURCE_IDENTIFIER_NULL;
+        return FFX_OK;
+    }
+
+    FFX_ASSERT(effectContext.nextDynamicResource > effectContext.nextStaticResource);
+    outFfxResourceInternal->internalIndex = effectContext.nextDynamicResource--;
+
+    BackendContext_Null::Resource* backendResource = &backendContext->pResources[outFfxResourceInternal->internalIndex];
+    backendResource->resourcePtr         = inFfxResource->resource;
+    backendResource->hostMemory          = nullptr;
+    backendResource->resourceDescription = inFfxResource->description;
+    backendResource->initialState        = inFfxResource->state;
+    backendResource->currentState        = inFfxResource->state;
+    backendResource->sizeInBytes         = 0;
+
+    ++backendContext->statistics.resourcesRegistered;
+
+    return FFX_OK;
+}
+
+FfxResource GetResourceNull(FfxInterface* backendInterface, FfxResourceInternal inResource)
+{
+    FFX_ASSERT(nullptr != backendInterface);
+    BackendContext_Null* backendContext = (BackendContext_Null*)backendInterface->scratchBuffer;
+
+    FfxResource resource = {};
+    resource.resource    = backendContext->pResources[inResource.internalIndex].resourcePtr;
+    resource.state       = backendContext->pResources[inResource.internalIndex].currentState;
+    resource.description = backendContext->pResources[inResource.internalIndex].resourceDescription;
+
+    return resource;
+}
+
+// dispose dynamic resources: This should be called at the end of the frame
+FfxErrorCode UnregisterResourcesNull(FfxInterface* backendInterface, FfxCommandList commandList, FfxUInt32 effectContextId)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    FFX_ASSERT(nullptr != commandList);
+
+    BackendContext_Null* backendContext = (BackendContext_Null*)(backendInterface->scratchBuffer);
+    BackendContext_Null::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
+    FfxNullCommandStream* commandStream = reinterpret_cast<FfxNullCommandStream*>(commandList);
+
+    // Walk back all the resources that don't belong to us and reset them to their initial state
+    for (uint32_t resourceIndex = ++effectContext.nextDynamicResource; resourceIndex < (effectContextId * FFX_MAX_RESOURCE_COUNT) + FFX_MAX_RESOURCE_COUNT; ++resourceIndex)
+    {
+        FfxResourceInternal internalResource;
+        internalResource.internalIndex = resourceIndex;
+
+        BackendContext_Null::Resource* backendResource = &backendContext->pResources[resourceIndex];
+        addBarrier(backendContext, commandStream, effectContextId, L"", &internalResource, backendResource->initialState);
+    }
+
+    effectContext.nextDynamicResource = (effectContextId * FFX_MAX_RESOURCE_COUNT) + FFX_MAX_RESOURCE_COUNT - 1;
+
+    return FFX_OK;
+}
+
+FfxErrorCode RegisterStaticResourceNull(FfxInterface* backendInterface, const FfxStaticResourceDescription* desc, FfxUInt32)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    FFX_ASSERT(NULL != desc);
+
+    BackendContext_Null* backendContext = (BackendContext_Null*)backendInterface->scratchBuffer;
+
+    switch (desc->descriptorType)
+    {
+    case FFX_DESCRIPTOR_TEXTURE_SRV:
+    case FFX_DESCRIPTOR_BUFFER_SRV:
+    case FFX_DESCRIPTOR_TEXTURE_UAV:
+    case FFX_DESCRIPTOR_BUFFER_UAV:
+        ++backendContext->statistics.staticResourcesRegistered;
+        return FFX_OK;
+    default:
+        return FFX_ERROR_INVALID_ARGUMENT;
+    }
+}
+
+FfxResourceDescription GetResourceDescriptorNull(
+    FfxInterface* backendInterface,
+    FfxResourceInternal resource)
+{
+    FFX_ASSERT(NULL != backendInterface);
+
+    BackendContext_Null* backendContext = (BackendContext_Null*)backendInterface->scratchBuffer;
+
+    return backendContext->pResources[resource.internalIndex].resourceDescription;
+}
+
+FfxErrorCode StageConstantBufferDataNull(FfxInterface* backendInterface, void* data, FfxUInt32 size, FfxConstantBuffer* constantBuffer)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    BackendContext_Null* backendContext = (BackendContext_Null*)backendInterface->scratchBuffer;
+
+    if (data && constantBuffer)
+    {
+        if ((backendContext->stagingRingBufferBase + FFX_ALIGN_UP(size, 256)) >= FFX_CONSTANT_BUFFER_RING_BUFFER_SIZE)
+            backendContext->stagingRingBufferBase = 0;
+
+        uint32_t* dstPtr = (uint32_t*)(backendContext->pStagingRingBuffer + backendContext->stagingRingBufferBase);
+
+        memcpy(dstPtr, data, size);
+
+        constantBuffer->data            = dstPtr;
+        constantBuffer->num32BitEntries = size / sizeof(uint32_t);
+
+        backendContext->stagingRingBufferBase += FFX_ALIGN_UP(size, 256);
+
+        ++backendContext->statistics.constantBufferUploads;
+        backendContext->statistics.constantBufferBytes += size;
+
+        return FFX_OK;
+    }
+    else
+        return FFX_ERROR_INVALID_POINTER;
+}
+
+FfxErrorCode CreatePipelineNull(
+    FfxInterface* backendInterface,
+    FfxEffect effect,
+    FfxPass pass,
+    uint32_t permutationOptions,
+    const FfxPipelineDescription* pipelineDescription,
+    FfxUInt32,
+    FfxPipelineState* outPipeline)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    FFX_ASSERT(NULL != pipelineDescription);
+    FFX_ASSERT(NULL != outPipeline);
+
+    BackendContext_Null* backendContext = (BackendContext_Null*)backendInterface->scratchBuffer;
+
+    FfxShaderBlob shaderBlob = { };
+    FFX_VALIDATE(backendInterface->fpGetPermutationBlobByIndex(effect, pass, FFX_BIND_COMPUTE_SHADER_STAGE, permutationOptions, &shaderBlob));
+    FFX_ASSERT(shaderBlob.data && shaderBlob.size);
+    FfxScopedPermutationBlob scopedShaderBlob = { &shaderBlob };
+
+    // Resources outside of space 0 are bound through the bindless static descriptors, count them separately like the DX12 backend
+    uint32_t staticTextureSrvCount = 0;
+    uint32_t staticBufferSrvCount  = 0;
+    uint32_t staticTextureUavCount = 0;
+    uint32_t staticBufferUavCount  = 0;
+
+    uint32_t flattenedSrvTextureCount = 0;
+
+    for (uint32_t srvIndex = 0; srvIndex < shaderBlob.srvTextureCount; ++srvIndex)
+    {
+        if (shaderBlob.boundSRVTextureSpaces[srvIndex] != 0)
+        {
+            staticTextureSrvCount += shaderBlob.boundSRVTextureCounts[srvIndex];
+            continue;
+        }
+
+        for (uint32_t arrayIndex = 0; arrayIndex < shaderBlob.boundSRVTextureCounts[srvIndex]; arrayIndex++)
+        {
+            FfxResourceBinding& binding = outPipeline->srvTextureBindings[flattenedSrvTextureCount++];
+            binding.slotIndex  = shaderBlob.boundSRVTextures[srvIndex];
+            binding.arrayIndex = arrayIndex;
+            widenBindingName(binding.name, FFX_RESOURCE_NAME_SIZE, shaderBlob.boundSRVTextureNames[srvIndex]);
+        }
+    }
+
+    outPipeline->srvTextureCount = flattenedSrvTextureCount;
+    FFX_ASSERT(outPipeline->srvTextureCount < FFX_MAX_NUM_SRVS);
+
+    uint32_t flattenedUavTextureCount = 0;
+
+    for (uint32_t uavIndex = 0; uavIndex < shaderBlob.uavTextureCount; ++uavIndex)
+    {
+        if (shaderBlob.boundUAVTextureSpaces[uavIndex] != 0)
+        {
+            staticTextureUavCount += shaderBlob.boundUAVTextureCounts[uavIndex];
+            continue;
+        }
+
+        for (uint32_t arrayIndex = 0; arrayIndex < shaderBlob.boundUAVTextureCounts[uavIndex]; arrayIndex++)
+        {
+            FfxResourceBinding& binding = outPipeline->uavTextureBindings[flattenedUavTextureCount++];
+            binding.slotIndex  = shaderBlob.boundUAVTextures[uavIndex];
+            binding.arrayIndex = arrayIndex;
+            widenBindingName(binding.name, FFX_RESOURCE_NAME_SIZE, shaderBlob.boundUAVTextureNames[uavIndex]);
+        }
+    }
+
+    outPipeline->uavTextureCount = flattenedUavTextureCount;
+    FFX_ASSERT(outPipeline->uavTextureCount < FFX_MAX_NUM_UAVS);
+
+    uint32_t flattenedSrvBufferCount = 0;
+
+    for (uint32_t srvIndex = 0; srvIndex < shaderBlob.srvBufferCount; ++srvIndex)
+    {
+        if (shaderBlob.boundSRVBufferSpaces[srvIndex] != 0)
+        {
+            staticBufferSrvCount += shaderBlob.boundSRVBufferCounts[srvIndex];
+            continue;
+        }
+
+        for (uint32_t arrayIndex = 0; arrayIndex < shaderBlob.boundSRVBufferCounts[srvIndex]; arrayIndex++)
+        {
+            FfxResourceBinding& binding = outPipeline->srvBufferBindings[flattenedSrvBufferCount++];
+            binding.slotIndex  = shaderBlob.boundSRVBuffers[srvIndex];
+            binding.arrayIndex = arrayIndex;
+            widenBindingName(binding.name, FFX_RESOURCE_NAME_SIZE, shaderBlob.boundSRVBufferNames[srvIndex]);
+        }
+    }
+
+    outPipeline->srvBufferCount = flattenedSrvBufferCount;
+    FFX_ASSERT(outPipeline->srvBufferCount < FFX_MAX_NUM_SRVS);
+
+    uint32_t flattenedUavBufferCount = 0;
+
+    for (uint32_t uavIndex = 0; uavIndex < shaderBlob.uavBufferCount; ++uavIndex)
+    {
+        if (shaderBlob.boundUAVBufferSpaces[uavIndex] != 0)
+        {
+            staticBufferUavCount += shaderBlob.boundUAVBufferCounts[uavIndex];
+            continue;
+        }
+
+        for (uint32_t arrayIndex = 0; arrayIndex < shaderBlob.boundUAVBufferCounts[uavIndex]; arrayIndex++)
+        {
+            FfxResourceBinding& binding = outPipeline->uavBufferBindings[flattenedUavBufferCount++];
+            binding.slotIndex  = shaderBlob.boundUAVBuffers[uavIndex];
+            binding.arrayIndex = arrayIndex;
+            widenBindingName(binding.name, FFX_RESOURCE_NAME_SIZE, shaderBlob.boundUAVBufferNames[uavIndex]);
+        }
+    }
+
+    outPipeline->uavBufferCount = flattenedUavBufferCount;
+    FFX_ASSERT(outPipeline->uavBufferCount < FFX_MAX_NUM_UAVS);
+
+    for (uint32_t cbIndex = 0; cbIndex < shaderBlob.cbvCount; ++cbIndex)
+    {
+        FfxResourceBinding& binding = outPipeline->constantBufferBindings[cbIndex];
+        binding.slotIndex  = shaderBlob.boundConstantBuffers[cbIndex];
+        binding.arrayIndex = 1;
+        widenBindingName(binding.name, FFX_RESOURCE_NAME_SIZE, shaderBlob.boundConstantBufferNames[cbIndex]);
+    }
+
+    outPipeline->constCount = shaderBlob.cbvCount;
+    FFX_ASSERT(outPipeline->constCount < FFX_MAX_NUM_CONST_BUFFERS);
+
+    outPipeline->staticTextureSrvCount = staticTextureSrvCount;
+    outPipeline->staticBufferSrvCount  = staticBufferSrvCount;
+    outPipeline->staticTextureUavCount = staticTextureUavCount;
+    outPipeline->staticBufferUavCount  = staticBufferUavCount;
+
+    // There are no API objects, a cache entry serves as the handles of the pipelines sharing it. When the cache is
+    // full the pipeline state itself does.
+    FfxSharedPipeline        key            = {};
+    const bool               shareable      = FfxSharedPipelineCache::makeKey(effect, pass, permutationOptions, pipelineDescription, key);
+    const FfxSharedPipeline* sharedPipeline = shareable ? backendContext->pipelineCache.find(key) : nullptr;
+    if (!sharedPipeline)
+    {
+        if (shareable)
+        {
+            if (FfxSharedPipeline* entry = backendContext->pipelineCache.insert(key))
+            {
+                entry->pipeline     = reinterpret_cast<FfxPipeline>(entry);
+                entry->cmdSignature = key.indirectWorkload ? reinterpret_cast<FfxCommandSignature>(entry) : nullptr;
+                sharedPipeline      = entry;
+            }
+        }
+        ++backendContext->statistics.pipelinesCompiled;
+    }
+
+    outPipeline->rootSignature = nullptr;
+    if (sharedPipeline)
+    {
+        outPipeline->pipeline     = sharedPipeline->pipeline;
+        outPipeline->cmdSignature = sharedPipeline->cmdSignature;
+    }
+    else
+    {
+        outPipeline->pipeline     = reinterpret_cast<FfxPipeline>(outPipeline);
+        outPipeline->cmdSignature = pipelineDescription->indirectWorkload ? reinterpret_cast<FfxCommandSignature>(outPipeline) : nullptr;
+    }
+
+    copyLabel(outPipeline->name, FFX_RESOURCE_NAME_SIZE, pipelineDescription->name);
+
+    ++backendContext->statistics.pipelinesCreated;
+
+    return FFX_OK;
+}
+
+FfxErrorCode CreatePipelinesNull(
+    FfxInterface* backendInterface,
+    FfxEffect effect,
+    const FfxPipelineCreateDescription* pipelineCreateDescriptions,
+    uint32_t pipelineCount,
+    FfxUInt32 effectContextId)
+{
+    FFX_ASSERT(NULL != pipelineCreateDescriptions || !pipelineCount);
+
+    for (uint32_t i = 0; i < pipelineCount; ++i)
+    {
+        const FfxPipelineCreateDescription& desc = pipelineCreateDescriptions[i];
+        FFX_VALIDATE(CreatePipelineNull(backendInterface, effect, desc.pass, desc.permutationOptions, desc.pipelineDescription, effectContextId, desc.outPipeline));
+    }
+
+    return FFX_OK;
+}
+
+FfxErrorCode DestroyPipelineNull(
+    FfxInterface* backendInterface,
+    FfxPipelineState* pipeline,
+    FfxUInt32)
+{
+    FFX_ASSERT(backendInterface != nullptr);
+    if (!pipeline) {
+        return FFX_OK;
+    }
+
+    pipeline->rootSignature = nullptr;
+    pipeline->cmdSignature  = nullptr;
+    pipeline->pipeline      = nullptr;
+
+    return FFX_OK;
+}
+
+FfxErrorCode ScheduleGpuJobNull(
+    FfxInterface* backendInterface,
+    const FfxGpuJobDescription* job)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    FFX_ASSERT(NULL != job);
+
+    BackendContext_Null* backendContext = (BackendContext_Null*)backendInterface->scratchBuffer;
+
+    FFX_ASSERT(backendContext->gpuJobCount < FFX_MAX_GPU_JOBS);
+
+    if (job->jobType == FFX_GPU_JOB_COMPUTE_COMPACT)
+        ffxStoreCompactComputeJob(&backendContext->pGpuJobs[backendContext->gpuJobCount], job);
+    else
+        backendContext->pGpuJobs[backendContext->gpuJobCount] = *job;
+    backendContext->gpuJobCount++;
+
+    ++backendContext->statistics.jobsScheduled;
+    backendContext->statistics.maxScheduledJobs = FFX_MAXIMUM(backendContext->statistics.maxScheduledJobs, backendContext->gpuJobCount);
+
+    return FFX_OK;
+}
+
+static FfxErrorCode executeGpuJobCompute(BackendContext_Null*  backendContext,
+                                         FfxComputeJobView&    job,
+                                         FfxNullCommandStream* commandStream,
+                                         FfxUInt32             effectContextId,
+                                         const wchar_t*        label)
+{
+    // transition resources in the order the DX12 backend binds them
+    for (uint32_t currentPipelineUavIndex = 0; currentPipelineUavIndex < job.pipeline->uavTextureCount; ++currentPipelineUavIndex)
+        addBarrier(backendContext, commandStream, effectContextId, label, &job.uavTextures[currentPipelineUavIndex].resource, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+
+    for (uint32_t currentPipelineUavIndex = 0; currentPipelineUavIndex < job.pipeline->uavBufferCount; ++currentPipelineUavIndex)
+    {
+        if (job.uavBuffers[currentPipelineUavIndex].resource.internalIndex == 0)
+            continue;
+
+        addBarrier(backendContext, commandStream, effectContextId, label, &job.uavBuffers[currentPipelineUavIndex].resource, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+    }
+
+    for (uint32_t currentPipelineSrvIndex = 0; currentPipelineSrvIndex < job.pipeline->srvTextureCount; ++currentPipelineSrvIndex)
+    {
+        if (job.srvTextures[currentPipelineSrvIndex].resource.internalIndex == 0)
+            continue;
+
+        addBarrier(backendContext, commandStream, effectContextId, label, &job.srvTextures[currentPipelineSrvIndex].resource, FFX_RESOURCE_STATE_COMPUTE_READ);
+    }
+
+    for (uint32_t currentPipelineSrvIndex = 0; currentPipelineSrvIndex < job.pipeline->srvBufferCount; ++currentPipelineSrvIndex)
+    {
+        if (job.srvBuffers[currentPipelineSrvIndex].resource.internalIndex == 0)
+            continue;
+
+        addBarrier(backendContext, commandStream, effectContextId, label, &job.srvBuffers[currentPipelineSrvIndex].resource, FFX_RESOURCE_STATE_COMPUTE_READ);
+    }
+
+    const bool isIndirect = job.pipeline->cmdSignature != nullptr;
+    if (isIndirect)
+        addBarrier(backendContext, commandStream, effectContextId, label, &job.cmdArgument, FFX_RESOURCE_STATE_INDIRECT_ARGUMENT);
+
+    // hand the constants to the application's allocator if there is one, they were already staged otherwise
+    uint32_t constantBufferBytes = 0;
+    for (uint32_t currentRootConstantIndex = 0; currentRootConstantIndex < job.pipeline->constCount; ++currentRootConstantIndex)
+    {
+        const uint32_t size = job.cbs[currentRootConstantIndex].num32BitEntries * sizeof(uint32_t);
+        if (backendContext->fpConstantAllocator)
+            backendContext->fpConstantAllocator(job.cbs[currentRootConstantIndex].data, size);
+
+        constantBufferBytes += size;
+    }
+
+    FfxNullCommand* command = recordCommand(backendContext, commandStream, isIndirect ? FFX_NULL_COMMAND_DISPATCH_INDIRECT : FFX_NULL_COMMAND_DISPATCH, effectContextId, label);
+    command->dispatch.pipeline            = job.pipeline;
+    command->dispatch.dimensions[0]       = isIndirect ? 0 : job.dimensions[0];
+    command->dispatch.dimensions[1]       = isIndirect ? 0 : job.dimensions[1];
+    command->dispatch.dimensions[2]       = isIndirect ? 0 : job.dimensions[2];
+    command->dispatch.cmdArgument         = job.cmdArgument;
+    command->dispatch.srvCount            = job.pipeline->srvTextureCount + job.pipeline->srvBufferCount;
+    command->dispatch.uavCount            = job.pipeline->uavTextureCount + job.pipeline->uavBufferCount;
+    command->dispatch.constantBufferCount = job.pipeline->constCount;
+    command->dispatch.constantBufferBytes = constantBufferBytes;
+
+    ++backendContext->statistics.dispatches;
+
+    return FFX_OK;
+}
+
+static FfxErrorCode executeGpuJobCopy(BackendContext_Null* backendContext, FfxGpuJobDescription* job, FfxNullCommandStream* commandStream, FfxUInt32 effectContextId, const wchar_t* label)
+{
+    addBarrier(backendContext, commandStream, effectContextId, label, &job->copyJobDescriptor.src, FFX_RESOURCE_STATE_COPY_SRC);
+    addBarrier(backendContext, commandStream, effectContextId, label, &job->copyJobDescriptor.dst, FFX_RESOURCE_STATE_COPY_DEST);
+
+    FfxNullCommand* command = recordCommand(backendContext, commandStream, FFX_NULL_COMMAND_COPY, effectContextId, label);
+    command->copy.src  = job->copyJobDescriptor.src;
+    command->copy.dst  = job->copyJobDescriptor.dst;
+    command->copy.size = job->copyJobDescriptor.size;
+
+    return FFX_OK;
+}
+
+static FfxErrorCode executeGpuJobBarrier(BackendContext_Null* backendContext, FfxGpuJobDescription* job, FfxNullCommandStream* commandStream, FfxUInt32 effectContextId, const wchar_t* label)
+{
+    addBarrier(backendContext, commandStream, effectContextId, label, &job->barrierDescriptor.resource, job->barrierDescriptor.newState);
+
+    return FFX_OK;
+}
+
+static FfxErrorCode executeGpuJobClearFloat(BackendContext_Null* backendContext, FfxGpuJobDescription* job, FfxNullCommandStream* commandStream, FfxUInt32 effectContextId, const wchar_t* label)
+{
+    addBarrier(backendContext, commandStream, effectContextId, label, &job->clearJobDescriptor.target, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+
+    FfxNullCommand* command = recordCommand(backendContext, commandStream, FFX_NULL_COMMAND_CLEAR_FLOAT, effectContextId, label);
+    command->clear.target = job->clearJobDescriptor.target;
+    memcpy(command->clear.color, job->clearJobDescriptor.color, sizeof(command->clear.color));
+
+    return FFX_OK;
+}
+
+static FfxErrorCode executeGpuJobDiscard(BackendContext_Null* backendContext, FfxGpuJobDescription* job, FfxNullCommandStream* commandStream, FfxUInt32 effectContextId, const wchar_t* label)
+{
+    addBarrier(backendContext, commandStream, effectContextId, label, &job->discardJobDescriptor.target, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+
+    FfxNullCommand* command = recordCommand(backendContext, commandStream, FFX_NULL_COMMAND_DISCARD, effectContextId, label);
+    command->clear.target = job->discardJobDescriptor.target;
+    memset(command->clear.color, 0, sizeof(command->clear.color));
+
+    return FFX_OK;
+}
+
+FfxErrorCode ExecuteGpuJobsNull(
+    FfxInterface* backendInterface,
+    FfxCommandList commandList,
+    FfxUInt32 effectContextId)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    BackendContext_Null* backendContext = (BackendContext_Null*)backendInterface->scratchBuffer;
+
+    FFX_ASSERT(nullptr != commandList);
+    FfxNullCommandStream* commandStream = reinterpret_cast<FfxNullCommandStream*>(commandList);
+
+    FfxErrorCode errorCode = FFX_OK;
+
+    // execute all GpuJobs
+    for (uint32_t currentGpuJobIndex = 0; currentGpuJobIndex < backendContext->gpuJobCount; ++currentGpuJobIndex) {
+
+        FfxGpuJobDescription* GpuJob = &backendContext->pGpuJobs[currentGpuJobIndex];
+        const wchar_t* jobLabel = ffxGetGpuJobLabel(GpuJob);
+
+        switch (GpuJob->jobType) {
+
+            case FFX_GPU_JOB_CLEAR_FLOAT:
+                errorCode = executeGpuJobClearFloat(backendContext, GpuJob, commandStream, effectContextId, jobLabel);
+                break;
+
+            case FFX_GPU_JOB_COPY:
+                errorCode = executeGpuJobCopy(backendContext, GpuJob, commandStream, effectContextId, jobLabel);
+                break;
+
+            case FFX_GPU_JOB_COMPUTE:
+            case FFX_GPU_JOB_COMPUTE_COMPACT:
+            {
+                FfxComputeJobView computeJob = ffxGetComputeJobView(GpuJob);
+                errorCode = executeGpuJobCompute(backendContext, computeJob, commandStream, effectContextId, jobLabel);
+                break;
+            }
+
+            case FFX_GPU_JOB_BARRIER:
+                errorCode = executeGpuJobBarrier(backendContext, GpuJob, commandStream, effectContextId, jobLabel);
+                break;
+
+            case FFX_GPU_JOB_DISCARD:
+                errorCode = executeGpuJobDiscard(backendContext, GpuJob, commandStream, effectContextId, jobLabel);
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    // check the execute function returned cleanly.
+    FFX_RETURN_ON_ERROR(
+        errorCode == FFX_OK,
+        FFX_ERROR_BACKEND_API_ERROR);
+
+    backendContext->statistics.jobsExecuted += backendContext->gpuJobCount;
+    ++backendContext->statistics.executeCalls;
+    backendContext->gpuJobCount = 0;
+
+    return FFX_OK;
+}
+
+// Breadcrumbs blocks live in host memory, their addresses double as GPU locations so markers can be written directly
+FfxErrorCode BreadcrumbsAllocBlockNull(
+    FfxInterface* backendInterface,
+    uint64_t blockBytes,
+    FfxBreadcrumbsBlockData* blockData)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    FFX_ASSERT(NULL != blockData);
+
+    blockData->memory = calloc(1, size_t(blockBytes));
+    if (blockData->memory == nullptr)
+    {
+        // Cannot create breadcrumbs buffer!
+        return FFX_ERROR_OUT_OF_MEMORY;
+    }
+
+    blockData->heap        = nullptr;
+    blockData->buffer      = blockData->memory;
+    blockData->baseAddress = reinterpret_cast<uint64_t>(blockData->memory);
+
+    return FFX_OK;
+}
+
+void BreadcrumbsFreeBlockNull(
+    FfxInterface* backendInterface,
+    FfxBreadcrumbsBlockData* blockData)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    FFX_ASSERT(NULL != blockData);
+
+    free(blockData->memory);
+    blockData->memory = nullptr;
+    blockData->buffer = nullptr;
+}
+
+void BreadcrumbsWriteNull(
+    FfxInterface* backendInterface,
+    FfxCommandList commandList,
+    uint32_t value,
+    uint64_t gpuLocation,
+    void* gpuBuffer,
+    bool isBegin)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    FFX_ASSERT(NULL != commandList);
+    FFX_ASSERT(NULL != gpuBuffer);
+
+    BackendContext_Null* backendContext = (BackendContext_Null*)backendInterface->scratchBuffer;
+    FfxNullCommandStream* commandStream = reinterpret_cast<FfxNullCommandStream*>(commandList);
+
+    FfxNullCommand* command = recordCommand(backendContext, commandStream, FFX_NULL_COMMAND_BREADCRUMBS_WRITE, 0, L"");
+    command->breadcrumbs.gpuLocation = gpuLocation;
+    command->breadcrumbs.value       = value;
+    command->breadcrumbs.isBegin     = isBegin;
+
+    // Work is considered done as soon as it is recorded
+    *reinterpret_cast<uint32_t*>(gpuLocation) = value;
+}
+
+void BreadcrumbsPrintDeviceInfoNull(
+    FfxInterface* backendInterface,
+    FfxAllocationCallbacks* allocs,
+    bool,
+    char** printBuffer,
+    size_t* printSize)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    FFX_ASSERT(NULL != allocs);
+    FFX_ASSERT(NULL != printBuffer);
+    FFX_ASSERT(NULL != printSize);
+    char* buff = *printBuffer;
+    size_t buffSize = *printSize;
+
+    BackendContext_Null* backendContext = (BackendContext_Null*)backendInterface->scratchBuffer;
+
+    FFX_BREADCRUMBS_APPEND_STRING(buff, buffSize, "[NULL DEVICE]\n");
+    FFX_BREADCRUMBS_PRINT_UINT(buff, buffSize, backendContext->deviceCapabilities, waveLaneCountMin);
+    FFX_BREADCRUMBS_PRINT_UINT(buff, buffSize, backendContext->deviceCapabilities, waveLaneCountMax);
+    FFX_BREADCRUMBS_PRINT_BOOL(buff, buffSize, backendContext->deviceCapabilities, fp16Supported);
+    FFX_BREADCRUMBS_PRINT_BOOL(buff, buffSize, backendContext->deviceCapabilities, raytracingSupported);
+
+    *printBuffer = buff;
+    *printSize = buffSize;
+}
+
+void RegisterConstantBufferAllocatorNull(FfxInterface* backendInterface, FfxConstantBufferAllocator fpConstantAllocator)
+{
+    FFX_ASSERT(NULL != backendInterface);
+
+    BackendContext_Null* backendContext = (BackendContext_Null*)backendInterface->scratchBuffer;
+    backendContext->fpConstantAllocator = fpConstantAllocator;
+}
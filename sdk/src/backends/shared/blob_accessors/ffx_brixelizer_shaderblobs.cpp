@@ -170,26 +170,22 @@ static FfxShaderBlob brixelizerGetCascadeMarkCascadeUninitializedPassPermutation
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_mark_cascade_uninitialized_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_mark_cascade_uninitialized_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_mark_cascade_uninitialized_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_mark_cascade_uninitialized_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_mark_cascade_uninitialized_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_mark_cascade_uninitialized_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_mark_cascade_uninitialized_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_mark_cascade_uninitialized_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_mark_cascade_uninitialized_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_mark_cascade_uninitialized_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_mark_cascade_uninitialized_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_mark_cascade_uninitialized_pass, key.index);
         }
     }
 }
@@ -204,26 +200,22 @@ static FfxShaderBlob brixelizerGetCascadeBuildTreeAABBPassPermutationBlobByIndex
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_build_tree_aabb_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_build_tree_aabb_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_build_tree_aabb_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_build_tree_aabb_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_build_tree_aabb_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_build_tree_aabb_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_build_tree_aabb_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_build_tree_aabb_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_build_tree_aabb_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_build_tree_aabb_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_build_tree_aabb_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_build_tree_aabb_pass, key.index);
         }
     }
 }
@@ -238,26 +230,22 @@ static FfxShaderBlob brixelizerGetCascadeClearBrickStoragePassPermutationBlobByI
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_clear_brick_storage_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_clear_brick_storage_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_clear_brick_storage_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_clear_brick_storage_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_clear_brick_storage_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_clear_brick_storage_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_clear_brick_storage_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_clear_brick_storage_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_clear_brick_storage_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_clear_brick_storage_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_clear_brick_storage_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_clear_brick_storage_pass, key.index);
         }
     }
 }
@@ -272,26 +260,22 @@ static FfxShaderBlob brixelizerGetCascadeClearBuildCountersPassPermutationBlobBy
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_clear_build_counters_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_clear_build_counters_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_clear_build_counters_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_clear_build_counters_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_clear_build_counters_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_clear_build_counters_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_clear_build_counters_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_clear_build_counters_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_clear_build_counters_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_clear_build_counters_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_clear_build_counters_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_clear_build_counters_pass, key.index);
         }
     }
 }
@@ -306,26 +290,22 @@ static FfxShaderBlob brixelizerGetCascadeClearJobCounterPassPermutationBlobByInd
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_clear_job_counter_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_clear_job_counter_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_clear_job_counter_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_clear_job_counter_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_clear_job_counter_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_clear_job_counter_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_clear_job_counter_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_clear_job_counter_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_clear_job_counter_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_clear_job_counter_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_clear_job_counter_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_clear_job_counter_pass, key.index);
         }
     }
 }
@@ -340,26 +320,22 @@ static FfxShaderBlob brixelizerGetCascadeClearRefCountersPassPermutationBlobByIn
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_clear_ref_counters_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_clear_ref_counters_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_clear_ref_counters_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_clear_ref_counters_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_clear_ref_counters_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_clear_ref_counters_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_clear_ref_counters_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_clear_ref_counters_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_clear_ref_counters_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_clear_ref_counters_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_clear_ref_counters_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_clear_ref_counters_pass, key.index);
         }
     }
 }
@@ -374,26 +350,22 @@ static FfxShaderBlob brixelizerGetCascadeCoarseCullingPassPermutationBlobByIndex
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_coarse_culling_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_coarse_culling_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_coarse_culling_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_coarse_culling_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_coarse_culling_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_coarse_culling_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_coarse_culling_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_coarse_culling_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_coarse_culling_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_coarse_culling_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_coarse_culling_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_coarse_culling_pass, key.index);
         }
     }
 }
@@ -408,26 +380,22 @@ static FfxShaderBlob brixelizerGetCascadeCompactReferencesPassPermutationBlobByI
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_compact_references_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_compact_references_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_compact_references_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_compact_references_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_compact_references_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_compact_references_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_compact_references_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_compact_references_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_compact_references_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_compact_references_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_compact_references_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_compact_references_pass, key.index);
         }
     }
 }
@@ -442,26 +410,22 @@ static FfxShaderBlob brixelizerGetCascadeCompressBrickPassPermutationBlobByIndex
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_compress_brick_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_compress_brick_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_compress_brick_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_compress_brick_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_compress_brick_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_compress_brick_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_compress_brick_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_compress_brick_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_compress_brick_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_compress_brick_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_compress_brick_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_compress_brick_pass, key.index);
         }
     }
 }
@@ -476,26 +440,22 @@ static FfxShaderBlob brixelizerGetCascadeEmitSDFPassPermutationBlobByIndex(uint3
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_emit_sdf_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_emit_sdf_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_emit_sdf_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_emit_sdf_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_emit_sdf_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_emit_sdf_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_emit_sdf_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_emit_sdf_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_emit_sdf_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_emit_sdf_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_emit_sdf_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_emit_sdf_pass, key.index);
         }
     }
 }
@@ -510,26 +470,22 @@ static FfxShaderBlob brixelizerGetCascadeFreeCascadePassPermutationBlobByIndex(u
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_free_cascade_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_free_cascade_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_free_cascade_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_free_cascade_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_free_cascade_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_free_cascade_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_free_cascade_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_free_cascade_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_free_cascade_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_free_cascade_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_free_cascade_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_free_cascade_pass, key.index);
         }
     }
 }
@@ -544,26 +500,22 @@ static FfxShaderBlob brixelizerGetCascadeInitializeCascadePassPermutationBlobByI
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_initialize_cascade_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_initialize_cascade_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_initialize_cascade_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_initialize_cascade_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_initialize_cascade_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_initialize_cascade_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_initialize_cascade_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_initialize_cascade_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_initialize_cascade_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_initialize_cascade_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_initialize_cascade_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_initialize_cascade_pass, key.index);
         }
     }
 }
@@ -578,26 +530,22 @@ static FfxShaderBlob brixelizerGetCascadeInvalidateJobAreasPassPermutationBlobBy
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_invalidate_job_areas_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_invalidate_job_areas_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_invalidate_job_areas_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_invalidate_job_areas_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_invalidate_job_areas_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_invalidate_job_areas_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_invalidate_job_areas_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_invalidate_job_areas_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_invalidate_job_areas_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_invalidate_job_areas_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_invalidate_job_areas_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_invalidate_job_areas_pass, key.index);
         }
     }
 }
@@ -612,26 +560,22 @@ static FfxShaderBlob brixelizerGetCascadeResetCascadePassPermutationBlobByIndex(
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_reset_cascade_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_reset_cascade_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_reset_cascade_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_reset_cascade_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_reset_cascade_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_reset_cascade_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_reset_cascade_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_reset_cascade_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_reset_cascade_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_reset_cascade_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_reset_cascade_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_reset_cascade_pass, key.index);
         }
     }
 }
@@ -646,26 +590,22 @@ static FfxShaderBlob brixelizerGetCascadeScanJobsPassPermutationBlobByIndex(uint
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_scan_jobs_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_scan_jobs_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_scan_jobs_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_scan_jobs_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_scan_jobs_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_scan_jobs_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_scan_jobs_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_scan_jobs_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_scan_jobs_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_scan_jobs_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_scan_jobs_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_scan_jobs_pass, key.index);
         }
     }
 }
@@ -680,26 +620,22 @@ static FfxShaderBlob brixelizerGetCascadeScanReferencesPassPermutationBlobByInde
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_scan_references_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_scan_references_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_scan_references_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_scan_references_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_scan_references_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_scan_references_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_scan_references_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_scan_references_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_scan_references_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_scan_references_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_scan_references_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_scan_references_pass, key.index);
         }
     }
 }
@@ -714,26 +650,22 @@ static FfxShaderBlob brixelizerGetCascadeScrollCascadePassPermutationBlobByIndex
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_scroll_cascade_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_scroll_cascade_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_scroll_cascade_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_scroll_cascade_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_scroll_cascade_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_scroll_cascade_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_scroll_cascade_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_scroll_cascade_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_scroll_cascade_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_scroll_cascade_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_scroll_cascade_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_scroll_cascade_pass, key.index);
         }
     }
 }
@@ -748,26 +680,22 @@ static FfxShaderBlob brixelizerGetCascadeVoxelizePassPermutationBlobByIndex(uint
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_voxelize_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_voxelize_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_voxelize_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_voxelize_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_voxelize_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_voxelize_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_voxelize_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_voxelize_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_voxelize_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_cascade_ops_voxelize_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_cascade_ops_voxelize_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_cascade_ops_voxelize_pass, key.index);
         }
     }
 }
@@ -782,26 +710,22 @@ static FfxShaderBlob brixelizerGetContextClearBrickPassPermutationBlobByIndex(ui
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_clear_brick_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_clear_brick_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_clear_brick_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_clear_brick_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_clear_brick_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_clear_brick_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_clear_brick_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_clear_brick_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_clear_brick_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_clear_brick_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_clear_brick_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_clear_brick_pass, key.index);
         }
     }
 }
@@ -816,26 +740,22 @@ static FfxShaderBlob brixelizerGetContextClearCountersPassPermutationBlobByIndex
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_clear_counters_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_clear_counters_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_clear_counters_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_clear_counters_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_clear_counters_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_clear_counters_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_clear_counters_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_clear_counters_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_clear_counters_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_clear_counters_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_clear_counters_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_clear_counters_pass, key.index);
         }
     }
 }
@@ -850,26 +770,22 @@ static FfxShaderBlob brixelizerGetContextCollectClearBricksPassPermutationBlobBy
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_collect_clear_bricks_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_collect_clear_bricks_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_collect_clear_bricks_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_collect_clear_bricks_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_collect_clear_bricks_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_collect_clear_bricks_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_collect_clear_bricks_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_collect_clear_bricks_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_collect_clear_bricks_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_collect_clear_bricks_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_collect_clear_bricks_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_collect_clear_bricks_pass, key.index);
         }
     }
 }
@@ -884,26 +800,22 @@ static FfxShaderBlob brixelizerGetContextCollectDirtyBricksPassPermutationBlobBy
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_collect_dirty_bricks_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_collect_dirty_bricks_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_collect_dirty_bricks_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_collect_dirty_bricks_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_collect_dirty_bricks_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_collect_dirty_bricks_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_collect_dirty_bricks_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_collect_dirty_bricks_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_collect_dirty_bricks_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_collect_dirty_bricks_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_collect_dirty_bricks_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_collect_dirty_bricks_pass, key.index);
         }
     }
 }
@@ -918,26 +830,22 @@ static FfxShaderBlob brixelizerGetContextEikonalPassPermutationBlobByIndex(uint3
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_eikonal_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_eikonal_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_eikonal_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_eikonal_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_eikonal_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_eikonal_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_eikonal_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_eikonal_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_eikonal_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_eikonal_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_eikonal_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_eikonal_pass, key.index);
         }
     }
 }
@@ -952,26 +860,22 @@ static FfxShaderBlob brixelizerGetContextMergeBricksPassPermutationBlobByIndex(u
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_merge_bricks_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_merge_bricks_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_merge_bricks_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_merge_bricks_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_merge_bricks_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_merge_bricks_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_merge_bricks_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_merge_bricks_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_merge_bricks_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_merge_bricks_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_merge_bricks_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_merge_bricks_pass, key.index);
         }
     }
 }
@@ -986,26 +890,22 @@ static FfxShaderBlob brixelizerGetContextMergeCascadesPassPermutationBlobByIndex
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_merge_cascades_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_merge_cascades_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_merge_cascades_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_merge_cascades_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_merge_cascades_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_merge_cascades_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_merge_cascades_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_merge_cascades_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_merge_cascades_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_merge_cascades_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_merge_cascades_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_merge_cascades_pass, key.index);
         }
     }
 }
@@ -1020,26 +920,22 @@ static FfxShaderBlob brixelizerGetContextPrepareClearBricksPassPermutationBlobBy
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_prepare_clear_bricks_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_prepare_clear_bricks_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_prepare_clear_bricks_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_prepare_clear_bricks_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_prepare_clear_bricks_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_prepare_clear_bricks_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_prepare_clear_bricks_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_prepare_clear_bricks_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_prepare_clear_bricks_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_prepare_clear_bricks_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_prepare_clear_bricks_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_prepare_clear_bricks_pass, key.index);
         }
     }
 }
@@ -1054,26 +950,22 @@ static FfxShaderBlob brixelizerGetContextPrepareEikonalArgsPassPermutationBlobBy
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_prepare_eikonal_args_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_prepare_eikonal_args_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_prepare_eikonal_args_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_prepare_eikonal_args_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_prepare_eikonal_args_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_prepare_eikonal_args_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_prepare_eikonal_args_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_prepare_eikonal_args_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_prepare_eikonal_args_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_prepare_eikonal_args_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_prepare_eikonal_args_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_prepare_eikonal_args_pass, key.index);
         }
     }
 }
@@ -1088,26 +980,22 @@ static FfxShaderBlob brixelizerGetContextPrepareMergeBricksArgsPassPermutationBl
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_prepare_merge_bricks_args_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_prepare_merge_bricks_args_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_prepare_merge_bricks_args_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_prepare_merge_bricks_args_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_prepare_merge_bricks_args_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_prepare_merge_bricks_args_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_prepare_merge_bricks_args_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_prepare_merge_bricks_args_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_prepare_merge_bricks_args_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_context_ops_prepare_merge_bricks_args_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_context_ops_prepare_merge_bricks_args_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_context_ops_prepare_merge_bricks_args_pass, key.index);
         }
     }
 }
@@ -1122,26 +1010,22 @@ static FfxShaderBlob brixelizerGetContextDebugVisualizationPassPermutationBlobBy
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_debug_visualization_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_debug_visualization_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_debug_visualization_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_debug_visualization_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_debug_visualization_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_debug_visualization_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_debug_visualization_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_debug_visualization_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_debug_visualization_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_debug_visualization_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_debug_visualization_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_debug_visualization_pass, key.index);
         }
     }
 }
@@ -1155,26 +1039,22 @@ static FfxShaderBlob brixelizerGetDebugDrawInstanceAABBsPermutationBlobByIndex(u
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_debug_draw_instance_aabbs_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_debug_draw_instance_aabbs_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_debug_draw_instance_aabbs_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_debug_draw_instance_aabbs_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_debug_draw_instance_aabbs_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_debug_draw_instance_aabbs_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_debug_draw_instance_aabbs_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_debug_draw_instance_aabbs_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_debug_draw_instance_aabbs_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_debug_draw_instance_aabbs_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_debug_draw_instance_aabbs_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_debug_draw_instance_aabbs, key.index);
         }
     }
 }
@@ -1188,26 +1068,22 @@ static FfxShaderBlob brixelizerGetDebugDrawAABBTreePermutationBlobByIndex(uint32
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_debug_draw_aabb_tree_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_debug_draw_aabb_tree_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_debug_draw_aabb_tree_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_debug_draw_aabb_tree_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_debug_draw_aabb_tree_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_debug_draw_aabb_tree_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizer_debug_draw_aabb_tree_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_debug_draw_aabb_tree_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_debug_draw_aabb_tree_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizer_debug_draw_aabb_tree_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizer_debug_draw_aabb_tree_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizer_debug_draw_aabb_tree, key.index);
         }
     }
 }
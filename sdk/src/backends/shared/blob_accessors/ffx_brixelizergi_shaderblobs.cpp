@@ -127,26 +127,22 @@ static FfxShaderBlob brixelizerGIGetBlurXPassPermutationByIndex(uint32_t permuta
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_blur_x_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_blur_x_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_blur_x_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_blur_x_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_blur_x_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_blur_x_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_blur_x_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_blur_x_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_blur_x_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_blur_x_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_blur_x_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_blur_x, key.index);
         }
     }
 }
@@ -160,26 +156,22 @@ static FfxShaderBlob brixelizerGIGetBlurYPassPermutationByIndex(uint32_t permuta
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_blur_y_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_blur_y_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_blur_y_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_blur_y_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_blur_y_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_blur_y_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_blur_y_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_blur_y_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_blur_y_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_blur_y_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_blur_y_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_blur_y, key.index);
         }
     }
 }
@@ -193,26 +185,22 @@ static FfxShaderBlob brixelizerGIGetClearCachePassPermutationByIndex(uint32_t pe
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_clear_cache_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_clear_cache_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_clear_cache_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_clear_cache_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_clear_cache_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_clear_cache_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_clear_cache_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_clear_cache_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_clear_cache_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_clear_cache_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_clear_cache_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_clear_cache, key.index);
         }
     }
 }
@@ -226,26 +214,22 @@ static FfxShaderBlob brixelizerGIGetEmitIrradianceCachePassPermutationByIndex(ui
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_emit_irradiance_cache_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_emit_irradiance_cache_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_emit_irradiance_cache_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_emit_irradiance_cache_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_emit_irradiance_cache_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_emit_irradiance_cache_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_emit_irradiance_cache_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_emit_irradiance_cache_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_emit_irradiance_cache_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_emit_irradiance_cache_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_emit_irradiance_cache_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_emit_irradiance_cache, key.index);
         }
     }
 }
@@ -259,26 +243,22 @@ static FfxShaderBlob brixelizerGIGetEmitPrimaryRayRadiancePassPermutationByIndex
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_emit_primary_ray_radiance_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_emit_primary_ray_radiance_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_emit_primary_ray_radiance_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_emit_primary_ray_radiance_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_emit_primary_ray_radiance_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_emit_primary_ray_radiance_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_emit_primary_ray_radiance_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_emit_primary_ray_radiance_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_emit_primary_ray_radiance_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_emit_primary_ray_radiance_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_emit_primary_ray_radiance_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_emit_primary_ray_radiance, key.index);
         }
     }
 }
@@ -292,26 +272,22 @@ static FfxShaderBlob brixelizerGIGetFillScreenProbesPassPermutationByIndex(uint3
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_fill_screen_probes_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_fill_screen_probes_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_fill_screen_probes_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_fill_screen_probes_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_fill_screen_probes_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_fill_screen_probes_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_fill_screen_probes_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_fill_screen_probes_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_fill_screen_probes_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_fill_screen_probes_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_fill_screen_probes_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_fill_screen_probes, key.index);
         }
     }
 }
@@ -325,26 +301,22 @@ static FfxShaderBlob brixelizerGIGetInterpolateScreenProbesPassPermutationByInde
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_interpolate_screen_probes_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_interpolate_screen_probes_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_interpolate_screen_probes_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_interpolate_screen_probes_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_interpolate_screen_probes_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_interpolate_screen_probes_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_interpolate_screen_probes_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_interpolate_screen_probes_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_interpolate_screen_probes_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_interpolate_screen_probes_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_interpolate_screen_probes_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_interpolate_screen_probes, key.index);
         }
     }
 }
@@ -358,26 +330,22 @@ static FfxShaderBlob brixelizerGIGetPrepareClearCachePassPermutationByIndex(uint
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_prepare_clear_cache_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_prepare_clear_cache_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_prepare_clear_cache_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_prepare_clear_cache_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_prepare_clear_cache_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_prepare_clear_cache_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_prepare_clear_cache_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_prepare_clear_cache_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_prepare_clear_cache_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_prepare_clear_cache_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_prepare_clear_cache_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_prepare_clear_cache, key.index);
         }
     }
 }
@@ -391,26 +359,22 @@ static FfxShaderBlob brixelizerGIGetProjectScreenProbesPassPermutationByIndex(ui
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_project_screen_probes_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_project_screen_probes_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_project_screen_probes_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_project_screen_probes_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_project_screen_probes_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_project_screen_probes_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_project_screen_probes_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_project_screen_probes_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_project_screen_probes_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_project_screen_probes_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_project_screen_probes_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_project_screen_probes, key.index);
         }
     }
 }
@@ -424,26 +388,22 @@ static FfxShaderBlob brixelizerGIGetPropagateSHPassPermutationByIndex(uint32_t p
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_propagate_sh_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_propagate_sh_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_propagate_sh_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_propagate_sh_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_propagate_sh_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_propagate_sh_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_propagate_sh_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_propagate_sh_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_propagate_sh_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_propagate_sh_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_propagate_sh_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_propagate_sh, key.index);
         }
     }
 }
@@ -457,26 +417,22 @@ static FfxShaderBlob brixelizerGIGetReprojectGIPassPermutationByIndex(uint32_t p
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_reproject_gi_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_reproject_gi_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_reproject_gi_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_reproject_gi_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_reproject_gi_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_reproject_gi_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_reproject_gi_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_reproject_gi_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_reproject_gi_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_reproject_gi_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_reproject_gi_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_reproject_gi, key.index);
         }
     }
 }
@@ -490,26 +446,22 @@ static FfxShaderBlob brixelizerGIGetReprojectScreenProbesPassPermutationByIndex(
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_reproject_screen_probes_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_reproject_screen_probes_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_reproject_screen_probes_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_reproject_screen_probes_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_reproject_screen_probes_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_reproject_screen_probes_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_reproject_screen_probes_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_reproject_screen_probes_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_reproject_screen_probes_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_reproject_screen_probes_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_reproject_screen_probes_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_reproject_screen_probes, key.index);
         }
     }
 }
@@ -523,26 +475,22 @@ static FfxShaderBlob brixelizerGIGetSpawnScreenProbesPassPermutationByIndex(uint
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_spawn_screen_probes_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_spawn_screen_probes_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_spawn_screen_probes_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_spawn_screen_probes_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_spawn_screen_probes_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_spawn_screen_probes_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_spawn_screen_probes_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_spawn_screen_probes_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_spawn_screen_probes_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_spawn_screen_probes_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_spawn_screen_probes_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_spawn_screen_probes, key.index);
         }
     }
 }
@@ -556,26 +504,22 @@ static FfxShaderBlob brixelizerGIGetSpecularPreTracePassPermutationByIndex(uint3
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_specular_pre_trace_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_specular_pre_trace_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_specular_pre_trace_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_specular_pre_trace_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_specular_pre_trace_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_specular_pre_trace_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_specular_pre_trace_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_specular_pre_trace_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_specular_pre_trace_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_specular_pre_trace_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_specular_pre_trace_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_specular_pre_trace, key.index);
         }
     }
 }
@@ -589,26 +533,22 @@ static FfxShaderBlob brixelizerGIGetSpecularTracePassPermutationByIndex(uint32_t
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_specular_trace_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_specular_trace_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_specular_trace_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_specular_trace_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_specular_trace_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_specular_trace_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_specular_trace_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_specular_trace_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_specular_trace_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_specular_trace_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_specular_trace_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_specular_trace, key.index);
         }
     }
 }
@@ -622,26 +562,22 @@ static FfxShaderBlob brixelizerGIGetDebugVisualizationPassPermutationByIndex(uin
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_debug_visualization_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_debug_visualization_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_debug_visualization_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_debug_visualization_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_debug_visualization_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_debug_visualization_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_debug_visualization_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_debug_visualization_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_debug_visualization_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_debug_visualization_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_debug_visualization_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_debug_visualization, key.index);
         }
     }
 }
@@ -655,26 +591,22 @@ static FfxShaderBlob brixelizerGIGetGenerateDisocclusionMaskPassPermutationByInd
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_generate_disocclusion_mask_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_generate_disocclusion_mask_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_generate_disocclusion_mask_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_generate_disocclusion_mask_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_generate_disocclusion_mask_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_generate_disocclusion_mask_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_generate_disocclusion_mask_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_generate_disocclusion_mask_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_generate_disocclusion_mask_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_generate_disocclusion_mask_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_generate_disocclusion_mask_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_generate_disocclusion_mask, key.index);
         }
     }
 }
@@ -688,26 +620,22 @@ static FfxShaderBlob brixelizerGIGetDownsamplePassPermutationByIndex(uint32_t pe
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_downsample_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_downsample_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_downsample_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_downsample_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_downsample_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_downsample_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_downsample_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_downsample_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_downsample_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_downsample_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_downsample_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_downsample, key.index);
         }
     }
 }
@@ -721,26 +649,22 @@ static FfxShaderBlob brixelizerGIGetUpsamplePassPermutationByIndex(uint32_t perm
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_upsample_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_upsample_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_upsample_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_upsample_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_upsample_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_upsample_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_upsample_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_upsample_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_upsample_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_brixelizergi_upsample_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_brixelizergi_upsample_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_brixelizergi_upsample, key.index);
         }
     }
 }
@@ -169,21 +169,17 @@ static FfxShaderBlob cacaoGetApplyNonSmartPassPermutationBlobByIndex(uint32_t pe
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
     if (isWave64){
         if (is16bit) {
-            const int32_t tableIndex = g_ffx_cacao_apply_non_smart_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_apply_non_smart_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_apply_non_smart_pass_wave64_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_cacao_apply_non_smart_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_apply_non_smart_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_apply_non_smart_pass_wave64, key.index);
         }
     }else{
         if (is16bit) {
-            const int32_t tableIndex = g_ffx_cacao_apply_non_smart_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_apply_non_smart_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_apply_non_smart_pass_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_cacao_apply_non_smart_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_apply_non_smart_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_apply_non_smart_pass, key.index);
         }
     }
 }
@@ -197,22 +193,18 @@ static FfxShaderBlob cacaoGetApplyNonSmartHalfPassPermutationBlobByIndex(uint32_
     if(isWave64){
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_cacao_apply_non_smart_half_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_apply_non_smart_half_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_apply_non_smart_half_pass_wave64_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_cacao_apply_non_smart_half_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_apply_non_smart_half_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_apply_non_smart_half_pass_wave64, key.index);
         }
     }else{
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_cacao_apply_non_smart_half_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_apply_non_smart_half_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_apply_non_smart_half_pass_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_cacao_apply_non_smart_half_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_apply_non_smart_half_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_apply_non_smart_half_pass, key.index);
         }
     }
 }
@@ -223,11 +215,9 @@ static FfxShaderBlob cacaoGetApplyPassPermutationBlobByIndex(uint32_t permutatio
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
 
     if(isWave64){
-        const int32_t tableIndex = g_ffx_cacao_apply_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_apply_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_apply_pass_wave64, key.index);
     }else{
-        const int32_t tableIndex = g_ffx_cacao_apply_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_apply_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_apply_pass, key.index);
     }
 }
 
@@ -238,11 +228,9 @@ static FfxShaderBlob cacaoGetClearLoadCounterPassPermutationBlobByIndex(uint32_t
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
 
     if(isWave64){
-        const int32_t tableIndex = g_ffx_cacao_clear_load_counter_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_clear_load_counter_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_clear_load_counter_pass_wave64, key.index);
     }else{
-        const int32_t tableIndex = g_ffx_cacao_clear_load_counter_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_clear_load_counter_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_clear_load_counter_pass, key.index);
     }
 }
 
@@ -253,11 +241,9 @@ static FfxShaderBlob cacaoGetEdgeSensitiveBlur1PassPermutationBlobByIndex(uint32
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
 
     if(isWave64){
-        const int32_t tableIndex = g_ffx_cacao_edge_sensitive_blur_1_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_edge_sensitive_blur_1_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_edge_sensitive_blur_1_pass_wave64, key.index);
     }else{
-        const int32_t tableIndex = g_ffx_cacao_edge_sensitive_blur_1_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_edge_sensitive_blur_1_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_edge_sensitive_blur_1_pass, key.index);
     }
 }
 
@@ -268,11 +254,9 @@ static FfxShaderBlob cacaoGetEdgeSensitiveBlur2PassPermutationBlobByIndex(uint32
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
     
     if(isWave64){
-        const int32_t tableIndex = g_ffx_cacao_edge_sensitive_blur_2_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_edge_sensitive_blur_2_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_edge_sensitive_blur_2_pass_wave64, key.index);
     }else{        
-        const int32_t tableIndex = g_ffx_cacao_edge_sensitive_blur_2_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_edge_sensitive_blur_2_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_edge_sensitive_blur_2_pass, key.index);
     }
 }
 
@@ -283,11 +267,9 @@ static FfxShaderBlob cacaoGetEdgeSensitiveBlur3PassPermutationBlobByIndex(uint32
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
 
     if(isWave64){
-        const int32_t tableIndex = g_ffx_cacao_edge_sensitive_blur_3_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_edge_sensitive_blur_3_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_edge_sensitive_blur_3_pass_wave64, key.index);
     }else{
-        const int32_t tableIndex = g_ffx_cacao_edge_sensitive_blur_3_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_edge_sensitive_blur_3_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_edge_sensitive_blur_3_pass, key.index);
     }
 }
 
@@ -298,11 +280,9 @@ static FfxShaderBlob cacaoGetEdgeSensitiveBlur4PassPermutationBlobByIndex(uint32
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
 
     if(isWave64){
-        const int32_t tableIndex = g_ffx_cacao_edge_sensitive_blur_4_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_edge_sensitive_blur_4_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_edge_sensitive_blur_4_pass_wave64, key.index);
     }else{
-        const int32_t tableIndex = g_ffx_cacao_edge_sensitive_blur_4_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_edge_sensitive_blur_4_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_edge_sensitive_blur_4_pass, key.index);
     }
 }
 
@@ -313,11 +293,9 @@ static FfxShaderBlob cacaoGetEdgeSensitiveBlur5PassPermutationBlobByIndex(uint32
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
 
     if(isWave64){
-        const int32_t tableIndex = g_ffx_cacao_edge_sensitive_blur_5_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_edge_sensitive_blur_5_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_edge_sensitive_blur_5_pass_wave64, key.index);
     }else{
-        const int32_t tableIndex = g_ffx_cacao_edge_sensitive_blur_5_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_edge_sensitive_blur_5_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_edge_sensitive_blur_5_pass, key.index);
     }
 }
 
@@ -328,11 +306,9 @@ static FfxShaderBlob cacaoGetEdgeSensitiveBlur6PassPermutationBlobByIndex(uint32
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
 
     if(isWave64){
-        const int32_t tableIndex = g_ffx_cacao_edge_sensitive_blur_6_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_edge_sensitive_blur_6_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_edge_sensitive_blur_6_pass_wave64, key.index);
     }else{
-        const int32_t tableIndex = g_ffx_cacao_edge_sensitive_blur_6_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_edge_sensitive_blur_6_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_edge_sensitive_blur_6_pass, key.index);
     }
 }
 
@@ -343,11 +319,9 @@ static FfxShaderBlob cacaoGetEdgeSensitiveBlur7PassPermutationBlobByIndex(uint32
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
 
     if(isWave64){
-        const int32_t tableIndex = g_ffx_cacao_edge_sensitive_blur_7_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_edge_sensitive_blur_7_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_edge_sensitive_blur_7_pass_wave64, key.index);
     }else{
-        const int32_t tableIndex = g_ffx_cacao_edge_sensitive_blur_7_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_edge_sensitive_blur_7_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_edge_sensitive_blur_7_pass, key.index);
     }
 }
 
@@ -358,11 +332,9 @@ static FfxShaderBlob cacaoGetEdgeSensitiveBlur8PassPermutationBlobByIndex(uint32
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
 
     if(isWave64){
-        const int32_t tableIndex = g_ffx_cacao_edge_sensitive_blur_8_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_edge_sensitive_blur_8_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_edge_sensitive_blur_8_pass_wave64, key.index);
     }else{
-        const int32_t tableIndex = g_ffx_cacao_edge_sensitive_blur_8_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_edge_sensitive_blur_8_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_edge_sensitive_blur_8_pass, key.index);
     }
 }
 
@@ -373,11 +345,9 @@ static FfxShaderBlob cacaoGetGenerateImportanceMapPassPermutationBlobByIndex(uin
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
 
     if(isWave64){
-        const int32_t tableIndex = g_ffx_cacao_generate_importance_map_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_generate_importance_map_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_generate_importance_map_pass_wave64, key.index);
     }else{
-        const int32_t tableIndex = g_ffx_cacao_generate_importance_map_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_generate_importance_map_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_generate_importance_map_pass, key.index);
     }
 }
 
@@ -388,11 +358,9 @@ static FfxShaderBlob cacaoGetGenerateImportanceMapAPassPermutationBlobByIndex(ui
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
 
     if(isWave64){
-        const int32_t tableIndex = g_ffx_cacao_generate_importance_map_a_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_generate_importance_map_a_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_generate_importance_map_a_pass_wave64, key.index);
     }else{
-        const int32_t tableIndex = g_ffx_cacao_generate_importance_map_a_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_generate_importance_map_a_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_generate_importance_map_a_pass, key.index);
     }
 }
 
@@ -403,11 +371,9 @@ static FfxShaderBlob cacaoGetGenerateImportanceMapBPassPermutationBlobByIndex(ui
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
 
     if(isWave64){
-        const int32_t tableIndex = g_ffx_cacao_generate_importance_map_b_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_generate_importance_map_b_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_generate_importance_map_b_pass_wave64, key.index);
     }else{
-        const int32_t tableIndex = g_ffx_cacao_generate_importance_map_b_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_generate_importance_map_b_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_generate_importance_map_b_pass, key.index);
     }
 }
 
@@ -418,11 +384,9 @@ static FfxShaderBlob cacaoGetGenerateQ0PassPermutationBlobByIndex(uint32_t permu
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
 
     if(isWave64){
-        const int32_t tableIndex = g_ffx_cacao_generate_q0_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_generate_q0_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_generate_q0_pass_wave64, key.index);
     }else{
-        const int32_t tableIndex = g_ffx_cacao_generate_q0_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_generate_q0_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_generate_q0_pass, key.index);
     }
 }
 
@@ -433,11 +397,9 @@ static FfxShaderBlob cacaoGetGenerateQ1PassPermutationBlobByIndex(uint32_t permu
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
 
     if(isWave64){
-        const int32_t tableIndex = g_ffx_cacao_generate_q1_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_generate_q1_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_generate_q1_pass_wave64, key.index);
     }else{
-        const int32_t tableIndex = g_ffx_cacao_generate_q1_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_generate_q1_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_generate_q1_pass, key.index);
     }
 }
 
@@ -448,11 +410,9 @@ static FfxShaderBlob cacaoGetGenerateQ2PassPermutationBlobByIndex(uint32_t permu
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
 
     if(isWave64){
-        const int32_t tableIndex = g_ffx_cacao_generate_q2_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_generate_q2_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_generate_q2_pass_wave64, key.index);
     }else{
-        const int32_t tableIndex = g_ffx_cacao_generate_q2_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_generate_q2_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_generate_q2_pass, key.index);
     }
 }
 
@@ -463,11 +423,9 @@ static FfxShaderBlob cacaoGetGenerateQ3PassPermutationBlobByIndex(uint32_t permu
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
 
     if(isWave64){
-        const int32_t tableIndex = g_ffx_cacao_generate_q3_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_generate_q3_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_generate_q3_pass_wave64, key.index);
     }else{
-        const int32_t tableIndex = g_ffx_cacao_generate_q3_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_generate_q3_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_generate_q3_pass, key.index);
     }
 }
 
@@ -478,11 +436,9 @@ static FfxShaderBlob cacaoGetGenerateQ3BasePassPermutationBlobByIndex(uint32_t p
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
 
     if(isWave64){
-        const int32_t tableIndex = g_ffx_cacao_generate_q3_base_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_generate_q3_base_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_generate_q3_base_pass_wave64, key.index);
     }else{
-        const int32_t tableIndex = g_ffx_cacao_generate_q3_base_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_generate_q3_base_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_generate_q3_base_pass, key.index);
     }
 }
 
@@ -493,11 +449,9 @@ static FfxShaderBlob cacaoGetPrepareDownsampledDepthsAndMipsPassPermutationBlobB
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
 
     if(isWave64){
-        const int32_t tableIndex = g_ffx_cacao_prepare_downsampled_depths_and_mips_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_prepare_downsampled_depths_and_mips_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_prepare_downsampled_depths_and_mips_pass_wave64, key.index);
     }else{
-        const int32_t tableIndex = g_ffx_cacao_prepare_downsampled_depths_and_mips_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_prepare_downsampled_depths_and_mips_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_prepare_downsampled_depths_and_mips_pass, key.index);
     }
 }
 
@@ -510,22 +464,18 @@ static FfxShaderBlob cacaoGetPrepareDownsampledDepthsHalfPassPermutationBlobByIn
     if(isWave64){
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_cacao_prepare_downsampled_depths_half_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_prepare_downsampled_depths_half_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_prepare_downsampled_depths_half_pass_wave64_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_cacao_prepare_downsampled_depths_half_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_prepare_downsampled_depths_half_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_prepare_downsampled_depths_half_pass_wave64, key.index);
         }
     }else{
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_cacao_prepare_downsampled_depths_half_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_prepare_downsampled_depths_half_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_prepare_downsampled_depths_half_pass_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_cacao_prepare_downsampled_depths_half_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_prepare_downsampled_depths_half_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_prepare_downsampled_depths_half_pass, key.index);
         }
     }
 }
@@ -539,22 +489,18 @@ static FfxShaderBlob cacaoGetPrepareDownsampledDepthsPassPermutationBlobByIndex(
     if(isWave64){
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_cacao_prepare_downsampled_depths_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_prepare_downsampled_depths_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_prepare_downsampled_depths_pass_wave64_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_cacao_prepare_downsampled_depths_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_prepare_downsampled_depths_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_prepare_downsampled_depths_pass_wave64, key.index);
         }
     }else{
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_cacao_prepare_downsampled_depths_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_prepare_downsampled_depths_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_prepare_downsampled_depths_pass_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_cacao_prepare_downsampled_depths_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_prepare_downsampled_depths_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_prepare_downsampled_depths_pass, key.index);
         }
     }
 }
@@ -566,11 +512,9 @@ static FfxShaderBlob cacaoGetPrepareDownsampledNormalsFromInputNormalsPassPermut
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
 
     if(isWave64){
-        const int32_t tableIndex = g_ffx_cacao_prepare_downsampled_normals_from_input_normals_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_prepare_downsampled_normals_from_input_normals_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_prepare_downsampled_normals_from_input_normals_pass_wave64, key.index);
     }else{
-        const int32_t tableIndex = g_ffx_cacao_prepare_downsampled_normals_from_input_normals_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_prepare_downsampled_normals_from_input_normals_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_prepare_downsampled_normals_from_input_normals_pass, key.index);
     }
 }
 
@@ -581,11 +525,9 @@ static FfxShaderBlob cacaoGetPrepareDownsampledNormalsPassPermutationBlobByIndex
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
 
     if(isWave64){
-        const int32_t tableIndex = g_ffx_cacao_prepare_downsampled_normals_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_prepare_downsampled_normals_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_prepare_downsampled_normals_pass_wave64, key.index);
     }else{
-        const int32_t tableIndex = g_ffx_cacao_prepare_downsampled_normals_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_prepare_downsampled_normals_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_prepare_downsampled_normals_pass, key.index);
     }
 }
 
@@ -596,11 +538,9 @@ static FfxShaderBlob cacaoGetPrepareNativeDepthsAndMipsPassPermutationBlobByInde
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
 
     if(isWave64){
-        const int32_t tableIndex = g_ffx_cacao_prepare_native_depths_and_mips_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_prepare_native_depths_and_mips_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_prepare_native_depths_and_mips_pass_wave64, key.index);
     }else{
-        const int32_t tableIndex = g_ffx_cacao_prepare_native_depths_and_mips_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_prepare_native_depths_and_mips_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_prepare_native_depths_and_mips_pass, key.index);
     }
 }
 
@@ -613,22 +553,18 @@ static FfxShaderBlob cacaoGetPrepareNativeDepthsHalfPassPermutationBlobByIndex(u
     if(isWave64){
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_cacao_prepare_native_depths_half_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_prepare_native_depths_half_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_prepare_native_depths_half_pass_wave64_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_cacao_prepare_native_depths_half_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_prepare_native_depths_half_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_prepare_native_depths_half_pass_wave64, key.index);
         }
     }else{
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_cacao_prepare_native_depths_half_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_prepare_native_depths_half_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_prepare_native_depths_half_pass_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_cacao_prepare_native_depths_half_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_prepare_native_depths_half_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_prepare_native_depths_half_pass, key.index);
         }
     }
 }
@@ -642,22 +578,18 @@ static FfxShaderBlob cacaoGetPrepareNativeDepthsPassPermutationBlobByIndex(uint3
     if(isWave64){
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_cacao_prepare_native_depths_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_prepare_native_depths_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_prepare_native_depths_pass_wave64_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_cacao_prepare_native_depths_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_prepare_native_depths_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_prepare_native_depths_pass_wave64, key.index);
         }
     }else{
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_cacao_prepare_native_depths_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_prepare_native_depths_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_prepare_native_depths_pass_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_cacao_prepare_native_depths_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_prepare_native_depths_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_prepare_native_depths_pass, key.index);
         }
     }
 }
@@ -669,11 +601,9 @@ static FfxShaderBlob cacaoGetPrepareNativeNormalsFromInputNormalsPassPermutation
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
 
     if(isWave64){
-        const int32_t tableIndex = g_ffx_cacao_prepare_native_normals_from_input_normals_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_prepare_native_normals_from_input_normals_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_prepare_native_normals_from_input_normals_pass_wave64, key.index);
     }else{
-        const int32_t tableIndex = g_ffx_cacao_prepare_native_normals_from_input_normals_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_prepare_native_normals_from_input_normals_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_prepare_native_normals_from_input_normals_pass, key.index);
     }
 }
 
@@ -684,11 +614,9 @@ static FfxShaderBlob cacaoGetPrepareNativeNormalsPassPermutationBlobByIndex(uint
     POPULATE_PERMUTATION_KEY(permutationOptions, key);
 
     if(isWave64){
-        const int32_t tableIndex = g_ffx_cacao_prepare_native_normals_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_prepare_native_normals_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_prepare_native_normals_pass_wave64, key.index);
     }else{
-        const int32_t tableIndex = g_ffx_cacao_prepare_native_normals_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_prepare_native_normals_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_prepare_native_normals_pass, key.index);
     }
 }
 
@@ -701,22 +629,18 @@ static FfxShaderBlob cacaoGetUpscaleBilateral5x5PassPermutationBlobByIndex(uint3
     if(isWave64){
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_cacao_upscale_bilateral_5x5_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_upscale_bilateral_5x5_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_upscale_bilateral_5x5_pass_wave64_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_cacao_upscale_bilateral_5x5_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_upscale_bilateral_5x5_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_upscale_bilateral_5x5_pass_wave64, key.index);
         }
     }else{
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_cacao_upscale_bilateral_5x5_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_upscale_bilateral_5x5_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_upscale_bilateral_5x5_pass_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_cacao_upscale_bilateral_5x5_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_cacao_upscale_bilateral_5x5_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_cacao_upscale_bilateral_5x5_pass, key.index);
         }
     }
 }
@@ -59,14 +59,12 @@ static FfxShaderBlob classifierGetPassClassifierPermutationBlobByIndex(uint32_t
     // f32 path not supported, always return f16
     if (isWave64)
     {
-        const int32_t tableIndex = g_ffx_classifier_shadows_pass_wave64_16bit_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_classifier_shadows_pass_wave64_16bit_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_classifier_shadows_pass_wave64_16bit, key.index);
 
     }
     else
     {
-        const int32_t tableIndex = g_ffx_classifier_shadows_pass_16bit_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_classifier_shadows_pass_16bit_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_classifier_shadows_pass_16bit, key.index);
 
     }
 }
@@ -81,26 +79,22 @@ static FfxShaderBlob classifierGetPassReflectionsPermutationBlobByIndex(uint32_t
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_classifier_reflections_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_classifier_reflections_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_classifier_reflections_pass_wave64_16bit, key.index);
         }
         else {
 
-            const int32_t tableIndex = g_ffx_classifier_reflections_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_classifier_reflections_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_classifier_reflections_pass_wave64, key.index);
         }
     }
     else {
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_classifier_reflections_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_classifier_reflections_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_classifier_reflections_pass_16bit, key.index);
         }
         else {
 
-            const int32_t tableIndex = g_ffx_classifier_reflections_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_classifier_reflections_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_classifier_reflections_pass, key.index);
         }
     }
 }
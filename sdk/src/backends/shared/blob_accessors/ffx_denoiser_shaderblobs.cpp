@@ -87,26 +87,22 @@ key.FFX_DENOISER_OPTION_INVERTED_DEPTH = FFX_CONTAINS_FLAG(options, DENOISER_SHA
 
          if (is16bit) {
 
-             const int32_t tableIndex = g_ffx_denoiser_prepare_shadow_mask_pass_wave64_16bit_IndirectionTable[key.index];
-             return POPULATE_SHADER_BLOB_FFX(g_ffx_denoiser_prepare_shadow_mask_pass_wave64_16bit_PermutationInfo, tableIndex);
+             return FFX_POPULATE_PERMUTATION_BLOB(ffx_denoiser_prepare_shadow_mask_pass_wave64_16bit, key.index);
          }
          else {
 
-             const int32_t tableIndex = g_ffx_denoiser_prepare_shadow_mask_pass_wave64_IndirectionTable[key.index];
-             return POPULATE_SHADER_BLOB_FFX(g_ffx_denoiser_prepare_shadow_mask_pass_wave64_PermutationInfo, tableIndex);
+             return FFX_POPULATE_PERMUTATION_BLOB(ffx_denoiser_prepare_shadow_mask_pass_wave64, key.index);
          }
      }
      else {
 
          if (is16bit) {
 
-             const int32_t tableIndex = g_ffx_denoiser_prepare_shadow_mask_pass_16bit_IndirectionTable[key.index];
-             return POPULATE_SHADER_BLOB_FFX(g_ffx_denoiser_prepare_shadow_mask_pass_16bit_PermutationInfo, tableIndex);
+             return FFX_POPULATE_PERMUTATION_BLOB(ffx_denoiser_prepare_shadow_mask_pass_16bit, key.index);
          }
          else {
 
-             const int32_t tableIndex = g_ffx_denoiser_prepare_shadow_mask_pass_IndirectionTable[key.index];
-             return POPULATE_SHADER_BLOB_FFX(g_ffx_denoiser_prepare_shadow_mask_pass_PermutationInfo, tableIndex);
+             return FFX_POPULATE_PERMUTATION_BLOB(ffx_denoiser_prepare_shadow_mask_pass, key.index);
          }
      }
  }
@@ -122,26 +118,22 @@ key.FFX_DENOISER_OPTION_INVERTED_DEPTH = FFX_CONTAINS_FLAG(options, DENOISER_SHA
 
          if (is16bit) {
 
-             const int32_t tableIndex = g_ffx_denoiser_shadows_tile_classification_pass_wave64_16bit_IndirectionTable[key.index];
-             return POPULATE_SHADER_BLOB_FFX(g_ffx_denoiser_shadows_tile_classification_pass_wave64_16bit_PermutationInfo, tableIndex);
+             return FFX_POPULATE_PERMUTATION_BLOB(ffx_denoiser_shadows_tile_classification_pass_wave64_16bit, key.index);
          }
          else {
 
-             const int32_t tableIndex = g_ffx_denoiser_shadows_tile_classification_pass_wave64_IndirectionTable[key.index];
-             return POPULATE_SHADER_BLOB_FFX(g_ffx_denoiser_shadows_tile_classification_pass_wave64_PermutationInfo, tableIndex);
+             return FFX_POPULATE_PERMUTATION_BLOB(ffx_denoiser_shadows_tile_classification_pass_wave64, key.index);
          }
      }
      else {
 
          if (is16bit) {
 
-             const int32_t tableIndex = g_ffx_denoiser_shadows_tile_classification_pass_16bit_IndirectionTable[key.index];
-             return POPULATE_SHADER_BLOB_FFX(g_ffx_denoiser_shadows_tile_classification_pass_16bit_PermutationInfo, tableIndex);
+             return FFX_POPULATE_PERMUTATION_BLOB(ffx_denoiser_shadows_tile_classification_pass_16bit, key.index);
          }
          else {
 
-             const int32_t tableIndex = g_ffx_denoiser_shadows_tile_classification_pass_IndirectionTable[key.index];
-             return POPULATE_SHADER_BLOB_FFX(g_ffx_denoiser_shadows_tile_classification_pass_PermutationInfo, tableIndex);
+             return FFX_POPULATE_PERMUTATION_BLOB(ffx_denoiser_shadows_tile_classification_pass, key.index);
          }
      }
  }
@@ -155,13 +147,11 @@ key.FFX_DENOISER_OPTION_INVERTED_DEPTH = FFX_CONTAINS_FLAG(options, DENOISER_SHA
 
      if (isWave64)
      {
-         const int32_t tableIndex = g_ffx_denoiser_filter_soft_shadows_0_pass_wave64_16bit_IndirectionTable[key.index];
-         return POPULATE_SHADER_BLOB_FFX(g_ffx_denoiser_filter_soft_shadows_0_pass_wave64_16bit_PermutationInfo, tableIndex);
+         return FFX_POPULATE_PERMUTATION_BLOB(ffx_denoiser_filter_soft_shadows_0_pass_wave64_16bit, key.index);
      }
      else
      {
-         const int32_t tableIndex = g_ffx_denoiser_filter_soft_shadows_0_pass_16bit_IndirectionTable[key.index];
-         return POPULATE_SHADER_BLOB_FFX(g_ffx_denoiser_filter_soft_shadows_0_pass_16bit_PermutationInfo, tableIndex);
+         return FFX_POPULATE_PERMUTATION_BLOB(ffx_denoiser_filter_soft_shadows_0_pass_16bit, key.index);
      }
  }
 
@@ -174,13 +164,11 @@ key.FFX_DENOISER_OPTION_INVERTED_DEPTH = FFX_CONTAINS_FLAG(options, DENOISER_SHA
 
      if (isWave64)
      {
-         const int32_t tableIndex = g_ffx_denoiser_filter_soft_shadows_1_pass_wave64_16bit_IndirectionTable[key.index];
-         return POPULATE_SHADER_BLOB_FFX(g_ffx_denoiser_filter_soft_shadows_1_pass_wave64_16bit_PermutationInfo, tableIndex);
+         return FFX_POPULATE_PERMUTATION_BLOB(ffx_denoiser_filter_soft_shadows_1_pass_wave64_16bit, key.index);
      }
      else
      {
-         const int32_t tableIndex = g_ffx_denoiser_filter_soft_shadows_1_pass_16bit_IndirectionTable[key.index];
-         return POPULATE_SHADER_BLOB_FFX(g_ffx_denoiser_filter_soft_shadows_1_pass_16bit_PermutationInfo, tableIndex);
+         return FFX_POPULATE_PERMUTATION_BLOB(ffx_denoiser_filter_soft_shadows_1_pass_16bit, key.index);
      }
  }
 
@@ -192,13 +180,11 @@ key.FFX_DENOISER_OPTION_INVERTED_DEPTH = FFX_CONTAINS_FLAG(options, DENOISER_SHA
 
      if (isWave64)
      {
-         const int32_t tableIndex = g_ffx_denoiser_filter_soft_shadows_2_pass_wave64_16bit_IndirectionTable[key.index];
-         return POPULATE_SHADER_BLOB_FFX(g_ffx_denoiser_filter_soft_shadows_2_pass_wave64_16bit_PermutationInfo, tableIndex);
+         return FFX_POPULATE_PERMUTATION_BLOB(ffx_denoiser_filter_soft_shadows_2_pass_wave64_16bit, key.index);
      }
      else
      {
-         const int32_t tableIndex = g_ffx_denoiser_filter_soft_shadows_2_pass_16bit_IndirectionTable[key.index];
-         return POPULATE_SHADER_BLOB_FFX(g_ffx_denoiser_filter_soft_shadows_2_pass_16bit_PermutationInfo, tableIndex);
+         return FFX_POPULATE_PERMUTATION_BLOB(ffx_denoiser_filter_soft_shadows_2_pass_16bit, key.index);
      }
  }
 
@@ -212,26 +198,22 @@ static FfxShaderBlob denoiserGetReprojectReflectionsPermutationBlobByIndex(uint3
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_denoiser_reproject_reflections_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_denoiser_reproject_reflections_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_denoiser_reproject_reflections_pass_wave64_16bit, key.index);
         }
         else {
 
-            const int32_t tableIndex = g_ffx_denoiser_reproject_reflections_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_denoiser_reproject_reflections_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_denoiser_reproject_reflections_pass_wave64, key.index);
         }
     }
     else {
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_denoiser_reproject_reflections_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_denoiser_reproject_reflections_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_denoiser_reproject_reflections_pass_16bit, key.index);
         }
         else {
 
-            const int32_t tableIndex = g_ffx_denoiser_reproject_reflections_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_denoiser_reproject_reflections_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_denoiser_reproject_reflections_pass, key.index);
         }
     }
 }
@@ -246,26 +228,22 @@ static FfxShaderBlob denoiserGetPrefilterReflectionsPermutationBlobByIndex(uint3
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_denoiser_prefilter_reflections_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_denoiser_prefilter_reflections_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_denoiser_prefilter_reflections_pass_wave64_16bit, key.index);
         }
         else {
 
-            const int32_t tableIndex = g_ffx_denoiser_prefilter_reflections_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_denoiser_prefilter_reflections_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_denoiser_prefilter_reflections_pass_wave64, key.index);
         }
     }
     else {
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_denoiser_prefilter_reflections_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_denoiser_prefilter_reflections_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_denoiser_prefilter_reflections_pass_16bit, key.index);
         }
         else {
 
-            const int32_t tableIndex = g_ffx_denoiser_prefilter_reflections_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_denoiser_prefilter_reflections_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_denoiser_prefilter_reflections_pass, key.index);
         }
     }
 }
@@ -280,26 +258,22 @@ static FfxShaderBlob denoiserGetResolveTemporalReflectionsPermutationBlobByIndex
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_denoiser_resolve_temporal_reflections_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_denoiser_resolve_temporal_reflections_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_denoiser_resolve_temporal_reflections_pass_wave64_16bit, key.index);
         }
         else {
 
-            const int32_t tableIndex = g_ffx_denoiser_resolve_temporal_reflections_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_denoiser_resolve_temporal_reflections_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_denoiser_resolve_temporal_reflections_pass_wave64, key.index);
         }
     }
     else {
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_denoiser_resolve_temporal_reflections_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_denoiser_resolve_temporal_reflections_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_denoiser_resolve_temporal_reflections_pass_16bit, key.index);
         }
         else {
 
-            const int32_t tableIndex = g_ffx_denoiser_resolve_temporal_reflections_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_denoiser_resolve_temporal_reflections_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_denoiser_resolve_temporal_reflections_pass, key.index);
         }
     }
 }
@@ -69,26 +69,22 @@ static FfxShaderBlob dofGetDsDepthPassPermutationBlobByIndex(uint32_t permutatio
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_dof_downsample_depth_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_dof_downsample_depth_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_dof_downsample_depth_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_dof_downsample_depth_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_dof_downsample_depth_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_dof_downsample_depth_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_dof_downsample_depth_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_dof_downsample_depth_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_dof_downsample_depth_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_dof_downsample_depth_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_dof_downsample_depth_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_dof_downsample_depth_pass, key.index);
         }
     }
 }
@@ -102,26 +98,22 @@ static FfxShaderBlob dofGetDsColorPassPermutationBlobByIndex(uint32_t permutatio
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_dof_downsample_color_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_dof_downsample_color_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_dof_downsample_color_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_dof_downsample_color_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_dof_downsample_color_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_dof_downsample_color_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_dof_downsample_color_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_dof_downsample_color_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_dof_downsample_color_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_dof_downsample_color_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_dof_downsample_color_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_dof_downsample_color_pass, key.index);
         }
     }
 }
@@ -135,26 +127,22 @@ static FfxShaderBlob dofGetDilatePassPermutationBlobByIndex(uint32_t permutation
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_dof_dilate_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_dof_dilate_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_dof_dilate_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_dof_dilate_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_dof_dilate_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_dof_dilate_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_dof_dilate_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_dof_dilate_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_dof_dilate_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_dof_dilate_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_dof_dilate_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_dof_dilate_pass, key.index);
         }
     }
 }
@@ -168,26 +156,22 @@ static FfxShaderBlob dofGetBlurPassPermutationBlobByIndex(uint32_t permutationOp
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_dof_blur_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_dof_blur_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_dof_blur_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_dof_blur_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_dof_blur_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_dof_blur_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_dof_blur_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_dof_blur_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_dof_blur_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_dof_blur_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_dof_blur_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_dof_blur_pass, key.index);
         }
     }
 }
@@ -201,26 +185,22 @@ static FfxShaderBlob dofGetCompositePassPermutationBlobByIndex(uint32_t permutat
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_dof_composite_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_dof_composite_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_dof_composite_pass_wave64_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_dof_composite_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_dof_composite_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_dof_composite_pass_wave64, key.index);
         }
     }
     else
     {
         if (is16bit)
         {
-            const int32_t tableIndex = g_ffx_dof_composite_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_dof_composite_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_dof_composite_pass_16bit, key.index);
         }
         else
         {
-            const int32_t tableIndex = g_ffx_dof_composite_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_dof_composite_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_dof_composite_pass, key.index);
         }
     }
 }
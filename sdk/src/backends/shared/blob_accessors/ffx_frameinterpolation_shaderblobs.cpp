@@ -92,13 +92,11 @@ static FfxShaderBlob FrameInterpolationGetReconstructAndDilatePermutationBlobByI
 
     if (isWave64)
     {
-        const int32_t tableIndex = g_ffx_frameinterpolation_reconstruct_and_dilate_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_frameinterpolation_reconstruct_and_dilate_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_frameinterpolation_reconstruct_and_dilate_pass_wave64, key.index);
     }
     else
     {
-        const int32_t tableIndex = g_ffx_frameinterpolation_reconstruct_and_dilate_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_frameinterpolation_reconstruct_and_dilate_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_frameinterpolation_reconstruct_and_dilate_pass, key.index);
     }
 }
 
@@ -110,13 +108,11 @@ static FfxShaderBlob FrameInterpolationGetSetupPermutationBlobByIndex(uint32_t p
 
     if (isWave64)
     {
-        const int32_t tableIndex = g_ffx_frameinterpolation_setup_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_frameinterpolation_setup_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_frameinterpolation_setup_pass_wave64, key.index);
     }
     else
     {
-        const int32_t tableIndex = g_ffx_frameinterpolation_setup_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_frameinterpolation_setup_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_frameinterpolation_setup_pass, key.index);
     }
 }
 
@@ -128,13 +124,11 @@ static FfxShaderBlob FrameInterpolationGetGameMotionVectorFieldPermutationBlobBy
 
     if (isWave64)
     {
-        const int32_t tableIndex = g_ffx_frameinterpolation_game_motion_vector_field_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_frameinterpolation_game_motion_vector_field_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_frameinterpolation_game_motion_vector_field_pass_wave64, key.index);
     }
     else
     {
-        const int32_t tableIndex = g_ffx_frameinterpolation_game_motion_vector_field_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_frameinterpolation_game_motion_vector_field_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_frameinterpolation_game_motion_vector_field_pass, key.index);
     }
 }
 
@@ -146,13 +140,11 @@ static FfxShaderBlob FrameInterpolationGetOpticalFlowVectorFieldPermutationBlobB
 
     if (isWave64)
     {
-        const int32_t tableIndex = g_ffx_frameinterpolation_optical_flow_vector_field_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_frameinterpolation_optical_flow_vector_field_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_frameinterpolation_optical_flow_vector_field_pass_wave64, key.index);
     }
     else
     {
-        const int32_t tableIndex = g_ffx_frameinterpolation_optical_flow_vector_field_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_frameinterpolation_optical_flow_vector_field_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_frameinterpolation_optical_flow_vector_field_pass, key.index);
     }
 }
 
@@ -164,13 +156,11 @@ static FfxShaderBlob FrameInterpolationGetReconstructPrevDepthPermutationBlobByI
 
     if (isWave64)
     {
-        const int32_t tableIndex = g_ffx_frameinterpolation_reconstruct_previous_depth_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_frameinterpolation_reconstruct_previous_depth_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_frameinterpolation_reconstruct_previous_depth_pass_wave64, key.index);
     }
     else
     {
-        const int32_t tableIndex = g_ffx_frameinterpolation_reconstruct_previous_depth_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_frameinterpolation_reconstruct_previous_depth_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_frameinterpolation_reconstruct_previous_depth_pass, key.index);
     }
 }
 
@@ -182,13 +172,11 @@ static FfxShaderBlob FrameInterpolationGetDisocclusionMaskPermutationBlobByIndex
 
     if (isWave64)
     {
-        const int32_t tableIndex = g_ffx_frameinterpolation_disocclusion_mask_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_frameinterpolation_disocclusion_mask_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_frameinterpolation_disocclusion_mask_pass_wave64, key.index);
     }
     else
     {
-        const int32_t tableIndex = g_ffx_frameinterpolation_disocclusion_mask_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_frameinterpolation_disocclusion_mask_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_frameinterpolation_disocclusion_mask_pass, key.index);
     }
 }
 
@@ -200,13 +188,11 @@ static FfxShaderBlob FrameInterpolationGetComputeInpaintingPyramidPassPermutatio
 
     if (isWave64)
     {
-        const int32_t tableIndex = g_ffx_frameinterpolation_compute_inpainting_pyramid_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_frameinterpolation_compute_inpainting_pyramid_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_frameinterpolation_compute_inpainting_pyramid_pass_wave64, key.index);
     }
     else
     {
-        const int32_t tableIndex = g_ffx_frameinterpolation_compute_inpainting_pyramid_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_frameinterpolation_compute_inpainting_pyramid_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_frameinterpolation_compute_inpainting_pyramid_pass, key.index);
     }
 }
 
@@ -218,13 +204,11 @@ static FfxShaderBlob FrameInterpolationGetFiPassPermutationBlobByIndex(uint32_t
 
     if (isWave64)
     {
-        const int32_t tableIndex = g_ffx_frameinterpolation_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_frameinterpolation_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_frameinterpolation_pass_wave64, key.index);
     }
     else
     {
-        const int32_t tableIndex = g_ffx_frameinterpolation_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_frameinterpolation_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_frameinterpolation_pass, key.index);
     }
 }
 
@@ -236,13 +220,11 @@ static FfxShaderBlob FrameInterpolationGetComputeGameVectorFieldInpaintingPyrami
 
     if (isWave64)
     {
-        const int32_t tableIndex = g_ffx_frameinterpolation_compute_game_vector_field_inpainting_pyramid_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_frameinterpolation_compute_game_vector_field_inpainting_pyramid_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_frameinterpolation_compute_game_vector_field_inpainting_pyramid_pass_wave64, key.index);
     }
     else
     {
-        const int32_t tableIndex = g_ffx_frameinterpolation_compute_game_vector_field_inpainting_pyramid_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_frameinterpolation_compute_game_vector_field_inpainting_pyramid_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_frameinterpolation_compute_game_vector_field_inpainting_pyramid_pass, key.index);
     }
 }
 
@@ -254,13 +236,11 @@ static FfxShaderBlob FrameInterpolationGetInpaintingPassPermutationBlobByIndex(u
 
     if (isWave64)
     {
-        const int32_t tableIndex = g_ffx_frameinterpolation_inpainting_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_frameinterpolation_inpainting_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_frameinterpolation_inpainting_pass_wave64, key.index);
     }
     else
     {
-        const int32_t tableIndex = g_ffx_frameinterpolation_inpainting_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_frameinterpolation_inpainting_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_frameinterpolation_inpainting_pass, key.index);
     }
 }
 
@@ -272,13 +252,11 @@ static FfxShaderBlob FrameInterpolationGetDebugViewPassPermutationBlobByIndex(ui
 
     if (isWave64)
     {
-        const int32_t tableIndex = g_ffx_frameinterpolation_debug_view_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_frameinterpolation_debug_view_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_frameinterpolation_debug_view_pass_wave64, key.index);
     }
     else
     {
-        const int32_t tableIndex = g_ffx_frameinterpolation_debug_view_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_frameinterpolation_debug_view_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_frameinterpolation_debug_view_pass, key.index);
     }
 }
 
@@ -57,23 +57,19 @@ static FfxShaderBlob fsr1GetEasuPassPermutationBlobByIndex(uint32_t permutationO
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_fsr1_easu_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr1_easu_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr1_easu_pass_wave64_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_fsr1_easu_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr1_easu_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr1_easu_pass_wave64, key.index);
         }
     } else {
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_fsr1_easu_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr1_easu_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr1_easu_pass_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_fsr1_easu_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr1_easu_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr1_easu_pass, key.index);
         }
     }
 }
@@ -89,23 +85,19 @@ static FfxShaderBlob fsr1GetRcasPassPermutationBlobByIndex(uint32_t permutationO
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_fsr1_rcas_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr1_rcas_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr1_rcas_pass_wave64_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_fsr1_rcas_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr1_rcas_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr1_rcas_pass_wave64, key.index);
         }
     } else {
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_fsr1_rcas_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr1_rcas_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr1_rcas_pass_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_fsr1_rcas_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr1_rcas_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr1_rcas_pass, key.index);
         }
     }
 }
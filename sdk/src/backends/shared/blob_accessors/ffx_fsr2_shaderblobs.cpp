@@ -85,23 +85,19 @@ static FfxShaderBlob fsr2GetTcrAutogenPassPermutationBlobByIndex(uint32_t permut
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_fsr2_tcr_autogen_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr2_tcr_autogen_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr2_tcr_autogen_pass_wave64_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_fsr2_tcr_autogen_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr2_tcr_autogen_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr2_tcr_autogen_pass_wave64, key.index);
         }
     } else {
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_fsr2_tcr_autogen_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr2_tcr_autogen_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr2_tcr_autogen_pass_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_fsr2_tcr_autogen_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr2_tcr_autogen_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr2_tcr_autogen_pass, key.index);
         }
     }
 }
@@ -117,23 +113,19 @@ static FfxShaderBlob fsr2GetDepthClipPassPermutationBlobByIndex(uint32_t permuta
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_fsr2_depth_clip_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr2_depth_clip_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr2_depth_clip_pass_wave64_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_fsr2_depth_clip_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr2_depth_clip_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr2_depth_clip_pass_wave64, key.index);
         }
     } else {
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_fsr2_depth_clip_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr2_depth_clip_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr2_depth_clip_pass_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_fsr2_depth_clip_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr2_depth_clip_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr2_depth_clip_pass, key.index);
         }
     }
 }
@@ -149,23 +141,19 @@ static FfxShaderBlob fsr2GetReconstructPreviousDepthPassPermutationBlobByIndex(u
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_fsr2_reconstruct_previous_depth_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr2_reconstruct_previous_depth_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr2_reconstruct_previous_depth_pass_wave64_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_fsr2_reconstruct_previous_depth_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr2_reconstruct_previous_depth_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr2_reconstruct_previous_depth_pass_wave64, key.index);
         }
     } else {
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_fsr2_reconstruct_previous_depth_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr2_reconstruct_previous_depth_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr2_reconstruct_previous_depth_pass_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_fsr2_reconstruct_previous_depth_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr2_reconstruct_previous_depth_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr2_reconstruct_previous_depth_pass, key.index);
         }
     }
 }
@@ -181,23 +169,19 @@ static FfxShaderBlob fsr2GetLockPassPermutationBlobByIndex(uint32_t permutationO
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_fsr2_lock_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr2_lock_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr2_lock_pass_wave64_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_fsr2_lock_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr2_lock_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr2_lock_pass_wave64, key.index);
         }
     } else {
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_fsr2_lock_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr2_lock_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr2_lock_pass_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_fsr2_lock_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr2_lock_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr2_lock_pass, key.index);
         }
     }
 }
@@ -213,23 +197,19 @@ static FfxShaderBlob fsr2GetAccumulatePassPermutationBlobByIndex(uint32_t permut
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_fsr2_accumulate_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr2_accumulate_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr2_accumulate_pass_wave64_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_fsr2_accumulate_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr2_accumulate_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr2_accumulate_pass_wave64, key.index);
         }
     } else {
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_fsr2_accumulate_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr2_accumulate_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr2_accumulate_pass_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_fsr2_accumulate_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr2_accumulate_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr2_accumulate_pass, key.index);
         }
     }
 }
@@ -244,13 +224,11 @@ static FfxShaderBlob fsr2GetRCASPassPermutationBlobByIndex(uint32_t permutationO
     if (is16Bit) {
         if (isWave64) {
 
-            const int32_t tableIndex = g_ffx_fsr2_rcas_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr2_rcas_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr2_rcas_pass_wave64_16bit, key.index);
         }
         else {
 
-            const int32_t tableIndex = g_ffx_fsr2_rcas_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr2_rcas_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr2_rcas_pass_16bit, key.index);
         }
     }
     else
@@ -260,13 +238,11 @@ static FfxShaderBlob fsr2GetRCASPassPermutationBlobByIndex(uint32_t permutationO
 
     if (isWave64) {
         
-        const int32_t tableIndex = g_ffx_fsr2_rcas_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr2_rcas_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr2_rcas_pass_wave64, key.index);
 
     } else {
 
-        const int32_t tableIndex = g_ffx_fsr2_rcas_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr2_rcas_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr2_rcas_pass, key.index);
 
     }
 }
@@ -280,12 +256,10 @@ static FfxShaderBlob fsr2GetComputeLuminancePyramidPassPermutationBlobByIndex(ui
 
     if (isWave64) {
 
-        const int32_t tableIndex = g_ffx_fsr2_compute_luminance_pyramid_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr2_compute_luminance_pyramid_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr2_compute_luminance_pyramid_pass_wave64, key.index);
     } else {
 
-        const int32_t tableIndex = g_ffx_fsr2_compute_luminance_pyramid_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr2_compute_luminance_pyramid_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr2_compute_luminance_pyramid_pass, key.index);
     }
 }
 
@@ -302,26 +276,22 @@ static FfxShaderBlob fsr2GetAutogenReactivePassPermutationBlobByIndex(
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_fsr2_autogen_reactive_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr2_autogen_reactive_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr2_autogen_reactive_pass_wave64_16bit, key.index);
         }
         else {
 
-            const int32_t tableIndex = g_ffx_fsr2_autogen_reactive_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr2_autogen_reactive_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr2_autogen_reactive_pass_wave64, key.index);
         }
     }
     else {
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_fsr2_autogen_reactive_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr2_autogen_reactive_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr2_autogen_reactive_pass_16bit, key.index);
         }
         else {
 
-            const int32_t tableIndex = g_ffx_fsr2_autogen_reactive_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr2_autogen_reactive_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr2_autogen_reactive_pass, key.index);
         }
     }
 }
@@ -93,23 +93,19 @@ static FfxShaderBlob fsr3UpscalerGetPrepareReactivityPassPermutationBlobByIndex(
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_fsr3upscaler_prepare_reactivity_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr3upscaler_prepare_reactivity_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr3upscaler_prepare_reactivity_pass_wave64_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_fsr3upscaler_prepare_reactivity_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr3upscaler_prepare_reactivity_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr3upscaler_prepare_reactivity_pass_wave64, key.index);
         }
     } else {
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_fsr3upscaler_prepare_reactivity_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr3upscaler_prepare_reactivity_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr3upscaler_prepare_reactivity_pass_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_fsr3upscaler_prepare_reactivity_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr3upscaler_prepare_reactivity_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr3upscaler_prepare_reactivity_pass, key.index);
         }
     }
 }
@@ -125,23 +121,19 @@ static FfxShaderBlob fsr3UpscalerGetShadingChangePassPermutationBlobByIndex(uint
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_fsr3upscaler_shading_change_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr3upscaler_shading_change_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr3upscaler_shading_change_pass_wave64_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_fsr3upscaler_shading_change_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr3upscaler_shading_change_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr3upscaler_shading_change_pass_wave64, key.index);
         }
     } else {
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_fsr3upscaler_shading_change_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr3upscaler_shading_change_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr3upscaler_shading_change_pass_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_fsr3upscaler_shading_change_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr3upscaler_shading_change_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr3upscaler_shading_change_pass, key.index);
         }
     }
 }
@@ -154,13 +146,11 @@ static FfxShaderBlob fsr3UpscalerGetPrepareInputsPassPermutationBlobByIndex(uint
 
     if (isWave64)
     {
-        const int32_t tableIndex = g_ffx_fsr3upscaler_prepare_inputs_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr3upscaler_prepare_inputs_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr3upscaler_prepare_inputs_pass_wave64, key.index);
     }
     else
     {
-        const int32_t tableIndex = g_ffx_fsr3upscaler_prepare_inputs_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr3upscaler_prepare_inputs_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr3upscaler_prepare_inputs_pass, key.index);
     }
 }
 
@@ -174,23 +164,19 @@ static FfxShaderBlob fsr3UpscalerGetAccumulatePassPermutationBlobByIndex(uint32_
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_fsr3upscaler_accumulate_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr3upscaler_accumulate_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr3upscaler_accumulate_pass_wave64_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_fsr3upscaler_accumulate_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr3upscaler_accumulate_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr3upscaler_accumulate_pass_wave64, key.index);
         }
     } else {
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_fsr3upscaler_accumulate_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr3upscaler_accumulate_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr3upscaler_accumulate_pass_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_fsr3upscaler_accumulate_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr3upscaler_accumulate_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr3upscaler_accumulate_pass, key.index);
         }
     }
 }
@@ -205,13 +191,11 @@ static FfxShaderBlob fsr3UpscalerGetRCASPassPermutationBlobByIndex(uint32_t perm
     if (is16Bit) {
 
         if (isWave64) {
-            const int32_t tableIndex = g_ffx_fsr3upscaler_rcas_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr3upscaler_rcas_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr3upscaler_rcas_pass_wave64_16bit, key.index);
 
         } else {
 
-            const int32_t tableIndex = g_ffx_fsr3upscaler_rcas_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr3upscaler_rcas_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr3upscaler_rcas_pass_16bit, key.index);
         }
     }
     else
@@ -221,13 +205,11 @@ static FfxShaderBlob fsr3UpscalerGetRCASPassPermutationBlobByIndex(uint32_t perm
 
     if (isWave64) {
         
-        const int32_t tableIndex = g_ffx_fsr3upscaler_rcas_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr3upscaler_rcas_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr3upscaler_rcas_pass_wave64, key.index);
 
     } else {
 
-        const int32_t tableIndex = g_ffx_fsr3upscaler_rcas_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr3upscaler_rcas_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr3upscaler_rcas_pass, key.index);
 
     }
 }
@@ -240,12 +222,10 @@ static FfxShaderBlob fsr3UpscalerGetLumaPyramidPassPermutationBlobByIndex(uint32
 
     if (isWave64) {
 
-        const int32_t tableIndex = g_ffx_fsr3upscaler_luma_pyramid_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr3upscaler_luma_pyramid_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr3upscaler_luma_pyramid_pass_wave64, key.index);
     } else {
 
-        const int32_t tableIndex = g_ffx_fsr3upscaler_luma_pyramid_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr3upscaler_luma_pyramid_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr3upscaler_luma_pyramid_pass, key.index);
     }
 }
 
@@ -262,26 +242,22 @@ static FfxShaderBlob fsr3UpscalerGetAutogenReactivePassPermutationBlobByIndex(
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_fsr3upscaler_autogen_reactive_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr3upscaler_autogen_reactive_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr3upscaler_autogen_reactive_pass_wave64_16bit, key.index);
         }
         else {
 
-            const int32_t tableIndex = g_ffx_fsr3upscaler_autogen_reactive_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr3upscaler_autogen_reactive_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr3upscaler_autogen_reactive_pass_wave64, key.index);
         }
     }
     else {
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_fsr3upscaler_autogen_reactive_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr3upscaler_autogen_reactive_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr3upscaler_autogen_reactive_pass_16bit, key.index);
         }
         else {
 
-            const int32_t tableIndex = g_ffx_fsr3upscaler_autogen_reactive_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr3upscaler_autogen_reactive_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr3upscaler_autogen_reactive_pass, key.index);
         }
     }
 }
@@ -294,13 +270,11 @@ static FfxShaderBlob fsr3UpscalerGetShadingChangePyramidPassPermutationBlobByInd
 
     if (isWave64)
     {
-        const int32_t tableIndex = g_ffx_fsr3upscaler_shading_change_pyramid_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr3upscaler_shading_change_pyramid_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr3upscaler_shading_change_pyramid_pass_wave64, key.index);
     }
     else
     {
-        const int32_t tableIndex = g_ffx_fsr3upscaler_shading_change_pyramid_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr3upscaler_shading_change_pyramid_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr3upscaler_shading_change_pyramid_pass, key.index);
     }
 }
 
@@ -312,13 +286,11 @@ static FfxShaderBlob fsr3UpscalerGetLumaInstabilityPassPermutationBlobByIndex(ui
 
     if (isWave64)
     {
-        const int32_t tableIndex = g_ffx_fsr3upscaler_luma_instability_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr3upscaler_luma_instability_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr3upscaler_luma_instability_pass_wave64, key.index);
     }
     else
     {
-        const int32_t tableIndex = g_ffx_fsr3upscaler_luma_instability_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr3upscaler_luma_instability_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr3upscaler_luma_instability_pass, key.index);
     }
 }
 
@@ -330,13 +302,11 @@ static FfxShaderBlob fsr3UpscalerGetDebugViewPassPermutationBlobByIndex(uint32_t
 
     if (isWave64)
     {
-        const int32_t tableIndex = g_ffx_fsr3upscaler_debug_view_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr3upscaler_debug_view_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr3upscaler_debug_view_pass_wave64, key.index);
     }
     else
     {
-        const int32_t tableIndex = g_ffx_fsr3upscaler_debug_view_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_fsr3upscaler_debug_view_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_fsr3upscaler_debug_view_pass, key.index);
     }
 }
 
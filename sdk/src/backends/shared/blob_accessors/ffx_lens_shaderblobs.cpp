@@ -47,23 +47,19 @@ static FfxShaderBlob lensGetMainPassPermutationBlobByIndex(uint32_t, bool isWave
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_lens_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_lens_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_lens_pass_wave64_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_lens_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_lens_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_lens_pass_wave64, key.index);
         }
     } else {
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_lens_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_lens_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_lens_pass_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_lens_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_lens_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_lens_pass, key.index);
         }
     }
 }
@@ -77,13 +77,11 @@ static FfxShaderBlob opticalflowGetComputeLuminancePyramidPassPermutationBlobByI
 
     if (isWave64)
     {
-        const int32_t tableIndex = g_ffx_opticalflow_compute_luminance_pyramid_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_opticalflow_compute_luminance_pyramid_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_opticalflow_compute_luminance_pyramid_pass_wave64, key.index);
     }
     else
     {
-        const int32_t tableIndex = g_ffx_opticalflow_compute_luminance_pyramid_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_opticalflow_compute_luminance_pyramid_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_opticalflow_compute_luminance_pyramid_pass, key.index);
     }
 }
 
@@ -95,13 +93,11 @@ static FfxShaderBlob opticalflowGetComputeScdDivergencePassPermutationBlobByInde
 
     if (isWave64)
     {
-        const int32_t tableIndex = g_ffx_opticalflow_compute_scd_divergence_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_opticalflow_compute_scd_divergence_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_opticalflow_compute_scd_divergence_pass_wave64, key.index);
     }
     else
     {
-        const int32_t tableIndex = g_ffx_opticalflow_compute_scd_divergence_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_opticalflow_compute_scd_divergence_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_opticalflow_compute_scd_divergence_pass, key.index);
     }
 }
 
@@ -113,13 +109,11 @@ static FfxShaderBlob opticalflowGetGenerateScdHistogramPassPermutationBlobByInde
 
     if (isWave64)
     {
-        const int32_t tableIndex = g_ffx_opticalflow_generate_scd_histogram_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_opticalflow_generate_scd_histogram_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_opticalflow_generate_scd_histogram_pass_wave64, key.index);
     }
     else
     {
-        const int32_t tableIndex = g_ffx_opticalflow_generate_scd_histogram_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_opticalflow_generate_scd_histogram_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_opticalflow_generate_scd_histogram_pass, key.index);
     }
 }
 
@@ -131,13 +125,11 @@ static FfxShaderBlob opticalflowGetPrepareLumaPassPermutationBlobByIndex(uint32_
 
     if (isWave64)
     {
-        const int32_t tableIndex = g_ffx_opticalflow_prepare_luma_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_opticalflow_prepare_luma_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_opticalflow_prepare_luma_pass_wave64, key.index);
     }
     else
     {
-        const int32_t tableIndex = g_ffx_opticalflow_prepare_luma_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_opticalflow_prepare_luma_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_opticalflow_prepare_luma_pass, key.index);
     }
 }
 
@@ -149,13 +141,11 @@ static FfxShaderBlob opticalflowGetComputeOpticalFlowAdvancedPassV5PermutationBl
 
     if (isWave64)
     {
-        const int32_t tableIndex = g_ffx_opticalflow_compute_optical_flow_advanced_pass_v5_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_opticalflow_compute_optical_flow_advanced_pass_v5_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_opticalflow_compute_optical_flow_advanced_pass_v5_wave64, key.index);
     }
     else
     {
-        const int32_t tableIndex = g_ffx_opticalflow_compute_optical_flow_advanced_pass_v5_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_opticalflow_compute_optical_flow_advanced_pass_v5_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_opticalflow_compute_optical_flow_advanced_pass_v5, key.index);
     }
 }
  
@@ -167,13 +157,11 @@ static FfxShaderBlob opticalflowGetFilterOpticalFlowPassV5PermutationBlobByIndex
 
     if (isWave64)
     {
-        const int32_t tableIndex = g_ffx_opticalflow_filter_optical_flow_pass_v5_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_opticalflow_filter_optical_flow_pass_v5_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_opticalflow_filter_optical_flow_pass_v5_wave64, key.index);
     }
     else
     {
-        const int32_t tableIndex = g_ffx_opticalflow_filter_optical_flow_pass_v5_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_opticalflow_filter_optical_flow_pass_v5_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_opticalflow_filter_optical_flow_pass_v5, key.index);
     }
 }
 
@@ -185,13 +173,11 @@ static FfxShaderBlob opticalflowGetScaleOpticalFlowAdvancedPassV5PermutationBlob
 
     if (isWave64)
     {
-        const int32_t tableIndex = g_ffx_opticalflow_scale_optical_flow_advanced_pass_v5_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_opticalflow_scale_optical_flow_advanced_pass_v5_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_opticalflow_scale_optical_flow_advanced_pass_v5_wave64, key.index);
     }
     else
     {
-        const int32_t tableIndex = g_ffx_opticalflow_scale_optical_flow_advanced_pass_v5_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_opticalflow_scale_optical_flow_advanced_pass_v5_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_opticalflow_scale_optical_flow_advanced_pass_v5, key.index);
     }
 }
 
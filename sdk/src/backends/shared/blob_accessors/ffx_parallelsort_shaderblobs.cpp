@@ -56,13 +56,11 @@ static FfxShaderBlob parallelSortGetSetupIndirectArgsPassPermutationBlobByIndex(
 
     if (isWave64) {
 
-        const int32_t tableIndex = g_ffx_parallelsort_setup_indirect_args_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_parallelsort_setup_indirect_args_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_parallelsort_setup_indirect_args_pass_wave64, key.index);
         
     } else {
 
-        const int32_t tableIndex = g_ffx_parallelsort_setup_indirect_args_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_parallelsort_setup_indirect_args_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_parallelsort_setup_indirect_args_pass, key.index);
     }
 }
 
@@ -74,14 +72,12 @@ static FfxShaderBlob parallelSortGetSumPassPermutationBlobByIndex(uint32_t permu
 
     if (isWave64) {
 
-        const int32_t tableIndex = g_ffx_parallelsort_sum_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_parallelsort_sum_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_parallelsort_sum_pass_wave64, key.index);
 
     }
     else {
 
-        const int32_t tableIndex = g_ffx_parallelsort_sum_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_parallelsort_sum_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_parallelsort_sum_pass, key.index);
     }
 }
 
@@ -93,14 +89,12 @@ static FfxShaderBlob parallelSortGetReducePassPermutationBlobByIndex(uint32_t pe
 
     if (isWave64) {
 
-        const int32_t tableIndex = g_ffx_parallelsort_reduce_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_parallelsort_reduce_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_parallelsort_reduce_pass_wave64, key.index);
 
     }
     else {
 
-        const int32_t tableIndex = g_ffx_parallelsort_reduce_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_parallelsort_reduce_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_parallelsort_reduce_pass, key.index);
     }
 }
 
@@ -112,14 +106,12 @@ static FfxShaderBlob parallelSortGetScanPassPermutationBlobByIndex(uint32_t perm
 
     if (isWave64) {
 
-        const int32_t tableIndex = g_ffx_parallelsort_scan_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_parallelsort_scan_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_parallelsort_scan_pass_wave64, key.index);
 
     }
     else {
 
-        const int32_t tableIndex = g_ffx_parallelsort_scan_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_parallelsort_scan_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_parallelsort_scan_pass, key.index);
     }
 }
 
@@ -131,14 +123,12 @@ static FfxShaderBlob parallelSortGetScanAddPassPermutationBlobByIndex(uint32_t p
 
     if (isWave64) {
 
-        const int32_t tableIndex = g_ffx_parallelsort_scan_add_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_parallelsort_scan_add_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_parallelsort_scan_add_pass_wave64, key.index);
 
     }
     else {
 
-        const int32_t tableIndex = g_ffx_parallelsort_scan_add_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_parallelsort_scan_add_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_parallelsort_scan_add_pass, key.index);
     }
 }
 
@@ -150,14 +140,12 @@ static FfxShaderBlob parallelSortGetScatterPassPermutationBlobByIndex(uint32_t p
 
     if (isWave64) {
 
-        const int32_t tableIndex = g_ffx_parallelsort_scatter_pass_wave64_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_parallelsort_scatter_pass_wave64_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_parallelsort_scatter_pass_wave64, key.index);
 
     }
     else {
 
-        const int32_t tableIndex = g_ffx_parallelsort_scatter_pass_IndirectionTable[key.index];
-        return POPULATE_SHADER_BLOB_FFX(g_ffx_parallelsort_scatter_pass_PermutationInfo, tableIndex);
+        return FFX_POPULATE_PERMUTATION_BLOB(ffx_parallelsort_scatter_pass, key.index);
     }
 }
 
@@ -68,23 +68,19 @@ static FfxShaderBlob sssrGetClassifyTilesPassPermutationBlobByIndex(uint32_t per
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_sssr_classify_tiles_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_sssr_classify_tiles_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_sssr_classify_tiles_pass_wave64_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_sssr_classify_tiles_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_sssr_classify_tiles_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_sssr_classify_tiles_pass_wave64, key.index);
         }
     } else {
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_sssr_classify_tiles_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_sssr_classify_tiles_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_sssr_classify_tiles_pass_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_sssr_classify_tiles_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_sssr_classify_tiles_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_sssr_classify_tiles_pass, key.index);
         }
     }
 }
@@ -100,23 +96,19 @@ static FfxShaderBlob sssrGetPrepareBlueNoiseTexturePassPermutationBlobByIndex(ui
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_sssr_prepare_blue_noise_texture_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_sssr_prepare_blue_noise_texture_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_sssr_prepare_blue_noise_texture_pass_wave64_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_sssr_prepare_blue_noise_texture_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_sssr_prepare_blue_noise_texture_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_sssr_prepare_blue_noise_texture_pass_wave64, key.index);
         }
     } else {
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_sssr_prepare_blue_noise_texture_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_sssr_prepare_blue_noise_texture_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_sssr_prepare_blue_noise_texture_pass_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_sssr_prepare_blue_noise_texture_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_sssr_prepare_blue_noise_texture_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_sssr_prepare_blue_noise_texture_pass, key.index);
         }
     }
 }
@@ -132,23 +124,19 @@ static FfxShaderBlob sssrGetPrepareIndirectArgsPassPermutationBlobByIndex(uint32
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_sssr_prepare_indirect_args_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_sssr_prepare_indirect_args_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_sssr_prepare_indirect_args_pass_wave64_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_sssr_prepare_indirect_args_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_sssr_prepare_indirect_args_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_sssr_prepare_indirect_args_pass_wave64, key.index);
         }
     } else {
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_sssr_prepare_indirect_args_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_sssr_prepare_indirect_args_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_sssr_prepare_indirect_args_pass_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_sssr_prepare_indirect_args_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_sssr_prepare_indirect_args_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_sssr_prepare_indirect_args_pass, key.index);
         }
     }
 }
@@ -164,23 +152,19 @@ static FfxShaderBlob sssrGetIntersectionPassPermutationBlobByIndex(uint32_t perm
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_sssr_intersect_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_sssr_intersect_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_sssr_intersect_pass_wave64_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_sssr_intersect_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_sssr_intersect_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_sssr_intersect_pass_wave64, key.index);
         }
     } else {
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_sssr_intersect_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_sssr_intersect_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_sssr_intersect_pass_16bit, key.index);
         } else {
 
-            const int32_t tableIndex = g_ffx_sssr_intersect_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_sssr_intersect_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_sssr_intersect_pass, key.index);
         }
     }
 }
@@ -196,26 +180,22 @@ static FfxShaderBlob sssrGetDepthDownsamplePassPermutationBlobByIndex(uint32_t p
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_sssr_depth_downsample_pass_wave64_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_sssr_depth_downsample_pass_wave64_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_sssr_depth_downsample_pass_wave64_16bit, key.index);
         }
         else {
 
-            const int32_t tableIndex = g_ffx_sssr_depth_downsample_pass_wave64_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_sssr_depth_downsample_pass_wave64_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_sssr_depth_downsample_pass_wave64, key.index);
         }
     }
     else {
 
         if (is16bit) {
 
-            const int32_t tableIndex = g_ffx_sssr_depth_downsample_pass_16bit_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_sssr_depth_downsample_pass_16bit_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_sssr_depth_downsample_pass_16bit, key.index);
         }
         else {
 
-            const int32_t tableIndex = g_ffx_sssr_depth_downsample_pass_IndirectionTable[key.index];
-            return POPULATE_SHADER_BLOB_FFX(g_ffx_sssr_depth_downsample_pass_PermutationInfo, tableIndex);
+            return FFX_POPULATE_PERMUTATION_BLOB(ffx_sssr_depth_downsample_pass, key.index);
         }
     }
 }
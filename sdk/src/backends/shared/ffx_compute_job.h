@@ -0,0 +1,149 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#pragma once
+
+#include <stddef.h>
+#include <string.h>
+#include <FidelityFX/host/ffx_types.h>
+#include <FidelityFX/host/ffx_assert.h>
+
+// A compact compute job is stored in the backend's job queue as its FfxCompactComputeJobDescription header,
+// followed by copies of the resource arrays it references, packed densely into the otherwise unused tail of the
+// FfxGpuJobDescription union. The header's array pointers are redirected to those copies, so scheduling a compact
+// job only touches the slots its pipeline uses and nothing needs to be allocated beyond the existing job queue.
+static_assert(sizeof(FfxCompactComputeJobDescription) + 5 * alignof(void*) <= sizeof(FfxPipelineState),
+              "Packed compact compute job resources may not fit in a FfxGpuJobDescription");
+
+namespace ffx_compute_job_detail
+{
+    template<typename T>
+    inline const T* packArray(uint8_t*& cursor, const uint8_t* end, const T* src, uint32_t count)
+    {
+        if (count == 0)
+            return nullptr;
+
+        FFX_ASSERT(src != nullptr);
+
+        const size_t alignment = alignof(T);
+        cursor = reinterpret_cast<uint8_t*>((reinterpret_cast<uintptr_t>(cursor) + alignment - 1) & ~(uintptr_t)(alignment - 1));
+        const size_t size = sizeof(T) * count;
+        FFX_ASSERT(cursor + size <= end);
+        (void)end;
+
+        memcpy(cursor, src, size);
+        T* dst = reinterpret_cast<T*>(cursor);
+        cursor += size;
+        return dst;
+    }
+}
+
+// Copy a FFX_GPU_JOB_COMPUTE_COMPACT job into a slot of the backend's job queue.
+inline void ffxStoreCompactComputeJob(FfxGpuJobDescription* dst, const FfxGpuJobDescription* src)
+{
+    FFX_ASSERT(src->jobType == FFX_GPU_JOB_COMPUTE_COMPACT);
+
+    const FfxCompactComputeJobDescription& job      = src->compactComputeJobDescriptor;
+    const FfxPipelineState*                pipeline = job.pipeline;
+    FFX_ASSERT(pipeline != nullptr);
+    FFX_ASSERT(pipeline->srvTextureCount <= FFX_MAX_NUM_SRVS && pipeline->srvBufferCount <= FFX_MAX_NUM_SRVS);
+    FFX_ASSERT(pipeline->uavTextureCount <= FFX_MAX_NUM_UAVS && pipeline->uavBufferCount <= FFX_MAX_NUM_UAVS);
+    FFX_ASSERT(pipeline->constCount <= FFX_MAX_NUM_CONST_BUFFERS);
+
+    // Only the header is copied; the label is taken from the pipeline name at execution time
+    dst->jobType     = FFX_GPU_JOB_COMPUTE_COMPACT;
+    dst->jobLabel[0] = L'\0';
+
+    FfxCompactComputeJobDescription& stored = dst->compactComputeJobDescriptor;
+    stored.pipeline          = pipeline;
+    stored.dimensions[0]     = job.dimensions[0];
+    stored.dimensions[1]     = job.dimensions[1];
+    stored.dimensions[2]     = job.dimensions[2];
+    stored.cmdArgument       = job.cmdArgument;
+    stored.cmdArgumentOffset = job.cmdArgumentOffset;
+
+    uint8_t*       cursor = reinterpret_cast<uint8_t*>(&stored + 1);
+    const uint8_t* end    = reinterpret_cast<const uint8_t*>(dst + 1);
+    stored.srvTextures    = ffx_compute_job_detail::packArray(cursor, end, job.srvTextures, pipeline->srvTextureCount);
+    stored.srvBuffers     = ffx_compute_job_detail::packArray(cursor, end, job.srvBuffers, pipeline->srvBufferCount);
+    stored.uavTextures    = ffx_compute_job_detail::packArray(cursor, end, job.uavTextures, pipeline->uavTextureCount);
+    stored.uavBuffers     = ffx_compute_job_detail::packArray(cursor, end, job.uavBuffers, pipeline->uavBufferCount);
+    stored.cbs            = ffx_compute_job_detail::packArray(cursor, end, job.cbs, pipeline->constCount);
+}
+
+// A uniform view over the data of a scheduled FFX_GPU_JOB_COMPUTE or FFX_GPU_JOB_COMPUTE_COMPACT job, used by the
+// backends to execute both job types through the same code path. Resource arrays are indexed in pipeline binding
+// order and hold the pipeline's count of entries.
+struct FfxComputeJobView
+{
+    const FfxPipelineState*  pipeline;
+    const uint32_t*          dimensions;
+    FfxResourceInternal      cmdArgument;
+    uint32_t                 cmdArgumentOffset;
+    FfxTextureSRV*           srvTextures;
+    FfxBufferSRV*            srvBuffers;
+    FfxTextureUAV*           uavTextures;
+    FfxBufferUAV*            uavBuffers;
+    const FfxConstantBuffer* cbs;
+};
+
+// Build a view over a job in the backend's job queue. Compact jobs must have been stored with ffxStoreCompactComputeJob,
+// so that their resource arrays are owned by the queue.
+inline FfxComputeJobView ffxGetComputeJobView(FfxGpuJobDescription* job)
+{
+    FfxComputeJobView view;
+    if (job->jobType == FFX_GPU_JOB_COMPUTE_COMPACT)
+    {
+        FfxCompactComputeJobDescription& compact = job->compactComputeJobDescriptor;
+        view.pipeline          = compact.pipeline;
+        view.dimensions        = compact.dimensions;
+        view.cmdArgument       = compact.cmdArgument;
+        view.cmdArgumentOffset = compact.cmdArgumentOffset;
+        view.srvTextures       = const_cast<FfxTextureSRV*>(compact.srvTextures);
+        view.srvBuffers        = const_cast<FfxBufferSRV*>(compact.srvBuffers);
+        view.uavTextures       = const_cast<FfxTextureUAV*>(compact.uavTextures);
+        view.uavBuffers        = const_cast<FfxBufferUAV*>(compact.uavBuffers);
+        view.cbs               = compact.cbs;
+    }
+    else
+    {
+        FFX_ASSERT(job->jobType == FFX_GPU_JOB_COMPUTE);
+        FfxComputeJobDescription& full = job->computeJobDescriptor;
+        view.pipeline          = &full.pipeline;
+        view.dimensions        = full.dimensions;
+        view.cmdArgument       = full.cmdArgument;
+        view.cmdArgumentOffset = full.cmdArgumentOffset;
+        view.srvTextures       = full.srvTextures;
+        view.srvBuffers        = full.srvBuffers;
+        view.uavTextures       = full.uavTextures;
+        view.uavBuffers        = full.uavBuffers;
+        view.cbs               = full.cbs;
+    }
+    return view;
+}
+
+// Label to use for the markers of a scheduled job. Compact compute jobs don't carry a label, they use their pipeline's name.
+inline const wchar_t* ffxGetGpuJobLabel(const FfxGpuJobDescription* job)
+{
+    return job->jobType == FFX_GPU_JOB_COMPUTE_COMPACT ? job->compactComputeJobDescriptor.pipeline->name : job->jobLabel;
+}
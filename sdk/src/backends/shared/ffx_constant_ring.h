@@ -0,0 +1,258 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <atomic>
+#include <new>
+#include <stdint.h>
+#include <string.h>
+#include <FidelityFX/host/ffx_types.h>
+#include <FidelityFX/host/ffx_util.h>
+#include <FidelityFX/host/ffx_assert.h>
+
+#define FFX_CONSTANT_RING_INVALID_OFFSET (~0ull)
+
+// Suballocator for the fallback constant buffer ring shared by all effect contexts of a backend. It only hands out
+// offsets; the backend owns the mapped GPU memory.
+//
+// The ring is split into fixed-size blocks. Each effect context bump-allocates from the block it currently owns and
+// claims a new block through a shared atomic head when it runs out, so allocations never take a lock. A block is
+// tagged with the effect context and frame that last wrote to it, and is only handed out again once that context has
+// ended FFX_MAX_QUEUED_FRAMES further frames. This is the same lifetime the backends already assume for dynamic
+// resource views. When no retired block is left, allocate() fails and the backend may wait for the GPU and call
+// retireSubmittedFrames() before retrying.
+//
+// An effect context records on one thread at a time, so its bump state is not synchronized. Only block tags, frame
+// serials and statistics are shared between threads.
+class FfxConstantRing
+{
+public:
+    static constexpr uint32_t MAX_BLOCK_COUNT = 1024;
+    static constexpr uint32_t MIN_BLOCKS_PER_CONTEXT_FRAME = 4;
+
+    // Per effect context state, stored in memory supplied by the backend
+    typedef struct ContextState
+    {
+        std::atomic<uint64_t> frameSerial;       // number of frames this context has ended
+        std::atomic<uint64_t> retiredSerial;     // blocks tagged with an older frame are known to be complete
+        uint32_t              block;
+        uint64_t              blockOffset;
+    } ContextState;
+
+    static size_t getContextMemorySize(size_t contextCount)
+    {
+        return FFX_ALIGN_UP(contextCount * sizeof(ContextState), sizeof(uint64_t));
+    }
+
+    void initialize(uint64_t capacity, uint64_t alignment, uint32_t contextCount, void* contextMemory)
+    {
+        FFX_ASSERT(alignment > 0 && (alignment & (alignment - 1)) == 0);
+        FFX_ASSERT(contextCount > 0 && contextCount < 0xffff);
+        FFX_ASSERT(contextMemory != nullptr);
+
+        // blocks hold a few passes worth of constants, and get larger once the block count is capped
+        const uint64_t minBlockSize = FFX_ALIGN_UP(FFX_BUFFER_SIZE, alignment) * MIN_BLOCKS_PER_CONTEXT_FRAME;
+        m_blockCount = static_cast<uint32_t>(FFX_MINIMUM(FFX_MAXIMUM(capacity / minBlockSize, uint64_t(1)), uint64_t(MAX_BLOCK_COUNT)));
+        m_blockSize  = (capacity / m_blockCount) & ~(alignment - 1);
+        m_capacity   = capacity;
+        m_alignment  = alignment;
+
+        m_contextCount = contextCount;
+        m_contexts     = static_cast<ContextState*>(contextMemory);
+        for (uint32_t i = 0; i < contextCount; ++i)
+        {
+            new (&m_contexts[i]) ContextState();
+            m_contexts[i].block = NO_BLOCK;
+        }
+
+        for (uint32_t i = 0; i < MAX_BLOCK_COUNT; ++i)
+            m_blockTags[i].store(0, std::memory_order_relaxed);
+        m_head.store(0, std::memory_order_relaxed);
+
+        m_allocationCount.store(0, std::memory_order_relaxed);
+        m_allocatedBytes.store(0, std::memory_order_relaxed);
+        m_stallCount.store(0, std::memory_order_relaxed);
+        m_failedAllocationCount.store(0, std::memory_order_relaxed);
+    }
+
+    bool isInitialized() const
+    {
+        return m_contexts != nullptr;
+    }
+
+    // Returns the offset of size bytes in the ring, or FFX_CONSTANT_RING_INVALID_OFFSET if every block is in flight
+    uint64_t allocate(uint32_t effectContextId, uint64_t size)
+    {
+        FFX_ASSERT(effectContextId < m_contextCount);
+        size = FFX_ALIGN_UP(FFX_MAXIMUM(size, uint64_t(1)), m_alignment);
+        FFX_ASSERT_MESSAGE(size <= m_blockSize, "Constant buffer is larger than a constant ring block");
+        if (size > m_blockSize)
+        {
+            m_failedAllocationCount.fetch_add(1, std::memory_order_relaxed);
+            return FFX_CONSTANT_RING_INVALID_OFFSET;
+        }
+
+        ContextState&  context = m_contexts[effectContextId];
+        const uint64_t tag     = makeTag(effectContextId, context.frameSerial.load(std::memory_order_relaxed));
+
+        if (context.block != NO_BLOCK && context.blockOffset + size <= m_blockSize)
+        {
+            // re-tag the block for the current frame, unless it aged out and was claimed by another context meanwhile
+            uint64_t blockTag = m_blockTags[context.block].load(std::memory_order_acquire);
+            if (blockTag != tag && (tagContext(blockTag) != effectContextId ||
+                                    !m_blockTags[context.block].compare_exchange_strong(blockTag, tag, std::memory_order_acq_rel)))
+                context.block = NO_BLOCK;
+        }
+        else
+        {
+            // a block without room left keeps the tag of the last frame that wrote to it, so it retires on time
+            context.block = NO_BLOCK;
+        }
+
+        if (context.block == NO_BLOCK)
+        {
+            context.block = claimBlock(tag);
+            if (context.block == NO_BLOCK)
+            {
+                m_failedAllocationCount.fetch_add(1, std::memory_order_relaxed);
+                return FFX_CONSTANT_RING_INVALID_OFFSET;
+            }
+            context.blockOffset = 0;
+        }
+
+        const uint64_t offset = uint64_t(context.block) * m_blockSize + context.blockOffset;
+        context.blockOffset += size;
+
+        m_allocationCount.fetch_add(1, std::memory_order_relaxed);
+        m_allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+        return offset;
+    }
+
+    // Called once an effect context has recorded all work of a frame
+    void endFrame(uint32_t effectContextId)
+    {
+        if (!isInitialized())
+            return;
+
+        FFX_ASSERT(effectContextId < m_contextCount);
+        m_contexts[effectContextId].frameSerial.fetch_add(1, std::memory_order_release);
+    }
+
+    // Called when an effect context is destroyed, after the GPU is done with it, so its blocks retire immediately
+    void releaseContext(uint32_t effectContextId)
+    {
+        if (!isInitialized())
+            return;
+
+        FFX_ASSERT(effectContextId < m_contextCount);
+        ContextState& context = m_contexts[effectContextId];
+        context.frameSerial.fetch_add(FFX_MAX_QUEUED_FRAMES, std::memory_order_release);
+        context.block = NO_BLOCK;
+    }
+
+    // Called after the backend waited for the GPU to go idle: every frame an effect context has already ended is
+    // complete, only the frames currently being recorded keep their blocks.
+    void retireSubmittedFrames()
+    {
+        m_stallCount.fetch_add(1, std::memory_order_relaxed);
+        for (uint32_t i = 0; i < m_contextCount; ++i)
+        {
+            const uint64_t frameSerial = m_contexts[i].frameSerial.load(std::memory_order_acquire);
+            uint64_t       retired     = m_contexts[i].retiredSerial.load(std::memory_order_relaxed);
+            while (retired < frameSerial && !m_contexts[i].retiredSerial.compare_exchange_weak(retired, frameSerial, std::memory_order_release))
+                ;
+        }
+    }
+
+    void getStatistics(FfxConstantRingStatistics* statistics) const
+    {
+        FFX_ASSERT(statistics != nullptr);
+        memset(statistics, 0, sizeof(FfxConstantRingStatistics));
+        if (!isInitialized())
+            return;
+
+        statistics->capacityInBytes  = m_capacity;
+        statistics->blockSizeInBytes = m_blockSize;
+        statistics->blockCount       = m_blockCount;
+        for (uint32_t i = 0; i < m_blockCount; ++i)
+            statistics->blocksInFlight += isRetired(m_blockTags[i].load(std::memory_order_acquire)) ? 0 : 1;
+
+        statistics->allocationCount       = m_allocationCount.load(std::memory_order_relaxed);
+        statistics->allocatedBytes        = m_allocatedBytes.load(std::memory_order_relaxed);
+        statistics->stallCount            = m_stallCount.load(std::memory_order_relaxed);
+        statistics->failedAllocationCount = m_failedAllocationCount.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr uint32_t NO_BLOCK = ~0u;
+
+    // A tag packs the writing context (biased by one so 0 means never written) and its frame serial
+    static uint64_t makeTag(uint32_t effectContextId, uint64_t frameSerial)
+    {
+        return (frameSerial << 16) | (effectContextId + 1);
+    }
+
+    static uint32_t tagContext(uint64_t tag)
+    {
+        return static_cast<uint32_t>(tag & 0xffff) - 1;
+    }
+
+    bool isRetired(uint64_t tag) const
+    {
+        if (tag == 0)
+            return true;
+
+        const ContextState& context     = m_contexts[tagContext(tag)];
+        const uint64_t      frameSerial = tag >> 16;
+        return frameSerial + FFX_MAX_QUEUED_FRAMES <= context.frameSerial.load(std::memory_order_acquire) ||
+               frameSerial < context.retiredSerial.load(std::memory_order_acquire);
+    }
+
+    // Walks the ring from the shared head and claims the first retired block, giving up after one full turn
+    uint32_t claimBlock(uint64_t tag)
+    {
+        for (uint32_t attempt = 0; attempt < m_blockCount; ++attempt)
+        {
+            const uint32_t block    = static_cast<uint32_t>(m_head.fetch_add(1, std::memory_order_relaxed) % m_blockCount);
+            uint64_t       blockTag = m_blockTags[block].load(std::memory_order_acquire);
+            if (isRetired(blockTag) && m_blockTags[block].compare_exchange_strong(blockTag, tag, std::memory_order_acq_rel))
+                return block;
+        }
+        return NO_BLOCK;
+    }
+
+    uint64_t              m_capacity     = 0;
+    uint64_t              m_alignment    = 0;
+    uint64_t              m_blockSize    = 0;
+    uint32_t              m_blockCount   = 0;
+    uint32_t              m_contextCount = 0;
+    ContextState*         m_contexts     = nullptr;
+
+    std::atomic<uint64_t> m_head;
+    std::atomic<uint64_t> m_blockTags[MAX_BLOCK_COUNT];
+
+    std::atomic<uint64_t> m_allocationCount;
+    std::atomic<uint64_t> m_allocatedBytes;
+    std::atomic<uint64_t> m_stallCount;
+    std::atomic<uint64_t> m_failedAllocationCount;
+};
@@ -0,0 +1,452 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <FidelityFX/host/ffx_types.h>
+
+// Frame pacing logic shared by the frame interpolation swapchains. It has no dependency on a platform or graphics
+// API: time is read and waited on through an FfxFramePacingTimer, which the swapchains back with QPC and Sleep and
+// which can be replaced by a simulated clock to run the pacing logic on its own (see
+// tests/frame_pacing/ffx_frame_pacing_simulator.h).
+
+#define FFX_FRAME_PACING_UNKNOWN_TIMER_RESOLUTION 0  // sleep precision can't be guaranteed, so only spin
+
+// Hint to the core that the thread is spinning, this saves power and frees execution resources for a sibling hyperthread.
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define FFX_FRAME_PACING_CPU_PAUSE() _mm_pause()
+#elif defined(_M_ARM64) || defined(_M_ARM)
+#include <intrin.h>
+#define FFX_FRAME_PACING_CPU_PAUSE() __yield()
+#elif defined(__aarch64__) || defined(__arm__)
+#define FFX_FRAME_PACING_CPU_PAUSE() __asm__ __volatile__("yield")
+#else
+#define FFX_FRAME_PACING_CPU_PAUSE()
+#endif
+
+typedef struct FfxFramePacingTimer
+{
+    int64_t frequency;                                                          // ticks per second
+    int64_t (*getCount)(void* userData);                                        // current time in ticks
+    bool    (*sleep)(void* userData, uint32_t milliseconds, uint32_t timerResolution);  // returns false if the sleep can't be made precise
+    void*   userData;
+} FfxFramePacingTimer;
+
+template <const int Size, typename Type = double>
+struct SimpleMovingAverage
+{
+    Type                    history[Size] = {};
+    unsigned int            idx           = 0;
+    unsigned int            updateCount   = 0;
+
+    Type getAverage()
+    {
+        if (updateCount < Size)
+            return 0.0;
+
+        Type          average    = 0.f;
+        unsigned int  iterations = (updateCount >= Size) ? Size : updateCount;
+
+        if (iterations > 0)
+        {
+            for (size_t i = 0; i < iterations; i++)
+            {
+                average += history[i];
+            }
+            average /= iterations;
+        }
+
+        return average;
+    }
+
+    Type getVariance()
+    {
+        if (updateCount < Size)
+            return 0.0;
+
+        Type average  = getAverage();
+        Type variance = 0.f;
+        unsigned int iterations = (updateCount >= Size) ? Size : updateCount;
+
+        if (iterations > 0)
+        {
+            for (size_t i = 0; i < iterations; i++)
+            {
+                variance += (history[i] - average) * (history[i] - average);
+            }
+            variance /= iterations;
+        }
+
+        return sqrt(variance);
+    }
+
+    void reset()
+    {
+        updateCount = 0;
+        idx         = 0;
+    }
+
+    void update(Type newValue)
+    {
+        history[idx] = newValue;
+        idx          = (idx + 1) % Size;
+        updateCount++;
+    }
+};
+
+// Exponentially weighted mean and variance, which follows load changes faster than a moving average.
+struct ExponentialMovingAverage
+{
+    static constexpr double alpha       = 2.0 / 11.0;  // same center of mass as a 10 sample window
+    static constexpr int    warmupCount = 10;
+
+    double       mean        = 0.0;
+    double       variance    = 0.0;
+    unsigned int updateCount = 0;
+
+    double getAverage()
+    {
+        return updateCount < warmupCount ? 0.0 : mean;
+    }
+
+    double getVariance()
+    {
+        return updateCount < warmupCount ? 0.0 : sqrt(variance);
+    }
+
+    void reset()
+    {
+        updateCount = 0;
+    }
+
+    void update(double newValue)
+    {
+        if (updateCount == 0)
+        {
+            mean     = newValue;
+            variance = 0.0;
+        }
+        else
+        {
+            const double delta = newValue - mean;
+            mean += alpha * delta;
+            variance = (1.0 - alpha) * (variance + alpha * delta * delta);
+        }
+        updateCount++;
+    }
+};
+
+// Median and scaled median absolute deviation of a window, which ignore isolated spikes.
+template <const int Size>
+struct MovingMedian
+{
+    SimpleMovingAverage<Size, double> window{};
+
+    double getAverage()
+    {
+        if (window.updateCount < Size)
+            return 0.0;
+
+        double sorted[Size];
+        memcpy(sorted, window.history, sizeof(sorted));
+        return median(sorted);
+    }
+
+    double getVariance()
+    {
+        if (window.updateCount < Size)
+            return 0.0;
+
+        const double center = getAverage();
+        double       deviations[Size];
+        for (int i = 0; i < Size; i++)
+        {
+            deviations[i] = fabs(window.history[i] - center);
+        }
+
+        // scale so the deviation matches the standard deviation for normally distributed frame times
+        return 1.4826 * median(deviations);
+    }
+
+    void reset()
+    {
+        window.reset();
+    }
+
+    void update(double newValue)
+    {
+        window.update(newValue);
+    }
+
+private:
+    static double median(double (&values)[Size])
+    {
+        std::sort(values, values + Size);
+        return (Size & 1) ? values[Size / 2] : 0.5 * (values[Size / 2 - 1] + values[Size / 2]);
+    }
+};
+
+// Percentile of the frame times in a window, tracked with a histogram of the samples in a ring buffer.
+template <const int Size>
+struct MovingPercentile
+{
+    static constexpr double   bucketSizeInSec = 0.00005;  // 50us
+    static constexpr uint32_t bucketCount     = 2048;     // covers the 0.1s after which pacing is reset
+
+    uint16_t     histogram[bucketCount] = {};
+    uint16_t     ring[Size]             = {};
+    unsigned int idx                    = 0;
+    unsigned int updateCount            = 0;
+    double       ticksPerBucket         = 0.0;
+
+    // Returns the frame time below which the given fraction of the window lies.
+    double getPercentile(double fraction)
+    {
+        if (updateCount < Size)
+            return 0.0;
+
+        const uint32_t target     = uint32_t(fraction * (Size - 1));
+        uint32_t       cumulative = 0;
+        for (uint32_t bucket = 0; bucket < bucketCount; bucket++)
+        {
+            cumulative += histogram[bucket];
+            if (cumulative > target)
+                return (bucket + 0.5) * ticksPerBucket;
+        }
+        return bucketCount * ticksPerBucket;
+    }
+
+    void reset()
+    {
+        memset(histogram, 0, sizeof(histogram));
+        updateCount = 0;
+        idx         = 0;
+    }
+
+    void update(double newValue, int64_t frequency)
+    {
+        ticksPerBucket = double(frequency) * bucketSizeInSec;
+        if (updateCount >= Size)
+        {
+            histogram[ring[idx]]--;
+        }
+
+        const double   bucket = newValue / ticksPerBucket;
+        const uint16_t index  = uint16_t(bucket < double(bucketCount - 1) ? bucket : double(bucketCount - 1));
+        ring[idx]             = index;
+        histogram[index]++;
+        idx = (idx + 1) % Size;
+        updateCount++;
+    }
+};
+
+// Predicts the delay between presenting an interpolated frame and the real frame following it from the intervals
+// at which interpolated frames become ready.
+class FfxFramePacer
+{
+public:
+    // Called when an interpolated frame is ready, returns the delay in ticks to present the real frame after it.
+    int64_t update(int64_t currentCount, int64_t frequency, bool resetTimer, double safetyMarginInSec, double varianceFactor,
+                   FfxSwapchainFrameTimePredictor predictor = FFX_SWAPCHAIN_FRAMETIME_PREDICTOR_MOVING_AVERAGE)
+    {
+        const double deltaCount = double(currentCount - previousCount) * (previousCount > 0);
+        previousCount           = currentCount;
+
+        // restart the predictors when switching between them so they don't run on stale history
+        if (predictor != currentPredictor)
+        {
+            resetTimer       = true;
+            currentPredictor = predictor;
+        }
+
+        // reset pacing averaging if delta > 10 fps,
+        const float fTimeoutInSeconds         = 0.1f;
+        double      deltaCountResetThreashold = double(frequency * fTimeoutInSeconds);
+        if ((deltaCount > deltaCountResetThreashold) || resetTimer)
+        {
+            frameTime.reset();
+            exponentialFrameTime.reset();
+            medianFrameTime.reset();
+            percentileFrameTime.reset();
+        }
+        else
+        {
+            switch (currentPredictor)
+            {
+            case FFX_SWAPCHAIN_FRAMETIME_PREDICTOR_EXPONENTIAL_AVERAGE:
+                exponentialFrameTime.update(deltaCount);
+                break;
+            case FFX_SWAPCHAIN_FRAMETIME_PREDICTOR_MEDIAN:
+                medianFrameTime.update(deltaCount);
+                break;
+            case FFX_SWAPCHAIN_FRAMETIME_PREDICTOR_PERCENTILE:
+                percentileFrameTime.update(deltaCount, frequency);
+                break;
+            default:
+                frameTime.update(deltaCount);
+                break;
+            }
+        }
+
+        // set presentation time: reduce based on variance and subract safety margin so we don't lock on a framerate lower than necessary
+        double conservativeFrameTime = 0.0;
+        switch (currentPredictor)
+        {
+        case FFX_SWAPCHAIN_FRAMETIME_PREDICTOR_EXPONENTIAL_AVERAGE:
+            conservativeFrameTime = exponentialFrameTime.getAverage() * 0.5 - exponentialFrameTime.getVariance() * varianceFactor;
+            break;
+        case FFX_SWAPCHAIN_FRAMETIME_PREDICTOR_MEDIAN:
+            conservativeFrameTime = medianFrameTime.getAverage() * 0.5 - medianFrameTime.getVariance() * varianceFactor;
+            break;
+        case FFX_SWAPCHAIN_FRAMETIME_PREDICTOR_PERCENTILE:
+            // the percentile a normal distribution has 2 * varianceFactor deviations below its mean, matching the other predictors
+            conservativeFrameTime = percentileFrameTime.getPercentile(0.5 * erfc(2.0 * varianceFactor / sqrt(2.0))) * 0.5;
+            break;
+        default:
+            conservativeFrameTime = frameTime.getAverage() * 0.5 - frameTime.getVariance() * varianceFactor;
+            break;
+        }
+
+        int64_t       safetyMargin    = int64_t(frequency * safetyMarginInSec);
+        const int64_t conservativeAvg = int64_t(conservativeFrameTime);
+        return conservativeAvg > safetyMargin ? (conservativeAvg - safetyMargin) : 0;
+    }
+
+private:
+    SimpleMovingAverage<10, double> frameTime{};
+    ExponentialMovingAverage        exponentialFrameTime{};
+    MovingMedian<9>                 medianFrameTime{};
+    MovingPercentile<32>            percentileFrameTime{};
+    FfxSwapchainFrameTimePredictor  currentPredictor = FFX_SWAPCHAIN_FRAMETIME_PREDICTOR_MOVING_AVERAGE;
+    int64_t                         previousCount    = 0;
+};
+
+// Result of a wait, in timer ticks.
+typedef struct FfxFramePacingWaitStats
+{
+    int64_t lateCount;   // how far past the target the wait returned, the achieved error
+    int64_t spinCount;   // time spent spinning, which keeps a core busy
+    int64_t sleepCount;  // time spent sleeping, which leaves the core to other threads
+} FfxFramePacingWaitStats;
+
+// Waits for a timer count with little CPU use. The thread sleeps while the remaining time exceeds the expected sleep
+// overshoot, then spins with a pause instruction for the rest. The overshoot is measured on every sleep, so it adapts to
+// the scheduler of the machine instead of relying on a fixed margin.
+class FfxPreciseWait
+{
+public:
+    // Waits until the timer reaches targetCount. Sleeping needs a known timerResolution and a sleep callback, otherwise
+    // the whole wait spins. initialSpinTime, in timer resolution units, is the overshoot assumed before any sleep was measured.
+    FfxFramePacingWaitStats waitForCount(const FfxFramePacingTimer& timer, const int64_t targetCount, const uint32_t timerResolution, const uint32_t initialSpinTime)
+    {
+        FfxFramePacingWaitStats stats = {};
+
+        int64_t currentCount = timer.getCount(timer.userData);
+        if (currentCount >= targetCount)
+        {
+            stats.lateCount = currentCount - targetCount;
+            return stats;
+        }
+
+        const bool canSleep = timer.sleep && timerResolution != FFX_FRAME_PACING_UNKNOWN_TIMER_RESOLUTION;
+        if (canSleep && !calibrated)
+        {
+            overshootMean      = double(initialSpinTime) * timerResolution * timer.frequency / 1000.0;
+            overshootDeviation = 0.0;
+            calibrated         = true;
+        }
+
+        // each slice sleeps what is left minus the overshoot budget, so slices shrink as the target comes closer
+        const int64_t ticksPerMillisecond = timer.frequency / 1000;
+        const int64_t minimumSleepTicks   = ticksPerMillisecond * timerResolution;
+        bool          slept               = false;
+        while (canSleep)
+        {
+            const int64_t remainingTicks = targetCount - currentCount;
+            const int64_t sleepTicks     = remainingTicks - getSleepOvershootBudget();
+            if (sleepTicks < minimumSleepTicks)
+            {
+                // the estimate is only refined by sleeping, so its deviation relaxes while it keeps waits from sleeping
+                // that the mean overshoot alone would allow, or one long overshoot would stop all sleeps for good
+                if (!slept && remainingTicks - int64_t(overshootMean) >= minimumSleepTicks)
+                    overshootDeviation *= 0.875;
+                break;
+            }
+
+            const uint32_t milliseconds = uint32_t(sleepTicks / ticksPerMillisecond);
+            const int64_t  sleepStart   = currentCount;
+            if (!timer.sleep(timer.userData, milliseconds, timerResolution))
+                break;  // can't guarantee sleep precision
+
+            currentCount = timer.getCount(timer.userData);
+            stats.sleepCount += currentCount - sleepStart;
+            calibrate(double(currentCount - sleepStart - milliseconds * ticksPerMillisecond));
+            slept = true;
+        }
+
+        const int64_t spinStart = timer.getCount(timer.userData);
+        currentCount            = spinStart;
+        while (currentCount < targetCount)
+        {
+            FFX_FRAME_PACING_CPU_PAUSE();
+            currentCount = timer.getCount(timer.userData);
+        }
+
+        stats.spinCount = currentCount - spinStart;
+        stats.lateCount = currentCount - targetCount;
+        return stats;
+    }
+
+    // Ticks before the target at which sleeping stops and spinning starts.
+    int64_t getSleepOvershootBudget() const
+    {
+        return int64_t(overshootMean + 4.0 * overshootDeviation);
+    }
+
+private:
+    // smoothed mean and mean deviation of the overshoot, weighted like a retransmission timeout estimator, which also
+    // replaces its seed with the first measurement
+    void calibrate(double overshoot)
+    {
+        overshoot = overshoot > 0.0 ? overshoot : 0.0;
+        if (!measured)
+        {
+            overshootMean      = overshoot;
+            overshootDeviation = 0.5 * overshoot;
+            measured           = true;
+            return;
+        }
+
+        overshootDeviation += 0.25 * (fabs(overshoot - overshootMean) - overshootDeviation);
+        overshootMean += 0.125 * (overshoot - overshootMean);
+    }
+
+    double overshootMean      = 0.0;
+    double overshootDeviation = 0.0;
+    bool   calibrated         = false;  // seeded from initialSpinTime
+    bool   measured           = false;  // refined by a sleep
+};
@@ -0,0 +1,112 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#pragma once
+
+#include <string.h>
+#include <FidelityFX/host/ffx_types.h>
+#include <FidelityFX/host/ffx_assert.h>
+
+// The native objects of the pipelines created on a backend, so effect contexts sharing the backend (such as the
+// ffx-api contexts chaining ffxCreateContextDescSharedBackend) compile each pipeline once instead of once per context.
+// Every context still gets its own FfxPipelineState, reflected from the shader blob as before; only the root
+// signature, command signature and pipeline object are shared.
+//
+// A pipeline's native objects depend on the shader permutation, the static samplers and whether it is dispatched
+// indirectly, so those make up the key. The cache holds one reference on each object, which the backend drops when
+// its last effect context is destroyed. The DX12 and null backends use it. The Vulkan backend allocates descriptor
+// sets per pipeline layout and hands them out per dispatch, so its pipelines are not shared.
+//
+// Like the rest of a backend context, the cache is not synchronized: pipelines are created from one thread at a time.
+typedef struct FfxSharedPipeline
+{
+    FfxEffect             effect;
+    FfxPass               pass;
+    uint32_t              permutationOptions;
+    uint32_t              indirectWorkload;
+    uint32_t              samplerCount;
+    FfxSamplerDescription samplers[FFX_MAX_SAMPLERS];
+
+    FfxRootSignature      rootSignature;
+    FfxCommandSignature   cmdSignature;
+    FfxPipeline           pipeline;
+} FfxSharedPipeline;
+
+typedef struct FfxSharedPipelineCache
+{
+    static constexpr uint32_t CAPACITY = 128;
+
+    FfxSharedPipeline entries[CAPACITY];
+    uint32_t          entryCount;
+
+    // Fills key with the parts of a pipeline its native objects depend on. Returns false when the pipeline can't be
+    // shared.
+    static bool makeKey(FfxEffect effect, FfxPass pass, uint32_t permutationOptions, const FfxPipelineDescription* description, FfxSharedPipeline& key)
+    {
+        if (description->samplerCount > FFX_MAX_SAMPLERS)
+            return false;
+
+        memset(&key, 0, sizeof(key));
+        key.effect             = effect;
+        key.pass               = pass;
+        key.permutationOptions = permutationOptions;
+        key.indirectWorkload   = description->indirectWorkload ? 1 : 0;
+        key.samplerCount       = uint32_t(description->samplerCount);
+        if (key.samplerCount)
+            memcpy(key.samplers, description->samplers, key.samplerCount * sizeof(FfxSamplerDescription));
+        return true;
+    }
+
+    // Returns the cached pipeline matching key, or nullptr. The caller takes its own reference on the objects.
+    const FfxSharedPipeline* find(const FfxSharedPipeline& key) const
+    {
+        for (uint32_t entryIndex = 0; entryIndex < entryCount; ++entryIndex)
+        {
+            const FfxSharedPipeline& entry = entries[entryIndex];
+            if (entry.effect == key.effect && entry.pass == key.pass && entry.permutationOptions == key.permutationOptions &&
+                entry.indirectWorkload == key.indirectWorkload && entry.samplerCount == key.samplerCount &&
+                0 == memcmp(entry.samplers, key.samplers, entry.samplerCount * sizeof(FfxSamplerDescription)))
+                return &entry;
+        }
+        return nullptr;
+    }
+
+    // Adds the native objects of a new pipeline under key. The cache takes over a reference on them unless it is
+    // full, in which case nullptr is returned and the pipeline is simply not shared.
+    FfxSharedPipeline* insert(const FfxSharedPipeline& key)
+    {
+        if (entryCount == CAPACITY)
+            return nullptr;
+
+        FfxSharedPipeline& entry = entries[entryCount++];
+        entry = key;
+        return &entry;
+    }
+
+    // Empties the cache, calling release on each entry so the backend can drop the cache's references
+    template<typename Release>
+    void clear(Release release)
+    {
+        for (uint32_t entryIndex = 0; entryIndex < entryCount; ++entryIndex)
+            release(entries[entryIndex]);
+        entryCount = 0;
+    }
+} FfxSharedPipelineCache;
@@ -0,0 +1,478 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include "ffx_shader_blob_archive.h"
+#include "ffx_shader_blob_archive_format.h"
+#include "ffx_shader_blob_lz.h"
+
+#include <FidelityFX/host/ffx_assert.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif // #ifdef _WIN32
+
+namespace
+{
+    struct MountedPermutation
+    {
+        FfxShaderBlob  blob;                    // data is null for compressed blobs
+        const uint8_t* storedData;
+        uint32_t       storedSize;
+    };
+
+    struct MountedSection
+    {
+        const uint32_t*                 indirectionTable = nullptr;
+        uint32_t                        keyCount         = 0;
+        std::vector<MountedPermutation> permutations;
+    };
+
+    struct MountedArchive
+    {
+        ~MountedArchive()
+        {
+#ifdef _WIN32
+            if (mappedView)
+                UnmapViewOfFile(mappedView);
+            if (mapping)
+                CloseHandle(mapping);
+            if (file != INVALID_HANDLE_VALUE)
+                CloseHandle(file);
+#endif // #ifdef _WIN32
+        }
+
+        std::unique_ptr<uint8_t[]>         ownedData;
+        std::vector<const char*>           namePool;
+#ifdef _WIN32
+        HANDLE                             file       = INVALID_HANDLE_VALUE;
+        HANDLE                             mapping    = nullptr;
+        void*                              mappedView = nullptr;
+#endif // #ifdef _WIN32
+    };
+
+    // Decompressed blobs, keyed by their stored (compressed) data. Entries are pinned while handed out
+    // and sit in an LRU list, most recently used first.
+    struct CachedBlob
+    {
+        std::unique_ptr<uint8_t[]>           data;
+        uint32_t                             size     = 0;
+        uint32_t                             pinCount = 0;
+        std::list<const uint8_t*>::iterator  lruPosition;
+    };
+
+    struct ArchiveRegistry
+    {
+        std::mutex                                      mutex;
+        std::vector<std::unique_ptr<MountedArchive>>    archives;
+        std::unordered_map<std::string, MountedSection> sections;
+
+        std::unordered_map<const uint8_t*, CachedBlob>     cache;
+        std::unordered_map<const uint8_t*, const uint8_t*> cacheDataToStoredData;
+        std::list<const uint8_t*>                          cacheLru;
+        FfxShaderBlobArchiveCacheStats                     cacheStats = { 0, 0, 0, 0, 0, FFX_SHADER_BLOB_ARCHIVE_DEFAULT_CACHE_BUDGET };
+    };
+
+    ArchiveRegistry& GetRegistry()
+    {
+        static ArchiveRegistry registry;
+        return registry;
+    }
+
+    // Must be called with the registry mutex held.
+    void TrimCache(ArchiveRegistry& registry)
+    {
+        auto it = registry.cacheLru.end();
+        while (registry.cacheStats.residentBytes > registry.cacheStats.budgetBytes && it != registry.cacheLru.begin())
+        {
+            --it;
+
+            auto cached = registry.cache.find(*it);
+            if (cached->second.pinCount > 0)
+                continue;
+
+            registry.cacheStats.residentBytes -= cached->second.size;
+            registry.cacheStats.evictions++;
+            registry.cacheDataToStoredData.erase(cached->second.data.get());
+            registry.cache.erase(cached);
+            it = registry.cacheLru.erase(it);
+        }
+    }
+
+    // Must be called with the registry mutex held.
+    void ClearCache(ArchiveRegistry& registry)
+    {
+        registry.cache.clear();
+        registry.cacheDataToStoredData.clear();
+        registry.cacheLru.clear();
+        registry.cacheStats.residentBytes = 0;
+    }
+
+    bool IsRangeValid(size_t size, uint32_t offset, uint64_t length, uint32_t alignment)
+    {
+        return (offset % alignment) == 0 && uint64_t(offset) + length <= size;
+    }
+
+    bool IsStringValid(const uint8_t* data, const FfxShaderBlobArchiveHeader& header, uint32_t offset)
+    {
+        if (offset < header.stringTableOffset || offset >= header.stringTableOffset + header.stringTableSize)
+            return false;
+        return memchr(data + offset, '\0', header.stringTableOffset + header.stringTableSize - offset) != nullptr;
+    }
+
+    bool ValidateResourceTable(const uint8_t* data, const FfxShaderBlobArchiveHeader& header, const FfxShaderBlobArchiveResourceTable& table)
+    {
+        if (table.count == 0)
+            return true;
+
+        const uint64_t length = uint64_t(table.count) * sizeof(uint32_t);
+        if (!IsRangeValid(header.totalSize, table.namesOffset, length, 4) || !IsRangeValid(header.totalSize, table.bindingsOffset, length, 4) ||
+            !IsRangeValid(header.totalSize, table.countsOffset, length, 4) || !IsRangeValid(header.totalSize, table.spacesOffset, length, 4))
+            return false;
+
+        const uint32_t* names = reinterpret_cast<const uint32_t*>(data + table.namesOffset);
+        for (uint32_t i = 0; i < table.count; ++i)
+        {
+            if (!IsStringValid(data, header, names[i]))
+                return false;
+        }
+        return true;
+    }
+
+    FfxErrorCode MountArchive(const uint8_t* data, size_t size, std::unique_ptr<MountedArchive> archive)
+    {
+        FFX_RETURN_ON_ERROR(data, FFX_ERROR_INVALID_POINTER);
+        FFX_RETURN_ON_ERROR(size >= sizeof(FfxShaderBlobArchiveHeader), FFX_ERROR_INVALID_SIZE);
+        FFX_RETURN_ON_ERROR((reinterpret_cast<uintptr_t>(data) % 4) == 0, FFX_ERROR_INVALID_ALIGNMENT);
+
+        const FfxShaderBlobArchiveHeader& header = *reinterpret_cast<const FfxShaderBlobArchiveHeader*>(data);
+        FFX_RETURN_ON_ERROR(header.magic == FFX_SHADER_BLOB_ARCHIVE_MAGIC, FFX_ERROR_MALFORMED_DATA);
+        FFX_RETURN_ON_ERROR(header.version == FFX_SHADER_BLOB_ARCHIVE_VERSION, FFX_ERROR_INVALID_VERSION);
+        FFX_RETURN_ON_ERROR(header.totalSize <= size, FFX_ERROR_INVALID_SIZE);
+
+        // ------------------------------------------------------------------------------------------------
+        // Validate all tables up front so that lookups never need to.
+        // ------------------------------------------------------------------------------------------------
+        FFX_RETURN_ON_ERROR(IsRangeValid(header.totalSize, header.sectionsOffset, uint64_t(header.sectionCount) * sizeof(FfxShaderBlobArchiveSection), 4) &&
+                            IsRangeValid(header.totalSize, header.permutationsOffset, uint64_t(header.permutationCount) * sizeof(FfxShaderBlobArchivePermutation), 4) &&
+                            IsRangeValid(header.totalSize, header.blobsOffset, uint64_t(header.blobCount) * sizeof(FfxShaderBlobArchiveBlob), 4) &&
+                            IsRangeValid(header.totalSize, header.stringTableOffset, header.stringTableSize, 1),
+                            FFX_ERROR_MALFORMED_DATA);
+
+        const FfxShaderBlobArchiveSection*     sections     = reinterpret_cast<const FfxShaderBlobArchiveSection*>(data + header.sectionsOffset);
+        const FfxShaderBlobArchivePermutation* permutations = reinterpret_cast<const FfxShaderBlobArchivePermutation*>(data + header.permutationsOffset);
+        const FfxShaderBlobArchiveBlob*        blobs        = reinterpret_cast<const FfxShaderBlobArchiveBlob*>(data + header.blobsOffset);
+
+        for (uint32_t i = 0; i < header.blobCount; ++i)
+            FFX_RETURN_ON_ERROR(IsRangeValid(header.totalSize, blobs[i].offset, blobs[i].storedSize, FFX_SHADER_BLOB_ARCHIVE_BLOB_ALIGNMENT) &&
+                                blobs[i].storedSize <= blobs[i].size && blobs[i].size > 0,
+                                FFX_ERROR_MALFORMED_DATA);
+
+        size_t namePoolSize = 0;
+        for (uint32_t i = 0; i < header.permutationCount; ++i)
+        {
+            FFX_RETURN_ON_ERROR(permutations[i].blobIndex < header.blobCount, FFX_ERROR_MALFORMED_DATA);
+            for (uint32_t type = 0; type < FFX_SHADER_BLOB_ARCHIVE_RESOURCE_TYPE_COUNT; ++type)
+            {
+                FFX_RETURN_ON_ERROR(ValidateResourceTable(data, header, permutations[i].resources[type]), FFX_ERROR_MALFORMED_DATA);
+                namePoolSize += permutations[i].resources[type].count;
+            }
+        }
+
+        for (uint32_t i = 0; i < header.sectionCount; ++i)
+        {
+            const FfxShaderBlobArchiveSection& section = sections[i];
+            FFX_RETURN_ON_ERROR(IsStringValid(data, header, section.nameOffset) &&
+                                IsRangeValid(header.totalSize, section.indirectionTableOffset, uint64_t(section.keyCount) * sizeof(uint32_t), 4) &&
+                                uint64_t(section.firstPermutation) + section.permutationCount <= header.permutationCount,
+                                FFX_ERROR_MALFORMED_DATA);
+
+            const uint32_t* indirectionTable = reinterpret_cast<const uint32_t*>(data + section.indirectionTableOffset);
+            for (uint32_t key = 0; key < section.keyCount; ++key)
+                FFX_RETURN_ON_ERROR(indirectionTable[key] < section.permutationCount, FFX_ERROR_MALFORMED_DATA);
+        }
+
+        // ------------------------------------------------------------------------------------------------
+        // Build the FfxShaderBlob descriptions. Names are the only thing that need fixing up, everything
+        // else points straight into the archive memory. Compressed blobs get their data on lookup.
+        // ------------------------------------------------------------------------------------------------
+        archive->namePool.reserve(namePoolSize);
+
+        std::unordered_map<std::string, MountedSection> mountedSections;
+        for (uint32_t i = 0; i < header.sectionCount; ++i)
+        {
+            const FfxShaderBlobArchiveSection& section = sections[i];
+
+            MountedSection mounted;
+            mounted.indirectionTable = reinterpret_cast<const uint32_t*>(data + section.indirectionTableOffset);
+            mounted.keyCount         = section.keyCount;
+            mounted.permutations.reserve(section.permutationCount);
+
+            for (uint32_t p = 0; p < section.permutationCount; ++p)
+            {
+                const FfxShaderBlobArchivePermutation& permutation = permutations[section.firstPermutation + p];
+                const FfxShaderBlobArchiveBlob&        blob        = blobs[permutation.blobIndex];
+
+                const char**    names[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_TYPE_COUNT]    = {};
+                const uint32_t* bindings[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_TYPE_COUNT] = {};
+                const uint32_t* counts[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_TYPE_COUNT]   = {};
+                const uint32_t* spaces[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_TYPE_COUNT]   = {};
+
+                for (uint32_t type = 0; type < FFX_SHADER_BLOB_ARCHIVE_RESOURCE_TYPE_COUNT; ++type)
+                {
+                    const FfxShaderBlobArchiveResourceTable& table = permutation.resources[type];
+                    if (table.count == 0)
+                        continue;
+
+                    // namePool was reserved up front, so these pointers stay stable
+                    const uint32_t* nameOffsets = reinterpret_cast<const uint32_t*>(data + table.namesOffset);
+                    names[type] = archive->namePool.data() + archive->namePool.size();
+                    for (uint32_t r = 0; r < table.count; ++r)
+                        archive->namePool.push_back(reinterpret_cast<const char*>(data + nameOffsets[r]));
+
+                    bindings[type] = reinterpret_cast<const uint32_t*>(data + table.bindingsOffset);
+                    counts[type]   = reinterpret_cast<const uint32_t*>(data + table.countsOffset);
+                    spaces[type]   = reinterpret_cast<const uint32_t*>(data + table.spacesOffset);
+                }
+
+                const bool                               isCompressed = blob.storedSize != blob.size;
+                const FfxShaderBlobArchiveResourceTable* tables       = permutation.resources;
+                mounted.permutations.push_back(MountedPermutation{FfxShaderBlob{
+                    isCompressed ? nullptr : data + blob.offset, blob.size,
+                    tables[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_CBV].count,
+                    tables[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_TEXTURE_SRV].count,
+                    tables[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_TEXTURE_UAV].count,
+                    tables[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_BUFFER_SRV].count,
+                    tables[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_BUFFER_UAV].count,
+                    tables[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_SAMPLER].count,
+                    tables[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_RT_ACCELERATION_STRUCTURE].count,
+                    names[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_CBV], bindings[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_CBV],
+                    counts[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_CBV], spaces[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_CBV],
+                    names[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_TEXTURE_SRV], bindings[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_TEXTURE_SRV],
+                    counts[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_TEXTURE_SRV], spaces[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_TEXTURE_SRV],
+                    names[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_TEXTURE_UAV], bindings[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_TEXTURE_UAV],
+                    counts[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_TEXTURE_UAV], spaces[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_TEXTURE_UAV],
+                    names[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_BUFFER_SRV], bindings[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_BUFFER_SRV],
+                    counts[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_BUFFER_SRV], spaces[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_BUFFER_SRV],
+                    names[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_BUFFER_UAV], bindings[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_BUFFER_UAV],
+                    counts[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_BUFFER_UAV], spaces[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_BUFFER_UAV],
+                    names[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_SAMPLER], bindings[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_SAMPLER],
+                    counts[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_SAMPLER], spaces[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_SAMPLER],
+                    names[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_RT_ACCELERATION_STRUCTURE], bindings[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_RT_ACCELERATION_STRUCTURE],
+                    counts[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_RT_ACCELERATION_STRUCTURE], spaces[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_RT_ACCELERATION_STRUCTURE]},
+                    data + blob.offset, blob.storedSize});
+            }
+
+            mountedSections[reinterpret_cast<const char*>(data + section.nameOffset)] = std::move(mounted);
+        }
+
+        ArchiveRegistry&            registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        for (auto& section : mountedSections)
+            registry.sections[section.first] = std::move(section.second);
+        registry.archives.push_back(std::move(archive));
+
+        return FFX_OK;
+    }
+}  // namespace
+
+FfxErrorCode ffxShaderBlobArchiveMount(const void* data, size_t size)
+{
+    return MountArchive(reinterpret_cast<const uint8_t*>(data), size, std::make_unique<MountedArchive>());
+}
+
+FfxErrorCode ffxShaderBlobArchiveMountFile(const wchar_t* path)
+{
+    FFX_RETURN_ON_ERROR(path, FFX_ERROR_INVALID_POINTER);
+
+    std::unique_ptr<MountedArchive> archive = std::make_unique<MountedArchive>();
+
+#ifdef _WIN32
+    // Map the archive rather than reading it, so only the pages of blobs actually used become resident
+    archive->file = CreateFileW(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    FFX_RETURN_ON_ERROR(archive->file != INVALID_HANDLE_VALUE, FFX_ERROR_INVALID_PATH);
+
+    LARGE_INTEGER fileSize = {};
+    FFX_RETURN_ON_ERROR(GetFileSizeEx(archive->file, &fileSize) && fileSize.QuadPart > 0, FFX_ERROR_INVALID_SIZE);
+
+    archive->mapping = CreateFileMappingW(archive->file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    FFX_RETURN_ON_ERROR(archive->mapping, FFX_ERROR_INVALID_PATH);
+
+    archive->mappedView = MapViewOfFile(archive->mapping, FILE_MAP_READ, 0, 0, 0);
+    FFX_RETURN_ON_ERROR(archive->mappedView, FFX_ERROR_INVALID_PATH);
+
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(archive->mappedView);
+    return MountArchive(data, size_t(fileSize.QuadPart), std::move(archive));
+#else
+    std::wstring widePath(path);
+    FILE*        fp = fopen(std::string(widePath.begin(), widePath.end()).c_str(), "rb");
+    FFX_RETURN_ON_ERROR(fp, FFX_ERROR_INVALID_PATH);
+
+    fseek(fp, 0, SEEK_END);
+    long fileSize = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+
+    if (fileSize <= 0)
+    {
+        fclose(fp);
+        return FFX_ERROR_INVALID_SIZE;
+    }
+
+    // new[] of uint8_t is suitably aligned for any fundamental type
+    archive->ownedData.reset(new uint8_t[fileSize]);
+    size_t bytesRead = fread(archive->ownedData.get(), 1, fileSize, fp);
+    fclose(fp);
+    FFX_RETURN_ON_ERROR(bytesRead == size_t(fileSize), FFX_ERROR_EOF);
+
+    const uint8_t* data = archive->ownedData.get();
+    return MountArchive(data, size_t(fileSize), std::move(archive));
+#endif // #ifdef _WIN32
+}
+
+void ffxShaderBlobArchiveUnmountAll()
+{
+    ArchiveRegistry&            registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    ClearCache(registry);
+    registry.sections.clear();
+    registry.archives.clear();
+}
+
+FfxShaderBlob ffxShaderBlobArchiveGetPermutationBlob(const char* sectionName, uint32_t keyIndex)
+{
+    ArchiveRegistry&             registry = GetRegistry();
+    std::unique_lock<std::mutex> lock(registry.mutex);
+
+    auto section = registry.sections.find(sectionName);
+    if (section == registry.sections.end() || keyIndex >= section->second.keyCount)
+    {
+        FFX_ASSERT_MESSAGE(false, "Shader permutation not found in any mounted archive.");
+
+        FfxShaderBlob emptyBlob = {};
+        return emptyBlob;
+    }
+
+    const MountedPermutation& permutation = section->second.permutations[section->second.indirectionTable[keyIndex]];
+    FfxShaderBlob             blob        = permutation.blob;
+    if (blob.data)
+        return blob;
+
+    const uint8_t* storedData = permutation.storedData;
+    const uint32_t storedSize = permutation.storedSize;
+
+    auto cached = registry.cache.find(storedData);
+    if (cached != registry.cache.end())
+    {
+        registry.cacheStats.hits++;
+        cached->second.pinCount++;
+        registry.cacheLru.splice(registry.cacheLru.begin(), registry.cacheLru, cached->second.lruPosition);
+
+        blob.data = cached->second.data.get();
+        return blob;
+    }
+
+    registry.cacheStats.misses++;
+
+    // Decompress outside of the lock so lookups of other blobs are not serialized behind it
+    lock.unlock();
+
+    std::unique_ptr<uint8_t[]> decompressed(new uint8_t[blob.size]);
+    if (!ffxShaderBlobLzDecompress(storedData, storedSize, decompressed.get(), blob.size))
+    {
+        FFX_ASSERT_MESSAGE(false, "Failed to decompress shader blob.");
+
+        FfxShaderBlob emptyBlob = {};
+        return emptyBlob;
+    }
+
+    lock.lock();
+
+    // Another thread may have decompressed the same blob in the meantime
+    cached = registry.cache.find(storedData);
+    if (cached == registry.cache.end())
+    {
+        CachedBlob entry;
+        entry.data        = std::move(decompressed);
+        entry.size        = blob.size;
+        entry.lruPosition = registry.cacheLru.insert(registry.cacheLru.begin(), storedData);
+
+        registry.cacheDataToStoredData[entry.data.get()] = storedData;
+        cached = registry.cache.emplace(storedData, std::move(entry)).first;
+
+        registry.cacheStats.residentBytes += blob.size;
+        if (registry.cacheStats.residentBytes > registry.cacheStats.peakResidentBytes)
+            registry.cacheStats.peakResidentBytes = registry.cacheStats.residentBytes;
+    }
+
+    cached->second.pinCount++;
+    blob.data = cached->second.data.get();
+
+    TrimCache(registry);
+
+    return blob;
+}
+
+void ffxShaderBlobArchiveReleasePermutationBlob(const uint8_t* blobData)
+{
+    ArchiveRegistry&            registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    auto storedData = registry.cacheDataToStoredData.find(blobData);
+    if (storedData == registry.cacheDataToStoredData.end())
+        return;
+
+    CachedBlob& cached = registry.cache[storedData->second];
+    FFX_ASSERT(cached.pinCount > 0);
+    cached.pinCount--;
+
+    TrimCache(registry);
+}
+
+void ffxShaderBlobArchiveSetCacheBudget(size_t budgetInBytes)
+{
+    ArchiveRegistry&            registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    registry.cacheStats.budgetBytes = budgetInBytes;
+    TrimCache(registry);
+}
+
+void ffxShaderBlobArchiveGetCacheStats(FfxShaderBlobArchiveCacheStats* outStats)
+{
+    FFX_ASSERT(outStats);
+
+    ArchiveRegistry&            registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    *outStats = registry.cacheStats;
+}
@@ -0,0 +1,81 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <FidelityFX/host/ffx_types.h>
+#include <FidelityFX/host/ffx_error.h>
+
+// Default size of the cache holding decompressed shader blobs.
+#define FFX_SHADER_BLOB_ARCHIVE_DEFAULT_CACHE_BUDGET    (16u * 1024u * 1024u)
+
+// Statistics of the decompression cache shared by all mounted archives.
+typedef struct FfxShaderBlobArchiveCacheStats
+{
+    uint64_t hits;                  // Lookups of compressed blobs served from the cache.
+    uint64_t misses;                // Lookups of compressed blobs that had to be decompressed.
+    uint64_t evictions;             // Decompressed blobs dropped to stay within the budget.
+    size_t   residentBytes;         // Decompressed bytes currently held by the cache.
+    size_t   peakResidentBytes;     // High water mark of residentBytes.
+    size_t   budgetBytes;           // Budget the cache is trimmed to.
+} FfxShaderBlobArchiveCacheStats;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif // #if defined(__cplusplus)
+
+// Mount an in-memory shader blob archive. The memory must stay valid until the archive is unmounted.
+// Sections already provided by a previously mounted archive are shadowed by the new one.
+FfxErrorCode ffxShaderBlobArchiveMount(const void* data, size_t size);
+
+// Memory map a shader blob archive from disk and mount it. The mapping is owned by the reader.
+FfxErrorCode ffxShaderBlobArchiveMountFile(const wchar_t* path);
+
+// Unmount all archives, releasing any memory owned by the reader. Must not race with lookups, and all
+// blobs handed out become invalid.
+void ffxShaderBlobArchiveUnmountAll();
+
+// Get the shader blob for the given section (shader name) and permutation key.
+// Returns an empty blob if the section or key can't be found.
+//
+// Compressed blobs are decompressed on first use into a cache shared by all archives, and stay pinned
+// in it until released with ffxShaderBlobArchiveReleasePermutationBlob. Lookups are thread safe.
+FfxShaderBlob ffxShaderBlobArchiveGetPermutationBlob(const char* sectionName, uint32_t keyIndex);
+
+// Release a blob returned by ffxShaderBlobArchiveGetPermutationBlob once its data has been consumed.
+// Unpinned blobs are evicted least recently used first whenever the cache exceeds its budget.
+// Pointers not handed out by the decompression cache are ignored.
+void ffxShaderBlobArchiveReleasePermutationBlob(const uint8_t* blobData);
+
+// Set the size of the decompression cache (FFX_SHADER_BLOB_ARCHIVE_DEFAULT_CACHE_BUDGET by default).
+// Pinned blobs are never evicted, so the cache may exceed its budget while they are in use.
+void ffxShaderBlobArchiveSetCacheBudget(size_t budgetInBytes);
+
+// Query the decompression cache statistics.
+void ffxShaderBlobArchiveGetCacheStats(FfxShaderBlobArchiveCacheStats* outStats);
+
+#if defined(__cplusplus)
+}
+#endif // #if defined(__cplusplus)
@@ -0,0 +1,112 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#pragma once
+
+#include <stdint.h>
+
+// On-disk layout of a FidelityFX shader blob archive, as written by FidelityFX-SC (-archive / -pack)
+// and read by ffx_shader_blob_archive.cpp.
+//
+// An archive holds any number of sections, one per compiled shader (e.g. "ffx_fsr1_easu_pass_wave64").
+// Each section owns an indirection table mapping permutation keys to its unique permutations, and each
+// permutation references a (deduplicated) shader blob plus its reflection tables. All offsets are in bytes
+// from the start of the archive, all values are little-endian, and all tables are 4-byte aligned.
+// Blob data is 16-byte aligned. Blobs that shrink when compressed are stored in LZ4 block format
+// (see ffx_shader_blob_lz.h) and decompressed on first use.
+//
+// Layout:
+//  FfxShaderBlobArchiveHeader
+//  FfxShaderBlobArchiveSection[sectionCount]
+//  FfxShaderBlobArchivePermutation[permutationCount]
+//  FfxShaderBlobArchiveBlob[blobCount]
+//  uint32_t table pool (indirection tables, reflection string offsets, bindings, counts and spaces)
+//  string table (null terminated strings)
+//  blob data
+
+#define FFX_SHADER_BLOB_ARCHIVE_MAGIC               0x41584646u  // 'FFXA'
+#define FFX_SHADER_BLOB_ARCHIVE_VERSION             2u
+#define FFX_SHADER_BLOB_ARCHIVE_BLOB_ALIGNMENT      16u
+
+/// Order of the reflection tables stored for each permutation.
+typedef enum FfxShaderBlobArchiveResourceType
+{
+    FFX_SHADER_BLOB_ARCHIVE_RESOURCE_CBV = 0,
+    FFX_SHADER_BLOB_ARCHIVE_RESOURCE_TEXTURE_SRV,
+    FFX_SHADER_BLOB_ARCHIVE_RESOURCE_TEXTURE_UAV,
+    FFX_SHADER_BLOB_ARCHIVE_RESOURCE_BUFFER_SRV,
+    FFX_SHADER_BLOB_ARCHIVE_RESOURCE_BUFFER_UAV,
+    FFX_SHADER_BLOB_ARCHIVE_RESOURCE_SAMPLER,
+    FFX_SHADER_BLOB_ARCHIVE_RESOURCE_RT_ACCELERATION_STRUCTURE,
+
+    FFX_SHADER_BLOB_ARCHIVE_RESOURCE_TYPE_COUNT
+} FfxShaderBlobArchiveResourceType;
+
+typedef struct FfxShaderBlobArchiveHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t totalSize;
+    uint32_t sectionCount;
+    uint32_t sectionsOffset;
+    uint32_t permutationCount;
+    uint32_t permutationsOffset;
+    uint32_t blobCount;
+    uint32_t blobsOffset;
+    uint32_t tablePoolOffset;
+    uint32_t tablePoolSize;
+    uint32_t stringTableOffset;
+    uint32_t stringTableSize;
+    uint32_t reserved[3];
+} FfxShaderBlobArchiveHeader;
+
+typedef struct FfxShaderBlobArchiveSection
+{
+    uint32_t nameOffset;                ///< Offset of the section name in the archive.
+    uint32_t keyCount;                  ///< Number of entries in the indirection table.
+    uint32_t indirectionTableOffset;    ///< Offset of the uint32_t indirection table (key -> section-local permutation index).
+    uint32_t firstPermutation;          ///< Index of the section's first permutation in the permutation table.
+    uint32_t permutationCount;          ///< Number of unique permutations in the section.
+} FfxShaderBlobArchiveSection;
+
+typedef struct FfxShaderBlobArchiveResourceTable
+{
+    uint32_t count;                     ///< Number of bound resources of this type.
+    uint32_t namesOffset;               ///< Offset of count uint32_t string offsets.
+    uint32_t bindingsOffset;            ///< Offset of count uint32_t binding indices.
+    uint32_t countsOffset;              ///< Offset of count uint32_t binding counts.
+    uint32_t spacesOffset;              ///< Offset of count uint32_t binding spaces.
+} FfxShaderBlobArchiveResourceTable;
+
+typedef struct FfxShaderBlobArchivePermutation
+{
+    uint32_t                          blobIndex;
+    FfxShaderBlobArchiveResourceTable resources[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_TYPE_COUNT];
+} FfxShaderBlobArchivePermutation;
+
+typedef struct FfxShaderBlobArchiveBlob
+{
+    uint32_t offset;                    ///< Offset of the stored blob data.
+    uint32_t size;                      ///< Size of the shader blob in bytes.
+    uint32_t storedSize;                ///< Size of the stored data. Equal to size if stored uncompressed.
+} FfxShaderBlobArchiveBlob;
@@ -0,0 +1,212 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+// Minimal LZ4 block format codec used for shader blobs in shader blob archives. The compressor is only
+// used offline by FidelityFX-SC, the decompressor by ffx_shader_blob_archive.cpp at runtime.
+//
+// A block is a sequence of (token, literal length, literals, match offset, match length) tuples where
+// the last one only holds literals. Matches are at least 4 bytes long and reference up to 64 KB back.
+
+#define FFX_SHADER_BLOB_LZ_MIN_MATCH        4u
+#define FFX_SHADER_BLOB_LZ_MAX_OFFSET       65535u
+#define FFX_SHADER_BLOB_LZ_HASH_BITS        12u
+#define FFX_SHADER_BLOB_LZ_LAST_LITERALS    5u      // a block always ends with at least this many literals
+#define FFX_SHADER_BLOB_LZ_MATCH_GUARD      12u     // no match may start within this many bytes of the end
+
+/// Worst case compressed size for an input of the given size.
+static inline uint32_t ffxShaderBlobLzCompressBound(uint32_t size)
+{
+    return size + size / 255 + 16;
+}
+
+static inline uint32_t ffxShaderBlobLzRead32(const uint8_t* ptr)
+{
+    uint32_t value;
+    memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+static inline int ffxShaderBlobLzWriteLength(uint8_t* dst, uint32_t dstCapacity, uint32_t* dstPos, uint32_t length)
+{
+    for (; length >= 255; length -= 255)
+    {
+        if (*dstPos >= dstCapacity)
+            return 0;
+        dst[(*dstPos)++] = 255;
+    }
+    if (*dstPos >= dstCapacity)
+        return 0;
+    dst[(*dstPos)++] = (uint8_t)length;
+    return 1;
+}
+
+static inline int ffxShaderBlobLzWriteSequence(
+    uint8_t* dst, uint32_t dstCapacity, uint32_t* dstPos, const uint8_t* literals, uint32_t literalLength, uint32_t matchOffset, uint32_t matchLength)
+{
+    if (*dstPos >= dstCapacity)
+        return 0;
+
+    const uint32_t matchCode = matchLength ? matchLength - FFX_SHADER_BLOB_LZ_MIN_MATCH : 0;
+    uint8_t* token = &dst[(*dstPos)++];
+    *token = (uint8_t)(((literalLength < 15 ? literalLength : 15) << 4) | (matchCode < 15 ? matchCode : 15));
+
+    if (literalLength >= 15 && !ffxShaderBlobLzWriteLength(dst, dstCapacity, dstPos, literalLength - 15))
+        return 0;
+    if (literalLength > dstCapacity - *dstPos)
+        return 0;
+    memcpy(dst + *dstPos, literals, literalLength);
+    *dstPos += literalLength;
+
+    // The final sequence carries literals only
+    if (matchLength == 0)
+        return 1;
+
+    if (dstCapacity - *dstPos < 2)
+        return 0;
+    dst[(*dstPos)++] = (uint8_t)(matchOffset & 0xff);
+    dst[(*dstPos)++] = (uint8_t)(matchOffset >> 8);
+
+    if (matchCode >= 15 && !ffxShaderBlobLzWriteLength(dst, dstCapacity, dstPos, matchCode - 15))
+        return 0;
+    return 1;
+}
+
+/// Compress srcSize bytes into dst.
+///
+/// @returns
+/// The compressed size in bytes, or 0 if the result does not fit into dstCapacity.
+static inline uint32_t ffxShaderBlobLzCompress(const uint8_t* src, uint32_t srcSize, uint8_t* dst, uint32_t dstCapacity)
+{
+    // Positions are stored biased by one so that 0 means empty
+    uint32_t hashTable[1u << FFX_SHADER_BLOB_LZ_HASH_BITS];
+    memset(hashTable, 0, sizeof(hashTable));
+
+    uint32_t srcPos = 0;
+    uint32_t anchor = 0;
+    uint32_t dstPos = 0;
+
+    if (srcSize > FFX_SHADER_BLOB_LZ_MATCH_GUARD)
+    {
+        const uint32_t matchStartLimit = srcSize - FFX_SHADER_BLOB_LZ_MATCH_GUARD;
+        const uint32_t matchEndLimit   = srcSize - FFX_SHADER_BLOB_LZ_LAST_LITERALS;
+
+        while (srcPos < matchStartLimit)
+        {
+            const uint32_t sequence  = ffxShaderBlobLzRead32(src + srcPos);
+            const uint32_t hash      = (sequence * 2654435761u) >> (32 - FFX_SHADER_BLOB_LZ_HASH_BITS);
+            const uint32_t reference = hashTable[hash];
+            hashTable[hash] = srcPos + 1;
+
+            if (reference == 0 || srcPos - (reference - 1) > FFX_SHADER_BLOB_LZ_MAX_OFFSET || ffxShaderBlobLzRead32(src + reference - 1) != sequence)
+            {
+                ++srcPos;
+                continue;
+            }
+
+            const uint32_t matchPos    = reference - 1;
+            uint32_t       matchLength = FFX_SHADER_BLOB_LZ_MIN_MATCH;
+            while (srcPos + matchLength < matchEndLimit && src[matchPos + matchLength] == src[srcPos + matchLength])
+                ++matchLength;
+
+            if (!ffxShaderBlobLzWriteSequence(dst, dstCapacity, &dstPos, src + anchor, srcPos - anchor, srcPos - matchPos, matchLength))
+                return 0;
+
+            srcPos += matchLength;
+            anchor = srcPos;
+        }
+    }
+
+    if (!ffxShaderBlobLzWriteSequence(dst, dstCapacity, &dstPos, src + anchor, srcSize - anchor, 0, 0))
+        return 0;
+
+    return dstPos;
+}
+
+static inline int ffxShaderBlobLzReadLength(const uint8_t* src, uint32_t srcSize, uint32_t* srcPos, uint64_t* length)
+{
+    uint8_t value;
+    do
+    {
+        if (*srcPos >= srcSize)
+            return 0;
+        value = src[(*srcPos)++];
+        *length += value;
+    } while (value == 255);
+    return 1;
+}
+
+/// Decompress srcSize bytes into exactly dstSize bytes at dst. Malformed input is rejected without
+/// reading or writing out of bounds.
+///
+/// @returns
+/// 1 on success, 0 if the input is malformed or does not decompress to exactly dstSize bytes.
+static inline int ffxShaderBlobLzDecompress(const uint8_t* src, uint32_t srcSize, uint8_t* dst, uint32_t dstSize)
+{
+    uint32_t srcPos = 0;
+    uint32_t dstPos = 0;
+
+    while (srcPos < srcSize)
+    {
+        const uint8_t token = src[srcPos++];
+
+        uint64_t literalLength = token >> 4;
+        if (literalLength == 15 && !ffxShaderBlobLzReadLength(src, srcSize, &srcPos, &literalLength))
+            return 0;
+        if (literalLength > srcSize - srcPos || literalLength > dstSize - dstPos)
+            return 0;
+        memcpy(dst + dstPos, src + srcPos, (size_t)literalLength);
+        srcPos += (uint32_t)literalLength;
+        dstPos += (uint32_t)literalLength;
+
+        // The final sequence carries literals only
+        if (srcPos == srcSize)
+            break;
+
+        if (srcSize - srcPos < 2)
+            return 0;
+        const uint32_t matchOffset = src[srcPos] | (src[srcPos + 1] << 8);
+        srcPos += 2;
+        if (matchOffset == 0 || matchOffset > dstPos)
+            return 0;
+
+        uint64_t matchLength = token & 15;
+        if (matchLength == 15 && !ffxShaderBlobLzReadLength(src, srcSize, &srcPos, &matchLength))
+            return 0;
+        matchLength += FFX_SHADER_BLOB_LZ_MIN_MATCH;
+        if (matchLength > dstSize - dstPos)
+            return 0;
+
+        // Matches may overlap their own output, so copy byte by byte
+        const uint8_t* match = dst + dstPos - matchOffset;
+        for (uint32_t i = 0; i < (uint32_t)matchLength; ++i)
+            dst[dstPos + i] = match[i];
+        dstPos += (uint32_t)matchLength;
+    }
+
+    return dstPos == dstSize;
+}
@@ -222,6 +222,16 @@ FfxErrorCode ffxGetPermutationBlobByIndex(
     return FFX_OK;
 }
 
+void ffxReleasePermutationBlob(const FfxShaderBlob* blob)
+{
+#if defined(FFX_SHADER_BLOB_ARCHIVE)
+    if (blob && blob->data)
+        ffxShaderBlobArchiveReleasePermutationBlob(blob->data);
+#else
+    (void)blob;
+#endif // #if defined(FFX_SHADER_BLOB_ARCHIVE)
+}
+
 FfxErrorCode ffxIsWave64(FfxEffect effectId, uint32_t permutationOptions, bool& isWave64)
 {
     (void)permutationOptions;
@@ -25,6 +25,16 @@
 #include <stdint.h>
 #include <FidelityFX/host/ffx_interface.h>
 
+// Resolve the shader blob for a permutation key of the named shader. Shaders are either embedded
+// as generated C arrays (default) or read from a mounted shader blob archive when the SDK is built
+// with FFX_SHADER_BLOB_ARCHIVE (see ffx_shader_blob_archive.h).
+#if defined(FFX_SHADER_BLOB_ARCHIVE)
+#include "ffx_shader_blob_archive.h"
+#define FFX_POPULATE_PERMUTATION_BLOB(name, keyIndex) ffxShaderBlobArchiveGetPermutationBlob(#name, keyIndex)
+#else
+#define FFX_POPULATE_PERMUTATION_BLOB(name, keyIndex) POPULATE_SHADER_BLOB_FFX(g_##name##_PermutationInfo, g_##name##_IndirectionTable[keyIndex])
+#endif // #if defined(FFX_SHADER_BLOB_ARCHIVE)
+
 #if defined(__cplusplus)
 extern "C" {
 #endif // #if defined(__cplusplus)
@@ -38,9 +48,20 @@ FfxErrorCode ffxGetPermutationBlobByIndex(FfxEffect effectId,
     uint32_t permutationOptions,
     FfxShaderBlob* outBlob);
 
+// Release a shader blob obtained from ffxGetPermutationBlobByIndex once its data has been consumed.
+// Only blobs decompressed from a shader blob archive hold resources, all others are ignored.
+void ffxReleasePermutationBlob(const FfxShaderBlob* blob);
+
 // Check is Wave64 is requested on this permutation
 FfxErrorCode ffxIsWave64(FfxEffect effectId, uint32_t permutationOptions, bool& isWave64);
 
 #if defined(__cplusplus)
 }
+
+// Releases a shader blob when leaving the scope it was fetched in, covering all early outs.
+struct FfxScopedPermutationBlob
+{
+    const FfxShaderBlob* blob;
+    ~FfxScopedPermutationBlob() { ffxReleasePermutationBlob(blob); }
+};
 #endif // #if defined(__cplusplus)
@@ -0,0 +1,137 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <stdint.h>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+// A fixed set of worker threads a backend keeps for the lifetime of its effect contexts, so work fanned out on every
+// context creation (such as compiling a batch of pipelines) doesn't pay for spawning and joining threads each time.
+//
+// run() hands one task to every worker and runs it on the calling thread too, returning once all of them are done.
+// Tasks are expected to pull their work items from a shared counter, so it doesn't matter how many workers actually
+// get to take part. Calls to run() are serialized.
+class FfxWorkerPool
+{
+public:
+    // Starts up to workerCount threads; if the system refuses to create more, the pool makes do with fewer
+    explicit FfxWorkerPool(uint32_t workerCount)
+    {
+        m_workers.reserve(workerCount);
+        try
+        {
+            for (uint32_t i = 0; i < workerCount; ++i)
+                m_workers.emplace_back(&FfxWorkerPool::workerLoop, this);
+        }
+        catch (const std::system_error&)
+        {
+        }
+    }
+
+    ~FfxWorkerPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_wake.notify_all();
+
+        for (std::thread& worker : m_workers)
+            worker.join();
+    }
+
+    FfxWorkerPool(const FfxWorkerPool&)            = delete;
+    FfxWorkerPool& operator=(const FfxWorkerPool&) = delete;
+
+    uint32_t getWorkerCount() const
+    {
+        return uint32_t(m_workers.size());
+    }
+
+    template <typename Task>
+    void run(Task& task)
+    {
+        run([](void* data) { (*static_cast<Task*>(data))(); }, &task);
+    }
+
+    void run(void (*function)(void*), void* data)
+    {
+        std::lock_guard<std::mutex> runLock(m_runMutex);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_function    = function;
+            m_data        = data;
+            m_busyWorkers = uint32_t(m_workers.size());
+            ++m_generation;
+        }
+        m_wake.notify_all();
+
+        // the calling thread takes part too
+        function(data);
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [this]() { return m_busyWorkers == 0; });
+    }
+
+private:
+    void workerLoop()
+    {
+        uint64_t                     generation = 0;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        for (;;)
+        {
+            m_wake.wait(lock, [&]() { return m_stop || m_generation != generation; });
+            if (m_stop)
+                return;
+
+            // run() waits for every worker before publishing another task, so no generation is ever skipped
+            generation = m_generation;
+            void (*function)(void*) = m_function;
+            void* data              = m_data;
+
+            lock.unlock();
+            function(data);
+            lock.lock();
+
+            if (--m_busyWorkers == 0)
+                m_done.notify_one();
+        }
+    }
+
+    std::vector<std::thread> m_workers;
+    std::mutex               m_runMutex;
+
+    // guards everything below
+    std::mutex              m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+    uint64_t                m_generation  = 0;
+    uint32_t                m_busyWorkers = 0;
+    bool                    m_stop        = false;
+    void                    (*m_function)(void*) = nullptr;
+    void*                   m_data               = nullptr;
+};
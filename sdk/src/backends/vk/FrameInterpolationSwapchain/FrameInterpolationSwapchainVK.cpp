@@ -663,6 +663,12 @@ FfxErrorCode ffxConfigureFrameInterpolationSwapchainVK(FfxSwapchain gameSwapChai
                     pSwapChainVK->setFramePacingTuning(static_cast<FfxSwapchainFramePacingTuning*>(valuePtr));
                 }
             break;
+            case FFX_FI_SWAPCHAIN_CONFIGURE_KEY_FRAMETIMEPREDICTOR:
+                if (valuePtr != nullptr)
+                {
+                    pSwapChainVK->setFrameTimePredictor(*static_cast<FfxSwapchainFrameTimePredictor*>(valuePtr));
+                }
+            break;
             return FFX_OK;
         }
     }
@@ -1190,8 +1196,7 @@ DWORD WINAPI interpolationThread(LPVOID param)
             SetThreadPriority(presenterThreadHandle, THREAD_PRIORITY_HIGHEST);
             SetThreadDescription(presenterThreadHandle, L"AMD FSR Presenter Thread");
 
-            SimpleMovingAverage<10, double> frameTime{};
-            int64_t previousQpc = 0;
+            FfxFramePacer framePacer{};
 
             while (!presenter->shutdown)
             {
@@ -1213,28 +1218,11 @@ DWORD WINAPI interpolationThread(LPVOID param)
 
                     int64_t currentQpc = 0;
                     QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&currentQpc));
-
-                    const double deltaQpc = double(currentQpc - previousQpc) * (previousQpc > 0);
-                    previousQpc           = currentQpc;
-
-                    // reset pacing averaging if delta > 10 fps,
                     int64_t qpcFrequency;
                     QueryPerformanceFrequency(reinterpret_cast<LARGE_INTEGER*>(&qpcFrequency));
-                    const float fTimeoutInSeconds       = 0.1f;
-                    double      deltaQpcResetThreashold = double(qpcFrequency * fTimeoutInSeconds);
-                    if ((deltaQpc > deltaQpcResetThreashold) || presenter->resetTimer)
-                    {
-                        frameTime.reset();
-                    }
-                    else
-                    {
-                        frameTime.update(deltaQpc);
-                    }
 
-                    // set presentation time: reduce based on variance and subract safety margin so we don't lock on a framerate lower than necessary
-                    int64_t qpcSafetyMargin         = int64_t(qpcFrequency * presenter->safetyMarginInSec);
-                    const int64_t conservativeAvg   = int64_t(frameTime.getAverage() * 0.5 - frameTime.getVariance() * presenter->varianceFactor);
-                    const int64_t deltaToUse        = conservativeAvg > qpcSafetyMargin ? (conservativeAvg - qpcSafetyMargin) : 0;
+                    const int64_t deltaToUse = framePacer.update(currentQpc, qpcFrequency, presenter->resetTimer, presenter->safetyMarginInSec, presenter->varianceFactor,
+                                                                 FfxSwapchainFrameTimePredictor(presenter->frameTimePredictor));
                     entry.frames[PacingData::FrameType::Interpolated_1].presentQpcDelta = deltaToUse;
                     entry.frames[PacingData::FrameType::Real].presentQpcDelta           = deltaToUse;
 
@@ -2224,6 +2212,11 @@ void FrameInterpolationSwapChainVK::setFramePacingTuning(const FfxSwapchainFrame
     presentInfo.varianceFactor = static_cast<double> (framePacingTuning->varianceFactor);
 }
 
+void FrameInterpolationSwapChainVK::setFrameTimePredictor(FfxSwapchainFrameTimePredictor predictor)
+{
+    presentInfo.frameTimePredictor = predictor;
+}
+
 VkResult FrameInterpolationSwapChainVK::queuePresentNonInterpolated(VkCommands* pCommands, uint32_t imageIndex, SubmissionSemaphores& semaphoresToWait)
 {
     SubmissionSemaphores semaphoresToSignal;
@@ -213,6 +213,7 @@ struct FrameinterpolationPresentInfo
 
     volatile double            safetyMarginInSec = 0.0001; //0.1ms
     volatile double            varianceFactor    = 0.1;
+    volatile uint32_t          frameTimePredictor = FFX_SWAPCHAIN_FRAMETIME_PREDICTOR_MOVING_AVERAGE;
 
     FfxWaitCallbackFunc waitCallback               = nullptr;
 };
@@ -245,6 +246,7 @@ public:  // vulkan functions reimplementation
 public:
     void            setFrameGenerationConfig(FfxFrameGenerationConfig const* config);
     void            setFramePacingTuning(const FfxSwapchainFramePacingTuning* framePacingTuning);
+    void            setFrameTimePredictor(FfxSwapchainFrameTimePredictor predictor);
     bool            waitForPresents();
     FfxResource     interpolationOutput(int index = 0);
     VkCommandBuffer getInterpolationCommandList();
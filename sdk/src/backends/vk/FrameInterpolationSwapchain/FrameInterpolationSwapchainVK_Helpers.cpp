@@ -26,13 +26,22 @@
 #include <dwmapi.h>
 #endif  // #ifdef _WIN32
 
-void waitForPerformanceCount(const int64_t targetCount)
+static int64_t getPerformanceCount(void*)
 {
     int64_t currentCount = 0;
-    do
-    {
-        QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&currentCount));
-    } while (currentCount < targetCount);
+    QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&currentCount));
+    return currentCount;
+}
+
+void waitForPerformanceCount(const int64_t targetCount)
+{
+    FfxFramePacingTimer timer = {};
+    QueryPerformanceFrequency(reinterpret_cast<LARGE_INTEGER*>(&timer.frequency));
+    timer.getCount = getPerformanceCount;
+
+    // no sleep callback, so this only spins
+    FfxPreciseWait preciseWait{};
+    preciseWait.waitForCount(timer, targetCount, FFX_FRAME_PACING_UNKNOWN_TIMER_RESOLUTION, 0);
 }
 
 VkResult VulkanQueue::submit(VkCommandBuffer commandBuffer, SubmissionSemaphores& semaphoresToWait, SubmissionSemaphores& semaphoresToSignal, VkFence fence)
@@ -25,7 +25,10 @@
 #include <FidelityFX/host/ffx_assert.h>
 #include <FidelityFX/host/backends/vk/ffx_vk.h>
 #include <ffx_shader_blobs.h>
+#include <ffx_compute_job.h>
 #include <ffx_breadcrumbs_list.h>
+#include <ffx_constant_ring.h>
+#include <ffx_worker_pool.h>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -35,6 +38,11 @@
 
 #include <vulkan/vulkan.h>
 
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <vector>
+
 // prototypes for functions in the interface
 FfxVersionNumber       GetSDKVersionVK(FfxInterface* backendInterface);
 FfxErrorCode           GetEffectGpuMemoryUsageVK(FfxInterface* backendInterface, FfxUInt32 effectContextId, FfxEffectMemoryUsage* outVramUsage);
@@ -52,6 +60,7 @@ FfxErrorCode           RegisterStaticResourceVK(FfxInterface* backendInterface,
 FfxResourceDescription GetResourceDescriptionVK(FfxInterface* backendInterface, FfxResourceInternal resource);
 FfxErrorCode           StageConstantBufferDataVK(FfxInterface* backendInterface, void* data, FfxUInt32 size, FfxConstantBuffer* constantBuffer);
 FfxErrorCode           CreatePipelineVK(FfxInterface* backendInterface, FfxEffect effect, FfxPass passId, uint32_t permutationOptions, const FfxPipelineDescription* desc, FfxUInt32 effectContextId, FfxPipelineState* outPass);
+FfxErrorCode           CreatePipelinesVK(FfxInterface* backendInterface, FfxEffect effect, const FfxPipelineCreateDescription* descs, uint32_t count, FfxUInt32 effectContextId);
 FfxErrorCode           DestroyPipelineVK(FfxInterface* backendInterface, FfxPipelineState* pipeline, FfxUInt32 effectContextId);
 FfxErrorCode           ScheduleGpuJobVK(FfxInterface* backendInterface, const FfxGpuJobDescription* job);
 FfxErrorCode           ExecuteGpuJobsVK(FfxInterface* backendInterface, FfxCommandList commandList, FfxUInt32 effectContextId);
@@ -74,6 +83,20 @@ static FfxConstantBufferAllocator s_fpConstantAllocator = nullptr;
 // Offset the binding of samplers to avoid collisions
 constexpr uint32_t SAMPLER_BINDING_SHIFT = 1000;
 
+// One descriptor of a dispatch, laid out as expected by the pipeline's descriptor update template
+typedef union DescriptorInfoVK
+{
+    VkDescriptorImageInfo  image;
+    VkDescriptorBufferInfo buffer;
+} DescriptorInfoVK;
+
+constexpr uint64_t DESCRIPTOR_HASH_SEED  = 0xcbf29ce484222325ull;
+constexpr uint64_t DESCRIPTOR_HASH_PRIME = 0x100000001b3ull;
+
+// Mips at and beyond the last tracked level share its state
+constexpr uint32_t MAX_TRACKED_MIP_LEVELS = 16;
+constexpr uint32_t ALL_MIP_LEVELS         = UINT32_MAX;
+
 typedef struct BackendContext_VK {
 
     // store for resources and resourceViews
@@ -89,7 +112,8 @@ typedef struct BackendContext_VK {
 
         FfxResourceDescription  resourceDescription;
         FfxResourceStates       initialState;
-        FfxResourceStates       currentState;
+        FfxResourceStates       currentState;       // Whole resource state, or mip 0 state while splitMipStates is set
+        FfxResourceStates       mipStates[MAX_TRACKED_MIP_LEVELS];
         int32_t                 srvViewIndex;
         int32_t                 uavViewIndex;
         uint32_t                uavViewCount;
@@ -100,6 +124,12 @@ typedef struct BackendContext_VK {
 
         bool                    undefined;
         bool                    dynamic;
+        bool                    splitMipStates;
+
+        // Unique per creation/registration, so cached descriptor sets never match a recreated resource. Registered
+        // resources get a new generation (and new views) on every RegisterResourceVK call, so their descriptor sets
+        // are only reused by repeated dispatches within a frame.
+        uint64_t                generation;
 
     } Resource;
 
@@ -110,6 +140,8 @@ typedef struct BackendContext_VK {
         VkDescriptorSet         descriptorSets[FFX_MAX_QUEUED_FRAMES * MAX_PIPELINE_USAGE_PER_FRAME];
         uint32_t                descriptorSetIndex;
         VkPipelineLayout        pipelineLayout;
+        VkDescriptorUpdateTemplate descriptorUpdateTemplate;
+        uint64_t                descriptorSetHashes[FFX_MAX_QUEUED_FRAMES * MAX_PIPELINE_USAGE_PER_FRAME];  // 0 when the contents are unknown
         int32_t                 staticTextureSrvSet;
         int32_t                 staticBufferSrvSet;
         int32_t                 staticTextureUavSet;
@@ -130,6 +162,10 @@ typedef struct BackendContext_VK {
         PFN_vkCreateShaderModule                vkCreateShaderModule = 0;
         PFN_vkCreatePipelineLayout              vkCreatePipelineLayout = 0;
         PFN_vkCreateComputePipelines            vkCreateComputePipelines = 0;
+        PFN_vkCreatePipelineCache               vkCreatePipelineCache = 0;
+        PFN_vkDestroyPipelineCache              vkDestroyPipelineCache = 0;
+        PFN_vkGetPipelineCacheData              vkGetPipelineCacheData = 0;
+        PFN_vkMergePipelineCaches               vkMergePipelineCaches = 0;
         PFN_vkDestroyPipelineLayout             vkDestroyPipelineLayout = 0;
         PFN_vkDestroyPipeline                   vkDestroyPipeline = 0;
         PFN_vkDestroyImage                      vkDestroyImage = 0;
@@ -141,6 +177,7 @@ typedef struct BackendContext_VK {
         PFN_vkDestroySampler                    vkDestroySampler = 0;
         PFN_vkDestroyShaderModule               vkDestroyShaderModule = 0;
         PFN_vkGetBufferMemoryRequirements       vkGetBufferMemoryRequirements = 0;
+        PFN_vkDeviceWaitIdle                    vkDeviceWaitIdle = 0;
         PFN_vkGetBufferMemoryRequirements2KHR   vkGetBufferMemoryRequirements2KHR = 0;
         PFN_vkGetImageMemoryRequirements        vkGetImageMemoryRequirements = 0;
         PFN_vkAllocateDescriptorSets            vkAllocateDescriptorSets = 0;
@@ -152,6 +189,9 @@ typedef struct BackendContext_VK {
         PFN_vkBindBufferMemory                  vkBindBufferMemory = 0;
         PFN_vkBindImageMemory                   vkBindImageMemory = 0;
         PFN_vkUpdateDescriptorSets              vkUpdateDescriptorSets = 0;
+        PFN_vkCreateDescriptorUpdateTemplate    vkCreateDescriptorUpdateTemplate = 0;
+        PFN_vkDestroyDescriptorUpdateTemplate   vkDestroyDescriptorUpdateTemplate = 0;
+        PFN_vkUpdateDescriptorSetWithTemplate   vkUpdateDescriptorSetWithTemplate = 0;
         PFN_vkFlushMappedMemoryRanges           vkFlushMappedMemoryRanges = 0;
         PFN_vkCmdPipelineBarrier                vkCmdPipelineBarrier = 0;
         PFN_vkCmdBindPipeline                   vkCmdBindPipeline = 0;
@@ -188,15 +228,31 @@ typedef struct BackendContext_VK {
     uint8_t*                pStagingRingBuffer;
     uint32_t                stagingRingBufferBase = 0;
 
+    uint64_t                resourceGeneration = 0;
+
     PipelineLayout*         pPipelineLayouts;
 
+    // Shared by all effect contexts. While no context is alive, pipelineCacheData points to the data the next cache is
+    // created from: either the application's (ffxSetPipelineCacheDataVK), or the last cache serialized into the
+    // storage it provided (ffxSetPipelineCacheStorageVK).
+    VkPipelineCache         pipelineCache;
+    const void*             pipelineCacheData;
+    size_t                  pipelineCacheDataSize;
+    void*                   pipelineCacheStorage;
+    size_t                  pipelineCacheStorageSize;
+
+    // Compiles batches of pipelines, from the first batch until the last effect context is destroyed
+    FfxWorkerPool*          pPipelineWorkers;
+
     VkDescriptorPool        descriptorPool;
     uint32_t                bindlessBase;
 
+    // Image barriers carry layout transitions; everything else folds into a single global memory barrier
     VkImageMemoryBarrier    imageMemoryBarriers[FFX_MAX_BARRIERS] = {};
-    VkBufferMemoryBarrier   bufferMemoryBarriers[FFX_MAX_BARRIERS] = {};
     uint32_t                scheduledImageBarrierCount = 0;
-    uint32_t                scheduledBufferBarrierCount = 0;
+    VkAccessFlags           memoryBarrierSrcAccessMask = 0;
+    VkAccessFlags           memoryBarrierDstAccessMask = 0;
+    bool                    memoryBarrierScheduled = false;
     VkPipelineStageFlags    srcStageMask = 0;
     VkPipelineStageFlags    dstStageMask = 0;
 
@@ -248,15 +304,15 @@ typedef struct BackendContext_VK {
     EffectContext*          pEffectContexts;
 
      // Allocation defaults
-    FfxConstantAllocation FallbackConstantAllocator(void* data, FfxUInt64 dataSize);
+    FfxConstantAllocation FallbackConstantAllocator(void* data, FfxUInt64 dataSize, FfxUInt32 effectContextId);
     VkDeviceMemory        uniformBufferMemory = VK_NULL_HANDLE;
     VkMemoryPropertyFlags uniformBufferMemoryProperties;
     VkDeviceSize          uniformBufferAlignment = 0;
     void*                 uniformBufferMem       = nullptr;
     VkBuffer              uniformBuffer          = VK_NULL_HANDLE;
     VkDeviceSize          uniformBufferSize      = 0;
-    VkDeviceSize          uniformBufferOffset    = 0;
-    std::mutex            uniformBufferMutex;
+    FfxConstantRing       constantRing;
+    void*                 pConstantRingContexts  = nullptr;
 
     uint32_t                numDeviceExtensions = 0;
     VkExtensionProperties*  extensionProperties = nullptr;
@@ -286,9 +342,10 @@ FFX_API size_t ffxGetScratchMemorySizeVK(VkPhysicalDevice physicalDevice, size_t
     uint32_t pipelineArraySize = FFX_ALIGN_UP(maxContexts * FFX_MAX_PASS_COUNT * sizeof(BackendContext_VK::PipelineLayout), sizeof(uint32_t));
     uint32_t resourceArraySize = FFX_ALIGN_UP(maxContexts * FFX_MAX_RESOURCE_COUNT * sizeof(BackendContext_VK::Resource), sizeof(uint32_t));
     uint32_t contextArraySize = FFX_ALIGN_UP(maxContexts * sizeof(BackendContext_VK::EffectContext), sizeof(uint32_t));
+    uint32_t constantRingContextArraySize = uint32_t(FfxConstantRing::getContextMemorySize(maxContexts));
     
     return FFX_ALIGN_UP(sizeof(BackendContext_VK) + extensionPropArraySize + gpuJobDescArraySize + resourceViewArraySize + stagingRingBufferArraySize +
-                            pipelineArraySize + resourceArraySize + contextArraySize,
+                            pipelineArraySize + resourceArraySize + contextArraySize + constantRingContextArraySize,
                         sizeof(uint64_t));
 }
 
@@ -332,6 +389,7 @@ FfxErrorCode ffxGetInterfaceVK(
     backendInterface->fpGetResourceDescription = GetResourceDescriptionVK;
     backendInterface->fpStageConstantBufferDataFunc = StageConstantBufferDataVK;
     backendInterface->fpCreatePipeline = CreatePipelineVK;
+    backendInterface->fpCreatePipelines = CreatePipelinesVK;
     backendInterface->fpDestroyPipeline = DestroyPipelineVK;
     backendInterface->fpGetPermutationBlobByIndex = ffxGetPermutationBlobByIndex;
     backendInterface->fpScheduleGpuJob = ScheduleGpuJobVK;
@@ -1081,10 +1139,11 @@ void copyResourceState(BackendContext_VK::Resource* backendResource, const FfxRe
     FfxResourceStates state = inFfxResource->state;
 
     // copy the new states
-    backendResource->initialState = state;
-    backendResource->currentState = state;
-    backendResource->undefined    = false;
-    backendResource->dynamic      = true;
+    backendResource->initialState   = state;
+    backendResource->currentState   = state;
+    backendResource->undefined      = false;
+    backendResource->dynamic        = true;
+    backendResource->splitMipStates = false;
 
     // If the internal resource state is undefined, that means we are importing a resource that
     // has not yet been initialized, so tag the resource as undefined so we can transition it accordingly.
@@ -1149,70 +1208,184 @@ void endMarkerVK(BackendContext_VK* backendContext, VkCommandBuffer commandBuffe
     backendContext->vkFunctionTable.vkCmdEndDebugUtilsLabelEXT(commandBuffer);
 }
 
-void addBarrier(BackendContext_VK* backendContext, FfxResourceInternal* resource, FfxResourceStates newState)
+static uint32_t getTrackedMipCount(const BackendContext_VK::Resource& resource)
 {
-    FFX_ASSERT(NULL != backendContext);
-    FFX_ASSERT(NULL != resource);
+    if (resource.resourceDescription.type == FFX_RESOURCE_TYPE_BUFFER)
+        return 1;
+    return FFX_MAXIMUM(1u, FFX_MINIMUM(resource.resourceDescription.mipCount, MAX_TRACKED_MIP_LEVELS));
+}
 
-    BackendContext_VK::Resource& ffxResource = backendContext->pResources[resource->internalIndex];
+static FfxResourceStates getSubresourceState(const BackendContext_VK::Resource& resource, uint32_t mip)
+{
+    return resource.splitMipStates ? resource.mipStates[mip] : resource.currentState;
+}
 
-    if (ffxResource.resourceDescription.type == FFX_RESOURCE_TYPE_BUFFER)
+static void setSubresourceStates(BackendContext_VK::Resource& resource, uint32_t baseMip, uint32_t mipCount, FfxResourceStates state)
+{
+    const uint32_t trackedMipCount = getTrackedMipCount(resource);
+    if (baseMip == 0 && mipCount == trackedMipCount)
     {
-        VkBuffer vkResource = ffxResource.bufferResource;
-        VkBufferMemoryBarrier* barrier = &backendContext->bufferMemoryBarriers[backendContext->scheduledBufferBarrierCount];
+        resource.currentState   = state;
+        resource.splitMipStates = false;
+        return;
+    }
+
+    if (!resource.splitMipStates)
+    {
+        for (uint32_t mip = 0; mip < trackedMipCount; ++mip)
+            resource.mipStates[mip] = resource.currentState;
+        resource.splitMipStates = true;
+    }
+
+    for (uint32_t mip = baseMip; mip < baseMip + mipCount; ++mip)
+        resource.mipStates[mip] = state;
+    resource.currentState = resource.mipStates[0];
+}
+
+static void setImageBarrierMips(VkImageMemoryBarrier& barrier, uint32_t baseMip, uint32_t endMip, uint32_t trackedMipCount)
+{
+    // the last tracked level stands for the rest of the chain
+    barrier.subresourceRange.baseMipLevel = baseMip;
+    barrier.subresourceRange.levelCount   = (endMip == trackedMipCount) ? VK_REMAINING_MIP_LEVELS : endMip - baseMip;
+}
+
+static void addImageBarrier(BackendContext_VK* backendContext, const BackendContext_VK::Resource& resource, VkImageLayout oldLayout, VkImageLayout newLayout,
+                            VkAccessFlags srcAccessMask, VkAccessFlags dstAccessMask, uint32_t baseMip, uint32_t mipCount)
+{
+    const uint32_t trackedMipCount = getTrackedMipCount(resource);
+    const uint32_t endMip          = baseMip + mipCount;
+
+    for (uint32_t i = 0; i < backendContext->scheduledImageBarrierCount; ++i)
+    {
+        VkImageMemoryBarrier& pending = backendContext->imageMemoryBarriers[i];
+        if (pending.image != resource.imageResource)
+            continue;
+
+        const uint32_t pendingBaseMip = pending.subresourceRange.baseMipLevel;
+        const uint32_t pendingEndMip  = (pending.subresourceRange.levelCount == VK_REMAINING_MIP_LEVELS) ? trackedMipCount : pendingBaseMip + pending.subresourceRange.levelCount;
+
+        if (pendingBaseMip < endMip && baseMip < pendingEndMip)
+        {
+            // Barriers of one batch must not overlap, so the mips both transition chain onto the pending barrier. No
+            // work runs between the two transitions, so the intermediate layout is skipped. The pending barrier keeps
+            // the mips only it transitions, and the mips only this one transitions are added on their own.
+            FFX_ASSERT(pending.newLayout == oldLayout);
+            const uint32_t overlapBaseMip = FFX_MAXIMUM(baseMip, pendingBaseMip);
+            const uint32_t overlapEndMip  = FFX_MINIMUM(endMip, pendingEndMip);
+
+            const VkImageMemoryBarrier pendingTransition = pending;
+            pending.newLayout     = newLayout;
+            pending.dstAccessMask = dstAccessMask;
+            setImageBarrierMips(pending, overlapBaseMip, overlapEndMip, trackedMipCount);
+
+            const uint32_t remainders[2][2] = { { pendingBaseMip, overlapBaseMip }, { overlapEndMip, pendingEndMip } };
+            for (const uint32_t (&range)[2] : remainders)
+            {
+                if (range[0] == range[1])
+                    continue;
+                FFX_ASSERT(backendContext->scheduledImageBarrierCount < FFX_MAX_BARRIERS);
+                VkImageMemoryBarrier& remainder = backendContext->imageMemoryBarriers[backendContext->scheduledImageBarrierCount++];
+                remainder = pendingTransition;
+                setImageBarrierMips(remainder, range[0], range[1], trackedMipCount);
+            }
+
+            if (baseMip < overlapBaseMip)
+                addImageBarrier(backendContext, resource, oldLayout, newLayout, srcAccessMask, dstAccessMask, baseMip, overlapBaseMip - baseMip);
+            if (overlapEndMip < endMip)
+                addImageBarrier(backendContext, resource, oldLayout, newLayout, srcAccessMask, dstAccessMask, overlapEndMip, endMip - overlapEndMip);
+            return;
+        }
+
+        // identical transitions of neighbouring mips share one barrier
+        if (pending.oldLayout == oldLayout && pending.newLayout == newLayout && pending.srcAccessMask == srcAccessMask && pending.dstAccessMask == dstAccessMask &&
+            pendingEndMip == baseMip)
+        {
+            setImageBarrierMips(pending, pendingBaseMip, endMip, trackedMipCount);
+            return;
+        }
+    }
+
+    FFX_ASSERT(backendContext->scheduledImageBarrierCount < FFX_MAX_BARRIERS);
+    VkImageMemoryBarrier* barrier = &backendContext->imageMemoryBarriers[backendContext->scheduledImageBarrierCount++];
+
+    barrier->sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier->pNext = nullptr;
+    barrier->srcAccessMask = srcAccessMask;
+    barrier->dstAccessMask = dstAccessMask;
+    barrier->oldLayout = oldLayout;
+    barrier->newLayout = newLayout;
+    barrier->srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier->dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier->image = resource.imageResource;
+    barrier->subresourceRange.aspectMask = getImageAspect(resource.resourceDescription.usage);
+    setImageBarrierMips(*barrier, baseMip, endMip, trackedMipCount);
+    barrier->subresourceRange.baseArrayLayer = 0;
+    barrier->subresourceRange.layerCount = VK_REMAINING_ARRAY_LAYERS;
+}
 
-        FfxResourceStates& curState = backendContext->pResources[resource->internalIndex].currentState;
+static void addTransition(BackendContext_VK* backendContext, const BackendContext_VK::Resource& resource, FfxResourceStates curState, FfxResourceStates newState, uint32_t baseMip, uint32_t mipCount)
+{
+    constexpr VkAccessFlags writeAccessMask = VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_HOST_WRITE_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
 
-        barrier->sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
-        barrier->pNext = nullptr;
-        barrier->srcAccessMask = getVKAccessFlagsFromResourceState(curState);
-        barrier->dstAccessMask = getVKAccessFlagsFromResourceState(newState);
-        barrier->srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        barrier->dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        barrier->buffer = vkResource;
-        barrier->offset = 0;
-        barrier->size = VK_WHOLE_SIZE;
+    const VkAccessFlags        srcAccessMask = getVKAccessFlagsFromResourceState(curState);
+    const VkAccessFlags        dstAccessMask = getVKAccessFlagsFromResourceState(newState);
+    const VkPipelineStageFlags srcStageMask  = getVKPipelineStageFlagsFromResourceState(curState);
+    const VkPipelineStageFlags dstStageMask  = getVKPipelineStageFlagsFromResourceState(newState);
 
-        backendContext->srcStageMask |= getVKPipelineStageFlagsFromResourceState(curState);
-        backendContext->dstStageMask |= getVKPipelineStageFlagsFromResourceState(newState);
+    const bool isBuffer = resource.resourceDescription.type == FFX_RESOURCE_TYPE_BUFFER;
+    const bool keepsLayout = isBuffer || (!resource.undefined && getVKImageLayoutFromResourceState(curState) == getVKImageLayoutFromResourceState(newState));
 
-        curState = newState;
+    if (keepsLayout)
+    {
+        // reads following identical reads need no dependency at all
+        if (srcAccessMask == dstAccessMask && srcStageMask == dstStageMask && !(srcAccessMask & writeAccessMask))
+            return;
 
-        ++backendContext->scheduledBufferBarrierCount;
+        backendContext->memoryBarrierSrcAccessMask |= srcAccessMask;
+        backendContext->memoryBarrierDstAccessMask |= dstAccessMask;
+        backendContext->memoryBarrierScheduled = true;
     }
     else
     {
-        VkImage vkResource = ffxResource.imageResource;
-        VkImageMemoryBarrier* barrier = &backendContext->imageMemoryBarriers[backendContext->scheduledImageBarrierCount];
+        const VkImageLayout oldLayout = resource.undefined ? VK_IMAGE_LAYOUT_UNDEFINED : getVKImageLayoutFromResourceState(curState);
+        addImageBarrier(backendContext, resource, oldLayout, getVKImageLayoutFromResourceState(newState), srcAccessMask, dstAccessMask, baseMip, mipCount);
+    }
 
-        FfxResourceStates& curState = backendContext->pResources[resource->internalIndex].currentState;
+    backendContext->srcStageMask |= srcStageMask;
+    backendContext->dstStageMask |= dstStageMask;
+}
 
-        VkImageSubresourceRange range;
-        range.aspectMask = getImageAspect(ffxResource.resourceDescription.usage);
-        range.baseMipLevel = 0;
-        range.levelCount = VK_REMAINING_MIP_LEVELS;
-        range.baseArrayLayer = 0;
-        range.layerCount = VK_REMAINING_ARRAY_LAYERS;
+void addBarrier(BackendContext_VK* backendContext, FfxResourceInternal* resource, FfxResourceStates newState, uint32_t mip = ALL_MIP_LEVELS)
+{
+    FFX_ASSERT(NULL != backendContext);
+    FFX_ASSERT(NULL != resource);
 
-        barrier->sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-        barrier->pNext = nullptr;
-        barrier->srcAccessMask = getVKAccessFlagsFromResourceState(curState);
-        barrier->dstAccessMask = getVKAccessFlagsFromResourceState(newState);
-        barrier->oldLayout = ffxResource.undefined ? VK_IMAGE_LAYOUT_UNDEFINED : getVKImageLayoutFromResourceState(curState);
-        barrier->newLayout = getVKImageLayoutFromResourceState(newState);
-        barrier->srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        barrier->dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        barrier->image = vkResource;
-        barrier->subresourceRange = range;
+    BackendContext_VK::Resource& ffxResource = backendContext->pResources[resource->internalIndex];
 
-        backendContext->srcStageMask |= getVKPipelineStageFlagsFromResourceState(curState);
-        backendContext->dstStageMask |= getVKPipelineStageFlagsFromResourceState(newState);
+    // undefined contents are always initialized as a whole
+    const uint32_t trackedMipCount = getTrackedMipCount(ffxResource);
+    uint32_t       baseMip         = 0;
+    uint32_t       mipCount        = trackedMipCount;
+    if (mip != ALL_MIP_LEVELS && !ffxResource.undefined)
+    {
+        baseMip  = FFX_MINIMUM(mip, trackedMipCount - 1);
+        mipCount = 1;
+    }
 
-        curState = newState;
+    // emit one transition per run of mips sharing a state
+    uint32_t runStart = baseMip;
+    for (uint32_t currentMip = baseMip + 1; currentMip <= baseMip + mipCount; ++currentMip)
+    {
+        const FfxResourceStates runState = getSubresourceState(ffxResource, runStart);
+        if (currentMip < baseMip + mipCount && getSubresourceState(ffxResource, currentMip) == runState)
+            continue;
 
-        ++backendContext->scheduledImageBarrierCount;
+        addTransition(backendContext, ffxResource, runState, newState, runStart, currentMip - runStart);
+        runStart = currentMip;
     }
 
+    setSubresourceStates(ffxResource, baseMip, mipCount, newState);
+
     if (ffxResource.undefined)
         ffxResource.undefined = false;
 }
@@ -1222,129 +1395,227 @@ void flushBarriers(BackendContext_VK* backendContext, VkCommandBuffer vkCommandB
     FFX_ASSERT(NULL != backendContext);
     FFX_ASSERT(NULL != vkCommandBuffer);
 
-    if (backendContext->scheduledImageBarrierCount > 0 || backendContext->scheduledBufferBarrierCount > 0)
+    if (backendContext->scheduledImageBarrierCount > 0 || backendContext->memoryBarrierScheduled)
     {
-        backendContext->vkFunctionTable.vkCmdPipelineBarrier(vkCommandBuffer, backendContext->srcStageMask, backendContext->dstStageMask, VK_DEPENDENCY_BY_REGION_BIT, 0, nullptr, backendContext->scheduledBufferBarrierCount, backendContext->bufferMemoryBarriers, backendContext->scheduledImageBarrierCount, backendContext->imageMemoryBarriers);
+        VkMemoryBarrier memoryBarrier = {};
+        memoryBarrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        memoryBarrier.srcAccessMask   = backendContext->memoryBarrierSrcAccessMask;
+        memoryBarrier.dstAccessMask   = backendContext->memoryBarrierDstAccessMask;
+
+        backendContext->vkFunctionTable.vkCmdPipelineBarrier(vkCommandBuffer, backendContext->srcStageMask, backendContext->dstStageMask, VK_DEPENDENCY_BY_REGION_BIT,
+            backendContext->memoryBarrierScheduled ? 1 : 0, &memoryBarrier, 0, nullptr, backendContext->scheduledImageBarrierCount, backendContext->imageMemoryBarriers);
         backendContext->scheduledImageBarrierCount = 0;
-        backendContext->scheduledBufferBarrierCount = 0;
+        backendContext->memoryBarrierSrcAccessMask = 0;
+        backendContext->memoryBarrierDstAccessMask = 0;
+        backendContext->memoryBarrierScheduled = false;
         backendContext->srcStageMask = 0;
         backendContext->dstStageMask = 0;
     }
 }
 
-FfxConstantAllocation BackendContext_VK::FallbackConstantAllocator(void* data, FfxUInt64 dataSize)
+FfxConstantAllocation BackendContext_VK::FallbackConstantAllocator(void* data, FfxUInt64 dataSize, FfxUInt32 effectContextId)
 {
-    FfxConstantAllocation       allocation;
-    std::lock_guard<std::mutex> cbLock{uniformBufferMutex};
+    FfxConstantAllocation allocation;
 
-    if (!uniformBufferMem)
-    {
-        // allocate dynamic uniform buffer
+    // the uniform buffer is created along with the first effect context
+    FFX_ASSERT(uniformBufferMem);
+
+    allocation.resource.resource = uniformBuffer;
+    allocation.handle            = 0;
 
-        // get alignment
-        VkPhysicalDeviceProperties physicalDeviceProperties = {};
-        vkGetPhysicalDeviceProperties(physicalDevice, &physicalDeviceProperties);
-        uniformBufferAlignment = physicalDeviceProperties.limits.minUniformBufferOffsetAlignment;
+    if (data)
+    {
+        uint64_t offset = constantRing.allocate(effectContextId, dataSize);
+        if (offset == FFX_CONSTANT_RING_INVALID_OFFSET)
+        {
+            // every block still holds constants of a queued frame, wait for the GPU so all recorded frames retire
+            vkFunctionTable.vkDeviceWaitIdle(device);
+            constantRing.retireSubmittedFrames();
+            offset = constantRing.allocate(effectContextId, dataSize);
+        }
 
-        uniformBufferSize = FFX_ALIGN_UP(FFX_BUFFER_SIZE, uniformBufferAlignment) * maxEffectContexts * FFX_MAX_PASS_COUNT * FFX_MAX_QUEUED_FRAMES;
+        FFX_ASSERT_MESSAGE(offset != FFX_CONSTANT_RING_INVALID_OFFSET, "FFXInterface: Vulkan: Out of constant buffer memory.");
+        if (offset == FFX_CONSTANT_RING_INVALID_OFFSET)
+            return allocation;
 
-        VkBufferCreateInfo bufferInfo = {};
-        bufferInfo.sType              = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-        bufferInfo.size               = static_cast<VkDeviceSize>(uniformBufferSize);
-        bufferInfo.usage              = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
-        bufferInfo.sharingMode        = VK_SHARING_MODE_EXCLUSIVE;
+        allocation.handle = static_cast<FfxUInt64>(offset);
 
-        VkResult res = vkFunctionTable.vkCreateBuffer(device, &bufferInfo, NULL, &uniformBuffer);
-        FFX_ASSERT(res == VK_SUCCESS);
+        void* pBuffer = (void*)((uint8_t*)(uniformBufferMem) + offset);
+        memcpy(pBuffer, data, dataSize);
 
-        VkMemoryAllocateInfo allocInfo = {};
-        if (res == VK_SUCCESS)
+        // flush mapped range if memory type is not coherent
+        if ((uniformBufferMemoryProperties & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) == 0)
         {
-            // allocate memory block for all uniform buffers
-            VkMemoryRequirements memRequirements = {};
-            vkFunctionTable.vkGetBufferMemoryRequirements(device, uniformBuffer, &memRequirements);
+            VkMappedMemoryRange memoryRange;
+            memset(&memoryRange, 0, sizeof(memoryRange));
 
-            // this is the real alignment
-            uniformBufferAlignment = memRequirements.alignment;
+            memoryRange.sType  = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+            memoryRange.memory = uniformBufferMemory;
+            memoryRange.offset = offset;
+            memoryRange.size   = FFX_ALIGN_UP(dataSize, uniformBufferAlignment);
 
-            VkMemoryPropertyFlags requiredMemoryProperties = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+            vkFunctionTable.vkFlushMappedMemoryRanges(device, 1, &memoryRange);
+        }
+    }
 
-            allocInfo.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-            allocInfo.allocationSize  = uniformBufferSize;
-            allocInfo.memoryTypeIndex = findMemoryTypeIndex(physicalDevice, memRequirements, requiredMemoryProperties, uniformBufferMemoryProperties);
+    return allocation;
+}
 
-            if (allocInfo.memoryTypeIndex == UINT32_MAX)
-            {
-                requiredMemoryProperties  = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
-                allocInfo.memoryTypeIndex = findMemoryTypeIndex(physicalDevice, memRequirements, requiredMemoryProperties, uniformBufferMemoryProperties);
+void resetBackendContext(BackendContext_VK* backendContext)
+{
+    // reset the context except the maxEffectContexts and pipeline cache data in case the memory is reused for a new context
+    uint32_t    maxEffectContexts        = backendContext->maxEffectContexts;
+    const void* pipelineCacheData        = backendContext->pipelineCacheData;
+    size_t      pipelineCacheDataSize    = backendContext->pipelineCacheDataSize;
+    void*       pipelineCacheStorage     = backendContext->pipelineCacheStorage;
+    size_t      pipelineCacheStorageSize = backendContext->pipelineCacheStorageSize;
 
-                if (allocInfo.memoryTypeIndex == UINT32_MAX)
-                    res = VK_ERROR_INITIALIZATION_FAILED;
-            }
-        }
+    memset(backendContext, 0, sizeof(BackendContext_VK));
 
-        if (res == VK_SUCCESS)
-            res = vkFunctionTable.vkAllocateMemory(device, &allocInfo, nullptr, &uniformBufferMemory);
-        FFX_ASSERT(res == VK_SUCCESS);
+    // restore the maxEffectContexts and pipeline cache data
+    backendContext->maxEffectContexts        = maxEffectContexts;
+    backendContext->pipelineCacheData        = pipelineCacheData;
+    backendContext->pipelineCacheDataSize    = pipelineCacheDataSize;
+    backendContext->pipelineCacheStorage     = pipelineCacheStorage;
+    backendContext->pipelineCacheStorageSize = pipelineCacheStorageSize;
+}
 
-        if (res == VK_SUCCESS)
-            res = vkFunctionTable.vkBindBufferMemory(device, uniformBuffer, uniformBufferMemory, 0);
-        FFX_ASSERT(res == VK_SUCCESS);
+static bool isPipelineCacheDataCompatible(BackendContext_VK* backendContext, const void* data, size_t dataSize)
+{
+    // Data from another driver or device would be discarded by the implementation anyway, so skip the work
+    VkPipelineCacheHeaderVersionOne header;
+    if (!data || dataSize < sizeof(header))
+        return false;
+    memcpy(&header, data, sizeof(header));
 
-        // map the memory block
-        if (res == VK_SUCCESS)
-            res = vkFunctionTable.vkMapMemory(device, uniformBufferMemory, 0, uniformBufferSize, 0, &uniformBufferMem);
-        FFX_ASSERT(res == VK_SUCCESS);
+    VkPhysicalDeviceProperties physicalDeviceProperties = {};
+    vkGetPhysicalDeviceProperties(backendContext->physicalDevice, &physicalDeviceProperties);
+
+    return header.headerSize >= sizeof(header) && header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+           header.vendorID == physicalDeviceProperties.vendorID && header.deviceID == physicalDeviceProperties.deviceID &&
+           memcmp(header.pipelineCacheUUID, physicalDeviceProperties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+
+static FfxErrorCode createPipelineCache(BackendContext_VK* backendContext, const void* data, size_t dataSize, VkPipelineCache* outPipelineCache)
+{
+    VkPipelineCacheCreateInfo createInfo = {};
+    createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    if (isPipelineCacheDataCompatible(backendContext, data, dataSize))
+    {
+        createInfo.initialDataSize = dataSize;
+        createInfo.pInitialData    = data;
     }
 
-    FFX_ASSERT(uniformBufferMem);
+    if (backendContext->vkFunctionTable.vkCreatePipelineCache(backendContext->device, &createInfo, nullptr, outPipelineCache) != VK_SUCCESS)
+        return FFX_ERROR_BACKEND_API_ERROR;
 
-    allocation.resource.resource = uniformBuffer;
-    allocation.handle            = 0;
+    return FFX_OK;
+}
 
-    if (data)
+static void retainPipelineCacheData(BackendContext_VK* backendContext)
+{
+    backendContext->pipelineCacheData     = nullptr;
+    backendContext->pipelineCacheDataSize = 0;
+    if (!backendContext->pipelineCacheStorage)
+        return;
+
+    // a cache larger than the storage is truncated, which vkGetPipelineCacheData guarantees still yields valid initial data
+    size_t   dataSize = backendContext->pipelineCacheStorageSize;
+    VkResult result   = backendContext->vkFunctionTable.vkGetPipelineCacheData(backendContext->device, backendContext->pipelineCache, &dataSize, backendContext->pipelineCacheStorage);
+    if (result == VK_SUCCESS || result == VK_INCOMPLETE)
     {
-        if (uniformBufferOffset + dataSize >= uniformBufferSize)
-            uniformBufferOffset = 0;
+        backendContext->pipelineCacheData     = backendContext->pipelineCacheStorage;
+        backendContext->pipelineCacheDataSize = dataSize;
+    }
+}
 
-        allocation.handle = static_cast<FfxUInt64>(uniformBufferOffset);
+FfxErrorCode ffxSetPipelineCacheDataVK(FfxInterface* backendInterface, const void* data, size_t dataSize)
+{
+    FFX_RETURN_ON_ERROR(backendInterface && backendInterface->scratchBuffer, FFX_ERROR_INVALID_POINTER);
+    BackendContext_VK* backendContext = (BackendContext_VK*)backendInterface->scratchBuffer;
 
-        void* pBuffer = (void*)((uint8_t*)(uniformBufferMem) + uniformBufferOffset);
-        memcpy(pBuffer, data, dataSize);
+    if (!data || !dataSize)
+    {
+        if (!backendContext->refCount)
+        {
+            backendContext->pipelineCacheData     = nullptr;
+            backendContext->pipelineCacheDataSize = 0;
+        }
+        return FFX_OK;
+    }
 
-        // TODO: ensure that we aren't writing on some used memory
+    // no live cache yet, refer to the application's data until the first context is created
+    if (!backendContext->refCount)
+    {
+        backendContext->pipelineCacheData     = data;
+        backendContext->pipelineCacheDataSize = dataSize;
+        return FFX_OK;
+    }
 
-        // flush mapped range if memory type is not coherent
-        if ((uniformBufferMemoryProperties & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) == 0)
-        {
-            VkMappedMemoryRange memoryRange;
-            memset(&memoryRange, 0, sizeof(memoryRange));
+    if (!isPipelineCacheDataCompatible(backendContext, data, dataSize))
+        return FFX_OK;
 
-            memoryRange.sType  = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-            memoryRange.memory = uniformBufferMemory;
-            memoryRange.offset = uniformBufferOffset;
-            memoryRange.size   = dataSize;
+    VkPipelineCache sourceCache = VK_NULL_HANDLE;
+    FFX_VALIDATE(createPipelineCache(backendContext, data, dataSize, &sourceCache));
+    VkResult result = backendContext->vkFunctionTable.vkMergePipelineCaches(backendContext->device, backendContext->pipelineCache, 1, &sourceCache);
+    backendContext->vkFunctionTable.vkDestroyPipelineCache(backendContext->device, sourceCache, nullptr);
 
-            vkFunctionTable.vkFlushMappedMemoryRanges(device, 1, &memoryRange);
-        }
+    return result == VK_SUCCESS ? FFX_OK : FFX_ERROR_BACKEND_API_ERROR;
+}
 
-        uniformBufferOffset += FFX_ALIGN_UP(dataSize, uniformBufferAlignment);
-        if (uniformBufferOffset > uniformBufferSize)
-            uniformBufferOffset = 0;
+FfxErrorCode ffxSetPipelineCacheStorageVK(FfxInterface* backendInterface, void* storage, size_t storageSize)
+{
+    FFX_RETURN_ON_ERROR(backendInterface && backendInterface->scratchBuffer, FFX_ERROR_INVALID_POINTER);
+    BackendContext_VK* backendContext = (BackendContext_VK*)backendInterface->scratchBuffer;
+
+    // data retained in the previous storage goes away with it
+    if (!backendContext->refCount && backendContext->pipelineCacheData && backendContext->pipelineCacheData == backendContext->pipelineCacheStorage)
+    {
+        backendContext->pipelineCacheData     = nullptr;
+        backendContext->pipelineCacheDataSize = 0;
     }
 
-    return allocation;
+    backendContext->pipelineCacheStorage     = storageSize ? storage : nullptr;
+    backendContext->pipelineCacheStorageSize = storage ? storageSize : 0;
+
+    return FFX_OK;
 }
 
-void resetBackendContext(BackendContext_VK* backendContext)
+FfxErrorCode ffxGetPipelineCacheDataVK(FfxInterface* backendInterface, void* data, size_t* dataSize)
 {
-    // reset the context except the maxEffectContexts in case the memory is reused for a new context
-    uint32_t maxEffectContexts = backendContext->maxEffectContexts;
+    FFX_RETURN_ON_ERROR(backendInterface && backendInterface->scratchBuffer && dataSize, FFX_ERROR_INVALID_POINTER);
+    BackendContext_VK* backendContext = (BackendContext_VK*)backendInterface->scratchBuffer;
 
-    memset(backendContext, 0, sizeof(BackendContext_VK));
+    if (backendContext->refCount)
+    {
+        VkResult result = backendContext->vkFunctionTable.vkGetPipelineCacheData(backendContext->device, backendContext->pipelineCache, dataSize, data);
+        FFX_RETURN_ON_ERROR(result != VK_INCOMPLETE, FFX_ERROR_INSUFFICIENT_MEMORY);
+        return result == VK_SUCCESS ? FFX_OK : FFX_ERROR_BACKEND_API_ERROR;
+    }
+
+    if (!data)
+    {
+        *dataSize = backendContext->pipelineCacheDataSize;
+        return FFX_OK;
+    }
+
+    const size_t copySize = FFX_MINIMUM(*dataSize, backendContext->pipelineCacheDataSize);
+    if (copySize && data != backendContext->pipelineCacheData)
+        memmove(data, backendContext->pipelineCacheData, copySize);
+    *dataSize = copySize;
+
+    return copySize == backendContext->pipelineCacheDataSize ? FFX_OK : FFX_ERROR_INSUFFICIENT_MEMORY;
+}
+
+FfxErrorCode ffxGetConstantRingStatisticsVK(FfxInterface* backendInterface, FfxConstantRingStatistics* statistics)
+{
+    FFX_RETURN_ON_ERROR(backendInterface, FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(statistics, FFX_ERROR_INVALID_POINTER);
+
+    BackendContext_VK* backendContext = (BackendContext_VK*)backendInterface->scratchBuffer;
+    backendContext->constantRing.getStatistics(statistics);
 
-    // restore the maxEffectContexts
-    backendContext->maxEffectContexts = maxEffectContexts;
+    return FFX_OK;
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -1385,7 +1656,7 @@ FfxErrorCode CreateBackendContextVK(FfxInterface* backendInterface, FfxEffect ef
 
         resetBackendContext(backendContext);
 
-        new (&backendContext->uniformBufferMutex) std::mutex();
+        new (&backendContext->constantRing) FfxConstantRing();
 
         // Map all of our pointers
         uint32_t gpuJobDescArraySize   = FFX_ALIGN_UP(backendContext->maxEffectContexts * FFX_MAX_GPU_JOBS * sizeof(FfxGpuJobDescription), sizeof(uint32_t));
@@ -1394,7 +1665,12 @@ FfxErrorCode CreateBackendContextVK(FfxInterface* backendInterface, FfxEffect ef
         uint32_t pipelineArraySize = FFX_ALIGN_UP(backendContext->maxEffectContexts * FFX_MAX_PASS_COUNT * sizeof(BackendContext_VK::PipelineLayout), sizeof(uint32_t));
         uint32_t resourceArraySize = FFX_ALIGN_UP(backendContext->maxEffectContexts * FFX_MAX_RESOURCE_COUNT * sizeof(BackendContext_VK::Resource), sizeof(uint32_t));
         uint32_t contextArraySize = FFX_ALIGN_UP(backendContext->maxEffectContexts * sizeof(BackendContext_VK::EffectContext), sizeof(uint32_t));
-        uint8_t* pMem = (uint8_t*)((BackendContext_VK*)(backendContext + 1));
+        uint32_t constantRingContextArraySize = uint32_t(FfxConstantRing::getContextMemorySize(backendContext->maxEffectContexts));
+        uint8_t* pMem = (uint8_t*)(backendContext + 1);
+
+        // Map constant ring context array first as it holds 64-bit atomics (initialized along with the uniform buffer)
+        backendContext->pConstantRingContexts = pMem;
+        pMem += constantRingContextArraySize;
 
         // Map gpu job array
         backendContext->pGpuJobs = (FfxGpuJobDescription*)pMem;
@@ -1459,6 +1735,10 @@ FfxErrorCode CreateBackendContextVK(FfxInterface* backendInterface, FfxEffect ef
         backendContext->vkFunctionTable.vkCreateShaderModule = (PFN_vkCreateShaderModule)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCreateShaderModule");
         backendContext->vkFunctionTable.vkCreatePipelineLayout = (PFN_vkCreatePipelineLayout)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCreatePipelineLayout");
         backendContext->vkFunctionTable.vkCreateComputePipelines = (PFN_vkCreateComputePipelines)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCreateComputePipelines");
+        backendContext->vkFunctionTable.vkCreatePipelineCache = (PFN_vkCreatePipelineCache)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCreatePipelineCache");
+        backendContext->vkFunctionTable.vkDestroyPipelineCache = (PFN_vkDestroyPipelineCache)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkDestroyPipelineCache");
+        backendContext->vkFunctionTable.vkGetPipelineCacheData = (PFN_vkGetPipelineCacheData)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkGetPipelineCacheData");
+        backendContext->vkFunctionTable.vkMergePipelineCaches = (PFN_vkMergePipelineCaches)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkMergePipelineCaches");
         backendContext->vkFunctionTable.vkDestroyPipelineLayout = (PFN_vkDestroyPipelineLayout)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkDestroyPipelineLayout");
         backendContext->vkFunctionTable.vkDestroyPipeline = (PFN_vkDestroyPipeline)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkDestroyPipeline");
         backendContext->vkFunctionTable.vkDestroyImage = (PFN_vkDestroyImage)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkDestroyImage");
@@ -1470,6 +1750,7 @@ FfxErrorCode CreateBackendContextVK(FfxInterface* backendInterface, FfxEffect ef
         backendContext->vkFunctionTable.vkDestroySampler = (PFN_vkDestroySampler)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkDestroySampler");
         backendContext->vkFunctionTable.vkDestroyShaderModule = (PFN_vkDestroyShaderModule)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkDestroyShaderModule");
         backendContext->vkFunctionTable.vkGetBufferMemoryRequirements = (PFN_vkGetBufferMemoryRequirements)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkGetBufferMemoryRequirements");
+        backendContext->vkFunctionTable.vkDeviceWaitIdle = (PFN_vkDeviceWaitIdle)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkDeviceWaitIdle");
         backendContext->vkFunctionTable.vkGetBufferMemoryRequirements2KHR = (PFN_vkGetBufferMemoryRequirements2KHR)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkGetBufferMemoryRequirements2KHR");
         backendContext->vkFunctionTable.vkGetImageMemoryRequirements = (PFN_vkGetImageMemoryRequirements)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkGetImageMemoryRequirements");
         backendContext->vkFunctionTable.vkAllocateDescriptorSets = (PFN_vkAllocateDescriptorSets)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkAllocateDescriptorSets");
@@ -1481,6 +1762,17 @@ FfxErrorCode CreateBackendContextVK(FfxInterface* backendInterface, FfxEffect ef
         backendContext->vkFunctionTable.vkBindBufferMemory = (PFN_vkBindBufferMemory)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkBindBufferMemory");
         backendContext->vkFunctionTable.vkBindImageMemory = (PFN_vkBindImageMemory)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkBindImageMemory");
         backendContext->vkFunctionTable.vkUpdateDescriptorSets = (PFN_vkUpdateDescriptorSets)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkUpdateDescriptorSets");
+        backendContext->vkFunctionTable.vkCreateDescriptorUpdateTemplate = (PFN_vkCreateDescriptorUpdateTemplate)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCreateDescriptorUpdateTemplate");
+        backendContext->vkFunctionTable.vkDestroyDescriptorUpdateTemplate = (PFN_vkDestroyDescriptorUpdateTemplate)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkDestroyDescriptorUpdateTemplate");
+        backendContext->vkFunctionTable.vkUpdateDescriptorSetWithTemplate = (PFN_vkUpdateDescriptorSetWithTemplate)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkUpdateDescriptorSetWithTemplate");
+
+        // descriptor update templates are core in 1.1, fall back to the extension on 1.0 devices
+        if (!backendContext->vkFunctionTable.vkCreateDescriptorUpdateTemplate || !backendContext->vkFunctionTable.vkDestroyDescriptorUpdateTemplate || !backendContext->vkFunctionTable.vkUpdateDescriptorSetWithTemplate)
+        {
+            backendContext->vkFunctionTable.vkCreateDescriptorUpdateTemplate = (PFN_vkCreateDescriptorUpdateTemplate)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCreateDescriptorUpdateTemplateKHR");
+            backendContext->vkFunctionTable.vkDestroyDescriptorUpdateTemplate = (PFN_vkDestroyDescriptorUpdateTemplate)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkDestroyDescriptorUpdateTemplateKHR");
+            backendContext->vkFunctionTable.vkUpdateDescriptorSetWithTemplate = (PFN_vkUpdateDescriptorSetWithTemplate)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkUpdateDescriptorSetWithTemplateKHR");
+        }
         backendContext->vkFunctionTable.vkCmdPipelineBarrier = (PFN_vkCmdPipelineBarrier)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCmdPipelineBarrier");
         backendContext->vkFunctionTable.vkCmdBindPipeline = (PFN_vkCmdBindPipeline)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCmdBindPipeline");
         backendContext->vkFunctionTable.vkCmdBindDescriptorSets = (PFN_vkCmdBindDescriptorSets)vkDeviceContext->vkDeviceProcAddr(backendContext->device, "vkCmdBindDescriptorSets");
@@ -1508,7 +1800,7 @@ FfxErrorCode CreateBackendContextVK(FfxInterface* backendInterface, FfxEffect ef
             { VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, backendContext->maxEffectContexts * FFX_MAX_RESOURCE_COUNT * FFX_MAX_PASS_COUNT * FFX_MAX_QUEUED_FRAMES * MAX_PIPELINE_USAGE_PER_FRAME },
             { VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, backendContext->maxEffectContexts * FFX_MAX_RESOURCE_COUNT * FFX_MAX_PASS_COUNT * FFX_MAX_QUEUED_FRAMES * MAX_PIPELINE_USAGE_PER_FRAME },
             { VK_DESCRIPTOR_TYPE_SAMPLER, backendContext->maxEffectContexts * FFX_MAX_RESOURCE_COUNT * FFX_MAX_PASS_COUNT * FFX_MAX_QUEUED_FRAMES * MAX_PIPELINE_USAGE_PER_FRAME },
-            { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, backendContext->maxEffectContexts * FFX_MAX_RESOURCE_COUNT * FFX_MAX_PASS_COUNT * FFX_MAX_QUEUED_FRAMES * MAX_PIPELINE_USAGE_PER_FRAME },
+            { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, backendContext->maxEffectContexts * FFX_MAX_RESOURCE_COUNT * FFX_MAX_PASS_COUNT * FFX_MAX_QUEUED_FRAMES * MAX_PIPELINE_USAGE_PER_FRAME },
             { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, backendContext->maxEffectContexts * FFX_MAX_RESOURCE_COUNT * FFX_MAX_PASS_COUNT * FFX_MAX_QUEUED_FRAMES * MAX_PIPELINE_USAGE_PER_FRAME },
         };
 
@@ -1523,6 +1815,13 @@ FfxErrorCode CreateBackendContextVK(FfxInterface* backendInterface, FfxEffect ef
             return FFX_ERROR_BACKEND_API_ERROR;
         }
 
+        // create the pipeline cache, seeded with any data retained from a previous context or provided by the application,
+        // which is not referred to past this point
+        FFX_RETURN_ON_ERROR(createPipelineCache(backendContext, backendContext->pipelineCacheData, backendContext->pipelineCacheDataSize, &backendContext->pipelineCache) == FFX_OK,
+                            FFX_ERROR_BACKEND_API_ERROR);
+        backendContext->pipelineCacheData     = nullptr;
+        backendContext->pipelineCacheDataSize = 0;
+
         // set bindless resource view to base
         backendContext->bindlessBase = (backendContext->maxEffectContexts * FFX_MAX_QUEUED_FRAMES * FFX_MAX_RESOURCE_COUNT * 2);
 
@@ -1601,6 +1900,8 @@ FfxErrorCode CreateBackendContextVK(FfxInterface* backendInterface, FfxEffect ef
             {
                 return FFX_ERROR_BACKEND_API_ERROR;
             }
+
+            backendContext->constantRing.initialize(backendContext->uniformBufferSize, backendContext->uniformBufferAlignment, backendContext->maxEffectContexts, backendContext->pConstantRingContexts);
         }
 
         // Setup Breadcrumbs data
@@ -1970,6 +2271,7 @@ FfxErrorCode GetDeviceCapabilitiesVK(FfxInterface* backendInterface, FfxDeviceCa
     deviceCapabilities->bufferMarkerSupported = false;
     deviceCapabilities->extendedSynchronizationSupported = false;
     deviceCapabilities->shaderStorageBufferArrayNonUniformIndexing = false;
+    deviceCapabilities->compactComputeJobsSupported = true;
 
     BackendContext_VK* context = (BackendContext_VK*)backendInterface->scratchBuffer;
 
@@ -2096,6 +2398,9 @@ FfxErrorCode DestroyBackendContextVK(FfxInterface* backendInterface, FfxUInt32 e
     for (uint32_t frameIndex = 0; frameIndex < FFX_MAX_QUEUED_FRAMES; ++frameIndex)
         destroyDynamicViews(backendContext, effectContextId, frameIndex);
 
+    // the context's constants are no longer in flight either
+    backendContext->constantRing.releaseContext(effectContextId);
+
     // clean up descriptor set layouts
     if (effectContext.bindlessTextureSrvDescriptorSetLayout)
     {
@@ -2144,6 +2449,14 @@ FfxErrorCode DestroyBackendContextVK(FfxInterface* backendInterface, FfxUInt32 e
 
     if (!backendContext->refCount) {
 
+        delete backendContext->pPipelineWorkers;
+        backendContext->pPipelineWorkers = nullptr;
+
+        // retain the pipeline cache contents so the next context creation can reuse them
+        retainPipelineCacheData(backendContext);
+        backendContext->vkFunctionTable.vkDestroyPipelineCache(backendContext->device, backendContext->pipelineCache, VK_NULL_HANDLE);
+        backendContext->pipelineCache = VK_NULL_HANDLE;
+
         // clean up descriptor pool
         backendContext->vkFunctionTable.vkDestroyDescriptorPool(backendContext->device, backendContext->descriptorPool, VK_NULL_HANDLE);
         backendContext->descriptorPool = VK_NULL_HANDLE;
@@ -2222,6 +2535,8 @@ FfxErrorCode CreateResourceVK(
             : createResourceDescription->initialState;
     backendResource->initialState = resourceState;
     backendResource->currentState = resourceState;
+    backendResource->splitMipStates = false;
+    backendResource->generation = ++backendContext->resourceGeneration;
 
 #ifdef _DEBUG
     size_t retval = 0;
@@ -2494,6 +2809,7 @@ FfxErrorCode DestroyResourceVK(FfxInterface* backendInterface, FfxResourceIntern
     if ((resource.internalIndex >= int32_t(effectContextId * FFX_MAX_RESOURCE_COUNT)) && (resource.internalIndex < int32_t(effectContext.nextStaticResource)))
     {
         BackendContext_VK::Resource& backgroundResource = backendContext->pResources[resource.internalIndex];
+        backgroundResource.generation = ++backendContext->resourceGeneration;
 
         if (backgroundResource.resourceDescription.type == FFX_RESOURCE_TYPE_BUFFER)
         {
@@ -2659,6 +2975,10 @@ FfxErrorCode RegisterResourceVK(
 
     copyResourceState(backendResource, inFfxResource);
 
+    // Views of registered resources are recreated by every registration (they live in the per frame view ranges),
+    // so the generation is bumped as well: descriptor sets written for last frame's views must never be reused.
+    backendResource->generation = ++backendContext->resourceGeneration;
+
 #ifdef _DEBUG
     size_t retval = 0;
     wcstombs_s(&retval, backendResource->resourceName, sizeof(backendResource->resourceName), inFfxResource->name, sizeof(backendResource->resourceName));
@@ -2832,6 +3152,9 @@ FfxErrorCode UnregisterResourcesVK(FfxInterface* backendInterface, FfxCommandLis
     effectContext.frameIndex = (effectContext.frameIndex + 1) % FFX_MAX_QUEUED_FRAMES;
     destroyDynamicViews(backendContext, effectContextId, effectContext.frameIndex);
 
+    // constants written this frame retire along with its views
+    backendContext->constantRing.endFrame(effectContextId);
+
     return FFX_OK;
 }
 
@@ -3216,25 +3539,71 @@ VkSamplerAddressMode FfxGetAddressModeVK(const FfxAddressMode& addressMode)
     }
 }
 
-FfxErrorCode CreatePipelineVK(FfxInterface* backendInterface,
-    FfxEffect effect,
-    FfxPass pass,
-    uint32_t permutationOptions,
+// Describes set 0 in the order executeGpuJobCompute gathers descriptors: texture UAVs, buffer UAVs, texture SRVs, buffer SRVs, constant buffers.
+static FfxErrorCode createDescriptorUpdateTemplate(BackendContext_VK* backendContext, const FfxPipelineState* pipeline, BackendContext_VK::PipelineLayout* pPipelineLayout)
+{
+    pPipelineLayout->descriptorUpdateTemplate = VK_NULL_HANDLE;
+
+    // without template support every dispatch goes through vkUpdateDescriptorSets
+    if (!backendContext->vkFunctionTable.vkCreateDescriptorUpdateTemplate)
+        return FFX_OK;
+
+    VkDescriptorUpdateTemplateEntry entries[FFX_MAX_RESOURCE_COUNT];
+    uint32_t                        entryCount = 0;
+
+    auto addEntries = [&](const FfxResourceBinding* bindings, uint32_t bindingCount, VkDescriptorType descriptorType, bool useArrayIndex) {
+        for (uint32_t i = 0; i < bindingCount; ++i)
+        {
+            FFX_ASSERT(entryCount < FFX_MAX_RESOURCE_COUNT);
+            VkDescriptorUpdateTemplateEntry& entry = entries[entryCount];
+            entry.dstBinding      = bindings[i].slotIndex;
+            entry.dstArrayElement = useArrayIndex ? bindings[i].arrayIndex : 0;
+            entry.descriptorCount = 1;
+            entry.descriptorType  = descriptorType;
+            entry.offset          = entryCount * sizeof(DescriptorInfoVK);
+            entry.stride          = sizeof(DescriptorInfoVK);
+            ++entryCount;
+        }
+    };
+
+    addEntries(pipeline->uavTextureBindings, pipeline->uavTextureCount, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, true);
+    addEntries(pipeline->uavBufferBindings, pipeline->uavBufferCount, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, true);
+    addEntries(pipeline->srvTextureBindings, pipeline->srvTextureCount, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, true);
+    addEntries(pipeline->srvBufferBindings, pipeline->srvBufferCount, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, true);
+    addEntries(pipeline->constantBufferBindings, pipeline->constCount, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, false);
+
+    if (!entryCount)
+        return FFX_OK;
+
+    VkDescriptorUpdateTemplateCreateInfo createInfo = {};
+    createInfo.sType                      = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+    createInfo.descriptorUpdateEntryCount = entryCount;
+    createInfo.pDescriptorUpdateEntries   = entries;
+    createInfo.templateType               = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+    createInfo.descriptorSetLayout        = pPipelineLayout->descriptorSetLayout;
+
+    if (backendContext->vkFunctionTable.vkCreateDescriptorUpdateTemplate(backendContext->device, &createInfo, nullptr, &pPipelineLayout->descriptorUpdateTemplate) != VK_SUCCESS)
+        return FFX_ERROR_BACKEND_API_ERROR;
+
+    return FFX_OK;
+}
+
+// Builds the pipeline layout and binding tables. Allocates from shared backend state, so must run serially.
+static FfxErrorCode preparePipelineVK(BackendContext_VK* backendContext,
+    const FfxShaderBlob& shaderBlob,
     const FfxPipelineDescription* pipelineDescription,
     FfxUInt32 effectContextId,
     FfxPipelineState* outPipeline)
 {
-    FFX_ASSERT(NULL != backendInterface);
-    FFX_ASSERT(NULL != pipelineDescription);
-
-    BackendContext_VK* backendContext = (BackendContext_VK*)backendInterface->scratchBuffer;
     BackendContext_VK::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
 
-    // start by fetching the shader blob
-    FfxShaderBlob shaderBlob = { };
-    // WON'T WORK WITH FSR3!!
-    backendInterface->fpGetPermutationBlobByIndex(effect, pass, FFX_BIND_COMPUTE_SHADER_STAGE, permutationOptions, &shaderBlob);
-    FFX_ASSERT(shaderBlob.data && shaderBlob.size);
+    // Each constant buffer is bound with a single dynamic offset (see executeGpuJobCompute), so arrays of constant
+    // buffers are not supported. Checked before anything is created so a rejected pipeline leaks nothing.
+    for (uint32_t cbIndex = 0; cbIndex < shaderBlob.cbvCount; ++cbIndex)
+    {
+        FFX_ASSERT_MESSAGE(shaderBlob.boundConstantBufferCounts[cbIndex] == 1, "FFXInterface: Vulkan: Arrays of constant buffers are not supported.");
+        FFX_RETURN_ON_ERROR(shaderBlob.boundConstantBufferCounts[cbIndex] == 1, FFX_ERROR_INVALID_ARGUMENT);
+    }
 
     //////////////////////////////////////////////////////////////////////////
     // One root signature (or pipeline layout) per pipeline
@@ -3384,11 +3753,11 @@ FfxErrorCode CreatePipelineVK(FfxInterface* backendInterface,
             shaderBlob.boundUAVBufferCounts[uavIndex], shaderStageFlags, nullptr };
     }
 
-    // Constant buffers (uniforms)
+    // Constant buffers (uniforms), validated above
     for (uint32_t cbIndex = 0; cbIndex < shaderBlob.cbvCount; ++cbIndex)
     {
-        layoutBindings[numLayoutBindings++] = { shaderBlob.boundConstantBuffers[cbIndex], VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
-            shaderBlob.boundConstantBufferCounts[cbIndex], shaderStageFlags, nullptr };
+        layoutBindings[numLayoutBindings++] = { shaderBlob.boundConstantBuffers[cbIndex], VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC,
+            1, shaderStageFlags, nullptr };
     }
 
     // Create the descriptor layout
@@ -3415,6 +3784,7 @@ FfxErrorCode CreatePipelineVK(FfxInterface* backendInterface,
         {
             return FFX_ERROR_BACKEND_API_ERROR;
         }
+        pPipelineLayout->descriptorSetHashes[i] = 0;
     }
 
     uint32_t setCount = 0;
@@ -3584,10 +3954,22 @@ FfxErrorCode CreatePipelineVK(FfxInterface* backendInterface,
     //outPipeline->samplerCount      = shaderBlob.samplerCount;
     //outPipeline->rtAccelStructCount= shaderBlob.rtAccelStructCount;
 
+    return createDescriptorUpdateTemplate(backendContext, outPipeline, pPipelineLayout);
+}
+
+// Compiles the pipeline against the shared pipeline cache. Only touches thread-safe Vulkan entry points, so batches run this concurrently.
+static FfxErrorCode compilePipelineVK(BackendContext_VK* backendContext,
+    const FfxDeviceCapabilities& capabilities,
+    FfxEffect effect,
+    uint32_t permutationOptions,
+    const FfxShaderBlob& shaderBlob,
+    const FfxPipelineDescription* pipelineDescription,
+    FfxPipelineState* outPipeline)
+{
+    BackendContext_VK::PipelineLayout* pPipelineLayout = reinterpret_cast<BackendContext_VK::PipelineLayout*>(outPipeline->rootSignature);
+
     //////////////////////////////////////////////////////////////////////////
     // pipeline creation
-    FfxDeviceCapabilities capabilities;
-    backendInterface->fpGetDeviceCapabilities(backendInterface, &capabilities);
 
     // shader module
     VkShaderModule shaderModule = VK_NULL_HANDLE;
@@ -3625,13 +4007,15 @@ FfxErrorCode CreatePipelineVK(FfxInterface* backendInterface,
     pipelineCreateInfo.layout = pPipelineLayout->pipelineLayout;
 
     VkPipeline computePipeline = VK_NULL_HANDLE;
-    if (backendContext->vkFunctionTable.vkCreateComputePipelines(backendContext->device, nullptr, 1, &pipelineCreateInfo, nullptr, &computePipeline) != VK_SUCCESS) {
-        return FFX_ERROR_BACKEND_API_ERROR;
-    }
+    VkResult result = backendContext->vkFunctionTable.vkCreateComputePipelines(backendContext->device, backendContext->pipelineCache, 1, &pipelineCreateInfo, nullptr, &computePipeline);
 
     // done with shader module, so clean up
     backendContext->vkFunctionTable.vkDestroyShaderModule(backendContext->device, shaderModule, nullptr);
 
+    if (result != VK_SUCCESS) {
+        return FFX_ERROR_BACKEND_API_ERROR;
+    }
+
     // set the pipeline
     outPipeline->pipeline = reinterpret_cast<FfxPipeline>(computePipeline);
 
@@ -3641,6 +4025,102 @@ FfxErrorCode CreatePipelineVK(FfxInterface* backendInterface,
     return FFX_OK;
 }
 
+FfxErrorCode CreatePipelineVK(FfxInterface* backendInterface,
+    FfxEffect effect,
+    FfxPass pass,
+    uint32_t permutationOptions,
+    const FfxPipelineDescription* pipelineDescription,
+    FfxUInt32 effectContextId,
+    FfxPipelineState* outPipeline)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    FFX_ASSERT(NULL != pipelineDescription);
+
+    BackendContext_VK* backendContext = (BackendContext_VK*)backendInterface->scratchBuffer;
+
+    // start by fetching the shader blob
+    FfxShaderBlob shaderBlob = { };
+    // WON'T WORK WITH FSR3!!
+    backendInterface->fpGetPermutationBlobByIndex(effect, pass, FFX_BIND_COMPUTE_SHADER_STAGE, permutationOptions, &shaderBlob);
+    FFX_ASSERT(shaderBlob.data && shaderBlob.size);
+    FfxScopedPermutationBlob scopedShaderBlob = { &shaderBlob };
+
+    FFX_VALIDATE(preparePipelineVK(backendContext, shaderBlob, pipelineDescription, effectContextId, outPipeline));
+
+    FfxDeviceCapabilities capabilities;
+    backendInterface->fpGetDeviceCapabilities(backendInterface, &capabilities);
+
+    return compilePipelineVK(backendContext, capabilities, effect, permutationOptions, shaderBlob, pipelineDescription, outPipeline);
+}
+
+FfxErrorCode CreatePipelinesVK(FfxInterface* backendInterface,
+    FfxEffect effect,
+    const FfxPipelineCreateDescription* pipelineCreateDescriptions,
+    uint32_t pipelineCount,
+    FfxUInt32 effectContextId)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    FFX_ASSERT(NULL != pipelineCreateDescriptions || !pipelineCount);
+
+    BackendContext_VK* backendContext = (BackendContext_VK*)backendInterface->scratchBuffer;
+
+    // blobs stay pinned until all workers are done with them
+    std::vector<FfxShaderBlob> shaderBlobs(pipelineCount);
+    struct ScopedPermutationBlobs
+    {
+        std::vector<FfxShaderBlob>& blobs;
+        ~ScopedPermutationBlobs() { for (const FfxShaderBlob& blob : blobs) ffxReleasePermutationBlob(&blob); }
+    } scopedShaderBlobs = { shaderBlobs };
+
+    // layouts and descriptor sets come from shared pools, so set those up serially
+    for (uint32_t i = 0; i < pipelineCount; ++i)
+    {
+        const FfxPipelineCreateDescription& desc = pipelineCreateDescriptions[i];
+        FFX_ASSERT(NULL != desc.pipelineDescription && NULL != desc.outPipeline);
+
+        backendInterface->fpGetPermutationBlobByIndex(effect, desc.pass, FFX_BIND_COMPUTE_SHADER_STAGE, desc.permutationOptions, &shaderBlobs[i]);
+        FFX_ASSERT(shaderBlobs[i].data && shaderBlobs[i].size);
+
+        FFX_VALIDATE(preparePipelineVK(backendContext, shaderBlobs[i], desc.pipelineDescription, effectContextId, desc.outPipeline));
+    }
+
+    FfxDeviceCapabilities capabilities;
+    backendInterface->fpGetDeviceCapabilities(backendInterface, &capabilities);
+
+    // shader compilation dominates, fan it out across workers pulling from a shared index
+    std::atomic<uint32_t>     nextPipeline = { 0 };
+    std::atomic<FfxErrorCode> firstError   = { FFX_OK };
+    auto compileWorker = [&]() {
+        for (uint32_t i = nextPipeline++; i < pipelineCount; i = nextPipeline++)
+        {
+            const FfxPipelineCreateDescription& desc = pipelineCreateDescriptions[i];
+            FfxErrorCode errorCode = compilePipelineVK(backendContext, capabilities, effect, desc.permutationOptions, shaderBlobs[i], desc.pipelineDescription, desc.outPipeline);
+            if (errorCode != FFX_OK)
+            {
+                FfxErrorCode expected = FFX_OK;
+                firstError.compare_exchange_strong(expected, errorCode);
+            }
+        }
+    };
+
+    if (pipelineCount < 2)
+    {
+        compileWorker();
+        return firstError.load();
+    }
+
+    // the workers are started with the first batch and live as long as the effect contexts do. The calling thread
+    // takes part too, so there is one worker fewer than there are hardware threads
+    if (!backendContext->pPipelineWorkers)
+    {
+        const uint32_t hardwareThreads = std::thread::hardware_concurrency();
+        backendContext->pPipelineWorkers = new FfxWorkerPool(hardwareThreads > 1 ? hardwareThreads - 1 : 0);
+    }
+    backendContext->pPipelineWorkers->run(compileWorker);
+
+    return firstError.load();
+}
+
 FfxErrorCode DestroyPipelineVK(FfxInterface* backendInterface, FfxPipelineState* pipeline, FfxUInt32 effectContextId)
 {
     FFX_ASSERT(backendInterface != nullptr);
@@ -3671,10 +4151,17 @@ FfxErrorCode DestroyPipelineVK(FfxInterface* backendInterface, FfxPipelineState*
             pPipelineLayout->pipelineLayout = VK_NULL_HANDLE;
         }
 
+        // Descriptor update template
+        if (pPipelineLayout->descriptorUpdateTemplate != VK_NULL_HANDLE) {
+            backendContext->vkFunctionTable.vkDestroyDescriptorUpdateTemplate(backendContext->device, pPipelineLayout->descriptorUpdateTemplate, VK_NULL_HANDLE);
+            pPipelineLayout->descriptorUpdateTemplate = VK_NULL_HANDLE;
+        }
+
         // Descriptor sets
         for (uint32_t i = 0; i < FFX_MAX_QUEUED_FRAMES * MAX_PIPELINE_USAGE_PER_FRAME; i++) {
             backendContext->vkFunctionTable.vkFreeDescriptorSets(backendContext->device, backendContext->descriptorPool, 1, &pPipelineLayout->descriptorSets[i]);
             pPipelineLayout->descriptorSets[i] = VK_NULL_HANDLE;
+            pPipelineLayout->descriptorSetHashes[i] = 0;
         }
 
         // Descriptor set layout
@@ -3705,50 +4192,71 @@ FfxErrorCode ScheduleGpuJobVK(FfxInterface* backendInterface, const FfxGpuJobDes
 
     FFX_ASSERT(backendContext->gpuJobCount < FFX_MAX_GPU_JOBS);
 
-    backendContext->pGpuJobs[backendContext->gpuJobCount] = *job;
+    if (job->jobType == FFX_GPU_JOB_COMPUTE_COMPACT)
+        ffxStoreCompactComputeJob(&backendContext->pGpuJobs[backendContext->gpuJobCount], job);
+    else
+        backendContext->pGpuJobs[backendContext->gpuJobCount] = *job;
     backendContext->gpuJobCount++;
 
     return FFX_OK;
 }
 
-static FfxErrorCode executeGpuJobCompute(BackendContext_VK*    backendContext,
-                                         FfxGpuJobDescription* job,
-                                         VkCommandBuffer       vkCommandBuffer,
-                                         FfxUInt32             effectContextId)
+static FfxErrorCode executeGpuJobCompute(BackendContext_VK* backendContext,
+                                         FfxComputeJobView& job,
+                                         VkCommandBuffer    vkCommandBuffer,
+                                         FfxUInt32          effectContextId)
 {
-    BackendContext_VK::PipelineLayout* pipelineLayout = reinterpret_cast<BackendContext_VK::PipelineLayout*>(job->computeJobDescriptor.pipeline.rootSignature);
+    BackendContext_VK::PipelineLayout* pipelineLayout = reinterpret_cast<BackendContext_VK::PipelineLayout*>(job.pipeline->rootSignature);
 
-    // bind texture & buffer UAVs (note the binding order here MUST match the root signature mapping order from CreatePipeline!)
-    uint32_t               descriptorWriteIndex = 0;
-    VkWriteDescriptorSet   writeDescriptorSets[FFX_MAX_RESOURCE_COUNT];
+    // gather descriptors in update template order (see createDescriptorUpdateTemplate), null resources leave their slot unwritten
+    uint32_t             descriptorCount = 0;
+    DescriptorInfoVK     descriptorInfos[FFX_MAX_RESOURCE_COUNT];
+    uint64_t             resourceGenerations[FFX_MAX_RESOURCE_COUNT];
+    bool                 hasNullDescriptor = false;
 
-    // These MUST be initialized
-    uint32_t               imageDescriptorIndex = 0;
-    VkDescriptorImageInfo  imageDescriptorInfos[FFX_MAX_RESOURCE_COUNT];
-    for (int i = 0; i < FFX_MAX_RESOURCE_COUNT; ++i)
-        imageDescriptorInfos[i] = { VK_NULL_HANDLE, VK_NULL_HANDLE, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL };
+    uint32_t             descriptorWriteIndex = 0;
+    VkWriteDescriptorSet writeDescriptorSets[FFX_MAX_RESOURCE_COUNT];
 
-    // These MUST be initialized
-    uint32_t               bufferDescriptorIndex = 0;
-    VkDescriptorBufferInfo bufferDescriptorInfos[FFX_MAX_RESOURCE_COUNT];
-    for (int i = 0; i < FFX_MAX_RESOURCE_COUNT; ++i)
-        bufferDescriptorInfos[i] = { VK_NULL_HANDLE, 0, VK_WHOLE_SIZE };
+    auto addDescriptor = [&](VkDescriptorType descriptorType, uint32_t binding, uint32_t arrayElement, uint64_t generation) -> DescriptorInfoVK& {
+        FFX_ASSERT(descriptorCount < FFX_MAX_RESOURCE_COUNT);
+        DescriptorInfoVK& descriptorInfo = descriptorInfos[descriptorCount];
+        memset(&descriptorInfo, 0, sizeof(descriptorInfo));
+        resourceGenerations[descriptorCount++] = generation;
+
+        VkWriteDescriptorSet& writeDescriptorSet = writeDescriptorSets[descriptorWriteIndex++];
+        writeDescriptorSet                 = {};
+        writeDescriptorSet.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writeDescriptorSet.descriptorCount = 1;
+        writeDescriptorSet.descriptorType  = descriptorType;
+        writeDescriptorSet.pImageInfo      = &descriptorInfo.image;
+        writeDescriptorSet.pBufferInfo     = &descriptorInfo.buffer;
+        writeDescriptorSet.dstBinding      = binding;
+        writeDescriptorSet.dstArrayElement = arrayElement;
+        return descriptorInfo;
+    };
+
+    auto skipDescriptor = [&]() {
+        FFX_ASSERT(descriptorCount < FFX_MAX_RESOURCE_COUNT);
+        memset(&descriptorInfos[descriptorCount], 0, sizeof(DescriptorInfoVK));
+        resourceGenerations[descriptorCount++] = 0;
+        hasNullDescriptor = true;
+    };
 
     // bind texture UAVs
-    for (uint32_t currentPipelineUavIndex = 0; currentPipelineUavIndex < job->computeJobDescriptor.pipeline.uavTextureCount; ++currentPipelineUavIndex)
+    for (uint32_t currentPipelineUavIndex = 0; currentPipelineUavIndex < job.pipeline->uavTextureCount; ++currentPipelineUavIndex)
     {
-        FfxTextureUAV& textureUAV = job->computeJobDescriptor.uavTextures[currentPipelineUavIndex];
+        FfxTextureUAV& textureUAV = job.uavTextures[currentPipelineUavIndex];
 
         // continue if this is a null resource.
-        if (job->computeJobDescriptor.uavTextures[currentPipelineUavIndex].resource.internalIndex == 0)
+        if (textureUAV.resource.internalIndex == 0)
+        {
+            skipDescriptor();
             continue;
+        }
 
-        addBarrier(backendContext, &textureUAV.resource, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
-
-        const FfxResourceBinding binding = job->computeJobDescriptor.pipeline.uavTextureBindings[currentPipelineUavIndex];
+        addBarrier(backendContext, &textureUAV.resource, FFX_RESOURCE_STATE_UNORDERED_ACCESS, textureUAV.mip);
 
-        // where to bind it
-        const uint32_t currentUavResourceIndex = job->computeJobDescriptor.pipeline.uavTextureBindings[currentPipelineUavIndex].slotIndex;
+        const FfxResourceBinding binding = job.pipeline->uavTextureBindings[currentPipelineUavIndex];
 
         // source: UAV of resource to bind
         const uint32_t resourceIndex = textureUAV.resource.internalIndex;
@@ -3757,207 +4265,201 @@ static FfxErrorCode executeGpuJobCompute(BackendContext_VK*    backendContext,
             mipOffset = backendContext->pResources[resourceIndex].resourceDescription.mipCount - 1;
         const uint32_t uavViewIndex  = backendContext->pResources[resourceIndex].uavViewIndex + mipOffset;
 
-        writeDescriptorSets[descriptorWriteIndex]                 = {};
-        writeDescriptorSets[descriptorWriteIndex].sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        writeDescriptorSets[descriptorWriteIndex].dstSet          = pipelineLayout->descriptorSets[pipelineLayout->descriptorSetIndex];
-        writeDescriptorSets[descriptorWriteIndex].descriptorCount = 1;
-        writeDescriptorSets[descriptorWriteIndex].descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
-        writeDescriptorSets[descriptorWriteIndex].pImageInfo      = &imageDescriptorInfos[imageDescriptorIndex];
-        writeDescriptorSets[descriptorWriteIndex].dstBinding      = binding.slotIndex;
-        writeDescriptorSets[descriptorWriteIndex].dstArrayElement = binding.arrayIndex;
-
-        imageDescriptorInfos[imageDescriptorIndex]             = {};
-        imageDescriptorInfos[imageDescriptorIndex].imageLayout = VK_IMAGE_LAYOUT_GENERAL;
-        imageDescriptorInfos[imageDescriptorIndex].imageView   = backendContext->pResourceViews[uavViewIndex].imageView;
-
-        imageDescriptorIndex++;
-        descriptorWriteIndex++;
+        DescriptorInfoVK& descriptorInfo = addDescriptor(VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, binding.slotIndex, binding.arrayIndex, backendContext->pResources[resourceIndex].generation);
+        descriptorInfo.image.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+        descriptorInfo.image.imageView   = backendContext->pResourceViews[uavViewIndex].imageView;
     }
 
     // bind buffer UAVs
-    for (uint32_t currentPipelineUavIndex = 0; currentPipelineUavIndex < job->computeJobDescriptor.pipeline.uavBufferCount; ++currentPipelineUavIndex) 
+    for (uint32_t currentPipelineUavIndex = 0; currentPipelineUavIndex < job.pipeline->uavBufferCount; ++currentPipelineUavIndex) 
     {
-        FfxBufferUAV& bufferUAV = job->computeJobDescriptor.uavBuffers[currentPipelineUavIndex];
+        FfxBufferUAV& bufferUAV = job.uavBuffers[currentPipelineUavIndex];
 
         // continue if this is a null resource.
-        if (job->computeJobDescriptor.uavBuffers[currentPipelineUavIndex].resource.internalIndex == 0)
+        if (bufferUAV.resource.internalIndex == 0)
+        {
+            skipDescriptor();
             continue;
+        }
 
         addBarrier(backendContext, &bufferUAV.resource, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
 
-        const FfxResourceBinding binding = job->computeJobDescriptor.pipeline.uavBufferBindings[currentPipelineUavIndex];
+        const FfxResourceBinding binding = job.pipeline->uavBufferBindings[currentPipelineUavIndex];
 
         // source: UAV of buffer to bind
         const uint32_t resourceIndex = bufferUAV.resource.internalIndex;
 
-        // where to bind it
-        const uint32_t currentUavResourceIndex = job->computeJobDescriptor.pipeline.uavBufferBindings[currentPipelineUavIndex].slotIndex;
-
-        writeDescriptorSets[descriptorWriteIndex] = {};
-        writeDescriptorSets[descriptorWriteIndex].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        writeDescriptorSets[descriptorWriteIndex].dstSet = pipelineLayout->descriptorSets[pipelineLayout->descriptorSetIndex];
-        writeDescriptorSets[descriptorWriteIndex].descriptorCount = 1;
-        writeDescriptorSets[descriptorWriteIndex].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-        writeDescriptorSets[descriptorWriteIndex].pBufferInfo = &bufferDescriptorInfos[bufferDescriptorIndex];
-        writeDescriptorSets[descriptorWriteIndex].dstBinding      = binding.slotIndex;
-        writeDescriptorSets[descriptorWriteIndex].dstArrayElement = binding.arrayIndex;
-
-        bufferDescriptorInfos[bufferDescriptorIndex] = {};
-        bufferDescriptorInfos[bufferDescriptorIndex].buffer = backendContext->pResources[resourceIndex].bufferResource;
-        bufferDescriptorInfos[bufferDescriptorIndex].offset = bufferUAV.offset;
-        bufferDescriptorInfos[bufferDescriptorIndex].range  = bufferUAV.size > 0 ? bufferUAV.size : VK_WHOLE_SIZE;
-
-        bufferDescriptorIndex++;
-        descriptorWriteIndex++;
+        DescriptorInfoVK& descriptorInfo = addDescriptor(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, binding.slotIndex, binding.arrayIndex, backendContext->pResources[resourceIndex].generation);
+        descriptorInfo.buffer.buffer = backendContext->pResources[resourceIndex].bufferResource;
+        descriptorInfo.buffer.offset = bufferUAV.offset;
+        descriptorInfo.buffer.range  = bufferUAV.size > 0 ? bufferUAV.size : VK_WHOLE_SIZE;
     }
 
     // bind texture SRVs
-    for (uint32_t currentPipelineSrvIndex = 0; currentPipelineSrvIndex < job->computeJobDescriptor.pipeline.srvTextureCount; ++currentPipelineSrvIndex)
+    for (uint32_t currentPipelineSrvIndex = 0; currentPipelineSrvIndex < job.pipeline->srvTextureCount; ++currentPipelineSrvIndex)
     {
-        FfxTextureSRV& textureSRV = job->computeJobDescriptor.srvTextures[currentPipelineSrvIndex];
+        FfxTextureSRV& textureSRV = job.srvTextures[currentPipelineSrvIndex];
 
         // continue if this is a null resource.
-        if (job->computeJobDescriptor.srvTextures[currentPipelineSrvIndex].resource.internalIndex == 0)
+        if (textureSRV.resource.internalIndex == 0)
+        {
+            skipDescriptor();
             continue;
+        }
 
         addBarrier(backendContext, &textureSRV.resource, FFX_RESOURCE_STATE_COMPUTE_READ);
 
-        const FfxResourceBinding binding = job->computeJobDescriptor.pipeline.srvTextureBindings[currentPipelineSrvIndex];
-
-        // where to bind it
-        const uint32_t currentSrvResourceIndex = job->computeJobDescriptor.pipeline.srvTextureBindings[currentPipelineSrvIndex].slotIndex;
-
-        writeDescriptorSets[descriptorWriteIndex]                 = {};
-        writeDescriptorSets[descriptorWriteIndex].sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        writeDescriptorSets[descriptorWriteIndex].dstSet          = pipelineLayout->descriptorSets[pipelineLayout->descriptorSetIndex];
-        writeDescriptorSets[descriptorWriteIndex].descriptorCount = 1;
-        writeDescriptorSets[descriptorWriteIndex].descriptorType  = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
-        writeDescriptorSets[descriptorWriteIndex].pImageInfo      = &imageDescriptorInfos[imageDescriptorIndex];
-        writeDescriptorSets[descriptorWriteIndex].dstBinding      = binding.slotIndex;
-        writeDescriptorSets[descriptorWriteIndex].dstArrayElement = binding.arrayIndex;
+        const FfxResourceBinding binding = job.pipeline->srvTextureBindings[currentPipelineSrvIndex];
 
         const uint32_t resourceIndex = textureSRV.resource.internalIndex;
         const uint32_t srvViewIndex  = backendContext->pResources[resourceIndex].srvViewIndex;
 
-        imageDescriptorInfos[imageDescriptorIndex]             = {};
-        imageDescriptorInfos[imageDescriptorIndex].imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-        imageDescriptorInfos[imageDescriptorIndex].imageView   = backendContext->pResourceViews[srvViewIndex].imageView;
-
-        imageDescriptorIndex++;
-        descriptorWriteIndex++;
+        DescriptorInfoVK& descriptorInfo = addDescriptor(VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, binding.slotIndex, binding.arrayIndex, backendContext->pResources[resourceIndex].generation);
+        descriptorInfo.image.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        descriptorInfo.image.imageView   = backendContext->pResourceViews[srvViewIndex].imageView;
     }
 
     // bind buffer SRVs
-    for (uint32_t currentPipelineSrvIndex = 0; currentPipelineSrvIndex < job->computeJobDescriptor.pipeline.srvBufferCount; ++currentPipelineSrvIndex)
+    for (uint32_t currentPipelineSrvIndex = 0; currentPipelineSrvIndex < job.pipeline->srvBufferCount; ++currentPipelineSrvIndex)
     {
-        FfxBufferSRV& bufferSRV = job->computeJobDescriptor.srvBuffers[currentPipelineSrvIndex];
+        FfxBufferSRV& bufferSRV = job.srvBuffers[currentPipelineSrvIndex];
 
         // continue if this is a null resource.
-        if (job->computeJobDescriptor.srvBuffers[currentPipelineSrvIndex].resource.internalIndex == 0)
+        if (bufferSRV.resource.internalIndex == 0)
+        {
+            skipDescriptor();
             continue;
+        }
 
         addBarrier(backendContext, &bufferSRV.resource, FFX_RESOURCE_STATE_COMPUTE_READ);
 
-        const FfxResourceBinding binding = job->computeJobDescriptor.pipeline.srvBufferBindings[currentPipelineSrvIndex];
+        const FfxResourceBinding binding = job.pipeline->srvBufferBindings[currentPipelineSrvIndex];
 
         // source: SRV of buffer to bind
         const uint32_t resourceIndex = bufferSRV.resource.internalIndex;
 
-        // where to bind it
-        const uint32_t currentSrvResourceIndex = job->computeJobDescriptor.pipeline.srvBufferBindings[currentPipelineSrvIndex].slotIndex;
-
-        writeDescriptorSets[descriptorWriteIndex]                 = {};
-        writeDescriptorSets[descriptorWriteIndex].sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        writeDescriptorSets[descriptorWriteIndex].dstSet          = pipelineLayout->descriptorSets[pipelineLayout->descriptorSetIndex];
-        writeDescriptorSets[descriptorWriteIndex].descriptorCount = 1;
-        writeDescriptorSets[descriptorWriteIndex].descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-        writeDescriptorSets[descriptorWriteIndex].pBufferInfo     = &bufferDescriptorInfos[bufferDescriptorIndex];
-        writeDescriptorSets[descriptorWriteIndex].dstBinding      = binding.slotIndex;
-        writeDescriptorSets[descriptorWriteIndex].dstArrayElement = binding.arrayIndex;
-
-        bufferDescriptorInfos[bufferDescriptorIndex]        = {};
-        bufferDescriptorInfos[bufferDescriptorIndex].buffer = backendContext->pResources[resourceIndex].bufferResource;
-        bufferDescriptorInfos[bufferDescriptorIndex].offset = bufferSRV.offset;
-        bufferDescriptorInfos[bufferDescriptorIndex].range  = bufferSRV.size > 0 ? bufferSRV.size : VK_WHOLE_SIZE;
-    
-        bufferDescriptorIndex++;
-        descriptorWriteIndex++;
+        DescriptorInfoVK& descriptorInfo = addDescriptor(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, binding.slotIndex, binding.arrayIndex, backendContext->pResources[resourceIndex].generation);
+        descriptorInfo.buffer.buffer = backendContext->pResources[resourceIndex].bufferResource;
+        descriptorInfo.buffer.offset = bufferSRV.offset;
+        descriptorInfo.buffer.range  = bufferSRV.size > 0 ? bufferSRV.size : VK_WHOLE_SIZE;
     }
 
-    // update uniform buffers
-    for (uint32_t currentRootConstantIndex = 0; currentRootConstantIndex < job->computeJobDescriptor.pipeline.constCount; ++currentRootConstantIndex)
+    // update uniform buffers, the allocation offset is passed as a dynamic offset so the descriptor itself stays stable
+    uint32_t dynamicOffsets[FFX_MAX_NUM_CONST_BUFFERS];
+    for (uint32_t currentRootConstantIndex = 0; currentRootConstantIndex < job.pipeline->constCount; ++currentRootConstantIndex)
     {
-        uint32_t dataSize = job->computeJobDescriptor.cbs[currentRootConstantIndex].num32BitEntries * sizeof(uint32_t);
+        uint32_t dataSize = job.cbs[currentRootConstantIndex].num32BitEntries * sizeof(uint32_t);
         
         // If we have a constant buffer allocator, use that, otherwise use the default backend allocator
         FfxConstantAllocation allocation;
         if (s_fpConstantAllocator)
-            allocation = s_fpConstantAllocator(job->computeJobDescriptor.cbs[currentRootConstantIndex].data, dataSize);
+            allocation = s_fpConstantAllocator(job.cbs[currentRootConstantIndex].data, dataSize);
         else
-            allocation = backendContext->FallbackConstantAllocator(job->computeJobDescriptor.cbs[currentRootConstantIndex].data, dataSize);
-            
-        writeDescriptorSets[descriptorWriteIndex]                 = {};
-        writeDescriptorSets[descriptorWriteIndex].sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        writeDescriptorSets[descriptorWriteIndex].dstSet          = pipelineLayout->descriptorSets[pipelineLayout->descriptorSetIndex];
-        writeDescriptorSets[descriptorWriteIndex].descriptorCount = 1;
-        writeDescriptorSets[descriptorWriteIndex].descriptorType  = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-        writeDescriptorSets[descriptorWriteIndex].pBufferInfo     = &bufferDescriptorInfos[bufferDescriptorIndex];
-        writeDescriptorSets[descriptorWriteIndex].dstBinding =
-            job->computeJobDescriptor.pipeline.constantBufferBindings[currentRootConstantIndex].slotIndex;
-        writeDescriptorSets[descriptorWriteIndex].dstArrayElement = 0;
-
-        bufferDescriptorInfos[bufferDescriptorIndex].buffer = static_cast<VkBuffer>(allocation.resource.resource);
-        bufferDescriptorInfos[bufferDescriptorIndex].offset = static_cast<VkDeviceSize>(allocation.handle);
-        bufferDescriptorInfos[bufferDescriptorIndex].range  = dataSize;
-
-        bufferDescriptorIndex++;
-        descriptorWriteIndex++;
+            allocation = backendContext->FallbackConstantAllocator(job.cbs[currentRootConstantIndex].data, dataSize, effectContextId);
+
+        const uint32_t binding = job.pipeline->constantBufferBindings[currentRootConstantIndex].slotIndex;
+
+        DescriptorInfoVK& descriptorInfo = addDescriptor(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, binding, 0, 0);
+        descriptorInfo.buffer.buffer = static_cast<VkBuffer>(allocation.resource.resource);
+        descriptorInfo.buffer.offset = 0;
+        descriptorInfo.buffer.range  = dataSize;
+
+        // dynamic offsets are consumed in binding order
+        uint32_t dynamicOffsetIndex = 0;
+        for (uint32_t i = 0; i < job.pipeline->constCount; ++i)
+            dynamicOffsetIndex += (job.pipeline->constantBufferBindings[i].slotIndex < binding) ? 1 : 0;
+        dynamicOffsets[dynamicOffsetIndex] = static_cast<uint32_t>(allocation.handle);
     }
 
     // If we are dispatching indirectly, transition the argument resource to indirect argument
-    if (job->computeJobDescriptor.pipeline.cmdSignature)
+    if (job.pipeline->cmdSignature)
     {
-        addBarrier(backendContext, &job->computeJobDescriptor.cmdArgument, FFX_RESOURCE_STATE_INDIRECT_ARGUMENT);
+        addBarrier(backendContext, &job.cmdArgument, FFX_RESOURCE_STATE_INDIRECT_ARGUMENT);
     }
 
     // insert all the barriers
     flushBarriers(backendContext, vkCommandBuffer);
 
-    // update all uavs and srvs
-    backendContext->vkFunctionTable.vkUpdateDescriptorSets(backendContext->device, descriptorWriteIndex, writeDescriptorSets, 0, nullptr);
+    // Reuse a set that already holds these descriptors by swapping it into the current ring slot. The set previously
+    // in that slot is the least recently used one, so moving it elsewhere never brings an in-flight set forward.
+    const uint32_t descriptorSetIndex = pipelineLayout->descriptorSetIndex;
+    uint64_t       descriptorHash     = 0;
+    if (!hasNullDescriptor)
+    {
+        const uint8_t* hashData[]     = { reinterpret_cast<const uint8_t*>(descriptorInfos), reinterpret_cast<const uint8_t*>(resourceGenerations) };
+        const size_t   hashDataSize[] = { descriptorCount * sizeof(DescriptorInfoVK), descriptorCount * sizeof(uint64_t) };
+
+        descriptorHash = DESCRIPTOR_HASH_SEED;
+        for (uint32_t block = 0; block < 2; ++block)
+        {
+            for (size_t i = 0; i < hashDataSize[block]; ++i)
+                descriptorHash = (descriptorHash ^ hashData[block][i]) * DESCRIPTOR_HASH_PRIME;
+        }
+        descriptorHash = descriptorHash ? descriptorHash : 1;
+    }
+
+    bool descriptorSetCached = false;
+    for (uint32_t i = 0; descriptorHash && i < (FFX_MAX_QUEUED_FRAMES * MAX_PIPELINE_USAGE_PER_FRAME); ++i)
+    {
+        if (pipelineLayout->descriptorSetHashes[i] != descriptorHash)
+            continue;
+
+        std::swap(pipelineLayout->descriptorSets[i], pipelineLayout->descriptorSets[descriptorSetIndex]);
+        std::swap(pipelineLayout->descriptorSetHashes[i], pipelineLayout->descriptorSetHashes[descriptorSetIndex]);
+        descriptorSetCached = true;
+        break;
+    }
+
+    VkDescriptorSet descriptorSet = pipelineLayout->descriptorSets[descriptorSetIndex];
+    if (!descriptorSetCached)
+    {
+        // update all uavs and srvs
+        if (pipelineLayout->descriptorUpdateTemplate != VK_NULL_HANDLE && !hasNullDescriptor)
+        {
+            backendContext->vkFunctionTable.vkUpdateDescriptorSetWithTemplate(backendContext->device, descriptorSet, pipelineLayout->descriptorUpdateTemplate, descriptorInfos);
+        }
+        else
+        {
+            for (uint32_t i = 0; i < descriptorWriteIndex; ++i)
+                writeDescriptorSets[i].dstSet = descriptorSet;
+            backendContext->vkFunctionTable.vkUpdateDescriptorSets(backendContext->device, descriptorWriteIndex, writeDescriptorSets, 0, nullptr);
+        }
+
+        pipelineLayout->descriptorSetHashes[descriptorSetIndex] = descriptorHash;
+    }
 
     // bind pipeline
-    backendContext->vkFunctionTable.vkCmdBindPipeline(vkCommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, reinterpret_cast<VkPipeline>(job->computeJobDescriptor.pipeline.pipeline));
+    backendContext->vkFunctionTable.vkCmdBindPipeline(vkCommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, reinterpret_cast<VkPipeline>(job.pipeline->pipeline));
 
     // bind descriptor sets
     {
-        backendContext->vkFunctionTable.vkCmdBindDescriptorSets(vkCommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipelineLayout->pipelineLayout, 0, 1, &pipelineLayout->descriptorSets[pipelineLayout->descriptorSetIndex], 0, nullptr);
+        backendContext->vkFunctionTable.vkCmdBindDescriptorSets(vkCommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipelineLayout->pipelineLayout, 0, 1, &descriptorSet, job.pipeline->constCount, dynamicOffsets);
 
         BackendContext_VK::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
 
-        if (job->computeJobDescriptor.pipeline.staticTextureSrvCount > 0)
+        if (job.pipeline->staticTextureSrvCount > 0)
             backendContext->vkFunctionTable.vkCmdBindDescriptorSets(vkCommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipelineLayout->pipelineLayout, pipelineLayout->staticTextureSrvSet, 1, &effectContext.bindlessTextureSrvDescriptorSet, 0, nullptr);
 
-        if (job->computeJobDescriptor.pipeline.staticBufferSrvCount > 0)
+        if (job.pipeline->staticBufferSrvCount > 0)
             backendContext->vkFunctionTable.vkCmdBindDescriptorSets(vkCommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipelineLayout->pipelineLayout, pipelineLayout->staticBufferSrvSet, 1, &effectContext.bindlessBufferSrvDescriptorSet, 0, nullptr);
 
-        if (job->computeJobDescriptor.pipeline.staticTextureUavCount > 0)
+        if (job.pipeline->staticTextureUavCount > 0)
             backendContext->vkFunctionTable.vkCmdBindDescriptorSets(vkCommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipelineLayout->pipelineLayout, pipelineLayout->staticTextureUavSet, 1, &effectContext.bindlessTextureUavDescriptorSet, 0, nullptr);
 
-        if (job->computeJobDescriptor.pipeline.staticBufferUavCount > 0)
+        if (job.pipeline->staticBufferUavCount > 0)
             backendContext->vkFunctionTable.vkCmdBindDescriptorSets(vkCommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipelineLayout->pipelineLayout, pipelineLayout->staticBufferUavSet, 1, &effectContext.bindlessBufferUavDescriptorSet, 0, nullptr);
     }
     
     // Dispatch (or dispatch indirect)
-    if (job->computeJobDescriptor.pipeline.cmdSignature)
+    if (job.pipeline->cmdSignature)
     {
-        const uint32_t resourceIndex = job->computeJobDescriptor.cmdArgument.internalIndex;
+        const uint32_t resourceIndex = job.cmdArgument.internalIndex;
         VkBuffer buffer = backendContext->pResources[resourceIndex].bufferResource;
-        backendContext->vkFunctionTable.vkCmdDispatchIndirect(vkCommandBuffer, buffer, job->computeJobDescriptor.cmdArgumentOffset);
+        backendContext->vkFunctionTable.vkCmdDispatchIndirect(vkCommandBuffer, buffer, job.cmdArgumentOffset);
     }
     else
     {
-        backendContext->vkFunctionTable.vkCmdDispatch(vkCommandBuffer, job->computeJobDescriptor.dimensions[0], job->computeJobDescriptor.dimensions[1], job->computeJobDescriptor.dimensions[2]);
+        backendContext->vkFunctionTable.vkCmdDispatch(vkCommandBuffer, job.dimensions[0], job.dimensions[1], job.dimensions[2]);
     }
 
     // move to another descriptor set for the next compute render job so that we don't overwrite descriptors in-use
@@ -4084,8 +4586,8 @@ static FfxErrorCode executeGpuJobCopy(BackendContext_VK* backendContext, FfxGpuJ
 
 static FfxErrorCode executeGpuJobBarrier(BackendContext_VK* backendContext, FfxGpuJobDescription* job, VkCommandBuffer vkCommandBuffer)
 {
+    // left pending so consecutive barrier jobs batch with the next job's own barriers
     addBarrier(backendContext, &job->barrierDescriptor.resource, job->barrierDescriptor.newState);
-    flushBarriers(backendContext, vkCommandBuffer);
 
     return FFX_OK;
 }
@@ -4155,8 +4657,9 @@ FfxErrorCode ExecuteGpuJobsVK(FfxInterface* backendInterface, FfxCommandList com
         FfxGpuJobDescription* gpuJob = &backendContext->pGpuJobs[i];
 
         // If we have a label for the job, drop a marker for it
-        if (gpuJob->jobLabel[0]) {
-            beginMarkerVK(backendContext, vkCommandBuffer, gpuJob->jobLabel);
+        const wchar_t* jobLabel = ffxGetGpuJobLabel(gpuJob);
+        if (jobLabel[0]) {
+            beginMarkerVK(backendContext, vkCommandBuffer, jobLabel);
         }
 
         
@@ -4173,8 +4676,10 @@ FfxErrorCode ExecuteGpuJobsVK(FfxInterface* backendInterface, FfxCommandList com
             break;
         }
         case FFX_GPU_JOB_COMPUTE:
+        case FFX_GPU_JOB_COMPUTE_COMPACT:
         {
-            errorCode = executeGpuJobCompute(backendContext, gpuJob, vkCommandBuffer, effectContextId);
+            FfxComputeJobView computeJob = ffxGetComputeJobView(gpuJob);
+            errorCode = executeGpuJobCompute(backendContext, computeJob, vkCommandBuffer, effectContextId);
             break;
         }
         case FFX_GPU_JOB_BARRIER:
@@ -4185,11 +4690,14 @@ FfxErrorCode ExecuteGpuJobsVK(FfxInterface* backendInterface, FfxCommandList com
         default:;
         }
 
-        if (gpuJob->jobLabel[0]) {
+        if (jobLabel[0]) {
             endMarkerVK(backendContext, vkCommandBuffer);
         }
     }
 
+    // submit whatever barrier jobs left pending
+    flushBarriers(backendContext, vkCommandBuffer);
+
     // check the execute function returned cleanly.
     FFX_RETURN_ON_ERROR(
         errorCode == FFX_OK,
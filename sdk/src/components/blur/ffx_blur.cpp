@@ -30,25 +30,20 @@
 #include <FidelityFX/gpu/blur/ffx_blur.h>
 
 #include <ffx_object_management.h>
+#include <ffx_resource_binding_map.h>
 
 #include "ffx_blur_private.h"
 
 // lists to map shader resource bindpoint name to resource identifier
-typedef struct ResourceBinding
-{
-    uint32_t index;
-    wchar_t  name[64];
-} ResourceBinding;
-
-static const ResourceBinding srvTextureBindingTable[] = {
+static const FfxResourceBindingMapEntry srvTextureBindingTable[] = {
     {FFX_BLUR_RESOURCE_IDENTIFIER_INPUT_SRC, L"r_input_src"},
 };
 
-static const ResourceBinding uavTextureBindingTable[] = {
+static const FfxResourceBindingMapEntry uavTextureBindingTable[] = {
     {FFX_BLUR_RESOURCE_IDENTIFIER_OUTPUT, L"rw_output"},
 };
 
-static const ResourceBinding cbResourceBindingTable[] = {
+static const FfxResourceBindingMapEntry cbResourceBindingTable[] = {
     {FFX_BLUR_CONSTANTBUFFER_IDENTIFIER_BLUR, L"cbBLUR"},
 };
 
@@ -100,47 +95,9 @@ static wchar_t* getKernelSizeString(wchar_t* buffer, FfxBlurKernelSize kernelSiz
 
 static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
 {
-    for (uint32_t srvIndex = 0; srvIndex < inoutPipeline->srvTextureCount; ++srvIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(srvTextureBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(srvTextureBindingTable[mapIndex].name, inoutPipeline->srvTextureBindings[srvIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(srvTextureBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->srvTextureBindings[srvIndex].resourceIdentifier = srvTextureBindingTable[mapIndex].index;
-    }
-
-    for (uint32_t uavIndex = 0; uavIndex < inoutPipeline->uavTextureCount; ++uavIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(uavTextureBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(uavTextureBindingTable[mapIndex].name, inoutPipeline->uavTextureBindings[uavIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(uavTextureBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->uavTextureBindings[uavIndex].resourceIdentifier = uavTextureBindingTable[mapIndex].index;
-    }
-
-    for (uint32_t cbIndex = 0; cbIndex < inoutPipeline->constCount; ++cbIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(cbResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(cbResourceBindingTable[mapIndex].name, inoutPipeline->constantBufferBindings[cbIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(cbResourceBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->constantBufferBindings[cbIndex].resourceIdentifier = cbResourceBindingTable[mapIndex].index;
-    }
+    FFX_VALIDATE(ffxResolveResourceBindings(inoutPipeline->srvTextureBindings, inoutPipeline->srvTextureCount, srvTextureBindingTable));
+    FFX_VALIDATE(ffxResolveResourceBindings(inoutPipeline->uavTextureBindings, inoutPipeline->uavTextureCount, uavTextureBindingTable));
+    FFX_VALIDATE(ffxResolveResourceBindings(inoutPipeline->constantBufferBindings, inoutPipeline->constCount, cbResourceBindingTable));
 
     return FFX_OK;
 }
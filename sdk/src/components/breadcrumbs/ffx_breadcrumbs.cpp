@@ -61,6 +61,7 @@ static void breadcrumbsSetName(FfxAllocationCallbacks* allocs, BreadcrumbsCustom
         {
             nameBuffer->pBuffer = (char*)ffxBreadcrumbsAppendList(nameBuffer->pBuffer,
                 nameBuffer->bufferSize, 1, nameBuffer->currentNamesOffset - nameBuffer->bufferSize, allocs);
+            nameBuffer->bufferSize = nameBuffer->currentNamesOffset;
         }
         memcpy(nameBuffer->pBuffer + nameOffset, tag->pName, length);
 
@@ -91,17 +92,188 @@ static char* breadcrumbsGetName(BreadcrumbsCustomNameBuffer* nameBuffer, const B
     return name->pName;
 }
 
+static size_t breadcrumbsHashHandle(const void* handle)
+{
+    // Handles are mostly aligned pointers, so mix upper bits into the lower ones used for slot selection.
+    uint64_t hash = (uint64_t)(uintptr_t)handle;
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 33;
+    return (size_t)hash;
+}
+
+static const BreadcrumbsHandleSlot* breadcrumbsIndexFind(const BreadcrumbsHandleIndex* index, const void* handle)
+{
+    if (index->count == 0)
+        return nullptr;
+
+    const size_t mask = index->capacity - 1;
+    for (size_t slot = breadcrumbsHashHandle(handle) & mask;; slot = (slot + 1) & mask)
+    {
+        const BreadcrumbsHandleSlot* current = index->pSlots + slot;
+        if (current->handle == handle)
+            return current;
+        // Load factor is kept below 1/2 so there is always an empty slot ending the probe.
+        if (current->handle == nullptr)
+            return nullptr;
+    }
+}
+
+static void breadcrumbsIndexPlace(BreadcrumbsHandleSlot* slots, size_t capacity, const void* handle, size_t entry)
+{
+    const size_t mask = capacity - 1;
+    size_t slot = breadcrumbsHashHandle(handle) & mask;
+    while (slots[slot].handle)
+        slot = (slot + 1) & mask;
+    slots[slot] = { handle, entry };
+}
+
+static FfxErrorCode breadcrumbsIndexInsert(BreadcrumbsHandleIndex* index, FfxAllocationCallbacks* allocs, const void* handle, size_t entry)
+{
+    FFX_ASSERT(handle);
+    FFX_ASSERT(breadcrumbsIndexFind(index, handle) == nullptr);
+
+    if ((index->count + 1) * 2 > index->capacity)
+    {
+        const size_t newCapacity = index->capacity ? index->capacity * 2 : 64;
+        BreadcrumbsHandleSlot* newSlots = (BreadcrumbsHandleSlot*)allocs->fpAlloc(newCapacity * sizeof(BreadcrumbsHandleSlot));
+        FFX_RETURN_ON_ERROR(newSlots, FFX_ERROR_OUT_OF_MEMORY);
+        memset(newSlots, 0, newCapacity * sizeof(BreadcrumbsHandleSlot));
+
+        for (size_t i = 0; i < index->capacity; ++i)
+        {
+            if (index->pSlots[i].handle)
+                breadcrumbsIndexPlace(newSlots, newCapacity, index->pSlots[i].handle, index->pSlots[i].entry);
+        }
+        FFX_SAFE_FREE(index->pSlots, allocs->fpFree);
+        index->pSlots = newSlots;
+        index->capacity = newCapacity;
+    }
+
+    breadcrumbsIndexPlace(index->pSlots, index->capacity, handle, entry);
+    ++index->count;
+    return FFX_OK;
+}
+
+static BreadcrumbsListTable* breadcrumbsAllocListTable(FfxAllocationCallbacks* allocs, size_t capacity, BreadcrumbsListTable* replaced)
+{
+    // Slots are placed right after the table.
+    BreadcrumbsListTable* table = (BreadcrumbsListTable*)allocs->fpAlloc(sizeof(BreadcrumbsListTable) + capacity * sizeof(BreadcrumbsListSlot));
+    if (table == nullptr)
+        return nullptr;
+
+    table->capacity = capacity;
+    table->count = 0;
+    table->pReplaced = replaced;
+    table->pSlots = (BreadcrumbsListSlot*)(table + 1);
+    for (size_t i = 0; i < capacity; ++i)
+        new(table->pSlots + i) BreadcrumbsListSlot();
+    return table;
+}
+
+static void breadcrumbsListTablePlace(BreadcrumbsListTable* table, BreadcrumbsListData* listData)
+{
+    // Lock placed externally.
+    const size_t mask = table->capacity - 1;
+    size_t slot = breadcrumbsHashHandle(listData->list) & mask;
+    while (table->pSlots[slot].list.load(std::memory_order_relaxed))
+        slot = (slot + 1) & mask;
+
+    // Data has to be visible before the handle that lookups compare against.
+    table->pSlots[slot].pData = listData;
+    table->pSlots[slot].list.store(listData->list, std::memory_order_release);
+    ++table->count;
+}
+
 static BreadcrumbsListData* breadcrumbsSearchList(BreadcrumbsFrameData* frame, FfxCommandList list)
 {
-    // Lock placed externally
+    // No need for lock, see BreadcrumbsListTable. Any list registered before the lookup is in the table read here,
+    // either inserted into it or copied when it replaced the previous one.
     FFX_ASSERT(frame);
     FFX_ASSERT(list);
-    for (size_t i = 0; i < frame->usedListsCount; ++i)
+    const BreadcrumbsListTable* table = frame->pUsedListsTable.load(std::memory_order_acquire);
+    if (table == nullptr)
+        return nullptr;
+
+    const size_t mask = table->capacity - 1;
+    for (size_t slot = breadcrumbsHashHandle(list) & mask;; slot = (slot + 1) & mask)
     {
-        if (frame->pUsedLists[i].list == list)
-            return frame->pUsedLists + i;
+        const FfxCommandList current = table->pSlots[slot].list.load(std::memory_order_acquire);
+        if (current == list)
+            return table->pSlots[slot].pData;
+        // Load factor is kept below 1/2 so there is always an empty slot ending the probe.
+        if (current == nullptr)
+            return nullptr;
+    }
+}
+
+static FfxErrorCode breadcrumbsInsertList(BreadcrumbsFrameData* frame, FfxAllocationCallbacks* allocs, BreadcrumbsListData* listData)
+{
+    // Lock placed externally.
+    FFX_ASSERT(frame);
+    FFX_ASSERT(listData);
+    FFX_ASSERT(breadcrumbsSearchList(frame, listData->list) == nullptr);
+
+    BreadcrumbsListTable* table = frame->pUsedListsTable.load(std::memory_order_relaxed);
+    if (table == nullptr || (table->count + 1) * 2 > table->capacity)
+    {
+        // Lookups in progress keep probing the replaced table, so it is only freed with the frame.
+        BreadcrumbsListTable* newTable = breadcrumbsAllocListTable(allocs, table ? table->capacity * 2 : 64, table);
+        FFX_RETURN_ON_ERROR(newTable, FFX_ERROR_OUT_OF_MEMORY);
+        for (size_t i = 0; table && i < table->capacity; ++i)
+        {
+            if (table->pSlots[i].list.load(std::memory_order_relaxed))
+                breadcrumbsListTablePlace(newTable, table->pSlots[i].pData);
+        }
+        frame->pUsedListsTable.store(newTable, std::memory_order_release);
+        table = newTable;
+    }
+
+    breadcrumbsListTablePlace(table, listData);
+    return FFX_OK;
+}
+
+static void breadcrumbsReleaseLists(BreadcrumbsFrameData* frame, FfxAllocationCallbacks* allocs, bool keepTable)
+{
+    // Not protected by lock, should be called from single thread only!
+    FFX_ASSERT(frame);
+    for (size_t list = 0; list < frame->usedListsCount; ++list)
+    {
+        BreadcrumbsListData* listData = frame->ppUsedLists[list];
+        FFX_SAFE_FREE(listData->pMarkers, allocs->fpFree);
+        FFX_SAFE_FREE(listData->pCurrentStack, allocs->fpFree);
+        FFX_SAFE_FREE(listData->pReservations, allocs->fpFree);
+        allocs->fpFree(listData);
+    }
+    FFX_SAFE_FREE(frame->ppUsedLists, allocs->fpFree);
+    frame->usedListsCount = 0;
+
+    BreadcrumbsListTable* table = frame->pUsedListsTable.load(std::memory_order_relaxed);
+    if (table == nullptr)
+        return;
+    for (BreadcrumbsListTable* replaced = table->pReplaced; replaced;)
+    {
+        BreadcrumbsListTable* next = replaced->pReplaced;
+        allocs->fpFree(replaced);
+        replaced = next;
+    }
+    table->pReplaced = nullptr;
+
+    if (keepTable)
+    {
+        // Keep the largest table around, the same amount of lists is likely to be used in next frames.
+        for (size_t i = 0; i < table->capacity; ++i)
+        {
+            table->pSlots[i].list.store(nullptr, std::memory_order_relaxed);
+            table->pSlots[i].pData = nullptr;
+        }
+        table->count = 0;
+    }
+    else
+    {
+        allocs->fpFree(table);
+        frame->pUsedListsTable.store(nullptr, std::memory_order_relaxed);
     }
-    return nullptr;
 }
 
 static BreadcrumbsPipelineData* breadcrumbsSearchPipeline(FfxBreadcrumbsContext_Private* context, FfxPipeline pipeline)
@@ -109,10 +281,11 @@ static BreadcrumbsPipelineData* breadcrumbsSearchPipeline(FfxBreadcrumbsContext_
     // Lock placed externally
     FFX_ASSERT(context);
     FFX_ASSERT(pipeline);
-    for (size_t i = 0; i < context->registeredPipelinesCount; ++i)
+    const BreadcrumbsHandleSlot* slot = breadcrumbsIndexFind(&context->registeredPipelinesIndex, pipeline);
+    if (slot)
     {
-        if (context->pRegisteredPipelines[i].pipeline == pipeline)
-            return context->pRegisteredPipelines + i;
+        FFX_ASSERT(slot->entry < context->registeredPipelinesCount);
+        return context->pRegisteredPipelines + slot->entry;
     }
     return nullptr;
 }
@@ -181,6 +354,47 @@ static FfxErrorCode breadcrumbsAllocBlock(FfxInterface* ptr, FfxAllocationCallba
     return FFX_OK;
 }
 
+static FfxErrorCode breadcrumbsReserveMarkers(FfxBreadcrumbsContext_Private* context, BreadcrumbsBlockVector* queueBlocks,
+    uint32_t markersCount, BreadcrumbsMarkerReservation* reservation)
+{
+    // Lock placed externally.
+    FFX_ASSERT(context);
+    FFX_ASSERT(queueBlocks);
+    FFX_ASSERT(markersCount > 0);
+    FFX_ASSERT(reservation);
+
+    // Select block with free region for markers.
+    const uint32_t maxMarkers = context->contextDescription.maxMarkersPerMemoryBlock;
+    FfxBreadcrumbsBlockData* block = breadcrumbsGetLastBlock(queueBlocks);
+    FFX_ASSERT(block);
+
+    if (block->nextMarker >= maxMarkers)
+    {
+        // Advance to next block.
+        if (++queueBlocks->currentBlock >= queueBlocks->memoryBlocksCount)
+        {
+            FfxErrorCode error = breadcrumbsAllocBlock(&context->contextDescription.backendInterface, &context->contextDescription.allocCallbacks,
+                queueBlocks, maxMarkers);
+            if (error != FFX_OK)
+            {
+                --queueBlocks->currentBlock;
+                return error;
+            }
+        }
+        block = breadcrumbsGetLastBlock(queueBlocks);
+        block->nextMarker = 0;
+    }
+
+    reservation->block = queueBlocks->currentBlock;
+    reservation->buffer = block->buffer;
+    reservation->baseAddress = block->baseAddress;
+    reservation->nextOffset = block->nextMarker;
+    reservation->endOffset = block->nextMarker + FFX_MINIMUM(markersCount, maxMarkers - block->nextMarker);
+    block->nextMarker = reservation->endOffset;
+
+    return FFX_OK;
+}
+
 static FfxErrorCode breadcrumbsRelease(FfxBreadcrumbsContext_Private* context)
 {
     // Not protected by lock, should be called from single thread only!
@@ -192,11 +406,7 @@ static FfxErrorCode breadcrumbsRelease(FfxBreadcrumbsContext_Private* context)
         for (uint32_t f = 0; f < context->contextDescription.frameHistoryLength; ++f)
         {
             BreadcrumbsFrameData* frame = context->pFrameData + f;
-            for (uint32_t list = 0; list < frame->usedListsCount; ++list)
-            {
-                FFX_SAFE_FREE(frame->pUsedLists->pMarkers, context->contextDescription.allocCallbacks.fpFree);
-            }
-            FFX_SAFE_FREE(frame->pUsedLists, context->contextDescription.allocCallbacks.fpFree);
+            breadcrumbsReleaseLists(frame, &context->contextDescription.allocCallbacks, false);
 
             for (uint32_t queue = 0; queue < context->contextDescription.usedGpuQueuesCount; ++queue)
             {
@@ -223,6 +433,7 @@ static FfxErrorCode breadcrumbsRelease(FfxBreadcrumbsContext_Private* context)
         context->contextDescription.allocCallbacks.fpFree(context->pFrameData);
     }
     FFX_SAFE_FREE(context->pRegisteredPipelines, context->contextDescription.allocCallbacks.fpFree);
+    FFX_SAFE_FREE(context->registeredPipelinesIndex.pSlots, context->contextDescription.allocCallbacks.fpFree);
     FFX_SAFE_FREE(context->pipelinesNamesBuffer.pBuffer, context->contextDescription.allocCallbacks.fpFree);
 
     // Destroy the context
@@ -356,12 +567,7 @@ FfxErrorCode ffxBreadcrumbsStartFrame(FfxBreadcrumbsContext* context)
     ++contextPrivate->frameIndex;
     BreadcrumbsFrameData* frame = breadcrumbsGetCurrentFrame(contextPrivate);
     frame->namesBuffer.currentNamesOffset = 0;
-    for (uint32_t list = 0; list < frame->usedListsCount; ++list)
-    {
-        FFX_SAFE_FREE(frame->pUsedLists->pMarkers, contextPrivate->contextDescription.allocCallbacks.fpFree);
-    }
-    FFX_SAFE_FREE(frame->pUsedLists, contextPrivate->contextDescription.allocCallbacks.fpFree);
-    frame->usedListsCount = 0;
+    breadcrumbsReleaseLists(frame, &contextPrivate->contextDescription.allocCallbacks, true);
 
     for (uint32_t queue = 0; queue < contextPrivate->contextDescription.usedGpuQueuesCount; ++queue)
     {
@@ -377,6 +583,7 @@ FfxErrorCode ffxBreadcrumbsRegisterCommandList(FfxBreadcrumbsContext* context, c
 {
     FFX_RETURN_ON_ERROR(context, FFX_ERROR_INVALID_POINTER);
     FFX_RETURN_ON_ERROR(commandListDescription, FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(commandListDescription->commandList, FFX_ERROR_INVALID_ARGUMENT);
 
     FfxBreadcrumbsContext_Private* contextPrivate = (FfxBreadcrumbsContext_Private*)(context);
     FFX_RETURN_ON_ERROR(breadcrumbsIsCorrectPipeline(contextPrivate, commandListDescription->pipeline, false), FFX_ERROR_INVALID_ARGUMENT);
@@ -400,19 +607,41 @@ FfxErrorCode ffxBreadcrumbsRegisterCommandList(FfxBreadcrumbsContext* context, c
         }
         return FFX_ERROR_INVALID_ARGUMENT;
     }
-    frame->pUsedLists = (BreadcrumbsListData*)ffxBreadcrumbsAppendList(frame->pUsedLists, frame->usedListsCount, sizeof(BreadcrumbsListData), 1, &contextPrivate->contextDescription.allocCallbacks);
-    frame->pUsedLists[frame->usedListsCount] =
+
+    // Allocated separately so it stays in place while markers are recorded without lock.
+    FfxAllocationCallbacks* allocs = &contextPrivate->contextDescription.allocCallbacks;
+    BreadcrumbsListData* listData = (BreadcrumbsListData*)allocs->fpAlloc(sizeof(BreadcrumbsListData));
+    FfxErrorCode errorCode = listData ? FFX_OK : FFX_ERROR_OUT_OF_MEMORY;
+    if (errorCode == FFX_OK)
+    {
+        *listData =
+        {
+            commandListDescription->commandList,
+            commandListDescription->queueType,
+            commandListDescription->submissionIndex,
+            name,
+            FFX_CONTAINS_FLAG(contextPrivate->contextDescription.flags, FFX_BREADCRUMBS_PRINT_SKIP_PIPELINE_INFO) ? nullptr : commandListDescription->pipeline,
+            0,
+            nullptr,
+            0,
+            nullptr,
+            0,
+            nullptr
+        };
+        errorCode = breadcrumbsInsertList(frame, allocs, listData);
+        if (errorCode != FFX_OK)
+            allocs->fpFree(listData);
+    }
+    if (errorCode != FFX_OK)
     {
-        commandListDescription->commandList,
-        commandListDescription->queueType,
-        commandListDescription->submissionIndex,
-        name,
-        FFX_CONTAINS_FLAG(contextPrivate->contextDescription.flags, FFX_BREADCRUMBS_PRINT_SKIP_PIPELINE_INFO) ? nullptr : commandListDescription->pipeline,
-        0,
-        nullptr,
-        0,
-        nullptr
-    };
+        if (lockEnable)
+        {
+            FFX_MUTEX_UNLOCK(frame->listMutex);
+        }
+        return errorCode;
+    }
+    frame->ppUsedLists = (BreadcrumbsListData**)ffxBreadcrumbsAppendList(frame->ppUsedLists, frame->usedListsCount, sizeof(BreadcrumbsListData*), 1, allocs);
+    frame->ppUsedLists[frame->usedListsCount] = listData;
     ++frame->usedListsCount;
     if (lockEnable)
     {
@@ -456,6 +685,16 @@ FfxErrorCode ffxBreadcrumbsRegisterPipeline(FfxBreadcrumbsContext* context, cons
         FFX_MUTEX_LOCK(contextPrivate->pipelinesNamesBuffer.mutex);
     }
 
+    const FfxErrorCode indexStatus = breadcrumbsIndexInsert(&contextPrivate->registeredPipelinesIndex, &contextPrivate->contextDescription.allocCallbacks,
+        pipelineDescription->pipeline, contextPrivate->registeredPipelinesCount);
+    if (indexStatus != FFX_OK)
+    {
+        if (lockEnable)
+        {
+            FFX_MUTEX_UNLOCK(contextPrivate->pipelinesNamesBuffer.mutex);
+        }
+        return indexStatus;
+    }
     contextPrivate->pRegisteredPipelines = (BreadcrumbsPipelineData*)ffxBreadcrumbsAppendList(contextPrivate->pRegisteredPipelines,
         contextPrivate->registeredPipelinesCount, sizeof(BreadcrumbsPipelineData), 1, &contextPrivate->contextDescription.allocCallbacks);
     BreadcrumbsPipelineData* newPipeline = contextPrivate->pRegisteredPipelines + contextPrivate->registeredPipelinesCount;
@@ -494,26 +733,11 @@ FfxErrorCode ffxBreadcrumbsSetPipeline(FfxBreadcrumbsContext* context, FfxComman
     if (FFX_CONTAINS_FLAG(contextPrivate->contextDescription.flags, FFX_BREADCRUMBS_PRINT_SKIP_PIPELINE_INFO))
         return FFX_OK;
 
-    FfxErrorCode ret = FFX_OK;
-    BreadcrumbsFrameData* frame = breadcrumbsGetCurrentFrame(contextPrivate);
-
-    const bool lockEnable = FFX_CONTAINS_FLAG(contextPrivate->contextDescription.flags, FFX_BREADCRUMBS_ENABLE_THREAD_SYNCHRONIZATION);
-    if (lockEnable)
-    {
-        FFX_MUTEX_LOCK_SHARED(frame->listMutex);
-    }
-
-    BreadcrumbsListData* listData = breadcrumbsSearchList(frame, commandList);
-    if (listData)
-        listData->currentPipeline = pipeline;
-    else
-        ret = FFX_ERROR_INVALID_ARGUMENT;
-
-    if (lockEnable)
-    {
-        FFX_MUTEX_UNLOCK_SHARED(frame->listMutex);
-    }
-    return ret;
+    // Command list is recorded by single thread at a time, so its data needs no lock.
+    BreadcrumbsListData* listData = breadcrumbsSearchList(breadcrumbsGetCurrentFrame(contextPrivate), commandList);
+    FFX_RETURN_ON_ERROR(listData, FFX_ERROR_INVALID_ARGUMENT);
+    listData->currentPipeline = pipeline;
+    return FFX_OK;
 }
 
 FfxErrorCode ffxBreadcrumbsBeginMarker(FfxBreadcrumbsContext* context, FfxCommandList commandList, FfxBreadcrumbsMarkerType type, const FfxBreadcrumbsNameTag* name)
@@ -536,66 +760,56 @@ FfxErrorCode ffxBreadcrumbsBeginMarker(FfxBreadcrumbsContext* context, FfxComman
     const bool lockEnable = FFX_CONTAINS_FLAG(contextPrivate->contextDescription.flags, FFX_BREADCRUMBS_ENABLE_THREAD_SYNCHRONIZATION);
     breadcrumbsSetName(allocs, &frame->namesBuffer, name, lockEnable, &markerData.name);
 
-    // Get queue type of current command list.
-    if (lockEnable)
-    {
-        FFX_MUTEX_LOCK_SHARED(frame->listMutex);
-    }
+    // Command list is recorded by single thread at a time, so its data needs no lock.
     BreadcrumbsListData* listData = breadcrumbsSearchList(frame, commandList);
-    if (listData == nullptr)
-    {
-        if (lockEnable)
-        {
-            FFX_MUTEX_UNLOCK_SHARED(frame->listMutex);
-        }
-        return FFX_ERROR_INVALID_ARGUMENT;
-    }
+    FFX_RETURN_ON_ERROR(listData, FFX_ERROR_INVALID_ARGUMENT);
     uint32_t queueType = listData->queueType;
     FFX_ASSERT(queueType < contextPrivate->contextDescription.usedGpuQueuesCount);
-
-    if (lockEnable)
-    {
-        FFX_MUTEX_UNLOCK_SHARED(frame->listMutex);
-        FFX_MUTEX_LOCK(frame->blockMutex);
-    }
-
-    // Select block with free region for marker.
     BreadcrumbsBlockVector* queueBlocks = frame->pBlockPerQueue + queueType;
-    FfxBreadcrumbsBlockData* block = breadcrumbsGetLastBlock(queueBlocks);
-    FFX_ASSERT(block);
 
-    if (block->nextMarker >= contextPrivate->contextDescription.maxMarkersPerMemoryBlock)
+    BreadcrumbsMarkerReservation markerReservation = {};
+    BreadcrumbsMarkerReservation* reservation = &markerReservation;
+    const bool reserveMarkers = FFX_CONTAINS_FLAG(contextPrivate->contextDescription.flags, FFX_BREADCRUMBS_RESERVE_MARKERS_PER_LIST);
+    if (reserveMarkers && listData->reservationsCount)
+        reservation = listData->pReservations + listData->reservationsCount - 1;
+
+    // Only taking new markers from memory blocks of the queue needs synchronization.
+    if (reservation->nextOffset == reservation->endOffset)
     {
-        // Advance to next block.
-        if (++queueBlocks->currentBlock >= queueBlocks->memoryBlocksCount)
+        if (lockEnable)
         {
-            FfxErrorCode error = breadcrumbsAllocBlock(&contextPrivate->contextDescription.backendInterface, allocs,
-                queueBlocks, contextPrivate->contextDescription.maxMarkersPerMemoryBlock);
-            if (error != FFX_OK)
-            {
-                FFX_MUTEX_UNLOCK(frame->blockMutex);
-                return error;
-            }
-            block = breadcrumbsGetLastBlock(queueBlocks);
+            FFX_MUTEX_LOCK(frame->blockMutex);
+        }
+        BreadcrumbsMarkerReservation newReservation = {};
+        FfxErrorCode error = breadcrumbsReserveMarkers(contextPrivate, queueBlocks, reserveMarkers ? FFX_BREADCRUMBS_LIST_RESERVED_MARKERS : 1, &newReservation);
+        if (lockEnable)
+        {
+            FFX_MUTEX_UNLOCK(frame->blockMutex);
+        }
+        FFX_RETURN_ON_ERROR(error == FFX_OK, error);
+
+        if (reserveMarkers && reservation != &markerReservation && reservation->block == newReservation.block && reservation->endOffset == newReservation.nextOffset)
+        {
+            // Continues in the same block, extend the range.
+            reservation->endOffset = newReservation.endOffset;
+        }
+        else if (reserveMarkers)
+        {
+            // Ranges of the list are kept for ending markers started in them.
+            listData->pReservations = (BreadcrumbsMarkerReservation*)ffxBreadcrumbsAppendList(listData->pReservations,
+                listData->reservationsCount, sizeof(BreadcrumbsMarkerReservation), 1, allocs);
+            reservation = listData->pReservations + listData->reservationsCount++;
+            *reservation = newReservation;
         }
         else
-            block->nextMarker = 0;
+            markerReservation = newReservation;
     }
 
-    markerData.block = queueBlocks->currentBlock;
-    markerData.offset = block->nextMarker++;
-    void* buffer = block->buffer;
-    const uint64_t baseAddress = block->baseAddress;
-
-    if (lockEnable)
-    {
-        FFX_MUTEX_UNLOCK(frame->blockMutex);
-        FFX_MUTEX_LOCK_SHARED(frame->listMutex);
-    }
+    markerData.block = reservation->block;
+    markerData.offset = reservation->nextOffset++;
+    void* buffer = reservation->buffer;
+    const uint64_t baseAddress = reservation->baseAddress;
 
-    // Find CL.
-    listData = breadcrumbsSearchList(frame, commandList);
-    FFX_ASSERT(listData);
     markerData.usedPipeline = listData->currentPipeline;
     markerData.nestingLevel = listData->currentStackCount;
 
@@ -604,11 +818,6 @@ FfxErrorCode ffxBreadcrumbsBeginMarker(FfxBreadcrumbsContext* context, FfxComman
     listData->pMarkers = (BreadcrumbsMarkerData*)ffxBreadcrumbsAppendList(listData->pMarkers, listData->markersCount, sizeof(BreadcrumbsMarkerData), 1, allocs);
     listData->pMarkers[listData->markersCount++] = markerData;
 
-    if (lockEnable)
-    {
-        FFX_MUTEX_UNLOCK_SHARED(frame->listMutex);
-    }
-
     // Unset bit 0 indicates that it's starting marker.
     contextPrivate->contextDescription.backendInterface.fpBreadcrumbsWrite(&contextPrivate->contextDescription.backendInterface,
         commandList, (contextPrivate->frameIndex + 1) << 1, baseAddress + 4ULL * markerData.offset, buffer, true);
@@ -623,40 +832,49 @@ FfxErrorCode ffxBreadcrumbsEndMarker(FfxBreadcrumbsContext* context, FfxCommandL
     FfxBreadcrumbsContext_Private* contextPrivate = (FfxBreadcrumbsContext_Private*)(context);
     BreadcrumbsFrameData* frame = breadcrumbsGetCurrentFrame(contextPrivate);
 
-    const bool lockEnable = FFX_CONTAINS_FLAG(contextPrivate->contextDescription.flags, FFX_BREADCRUMBS_ENABLE_THREAD_SYNCHRONIZATION);
-    if (lockEnable)
-    {
-        FFX_MUTEX_LOCK(frame->listMutex);
-    }
-
-    // Find CL that is used with this marker
+    // Find CL that is used with this marker. Command list is recorded by single thread at a time, so its data needs no lock.
     BreadcrumbsListData* listData = breadcrumbsSearchList(frame, commandList);
-    if (listData == nullptr || listData->currentStackCount == 0)
-    {
-        if (lockEnable)
-        {
-            FFX_MUTEX_UNLOCK(frame->listMutex);
-        }
-        return FFX_ERROR_INVALID_ARGUMENT;
-    }
+    FFX_RETURN_ON_ERROR(listData && listData->currentStackCount, FFX_ERROR_INVALID_ARGUMENT);
 
     // Retrieve data about which marker is being closed now.
     uint32_t markerIndex = listData->pCurrentStack[--listData->currentStackCount];
     FFX_ASSERT(markerIndex < listData->markersCount);
-    listData->pCurrentStack = (uint32_t*)ffxBreadcrumbsPopList(listData->pCurrentStack, listData->currentStackCount, sizeof(uint32_t),
+    listData->pCurrentStack = (uint32_t*)ffxBreadcrumbsPopList(listData->pCurrentStack, listData->currentStackCount,
         &contextPrivate->contextDescription.allocCallbacks);
 
-    // Get correct location for writing
-    BreadcrumbsMarkerData* marker = listData->pMarkers + markerIndex;
-    FfxBreadcrumbsBlockData* block = frame->pBlockPerQueue[listData->queueType].pMemoryBlocks + marker->block;
-    void* buffer = block->buffer;
-    const uint64_t baseAddress = block->baseAddress;
-    const uint32_t offset = marker->offset;
+    // Get correct location for writing, from the range the marker was reserved in if there is one.
+    const BreadcrumbsMarkerData* marker = listData->pMarkers + markerIndex;
+    const BreadcrumbsMarkerReservation* reservation = nullptr;
+    for (uint32_t i = listData->reservationsCount; i-- && reservation == nullptr;)
+    {
+        if (listData->pReservations[i].block == marker->block)
+            reservation = listData->pReservations + i;
+    }
 
-    if (lockEnable)
+    void* buffer;
+    uint64_t baseAddress;
+    if (reservation)
     {
-        FFX_MUTEX_UNLOCK(frame->listMutex);
+        buffer = reservation->buffer;
+        baseAddress = reservation->baseAddress;
+    }
+    else
+    {
+        // Memory blocks can be reallocated by markers started on other command lists.
+        const bool lockEnable = FFX_CONTAINS_FLAG(contextPrivate->contextDescription.flags, FFX_BREADCRUMBS_ENABLE_THREAD_SYNCHRONIZATION);
+        if (lockEnable)
+        {
+            FFX_MUTEX_LOCK_SHARED(frame->blockMutex);
+        }
+        FfxBreadcrumbsBlockData* block = frame->pBlockPerQueue[listData->queueType].pMemoryBlocks + marker->block;
+        buffer = block->buffer;
+        baseAddress = block->baseAddress;
+        if (lockEnable)
+        {
+            FFX_MUTEX_UNLOCK_SHARED(frame->blockMutex);
+        }
     }
+    const uint32_t offset = marker->offset;
 
     // Set bit 0 indicates that it's ending marker.
     contextPrivate->contextDescription.backendInterface.fpBreadcrumbsWrite(&contextPrivate->contextDescription.backendInterface,
@@ -707,7 +925,7 @@ FfxErrorCode ffxBreadcrumbsPrintStatus(FfxBreadcrumbsContext* context, FfxBreadc
         {
             FFX_BREADCRUMBS_APPEND_STRING(markersStatus->pBuffer, markersStatus->bufferSize, " - [");
 
-            BreadcrumbsListData* cl = frame->pUsedLists + j;
+            BreadcrumbsListData* cl = frame->ppUsedLists[j];
             bool skipList = false;
             uint32_t markerFrame = UINT32_MAX;
             const uint32_t* location = nullptr;
@@ -834,7 +1052,7 @@ FfxErrorCode ffxBreadcrumbsPrintStatus(FfxBreadcrumbsContext* context, FfxBreadc
                     if (marker->nestingLevel + 1 < nestingLevelIndicesCount)
                         markerId = 0;
                     while (marker->nestingLevel + 1 < nestingLevelIndicesCount)
-                        nestingLevelIndicatorIndices = (uint32_t*)ffxBreadcrumbsPopList(nestingLevelIndicatorIndices, --nestingLevelIndicesCount, sizeof(uint32_t), allocs);
+                        nestingLevelIndicatorIndices = (uint32_t*)ffxBreadcrumbsPopList(nestingLevelIndicatorIndices, --nestingLevelIndicesCount, allocs);
                 }
                 if (marker->type != currentType)
                 {
@@ -1034,6 +1252,7 @@ FfxErrorCode ffxBreadcrumbsPrintStatus(FfxBreadcrumbsContext* context, FfxBreadc
                     FFX_BREADCRUMBS_APPEND_STRING(markersStatus->pBuffer, markersStatus->bufferSize, "\n");
                 }
             }
+            FFX_SAFE_FREE(nestingLevelIndicatorIndices, allocs->fpFree);
         }
     }
 
@@ -22,6 +22,10 @@
 
 #pragma once
 #include <FidelityFX/host/ffx_breadcrumbs.h>
+#include <atomic>
+
+// Number of markers reserved at once by command list when FFX_BREADCRUMBS_RESERVE_MARKERS_PER_LIST is set.
+#define FFX_BREADCRUMBS_LIST_RESERVED_MARKERS 64
 
 typedef struct BreadcrumbsBlockVector {
 
@@ -54,6 +58,32 @@ typedef struct BreadcrumbsMarkerData {
     FfxPipeline                         usedPipeline;
 } BreadcrumbsMarkerData;
 
+// Open addressing index from pipeline handle into its registration array.
+// Stores positions instead of pointers since registration arrays are reallocated on growth.
+typedef struct BreadcrumbsHandleSlot {
+
+    const void*                         handle;
+    size_t                              entry;
+} BreadcrumbsHandleSlot;
+
+typedef struct BreadcrumbsHandleIndex {
+
+    size_t                              capacity;
+    size_t                              count;
+    BreadcrumbsHandleSlot*              pSlots;
+} BreadcrumbsHandleIndex;
+
+// Range of marker slots in single memory block. Block location is copied,
+// so it can be used without locking while memory blocks of the queue are reallocated.
+typedef struct BreadcrumbsMarkerReservation {
+
+    size_t                              block;
+    void*                               buffer;
+    uint64_t                            baseAddress;
+    uint32_t                            nextOffset;
+    uint32_t                            endOffset;
+} BreadcrumbsMarkerReservation;
+
 typedef struct BreadcrumbsListData {
 
     FfxCommandList                      list;
@@ -66,12 +96,35 @@ typedef struct BreadcrumbsListData {
     // Indices for ending markers.
     uint32_t                            currentStackCount;
     uint32_t*                           pCurrentStack;
+    // Marker slots reserved for this list in memory blocks of its queue, last one is being filled.
+    // Earlier ones are kept for ending markers started in them.
+    uint32_t                            reservationsCount;
+    BreadcrumbsMarkerReservation*       pReservations;
 } BreadcrumbsListData;
 
+// Open addressing table from command list handle to its data, which is allocated on registration and stays
+// in place until the frame is reset. Lists are inserted under listMutex, but looked up without any lock:
+// handle is published after the data pointer, and full table is replaced by a new one twice as large.
+// Replaced tables are kept until the frame is reset since lookups may still be probing them.
+typedef struct BreadcrumbsListSlot {
+
+    std::atomic<FfxCommandList>         list;
+    BreadcrumbsListData*                pData;
+} BreadcrumbsListSlot;
+
+typedef struct BreadcrumbsListTable {
+
+    size_t                              capacity;
+    size_t                              count;
+    struct BreadcrumbsListTable*        pReplaced;
+    BreadcrumbsListSlot*                pSlots;
+} BreadcrumbsListTable;
+
 typedef struct BreadcrumbsFrameData {
 
     size_t                              usedListsCount;
-    BreadcrumbsListData*                pUsedLists;
+    BreadcrumbsListData**               ppUsedLists;
+    std::atomic<BreadcrumbsListTable*>  pUsedListsTable;
     BreadcrumbsBlockVector*             pBlockPerQueue;
     BreadcrumbsCustomNameBuffer         namesBuffer;
     FFX_MUTEX                           listMutex;
@@ -103,5 +156,6 @@ typedef struct FfxBreadcrumbsContext_Private {
     BreadcrumbsFrameData*               pFrameData;
     size_t                              registeredPipelinesCount;
     BreadcrumbsPipelineData*            pRegisteredPipelines;
+    BreadcrumbsHandleIndex              registeredPipelinesIndex;
     BreadcrumbsCustomNameBuffer         pipelinesNamesBuffer;
 } FfxBreadcrumbsContext_Private;
@@ -21,12 +21,20 @@
 // THE SOFTWARE.
 
 #include <FidelityFX/host/ffx_brixelizer.h>
+#include "ffx_brixelizer_bvh.h"
 
 #include <float.h> // FLT_MIN, FLT_MAX
 #include <string.h> // memset
 #include <math.h> // floorf
 #include <stdbool.h>
 
+#define FFX_BRIXELIZER_MAX_TRACKED_DYNAMIC_INSTANCES  8192
+#define FFX_BRIXELIZER_TRACKED_DYNAMIC_INSTANCE_SLOTS (2 * FFX_BRIXELIZER_MAX_TRACKED_DYNAMIC_INSTANCES)
+#define FFX_BRIXELIZER_MAX_STATIC_QUERY_REGIONS       64
+#define FFX_BRIXELIZER_DIRTY_GRID_RESOLUTION          16
+#define FFX_BRIXELIZER_DIRTY_GRID_CELLS               (FFX_BRIXELIZER_DIRTY_GRID_RESOLUTION * FFX_BRIXELIZER_DIRTY_GRID_RESOLUTION * FFX_BRIXELIZER_DIRTY_GRID_RESOLUTION)
+#define FFX_BRIXELIZER_MAX_DIRTY_CELL_REGIONS         (4 * FFX_BRIXELIZER_MAX_INSTANCES)
+
 #define ifor(n) for (uint32_t i = 0; i < n; ++i)
 #define jfor(n) for (uint32_t j = 0; j < n; ++j)
 
@@ -51,6 +59,7 @@ typedef struct FfxBrixelizerBakedUpdateDescription_Private {
     FfxBrixelizerResources                      resources;
     FfxBrixelizerRawCascadeUpdateDescription    cascadeUpdateDesc;
     FfxBrixelizerPopulateDebugAABBsFlags        populateDebugAABBsFlags;
+    uint32_t                                    dynamicCascadeUpdateFlags;
     FfxBrixelizerStats*                         outStats;
     FfxBrixelizerDebugVisualizationDescription* debugVisualizationDesc;
     uint32_t                            numStaticJobs;
@@ -67,6 +76,12 @@ typedef struct FfxBrixelizerCascadePrivate {
     uint32_t                 staticIndex;
     uint32_t                 dynamicIndex;
     uint32_t                 mergedIndex;
+    bool                     hasBeenUpdated;
+    uint32_t                 lastUpdateFrameIndex;
+    int32_t                  lastUpdateClipmapOffset[3];
+    uint32_t                 lastNumInstanceJobs;
+    bool                     dynamicResetPending;
+    bool                     staticRequeryPending;  // a bake ran out of scratch space, so bricks may have been dropped
 } FfxBrixelizerCascadePrivate;
 
 typedef struct FfxBrixelizerInvalidation {
@@ -79,6 +94,13 @@ typedef struct FfxBrixelizerInstance {
     FfxBrixelizerAABB       aabb;
 } FfxBrixelizerInstance;
 
+typedef struct FfxBrixelizerTrackedInstance {
+    uint64_t          key;            // 0 for an empty slot
+    uint32_t          frameSerial;    // the last frame the instance was submitted in
+    FfxBrixelizerAABB aabb;           // the bounds and transform the instance was last voxelized with
+    FfxFloat32x3x4    transform;
+} FfxBrixelizerTrackedInstance;
+
 typedef struct FfxBrixelizerScratchSpace {
     union {
         struct {
@@ -88,6 +110,13 @@ typedef struct FfxBrixelizerScratchSpace {
         struct {
             FfxBrixelizerInstanceID instanceIDs[FFX_BRIXELIZER_MAX_INSTANCES];
         } update;
+        struct {
+            FfxBrixelizerInstanceID instanceIDs[FFX_BRIXELIZER_MAX_INSTANCES];
+            FfxBrixelizerAABB       dirtyRegions[FFX_BRIXELIZER_MAX_INSTANCES];
+            FfxBrixelizerAABB       inflatedDirtyRegions[FFX_BRIXELIZER_MAX_INSTANCES];
+            uint32_t                dirtyCellRegionEnds[FFX_BRIXELIZER_DIRTY_GRID_CELLS + 1];
+            uint32_t                dirtyCellRegions[FFX_BRIXELIZER_MAX_DIRTY_CELL_REGIONS];
+        } bake;
     };
 } FfxBrixelizerScratchSpace;
 
@@ -101,6 +130,13 @@ typedef struct FfxBrixelizerContext_Private {
     uint32_t                    dynamicInstanceStartIndex;
     uint32_t                    instanceIndices[FFX_BRIXELIZER_MAX_INSTANCES];
     FfxBrixelizerInstance       instances[FFX_BRIXELIZER_MAX_INSTANCES];
+    FfxBrixelizerBVH            staticInstanceBVH;
+    float                       dynamicInstanceMotionThreshold;
+    uint32_t                    dynamicFrameSerial;
+    uint32_t                    numDynamicInvalidations;
+    FfxBrixelizerInvalidation   dynamicInvalidations[FFX_BRIXELIZER_MAX_INSTANCES];
+    uint32_t                    numTrackedInstances;
+    FfxBrixelizerTrackedInstance trackedInstances[FFX_BRIXELIZER_TRACKED_DYNAMIC_INSTANCE_SLOTS];
     FfxBrixelizerScratchSpace   scratchSpace;
 } FfxBrixelizerContext_Private;
 
@@ -117,6 +153,8 @@ FfxErrorCode ffxBrixelizerContextCreate(const FfxBrixelizerContextDescription* d
 
     memset(outContext, 0, sizeof(*outContext));
     outContext->dynamicInstanceStartIndex = FFX_ARRAY_ELEMENTS(outContext->instances);
+    bvhInit(&outContext->staticInstanceBVH);
+    outContext->dynamicInstanceMotionThreshold = desc->dynamicInstanceMotionThreshold;
     RETURN_ON_FAIL(ffxBrixelizerRawContextCreate(&outContext->context, &rawDesc));
 
     uint32_t numStaticAndDynamicCascades = 0;
@@ -195,6 +233,246 @@ FfxErrorCode ffxBrixelizerContextDestroy(FfxBrixelizerContext* uncastContext)
     return FFX_OK;
 }
 
+static void requestDynamicCascadeReset(FfxBrixelizerContext_Private* context)
+{
+    ifor (context->numCascades) {
+        context->cascades[i].dynamicResetPending = true;
+    }
+    context->numDynamicInvalidations = 0;
+}
+
+static void addDynamicInvalidation(FfxBrixelizerContext_Private* context, FfxBrixelizerAABB aabb)
+{
+    FfxBrixelizerInvalidation invalidation = {};
+
+    uint32_t cascadesMask = 0;
+    ifor (context->numCascades) {
+        if ((context->cascades[i].flags & FFX_BRIXELIZER_CASCADE_DYNAMIC) && !context->cascades[i].dynamicResetPending) {
+            cascadesMask |= 1 << i;
+        }
+    }
+    if (!cascadesMask) {
+        return;
+    }
+    invalidation.cascades = cascadesMask;
+    invalidation.aabb = aabb;
+
+    // rebuild the dynamic cascades from scratch when there are too many changes to track
+    if (context->numDynamicInvalidations == FFX_ARRAY_ELEMENTS(context->dynamicInvalidations)) {
+        requestDynamicCascadeReset(context);
+        return;
+    }
+    context->dynamicInvalidations[context->numDynamicInvalidations++] = invalidation;
+}
+
+static uint32_t getTrackedInstanceHomeSlot(uint64_t key)
+{
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdull;
+    key ^= key >> 33;
+    return (uint32_t)key & (FFX_BRIXELIZER_TRACKED_DYNAMIC_INSTANCE_SLOTS - 1);
+}
+
+// Returns the slot holding key, or the empty slot it should be inserted in.
+static FfxBrixelizerTrackedInstance* findTrackedInstance(FfxBrixelizerContext_Private* context, uint64_t key)
+{
+    uint32_t slot = getTrackedInstanceHomeSlot(key);
+    while (context->trackedInstances[slot].key && context->trackedInstances[slot].key != key) {
+        slot = (slot + 1) & (FFX_BRIXELIZER_TRACKED_DYNAMIC_INSTANCE_SLOTS - 1);
+    }
+    return &context->trackedInstances[slot];
+}
+
+static void removeTrackedInstance(FfxBrixelizerContext_Private* context, uint32_t slot)
+{
+    const uint32_t mask = FFX_BRIXELIZER_TRACKED_DYNAMIC_INSTANCE_SLOTS - 1;
+
+    // shift back following entries of the probe sequence unless that would move them before their home slot
+    uint32_t hole = slot;
+    for (uint32_t next = (hole + 1) & mask; context->trackedInstances[next].key; next = (next + 1) & mask) {
+        uint32_t home = getTrackedInstanceHomeSlot(context->trackedInstances[next].key);
+        if (((next - home) & mask) >= ((next - hole) & mask)) {
+            context->trackedInstances[hole] = context->trackedInstances[next];
+            hole = next;
+        }
+    }
+    context->trackedInstances[hole].key = 0;
+    --context->numTrackedInstances;
+}
+
+static bool dynamicInstanceMoved(const FfxBrixelizerTrackedInstance* tracked, const FfxBrixelizerInstanceDescription* desc, float threshold)
+{
+    float extent = 0.0f;
+    ifor (3) {
+        if (fabsf(desc->aabb.min[i] - tracked->aabb.min[i]) > threshold) { return true; }
+        if (fabsf(desc->aabb.max[i] - tracked->aabb.max[i]) > threshold) { return true; }
+        float size = desc->aabb.max[i] - desc->aabb.min[i];
+        extent = size > extent ? size : extent;
+    }
+
+    // rotations can move geometry without changing its bounds, so estimate how far a point in the bounds has moved
+    const float *transform = desc->transform;
+    const float *trackedTransform = tracked->transform;
+    ifor (3) {
+        float delta = fabsf(transform[i * 4 + 3] - trackedTransform[i * 4 + 3]);
+        jfor (3) {
+            delta += fabsf(transform[i * 4 + j] - trackedTransform[i * 4 + j]) * extent;
+        }
+        if (delta > threshold) { return true; }
+    }
+    return false;
+}
+
+// Records a dynamic instance submitted this frame, invalidating the union of its old and new bounds when it has moved.
+static void trackDynamicInstance(FfxBrixelizerContext_Private* context, const FfxBrixelizerInstanceDescription* desc)
+{
+    if (!desc->dynamicInstanceKey) {
+        requestDynamicCascadeReset(context);
+        return;
+    }
+
+    FfxBrixelizerTrackedInstance *tracked = findTrackedInstance(context, desc->dynamicInstanceKey);
+    if (!tracked->key) {
+        if (context->numTrackedInstances == FFX_BRIXELIZER_MAX_TRACKED_DYNAMIC_INSTANCES) {
+            requestDynamicCascadeReset(context);
+            return;
+        }
+        tracked->key = desc->dynamicInstanceKey;
+        tracked->aabb = desc->aabb;
+        memcpy(tracked->transform, desc->transform, sizeof(tracked->transform));
+        ++context->numTrackedInstances;
+        addDynamicInvalidation(context, desc->aabb);
+    } else if (tracked->frameSerial == context->dynamicFrameSerial) {
+        // the key was submitted twice this frame so the instances can't be told apart
+        requestDynamicCascadeReset(context);
+        return;
+    } else if (dynamicInstanceMoved(tracked, desc, context->dynamicInstanceMotionThreshold)) {
+        FfxBrixelizerAABB aabb = tracked->aabb;
+        ifor (3) {
+            aabb.min[i] = desc->aabb.min[i] < aabb.min[i] ? desc->aabb.min[i] : aabb.min[i];
+            aabb.max[i] = desc->aabb.max[i] > aabb.max[i] ? desc->aabb.max[i] : aabb.max[i];
+        }
+        tracked->aabb = desc->aabb;
+        memcpy(tracked->transform, desc->transform, sizeof(tracked->transform));
+        addDynamicInvalidation(context, aabb);
+    }
+    tracked->frameSerial = context->dynamicFrameSerial;
+}
+
+// Invalidates and stops tracking dynamic instances which were not submitted this frame.
+static void retireDynamicInstances(FfxBrixelizerContext_Private* context)
+{
+    uint32_t slot = 0;
+    while (context->numTrackedInstances && slot < FFX_BRIXELIZER_TRACKED_DYNAMIC_INSTANCE_SLOTS) {
+        FfxBrixelizerTrackedInstance *tracked = &context->trackedInstances[slot];
+        if (tracked->key && tracked->frameSerial != context->dynamicFrameSerial) {
+            addDynamicInvalidation(context, tracked->aabb);
+            removeTrackedInstance(context, slot);
+            continue; // another entry may have been shifted into this slot
+        }
+        ++slot;
+    }
+}
+
+static FfxBrixelizerAABB inflateAABB(FfxBrixelizerAABB aabb, float margin)
+{
+    ifor (3) {
+        aabb.min[i] -= margin;
+        aabb.max[i] += margin;
+    }
+    return aabb;
+}
+
+typedef struct FfxBrixelizerDirtyCellRange {
+    uint32_t min[3];
+    uint32_t max[3];
+} FfxBrixelizerDirtyCellRange;
+
+// Gets the cells of a grid over the cascade covered by an AABB. Cells are clamped to the grid, so AABBs which overlap
+// always share a cell, even outside the cascade.
+static FfxBrixelizerDirtyCellRange getDirtyCellRange(FfxBrixelizerAABB aabb, FfxBrixelizerAABB cascadeAABB)
+{
+    const float maxCell = (float)(FFX_BRIXELIZER_DIRTY_GRID_RESOLUTION - 1);
+    FfxBrixelizerDirtyCellRange range;
+    ifor (3) {
+        float cellSize = (cascadeAABB.max[i] - cascadeAABB.min[i]) / (float)FFX_BRIXELIZER_DIRTY_GRID_RESOLUTION;
+        range.min[i] = (uint32_t)FFX_MINIMUM(FFX_MAXIMUM((aabb.min[i] - cascadeAABB.min[i]) / cellSize, 0.0f), maxCell);
+        range.max[i] = (uint32_t)FFX_MINIMUM(FFX_MAXIMUM((aabb.max[i] - cascadeAABB.min[i]) / cellSize, 0.0f), maxCell);
+    }
+    return range;
+}
+
+static uint32_t getDirtyCell(uint32_t x, uint32_t y, uint32_t z)
+{
+    return (z * FFX_BRIXELIZER_DIRTY_GRID_RESOLUTION + y) * FFX_BRIXELIZER_DIRTY_GRID_RESOLUTION + x;
+}
+
+static FfxBrixelizerAABB getCascadeAABB(const FfxBrixelizerCascadePrivate* cascadePrivate, const float sdfCenter[3])
+{
+    FfxBrixelizerAABB aabb = {};
+    ifor (3) {
+        float cascadeCenter = floorf(sdfCenter[i] / cascadePrivate->voxelSize);
+        aabb.min[i] = (cascadeCenter - (0.5f * (float)FFX_BRIXELIZER_CASCADE_RESOLUTION)) * cascadePrivate->voxelSize;
+        aabb.max[i] = aabb.min[i] + (cascadePrivate->voxelSize * (float)FFX_BRIXELIZER_CASCADE_RESOLUTION);
+    }
+    return aabb;
+}
+
+static uint32_t getCascadeToUpdateByCost(FfxBrixelizerContext_Private* context, const FfxBrixelizerUpdateDescription* desc)
+{
+    FfxBrixelizerRawCascadeSchedulingInfo cascadeInfos[FFX_BRIXELIZER_MAX_CASCADES] = {};
+
+    ifor (context->numCascades) {
+        FfxBrixelizerCascadePrivate *cascadePrivate = &context->cascades[i];
+        FfxBrixelizerRawCascadeSchedulingInfo *info = &cascadeInfos[i];
+        FfxBrixelizerAABB cascadeAABB = getCascadeAABB(cascadePrivate, desc->sdfCenter);
+
+        if (!cascadePrivate->hasBeenUpdated) {
+            info->framesSinceUpdate = UINT32_MAX;
+            continue;
+        }
+        info->framesSinceUpdate = desc->frameIndex - cascadePrivate->lastUpdateFrameIndex;
+
+        jfor (3) {
+            float displacement = fabsf(floorf(desc->sdfCenter[j] / cascadePrivate->voxelSize) - (float)cascadePrivate->lastUpdateClipmapOffset[j]);
+            info->displacement = displacement > info->displacement ? displacement : info->displacement;
+        }
+
+        if (cascadePrivate->flags & FFX_BRIXELIZER_CASCADE_STATIC) {
+            uint32_t cascadeMask = 1 << i;
+            jfor (context->numInvalidations) {
+                const FfxBrixelizerInvalidation *invalidation = &context->invalidations[j];
+                if ((invalidation->cascades & cascadeMask) && aabbsOverlap(invalidation->aabb, cascadeAABB)) {
+                    ++info->pendingInvalidations;
+                }
+            }
+            info->estimatedCost += cascadePrivate->lastNumInstanceJobs + info->pendingInvalidations;
+        }
+
+        // a dynamic cascade being rebuilt has all of its instances dirty, otherwise only those that moved
+        if (cascadePrivate->flags & FFX_BRIXELIZER_CASCADE_DYNAMIC) {
+            if (cascadePrivate->dynamicResetPending) {
+                for (uint32_t j = context->dynamicInstanceStartIndex; j < FFX_ARRAY_ELEMENTS(context->instances); ++j) {
+                    if (aabbsOverlap(context->instances[j].aabb, cascadeAABB)) {
+                        ++info->dirtyInstances;
+                    }
+                }
+            } else {
+                uint32_t cascadeMask = 1 << i;
+                jfor (context->numDynamicInvalidations) {
+                    const FfxBrixelizerInvalidation *invalidation = &context->dynamicInvalidations[j];
+                    if ((invalidation->cascades & cascadeMask) && aabbsOverlap(invalidation->aabb, cascadeAABB)) {
+                        ++info->dirtyInstances;
+                    }
+                }
+            }
+            info->estimatedCost += info->dirtyInstances;
+        }
+    }
+
+    return ffxBrixelizerRawGetCascadeToUpdateByCost(cascadeInfos, context->numCascades, desc->maxJobsPerUpdate);
+}
+
 FfxErrorCode ffxBrixelizerBakeUpdate(FfxBrixelizerContext* uncastContext, const FfxBrixelizerUpdateDescription* desc, FfxBrixelizerBakedUpdateDescription* uncastOutDesc)
 {
     FfxBrixelizerContext_Private *context = (FfxBrixelizerContext_Private*)uncastContext;
@@ -202,7 +480,11 @@ FfxErrorCode ffxBrixelizerBakeUpdate(FfxBrixelizerContext* uncastContext, const
 
     memset(outDesc, 0, sizeof(*outDesc));
 
-    uint32_t cascadeIndex = ffxBrixelizerRawGetCascadeToUpdate(desc->frameIndex, context->numCascades);
+    retireDynamicInstances(context);
+
+    uint32_t cascadeIndex = desc->cascadeSchedulingMode == FFX_BRIXELIZER_CASCADE_SCHEDULING_COST_AWARE
+                          ? getCascadeToUpdateByCost(context, desc)
+                          : ffxBrixelizerRawGetCascadeToUpdate(desc->frameIndex, context->numCascades);
 
     outDesc->resources = desc->resources;
     outDesc->cascadeUpdateDesc.cascadeIndex = cascadeIndex;
@@ -226,34 +508,78 @@ FfxErrorCode ffxBrixelizerBakeUpdate(FfxBrixelizerContext* uncastContext, const
     outDesc->numStaticJobs = 0;
     outDesc->numDynamicJobs = 0;
 
-    FfxBrixelizerAABB casacadeAABB = {};
+    FfxBrixelizerAABB casacadeAABB = getCascadeAABB(cascadePrivate, desc->sdfCenter);
+
+    bool cascadeMoved = !cascadePrivate->hasBeenUpdated;
+    ifor (3) {
+        cascadeMoved |= cascadePrivate->lastUpdateClipmapOffset[i] != cascadeUpdateDesc->clipmapOffset[i];
+    }
+
+    FfxBrixelizerAABB previousCascadeAABB = {};
     ifor (3) {
-        casacadeAABB.min[i] = cascadeUpdateDesc->cascadeMin[i];
-        casacadeAABB.max[i] = casacadeAABB.min[i] + (cascadePrivate->voxelSize * (float)FFX_BRIXELIZER_CASCADE_RESOLUTION);
+        previousCascadeAABB.min[i] = ((float)cascadePrivate->lastUpdateClipmapOffset[i] - (0.5f * (float)FFX_BRIXELIZER_CASCADE_RESOLUTION)) * cascadePrivate->voxelSize;
+        previousCascadeAABB.max[i] = previousCascadeAABB.min[i] + (cascadePrivate->voxelSize * (float)FFX_BRIXELIZER_CASCADE_RESOLUTION);
+    }
+    bool queryWholeCascade = !cascadePrivate->hasBeenUpdated || cascadePrivate->staticRequeryPending;
+    cascadePrivate->staticRequeryPending = false;
+
+    cascadePrivate->hasBeenUpdated = true;
+    cascadePrivate->lastUpdateFrameIndex = desc->frameIndex;
+    ifor (3) {
+        cascadePrivate->lastUpdateClipmapOffset[i] = cascadeUpdateDesc->clipmapOffset[i];
     }
 
     // create static jobs
     if (cascadePrivate->flags & FFX_BRIXELIZER_CASCADE_STATIC) {
         FfxBrixelizerRawJobDescription *curJob = outDesc->staticJobs;
+        uint32_t cascadeMask = 1 << cascadeIndex;
 
-        // Create instance jobs
-        ifor (context->numStaticInstances) {
-            FfxBrixelizerInstance *instance = &context->instances[i];
-            if (aabbsOverlap(instance->aabb, casacadeAABB)) {
-                FfxBrixelizerRawJobDescription job = {};
-                ifor (3) {
-                    job.aabbMin[i] = instance->aabb.min[i];
-                    job.aabbMax[i] = instance->aabb.max[i];
+        // Static bricks persist between updates, so only the instances overlapping the bricks this update builds need
+        // jobs: those in the region the cascade scrolled into and those under invalidations, which are added for
+        // created and deleted instances. Like dynamic dirty regions, the regions are grown by the voxels the raw
+        // context clears around them. The whole cascade is queried on its first update, after a bake ran out of
+        // scratch space (bricks which failed to allocate are only retried by resubmitting their instances), and when
+        // there are too many regions for the query to be cheaper.
+        float staticRegionMargin = 3.0f * cascadePrivate->voxelSize;
+        FfxBrixelizerAABB queryRegions[FFX_BRIXELIZER_MAX_STATIC_QUERY_REGIONS];
+        uint32_t numQueryRegions = 0;
+        if (!queryWholeCascade) {
+            numQueryRegions = bvhSubtract(casacadeAABB, previousCascadeAABB, queryRegions);
+            ifor (numQueryRegions) {
+                queryRegions[i] = inflateAABB(queryRegions[i], staticRegionMargin);
+            }
+            ifor (context->numInvalidations) {
+                const FfxBrixelizerInvalidation *invalidation = &context->invalidations[i];
+                if ((invalidation->cascades & cascadeMask) && aabbsOverlap(invalidation->aabb, casacadeAABB)) {
+                    if (numQueryRegions == FFX_ARRAY_ELEMENTS(queryRegions)) {
+                        queryWholeCascade = true;
+                        break;
+                    }
+                    queryRegions[numQueryRegions++] = inflateAABB(invalidation->aabb, staticRegionMargin);
                 }
-                job.instanceIdx = instance->id;
-                *curJob++ = job;
-                outDesc->numStaticJobs++;
-                FFX_ASSERT(outDesc->numStaticJobs <= FFX_ARRAY_ELEMENTS(outDesc->staticJobs));
             }
         }
 
+        // Create instance jobs for the static instances overlapping the queried regions
+        FfxBrixelizerInstanceID *instanceIDs = context->scratchSpace.bake.instanceIDs;
+        uint32_t numInstanceIDs = queryWholeCascade
+                                ? bvhQuery(&context->staticInstanceBVH, casacadeAABB, instanceIDs, FFX_ARRAY_ELEMENTS(context->scratchSpace.bake.instanceIDs))
+                                : bvhQueryAny(&context->staticInstanceBVH, queryRegions, numQueryRegions, instanceIDs, FFX_ARRAY_ELEMENTS(context->scratchSpace.bake.instanceIDs));
+        ifor (numInstanceIDs) {
+            FfxBrixelizerInstance *instance = &context->instances[context->instanceIndices[instanceIDs[i]]];
+            FfxBrixelizerRawJobDescription job = {};
+            ifor (3) {
+                job.aabbMin[i] = instance->aabb.min[i];
+                job.aabbMax[i] = instance->aabb.max[i];
+            }
+            job.instanceIdx = instance->id;
+            *curJob++ = job;
+            outDesc->numStaticJobs++;
+            FFX_ASSERT(outDesc->numStaticJobs <= FFX_ARRAY_ELEMENTS(outDesc->staticJobs));
+        }
+        cascadePrivate->lastNumInstanceJobs = numInstanceIDs;
+
         // Create invalidations
-        uint32_t cascadeMask = 1 << cascadeIndex;
         uint32_t curInvalidation= 0;
         while (curInvalidation < context->numInvalidations) {
             FfxBrixelizerInvalidation *invalidation = &context->invalidations[curInvalidation];
@@ -282,17 +608,136 @@ FfxErrorCode ffxBrixelizerBakeUpdate(FfxBrixelizerContext* uncastContext, const
     // create dynamic jobs
     if (cascadePrivate->flags & FFX_BRIXELIZER_CASCADE_DYNAMIC) {
         FfxBrixelizerRawJobDescription *job = outDesc->dynamicJobs;
+        uint32_t numDynamicInstances = FFX_ARRAY_ELEMENTS(context->instances) - context->dynamicInstanceStartIndex;
+
+        // The raw context inflates invalidations and instance jobs by a voxel and snaps them to voxels, so a region
+        // clears voxels of instances up to three voxels away from it, which then have to be voxelized again too
+        float dirtyRegionMargin = 3.0f * cascadePrivate->voxelSize;
 
-        // Create instance jobs
-        outDesc->numDynamicJobs = FFX_ARRAY_ELEMENTS(context->instances) - context->dynamicInstanceStartIndex;
-        for (uint32_t i = context->dynamicInstanceStartIndex; i < FFX_ARRAY_ELEMENTS(context->instances); ++i) {
-            jfor (3) {
-                job->aabbMin[j] = context->instances[i].aabb.min[j];
-                job->aabbMax[j] = context->instances[i].aabb.max[j];
+        // Gather the regions changed by tracked dynamic instances since the cascade was last updated
+        FfxBrixelizerAABB *dirtyRegions = context->scratchSpace.bake.dirtyRegions;
+        uint32_t numDirtyRegions = 0;
+        uint32_t cascadeMask = 1 << cascadeIndex;
+        uint32_t curInvalidation = 0;
+        while (curInvalidation < context->numDynamicInvalidations) {
+            FfxBrixelizerInvalidation *invalidation = &context->dynamicInvalidations[curInvalidation];
+            if (invalidation->cascades & cascadeMask) {
+                if (aabbsOverlap(inflateAABB(invalidation->aabb, dirtyRegionMargin), casacadeAABB)) {
+                    dirtyRegions[numDirtyRegions++] = invalidation->aabb;
+                }
+                invalidation->cascades &= ~cascadeMask;
+                if (!invalidation->cascades) {
+                    context->dynamicInvalidations[curInvalidation] = context->dynamicInvalidations[--context->numDynamicInvalidations];
+                    continue;
+                }
             }
-            job->instanceIdx = context->instances[i].id;
-            ++job;
+            ++curInvalidation;
         }
+
+        // Rebuild the cascade from scratch unless only the dirty regions need voxelizing again, and that takes fewer jobs
+        bool resetCascade = cascadeMoved || cascadePrivate->dynamicResetPending || numDirtyRegions > numDynamicInstances;
+        cascadePrivate->dynamicResetPending = false;
+
+        // Create instance jobs for the instances touching a dirty region. The regions are bucketed by the cells of a
+        // coarse grid over the cascade they cover, so each instance is only tested against the regions sharing a cell
+        // with it, unless the regions cover too many cells to bucket.
+        if (!resetCascade) {
+            FfxBrixelizerAABB *inflatedDirtyRegions = context->scratchSpace.bake.inflatedDirtyRegions;
+            uint32_t *cellRegionEnds = context->scratchSpace.bake.dirtyCellRegionEnds;
+            uint32_t *cellRegions = context->scratchSpace.bake.dirtyCellRegions;
+            uint32_t numCellRegions = 0;
+            memset(cellRegionEnds, 0, sizeof(context->scratchSpace.bake.dirtyCellRegionEnds));
+            ifor (numDirtyRegions) {
+                inflatedDirtyRegions[i] = inflateAABB(dirtyRegions[i], dirtyRegionMargin);
+                FfxBrixelizerDirtyCellRange range = getDirtyCellRange(inflatedDirtyRegions[i], casacadeAABB);
+                for (uint32_t z = range.min[2]; z <= range.max[2]; ++z) {
+                    for (uint32_t y = range.min[1]; y <= range.max[1]; ++y) {
+                        for (uint32_t x = range.min[0]; x <= range.max[0]; ++x) {
+                            ++cellRegionEnds[getDirtyCell(x, y, z) + 1];
+                            ++numCellRegions;
+                        }
+                    }
+                }
+            }
+            bool bucketed = numCellRegions <= FFX_BRIXELIZER_MAX_DIRTY_CELL_REGIONS;
+            if (bucketed) {
+                // count the regions of each cell, then fill the cells so cell c ends up holding [ends[c - 1], ends[c])
+                ifor (FFX_BRIXELIZER_DIRTY_GRID_CELLS) {
+                    cellRegionEnds[i + 1] += cellRegionEnds[i];
+                }
+                ifor (numDirtyRegions) {
+                    FfxBrixelizerDirtyCellRange range = getDirtyCellRange(inflatedDirtyRegions[i], casacadeAABB);
+                    for (uint32_t z = range.min[2]; z <= range.max[2]; ++z) {
+                        for (uint32_t y = range.min[1]; y <= range.max[1]; ++y) {
+                            for (uint32_t x = range.min[0]; x <= range.max[0]; ++x) {
+                                cellRegions[cellRegionEnds[getDirtyCell(x, y, z)]++] = i;
+                            }
+                        }
+                    }
+                }
+            }
+
+            for (uint32_t i = context->dynamicInstanceStartIndex; i < FFX_ARRAY_ELEMENTS(context->instances); ++i) {
+                const FfxBrixelizerInstance *instance = &context->instances[i];
+                bool dirty = false;
+                if (bucketed) {
+                    FfxBrixelizerDirtyCellRange range = getDirtyCellRange(instance->aabb, casacadeAABB);
+                    for (uint32_t z = range.min[2]; z <= range.max[2] && !dirty; ++z) {
+                        for (uint32_t y = range.min[1]; y <= range.max[1] && !dirty; ++y) {
+                            for (uint32_t x = range.min[0]; x <= range.max[0] && !dirty; ++x) {
+                                uint32_t cell = getDirtyCell(x, y, z);
+                                for (uint32_t j = cell ? cellRegionEnds[cell - 1] : 0; j < cellRegionEnds[cell] && !dirty; ++j) {
+                                    dirty = aabbsOverlap(instance->aabb, inflatedDirtyRegions[cellRegions[j]]);
+                                }
+                            }
+                        }
+                    }
+                } else {
+                    for (uint32_t j = 0; j < numDirtyRegions && !dirty; ++j) {
+                        dirty = aabbsOverlap(instance->aabb, inflatedDirtyRegions[j]);
+                    }
+                }
+                if (dirty) {
+                    jfor (3) {
+                        job->aabbMin[j] = instance->aabb.min[j];
+                        job->aabbMax[j] = instance->aabb.max[j];
+                    }
+                    job->instanceIdx = instance->id;
+                    ++job;
+                }
+            }
+
+            // when the dirty regions touch most instances, rebuilding takes fewer jobs
+            uint32_t numInstanceJobs = (uint32_t)(job - outDesc->dynamicJobs);
+            if (numInstanceJobs + numDirtyRegions > numDynamicInstances) {
+                resetCascade = true;
+                job = outDesc->dynamicJobs;
+            }
+        }
+        outDesc->dynamicCascadeUpdateFlags = resetCascade ? FFX_BRIXELIZER_CASCADE_UPDATE_FLAG_RESET : FFX_BRIXELIZER_CASCADE_UPDATE_FLAG_NONE;
+
+        if (resetCascade) {
+            // Create instance jobs for every instance
+            for (uint32_t i = context->dynamicInstanceStartIndex; i < FFX_ARRAY_ELEMENTS(context->instances); ++i) {
+                jfor (3) {
+                    job->aabbMin[j] = context->instances[i].aabb.min[j];
+                    job->aabbMax[j] = context->instances[i].aabb.max[j];
+                }
+                job->instanceIdx = context->instances[i].id;
+                ++job;
+            }
+        } else {
+            // Create invalidations
+            ifor (numDirtyRegions) {
+                jfor (3) {
+                    job->aabbMin[j] = dirtyRegions[i].min[j];
+                    job->aabbMax[j] = dirtyRegions[i].max[j];
+                }
+                job->flags = FFX_BRIXELIZER_RAW_JOB_FLAG_INVALIDATE;
+                ++job;
+            }
+        }
+        outDesc->numDynamicJobs = (uint32_t)(job - outDesc->dynamicJobs);
     }
 
     if (desc->outScratchBufferSize) {
@@ -310,7 +755,7 @@ FfxErrorCode ffxBrixelizerBakeUpdate(FfxBrixelizerContext* uncastContext, const
         if (context->cascades[cascadeIndex].flags & FFX_BRIXELIZER_CASCADE_DYNAMIC) {
             cascadeUpdateDesc->numJobs = outDesc->numDynamicJobs;
             cascadeUpdateDesc->jobs = outDesc->dynamicJobs;
-            cascadeUpdateDesc->flags = FFX_BRIXELIZER_CASCADE_UPDATE_FLAG_RESET;
+            cascadeUpdateDesc->flags = outDesc->dynamicCascadeUpdateFlags;
             FFX_VALIDATE(ffxBrixelizerRawContextGetScratchMemorySize(&context->context, cascadeUpdateDesc, &dynamicSize));
         }
 
@@ -346,6 +791,15 @@ FfxErrorCode ffxBrixelizerUpdate(FfxBrixelizerContext* uncastContext, FfxBrixeli
         desc->cascadeUpdateDesc.jobs = desc->staticJobs;
         desc->cascadeUpdateDesc.flags = FFX_BRIXELIZER_CASCADE_UPDATE_FLAG_NONE;
         ffxBrixelizerRawContextUpdateCascade(&context->context, &desc->cascadeUpdateDesc);
+
+        // A bake running out of scratch space drops bricks, which only a bake of the whole cascade builds again. The
+        // counters are those of an earlier bake, and are only read back with FFX_BRIXELIZER_CONTEXT_FLAG_DEBUG_CASCADE_READBACK_BUFFERS.
+        FfxBrixelizerScratchCounters scratchCounters = {};
+        ffxBrixelizerRawContextGetCascadeCounters(&context->context, staticCascadeIndex, &scratchCounters);
+        if (scratchCounters.triangles > scratchCounters.maxTriangles || scratchCounters.references > scratchCounters.maxReferences ||
+            scratchCounters.numBricksAllocated > desc->cascadeUpdateDesc.maxBricksPerBake) {
+            cascadePrivate->staticRequeryPending = true;
+        }
     }
 
     // update dynamic cascade
@@ -353,7 +807,7 @@ FfxErrorCode ffxBrixelizerUpdate(FfxBrixelizerContext* uncastContext, FfxBrixeli
         desc->cascadeUpdateDesc.cascadeIndex = dynamicCascadeIndex;
         desc->cascadeUpdateDesc.numJobs = desc->numDynamicJobs;
         desc->cascadeUpdateDesc.jobs = desc->dynamicJobs;
-        desc->cascadeUpdateDesc.flags = FFX_BRIXELIZER_CASCADE_UPDATE_FLAG_RESET;
+        desc->cascadeUpdateDesc.flags = desc->dynamicCascadeUpdateFlags;
         ffxBrixelizerRawContextUpdateCascade(&context->context, &desc->cascadeUpdateDesc);
     }
 
@@ -443,6 +897,7 @@ FfxErrorCode ffxBrixelizerUpdate(FfxBrixelizerContext* uncastContext, FfxBrixeli
         }
         ffxBrixelizerRawContextDestroyInstances(&context->context, instanceIDs, FFX_ARRAY_ELEMENTS(context->instances) - context->dynamicInstanceStartIndex);
         context->dynamicInstanceStartIndex = FFX_ARRAY_ELEMENTS(context->instances);
+        ++context->dynamicFrameSerial;
     }
 
     if (desc->outStats) {
@@ -560,6 +1015,8 @@ FfxErrorCode ffxBrixelizerCreateInstances(FfxBrixelizerContext* uncastContext, c
 
             instance->id = instanceID;
             instance->aabb = desc->aabb;
+
+            trackDynamicInstance(context, desc);
         } else {
             uint32_t instanceIndex = context->numStaticInstances++;
             FfxBrixelizerInstance *instance = &context->instances[instanceIndex];
@@ -567,6 +1024,7 @@ FfxErrorCode ffxBrixelizerCreateInstances(FfxBrixelizerContext* uncastContext, c
             instance->id = instanceID;
             instance->aabb = desc->aabb;
             context->instanceIndices[instanceID] = instanceIndex;
+            bvhInsert(&context->staticInstanceBVH, instanceID, desc->aabb);
 
             addInvalidationJob(context, desc->aabb);
 
@@ -592,6 +1050,7 @@ FfxErrorCode ffxBrixelizerDeleteInstances(FfxBrixelizerContext* uncastContext, c
         FfxBrixelizerInstance instance = context->instances[index];
 
         addInvalidationJob(context, instance.aabb);
+        bvhRemove(&context->staticInstanceBVH, instanceID);
 
         instance = context->instances[--context->numStaticInstances];
         context->instances[index] = instance;
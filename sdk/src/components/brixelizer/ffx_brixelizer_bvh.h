@@ -0,0 +1,355 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <FidelityFX/host/ffx_brixelizer.h>
+
+// Incrementally maintained bounding volume hierarchy over static instance bounds, used to find the instances
+// overlapping a cascade, or only the regions of it which need voxelizing, without scanning every instance. Leaves are inserted next to the sibling that grows the
+// tree's surface area the least and the tree is kept height balanced with rotations, so insertion, removal and
+// queries stay logarithmic in the instance count. All nodes live in a fixed pool inside the context.
+
+#define FFX_BRIXELIZER_BVH_NULL_NODE  (~0u)
+#define FFX_BRIXELIZER_BVH_MAX_NODES  (2 * FFX_BRIXELIZER_MAX_INSTANCES)
+#define FFX_BRIXELIZER_BVH_STACK_SIZE 128
+
+typedef struct FfxBrixelizerBVHNode {
+    FfxBrixelizerAABB       aabb;
+    uint32_t                parent;         // next free node while the node is unused
+    uint32_t                children[2];    // FFX_BRIXELIZER_BVH_NULL_NODE for leaves
+    int32_t                 height;         // 0 for leaves, -1 for unused nodes
+    FfxBrixelizerInstanceID instanceID;     // leaves only
+} FfxBrixelizerBVHNode;
+
+typedef struct FfxBrixelizerBVH {
+    uint32_t             root;
+    uint32_t             freeList;
+    FfxBrixelizerBVHNode nodes[FFX_BRIXELIZER_BVH_MAX_NODES];
+    uint32_t             leaves[FFX_BRIXELIZER_MAX_INSTANCES];  // leaf node of each instance ID
+} FfxBrixelizerBVH;
+
+static inline bool bvhIsLeaf(const FfxBrixelizerBVHNode* node)
+{
+    return node->children[0] == FFX_BRIXELIZER_BVH_NULL_NODE;
+}
+
+static inline FfxBrixelizerAABB bvhUnion(FfxBrixelizerAABB x, FfxBrixelizerAABB y)
+{
+    FfxBrixelizerAABB result;
+    for (uint32_t i = 0; i < 3; ++i) {
+        result.min[i] = x.min[i] < y.min[i] ? x.min[i] : y.min[i];
+        result.max[i] = x.max[i] > y.max[i] ? x.max[i] : y.max[i];
+    }
+    return result;
+}
+
+static inline float bvhArea(FfxBrixelizerAABB aabb)
+{
+    float dx = aabb.max[0] - aabb.min[0];
+    float dy = aabb.max[1] - aabb.min[1];
+    float dz = aabb.max[2] - aabb.min[2];
+    return 2.0f * (dx * dy + dy * dz + dz * dx);
+}
+
+static inline bool bvhOverlap(FfxBrixelizerAABB x, FfxBrixelizerAABB y)
+{
+    for (uint32_t i = 0; i < 3; ++i) {
+        if (x.min[i] > y.max[i]) { return false; }
+        if (y.min[i] > x.max[i]) { return false; }
+    }
+    return true;
+}
+
+static void bvhInit(FfxBrixelizerBVH* bvh)
+{
+    bvh->root = FFX_BRIXELIZER_BVH_NULL_NODE;
+    for (uint32_t i = 0; i < FFX_BRIXELIZER_BVH_MAX_NODES; ++i) {
+        bvh->nodes[i].parent = i + 1 < FFX_BRIXELIZER_BVH_MAX_NODES ? i + 1 : FFX_BRIXELIZER_BVH_NULL_NODE;
+        bvh->nodes[i].height = -1;
+    }
+    bvh->freeList = 0;
+    for (uint32_t i = 0; i < FFX_BRIXELIZER_MAX_INSTANCES; ++i) {
+        bvh->leaves[i] = FFX_BRIXELIZER_BVH_NULL_NODE;
+    }
+}
+
+static uint32_t bvhAllocateNode(FfxBrixelizerBVH* bvh)
+{
+    FFX_ASSERT(bvh->freeList != FFX_BRIXELIZER_BVH_NULL_NODE);
+    uint32_t index = bvh->freeList;
+    FfxBrixelizerBVHNode* node = &bvh->nodes[index];
+    bvh->freeList = node->parent;
+    node->parent = FFX_BRIXELIZER_BVH_NULL_NODE;
+    node->children[0] = FFX_BRIXELIZER_BVH_NULL_NODE;
+    node->children[1] = FFX_BRIXELIZER_BVH_NULL_NODE;
+    node->height = 0;
+    node->instanceID = FFX_BRIXELIZER_INVALID_ID;
+    return index;
+}
+
+static void bvhFreeNode(FfxBrixelizerBVH* bvh, uint32_t index)
+{
+    bvh->nodes[index].parent = bvh->freeList;
+    bvh->nodes[index].height = -1;
+    bvh->freeList = index;
+}
+
+static void bvhRefit(FfxBrixelizerBVH* bvh, uint32_t index)
+{
+    FfxBrixelizerBVHNode* node = &bvh->nodes[index];
+    const FfxBrixelizerBVHNode* a = &bvh->nodes[node->children[0]];
+    const FfxBrixelizerBVHNode* b = &bvh->nodes[node->children[1]];
+    node->aabb = bvhUnion(a->aabb, b->aabb);
+    node->height = 1 + (a->height > b->height ? a->height : b->height);
+}
+
+// Promotes a grandchild of the taller side of index to restore balance and returns the root of the subtree.
+static uint32_t bvhBalance(FfxBrixelizerBVH* bvh, uint32_t index)
+{
+    FfxBrixelizerBVHNode* node = &bvh->nodes[index];
+    if (bvhIsLeaf(node) || node->height < 2) {
+        return index;
+    }
+
+    int32_t balance = bvh->nodes[node->children[1]].height - bvh->nodes[node->children[0]].height;
+    if (balance >= -1 && balance <= 1) {
+        return index;
+    }
+
+    // tall is the taller child, short the other one
+    uint32_t tallSide = balance > 0 ? 1 : 0;
+    uint32_t tallIndex = node->children[tallSide];
+    FfxBrixelizerBVHNode* tall = &bvh->nodes[tallIndex];
+
+    // tall takes the place of node
+    tall->parent = node->parent;
+    node->parent = tallIndex;
+    if (tall->parent == FFX_BRIXELIZER_BVH_NULL_NODE) {
+        bvh->root = tallIndex;
+    } else {
+        FfxBrixelizerBVHNode* parent = &bvh->nodes[tall->parent];
+        parent->children[parent->children[0] == index ? 0 : 1] = tallIndex;
+    }
+
+    // the taller grandchild stays under tall, the shorter one moves under node
+    uint32_t f = tall->children[0];
+    uint32_t g = tall->children[1];
+    if (bvh->nodes[f].height < bvh->nodes[g].height) {
+        uint32_t swap = f;
+        f = g;
+        g = swap;
+    }
+
+    tall->children[0] = index;
+    tall->children[1] = f;
+    node->children[tallSide] = g;
+    bvh->nodes[g].parent = index;
+
+    bvhRefit(bvh, index);
+    bvhRefit(bvh, tallIndex);
+    return tallIndex;
+}
+
+static void bvhFixUpwards(FfxBrixelizerBVH* bvh, uint32_t index)
+{
+    while (index != FFX_BRIXELIZER_BVH_NULL_NODE) {
+        index = bvhBalance(bvh, index);
+        bvhRefit(bvh, index);
+        index = bvh->nodes[index].parent;
+    }
+}
+
+static void bvhInsert(FfxBrixelizerBVH* bvh, FfxBrixelizerInstanceID instanceID, FfxBrixelizerAABB aabb)
+{
+    FFX_ASSERT(instanceID < FFX_BRIXELIZER_MAX_INSTANCES);
+    FFX_ASSERT(bvh->leaves[instanceID] == FFX_BRIXELIZER_BVH_NULL_NODE);
+
+    uint32_t leaf = bvhAllocateNode(bvh);
+    bvh->nodes[leaf].aabb = aabb;
+    bvh->nodes[leaf].instanceID = instanceID;
+    bvh->leaves[instanceID] = leaf;
+
+    if (bvh->root == FFX_BRIXELIZER_BVH_NULL_NODE) {
+        bvh->root = leaf;
+        return;
+    }
+
+    // descend towards the sibling whose enlargement costs the least surface area
+    uint32_t sibling = bvh->root;
+    while (!bvhIsLeaf(&bvh->nodes[sibling])) {
+        const FfxBrixelizerBVHNode* node = &bvh->nodes[sibling];
+        float area = bvhArea(node->aabb);
+        float combinedArea = bvhArea(bvhUnion(node->aabb, aabb));
+
+        // cost of making a new parent for this node and the leaf, and the minimum cost pushed down to the children
+        float cost = 2.0f * combinedArea;
+        float inheritanceCost = 2.0f * (combinedArea - area);
+
+        float childCosts[2];
+        for (uint32_t i = 0; i < 2; ++i) {
+            const FfxBrixelizerBVHNode* child = &bvh->nodes[node->children[i]];
+            float enlargedArea = bvhArea(bvhUnion(child->aabb, aabb));
+            childCosts[i] = (bvhIsLeaf(child) ? enlargedArea : enlargedArea - bvhArea(child->aabb)) + inheritanceCost;
+        }
+
+        if (cost < childCosts[0] && cost < childCosts[1]) {
+            break;
+        }
+        sibling = node->children[childCosts[0] < childCosts[1] ? 0 : 1];
+    }
+
+    // splice a new parent in above the sibling
+    uint32_t oldParent = bvh->nodes[sibling].parent;
+    uint32_t newParent = bvhAllocateNode(bvh);
+    bvh->nodes[newParent].parent = oldParent;
+    bvh->nodes[newParent].children[0] = sibling;
+    bvh->nodes[newParent].children[1] = leaf;
+    bvh->nodes[sibling].parent = newParent;
+    bvh->nodes[leaf].parent = newParent;
+
+    if (oldParent == FFX_BRIXELIZER_BVH_NULL_NODE) {
+        bvh->root = newParent;
+    } else {
+        FfxBrixelizerBVHNode* parent = &bvh->nodes[oldParent];
+        parent->children[parent->children[0] == sibling ? 0 : 1] = newParent;
+    }
+
+    bvhFixUpwards(bvh, newParent);
+}
+
+static void bvhRemove(FfxBrixelizerBVH* bvh, FfxBrixelizerInstanceID instanceID)
+{
+    FFX_ASSERT(instanceID < FFX_BRIXELIZER_MAX_INSTANCES);
+    uint32_t leaf = bvh->leaves[instanceID];
+    if (leaf == FFX_BRIXELIZER_BVH_NULL_NODE) {
+        return;
+    }
+    bvh->leaves[instanceID] = FFX_BRIXELIZER_BVH_NULL_NODE;
+
+    uint32_t parent = bvh->nodes[leaf].parent;
+    bvhFreeNode(bvh, leaf);
+
+    if (parent == FFX_BRIXELIZER_BVH_NULL_NODE) {
+        bvh->root = FFX_BRIXELIZER_BVH_NULL_NODE;
+        return;
+    }
+
+    // the sibling takes the place of the parent
+    FfxBrixelizerBVHNode* parentNode = &bvh->nodes[parent];
+    uint32_t sibling = parentNode->children[parentNode->children[0] == leaf ? 1 : 0];
+    uint32_t grandParent = parentNode->parent;
+    bvh->nodes[sibling].parent = grandParent;
+    bvhFreeNode(bvh, parent);
+
+    if (grandParent == FFX_BRIXELIZER_BVH_NULL_NODE) {
+        bvh->root = sibling;
+    } else {
+        FfxBrixelizerBVHNode* grandParentNode = &bvh->nodes[grandParent];
+        grandParentNode->children[grandParentNode->children[0] == parent ? 0 : 1] = sibling;
+        bvhFixUpwards(bvh, grandParent);
+    }
+}
+
+// Writes the IDs of all instances whose bounds overlap any of aabbs, each once, and returns how many there are.
+static uint32_t bvhQueryAny(const FfxBrixelizerBVH* bvh, const FfxBrixelizerAABB* aabbs, uint32_t numAABBs, FfxBrixelizerInstanceID* outInstanceIDs, uint32_t maxInstanceIDs)
+{
+    if (bvh->root == FFX_BRIXELIZER_BVH_NULL_NODE) {
+        return 0;
+    }
+
+    if (numAABBs == 0) {
+        return 0;
+    }
+
+    // nodes outside the bounds of all the boxes are rejected with a single test
+    FfxBrixelizerAABB bounds = aabbs[0];
+    for (uint32_t i = 1; i < numAABBs; ++i) {
+        bounds = bvhUnion(bounds, aabbs[i]);
+    }
+
+    uint32_t numInstanceIDs = 0;
+    uint32_t stack[FFX_BRIXELIZER_BVH_STACK_SIZE];
+    uint32_t stackSize = 0;
+    stack[stackSize++] = bvh->root;
+
+    while (stackSize) {
+        const FfxBrixelizerBVHNode* node = &bvh->nodes[stack[--stackSize]];
+        if (!bvhOverlap(node->aabb, bounds)) {
+            continue;
+        }
+        bool overlap = false;
+        for (uint32_t i = 0; i < numAABBs && !overlap; ++i) {
+            overlap = bvhOverlap(node->aabb, aabbs[i]);
+        }
+        if (!overlap) {
+            continue;
+        }
+
+        if (bvhIsLeaf(node)) {
+            FFX_ASSERT(numInstanceIDs < maxInstanceIDs);
+            if (numInstanceIDs < maxInstanceIDs) {
+                outInstanceIDs[numInstanceIDs++] = node->instanceID;
+            }
+        } else {
+            FFX_ASSERT(stackSize + 2 <= FFX_BRIXELIZER_BVH_STACK_SIZE);
+            stack[stackSize++] = node->children[0];
+            stack[stackSize++] = node->children[1];
+        }
+    }
+
+    return numInstanceIDs;
+}
+
+// Writes the IDs of all instances whose bounds overlap aabb and returns how many there are.
+static uint32_t bvhQuery(const FfxBrixelizerBVH* bvh, FfxBrixelizerAABB aabb, FfxBrixelizerInstanceID* outInstanceIDs, uint32_t maxInstanceIDs)
+{
+    return bvhQueryAny(bvh, &aabb, 1, outInstanceIDs, maxInstanceIDs);
+}
+
+// Splits the part of current outside of previous into at most 6 boxes which only share faces (3 when both boxes have
+// the same size, as the boxes of a scrolling cascade do) and returns how many there are. Boxes are closed like
+// instance bounds, so the slabs include the faces they share with previous.
+static uint32_t bvhSubtract(FfxBrixelizerAABB current, FfxBrixelizerAABB previous, FfxBrixelizerAABB outRegions[6])
+{
+    if (!bvhOverlap(current, previous)) {
+        outRegions[0] = current;
+        return 1;
+    }
+
+    // cut the slabs sticking out of previous off what is left of current, one axis at a time
+    uint32_t numRegions = 0;
+    FfxBrixelizerAABB remaining = current;
+    for (uint32_t i = 0; i < 3; ++i) {
+        if (remaining.min[i] < previous.min[i]) {
+            outRegions[numRegions] = remaining;
+            outRegions[numRegions++].max[i] = previous.min[i];
+            remaining.min[i] = previous.min[i];
+        }
+        if (remaining.max[i] > previous.max[i]) {
+            outRegions[numRegions] = remaining;
+            outRegions[numRegions++].min[i] = previous.max[i];
+            remaining.max[i] = previous.max[i];
+        }
+    }
+    return numRegions;
+}
@@ -32,17 +32,12 @@
 #include <FidelityFX/host/ffx_brixelizer_raw.h>
 #include <FidelityFX/gpu/brixelizer/ffx_brixelizer_resources.h>
 #include <ffx_object_management.h>
+#include <ffx_resource_binding_map.h>
 
 #include "ffx_brixelizer_raw_private.h"
 
 // lists to map shader resource bindpoint name to resource identifier
-typedef struct ResourceBinding
-{
-    uint32_t index;
-    wchar_t  name[64];
-} ResourceBinding;
-
-static const ResourceBinding srvResourceBindingTable[] = {
+static const FfxResourceBindingMapEntry srvResourceBindingTable[] = {
     {FFX_BRIXELIZER_RESOURCE_IDENTIFIER_UPLOAD_JOB_BUFFER, L"r_job_buffer"},
     {FFX_BRIXELIZER_RESOURCE_IDENTIFIER_UPLOAD_JOB_INDEX_BUFFER, L"r_job_index_buffer"},
     {FFX_BRIXELIZER_RESOURCE_IDENTIFIER_INSTANCE_INFO_BUFFER, L"r_instance_info_buffer"},
@@ -51,7 +46,7 @@ static const ResourceBinding srvResourceBindingTable[] = {
     {FFX_BRIXELIZER_RESOURCE_IDENTIFIER_UPLOAD_DEBUG_INSTANCE_ID_BUFFER, L"r_debug_instance_id"},
 };
 
-static const ResourceBinding uavResourceBindingTable[] = {
+static const FfxResourceBindingMapEntry uavResourceBindingTable[] = {
     {FFX_BRIXELIZER_RESOURCE_IDENTIFIER_CASCADE_AABB_TREE, L"rw_cascade_aabbtree"},
     {FFX_BRIXELIZER_RESOURCE_IDENTIFIER_CASCADE_AABB_TREES, L"rw_cascade_aabbtrees"},
     {FFX_BRIXELIZER_RESOURCE_IDENTIFIER_CASCADE_BRICK_MAP, L"rw_cascade_brick_map"},
@@ -87,7 +82,7 @@ static const ResourceBinding uavResourceBindingTable[] = {
     {FFX_BRIXELIZER_RESOURCE_IDENTIFIER_SCRATCH_DEBUG_AABBS, L"rw_debug_aabbs"},
 };
 
-static const ResourceBinding cbvResourceBindingTable[] = {
+static const FfxResourceBindingMapEntry cbvResourceBindingTable[] = {
     {FFX_BRIXELIZER_CONSTANTBUFFER_IDENTIFIER_CASCADE_INFO, L"cbBrixelizerCascadeInfo"},
     {FFX_BRIXELIZER_CONSTANTBUFFER_IDENTIFIER_CONTEXT_INFO, L"cbBrixelizerContextInfo"},
     {FFX_BRIXELIZER_CONSTANTBUFFER_IDENTIFIER_BUILD_INFO, L"cbBrixelizerBuildInfo"},
@@ -184,83 +179,19 @@ static bool isExternalResource(uint32_t resourceId)
 
 static void patchResourceBindings(FfxPipelineState* inoutPipeline)
 {
-    for (uint32_t srvTextureIndex = 0; srvTextureIndex < inoutPipeline->srvTextureCount; ++srvTextureIndex)
-    {
-        FfxResourceBinding& binding = inoutPipeline->srvTextureBindings[srvTextureIndex];
-
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(srvResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(srvResourceBindingTable[mapIndex].name, binding.name))
-                break;
-        }
-        if (mapIndex == _countof(srvResourceBindingTable))
-            return;
-
-        binding.resourceIdentifier = srvResourceBindingTable[mapIndex].index + binding.arrayIndex;
-    }
-
-    for (uint32_t srvBufferIndex = 0; srvBufferIndex < inoutPipeline->srvBufferCount; ++srvBufferIndex)
-    {
-        FfxResourceBinding& binding = inoutPipeline->srvBufferBindings[srvBufferIndex];
-
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(srvResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(srvResourceBindingTable[mapIndex].name, binding.name))
-                break;
-        }
-        if (mapIndex == _countof(srvResourceBindingTable))
-            return;
-
-        binding.resourceIdentifier = srvResourceBindingTable[mapIndex].index + binding.arrayIndex;
-    }
+    if (ffxResolveResourceBindings(inoutPipeline->srvTextureBindings, inoutPipeline->srvTextureCount, srvResourceBindingTable, true) != FFX_OK)
+        return;
 
-    for (uint32_t uavTextureIndex = 0; uavTextureIndex < inoutPipeline->uavTextureCount; ++uavTextureIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(uavResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(uavResourceBindingTable[mapIndex].name, inoutPipeline->uavTextureBindings[uavTextureIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(uavResourceBindingTable))
-            return;
+    if (ffxResolveResourceBindings(inoutPipeline->srvBufferBindings, inoutPipeline->srvBufferCount, srvResourceBindingTable, true) != FFX_OK)
+        return;
 
-        inoutPipeline->uavTextureBindings[uavTextureIndex].resourceIdentifier = uavResourceBindingTable[mapIndex].index;
-    }
+    if (ffxResolveResourceBindings(inoutPipeline->uavTextureBindings, inoutPipeline->uavTextureCount, uavResourceBindingTable) != FFX_OK)
+        return;
 
-    for (uint32_t uavBufferIndex = 0; uavBufferIndex < inoutPipeline->uavBufferCount; ++uavBufferIndex)
-    {
-        FfxResourceBinding& binding = inoutPipeline->uavBufferBindings[uavBufferIndex];
-
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(uavResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(uavResourceBindingTable[mapIndex].name, binding.name))
-                break;
-        }
-        if (mapIndex == _countof(uavResourceBindingTable))
-            return;
-
-        binding.resourceIdentifier = uavResourceBindingTable[mapIndex].index + binding.arrayIndex;
-    }
-
-    for (uint32_t cbvIndex = 0; cbvIndex < inoutPipeline->constCount; ++cbvIndex)
-    {
-        FfxResourceBinding& binding = inoutPipeline->constantBufferBindings[cbvIndex];
-
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(cbvResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(cbvResourceBindingTable[mapIndex].name, binding.name))
-                break;
-        }
-        if (mapIndex == _countof(cbvResourceBindingTable))
-            return;
+    if (ffxResolveResourceBindings(inoutPipeline->uavBufferBindings, inoutPipeline->uavBufferCount, uavResourceBindingTable, true) != FFX_OK)
+        return;
 
-        binding.resourceIdentifier = cbvResourceBindingTable[mapIndex].index;
-    }
+    ffxResolveResourceBindings(inoutPipeline->constantBufferBindings, inoutPipeline->constCount, cbvResourceBindingTable);
 }
 
 static uint32_t getPipelinePermutationFlags(uint32_t contextFlags, bool fp16, bool force64)
@@ -1692,41 +1623,80 @@ static FfxErrorCode brixelizerDispatchDebugVisualization(FfxBrixelizerRawContext
     return FFX_OK;
 }
 
+// Number of ID ranges needed to cover the sorted instance IDs when gaps of up to maxGap unused IDs are bridged.
+static uint32_t countInstanceRanges(const FfxBrixelizerInstanceID* instanceIDs, uint32_t numInstanceIDs, uint32_t maxGap)
+{
+    uint32_t numRanges = numInstanceIDs ? 1 : 0;
+    for (uint32_t i = 1; i < numInstanceIDs; i++)
+        numRanges += (instanceIDs[i] - instanceIDs[i - 1] - 1 > maxGap) ? 1 : 0;
+    return numRanges;
+}
+
+// New instances are uploaded as at most FFX_BRIXELIZER_MAX_INSTANCE_FLUSH_RANGES runs of consecutive IDs per buffer,
+// bridging the smallest gaps between IDs, so a flush costs a bounded number of copies and a single execute. Bridged
+// IDs are either live instances, whose host copy matches the GPU one, or free IDs that are never read.
 static void brixelizerFlushInstances(FfxBrixelizerRawContext_Private* context, FfxCommandList cmdList)
 {
-    for (uint32_t i = 0; i < context->hostNewInstanceListSize; i++)
+    if (context->hostNewInstanceListSize == 0)
+        return;
+
+    FfxBrixelizerInstanceID* instanceIDs    = context->hostNewInstanceList;
+    std::sort(instanceIDs, instanceIDs + context->hostNewInstanceListSize);
+    const uint32_t           numInstanceIDs = (uint32_t)(std::unique(instanceIDs, instanceIDs + context->hostNewInstanceListSize) - instanceIDs);
+
+    // find the smallest gap that may be bridged while staying within the range budget
+    uint32_t maxGap = 0;
+    if (countInstanceRanges(instanceIDs, numInstanceIDs, maxGap) > FFX_BRIXELIZER_MAX_INSTANCE_FLUSH_RANGES)
     {
-        FfxBrixelizerInstanceID idx = context->hostNewInstanceList[i];
+        uint32_t minGap = 1;
+        maxGap          = FFX_BRIXELIZER_MAX_INSTANCES;
+        while (minGap < maxGap)
+        {
+            const uint32_t gap = minGap + (maxGap - minGap) / 2;
+            if (countInstanceRanges(instanceIDs, numInstanceIDs, gap) <= FFX_BRIXELIZER_MAX_INSTANCE_FLUSH_RANGES)
+                maxGap = gap;
+            else
+                minGap = gap + 1;
+        }
+    }
+
+    for (uint32_t rangeStart = 0, rangeEnd = 0; rangeStart < numInstanceIDs; rangeStart = rangeEnd)
+    {
+        for (rangeEnd = rangeStart + 1; rangeEnd < numInstanceIDs && instanceIDs[rangeEnd] - instanceIDs[rangeEnd - 1] - 1 <= maxGap; rangeEnd++)
+            ;
 
-        FfxBrixelizerInstanceInfo instanceInfo = getFlatInstancePtr(context)[idx];
-        FfxFloat32x3x4 transform;
-        memcpy(&transform, getFlatTransformPtr(context) + idx, sizeof(transform));
+        const FfxBrixelizerInstanceID firstID      = instanceIDs[rangeStart];
+        const uint32_t                numInstances = instanceIDs[rangeEnd - 1] - firstID + 1;
 
         // Copy into mapped pointer of staging buffer
-        uint32_t instanceInfoOffset =
-            copyToUploadBuffer(context, FFX_BRIXELIZER_RESOURCE_IDENTIFIER_UPLOAD_INSTANCE_INFO_BUFFER, &instanceInfo, sizeof(instanceInfo));
-        uint32_t instanceTransformOffset =
-            copyToUploadBuffer(context, FFX_BRIXELIZER_RESOURCE_IDENTIFIER_UPLOAD_INSTANCE_TRANSFORM_BUFFER, &transform, sizeof(transform));
+        uint32_t instanceInfoOffset = copyToUploadBuffer(context,
+                                                         FFX_BRIXELIZER_RESOURCE_IDENTIFIER_UPLOAD_INSTANCE_INFO_BUFFER,
+                                                         getFlatInstancePtr(context) + firstID,
+                                                         numInstances * sizeof(FfxBrixelizerInstanceInfo));
+        uint32_t instanceTransformOffset = copyToUploadBuffer(context,
+                                                              FFX_BRIXELIZER_RESOURCE_IDENTIFIER_UPLOAD_INSTANCE_TRANSFORM_BUFFER,
+                                                              getFlatTransformPtr(context) + firstID,
+                                                              numInstances * sizeof(FfxFloat32x3x4));
 
         scheduleCopy(context,
                      context->resources[FFX_BRIXELIZER_RESOURCE_IDENTIFIER_UPLOAD_INSTANCE_INFO_BUFFER],
                      instanceInfoOffset,
                      context->resources[FFX_BRIXELIZER_RESOURCE_IDENTIFIER_INSTANCE_INFO_BUFFER],
-                     idx * sizeof(FfxBrixelizerInstanceInfo),
-                     sizeof(FfxBrixelizerInstanceInfo),
+                     firstID * sizeof(FfxBrixelizerInstanceInfo),
+                     numInstances * sizeof(FfxBrixelizerInstanceInfo),
                      L"Instance Info");
 
         scheduleCopy(context,
                      context->resources[FFX_BRIXELIZER_RESOURCE_IDENTIFIER_UPLOAD_INSTANCE_TRANSFORM_BUFFER],
                      instanceTransformOffset,
                      context->resources[FFX_BRIXELIZER_RESOURCE_IDENTIFIER_INSTANCE_TRANSFORM_BUFFER],
-                     idx * sizeof(FfxFloat32x3x4),
-                     sizeof(FfxFloat32x3x4),
+                     firstID * sizeof(FfxFloat32x3x4),
+                     numInstances * sizeof(FfxFloat32x3x4),
                      L"Instance Transform");
-
-        context->contextDescription.backendInterface.fpExecuteGpuJobs(&context->contextDescription.backendInterface, cmdList, context->effectContextId);
     }
 
+    context->contextDescription.backendInterface.fpExecuteGpuJobs(&context->contextDescription.backendInterface, cmdList, context->effectContextId);
+
     clearHostNewInstanceList(context);
 }
 
@@ -2177,6 +2147,51 @@ uint32_t ffxBrixelizerRawGetCascadeToUpdate(uint32_t frameIndex, uint32_t maxCas
     return n;
 }
 
+// The number of frames between updates of a cascade with ffxBrixelizerRawGetCascadeToUpdate. Cascade i is updated
+// every 2^(i + 1) frames, except the least detailed cascade, which takes the frames left over and so shares the period of
+// the cascade before it.
+static uint32_t getCascadeRoundRobinPeriod(uint32_t cascadeIndex, uint32_t maxCascades)
+{
+    return 1u << FFX_MINIMUM(cascadeIndex + 1, maxCascades - 1);
+}
+
+uint32_t ffxBrixelizerRawGetCascadeToUpdateByCost(const FfxBrixelizerRawCascadeSchedulingInfo* cascadeInfos, uint32_t maxCascades, uint32_t budget)
+{
+    FFX_ASSERT(cascadeInfos && maxCascades > 0 && maxCascades <= FFX_BRIXELIZER_MAX_CASCADES);
+
+    // never let a cascade get staler than the round robin order lets it get. When several are due the most detailed one
+    // goes first, as it has the shortest period, which also keeps cascades which were never updated from holding it up.
+    for (uint32_t i = 0; i < maxCascades; ++i)
+    {
+        if (cascadeInfos[i].framesSinceUpdate >= getCascadeRoundRobinPeriod(i, maxCascades))
+            return i;
+    }
+
+    // score each cascade by how much of it is out of date, weighted by how long it has been waiting
+    uint32_t bestCascade = 0, bestFittingCascade = maxCascades;
+    float    bestScore = -1.0f, bestFittingScore = -1.0f;
+    for (uint32_t i = 0; i < maxCascades; ++i)
+    {
+        const FfxBrixelizerRawCascadeSchedulingInfo* info = &cascadeInfos[i];
+        float change = 1.0f + FFX_BRIXELIZER_RAW_SCHEDULER_DISPLACEMENT_WEIGHT * info->displacement + (float)info->pendingInvalidations + (float)info->dirtyInstances;
+        float score  = change * (float)(1 + info->framesSinceUpdate);
+
+        if (score > bestScore)
+        {
+            bestScore   = score;
+            bestCascade = i;
+        }
+        if ((!budget || info->estimatedCost <= budget) && score > bestFittingScore)
+        {
+            bestFittingScore   = score;
+            bestFittingCascade = i;
+        }
+    }
+
+    // if no cascade fits in the budget the most urgent one is updated and its work is capped by maxBricksPerBake
+    return bestFittingCascade < maxCascades ? bestFittingCascade : bestCascade;
+}
+
 bool ffxBrixelizerRawResourceIsNull(FfxResource resource)
  {
      return resource.resource == NULL;
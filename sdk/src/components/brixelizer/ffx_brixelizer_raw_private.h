@@ -85,6 +85,10 @@ typedef struct FfxBrixelizerCascade_Private
 } FfxBrixelizerCascade_Private;
 
 #define FFX_BRIXELIZER_NUM_IN_FLIGHT_FRAMES     3
+#define FFX_BRIXELIZER_MAX_INSTANCE_FLUSH_RANGES 8
+
+// Weight of one voxel of cascade movement against one pending job when scoring cascades for update.
+#define FFX_BRIXELIZER_RAW_SCHEDULER_DISPLACEMENT_WEIGHT 4.0f
 
 typedef struct FfxBrixelizerUploadBufferMetaData {
     uint32_t          size;
@@ -28,18 +28,13 @@
 #include <FidelityFX/gpu/brixelizergi/ffx_brixelizergi_host_interface.h>
 #include <FidelityFX/host/ffx_brixelizer_raw.h>
 #include <ffx_object_management.h>
+#include <ffx_resource_binding_map.h>
 
 #include "../brixelizer/ffx_brixelizer_raw_private.h"
 #include "ffx_brixelizergi_private.h"
 
 // lists to map shader resource bindpoint name to resource identifier
-typedef struct ResourceBinding
-{
-    uint32_t index;
-    wchar_t  name[64];
-} ResourceBinding;
-
-static const ResourceBinding srvResourceBindingTable[] = {
+static const FfxResourceBindingMapEntry srvResourceBindingTable[] = {
     {FFX_BRIXELIZER_GI_RESOURCE_IDENTIFIER_DISOCCLUSION_MASK, L"g_r_disocclusion_mask"},
     {FFX_BRIXELIZER_GI_PING_PONG_RESOURCE_STATIC_GI_TARGET_READ, L"g_sdfgi_r_static_gitarget"},
     {FFX_BRIXELIZER_GI_PING_PONG_RESOURCE_STATIC_SCREEN_PROBES_READ, L"g_sdfgi_r_static_screen_probes"},
@@ -72,7 +67,7 @@ static const ResourceBinding srvResourceBindingTable[] = {
     {FFX_BRIXELIZER_GI_RESOURCE_IDENTIFIER_OUTPUT_SPECULAR_GI, L"g_downsampled_specular_gi"},
 };
 
-static const ResourceBinding uavResourceBindingTable[] = {
+static const FfxResourceBindingMapEntry uavResourceBindingTable[] = {
     {FFX_BRIXELIZER_GI_RESOURCE_IDENTIFIER_DISOCCLUSION_MASK, L"g_rw_disocclusion_mask"},
     {FFX_BRIXELIZER_GI_PING_PONG_RESOURCE_STATIC_SCREEN_PROBES_WRITE, L"g_sdfgi_rw_static_screen_probes"},
     {FFX_BRIXELIZER_GI_RESOURCE_IDENTIFIER_STATIC_PUSHOFF_MAP, L"g_sdfgi_rw_static_pushoff_map"},
@@ -108,7 +103,7 @@ static const ResourceBinding uavResourceBindingTable[] = {
     {FFX_BRIXELIZER_GI_RESOURCE_IDENTIFIER_UPSAMPLED_SPECULAR_GI, L"g_upsampled_specular_gi"},
 };
 
-static const ResourceBinding cbvResourceBindingTable[] = {
+static const FfxResourceBindingMapEntry cbvResourceBindingTable[] = {
     {FFX_BRIXELIZER_GI_CONSTANTBUFFER_IDENTIFIER_GI_CONSTANTS, L"g_sdfgi_constants"},
     {FFX_BRIXELIZER_GI_CONSTANTBUFFER_IDENTIFIER_PASS_CONSTANTS, L"g_pass_constants"},
     {FFX_BRIXELIZER_GI_CONSTANTBUFFER_IDENTIFIER_SCALING_CONSTANTS, L"g_scaling_constants"},
@@ -330,83 +325,19 @@ static uint32_t getCurrentSpecularTargetId(FfxBrixelizerGIContext_Private* pCont
 
 static void patchResourceBindings(FfxPipelineState* inoutPipeline)
 {
-    for (uint32_t srvTextureIndex = 0; srvTextureIndex < inoutPipeline->srvTextureCount; ++srvTextureIndex)
-    {
-        FfxResourceBinding& binding = inoutPipeline->srvTextureBindings[srvTextureIndex];
-
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(srvResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(srvResourceBindingTable[mapIndex].name, binding.name))
-                break;
-        }
-        if (mapIndex == _countof(srvResourceBindingTable))
-            return;
-
-        binding.resourceIdentifier = srvResourceBindingTable[mapIndex].index + binding.arrayIndex;
-    }
-
-    for (uint32_t srvBufferIndex = 0; srvBufferIndex < inoutPipeline->srvBufferCount; ++srvBufferIndex)
-    {
-        FfxResourceBinding& binding = inoutPipeline->srvBufferBindings[srvBufferIndex];
-
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(srvResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(srvResourceBindingTable[mapIndex].name, binding.name))
-                break;
-        }
-        if (mapIndex == _countof(srvResourceBindingTable))
-            return;
-
-        binding.resourceIdentifier = srvResourceBindingTable[mapIndex].index + binding.arrayIndex;
-    }
-
-    for (uint32_t uavTextureIndex = 0; uavTextureIndex < inoutPipeline->uavTextureCount; ++uavTextureIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(uavResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(uavResourceBindingTable[mapIndex].name, inoutPipeline->uavTextureBindings[uavTextureIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(uavResourceBindingTable))
-            return;
-
-        inoutPipeline->uavTextureBindings[uavTextureIndex].resourceIdentifier = uavResourceBindingTable[mapIndex].index;
-    }
-
-    for (uint32_t uavBufferIndex = 0; uavBufferIndex < inoutPipeline->uavBufferCount; ++uavBufferIndex)
-    {
-        FfxResourceBinding& binding = inoutPipeline->uavBufferBindings[uavBufferIndex];
-
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(uavResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(uavResourceBindingTable[mapIndex].name, binding.name))
-                break;
-        }
-        if (mapIndex == _countof(uavResourceBindingTable))
-            return;
+    if (ffxResolveResourceBindings(inoutPipeline->srvTextureBindings, inoutPipeline->srvTextureCount, srvResourceBindingTable, true) != FFX_OK)
+        return;
 
-        binding.resourceIdentifier = uavResourceBindingTable[mapIndex].index + binding.arrayIndex;
-    }
+    if (ffxResolveResourceBindings(inoutPipeline->srvBufferBindings, inoutPipeline->srvBufferCount, srvResourceBindingTable, true) != FFX_OK)
+        return;
 
-    for (uint32_t cbvIndex = 0; cbvIndex < inoutPipeline->constCount; ++cbvIndex)
-    {
-        FfxResourceBinding& binding = inoutPipeline->constantBufferBindings[cbvIndex];
+    if (ffxResolveResourceBindings(inoutPipeline->uavTextureBindings, inoutPipeline->uavTextureCount, uavResourceBindingTable) != FFX_OK)
+        return;
 
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(cbvResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(cbvResourceBindingTable[mapIndex].name, binding.name))
-                break;
-        }
-        if (mapIndex == _countof(cbvResourceBindingTable))
-            return;
+    if (ffxResolveResourceBindings(inoutPipeline->uavBufferBindings, inoutPipeline->uavBufferCount, uavResourceBindingTable, true) != FFX_OK)
+        return;
 
-        binding.resourceIdentifier = cbvResourceBindingTable[mapIndex].index;
-    }
+    ffxResolveResourceBindings(inoutPipeline->constantBufferBindings, inoutPipeline->constCount, cbvResourceBindingTable);
 }
 
 static uint32_t getPipelinePermutationFlags(uint32_t contextFlags, bool fp16, bool force64)
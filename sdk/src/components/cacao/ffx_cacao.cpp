@@ -32,6 +32,7 @@
 #include <FidelityFX/host/ffx_cacao.h>
 #include <FidelityFX/gpu/ffx_core.h>
 #include <ffx_object_management.h>
+#include <ffx_resource_binding_map.h>
 
 #include "ffx_cacao_private.h"
 
@@ -62,17 +63,11 @@ inline static uint32_t dispatchSize(uint32_t tileSize, uint32_t totalSize)
 }
 
 // lists to map shader resource bindpoint name to resource identifier
-typedef struct ResourceBinding
-{
-    uint32_t index;
-    wchar_t  name[64];
-} ResourceBinding;
-
-static const ResourceBinding constantBufferBindingTable[] = {
+static const FfxResourceBindingMapEntry constantBufferBindingTable[] = {
     {FFX_CACAO_CONSTANTBUFFER_IDENTIFIER_CACAO, L"SSAOConstantsBuffer"},
 };
 
-static const ResourceBinding srvTextureBindingTable[] = {
+static const FfxResourceBindingMapEntry srvTextureBindingTable[] = {
     {FFX_CACAO_RESOURCE_IDENTIFIER_DEPTH_IN, L"g_DepthIn"},
     {FFX_CACAO_RESOURCE_IDENTIFIER_NORMAL_IN, L"g_NormalIn"},
     {FFX_CACAO_RESOURCE_IDENTIFIER_LOAD_COUNTER_BUFFER, L"g_LoadCounter"},
@@ -84,7 +79,7 @@ static const ResourceBinding srvTextureBindingTable[] = {
     {FFX_CACAO_RESOURCE_IDENTIFIER_IMPORTANCE_MAP_PONG, L"g_ImportanceMapPong"},
 };
 
-static const ResourceBinding uavTextureBindingTable[] = {
+static const FfxResourceBindingMapEntry uavTextureBindingTable[] = {
     {FFX_CACAO_RESOURCE_IDENTIFIER_LOAD_COUNTER_BUFFER, L"g_RwLoadCounter"},
     {FFX_CACAO_RESOURCE_IDENTIFIER_DEINTERLEAVED_DEPTHS, L"g_RwDeinterleavedDepth"},
     {FFX_CACAO_RESOURCE_IDENTIFIER_DEINTERLEAVED_NORMALS, L"g_RwDeinterleavedNormals"},
@@ -330,47 +325,9 @@ void ffxCacaoUpdateConstants(FfxCacaoConstants*            consts,
 
 static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
 {
-    for (uint32_t srvIndex = 0; srvIndex < inoutPipeline->srvTextureCount; ++srvIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < FFX_CACAO_ARRAY_SIZE(srvTextureBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(srvTextureBindingTable[mapIndex].name, inoutPipeline->srvTextureBindings[srvIndex].name))
-                break;
-        }
-        if (mapIndex == FFX_CACAO_ARRAY_SIZE(srvTextureBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->srvTextureBindings[srvIndex].resourceIdentifier = srvTextureBindingTable[mapIndex].index;
-    }
-
-    for (uint32_t uavIndex = 0; uavIndex < inoutPipeline->uavTextureCount; ++uavIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < FFX_CACAO_ARRAY_SIZE(uavTextureBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(uavTextureBindingTable[mapIndex].name, inoutPipeline->uavTextureBindings[uavIndex].name))
-                break;
-        }
-        if (mapIndex == FFX_CACAO_ARRAY_SIZE(uavTextureBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->uavTextureBindings[uavIndex].resourceIdentifier = uavTextureBindingTable[mapIndex].index;
-    }
-
-    for (uint32_t cbIndex = 0; cbIndex < inoutPipeline->constCount; ++cbIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < FFX_CACAO_ARRAY_SIZE(constantBufferBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(constantBufferBindingTable[mapIndex].name, inoutPipeline->constantBufferBindings[cbIndex].name))
-                break;
-        }
-        if (mapIndex == FFX_CACAO_ARRAY_SIZE(constantBufferBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->constantBufferBindings[cbIndex].resourceIdentifier = constantBufferBindingTable[mapIndex].index;
-    }
+    FFX_VALIDATE(ffxResolveResourceBindings(inoutPipeline->srvTextureBindings, inoutPipeline->srvTextureCount, srvTextureBindingTable));
+    FFX_VALIDATE(ffxResolveResourceBindings(inoutPipeline->uavTextureBindings, inoutPipeline->uavTextureCount, uavTextureBindingTable));
+    FFX_VALIDATE(ffxResolveResourceBindings(inoutPipeline->constantBufferBindings, inoutPipeline->constCount, constantBufferBindingTable));
 
     return FFX_OK;
 }
@@ -33,71 +33,28 @@
 #include <FidelityFX/gpu/ffx_core.h>
 #include <FidelityFX/gpu/cas/ffx_cas.h>
 #include <ffx_object_management.h>
+#include <ffx_resource_binding_map.h>
 
 #include "ffx_cas_private.h"
 
 // lists to map shader resource bindpoint name to resource identifier
-typedef struct ResourceBinding
-{
-    uint32_t index;
-    wchar_t  name[64];
-} ResourceBinding;
-
-static const ResourceBinding s_SrvResourceBindingTable[] = {
+static const FfxResourceBindingMapEntry s_SrvResourceBindingTable[] = {
     {FFX_CAS_RESOURCE_IDENTIFIER_INPUT_COLOR, L"r_input_color"},
 };
 
-static const ResourceBinding s_UavResourceBindingTable[] = {
+static const FfxResourceBindingMapEntry s_UavResourceBindingTable[] = {
     {FFX_CAS_RESOURCE_IDENTIFIER_OUTPUT_COLOR, L"rw_output_color"},
 };
 
-static const ResourceBinding s_CbResourceBindingTable[] = {
+static const FfxResourceBindingMapEntry s_CbResourceBindingTable[] = {
     {FFX_CAS_CONSTANTBUFFER_IDENTIFIER_CAS, L"cbCAS"},
 };
 
 static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
 {
-    for (uint32_t srvIndex = 0; srvIndex < inoutPipeline->srvTextureCount; ++srvIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(s_SrvResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(s_SrvResourceBindingTable[mapIndex].name, inoutPipeline->srvTextureBindings[srvIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(s_SrvResourceBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->srvTextureBindings[srvIndex].resourceIdentifier = s_SrvResourceBindingTable[mapIndex].index;
-    }
-
-    for (uint32_t uavIndex = 0; uavIndex < inoutPipeline->uavTextureCount; ++uavIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(s_UavResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(s_UavResourceBindingTable[mapIndex].name, inoutPipeline->uavTextureBindings[uavIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(s_UavResourceBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->uavTextureBindings[uavIndex].resourceIdentifier = s_UavResourceBindingTable[mapIndex].index;
-    }
-
-    for (uint32_t cbIndex = 0; cbIndex < inoutPipeline->constCount; ++cbIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(s_CbResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(s_CbResourceBindingTable[mapIndex].name, inoutPipeline->constantBufferBindings[cbIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(s_CbResourceBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->constantBufferBindings[cbIndex].resourceIdentifier = s_CbResourceBindingTable[mapIndex].index;
-    }
+    FFX_VALIDATE(ffxResolveResourceBindings(inoutPipeline->srvTextureBindings, inoutPipeline->srvTextureCount, s_SrvResourceBindingTable));
+    FFX_VALIDATE(ffxResolveResourceBindings(inoutPipeline->uavTextureBindings, inoutPipeline->uavTextureCount, s_UavResourceBindingTable));
+    FFX_VALIDATE(ffxResolveResourceBindings(inoutPipeline->constantBufferBindings, inoutPipeline->constCount, s_CbResourceBindingTable));
 
     return FFX_OK;
 }
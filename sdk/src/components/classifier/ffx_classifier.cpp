@@ -29,6 +29,7 @@
 #include <FidelityFX/host/ffx_util.h>
 #include <FidelityFX/gpu/ffx_core.h>
 #include <ffx_object_management.h>
+#include <ffx_resource_binding_map.h>
 
 #include "ffx_classifier_private.h"
 
@@ -36,13 +37,7 @@ static constexpr uint32_t k_tileSizeX = 8;
 static constexpr uint32_t k_tileSizeY = 4;
 
 // lists to map shader resource bindpoint name to resource identifier
-typedef struct ResourceBinding
-{
-    uint32_t    index;
-    wchar_t     name[64];
-}ResourceBinding;
-
-static const ResourceBinding srvTextureBindingTable[] =
+static const FfxResourceBindingMapEntry srvTextureBindingTable[] =
 {
     {FFX_CLASSIFIER_RESOURCE_IDENTIFIER_INPUT_DEPTH,                  L"r_input_depth"},
     {FFX_CLASSIFIER_RESOURCE_IDENTIFIER_INPUT_NORMAL,                 L"r_input_normal"},
@@ -54,12 +49,12 @@ static const ResourceBinding srvTextureBindingTable[] =
     {FFX_CLASSIFIER_RESOURCE_IDENTIFIER_INPUT_SHADOW_MAPS,            L"r_input_shadowMap"},
 };
 
-static const ResourceBinding srvBufferBindingTable[] =
+static const FfxResourceBindingMapEntry srvBufferBindingTable[] =
 {
     {FFX_CLASSIFIER_RESOURCE_IDENTIFIER_WORK_QUEUE,                   L"rsb_tiles"},
 };
 
-static const ResourceBinding uavBufferBindingTable[] =
+static const FfxResourceBindingMapEntry uavBufferBindingTable[] =
 {
     {FFX_CLASSIFIER_RESOURCE_IDENTIFIER_WORK_QUEUE,                   L"rwsb_tiles"},
     {FFX_CLASSIFIER_RESOURCE_IDENTIFIER_OUTPUT_WORK_QUEUE_COUNTER,    L"rwb_tileCount"},
@@ -69,7 +64,7 @@ static const ResourceBinding uavBufferBindingTable[] =
     {FFX_CLASSIFIER_RESOURCE_IDENTIFIER_RAY_COUNTER,                  L"rw_ray_counter"},
 };
 
-static const ResourceBinding uavTextureBindingTable[] =
+static const FfxResourceBindingMapEntry uavTextureBindingTable[] =
 {
     {FFX_CLASSIFIER_RESOURCE_IDENTIFIER_OUTPUT_RAY_HIT,               L"rwt2d_rayHitResults"},
     {FFX_CLASSIFIER_RESOURCE_IDENTIFIER_RADIANCE,                     L"rw_radiance"},
@@ -77,7 +72,7 @@ static const ResourceBinding uavTextureBindingTable[] =
     {FFX_CLASSIFIER_RESOURCE_IDENTIFIER_HIT_COUNTER,                  L"rw_hit_counter"},
 };
 
-static const ResourceBinding cbResourceBindingTable[] =
+static const FfxResourceBindingMapEntry cbResourceBindingTable[] =
 {
     {FFX_CLASSIFIER_CONSTANTBUFFER_IDENTIFIER_CLASSIFIER,             L"cbClassifier"},
     {FFX_CLASSIFIER_CONSTANTBUFFER_IDENTIFIER_REFLECTION ,            L"cbClassifierReflection"},
@@ -85,75 +80,11 @@ static const ResourceBinding cbResourceBindingTable[] =
 
 static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
 {
-    for (uint32_t srvIndex = 0; srvIndex < inoutPipeline->srvTextureCount; ++srvIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(srvTextureBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(srvTextureBindingTable[mapIndex].name, inoutPipeline->srvTextureBindings[srvIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(srvTextureBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->srvTextureBindings[srvIndex].resourceIdentifier = srvTextureBindingTable[mapIndex].index;
-    }
-
-    for (uint32_t srvIndex = 0; srvIndex < inoutPipeline->srvBufferCount; ++srvIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(srvBufferBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(srvBufferBindingTable[mapIndex].name, inoutPipeline->srvBufferBindings[srvIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(srvBufferBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->srvBufferBindings[srvIndex].resourceIdentifier = srvBufferBindingTable[mapIndex].index;
-    }
-
-    for (uint32_t uavIndex = 0; uavIndex < inoutPipeline->uavTextureCount; ++uavIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(uavTextureBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(uavTextureBindingTable[mapIndex].name, inoutPipeline->uavTextureBindings[uavIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(uavTextureBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->uavTextureBindings[uavIndex].resourceIdentifier = uavTextureBindingTable[mapIndex].index;
-    }
-
-    for (uint32_t uavIndex = 0; uavIndex < inoutPipeline->uavBufferCount; ++uavIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(uavBufferBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(uavBufferBindingTable[mapIndex].name, inoutPipeline->uavBufferBindings[uavIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(uavBufferBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->uavBufferBindings[uavIndex].resourceIdentifier = uavBufferBindingTable[mapIndex].index;
-    }
-
-    for (uint32_t cbIndex = 0; cbIndex < inoutPipeline->constCount; ++cbIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(cbResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(cbResourceBindingTable[mapIndex].name, inoutPipeline->constantBufferBindings[cbIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(cbResourceBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->constantBufferBindings[cbIndex].resourceIdentifier = cbResourceBindingTable[mapIndex].index;
-    }
+    FFX_VALIDATE(ffxResolveResourceBindings(inoutPipeline->srvTextureBindings, inoutPipeline->srvTextureCount, srvTextureBindingTable));
+    FFX_VALIDATE(ffxResolveResourceBindings(inoutPipeline->srvBufferBindings, inoutPipeline->srvBufferCount, srvBufferBindingTable));
+    FFX_VALIDATE(ffxResolveResourceBindings(inoutPipeline->uavTextureBindings, inoutPipeline->uavTextureCount, uavTextureBindingTable));
+    FFX_VALIDATE(ffxResolveResourceBindings(inoutPipeline->uavBufferBindings, inoutPipeline->uavBufferCount, uavBufferBindingTable));
+    FFX_VALIDATE(ffxResolveResourceBindings(inoutPipeline->constantBufferBindings, inoutPipeline->constCount, cbResourceBindingTable));
 
     return FFX_OK;
 }
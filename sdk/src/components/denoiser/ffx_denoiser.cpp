@@ -27,6 +27,7 @@
 #include <FidelityFX/host/ffx_denoiser.h>
 #include <FidelityFX/gpu/denoiser/ffx_denoiser_resources.h>
 #include <ffx_object_management.h>
+#include <ffx_resource_binding_map.h>
 
 #include "ffx_denoiser_private.h"
 
@@ -35,13 +36,7 @@ constexpr uint32_t k_tileSizeX = 8;
 constexpr uint32_t k_tileSizeY = 4;
 
 // lists to map shader resource bindpoint name to resource identifier
-typedef struct ResourceBinding
-{
-    uint32_t    index;
-    wchar_t     name[64];
-}ResourceBinding;
-
-static const ResourceBinding srvTextureBindingTable[] =
+static const FfxResourceBindingMapEntry srvTextureBindingTable[] =
 {
     {FFX_DENOISER_RESOURCE_IDENTIFIER_HIT_MASK_RESULTS,         L"r_hit_mask_results"},
     {FFX_DENOISER_RESOURCE_IDENTIFIER_DEPTH,                    L"r_depth"},
@@ -67,11 +62,11 @@ static const ResourceBinding srvTextureBindingTable[] =
     {FFX_DENOISER_RESOURCE_IDENTIFIER_REPROJECTED_RADIANCE,     L"r_reprojected_radiance"},
 };
 
-static const ResourceBinding srvBufferBindingTable[] = {
+static const FfxResourceBindingMapEntry srvBufferBindingTable[] = {
     {FFX_DENOISER_RESOURCE_IDENTIFIER_RAYTRACER_RESULT, L"sb_raytracer_result"},
 };
 
-static const ResourceBinding uavBufferBindingTable[] =
+static const FfxResourceBindingMapEntry uavBufferBindingTable[] =
 {
     {FFX_DENOISER_RESOURCE_IDENTIFIER_SHADOW_MASK,          L"rw_shadow_mask"},
     {FFX_DENOISER_RESOURCE_IDENTIFIER_RAYTRACER_RESULT,     L"rw_raytracer_result"},
@@ -81,7 +76,7 @@ static const ResourceBinding uavBufferBindingTable[] =
 
 };
 
-static const ResourceBinding uavTextureBindingTable[] =
+static const FfxResourceBindingMapEntry uavTextureBindingTable[] =
 {
     {FFX_DENOISER_RESOURCE_IDENTIFIER_FILTER_OUTPUT,            L"rw_filter_output"},
     {FFX_DENOISER_RESOURCE_IDENTIFIER_REPROJECTION_RESULTS,     L"rw_reprojection_results"},
@@ -94,7 +89,7 @@ static const ResourceBinding uavTextureBindingTable[] =
     {FFX_DENOISER_RESOURCE_IDENTIFIER_REPROJECTED_RADIANCE,     L"rw_reprojected_radiance"},
 };
 
-static const ResourceBinding cbResourceBindingTable[] =
+static const FfxResourceBindingMapEntry cbResourceBindingTable[] =
 {
     {FFX_DENOISER_SHADOWS_CONSTANTBUFFER_IDENTIFIER_DENOISER_SHADOWS0,  L"cb0DenoiserShadows"},
     {FFX_DENOISER_SHADOWS_CONSTANTBUFFER_IDENTIFIER_DENOISER_SHADOWS1,  L"cb1DenoiserShadows"},
@@ -144,80 +139,20 @@ typedef struct DenoiserShadowsFilterConstants {
 static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
 {
     // Texture srvs
-    for (uint32_t srvIndex = 0; srvIndex < inoutPipeline->srvTextureCount; ++srvIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(srvTextureBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(srvTextureBindingTable[mapIndex].name, inoutPipeline->srvTextureBindings[srvIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(srvTextureBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->srvTextureBindings[srvIndex].resourceIdentifier = srvTextureBindingTable[mapIndex].index;
-    }
+    FFX_VALIDATE(ffxResolveResourceBindings(inoutPipeline->srvTextureBindings, inoutPipeline->srvTextureCount, srvTextureBindingTable));
 
     // Buffer srvs
-    for (uint32_t srvIndex = 0; srvIndex < inoutPipeline->srvBufferCount; ++srvIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(srvBufferBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(srvBufferBindingTable[mapIndex].name, inoutPipeline->srvBufferBindings[srvIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(srvBufferBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->srvBufferBindings[srvIndex].resourceIdentifier = srvBufferBindingTable[mapIndex].index;
-    }
+    FFX_VALIDATE(ffxResolveResourceBindings(inoutPipeline->srvBufferBindings, inoutPipeline->srvBufferCount, srvBufferBindingTable));
 
     // Buffer uavs
-    for (uint32_t uavIndex = 0; uavIndex < inoutPipeline->uavBufferCount; ++uavIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(uavBufferBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(uavBufferBindingTable[mapIndex].name, inoutPipeline->uavBufferBindings[uavIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(uavBufferBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->uavBufferBindings[uavIndex].resourceIdentifier = uavBufferBindingTable[mapIndex].index;
-    }
+    FFX_VALIDATE(ffxResolveResourceBindings(inoutPipeline->uavBufferBindings, inoutPipeline->uavBufferCount, uavBufferBindingTable));
 
 
     // Texture uavs
-    for (uint32_t uavIndex = 0; uavIndex < inoutPipeline->uavTextureCount; ++uavIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(uavTextureBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(uavTextureBindingTable[mapIndex].name, inoutPipeline->uavTextureBindings[uavIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(uavTextureBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->uavTextureBindings[uavIndex].resourceIdentifier = uavTextureBindingTable[mapIndex].index;
-    }
+    FFX_VALIDATE(ffxResolveResourceBindings(inoutPipeline->uavTextureBindings, inoutPipeline->uavTextureCount, uavTextureBindingTable));
 
     // Constant buffers
-    for (uint32_t cbIndex = 0; cbIndex < inoutPipeline->constCount; ++cbIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(cbResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(cbResourceBindingTable[mapIndex].name, inoutPipeline->constantBufferBindings[cbIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(cbResourceBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->constantBufferBindings[cbIndex].resourceIdentifier = cbResourceBindingTable[mapIndex].index;
-    }
+    FFX_VALIDATE(ffxResolveResourceBindings(inoutPipeline->constantBufferBindings, inoutPipeline->constCount, cbResourceBindingTable));
 
     return FFX_OK;
 }
@@ -42,6 +42,7 @@
 #include <FidelityFX/gpu/fsr2/ffx_fsr2_callbacks_hlsl.h>
 #include <FidelityFX/gpu/fsr2/ffx_fsr2_common.h>
 #include <ffx_object_management.h>
+#include <ffx_resource_binding_map.h>
 
 #include "ffx_fsr2_maximum_bias.h"
 
@@ -51,13 +52,7 @@ static const uint32_t FSR2_MAX_QUEUED_FRAMES = 16;
 #include "ffx_fsr2_private.h"
 
 // lists to map shader resource bindpoint name to resource identifier
-typedef struct ResourceBinding
-{
-    uint32_t    index;
-    wchar_t     name[64];
-}ResourceBinding;
-
-static const ResourceBinding srvTextureBindingTable[] =
+static const FfxResourceBindingMapEntry srvTextureBindingTable[] =
 {
     {FFX_FSR2_RESOURCE_IDENTIFIER_INPUT_COLOR,                              L"r_input_color_jittered"},
     {FFX_FSR2_RESOURCE_IDENTIFIER_INPUT_OPAQUE_ONLY,                        L"r_input_opaque_only"},
@@ -88,7 +83,7 @@ static const ResourceBinding srvTextureBindingTable[] =
     {FFX_FSR2_RESOURCE_IDENTIFIER_PREV_POST_ALPHA_COLOR,                    L"r_input_prev_color_post_alpha"},
 };
 
-static const ResourceBinding uavTextureBindingTable[] =
+static const FfxResourceBindingMapEntry uavTextureBindingTable[] =
 {
     {FFX_FSR2_RESOURCE_IDENTIFIER_RECONSTRUCTED_PREVIOUS_NEAREST_DEPTH,    L"rw_reconstructed_previous_nearest_depth"},
     {FFX_FSR2_RESOURCE_IDENTIFIER_DILATED_MOTION_VECTORS,                  L"rw_dilated_motion_vectors"},
@@ -111,7 +106,7 @@ static const ResourceBinding uavTextureBindingTable[] =
     {FFX_FSR2_RESOURCE_IDENTIFIER_PREV_POST_ALPHA_COLOR,                   L"rw_output_prev_color_post_alpha"},
 };
 
-static const ResourceBinding constantBufferBindingTable[] =
+static const FfxResourceBindingMapEntry constantBufferBindingTable[] =
 {
     {FFX_FSR2_CONSTANTBUFFER_IDENTIFIER_FSR2,           L"cbFSR2"},
     {FFX_FSR2_CONSTANTBUFFER_IDENTIFIER_SPD,            L"cbSPD"},
@@ -323,47 +318,9 @@ static void fsr2DebugCheckDispatch(FfxFsr2Context_Private* context, const FfxFsr
 
 static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
 {
-    for (uint32_t srvIndex = 0; srvIndex < inoutPipeline->srvTextureCount; ++srvIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(srvTextureBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(srvTextureBindingTable[mapIndex].name, inoutPipeline->srvTextureBindings[srvIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(srvTextureBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->srvTextureBindings[srvIndex].resourceIdentifier = srvTextureBindingTable[mapIndex].index;
-    }
-
-    for (uint32_t uavIndex = 0; uavIndex < inoutPipeline->uavTextureCount; ++uavIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(uavTextureBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(uavTextureBindingTable[mapIndex].name, inoutPipeline->uavTextureBindings[uavIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(uavTextureBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->uavTextureBindings[uavIndex].resourceIdentifier = uavTextureBindingTable[mapIndex].index;
-    }
-
-    for (uint32_t cbIndex = 0; cbIndex < inoutPipeline->constCount; ++cbIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(constantBufferBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(constantBufferBindingTable[mapIndex].name, inoutPipeline->constantBufferBindings[cbIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(constantBufferBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->constantBufferBindings[cbIndex].resourceIdentifier = constantBufferBindingTable[mapIndex].index;
-    }
+    FFX_VALIDATE(ffxResolveResourceBindings(inoutPipeline->srvTextureBindings, inoutPipeline->srvTextureCount, srvTextureBindingTable));
+    FFX_VALIDATE(ffxResolveResourceBindings(inoutPipeline->uavTextureBindings, inoutPipeline->uavTextureCount, uavTextureBindingTable));
+    FFX_VALIDATE(ffxResolveResourceBindings(inoutPipeline->constantBufferBindings, inoutPipeline->constCount, constantBufferBindingTable));
 
     return FFX_OK;
 }
@@ -430,46 +387,54 @@ static FfxErrorCode createPipelineStates(FfxFsr2Context_Private* context)
     // Work out what permutation to load.
     uint32_t contextFlags = context->contextDescription.flags;
 
-    // Set up pipeline descriptor (basically RootSignature and binding)
-    wcscpy_s(pipelineDescription.name, L"FSR2-LUM_PYRAMID");
-    FFX_VALIDATE(context->contextDescription.backendInterface.fpCreatePipeline(&context->contextDescription.backendInterface, FFX_EFFECT_FSR2, FFX_FSR2_PASS_COMPUTE_LUMINANCE_PYRAMID,
-        getPipelinePermutationFlags(contextFlags, FFX_FSR2_PASS_COMPUTE_LUMINANCE_PYRAMID, supportedFP16, canForceWave64, useLut),
-        &pipelineDescription, context->effectContextId, &context->pipelineComputeLuminancePyramid));
-    wcscpy_s(pipelineDescription.name, L"FSR2-RCAS");
-    FFX_VALIDATE(context->contextDescription.backendInterface.fpCreatePipeline(&context->contextDescription.backendInterface, FFX_EFFECT_FSR2, FFX_FSR2_PASS_RCAS,
-        getPipelinePermutationFlags(contextFlags, FFX_FSR2_PASS_RCAS, supportedFP16, canForceWave64, useLut),
-        &pipelineDescription, context->effectContextId, &context->pipelineRCAS));
-    wcscpy_s(pipelineDescription.name, L"FSR2-GEN_REACTIVE");
-    FFX_VALIDATE(context->contextDescription.backendInterface.fpCreatePipeline(&context->contextDescription.backendInterface, FFX_EFFECT_FSR2, FFX_FSR2_PASS_GENERATE_REACTIVE,
-        getPipelinePermutationFlags(contextFlags, FFX_FSR2_PASS_GENERATE_REACTIVE, supportedFP16, canForceWave64, useLut),
-        &pipelineDescription, context->effectContextId, &context->pipelineGenerateReactive));
-    wcscpy_s(pipelineDescription.name, L"FSR2-TCR_AUTOGENERATE");
-    FFX_VALIDATE(context->contextDescription.backendInterface.fpCreatePipeline(&context->contextDescription.backendInterface, FFX_EFFECT_FSR2, FFX_FSR2_PASS_TCR_AUTOGENERATE,
-        getPipelinePermutationFlags(contextFlags, FFX_FSR2_PASS_TCR_AUTOGENERATE, supportedFP16, canForceWave64, useLut),
-        &pipelineDescription, context->effectContextId, &context->pipelineTcrAutogenerate));
-
-    pipelineDescription.rootConstantBufferCount = 1;
-
-    wcscpy_s(pipelineDescription.name, L"FSR2-DEPTH_CLIP");
-    FFX_VALIDATE(context->contextDescription.backendInterface.fpCreatePipeline(&context->contextDescription.backendInterface, FFX_EFFECT_FSR2, FFX_FSR2_PASS_DEPTH_CLIP,
-        getPipelinePermutationFlags(contextFlags, FFX_FSR2_PASS_DEPTH_CLIP, supportedFP16, canForceWave64, useLut),
-        &pipelineDescription, context->effectContextId, &context->pipelineDepthClip));
-    wcscpy_s(pipelineDescription.name, L"FSR2-RECON_PREV_DEPTH");
-    FFX_VALIDATE(context->contextDescription.backendInterface.fpCreatePipeline(&context->contextDescription.backendInterface, FFX_EFFECT_FSR2, FFX_FSR2_PASS_RECONSTRUCT_PREVIOUS_DEPTH,
-        getPipelinePermutationFlags(contextFlags, FFX_FSR2_PASS_RECONSTRUCT_PREVIOUS_DEPTH, supportedFP16, canForceWave64, useLut),
-        &pipelineDescription, context->effectContextId, &context->pipelineReconstructPreviousDepth));
-    wcscpy_s(pipelineDescription.name, L"FSR2-LOCK");
-    FFX_VALIDATE(context->contextDescription.backendInterface.fpCreatePipeline(&context->contextDescription.backendInterface, FFX_EFFECT_FSR2, FFX_FSR2_PASS_LOCK,
-        getPipelinePermutationFlags(contextFlags, FFX_FSR2_PASS_LOCK, supportedFP16, canForceWave64, useLut),
-        &pipelineDescription, context->effectContextId, &context->pipelineLock));
-    wcscpy_s(pipelineDescription.name, L"FSR2-ACCUMULATE");
-    FFX_VALIDATE(context->contextDescription.backendInterface.fpCreatePipeline(&context->contextDescription.backendInterface, FFX_EFFECT_FSR2, FFX_FSR2_PASS_ACCUMULATE,
-        getPipelinePermutationFlags(contextFlags, FFX_FSR2_PASS_ACCUMULATE, supportedFP16, canForceWave64, useLut),
-        &pipelineDescription, context->effectContextId, &context->pipelineAccumulate));
-    wcscpy_s(pipelineDescription.name, L"FSR2-ACCUM_SHARP");
-    FFX_VALIDATE(context->contextDescription.backendInterface.fpCreatePipeline(&context->contextDescription.backendInterface, FFX_EFFECT_FSR2, FFX_FSR2_PASS_ACCUMULATE_SHARPEN,
-        getPipelinePermutationFlags(contextFlags, FFX_FSR2_PASS_ACCUMULATE_SHARPEN, supportedFP16, canForceWave64, useLut),
-        &pipelineDescription, context->effectContextId, &context->pipelineAccumulateSharpen));
+    // Set up pipeline descriptors (basically RootSignature and binding)
+    const struct
+    {
+        FfxFsr2Pass         pass;
+        const wchar_t*      name;
+        uint32_t            rootConstantBufferCount;
+        FfxPipelineState*   pipeline;
+    } pipelines[] = {
+        { FFX_FSR2_PASS_COMPUTE_LUMINANCE_PYRAMID,  L"FSR2-LUM_PYRAMID",        2, &context->pipelineComputeLuminancePyramid },
+        { FFX_FSR2_PASS_RCAS,                       L"FSR2-RCAS",               2, &context->pipelineRCAS },
+        { FFX_FSR2_PASS_GENERATE_REACTIVE,          L"FSR2-GEN_REACTIVE",       2, &context->pipelineGenerateReactive },
+        { FFX_FSR2_PASS_TCR_AUTOGENERATE,           L"FSR2-TCR_AUTOGENERATE",   2, &context->pipelineTcrAutogenerate },
+        { FFX_FSR2_PASS_DEPTH_CLIP,                 L"FSR2-DEPTH_CLIP",         1, &context->pipelineDepthClip },
+        { FFX_FSR2_PASS_RECONSTRUCT_PREVIOUS_DEPTH, L"FSR2-RECON_PREV_DEPTH",   1, &context->pipelineReconstructPreviousDepth },
+        { FFX_FSR2_PASS_LOCK,                       L"FSR2-LOCK",               1, &context->pipelineLock },
+        { FFX_FSR2_PASS_ACCUMULATE,                 L"FSR2-ACCUMULATE",         1, &context->pipelineAccumulate },
+        { FFX_FSR2_PASS_ACCUMULATE_SHARPEN,         L"FSR2-ACCUM_SHARP",        1, &context->pipelineAccumulateSharpen },
+    };
+    const uint32_t pipelineCount = FFX_ARRAY_ELEMENTS(pipelines);
+
+    FfxPipelineDescription       pipelineDescriptions[FFX_ARRAY_ELEMENTS(pipelines)];
+    FfxPipelineCreateDescription pipelineCreateDescriptions[FFX_ARRAY_ELEMENTS(pipelines)];
+    for (uint32_t i = 0; i < pipelineCount; ++i)
+    {
+        pipelineDescriptions[i] = pipelineDescription;
+        pipelineDescriptions[i].rootConstantBufferCount = pipelines[i].rootConstantBufferCount;
+        wcscpy_s(pipelineDescriptions[i].name, pipelines[i].name);
+
+        pipelineCreateDescriptions[i].pass                = pipelines[i].pass;
+        pipelineCreateDescriptions[i].permutationOptions  = getPipelinePermutationFlags(contextFlags, pipelines[i].pass, supportedFP16, canForceWave64, useLut);
+        pipelineCreateDescriptions[i].pipelineDescription = &pipelineDescriptions[i];
+        pipelineCreateDescriptions[i].outPipeline         = pipelines[i].pipeline;
+    }
+
+    // Pipelines are independent, so let the backend compile them as a batch when it can
+    FfxInterface* backendInterface = &context->contextDescription.backendInterface;
+    if (backendInterface->fpCreatePipelines)
+    {
+        FFX_VALIDATE(backendInterface->fpCreatePipelines(backendInterface, FFX_EFFECT_FSR2, pipelineCreateDescriptions, pipelineCount, context->effectContextId));
+    }
+    else
+    {
+        for (uint32_t i = 0; i < pipelineCount; ++i)
+        {
+            const FfxPipelineCreateDescription& desc = pipelineCreateDescriptions[i];
+            FFX_VALIDATE(backendInterface->fpCreatePipeline(backendInterface, FFX_EFFECT_FSR2, desc.pass, desc.permutationOptions, desc.pipelineDescription, context->effectContextId, desc.outPipeline));
+        }
+    }
 
     // for each pipeline: re-route/fix-up IDs based on names
     patchResourceBindings(&context->pipelineDepthClip);
@@ -974,16 +939,18 @@ static void setupDeviceDepthToViewSpaceDepthParams(FfxFsr2Context_Private* conte
 
 static void scheduleDispatch(FfxFsr2Context_Private* context, const FfxFsr2DispatchDescription*, const FfxPipelineState* pipeline, uint32_t dispatchX, uint32_t dispatchY)
 {
-    FfxGpuJobDescription dispatchJob = {FFX_GPU_JOB_COMPUTE};
-    wcscpy_s(dispatchJob.jobLabel, pipeline->name);
+    // Only the slots the pipeline uses are filled in, the backend copies them when the job is scheduled
+    FfxTextureSRV     srvTextures[FFX_MAX_NUM_SRVS];
+    FfxTextureUAV     uavTextures[FFX_MAX_NUM_UAVS];
+    FfxConstantBuffer cbs[FFX_MAX_NUM_CONST_BUFFERS];
 
     for (uint32_t currentShaderResourceViewIndex = 0; currentShaderResourceViewIndex < pipeline->srvTextureCount; ++currentShaderResourceViewIndex) {
 
         const uint32_t currentResourceId = pipeline->srvTextureBindings[currentShaderResourceViewIndex].resourceIdentifier;
         const FfxResourceInternal currentResource = context->srvResources[currentResourceId];
-        dispatchJob.computeJobDescriptor.srvTextures[currentShaderResourceViewIndex].resource = currentResource;
+        srvTextures[currentShaderResourceViewIndex].resource = currentResource;
 #ifdef FFX_DEBUG
-        wcscpy_s(dispatchJob.computeJobDescriptor.srvTextures[currentShaderResourceViewIndex].name,
+        wcscpy_s(srvTextures[currentShaderResourceViewIndex].name,
                  pipeline->srvTextureBindings[currentShaderResourceViewIndex].name);
 #endif
     }
@@ -992,37 +959,62 @@ static void scheduleDispatch(FfxFsr2Context_Private* context, const FfxFsr2Dispa
 
         const uint32_t currentResourceId = pipeline->uavTextureBindings[currentUnorderedAccessViewIndex].resourceIdentifier;
 #ifdef FFX_DEBUG
-        wcscpy_s(dispatchJob.computeJobDescriptor.uavTextures[currentUnorderedAccessViewIndex].name,
+        wcscpy_s(uavTextures[currentUnorderedAccessViewIndex].name,
                  pipeline->uavTextureBindings[currentUnorderedAccessViewIndex].name);
 #endif
         if (currentResourceId >= FFX_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE_MIPMAP_0 && currentResourceId <= FFX_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE_MIPMAP_12)
         {
             const FfxResourceInternal currentResource = context->uavResources[FFX_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE];
-            dispatchJob.computeJobDescriptor.uavTextures[currentUnorderedAccessViewIndex].resource = currentResource;
-            dispatchJob.computeJobDescriptor.uavTextures[currentUnorderedAccessViewIndex].mip =
+            uavTextures[currentUnorderedAccessViewIndex].resource = currentResource;
+            uavTextures[currentUnorderedAccessViewIndex].mip =
                 currentResourceId - FFX_FSR2_RESOURCE_IDENTIFIER_SCENE_LUMINANCE_MIPMAP_0;
         }
         else
         {
             const FfxResourceInternal currentResource = context->uavResources[currentResourceId];
-            dispatchJob.computeJobDescriptor.uavTextures[currentUnorderedAccessViewIndex].resource = currentResource;
-            dispatchJob.computeJobDescriptor.uavTextures[currentUnorderedAccessViewIndex].mip = 0;
+            uavTextures[currentUnorderedAccessViewIndex].resource = currentResource;
+            uavTextures[currentUnorderedAccessViewIndex].mip = 0;
         }
     }
 
+    for (uint32_t currentRootConstantIndex = 0; currentRootConstantIndex < pipeline->constCount; ++currentRootConstantIndex) {
+        cbs[currentRootConstantIndex] = context->constantBuffers[pipeline->constantBufferBindings[currentRootConstantIndex].resourceIdentifier];
+    }
+
+    if (context->deviceCapabilities.compactComputeJobsSupported)
+    {
+        // Deliberately not zero-initialized, only the job type and the compact descriptor are read by the backend
+        FfxGpuJobDescription dispatchJob;
+        dispatchJob.jobType                     = FFX_GPU_JOB_COMPUTE_COMPACT;
+        dispatchJob.compactComputeJobDescriptor = {};
+        dispatchJob.compactComputeJobDescriptor.pipeline      = pipeline;
+        dispatchJob.compactComputeJobDescriptor.dimensions[0] = dispatchX;
+        dispatchJob.compactComputeJobDescriptor.dimensions[1] = dispatchY;
+        dispatchJob.compactComputeJobDescriptor.dimensions[2] = 1;
+        dispatchJob.compactComputeJobDescriptor.srvTextures   = srvTextures;
+        dispatchJob.compactComputeJobDescriptor.uavTextures   = uavTextures;
+        dispatchJob.compactComputeJobDescriptor.cbs           = cbs;
+
+        context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &dispatchJob);
+        return;
+    }
+
+    // Custom backends that don't report compact job support get the full descriptor
+    FfxGpuJobDescription dispatchJob = {FFX_GPU_JOB_COMPUTE};
+    wcscpy_s(dispatchJob.jobLabel, pipeline->name);
+    dispatchJob.computeJobDescriptor.pipeline      = *pipeline;
     dispatchJob.computeJobDescriptor.dimensions[0] = dispatchX;
     dispatchJob.computeJobDescriptor.dimensions[1] = dispatchY;
     dispatchJob.computeJobDescriptor.dimensions[2] = 1;
-    dispatchJob.computeJobDescriptor.pipeline      = *pipeline;
-
-    for (uint32_t currentRootConstantIndex = 0; currentRootConstantIndex < pipeline->constCount; ++currentRootConstantIndex) {
+    memcpy(dispatchJob.computeJobDescriptor.srvTextures, srvTextures, pipeline->srvTextureCount * sizeof(FfxTextureSRV));
+    memcpy(dispatchJob.computeJobDescriptor.uavTextures, uavTextures, pipeline->uavTextureCount * sizeof(FfxTextureUAV));
+    memcpy(dispatchJob.computeJobDescriptor.cbs, cbs, pipeline->constCount * sizeof(FfxConstantBuffer));
 #ifdef FFX_DEBUG
+    for (uint32_t currentRootConstantIndex = 0; currentRootConstantIndex < pipeline->constCount; ++currentRootConstantIndex) {
         wcscpy_s(dispatchJob.computeJobDescriptor.cbNames[currentRootConstantIndex], pipeline->constantBufferBindings[currentRootConstantIndex].name);
-#endif
-        dispatchJob.computeJobDescriptor.cbs[currentRootConstantIndex] = context->constantBuffers[pipeline->constantBufferBindings[currentRootConstantIndex].resourceIdentifier];
     }
+#endif
 
-    
     context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &dispatchJob);
 }
 
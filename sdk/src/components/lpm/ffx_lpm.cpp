@@ -30,84 +30,32 @@
 #define FFX_CPU
 #include <FidelityFX/gpu/ffx_core.h>
 
-static float    fs2S;
-static float    hdr10S;
-static uint32_t ctl[24 * 4];
-
-static void LpmSetupOut(uint32_t i, uint32_t* v)
-{
-    for (int j = 0; j < 4; ++j)
-    {
-        ctl[i * 4 + j] = v[j];
-    }
-}
+// Have FfxCalculateLpmConsts write each context's control block directly, so contexts on different threads share no state
+#define LPM_SETUP_OUT_CTL
 #include <FidelityFX/gpu/lpm/ffx_lpm.h>
 #include <ffx_object_management.h>
+#include <ffx_resource_binding_map.h>
 
 #include "ffx_lpm_private.h"
 
 // lists to map shader resource bindpoint name to resource identifier
-typedef struct ResourceBinding
-{
-    uint32_t index;
-    wchar_t  name[64];
-} ResourceBinding;
-
-static const ResourceBinding srvTextureBindingTable[] = {
+static const FfxResourceBindingMapEntry srvTextureBindingTable[] = {
     {FFX_LPM_RESOURCE_IDENTIFIER_INPUT_COLOR, L"r_input_color"},
 };
 
-static const ResourceBinding uavTextureBindingTable[] = {
+static const FfxResourceBindingMapEntry uavTextureBindingTable[] = {
     {FFX_LPM_RESOURCE_IDENTIFIER_OUTPUT_COLOR, L"rw_output_color"},
 };
 
-static const ResourceBinding cbResourceBindingTable[] = {
+static const FfxResourceBindingMapEntry cbResourceBindingTable[] = {
     {FFX_LPM_CONSTANTBUFFER_IDENTIFIER_LPM, L"cbLPM"},
 };
 
 static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
 {
-    for (uint32_t srvIndex = 0; srvIndex < inoutPipeline->srvTextureCount; ++srvIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(srvTextureBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(srvTextureBindingTable[mapIndex].name, inoutPipeline->srvTextureBindings[srvIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(srvTextureBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->srvTextureBindings[srvIndex].resourceIdentifier = srvTextureBindingTable[mapIndex].index;
-    }
-
-    for (uint32_t uavIndex = 0; uavIndex < inoutPipeline->uavTextureCount; ++uavIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(uavTextureBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(uavTextureBindingTable[mapIndex].name, inoutPipeline->uavTextureBindings[uavIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(uavTextureBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->uavTextureBindings[uavIndex].resourceIdentifier = uavTextureBindingTable[mapIndex].index;
-    }
-
-    for (uint32_t cbIndex = 0; cbIndex < inoutPipeline->constCount; ++cbIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(cbResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(cbResourceBindingTable[mapIndex].name, inoutPipeline->constantBufferBindings[cbIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(cbResourceBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->constantBufferBindings[cbIndex].resourceIdentifier = cbResourceBindingTable[mapIndex].index;
-    }
+    FFX_VALIDATE(ffxResolveResourceBindings(inoutPipeline->srvTextureBindings, inoutPipeline->srvTextureCount, srvTextureBindingTable));
+    FFX_VALIDATE(ffxResolveResourceBindings(inoutPipeline->uavTextureBindings, inoutPipeline->uavTextureCount, uavTextureBindingTable));
+    FFX_VALIDATE(ffxResolveResourceBindings(inoutPipeline->constantBufferBindings, inoutPipeline->constCount, cbResourceBindingTable));
 
     return FFX_OK;
 }
@@ -216,23 +164,33 @@ static void scheduleDispatch(FfxLpmContext_Private* context, const FfxLpmDispatc
     context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &dispatchJob);
 }
 
-static FfxErrorCode lpmDispatch(FfxLpmContext_Private* context, const FfxLpmDispatchDescription* params)
+static void lpmGetConstantsKey(LpmConstantsKey* key, const FfxLpmDispatchDescription* params)
 {
-    // take a short cut to the command list
-    FfxCommandList commandList = params->commandList;
-
-    // Register resources for frame
-    context->contextDescription.backendInterface.fpRegisterResource(&context->contextDescription.backendInterface, &params->inputColor, context->effectContextId, &context->srvResources[FFX_LPM_RESOURCE_IDENTIFIER_INPUT_COLOR]);
-
-    context->contextDescription.backendInterface.fpRegisterResource(
-        &context->contextDescription.backendInterface, &params->outputColor, context->effectContextId, &context->uavResources[FFX_LPM_RESOURCE_IDENTIFIER_OUTPUT_COLOR]);
+    // clear the padding too, keys are compared bytewise
+    memset(key, 0, sizeof(LpmConstantsKey));
+    key->shoulder            = params->shoulder;
+    key->softGap             = params->softGap;
+    key->hdrMax              = params->hdrMax;
+    key->lpmExposure         = params->lpmExposure;
+    key->contrast            = params->contrast;
+    key->shoulderContrast    = params->shoulderContrast;
+    memcpy(key->saturation, params->saturation, sizeof(key->saturation));
+    memcpy(key->crosstalk, params->crosstalk, sizeof(key->crosstalk));
+    key->colorSpace          = params->colorSpace;
+    key->displayMode         = params->displayMode;
+    memcpy(key->displayRedPrimary, params->displayRedPrimary, sizeof(key->displayRedPrimary));
+    memcpy(key->displayGreenPrimary, params->displayGreenPrimary, sizeof(key->displayGreenPrimary));
+    memcpy(key->displayBluePrimary, params->displayBluePrimary, sizeof(key->displayBluePrimary));
+    memcpy(key->displayWhitePoint, params->displayWhitePoint, sizeof(key->displayWhitePoint));
+    key->displayMinLuminance = params->displayMinLuminance;
+    key->displayMaxLuminance = params->displayMaxLuminance;
+}
 
-    // This value is the image region dimension that each thread group of the LPM shader operates on
-    static const int threadGroupWorkRegionDim = 16;
-    FfxResourceDescription desc = context->contextDescription.backendInterface.fpGetResourceDescription(
-        &context->contextDescription.backendInterface, context->srvResources[FFX_LPM_RESOURCE_IDENTIFIER_INPUT_COLOR]);
-    int dispatchX = FFX_DIVIDE_ROUNDING_UP(desc.width, threadGroupWorkRegionDim);
-    int dispatchY = FFX_DIVIDE_ROUNDING_UP(desc.height, threadGroupWorkRegionDim);
+static void lpmSetupConstants(LpmConstants* lpmConsts, const FfxLpmDispatchDescription* params)
+{
+    // Scale factors referenced by the LPM_COLORS_ prefabs
+    float fs2S   = 0.0f;
+    float hdr10S = 0.0f;
 
     FfxFloat32x2 fs2R;
     FfxFloat32x2 fs2G;
@@ -266,9 +224,9 @@ static FfxErrorCode lpmDispatch(FfxLpmContext_Private* context, const FfxLpmDisp
     crosstalk[1] = params->crosstalk[1];
     crosstalk[2] = params->crosstalk[2];
 
-    LpmConstants lpmConsts = {};
+    memset(lpmConsts, 0, sizeof(LpmConstants));
 
-    lpmConsts.displayMode = static_cast<FfxUInt32>(params->displayMode);
+    lpmConsts->displayMode = static_cast<FfxUInt32>(params->displayMode);
 
     switch (params->colorSpace)
     {
@@ -278,7 +236,8 @@ static FfxErrorCode lpmDispatch(FfxLpmContext_Private* context, const FfxLpmDisp
             {
                 case FfxLpmDisplayMode::FFX_LPM_DISPLAYMODE_LDR:
                 {
-                    FfxCalculateLpmConsts(params->shoulder,
+                    FfxCalculateLpmConsts(lpmConsts->ctl,
+                                          params->shoulder,
                                           LPM_CONFIG_709_709,
                                           LPM_COLORS_709_709,
                                           params->softGap,
@@ -288,13 +247,14 @@ static FfxErrorCode lpmDispatch(FfxLpmContext_Private* context, const FfxLpmDisp
                                           params->shoulderContrast,
                                           saturation,
                                           crosstalk);
-                    FfxPopulateLpmConsts(LPM_CONFIG_709_709, lpmConsts.con, lpmConsts.soft, lpmConsts.con2, lpmConsts.clip, lpmConsts.scaleOnly);
+                    FfxPopulateLpmConsts(LPM_CONFIG_709_709, lpmConsts->con, lpmConsts->soft, lpmConsts->con2, lpmConsts->clip, lpmConsts->scaleOnly);
                 }
                 break;
                 case FfxLpmDisplayMode::FFX_LPM_DISPLAYMODE_FSHDR_2084:
                 {
                     hdr10S = LpmHdr10RawScalar(displayMinMaxLuminance[1]);
-                    FfxCalculateLpmConsts(params->shoulder,
+                    FfxCalculateLpmConsts(lpmConsts->ctl,
+                                          params->shoulder,
                                           LPM_CONFIG_FS2RAWPQ_709,
                                           LPM_COLORS_FS2RAWPQ_709,
                                           params->softGap,
@@ -304,13 +264,14 @@ static FfxErrorCode lpmDispatch(FfxLpmContext_Private* context, const FfxLpmDisp
                                           params->shoulderContrast,
                                           saturation,
                                           crosstalk);
-                    FfxPopulateLpmConsts(LPM_CONFIG_FS2RAWPQ_709, lpmConsts.con, lpmConsts.soft, lpmConsts.con2, lpmConsts.clip, lpmConsts.scaleOnly);
+                    FfxPopulateLpmConsts(LPM_CONFIG_FS2RAWPQ_709, lpmConsts->con, lpmConsts->soft, lpmConsts->con2, lpmConsts->clip, lpmConsts->scaleOnly);
                 }
                 break;
                 case FfxLpmDisplayMode::FFX_LPM_DISPLAYMODE_FSHDR_SCRGB:
                 {
                     fs2S = LpmFs2ScrgbScalar(displayMinMaxLuminance[0], displayMinMaxLuminance[1]);
-                    FfxCalculateLpmConsts(params->shoulder,
+                    FfxCalculateLpmConsts(lpmConsts->ctl,
+                                          params->shoulder,
                                           LPM_CONFIG_FS2SCRGB_709,
                                           LPM_COLORS_FS2SCRGB_709,
                                           params->softGap,
@@ -320,13 +281,14 @@ static FfxErrorCode lpmDispatch(FfxLpmContext_Private* context, const FfxLpmDisp
                                           params->shoulderContrast,
                                           saturation,
                                           crosstalk);
-                    FfxPopulateLpmConsts(LPM_CONFIG_FS2SCRGB_709, lpmConsts.con, lpmConsts.soft, lpmConsts.con2, lpmConsts.clip, lpmConsts.scaleOnly);
+                    FfxPopulateLpmConsts(LPM_CONFIG_FS2SCRGB_709, lpmConsts->con, lpmConsts->soft, lpmConsts->con2, lpmConsts->clip, lpmConsts->scaleOnly);
                 }
                 break;
                 case FfxLpmDisplayMode::FFX_LPM_DISPLAYMODE_HDR10_2084:
                 {
                     hdr10S = LpmHdr10RawScalar(displayMinMaxLuminance[1]);
-                    FfxCalculateLpmConsts(params->shoulder,
+                    FfxCalculateLpmConsts(lpmConsts->ctl,
+                                          params->shoulder,
                                           LPM_CONFIG_HDR10RAW_709,
                                           LPM_COLORS_HDR10RAW_709,
                                           params->softGap,
@@ -336,13 +298,14 @@ static FfxErrorCode lpmDispatch(FfxLpmContext_Private* context, const FfxLpmDisp
                                           params->shoulderContrast,
                                           saturation,
                                           crosstalk);
-                    FfxPopulateLpmConsts(LPM_CONFIG_HDR10RAW_709, lpmConsts.con, lpmConsts.soft, lpmConsts.con2, lpmConsts.clip, lpmConsts.scaleOnly);
+                    FfxPopulateLpmConsts(LPM_CONFIG_HDR10RAW_709, lpmConsts->con, lpmConsts->soft, lpmConsts->con2, lpmConsts->clip, lpmConsts->scaleOnly);
                 }
                 break;
                 case FfxLpmDisplayMode::FFX_LPM_DISPLAYMODE_HDR10_SCRGB:
                 {
                     hdr10S = LpmHdr10ScrgbScalar(displayMinMaxLuminance[1]);
-                    FfxCalculateLpmConsts(params->shoulder,
+                    FfxCalculateLpmConsts(lpmConsts->ctl,
+                                          params->shoulder,
                                           LPM_CONFIG_HDR10SCRGB_709,
                                           LPM_COLORS_HDR10SCRGB_709,
                                           params->softGap,
@@ -352,7 +315,7 @@ static FfxErrorCode lpmDispatch(FfxLpmContext_Private* context, const FfxLpmDisp
                                           params->shoulderContrast,
                                           saturation,
                                           crosstalk);
-                    FfxPopulateLpmConsts(LPM_CONFIG_HDR10SCRGB_709, lpmConsts.con, lpmConsts.soft, lpmConsts.con2, lpmConsts.clip, lpmConsts.scaleOnly);
+                    FfxPopulateLpmConsts(LPM_CONFIG_HDR10SCRGB_709, lpmConsts->con, lpmConsts->soft, lpmConsts->con2, lpmConsts->clip, lpmConsts->scaleOnly);
                 }
                 break;
             }
@@ -364,7 +327,8 @@ static FfxErrorCode lpmDispatch(FfxLpmContext_Private* context, const FfxLpmDisp
             {
                 case FfxLpmDisplayMode::FFX_LPM_DISPLAYMODE_LDR:
                 {
-                    FfxCalculateLpmConsts(params->shoulder,
+                    FfxCalculateLpmConsts(lpmConsts->ctl,
+                                          params->shoulder,
                                           LPM_CONFIG_709_P3,
                                           LPM_COLORS_709_P3,
                                           params->softGap,
@@ -374,12 +338,13 @@ static FfxErrorCode lpmDispatch(FfxLpmContext_Private* context, const FfxLpmDisp
                                           params->shoulderContrast,
                                           saturation,
                                           crosstalk);
-                    FfxPopulateLpmConsts(LPM_CONFIG_709_P3, lpmConsts.con, lpmConsts.soft, lpmConsts.con2, lpmConsts.clip, lpmConsts.scaleOnly);
+                    FfxPopulateLpmConsts(LPM_CONFIG_709_P3, lpmConsts->con, lpmConsts->soft, lpmConsts->con2, lpmConsts->clip, lpmConsts->scaleOnly);
                 }
                 break;
                 case FfxLpmDisplayMode::FFX_LPM_DISPLAYMODE_FSHDR_2084:
                 {
-                    FfxCalculateLpmConsts(params->shoulder,
+                    FfxCalculateLpmConsts(lpmConsts->ctl,
+                                          params->shoulder,
                                           LPM_CONFIG_FS2RAWPQ_P3,
                                           LPM_COLORS_FS2RAWPQ_P3,
                                           params->softGap,
@@ -389,13 +354,14 @@ static FfxErrorCode lpmDispatch(FfxLpmContext_Private* context, const FfxLpmDisp
                                           params->shoulderContrast,
                                           saturation,
                                           crosstalk);
-                    FfxPopulateLpmConsts(LPM_CONFIG_FS2RAWPQ_P3, lpmConsts.con, lpmConsts.soft, lpmConsts.con2, lpmConsts.clip, lpmConsts.scaleOnly);
+                    FfxPopulateLpmConsts(LPM_CONFIG_FS2RAWPQ_P3, lpmConsts->con, lpmConsts->soft, lpmConsts->con2, lpmConsts->clip, lpmConsts->scaleOnly);
                 }
                 break;
                 case FfxLpmDisplayMode::FFX_LPM_DISPLAYMODE_FSHDR_SCRGB:
                 {
                     fs2S = LpmFs2ScrgbScalar(displayMinMaxLuminance[0], displayMinMaxLuminance[1]);
-                    FfxCalculateLpmConsts(params->shoulder,
+                    FfxCalculateLpmConsts(lpmConsts->ctl,
+                                          params->shoulder,
                                           LPM_CONFIG_FS2SCRGB_P3,
                                           LPM_COLORS_FS2SCRGB_P3,
                                           params->softGap,
@@ -405,13 +371,14 @@ static FfxErrorCode lpmDispatch(FfxLpmContext_Private* context, const FfxLpmDisp
                                           params->shoulderContrast,
                                           saturation,
                                           crosstalk);
-                    FfxPopulateLpmConsts(LPM_CONFIG_FS2SCRGB_P3, lpmConsts.con, lpmConsts.soft, lpmConsts.con2, lpmConsts.clip, lpmConsts.scaleOnly);
+                    FfxPopulateLpmConsts(LPM_CONFIG_FS2SCRGB_P3, lpmConsts->con, lpmConsts->soft, lpmConsts->con2, lpmConsts->clip, lpmConsts->scaleOnly);
                 }
                 break;
                 case FfxLpmDisplayMode::FFX_LPM_DISPLAYMODE_HDR10_2084:
                 {
                     hdr10S = LpmHdr10RawScalar(displayMinMaxLuminance[1]);
-                    FfxCalculateLpmConsts(params->shoulder,
+                    FfxCalculateLpmConsts(lpmConsts->ctl,
+                                          params->shoulder,
                                           LPM_CONFIG_HDR10RAW_P3,
                                           LPM_COLORS_HDR10RAW_P3,
                                           params->softGap,
@@ -421,13 +388,14 @@ static FfxErrorCode lpmDispatch(FfxLpmContext_Private* context, const FfxLpmDisp
                                           params->shoulderContrast,
                                           saturation,
                                           crosstalk);
-                    FfxPopulateLpmConsts(LPM_CONFIG_HDR10RAW_P3, lpmConsts.con, lpmConsts.soft, lpmConsts.con2, lpmConsts.clip, lpmConsts.scaleOnly);
+                    FfxPopulateLpmConsts(LPM_CONFIG_HDR10RAW_P3, lpmConsts->con, lpmConsts->soft, lpmConsts->con2, lpmConsts->clip, lpmConsts->scaleOnly);
                 }
                 break;
                 case FfxLpmDisplayMode::FFX_LPM_DISPLAYMODE_HDR10_SCRGB:
                 {
                     hdr10S = LpmHdr10ScrgbScalar(displayMinMaxLuminance[1]);
-                    FfxCalculateLpmConsts(params->shoulder,
+                    FfxCalculateLpmConsts(lpmConsts->ctl,
+                                          params->shoulder,
                                           LPM_CONFIG_HDR10SCRGB_P3,
                                           LPM_COLORS_HDR10SCRGB_P3,
                                           params->softGap,
@@ -437,7 +405,7 @@ static FfxErrorCode lpmDispatch(FfxLpmContext_Private* context, const FfxLpmDisp
                                           params->shoulderContrast,
                                           saturation,
                                           crosstalk);
-                    FfxPopulateLpmConsts(LPM_CONFIG_HDR10SCRGB_P3, lpmConsts.con, lpmConsts.soft, lpmConsts.con2, lpmConsts.clip, lpmConsts.scaleOnly);
+                    FfxPopulateLpmConsts(LPM_CONFIG_HDR10SCRGB_P3, lpmConsts->con, lpmConsts->soft, lpmConsts->con2, lpmConsts->clip, lpmConsts->scaleOnly);
                 }
                 break;
             }
@@ -449,7 +417,8 @@ static FfxErrorCode lpmDispatch(FfxLpmContext_Private* context, const FfxLpmDisp
             {
                 case FfxLpmDisplayMode::FFX_LPM_DISPLAYMODE_LDR:
                 {
-                    FfxCalculateLpmConsts(params->shoulder,
+                    FfxCalculateLpmConsts(lpmConsts->ctl,
+                                          params->shoulder,
                                           LPM_CONFIG_709_2020,
                                           LPM_COLORS_709_2020,
                                           params->softGap,
@@ -459,12 +428,13 @@ static FfxErrorCode lpmDispatch(FfxLpmContext_Private* context, const FfxLpmDisp
                                           params->shoulderContrast,
                                           saturation,
                                           crosstalk);
-                    FfxPopulateLpmConsts(LPM_CONFIG_709_2020, lpmConsts.con, lpmConsts.soft, lpmConsts.con2, lpmConsts.clip, lpmConsts.scaleOnly);
+                    FfxPopulateLpmConsts(LPM_CONFIG_709_2020, lpmConsts->con, lpmConsts->soft, lpmConsts->con2, lpmConsts->clip, lpmConsts->scaleOnly);
                 }
                 break;
                 case FfxLpmDisplayMode::FFX_LPM_DISPLAYMODE_FSHDR_2084:
                 {
-                    FfxCalculateLpmConsts(params->shoulder,
+                    FfxCalculateLpmConsts(lpmConsts->ctl,
+                                          params->shoulder,
                                           LPM_CONFIG_FS2RAWPQ_2020,
                                           LPM_COLORS_FS2RAWPQ_2020,
                                           params->softGap,
@@ -474,13 +444,14 @@ static FfxErrorCode lpmDispatch(FfxLpmContext_Private* context, const FfxLpmDisp
                                           params->shoulderContrast,
                                           saturation,
                                           crosstalk);
-                    FfxPopulateLpmConsts(LPM_CONFIG_FS2RAWPQ_2020, lpmConsts.con, lpmConsts.soft, lpmConsts.con2, lpmConsts.clip, lpmConsts.scaleOnly);
+                    FfxPopulateLpmConsts(LPM_CONFIG_FS2RAWPQ_2020, lpmConsts->con, lpmConsts->soft, lpmConsts->con2, lpmConsts->clip, lpmConsts->scaleOnly);
                 }
                 break;
                 case FfxLpmDisplayMode::FFX_LPM_DISPLAYMODE_FSHDR_SCRGB:
                 {
                     fs2S = LpmFs2ScrgbScalar(displayMinMaxLuminance[0], displayMinMaxLuminance[1]);
-                    FfxCalculateLpmConsts(params->shoulder,
+                    FfxCalculateLpmConsts(lpmConsts->ctl,
+                                          params->shoulder,
                                           LPM_CONFIG_FS2SCRGB_2020,
                                           LPM_COLORS_FS2SCRGB_2020,
                                           params->softGap,
@@ -490,13 +461,14 @@ static FfxErrorCode lpmDispatch(FfxLpmContext_Private* context, const FfxLpmDisp
                                           params->shoulderContrast,
                                           saturation,
                                           crosstalk);
-                    FfxPopulateLpmConsts(LPM_CONFIG_FS2SCRGB_2020, lpmConsts.con, lpmConsts.soft, lpmConsts.con2, lpmConsts.clip, lpmConsts.scaleOnly);
+                    FfxPopulateLpmConsts(LPM_CONFIG_FS2SCRGB_2020, lpmConsts->con, lpmConsts->soft, lpmConsts->con2, lpmConsts->clip, lpmConsts->scaleOnly);
                 }
                 break;
                 case FfxLpmDisplayMode::FFX_LPM_DISPLAYMODE_HDR10_2084:
                 {
                     hdr10S = LpmHdr10RawScalar(displayMinMaxLuminance[1]);
-                    FfxCalculateLpmConsts(params->shoulder,
+                    FfxCalculateLpmConsts(lpmConsts->ctl,
+                                          params->shoulder,
                                           LPM_CONFIG_HDR10RAW_2020,
                                           LPM_COLORS_HDR10RAW_2020,
                                           params->softGap,
@@ -506,13 +478,14 @@ static FfxErrorCode lpmDispatch(FfxLpmContext_Private* context, const FfxLpmDisp
                                           params->shoulderContrast,
                                           saturation,
                                           crosstalk);
-                    FfxPopulateLpmConsts(LPM_CONFIG_HDR10RAW_2020, lpmConsts.con, lpmConsts.soft, lpmConsts.con2, lpmConsts.clip, lpmConsts.scaleOnly);
+                    FfxPopulateLpmConsts(LPM_CONFIG_HDR10RAW_2020, lpmConsts->con, lpmConsts->soft, lpmConsts->con2, lpmConsts->clip, lpmConsts->scaleOnly);
                 }
                 break;
                 case FfxLpmDisplayMode::FFX_LPM_DISPLAYMODE_HDR10_SCRGB:
                 {
                     hdr10S = LpmHdr10ScrgbScalar(displayMinMaxLuminance[1]);
-                    FfxCalculateLpmConsts(params->shoulder,
+                    FfxCalculateLpmConsts(lpmConsts->ctl,
+                                          params->shoulder,
                                           LPM_CONFIG_HDR10SCRGB_2020,
                                           LPM_COLORS_HDR10SCRGB_2020,
                                           params->softGap,
@@ -522,7 +495,7 @@ static FfxErrorCode lpmDispatch(FfxLpmContext_Private* context, const FfxLpmDisp
                                           params->shoulderContrast,
                                           saturation,
                                           crosstalk);
-                    FfxPopulateLpmConsts(LPM_CONFIG_HDR10SCRGB_2020, lpmConsts.con, lpmConsts.soft, lpmConsts.con2, lpmConsts.clip, lpmConsts.scaleOnly);
+                    FfxPopulateLpmConsts(LPM_CONFIG_HDR10SCRGB_2020, lpmConsts->con, lpmConsts->soft, lpmConsts->con2, lpmConsts->clip, lpmConsts->scaleOnly);
                 }
                 break;
             }
@@ -531,11 +504,38 @@ static FfxErrorCode lpmDispatch(FfxLpmContext_Private* context, const FfxLpmDisp
         default:
             break;
     }
+}
+
+static FfxErrorCode lpmDispatch(FfxLpmContext_Private* context, const FfxLpmDispatchDescription* params)
+{
+    // take a short cut to the command list
+    FfxCommandList commandList = params->commandList;
+
+    // Register resources for frame
+    context->contextDescription.backendInterface.fpRegisterResource(&context->contextDescription.backendInterface, &params->inputColor, context->effectContextId, &context->srvResources[FFX_LPM_RESOURCE_IDENTIFIER_INPUT_COLOR]);
+
+    context->contextDescription.backendInterface.fpRegisterResource(
+        &context->contextDescription.backendInterface, &params->outputColor, context->effectContextId, &context->uavResources[FFX_LPM_RESOURCE_IDENTIFIER_OUTPUT_COLOR]);
 
-    memcpy(lpmConsts.ctl, ctl, sizeof(ctl));
+    // This value is the image region dimension that each thread group of the LPM shader operates on
+    static const int threadGroupWorkRegionDim = 16;
+    FfxResourceDescription desc = context->contextDescription.backendInterface.fpGetResourceDescription(
+        &context->contextDescription.backendInterface, context->srvResources[FFX_LPM_RESOURCE_IDENTIFIER_INPUT_COLOR]);
+    int dispatchX = FFX_DIVIDE_ROUNDING_UP(desc.width, threadGroupWorkRegionDim);
+    int dispatchY = FFX_DIVIDE_ROUNDING_UP(desc.height, threadGroupWorkRegionDim);
+
+    // The constants only depend on the tone and gamut mapping inputs, so they are only set up again when those change
+    LpmConstantsKey constantsKey;
+    lpmGetConstantsKey(&constantsKey, params);
+    if (!context->constantsValid || memcmp(&constantsKey, &context->constantsKey, sizeof(constantsKey)) != 0)
+    {
+        lpmSetupConstants(&context->constants, params);
+        context->constantsKey   = constantsKey;
+        context->constantsValid = true;
+    }
 
     context->contextDescription.backendInterface.fpStageConstantBufferDataFunc(&context->contextDescription.backendInterface, 
-                                                                               &lpmConsts, 
+                                                                               &context->constants, 
                                                                                sizeof(LpmConstants), 
                                                                                &context->constantBuffer);
     
@@ -662,6 +662,21 @@ FfxErrorCode ffxLpmContextDispatch(FfxLpmContext* context, const FfxLpmDispatchD
     return errorCode;
 }
 
+FfxErrorCode ffxLpmCalculateCpuConstants(FfxLpmCpuConstants* constants, const FfxLpmDispatchDescription* dispatchDescription)
+{
+    FFX_RETURN_ON_ERROR(constants, FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(dispatchDescription, FFX_ERROR_INVALID_POINTER);
+
+    // The CPU filter reads the very constants the GPU filter does
+    FFX_STATIC_ASSERT(sizeof(FfxLpmCpuConstants) == sizeof(LpmConstants));
+
+    LpmConstants lpmConsts;
+    lpmSetupConstants(&lpmConsts, dispatchDescription);
+    memcpy(constants, &lpmConsts, sizeof(LpmConstants));
+
+    return FFX_OK;
+}
+
 FFX_API FfxErrorCode FfxPopulateLpmConsts(bool      incon,
                                           bool      insoft,
                                           bool      incon2,
@@ -0,0 +1,593 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <FidelityFX/host/ffx_lpm.h>
+#include <FidelityFX/host/ffx_util.h>
+
+#include <string.h>  // for memcpy
+#include <cmath>
+#include <atomic>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+// The widest vector instruction set the SDK is compiled for is used, there is no runtime dispatch.
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define FFX_LPM_CPU_AVX2 1
+#elif defined(_M_X64) || defined(__x86_64__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#include <emmintrin.h>
+#define FFX_LPM_CPU_SSE2 1
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#include <arm_neon.h>
+#define FFX_LPM_CPU_NEON 1
+#endif
+
+// Rows are handed out to the filter threads in bands of this many rows.
+static const uint32_t LPM_CPU_ROWS_PER_BAND = 16;
+
+// The inputs of LpmMap(), unpacked from the control block the same way LpmFilter() loads them.
+struct LpmCpuMapper
+{
+    float lumaW[3];
+    float lumaT[3];
+    float rcpLumaT[3];
+    float saturation[3];
+    float contrast;
+    float shoulderContrast;
+    float toneScaleBias[2];
+    float crosstalk[3];
+    float conR[3];
+    float conG[3];
+    float conB[3];
+    float softGap[2];
+    float con2R[3];
+    float con2G[3];
+    float con2B[3];
+
+    bool        shoulder;
+    bool        con;
+    bool        soft;
+    bool        con2;
+    bool        clip;
+    bool        scaleOnly;
+    uint32_t    displayMode;
+};
+
+static void lpmCpuUnpack(float* out, const uint32_t* ctl, uint32_t first, uint32_t count)
+{
+    memcpy(out, ctl + first, count * sizeof(float));
+}
+
+static void lpmCpuSetupMapper(LpmCpuMapper* mapper, const FfxLpmCpuConstants* constants)
+{
+    // Offsets into ctl[] of the map0..map9 components read by LpmFilter()
+    const uint32_t* ctl = constants->ctl;
+    lpmCpuUnpack(mapper->saturation, ctl, 0, 3);
+    lpmCpuUnpack(&mapper->contrast, ctl, 3, 1);
+    lpmCpuUnpack(mapper->toneScaleBias, ctl, 4, 2);
+    lpmCpuUnpack(mapper->lumaT, ctl, 6, 3);
+    lpmCpuUnpack(mapper->crosstalk, ctl, 9, 3);
+    lpmCpuUnpack(mapper->rcpLumaT, ctl, 12, 3);
+    lpmCpuUnpack(mapper->con2R, ctl, 15, 3);
+    lpmCpuUnpack(mapper->con2G, ctl, 18, 3);
+    lpmCpuUnpack(mapper->con2B, ctl, 21, 3);
+    lpmCpuUnpack(&mapper->shoulderContrast, ctl, 24, 1);
+    lpmCpuUnpack(mapper->lumaW, ctl, 25, 3);
+    lpmCpuUnpack(mapper->softGap, ctl, 28, 2);
+    lpmCpuUnpack(mapper->conR, ctl, 30, 3);
+    lpmCpuUnpack(mapper->conG, ctl, 33, 3);
+    lpmCpuUnpack(mapper->conB, ctl, 36, 3);
+
+    mapper->shoulder    = constants->shoulder != 0;
+    mapper->con         = constants->con != 0;
+    mapper->soft        = constants->soft != 0;
+    mapper->con2        = constants->con2 != 0;
+    mapper->clip        = constants->clip != 0;
+    mapper->scaleOnly   = constants->scaleOnly != 0;
+    mapper->displayMode = constants->displayMode;
+}
+
+//==============================================================================================================================
+//                                                           LANES
+//------------------------------------------------------------------------------------------------------------------------------
+// Each lane type filters Width pixels at once. They provide the arithmetic LpmMap() needs, pow(), and conversion of RGBA
+// pixels to and from one register per channel.
+//==============================================================================================================================
+struct LpmCpuLanesScalar
+{
+    typedef float Type;
+    static const uint32_t Width = 1;
+
+    static Type Splat(float v) { return v; }
+    static Type Add(Type a, Type b) { return a + b; }
+    static Type Sub(Type a, Type b) { return a - b; }
+    static Type Mul(Type a, Type b) { return a * b; }
+    static Type Div(Type a, Type b) { return a / b; }
+    static Type Min(Type a, Type b) { return a < b ? a : b; }
+    static Type Max(Type a, Type b) { return a > b ? a : b; }
+    static Type Abs(Type a) { return std::fabs(a); }
+    static Type Pow(Type a, float b) { return std::pow(a, b); }
+    static Type Exp2(Type a) { return std::exp2(a); }
+
+    static void Load(const float* pixels, Type& r, Type& g, Type& b, Type& a)
+    {
+        r = pixels[0];
+        g = pixels[1];
+        b = pixels[2];
+        a = pixels[3];
+    }
+
+    static void Store(float* pixels, Type r, Type g, Type b, Type a)
+    {
+        pixels[0] = r;
+        pixels[1] = g;
+        pixels[2] = b;
+        pixels[3] = a;
+    }
+};
+
+// Polynomial log2() and exp2() for the vector lanes, accurate to a few ulp over the range LPM uses. log2() reduces the
+// mantissa to [sqrt(0.5), sqrt(2)) and uses the atanh series, exp2() rounds to the nearest integer power and uses the
+// Taylor series of 2^f over [-0.5, 0.5]. Zero and negative inputs of log2() return -inf, so pow(0, y) is 0 as on the GPU.
+#define LPM_CPU_LOG2_SERIES(L, t)                                                                                                         \
+    L::Mul(t, L::Add(L::Splat(2.8853900817779268f), L::Mul(L::Mul(t, t), L::Add(L::Splat(0.9617966939259756f),                   \
+        L::Mul(L::Mul(t, t), L::Add(L::Splat(0.5770780163555854f), L::Mul(L::Mul(t, t), L::Splat(0.4121985831111324f))))))))
+
+#define LPM_CPU_EXP2_SERIES(L, f)                                                                                                         \
+    L::Add(L::Splat(1.0f), L::Mul(f, L::Add(L::Splat(0.6931471805599453f), L::Mul(f, L::Add(L::Splat(0.2402265069591007f),        \
+        L::Mul(f, L::Add(L::Splat(0.05550410866482158f), L::Mul(f, L::Add(L::Splat(0.009618129107628477f),                           \
+        L::Mul(f, L::Add(L::Splat(0.0013333558146428443f), L::Mul(f, L::Add(L::Splat(0.00015403530393381606f),                       \
+        L::Mul(f, L::Splat(1.525273380405984e-05f)))))))))))))))
+
+#if defined(FFX_LPM_CPU_SSE2)
+struct LpmCpuLanesSSE2
+{
+    typedef __m128 Type;
+    static const uint32_t Width = 4;
+
+    static Type Splat(float v) { return _mm_set1_ps(v); }
+    static Type Add(Type a, Type b) { return _mm_add_ps(a, b); }
+    static Type Sub(Type a, Type b) { return _mm_sub_ps(a, b); }
+    static Type Mul(Type a, Type b) { return _mm_mul_ps(a, b); }
+    static Type Div(Type a, Type b) { return _mm_div_ps(a, b); }
+    static Type Min(Type a, Type b) { return _mm_min_ps(a, b); }
+    static Type Max(Type a, Type b) { return _mm_max_ps(a, b); }
+    static Type Abs(Type a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+
+    static Type Log2(Type a)
+    {
+        const __m128i bits     = _mm_castps_si128(a);
+        __m128        exponent = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127)));
+        __m128        mantissa = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007fffff)), _mm_set1_epi32(0x3f800000)));
+
+        const __m128 large = _mm_cmpgt_ps(mantissa, _mm_set1_ps(1.41421356f));
+        mantissa           = _mm_or_ps(_mm_and_ps(large, _mm_mul_ps(mantissa, _mm_set1_ps(0.5f))), _mm_andnot_ps(large, mantissa));
+        exponent           = _mm_add_ps(exponent, _mm_and_ps(large, _mm_set1_ps(1.0f)));
+
+        const __m128 t      = _mm_div_ps(_mm_sub_ps(mantissa, _mm_set1_ps(1.0f)), _mm_add_ps(mantissa, _mm_set1_ps(1.0f)));
+        const __m128 result = _mm_add_ps(exponent, LPM_CPU_LOG2_SERIES(LpmCpuLanesSSE2, t));
+
+        const __m128 positive = _mm_cmpgt_ps(a, _mm_setzero_ps());
+        return _mm_or_ps(_mm_and_ps(positive, result), _mm_andnot_ps(positive, _mm_set1_ps(-INFINITY)));
+    }
+
+    static Type Exp2(Type a)
+    {
+        const __m128  clamped  = _mm_min_ps(_mm_max_ps(a, _mm_set1_ps(-126.0f)), _mm_set1_ps(127.0f));
+        const __m128i exponent = _mm_cvtps_epi32(clamped);
+        const __m128  f        = _mm_sub_ps(clamped, _mm_cvtepi32_ps(exponent));
+        const __m128  scale    = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(exponent, _mm_set1_epi32(127)), 23));
+        const __m128  result   = _mm_mul_ps(LPM_CPU_EXP2_SERIES(LpmCpuLanesSSE2, f), scale);
+        return _mm_and_ps(_mm_cmpge_ps(a, _mm_set1_ps(-126.0f)), result);
+    }
+
+    static Type Pow(Type a, float b) { return Exp2(Mul(Log2(a), Splat(b))); }
+
+    static void Load(const float* pixels, Type& r, Type& g, Type& b, Type& a)
+    {
+        r = _mm_loadu_ps(pixels + 0);
+        g = _mm_loadu_ps(pixels + 4);
+        b = _mm_loadu_ps(pixels + 8);
+        a = _mm_loadu_ps(pixels + 12);
+        _MM_TRANSPOSE4_PS(r, g, b, a);
+    }
+
+    static void Store(float* pixels, Type r, Type g, Type b, Type a)
+    {
+        _MM_TRANSPOSE4_PS(r, g, b, a);
+        _mm_storeu_ps(pixels + 0, r);
+        _mm_storeu_ps(pixels + 4, g);
+        _mm_storeu_ps(pixels + 8, b);
+        _mm_storeu_ps(pixels + 12, a);
+    }
+};
+typedef LpmCpuLanesSSE2 LpmCpuLanes;
+#endif  // #if defined(FFX_LPM_CPU_SSE2)
+
+#if defined(FFX_LPM_CPU_AVX2)
+struct LpmCpuLanesAVX2
+{
+    typedef __m256 Type;
+    static const uint32_t Width = 8;
+
+    static Type Splat(float v) { return _mm256_set1_ps(v); }
+    static Type Add(Type a, Type b) { return _mm256_add_ps(a, b); }
+    static Type Sub(Type a, Type b) { return _mm256_sub_ps(a, b); }
+    static Type Mul(Type a, Type b) { return _mm256_mul_ps(a, b); }
+    static Type Div(Type a, Type b) { return _mm256_div_ps(a, b); }
+    static Type Min(Type a, Type b) { return _mm256_min_ps(a, b); }
+    static Type Max(Type a, Type b) { return _mm256_max_ps(a, b); }
+    static Type Abs(Type a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+
+    static Type Log2(Type a)
+    {
+        const __m256i bits     = _mm256_castps_si256(a);
+        __m256        exponent = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(127)));
+        __m256        mantissa = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x007fffff)), _mm256_set1_epi32(0x3f800000)));
+
+        const __m256 large = _mm256_cmp_ps(mantissa, _mm256_set1_ps(1.41421356f), _CMP_GT_OQ);
+        mantissa           = _mm256_blendv_ps(mantissa, _mm256_mul_ps(mantissa, _mm256_set1_ps(0.5f)), large);
+        exponent           = _mm256_add_ps(exponent, _mm256_and_ps(large, _mm256_set1_ps(1.0f)));
+
+        const __m256 t      = _mm256_div_ps(_mm256_sub_ps(mantissa, _mm256_set1_ps(1.0f)), _mm256_add_ps(mantissa, _mm256_set1_ps(1.0f)));
+        const __m256 result = _mm256_add_ps(exponent, LPM_CPU_LOG2_SERIES(LpmCpuLanesAVX2, t));
+
+        return _mm256_blendv_ps(_mm256_set1_ps(-INFINITY), result, _mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_GT_OQ));
+    }
+
+    static Type Exp2(Type a)
+    {
+        const __m256  clamped  = _mm256_min_ps(_mm256_max_ps(a, _mm256_set1_ps(-126.0f)), _mm256_set1_ps(127.0f));
+        const __m256i exponent = _mm256_cvtps_epi32(clamped);
+        const __m256  f        = _mm256_sub_ps(clamped, _mm256_cvtepi32_ps(exponent));
+        const __m256  scale    = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(exponent, _mm256_set1_epi32(127)), 23));
+        const __m256  result   = _mm256_mul_ps(LPM_CPU_EXP2_SERIES(LpmCpuLanesAVX2, f), scale);
+        return _mm256_and_ps(_mm256_cmp_ps(a, _mm256_set1_ps(-126.0f), _CMP_GE_OQ), result);
+    }
+
+    static Type Pow(Type a, float b) { return Exp2(Mul(Log2(a), Splat(b))); }
+
+    // Two groups of four pixels, each transposed like the SSE lanes do
+    static void Load(const float* pixels, Type& r, Type& g, Type& b, Type& a)
+    {
+        __m128 r0 = _mm_loadu_ps(pixels + 0), g0 = _mm_loadu_ps(pixels + 4), b0 = _mm_loadu_ps(pixels + 8), a0 = _mm_loadu_ps(pixels + 12);
+        __m128 r1 = _mm_loadu_ps(pixels + 16), g1 = _mm_loadu_ps(pixels + 20), b1 = _mm_loadu_ps(pixels + 24), a1 = _mm_loadu_ps(pixels + 28);
+        _MM_TRANSPOSE4_PS(r0, g0, b0, a0);
+        _MM_TRANSPOSE4_PS(r1, g1, b1, a1);
+        r = _mm256_insertf128_ps(_mm256_castps128_ps256(r0), r1, 1);
+        g = _mm256_insertf128_ps(_mm256_castps128_ps256(g0), g1, 1);
+        b = _mm256_insertf128_ps(_mm256_castps128_ps256(b0), b1, 1);
+        a = _mm256_insertf128_ps(_mm256_castps128_ps256(a0), a1, 1);
+    }
+
+    static void Store(float* pixels, Type r, Type g, Type b, Type a)
+    {
+        __m128 r0 = _mm256_castps256_ps128(r), g0 = _mm256_castps256_ps128(g), b0 = _mm256_castps256_ps128(b), a0 = _mm256_castps256_ps128(a);
+        __m128 r1 = _mm256_extractf128_ps(r, 1), g1 = _mm256_extractf128_ps(g, 1), b1 = _mm256_extractf128_ps(b, 1), a1 = _mm256_extractf128_ps(a, 1);
+        _MM_TRANSPOSE4_PS(r0, g0, b0, a0);
+        _MM_TRANSPOSE4_PS(r1, g1, b1, a1);
+        _mm_storeu_ps(pixels + 0, r0);
+        _mm_storeu_ps(pixels + 4, g0);
+        _mm_storeu_ps(pixels + 8, b0);
+        _mm_storeu_ps(pixels + 12, a0);
+        _mm_storeu_ps(pixels + 16, r1);
+        _mm_storeu_ps(pixels + 20, g1);
+        _mm_storeu_ps(pixels + 24, b1);
+        _mm_storeu_ps(pixels + 28, a1);
+    }
+};
+typedef LpmCpuLanesAVX2 LpmCpuLanes;
+#endif  // #if defined(FFX_LPM_CPU_AVX2)
+
+#if defined(FFX_LPM_CPU_NEON)
+struct LpmCpuLanesNEON
+{
+    typedef float32x4_t Type;
+    static const uint32_t Width = 4;
+
+    static Type Splat(float v) { return vdupq_n_f32(v); }
+    static Type Add(Type a, Type b) { return vaddq_f32(a, b); }
+    static Type Sub(Type a, Type b) { return vsubq_f32(a, b); }
+    static Type Mul(Type a, Type b) { return vmulq_f32(a, b); }
+    static Type Div(Type a, Type b) { return vdivq_f32(a, b); }
+    static Type Min(Type a, Type b) { return vminq_f32(a, b); }
+    static Type Max(Type a, Type b) { return vmaxq_f32(a, b); }
+    static Type Abs(Type a) { return vabsq_f32(a); }
+
+    static Type Log2(Type a)
+    {
+        const uint32x4_t bits     = vreinterpretq_u32_f32(a);
+        float32x4_t      exponent = vcvtq_f32_s32(vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(bits, 23)), vdupq_n_s32(127)));
+        float32x4_t      mantissa = vreinterpretq_f32_u32(vorrq_u32(vandq_u32(bits, vdupq_n_u32(0x007fffff)), vdupq_n_u32(0x3f800000)));
+
+        const uint32x4_t large = vcgtq_f32(mantissa, vdupq_n_f32(1.41421356f));
+        mantissa               = vbslq_f32(large, vmulq_f32(mantissa, vdupq_n_f32(0.5f)), mantissa);
+        exponent               = vaddq_f32(exponent, vreinterpretq_f32_u32(vandq_u32(large, vreinterpretq_u32_f32(vdupq_n_f32(1.0f)))));
+
+        const float32x4_t t      = vdivq_f32(vsubq_f32(mantissa, vdupq_n_f32(1.0f)), vaddq_f32(mantissa, vdupq_n_f32(1.0f)));
+        const float32x4_t result = vaddq_f32(exponent, LPM_CPU_LOG2_SERIES(LpmCpuLanesNEON, t));
+
+        return vbslq_f32(vcgtq_f32(a, vdupq_n_f32(0.0f)), result, vdupq_n_f32(-INFINITY));
+    }
+
+    static Type Exp2(Type a)
+    {
+        const float32x4_t clamped  = vminq_f32(vmaxq_f32(a, vdupq_n_f32(-126.0f)), vdupq_n_f32(127.0f));
+        const int32x4_t   exponent = vcvtnq_s32_f32(clamped);
+        const float32x4_t f        = vsubq_f32(clamped, vcvtq_f32_s32(exponent));
+        const float32x4_t scale    = vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(exponent, vdupq_n_s32(127)), 23));
+        const float32x4_t result   = vmulq_f32(LPM_CPU_EXP2_SERIES(LpmCpuLanesNEON, f), scale);
+        return vreinterpretq_f32_u32(vandq_u32(vcgeq_f32(a, vdupq_n_f32(-126.0f)), vreinterpretq_u32_f32(result)));
+    }
+
+    static Type Pow(Type a, float b) { return Exp2(Mul(Log2(a), Splat(b))); }
+
+    static void Load(const float* pixels, Type& r, Type& g, Type& b, Type& a)
+    {
+        const float32x4x4_t channels = vld4q_f32(pixels);
+        r = channels.val[0];
+        g = channels.val[1];
+        b = channels.val[2];
+        a = channels.val[3];
+    }
+
+    static void Store(float* pixels, Type r, Type g, Type b, Type a)
+    {
+        float32x4x4_t channels;
+        channels.val[0] = r;
+        channels.val[1] = g;
+        channels.val[2] = b;
+        channels.val[3] = a;
+        vst4q_f32(pixels, channels);
+    }
+};
+typedef LpmCpuLanesNEON LpmCpuLanes;
+#endif  // #if defined(FFX_LPM_CPU_NEON)
+
+#if !defined(FFX_LPM_CPU_SSE2) && !defined(FFX_LPM_CPU_AVX2) && !defined(FFX_LPM_CPU_NEON)
+typedef LpmCpuLanesScalar LpmCpuLanes;
+#endif
+
+//==============================================================================================================================
+//                                                           MAPPER
+//------------------------------------------------------------------------------------------------------------------------------
+// LpmMap() from ffx_lpm.h, with the same order of operations. See there for comments.
+//==============================================================================================================================
+template<typename L>
+static typename L::Type lpmCpuSaturate(typename L::Type a)
+{
+    return L::Min(L::Max(a, L::Splat(0.0f)), L::Splat(1.0f));
+}
+
+// a * x.r + b * x.g + c * x.b, evaluated as a * x[ia] + (b * x[ib] + (c * x[ic])) like the GPU code
+template<typename L>
+static typename L::Type lpmCpuDot(typename L::Type a, float wa, typename L::Type b, float wb, typename L::Type c, float wc)
+{
+    return L::Add(L::Mul(a, L::Splat(wa)), L::Add(L::Mul(b, L::Splat(wb)), L::Mul(c, L::Splat(wc))));
+}
+
+template<typename L>
+static void lpmCpuMap(const LpmCpuMapper& m, typename L::Type& colorR, typename L::Type& colorG, typename L::Type& colorB)
+{
+    typedef typename L::Type V;
+
+    V rcpMax = L::Div(L::Splat(1.0f), L::Max(L::Max(colorR, colorG), colorB));
+    V ratioR = L::Mul(colorR, rcpMax);
+    V ratioG = L::Mul(colorG, rcpMax);
+    V ratioB = L::Mul(colorB, rcpMax);
+
+    ratioR = L::Pow(ratioR, m.saturation[0]);
+    ratioG = L::Pow(ratioG, m.saturation[1]);
+    ratioB = L::Pow(ratioB, m.saturation[2]);
+
+    V luma;
+    if (m.soft)
+        luma = lpmCpuDot<L>(colorG, m.lumaW[1], colorR, m.lumaW[0], colorB, m.lumaW[2]);
+    else
+        luma = lpmCpuDot<L>(colorG, m.lumaT[1], colorR, m.lumaT[0], colorB, m.lumaT[2]);
+    luma = L::Pow(luma, m.contrast);
+    V lumaShoulder = m.shoulder ? L::Pow(luma, m.shoulderContrast) : luma;
+    luma = L::Mul(luma, L::Div(L::Splat(1.0f), L::Add(L::Mul(lumaShoulder, L::Splat(m.toneScaleBias[0])), L::Splat(m.toneScaleBias[1]))));
+
+    if (m.soft)
+    {
+        if (m.con)
+        {
+            colorR = ratioR;
+            colorG = ratioG;
+            colorB = ratioB;
+            ratioR = lpmCpuDot<L>(colorR, m.conR[0], colorG, m.conR[1], colorB, m.conR[2]);
+            ratioG = lpmCpuDot<L>(colorG, m.conG[1], colorR, m.conG[0], colorB, m.conG[2]);
+            ratioB = lpmCpuDot<L>(colorB, m.conB[2], colorG, m.conB[1], colorR, m.conB[0]);
+
+            rcpMax = L::Div(L::Splat(1.0f), L::Max(L::Max(ratioR, ratioG), ratioB));
+            ratioR = L::Mul(ratioR, rcpMax);
+            ratioG = L::Mul(ratioG, rcpMax);
+            ratioB = L::Mul(ratioB, rcpMax);
+        }
+
+        const V gap    = L::Splat(m.softGap[0]);
+        const V negGap = L::Splat(-m.softGap[0]);
+        const V gapExp = L::Splat(m.softGap[1]);
+        ratioR = L::Min(L::Max(gap, lpmCpuSaturate<L>(L::Add(L::Mul(ratioR, negGap), ratioR))), lpmCpuSaturate<L>(L::Mul(gap, L::Exp2(L::Mul(ratioR, gapExp)))));
+        ratioG = L::Min(L::Max(gap, lpmCpuSaturate<L>(L::Add(L::Mul(ratioG, negGap), ratioG))), lpmCpuSaturate<L>(L::Mul(gap, L::Exp2(L::Mul(ratioG, gapExp)))));
+        ratioB = L::Min(L::Max(gap, lpmCpuSaturate<L>(L::Add(L::Mul(ratioB, negGap), ratioB))), lpmCpuSaturate<L>(L::Mul(gap, L::Exp2(L::Mul(ratioB, gapExp)))));
+    }
+
+    const V lumaRatio = L::Add(L::Add(L::Mul(ratioR, L::Splat(m.lumaT[0])), L::Mul(ratioG, L::Splat(m.lumaT[1]))), L::Mul(ratioB, L::Splat(m.lumaT[2])));
+
+    const V ratioScale = lpmCpuSaturate<L>(L::Mul(luma, L::Div(L::Splat(1.0f), lumaRatio)));
+
+    colorR = lpmCpuSaturate<L>(L::Mul(ratioR, ratioScale));
+    colorG = lpmCpuSaturate<L>(L::Mul(ratioG, ratioScale));
+    colorB = lpmCpuSaturate<L>(L::Mul(ratioB, ratioScale));
+
+    const V capR = L::Add(L::Mul(L::Splat(-m.crosstalk[0]), colorR), L::Splat(m.crosstalk[0]));
+    const V capG = L::Add(L::Mul(L::Splat(-m.crosstalk[1]), colorG), L::Splat(m.crosstalk[1]));
+    const V capB = L::Add(L::Mul(L::Splat(-m.crosstalk[2]), colorB), L::Splat(m.crosstalk[2]));
+
+    // (-colorB) * lumaT.b + ((-colorR) * lumaT.r + ((-colorG) * lumaT.g + luma))
+    V lumaAdd = lpmCpuSaturate<L>(L::Sub(L::Sub(L::Sub(luma, L::Mul(colorG, L::Splat(m.lumaT[1]))), L::Mul(colorR, L::Splat(m.lumaT[0]))),
+                                         L::Mul(colorB, L::Splat(m.lumaT[2]))));
+
+    const V t = L::Mul(lumaAdd, L::Div(L::Splat(1.0f), lpmCpuDot<L>(capG, m.lumaT[1], capR, m.lumaT[0], capB, m.lumaT[2])));
+
+    colorR = lpmCpuSaturate<L>(L::Add(L::Mul(t, capR), colorR));
+    colorG = lpmCpuSaturate<L>(L::Add(L::Mul(t, capG), colorG));
+    colorB = lpmCpuSaturate<L>(L::Add(L::Mul(t, capB), colorB));
+
+    lumaAdd = lpmCpuSaturate<L>(L::Sub(L::Sub(L::Sub(luma, L::Mul(colorG, L::Splat(m.lumaT[1]))), L::Mul(colorR, L::Splat(m.lumaT[0]))),
+                                       L::Mul(colorB, L::Splat(m.lumaT[2]))));
+
+    colorR = lpmCpuSaturate<L>(L::Add(L::Mul(lumaAdd, L::Splat(m.rcpLumaT[0])), colorR));
+    colorG = lpmCpuSaturate<L>(L::Add(L::Mul(lumaAdd, L::Splat(m.rcpLumaT[1])), colorG));
+    colorB = lpmCpuSaturate<L>(L::Add(L::Mul(lumaAdd, L::Splat(m.rcpLumaT[2])), colorB));
+
+    if (m.con2)
+    {
+        ratioR = colorR;
+        ratioG = colorG;
+        ratioB = colorB;
+
+        colorR = lpmCpuDot<L>(ratioR, m.con2R[0], ratioG, m.con2R[1], ratioB, m.con2R[2]);
+        colorG = lpmCpuDot<L>(ratioG, m.con2G[1], ratioR, m.con2G[0], ratioB, m.con2G[2]);
+        colorB = lpmCpuDot<L>(ratioB, m.con2B[2], ratioG, m.con2B[1], ratioR, m.con2B[0]);
+
+        if (m.clip)
+        {
+            colorR = lpmCpuSaturate<L>(colorR);
+            colorG = lpmCpuSaturate<L>(colorG);
+            colorB = lpmCpuSaturate<L>(colorB);
+        }
+    }
+
+    if (m.scaleOnly)
+    {
+        const V scale = L::Splat(m.con2R[0]);
+        colorR = L::Mul(colorR, scale);
+        colorG = L::Mul(colorG, scale);
+        colorB = L::Mul(colorB, scale);
+    }
+}
+
+// The output encoding the filter shader applies after LpmFilter(), see ApplyGamma() and ApplyPQ().
+template<typename L>
+static typename L::Type lpmCpuEncode(const LpmCpuMapper& m, typename L::Type color)
+{
+    switch (FfxLpmDisplayMode(m.displayMode))
+    {
+    case FfxLpmDisplayMode::FFX_LPM_DISPLAYMODE_LDR:
+        return L::Pow(color, 1.0f / 2.2f);
+
+    case FfxLpmDisplayMode::FFX_LPM_DISPLAYMODE_HDR10_2084:
+    case FfxLpmDisplayMode::FFX_LPM_DISPLAYMODE_FSHDR_2084:
+    {
+        const float m1 = 2610.0f / 4096.0f / 4;
+        const float m2 = 2523.0f / 4096.0f * 128;
+        const float c1 = 3424.0f / 4096.0f;
+        const float c2 = 2413.0f / 4096.0f * 32;
+        const float c3 = 2392.0f / 4096.0f * 32;
+
+        const typename L::Type cp = L::Pow(L::Abs(color), m1);
+        return L::Pow(L::Div(L::Add(L::Splat(c1), L::Mul(L::Splat(c2), cp)), L::Add(L::Splat(1.0f), L::Mul(L::Splat(c3), cp))), m2);
+    }
+
+    default:
+        return color;
+    }
+}
+
+template<typename L>
+static void lpmCpuFilterPixels(const LpmCpuMapper& m, const float* input, float* output)
+{
+    typename L::Type r, g, b, a;
+    L::Load(input, r, g, b, a);
+    lpmCpuMap<L>(m, r, g, b);
+    L::Store(output, lpmCpuEncode<L>(m, r), lpmCpuEncode<L>(m, g), lpmCpuEncode<L>(m, b), a);
+}
+
+static void lpmCpuFilterRow(const LpmCpuMapper& mapper, const float* input, float* output, uint32_t width)
+{
+    uint32_t x = 0;
+    for (; x + LpmCpuLanes::Width <= width; x += LpmCpuLanes::Width)
+        lpmCpuFilterPixels<LpmCpuLanes>(mapper, input + x * 4, output + x * 4);
+
+    // The remainder of the row is filtered one pixel at a time
+    for (; x < width; ++x)
+        lpmCpuFilterPixels<LpmCpuLanesScalar>(mapper, input + x * 4, output + x * 4);
+}
+
+FfxErrorCode ffxLpmFilterCpu(const FfxLpmCpuFilterDescription* filterDescription)
+{
+    FFX_RETURN_ON_ERROR(filterDescription, FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(filterDescription->constants, FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(filterDescription->input, FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(filterDescription->output, FFX_ERROR_INVALID_POINTER);
+
+    const size_t rowSize        = size_t(filterDescription->width) * 4 * sizeof(float);
+    const size_t inputRowPitch  = filterDescription->inputRowPitch ? filterDescription->inputRowPitch : rowSize;
+    const size_t outputRowPitch = filterDescription->outputRowPitch ? filterDescription->outputRowPitch : rowSize;
+    FFX_RETURN_ON_ERROR(inputRowPitch >= rowSize && outputRowPitch >= rowSize, FFX_ERROR_INVALID_ARGUMENT);
+
+    LpmCpuMapper mapper;
+    lpmCpuSetupMapper(&mapper, filterDescription->constants);
+
+    const uint32_t        bandCount = (filterDescription->height + LPM_CPU_ROWS_PER_BAND - 1) / LPM_CPU_ROWS_PER_BAND;
+    std::atomic<uint32_t> nextBand{0};
+
+    const auto filterWorker = [&]() {
+        for (uint32_t band = nextBand++; band < bandCount; band = nextBand++)
+        {
+            const uint32_t firstRow = band * LPM_CPU_ROWS_PER_BAND;
+            const uint32_t lastRow  = FFX_MINIMUM(firstRow + LPM_CPU_ROWS_PER_BAND, filterDescription->height);
+            for (uint32_t row = firstRow; row < lastRow; ++row)
+            {
+                const float* input  = reinterpret_cast<const float*>(reinterpret_cast<const uint8_t*>(filterDescription->input) + row * inputRowPitch);
+                float*       output = reinterpret_cast<float*>(reinterpret_cast<uint8_t*>(filterDescription->output) + row * outputRowPitch);
+                lpmCpuFilterRow(mapper, input, output, filterDescription->width);
+            }
+        }
+    };
+
+    const uint32_t threadCount = filterDescription->threadCount ? filterDescription->threadCount : FFX_MAXIMUM(std::thread::hardware_concurrency(), 1u);
+    const uint32_t workerCount = FFX_MINIMUM(threadCount, bandCount);
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount > 0 ? workerCount - 1 : 0);
+    try
+    {
+        for (uint32_t i = 1; i < workerCount; ++i)
+            workers.emplace_back(filterWorker);
+    }
+    catch (const std::system_error&)
+    {
+        // fewer workers than requested is fine, the remaining ones drain the queue
+    }
+
+    // the calling thread takes part too
+    filterWorker();
+
+    for (std::thread& worker : workers)
+        worker.join();
+
+    return FFX_OK;
+}
@@ -51,6 +51,28 @@ typedef struct LpmConstants
     FfxUInt32 pad;          // Struct padding
 } LpmConstants;
 
+// Inputs of FfxLpmDispatchDescription the LPM constants are computed from. Compared bytewise to decide if the cached
+// constants can be reused, so it is cleared before being filled in.
+typedef struct LpmConstantsKey
+{
+    bool              shoulder;
+    float             softGap;
+    float             hdrMax;
+    float             lpmExposure;
+    float             contrast;
+    float             shoulderContrast;
+    float             saturation[3];
+    float             crosstalk[3];
+    FfxLpmColorSpace  colorSpace;
+    FfxLpmDisplayMode displayMode;
+    float             displayRedPrimary[2];
+    float             displayGreenPrimary[2];
+    float             displayBluePrimary[2];
+    float             displayWhitePoint[2];
+    float             displayMinLuminance;
+    float             displayMaxLuminance;
+} LpmConstantsKey;
+
 struct FfxLpmContextDescription;
 struct FfxDeviceCapabilities;
 struct FfxPipelineState;
@@ -63,6 +85,8 @@ typedef struct FfxLpmContext_Private
     FfxLpmContextDescription    contextDescription;
     FfxUInt32                   effectContextId;
     LpmConstants                constants;
+    LpmConstantsKey             constantsKey;
+    bool                        constantsValid;
     FfxDevice                   device;
     FfxDeviceCapabilities       deviceCapabilities;
     FfxConstantBuffer           constantBuffer;
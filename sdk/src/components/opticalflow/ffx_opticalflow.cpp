@@ -36,18 +36,13 @@
 #include <FidelityFX/gpu/spd/ffx_spd.h>
 #include <FidelityFX/gpu/opticalflow/ffx_opticalflow_callbacks_hlsl.h>
 #include <ffx_object_management.h>
+#include <ffx_resource_binding_map.h>
 
 #define FFX_OPTICALFLOW_MAX_QUEUED_FRAMES 16
 
 #include "ffx_opticalflow_private.h"
 
-typedef struct Binding
-{
-    uint32_t    index;
-    wchar_t     name[64];
-}Binding;
-
-static const Binding srvBindingNames[] =
+static const FfxResourceBindingMapEntry srvBindingNames[] =
 {
     {FFX_OF_BINDING_IDENTIFIER_INPUT_COLOR,                           L"r_input_color"},
     {FFX_OF_BINDING_IDENTIFIER_OPTICAL_FLOW_INPUT,                    L"r_optical_flow_input"},
@@ -56,7 +51,7 @@ static const Binding srvBindingNames[] =
     {FFX_OF_BINDING_IDENTIFIER_OPTICAL_FLOW_PREVIOUS,                 L"r_optical_flow_previous"},
 };
 
-static const Binding uavBindingNames[] =
+static const FfxResourceBindingMapEntry uavBindingNames[] =
 {
     {FFX_OF_BINDING_IDENTIFIER_OPTICAL_FLOW_INPUT,                      L"rw_optical_flow_input"},
     {FFX_OF_BINDING_IDENTIFIER_OPTICAL_FLOW_INPUT_LEVEL_1,              L"rw_optical_flow_input_level_1"},
@@ -73,7 +68,7 @@ static const Binding uavBindingNames[] =
     {FFX_OF_BINDING_IDENTIFIER_OPTICAL_FLOW_SCD_OUTPUT,                 L"rw_optical_flow_scd_output"},
 };
 
-static const Binding cbBindingNames[] =
+static const FfxResourceBindingMapEntry cbBindingNames[] =
 {
     {FFX_OPTICALFLOW_CONSTANTBUFFER_IDENTIFIER,       L"cbOF"},
     {FFX_OPTICALFLOW_CONSTANTBUFFER_IDENTIFIER_SPD,   L"cbOF_SPD"}
@@ -104,50 +99,17 @@ typedef struct OpticalFlowSpdConstants
 
 static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
 {
-    for (uint32_t srvIndex = 0; srvIndex < inoutPipeline->srvTextureCount; ++srvIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(srvBindingNames); ++mapIndex)
-        {
-            if (0 == wcscmp(srvBindingNames[mapIndex].name, inoutPipeline->srvTextureBindings[srvIndex].name))
-                break;
-        }
-        FFX_ASSERT(mapIndex < _countof(srvBindingNames));
-        if (mapIndex == _countof(srvBindingNames))
-            return FFX_ERROR_INVALID_ARGUMENT;
+    FfxErrorCode errorCode = ffxResolveResourceBindings(inoutPipeline->srvTextureBindings, inoutPipeline->srvTextureCount, srvBindingNames);
+    FFX_ASSERT(errorCode == FFX_OK);
+    FFX_VALIDATE(errorCode);
 
-        inoutPipeline->srvTextureBindings[srvIndex].resourceIdentifier = srvBindingNames[mapIndex].index;
-    }
+    errorCode = ffxResolveResourceBindings(inoutPipeline->uavTextureBindings, inoutPipeline->uavTextureCount, uavBindingNames);
+    FFX_ASSERT(errorCode == FFX_OK);
+    FFX_VALIDATE(errorCode);
 
-    for (uint32_t uavIndex = 0; uavIndex < inoutPipeline->uavTextureCount; ++uavIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(uavBindingNames); ++mapIndex)
-        {
-            if (0 == wcscmp(uavBindingNames[mapIndex].name, inoutPipeline->uavTextureBindings[uavIndex].name))
-                break;
-        }
-        FFX_ASSERT(mapIndex < _countof(uavBindingNames));
-        if (mapIndex == _countof(uavBindingNames))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->uavTextureBindings[uavIndex].resourceIdentifier = uavBindingNames[mapIndex].index;
-    }
-
-    for (uint32_t cbIndex = 0; cbIndex < inoutPipeline->constCount; ++cbIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(cbBindingNames); ++mapIndex)
-        {
-            if (0 == wcscmp(cbBindingNames[mapIndex].name, inoutPipeline->constantBufferBindings[cbIndex].name))
-                break;
-        }
-        FFX_ASSERT(mapIndex < _countof(cbBindingNames));
-        if (mapIndex == _countof(cbBindingNames))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->constantBufferBindings[cbIndex].resourceIdentifier = cbBindingNames[mapIndex].index;
-    }
+    errorCode = ffxResolveResourceBindings(inoutPipeline->constantBufferBindings, inoutPipeline->constCount, cbBindingNames);
+    FFX_ASSERT(errorCode == FFX_OK);
+    FFX_VALIDATE(errorCode);
 
     return FFX_OK;
 }
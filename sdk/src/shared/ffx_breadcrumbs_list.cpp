@@ -22,28 +22,49 @@
 
 #include "ffx_breadcrumbs_list.h"
 
+// Allocated size of the list is derived only from its element count, so lists grow
+// geometrically without storing their capacity. Appending is then amortized O(1),
+// which keeps building long status strings linear in their size.
+static size_t breadcrumbsListCapacity(size_t count)
+{
+    if (count <= FFX_BREADCRUMBS_LIST_MIN_CAPACITY)
+        return FFX_BREADCRUMBS_LIST_MIN_CAPACITY;
+
+    // Round up to next power of 2.
+    --count;
+    count |= count >> 1;
+    count |= count >> 2;
+    count |= count >> 4;
+    count |= count >> 8;
+    count |= count >> 16;
+#if SIZE_MAX > UINT32_MAX
+    count |= count >> 32;
+#endif
+    return count + 1;
+}
+
 void* ffxBreadcrumbsAppendList(void* src, size_t currentCount, size_t elementSize, size_t appendCount, FfxAllocationCallbacks* callbacks)
 {
     FFX_ASSERT(src ? currentCount > 0 : currentCount == 0);
 
-    void* dst = callbacks->fpRealloc(src, elementSize * (currentCount + appendCount));
+    const size_t capacity = breadcrumbsListCapacity(currentCount + appendCount);
+    if (src && capacity == breadcrumbsListCapacity(currentCount))
+        return src;
+
+    void* dst = callbacks->fpRealloc(src, elementSize * capacity);
     FFX_ASSERT(dst);
 
     return dst;
 }
 
-void* ffxBreadcrumbsPopList(void* src, size_t newCount, size_t elementSize, FfxAllocationCallbacks* callbacks)
+void* ffxBreadcrumbsPopList(void* src, size_t newCount, FfxAllocationCallbacks* callbacks)
 {
     FFX_ASSERT(src);
 
-    void* dst = nullptr;
+    // Memory is kept for the elements that could be appended again and released only when list becomes empty.
     if (newCount > 0)
-    {
-        dst = callbacks->fpRealloc(src, elementSize * newCount);
-        FFX_ASSERT(dst);
-    }
-    else
-        callbacks->fpFree(src);
+        return src;
 
-    return dst;
+    callbacks->fpFree(src);
+    return nullptr;
 }
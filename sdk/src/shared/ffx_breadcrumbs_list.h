@@ -23,9 +23,12 @@
 #pragma once
 
 #include <cstdint>
-#include <cstdio>      // sprintf_s
+#include <cstdio>      // snprintf
 #include <FidelityFX/host/ffx_assert.h>
 
+// Minimal number of elements allocated for every list.
+#define FFX_BREADCRUMBS_LIST_MIN_CAPACITY 16
+
 #define FFX_BREADCRUMBS_APPEND_STRING(buff, count, str)                                  \
     do                                                                                   \
     {                                                                                    \
@@ -48,7 +51,7 @@
     do                                                                           \
     {                                                                            \
         char _numberStr[maxLength];                                              \
-        const size_t _length = sprintf_s(_numberStr, maxLength, format, number); \
+        const size_t _length = snprintf(_numberStr, maxLength, format, number);  \
         buff = (char*)ffxBreadcrumbsAppendList(buff, count, 1, _length, allocs); \
         memcpy(buff + count, _numberStr, _length);                               \
         count += _length;                                                        \
@@ -116,7 +119,7 @@
     {                                                                                               \
         FFX_BREADCRUMBS_APPEND_STRING(buff, count, FFX_BREADCRUMBS_PRINTING_INDENT #member ": 0x"); \
         char _hexStr[maxLength];                                                                    \
-        const size_t _length = sprintf_s(_hexStr, maxLength, format, baseStruct.member);            \
+        const size_t _length = snprintf(_hexStr, maxLength, format, baseStruct.member);             \
         buff = (char*)ffxBreadcrumbsAppendList(buff, count, 1, _length + 1, allocs);                \
         memcpy(buff + count, _hexStr, _length);                                                     \
         count += _length;                                                                           \
@@ -141,9 +144,12 @@
 extern "C" {
 #endif // #if defined(__cplusplus)
 
+    // Grows list to hold appendCount more elements. List memory has to come only from these functions,
+    // as it can be larger than currentCount elements and is reallocated only when its capacity is exceeded.
     FFX_API void* ffxBreadcrumbsAppendList(void* src, size_t currentCount, size_t elementSize, size_t appendCount, FfxAllocationCallbacks* callbacks);
 
-    FFX_API void* ffxBreadcrumbsPopList(void* src, size_t newCount, size_t elementSize, FfxAllocationCallbacks* callbacks);
+    // Shrinks list to newCount elements, releasing its memory and returning nullptr when it becomes empty.
+    FFX_API void* ffxBreadcrumbsPopList(void* src, size_t newCount, FfxAllocationCallbacks* callbacks);
 
 #if defined(__cplusplus)
 }
@@ -0,0 +1,92 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <FidelityFX/host/ffx_types.h>
+#include <FidelityFX/host/ffx_error.h>
+#include <FidelityFX/host/ffx_util.h>
+#include <stddef.h>
+#include <wchar.h>
+
+// Maps a shader resource binding name to an effect's resource identifier. The name hash is computed when the
+// (constant) binding tables are compiled, so resolving a binding hashes its name once and then compares integers.
+//
+// Bindings are still resolved by name on every context creation, with a scan of the map. ffx_sc does not emit
+// per pipeline slot tables: the identifiers are the effects' own enums, which the shaders don't know about, and a
+// slot table per permutation would have to be selected at runtime just like the reflection data it replaces. Maps
+// hold a few dozen entries, so the scan costs tens of nanoseconds per binding (see
+// tests/shared/ffx_resource_binding_map_benchmark.cpp, and tests/null_backend/ffx_context_creation_benchmark.cpp for
+// whole context creations).
+struct FfxResourceBindingMapEntry
+{
+    uint32_t       index;       // The effect's resource identifier
+    const wchar_t* name;        // The shader resource binding name
+    uint32_t       nameHash;    // ffxHashResourceBindingName(name)
+
+    constexpr FfxResourceBindingMapEntry(uint32_t bindingIndex, const wchar_t* bindingName)
+        : index(bindingIndex), name(bindingName), nameHash(ffxHashResourceBindingName(bindingName))
+    {
+    }
+};
+
+// Resolve the resource identifiers of the bindings of a pipeline from a binding map. The hash of each binding
+// name is computed here rather than stored in FfxResourceBinding, which would grow every pipeline (and with it
+// every fixed size effect context). When addArrayIndex is set, the array index of each binding is added to the
+// identifier, for effects that bind arrays of resources.
+//
+// Returns FFX_ERROR_INVALID_ARGUMENT if a binding is not in the map.
+inline FfxErrorCode ffxResolveResourceBindings(FfxResourceBinding*               bindings,
+                                               uint32_t                          bindingCount,
+                                               const FfxResourceBindingMapEntry* map,
+                                               size_t                            mapSize,
+                                               bool                              addArrayIndex = false)
+{
+    for (uint32_t bindingIndex = 0; bindingIndex < bindingCount; ++bindingIndex)
+    {
+        FfxResourceBinding& binding  = bindings[bindingIndex];
+        const uint32_t      nameHash = ffxHashResourceBindingName(binding.name);
+
+        size_t mapIndex = 0;
+        for (; mapIndex < mapSize; ++mapIndex)
+        {
+            // Hash collisions are not expected, but confirm the match so one could never bind the wrong resource
+            if (map[mapIndex].nameHash == nameHash && 0 == wcscmp(map[mapIndex].name, binding.name))
+                break;
+        }
+        if (mapIndex == mapSize)
+            return FFX_ERROR_INVALID_ARGUMENT;
+
+        binding.resourceIdentifier = map[mapIndex].index + (addArrayIndex ? binding.arrayIndex : 0);
+    }
+
+    return FFX_OK;
+}
+
+template<size_t MapSize>
+inline FfxErrorCode ffxResolveResourceBindings(FfxResourceBinding*                     bindings,
+                                               uint32_t                                bindingCount,
+                                               const FfxResourceBindingMapEntry (&map)[MapSize],
+                                               bool                                    addArrayIndex = false)
+{
+    return ffxResolveResourceBindings(bindings, bindingCount, map, MapSize, addArrayIndex);
+}
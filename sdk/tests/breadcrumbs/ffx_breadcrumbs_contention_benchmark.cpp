@@ -0,0 +1,175 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// Measures breadcrumbs markers recorded from 1 to 32 threads at once, each on command lists of its own, with
+// FFX_BREADCRUMBS_ENABLE_THREAD_SYNCHRONIZATION. With FFX_BREADCRUMBS_RESERVE_MARKERS_PER_LIST a marker takes no lock
+// unless its list has used up the slots it reserved, without it every marker locks the memory blocks of its queue.
+//
+// Prints the wall time per marker over all threads. Reserving markers must not be slower than locking for each one.
+
+#include <FidelityFX/host/ffx_breadcrumbs.h>
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "ffx_test.h"
+
+static const uint32_t s_listsPerThread   = 4;
+static const uint32_t s_markersPerThread = 1 << 14;
+static const uint32_t s_roundCount       = 5;
+
+static FfxVersionNumber getSDKVersion(FfxInterface*)
+{
+    return FFX_SDK_MAKE_VERSION(1, 1, 2);
+}
+
+static FfxErrorCode createBackendContext(FfxInterface*, FfxEffect, FfxEffectBindlessConfig*, FfxUInt32* effectContextId)
+{
+    *effectContextId = 0;
+    return FFX_OK;
+}
+
+static FfxErrorCode destroyBackendContext(FfxInterface*, FfxUInt32)
+{
+    return FFX_OK;
+}
+
+static FfxErrorCode allocBlock(FfxInterface*, uint64_t blockBytes, FfxBreadcrumbsBlockData* blockData)
+{
+    *blockData             = {};
+    blockData->memory      = calloc(1, size_t(blockBytes));
+    blockData->buffer      = blockData->memory;
+    blockData->heap        = blockData->memory;
+    blockData->baseAddress = uint64_t(uintptr_t(blockData->memory));
+    return blockData->memory ? FFX_OK : FFX_ERROR_OUT_OF_MEMORY;
+}
+
+static void freeBlock(FfxInterface*, FfxBreadcrumbsBlockData* blockData)
+{
+    free(blockData->memory);
+    blockData->memory = blockData->buffer = blockData->heap = nullptr;
+}
+
+static void writeMarker(FfxInterface*, FfxCommandList, uint32_t value, uint64_t gpuLocation, void*, bool)
+{
+    *(uint32_t*)uintptr_t(gpuLocation) = value;
+}
+
+static FfxCommandList getListHandle(uint32_t thread, uint32_t list)
+{
+    return (FfxCommandList)uintptr_t(0x10000000 + 0x240 * uint64_t(thread * s_listsPerThread + list));
+}
+
+static void recordThread(FfxBreadcrumbsContext* context, uint32_t thread, FfxErrorCode* errorCode)
+{
+    const FfxBreadcrumbsNameTag markerName = { "Dispatch", true };
+    for (uint32_t marker = 0; marker < s_markersPerThread; ++marker)
+    {
+        const FfxCommandList commandList = getListHandle(thread, marker % s_listsPerThread);
+        *errorCode |= ffxBreadcrumbsBeginMarker(context, commandList, FFX_BREADCRUMBS_MARKER_DISPATCH, &markerName);
+        *errorCode |= ffxBreadcrumbsEndMarker(context, commandList);
+    }
+}
+
+// Fastest of a few rounds, in ns of wall time per marker
+static double measureThreads(uint32_t threadCount, uint32_t flags)
+{
+    uint32_t queues[] = { 0 };
+
+    FfxBreadcrumbsContextDescription contextDescription = {};
+    contextDescription.flags                                     = flags | FFX_BREADCRUMBS_ENABLE_THREAD_SYNCHRONIZATION | FFX_BREADCRUMBS_PRINT_SKIP_DEVICE_INFO;
+    contextDescription.frameHistoryLength                        = 2;
+    contextDescription.maxMarkersPerMemoryBlock                  = 4096;
+    contextDescription.usedGpuQueuesCount                        = FFX_ARRAY_ELEMENTS(queues);
+    contextDescription.pUsedGpuQueues                            = queues;
+    contextDescription.allocCallbacks.fpAlloc                    = malloc;
+    contextDescription.allocCallbacks.fpRealloc                  = realloc;
+    contextDescription.allocCallbacks.fpFree                     = free;
+    contextDescription.backendInterface.fpGetSDKVersion          = getSDKVersion;
+    contextDescription.backendInterface.fpCreateBackendContext   = createBackendContext;
+    contextDescription.backendInterface.fpDestroyBackendContext  = destroyBackendContext;
+    contextDescription.backendInterface.fpBreadcrumbsAllocBlock  = allocBlock;
+    contextDescription.backendInterface.fpBreadcrumbsFreeBlock   = freeBlock;
+    contextDescription.backendInterface.fpBreadcrumbsWrite       = writeMarker;
+
+    FfxBreadcrumbsContext context;
+    FFX_TEST_CHECK(ffxBreadcrumbsContextCreate(&context, &contextDescription) == FFX_OK);
+
+    std::vector<FfxErrorCode> errorCodes(threadCount, FFX_OK);
+    double                    fastest = 0.0;
+    for (uint32_t round = 0; round < s_roundCount; ++round)
+    {
+        FFX_TEST_CHECK(ffxBreadcrumbsStartFrame(&context) == FFX_OK);
+        for (uint32_t thread = 0; thread < threadCount; ++thread)
+        {
+            for (uint32_t list = 0; list < s_listsPerThread; ++list)
+            {
+                FfxBreadcrumbsCommandListDescription listDescription = {};
+                listDescription.commandList                          = getListHandle(thread, list);
+                listDescription.name                                 = { "List", true };
+                FFX_TEST_CHECK(ffxBreadcrumbsRegisterCommandList(&context, &listDescription) == FFX_OK);
+            }
+        }
+
+        std::vector<std::thread> threads;
+        const auto               start = std::chrono::high_resolution_clock::now();
+        for (uint32_t thread = 0; thread < threadCount; ++thread)
+            threads.emplace_back(recordThread, &context, thread, &errorCodes[thread]);
+        for (std::thread& thread : threads)
+            thread.join();
+        const auto   end         = std::chrono::high_resolution_clock::now();
+        const double nanoseconds = std::chrono::duration<double, std::nano>(end - start).count() / (threadCount * s_markersPerThread);
+        fastest                  = round == 0 || nanoseconds < fastest ? nanoseconds : fastest;
+    }
+    for (FfxErrorCode errorCode : errorCodes)
+        FFX_TEST_CHECK(errorCode == FFX_OK);
+
+    FFX_TEST_CHECK(ffxBreadcrumbsContextDestroy(&context) == FFX_OK);
+    return fastest;
+}
+
+int main()
+{
+    const uint32_t threadCounts[] = { 1, 2, 4, 8, 16, 32 };
+
+    printf("fastest of %u rounds of %u markers per thread, %u hardware threads, ns of wall time per marker\n",
+           s_roundCount,
+           s_markersPerThread,
+           std::thread::hardware_concurrency());
+    printf("%8s %18s %18s\n", "threads", "lock per marker", "reserved markers");
+
+    double lockedTotal   = 0.0;
+    double reservedTotal = 0.0;
+    for (uint32_t threadCount : threadCounts)
+    {
+        const double locked   = measureThreads(threadCount, 0);
+        const double reserved = measureThreads(threadCount, FFX_BREADCRUMBS_RESERVE_MARKERS_PER_LIST);
+        printf("%8u %18.1f %18.1f\n", threadCount, locked, reserved);
+
+        lockedTotal += locked;
+        reservedTotal += reserved;
+    }
+
+    FFX_TEST_CHECK(reservedTotal < lockedTotal);
+
+    return FFX_TEST_RESULT();
+}
@@ -0,0 +1,197 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// Measures the CPU cost of a marker (begin, set pipeline, end) as the number of command lists registered in the frame
+// and of pipelines registered in the context grows. Lists and pipelines are looked up by handle on every marker, so
+// the cost has to stay flat instead of growing with the counts.
+//
+// Markers are written to host memory by a stand-in backend, and recorded round robin over the lists in a shuffled
+// order, with a random registered pipeline set for each.
+
+#include <FidelityFX/host/ffx_breadcrumbs.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "ffx_test.h"
+
+static const uint32_t s_markerCount = 1 << 16;
+static const uint32_t s_roundCount  = 5;
+
+static FfxVersionNumber getSDKVersion(FfxInterface*)
+{
+    return FFX_SDK_MAKE_VERSION(1, 1, 2);
+}
+
+static FfxErrorCode createBackendContext(FfxInterface*, FfxEffect, FfxEffectBindlessConfig*, FfxUInt32* effectContextId)
+{
+    *effectContextId = 0;
+    return FFX_OK;
+}
+
+static FfxErrorCode destroyBackendContext(FfxInterface*, FfxUInt32)
+{
+    return FFX_OK;
+}
+
+static FfxErrorCode allocBlock(FfxInterface*, uint64_t blockBytes, FfxBreadcrumbsBlockData* blockData)
+{
+    *blockData             = {};
+    blockData->memory      = calloc(1, size_t(blockBytes));
+    blockData->buffer      = blockData->memory;
+    blockData->heap        = blockData->memory;
+    blockData->baseAddress = uint64_t(uintptr_t(blockData->memory));
+    return blockData->memory ? FFX_OK : FFX_ERROR_OUT_OF_MEMORY;
+}
+
+static void freeBlock(FfxInterface*, FfxBreadcrumbsBlockData* blockData)
+{
+    free(blockData->memory);
+    blockData->memory = blockData->buffer = blockData->heap = nullptr;
+}
+
+static void writeMarker(FfxInterface*, FfxCommandList, uint32_t value, uint64_t gpuLocation, void*, bool)
+{
+    *(uint32_t*)uintptr_t(gpuLocation) = value;
+}
+
+// Handles are spaced like the addresses of API objects
+static FfxCommandList getListHandle(uint32_t list)
+{
+    return (FfxCommandList)uintptr_t(0x10000000 + 0x240 * uint64_t(list));
+}
+
+static FfxPipeline getPipelineHandle(uint32_t pipeline)
+{
+    return (FfxPipeline)uintptr_t(0x20000000 + 0x180 * uint64_t(pipeline));
+}
+
+// Fastest of a few rounds, in ns per marker
+static double measureMarkers(uint32_t listCount, uint32_t pipelineCount)
+{
+    uint32_t queues[] = { 0 };
+
+    FfxBreadcrumbsContextDescription contextDescription = {};
+    contextDescription.flags                                     = FFX_BREADCRUMBS_PRINT_SKIP_DEVICE_INFO;
+    contextDescription.frameHistoryLength                        = 2;
+    contextDescription.maxMarkersPerMemoryBlock                  = s_markerCount;
+    contextDescription.usedGpuQueuesCount                        = FFX_ARRAY_ELEMENTS(queues);
+    contextDescription.pUsedGpuQueues                            = queues;
+    contextDescription.allocCallbacks.fpAlloc                    = malloc;
+    contextDescription.allocCallbacks.fpRealloc                  = realloc;
+    contextDescription.allocCallbacks.fpFree                     = free;
+    contextDescription.backendInterface.fpGetSDKVersion          = getSDKVersion;
+    contextDescription.backendInterface.fpCreateBackendContext   = createBackendContext;
+    contextDescription.backendInterface.fpDestroyBackendContext  = destroyBackendContext;
+    contextDescription.backendInterface.fpBreadcrumbsAllocBlock  = allocBlock;
+    contextDescription.backendInterface.fpBreadcrumbsFreeBlock   = freeBlock;
+    contextDescription.backendInterface.fpBreadcrumbsWrite       = writeMarker;
+
+    FfxBreadcrumbsContext context;
+    FFX_TEST_CHECK(ffxBreadcrumbsContextCreate(&context, &contextDescription) == FFX_OK);
+
+    for (uint32_t pipeline = 0; pipeline < pipelineCount; ++pipeline)
+    {
+        FfxBreadcrumbsPipelineStateDescription pipelineDescription = {};
+        pipelineDescription.pipeline      = getPipelineHandle(pipeline);
+        pipelineDescription.name          = { "Pipeline", true };
+        pipelineDescription.computeShader = { "MainCS", true };
+        FFX_TEST_CHECK(ffxBreadcrumbsRegisterPipeline(&context, &pipelineDescription) == FFX_OK);
+    }
+
+    std::mt19937          random(listCount * 31 + pipelineCount);
+    std::vector<uint32_t> listOrder(listCount);
+    for (uint32_t list = 0; list < listCount; ++list)
+        listOrder[list] = list;
+    std::shuffle(listOrder.begin(), listOrder.end(), random);
+
+    std::vector<FfxPipeline> pipelines(s_markerCount);
+    for (FfxPipeline& pipeline : pipelines)
+        pipeline = getPipelineHandle(random() % pipelineCount);
+
+    const FfxBreadcrumbsNameTag markerName = { "Dispatch", true };
+    FfxErrorCode                errorCode  = FFX_OK;
+    double                      fastest    = 0.0;
+    for (uint32_t round = 0; round < s_roundCount; ++round)
+    {
+        FFX_TEST_CHECK(ffxBreadcrumbsStartFrame(&context) == FFX_OK);
+        for (uint32_t list = 0; list < listCount; ++list)
+        {
+            FfxBreadcrumbsCommandListDescription listDescription = {};
+            listDescription.commandList                          = getListHandle(list);
+            listDescription.name                                 = { "List", true };
+            listDescription.submissionIndex                      = uint16_t(list);
+            errorCode |= ffxBreadcrumbsRegisterCommandList(&context, &listDescription);
+        }
+
+        const auto start = std::chrono::high_resolution_clock::now();
+        for (uint32_t marker = 0; marker < s_markerCount; ++marker)
+        {
+            const FfxCommandList commandList = getListHandle(listOrder[marker % listCount]);
+            errorCode |= ffxBreadcrumbsBeginMarker(&context, commandList, FFX_BREADCRUMBS_MARKER_DISPATCH, &markerName);
+            errorCode |= ffxBreadcrumbsSetPipeline(&context, commandList, pipelines[marker]);
+            errorCode |= ffxBreadcrumbsEndMarker(&context, commandList);
+        }
+        const auto   end         = std::chrono::high_resolution_clock::now();
+        const double nanoseconds = std::chrono::duration<double, std::nano>(end - start).count() / s_markerCount;
+        fastest                  = round == 0 || nanoseconds < fastest ? nanoseconds : fastest;
+    }
+    FFX_TEST_CHECK(errorCode == FFX_OK);
+
+    FFX_TEST_CHECK(ffxBreadcrumbsContextDestroy(&context) == FFX_OK);
+    return fastest;
+}
+
+int main()
+{
+    const uint32_t listCounts[]     = { 1, 16, 256, 4096 };
+    const uint32_t pipelineCounts[] = { 1, 64, 4096 };
+
+    printf("fastest of %u rounds of %u markers, ns per marker\n", s_roundCount, s_markerCount);
+    printf("%10s", "lists");
+    for (uint32_t pipelineCount : pipelineCounts)
+        printf(" %8u pipelines", pipelineCount);
+    printf("\n");
+
+    double fewest = 0.0;
+    double most   = 0.0;
+    for (uint32_t listCount : listCounts)
+    {
+        printf("%10u", listCount);
+        for (uint32_t pipelineCount : pipelineCounts)
+        {
+            const double nanoseconds = measureMarkers(listCount, pipelineCount);
+            printf(" %18.1f", nanoseconds);
+
+            fewest = listCount == listCounts[0] && pipelineCount == pipelineCounts[0] ? nanoseconds : fewest;
+            most   = nanoseconds;
+        }
+        printf("\n");
+    }
+
+    // Scanning 4096 lists and pipelines on every marker would be a hundred times slower. Hashed lookups are constant
+    // time, but the data of thousands of lists falls out of the caches, so allow for a few cache misses per marker.
+    FFX_TEST_CHECK(most < fewest * 8.0);
+
+    return FFX_TEST_RESULT();
+}
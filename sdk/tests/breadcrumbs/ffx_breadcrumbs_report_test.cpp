@@ -0,0 +1,326 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Records a large synthetic frame history of nested markers and prints the breadcrumbs report twice: once with lists
+// reallocated to their exact size on every append, as before they grew geometrically, and once with the geometric
+// growth of ffx_breadcrumbs_list.cpp. The reports have to match byte for byte.
+//
+// ffx_breadcrumbs_list.cpp is included under other names, and the list functions the library calls forward either to
+// it or to the exact size reference. Every reallocation moves the list and poisons its old memory, so anything still
+// pointing into a list after it grew shows up in the report.
+
+#define ffxBreadcrumbsAppendList ffxBreadcrumbsAppendListGeometric
+#define ffxBreadcrumbsPopList    ffxBreadcrumbsPopListGeometric
+#include <ffx_breadcrumbs_list.cpp>
+#undef ffxBreadcrumbsAppendList
+#undef ffxBreadcrumbsPopList
+
+#include <FidelityFX/host/ffx_breadcrumbs.h>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+
+#include "ffx_test.h"
+
+static bool   s_geometricGrowth = false;
+static size_t s_reallocations   = 0;
+
+// Allocations remember their size in front of the memory handed out
+static const size_t s_allocationHeaderSize = 16;
+
+static void* testAlloc(size_t size)
+{
+    uint8_t* memory = (uint8_t*)malloc(s_allocationHeaderSize + size);
+    memcpy(memory, &size, sizeof(size));
+    return memory + s_allocationHeaderSize;
+}
+
+static void testFree(void* ptr)
+{
+    uint8_t* memory = (uint8_t*)ptr - s_allocationHeaderSize;
+    size_t   size;
+    memcpy(&size, memory, sizeof(size));
+    memset(ptr, 0xCD, size);
+    free(memory);
+}
+
+static void* testRealloc(void* ptr, size_t size)
+{
+    ++s_reallocations;
+    void* newPtr = testAlloc(size);
+    if (ptr)
+    {
+        size_t oldSize;
+        memcpy(&oldSize, (uint8_t*)ptr - s_allocationHeaderSize, sizeof(oldSize));
+        memcpy(newPtr, ptr, oldSize < size ? oldSize : size);
+        testFree(ptr);
+    }
+    return newPtr;
+}
+
+extern "C" FFX_API void* ffxBreadcrumbsAppendList(void* src, size_t currentCount, size_t elementSize, size_t appendCount, FfxAllocationCallbacks* callbacks)
+{
+    if (s_geometricGrowth)
+        return ffxBreadcrumbsAppendListGeometric(src, currentCount, elementSize, appendCount, callbacks);
+
+    return callbacks->fpRealloc(src, elementSize * (currentCount + appendCount));
+}
+
+extern "C" FFX_API void* ffxBreadcrumbsPopList(void* src, size_t newCount, FfxAllocationCallbacks* callbacks)
+{
+    if (s_geometricGrowth)
+        return ffxBreadcrumbsPopListGeometric(src, newCount, callbacks);
+
+    if (newCount == 0)
+    {
+        callbacks->fpFree(src);
+        return nullptr;
+    }
+
+    // The exact size list was reallocated on every pop as well, which moves it with the test allocator
+    size_t size;
+    memcpy(&size, (uint8_t*)src - s_allocationHeaderSize, sizeof(size));
+    return callbacks->fpRealloc(src, size);
+}
+
+// A GPU which executes every marker write of the frames before the last, and hangs after a number of writes to each
+// queue in the last one
+struct SimulatedGpu
+{
+    bool     hang;
+    uint32_t writesBeforeHang[2];
+};
+
+static SimulatedGpu s_gpu;
+
+static FfxVersionNumber getSDKVersion(FfxInterface*)
+{
+    return FFX_SDK_MAKE_VERSION(1, 1, 2);
+}
+
+static FfxErrorCode createBackendContext(FfxInterface*, FfxEffect, FfxEffectBindlessConfig*, FfxUInt32* effectContextId)
+{
+    *effectContextId = 0;
+    return FFX_OK;
+}
+
+static FfxErrorCode destroyBackendContext(FfxInterface*, FfxUInt32)
+{
+    return FFX_OK;
+}
+
+static FfxErrorCode allocBlock(FfxInterface*, uint64_t blockBytes, FfxBreadcrumbsBlockData* blockData)
+{
+    *blockData             = {};
+    blockData->memory      = calloc(1, size_t(blockBytes));
+    blockData->buffer      = blockData->memory;
+    blockData->heap        = blockData->memory;
+    blockData->baseAddress = uint64_t(uintptr_t(blockData->memory));
+    return FFX_OK;
+}
+
+static void freeBlock(FfxInterface*, FfxBreadcrumbsBlockData* blockData)
+{
+    free(blockData->memory);
+    blockData->memory = blockData->buffer = blockData->heap = nullptr;
+}
+
+// Command lists encode their queue in the lowest bit of the handle
+static void writeMarker(FfxInterface*, FfxCommandList commandList, uint32_t value, uint64_t gpuLocation, void*, bool)
+{
+    if (s_gpu.hang)
+    {
+        uint32_t& writes = s_gpu.writesBeforeHang[uintptr_t(commandList) & 1];
+        if (writes == 0)
+            return;
+        --writes;
+    }
+    *(uint32_t*)uintptr_t(gpuLocation) = value;
+}
+
+// Device info printed with the same macros as the backends
+static void printDeviceInfo(FfxInterface*, FfxAllocationCallbacks* allocs, bool extendedInfo, char** printBuffer, size_t* printSize)
+{
+    struct
+    {
+        const char* description;
+        uint32_t    vendorId;
+        uint64_t    memory;
+        float       clock;
+        bool        integrated;
+    } device = { "Simulated GPU", 0x1002, 16ull << 30, 2.5f, false };
+
+    char*  buff     = *printBuffer;
+    size_t buffSize = *printSize;
+
+    FFX_BREADCRUMBS_APPEND_STRING(buff, buffSize, "[DEVICE]\n");
+    FFX_BREADCRUMBS_PRINT_STRING(buff, buffSize, device, description);
+    FFX_BREADCRUMBS_PRINT_HEX32(buff, buffSize, device, vendorId);
+    if (extendedInfo)
+    {
+        FFX_BREADCRUMBS_PRINT_UINT64(buff, buffSize, device, memory);
+        FFX_BREADCRUMBS_PRINT_HEX64(buff, buffSize, device, memory);
+        FFX_BREADCRUMBS_PRINT_FLOAT(buff, buffSize, device, clock);
+        FFX_BREADCRUMBS_PRINT_BOOL(buff, buffSize, device, integrated);
+    }
+
+    *printBuffer = buff;
+    *printSize   = buffSize;
+}
+
+static const char* s_passNames[] = { "GBuffer", "Shadows", "Lighting", "Post processing", "UI" };
+
+// Records markers nested up to maxDepth deep, with names either owned by the caller or copied by the library
+static void recordMarkers(FfxBreadcrumbsContext* context, FfxCommandList commandList, std::mt19937& random, uint32_t depth, uint32_t maxDepth, uint32_t& markerBudget)
+{
+    while (markerBudget)
+    {
+        --markerBudget;
+
+        FfxBreadcrumbsMarkerType type = FfxBreadcrumbsMarkerType(random() % (FFX_BREADCRUMBS_MARKER_WRITE_TIMESTAMP + 1));
+        std::string              name = std::string(s_passNames[random() % FFX_ARRAY_ELEMENTS(s_passNames)]) + " " + std::to_string(random() % 1000);
+        FfxBreadcrumbsNameTag    nameTag = { name.c_str(), false };
+        if (type != FFX_BREADCRUMBS_MARKER_PASS && random() % 2)
+            nameTag = { nullptr, true };
+        else if (random() % 2)
+            nameTag = { s_passNames[random() % FFX_ARRAY_ELEMENTS(s_passNames)], true };
+        FFX_TEST_CHECK(ffxBreadcrumbsBeginMarker(context, commandList, type, &nameTag) == FFX_OK);
+
+        if (random() % 8 == 0)
+            FFX_TEST_CHECK(ffxBreadcrumbsSetPipeline(context, commandList, (FfxPipeline)uintptr_t(0x100 * (1 + random() % 3))) == FFX_OK);
+        if (depth < maxDepth && random() % 3 == 0)
+            recordMarkers(context, commandList, random, depth + 1, maxDepth, markerBudget);
+
+        FFX_TEST_CHECK(ffxBreadcrumbsEndMarker(context, commandList) == FFX_OK);
+        if (depth > 0 && random() % 4 == 0)
+            return;
+    }
+}
+
+static std::string printReport(uint32_t flags, uint32_t markersPerList, bool geometricGrowth)
+{
+    s_geometricGrowth = geometricGrowth;
+    s_reallocations   = 0;
+    s_gpu             = {};
+    std::mt19937 random(markersPerList);
+
+    uint32_t queues[] = { 0, 1 };
+
+    FfxBreadcrumbsContextDescription contextDescription = {};
+    contextDescription.flags                                = flags;
+    contextDescription.frameHistoryLength                   = 3;
+    contextDescription.maxMarkersPerMemoryBlock             = 150;
+    contextDescription.usedGpuQueuesCount                   = FFX_ARRAY_ELEMENTS(queues);
+    contextDescription.pUsedGpuQueues                       = queues;
+    contextDescription.allocCallbacks.fpAlloc               = testAlloc;
+    contextDescription.allocCallbacks.fpRealloc             = testRealloc;
+    contextDescription.allocCallbacks.fpFree                = testFree;
+    contextDescription.backendInterface.fpGetSDKVersion     = getSDKVersion;
+    contextDescription.backendInterface.fpCreateBackendContext  = createBackendContext;
+    contextDescription.backendInterface.fpDestroyBackendContext = destroyBackendContext;
+    contextDescription.backendInterface.fpBreadcrumbsAllocBlock      = allocBlock;
+    contextDescription.backendInterface.fpBreadcrumbsFreeBlock       = freeBlock;
+    contextDescription.backendInterface.fpBreadcrumbsWrite           = writeMarker;
+    contextDescription.backendInterface.fpBreadcrumbsPrintDeviceInfo = printDeviceInfo;
+
+    FfxBreadcrumbsContext context;
+    FFX_TEST_CHECK(ffxBreadcrumbsContextCreate(&context, &contextDescription) == FFX_OK);
+
+    const char* shaderNames[] = { "FullscreenVS", "LightingPS", "TileCS" };
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        FfxBreadcrumbsPipelineStateDescription pipelineDescription = {};
+        pipelineDescription.pipeline = (FfxPipeline)uintptr_t(0x100 * (1 + i));
+        pipelineDescription.name     = { s_passNames[i], i != 0 };
+        if (i < 2)
+        {
+            pipelineDescription.vertexShader = { shaderNames[0], true };
+            pipelineDescription.pixelShader  = { shaderNames[1], false };
+        }
+        else
+            pipelineDescription.computeShader = { shaderNames[2], true };
+        FFX_TEST_CHECK(ffxBreadcrumbsRegisterPipeline(&context, &pipelineDescription) == FFX_OK);
+    }
+
+    const uint32_t frameCount = 5;
+    const uint32_t listCount  = 4;
+    for (uint32_t frame = 0; frame < frameCount; ++frame)
+    {
+        FFX_TEST_CHECK(ffxBreadcrumbsStartFrame(&context) == FFX_OK);
+        if (frame == frameCount - 1)
+        {
+            s_gpu.hang                = true;
+            s_gpu.writesBeforeHang[0] = markersPerList * 3;
+            s_gpu.writesBeforeHang[1] = markersPerList / 2;
+        }
+
+        for (uint32_t list = 0; list < listCount; ++list)
+        {
+            std::string listName = "Frame " + std::to_string(frame) + " list " + std::to_string(list);
+
+            FfxBreadcrumbsCommandListDescription listDescription = {};
+            listDescription.commandList     = (FfxCommandList)uintptr_t(0x1000 * (list + 1) + (list & 1));
+            listDescription.queueType       = list & 1;
+            listDescription.name            = { listName.c_str(), false };
+            listDescription.pipeline        = list % 3 ? (FfxPipeline)uintptr_t(0x100 * (list % 3)) : nullptr;
+            listDescription.submissionIndex = uint16_t(frame * listCount + list);
+            FFX_TEST_CHECK(ffxBreadcrumbsRegisterCommandList(&context, &listDescription) == FFX_OK);
+
+            uint32_t markerBudget = markersPerList;
+            recordMarkers(&context, listDescription.commandList, random, 0, 5, markerBudget);
+        }
+    }
+
+    FfxBreadcrumbsMarkersStatus status = {};
+    FFX_TEST_CHECK(ffxBreadcrumbsPrintStatus(&context, &status) == FFX_OK);
+    std::string report(status.pBuffer, status.bufferSize);
+    testFree(status.pBuffer);
+
+    FFX_TEST_CHECK(ffxBreadcrumbsContextDestroy(&context) == FFX_OK);
+    return report;
+}
+
+static void testReport(uint32_t flags, uint32_t markersPerList)
+{
+    const std::string reference = printReport(flags, markersPerList, false);
+    const size_t      referenceReallocations = s_reallocations;
+    const std::string report = printReport(flags, markersPerList, true);
+
+    FFX_TEST_CHECK(report == reference);
+    FFX_TEST_CHECK(report.find("[BREADCRUMBS]") != std::string::npos);
+
+    // most appends no longer reallocate
+    FFX_TEST_CHECK(s_reallocations * 10 < referenceReallocations);
+}
+
+int main()
+{
+    const uint32_t expandAll = FFX_BREADCRUMBS_PRINT_FINISHED_LISTS | FFX_BREADCRUMBS_PRINT_NOT_STARTED_LISTS |
+                               FFX_BREADCRUMBS_PRINT_FINISHED_NODES | FFX_BREADCRUMBS_PRINT_NOT_STARTED_NODES;
+
+    testReport(expandAll | FFX_BREADCRUMBS_PRINT_EXTENDED_DEVICE_INFO, 200);
+    testReport(FFX_BREADCRUMBS_RESERVE_MARKERS_PER_LIST, 200);
+    testReport(expandAll | FFX_BREADCRUMBS_PRINT_SKIP_DEVICE_INFO | FFX_BREADCRUMBS_PRINT_SKIP_PIPELINE_INFO | FFX_BREADCRUMBS_RESERVE_MARKERS_PER_LIST, 20);
+
+    return FFX_TEST_RESULT();
+}
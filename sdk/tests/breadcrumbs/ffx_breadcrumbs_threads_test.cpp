@@ -0,0 +1,251 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// Records breadcrumbs from many threads at once, with FFX_BREADCRUMBS_ENABLE_THREAD_SYNCHRONIZATION and with and
+// without FFX_BREADCRUMBS_RESERVE_MARKERS_PER_LIST. Each thread registers its command lists while the others are
+// recording, so the list table grows under concurrent lookups, and memory blocks are small so queues keep allocating
+// new ones.
+//
+// Every begin marker has to land in a slot of its own, its end marker has to be written to the same slot, and after
+// the frame every slot has to hold the end value of that frame.
+
+#include <FidelityFX/host/ffx_breadcrumbs.h>
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "ffx_test.h"
+
+static const uint32_t s_threadCount     = 8;
+static const uint32_t s_listsPerThread  = 32;
+static const uint32_t s_markersPerList  = 150;
+static const uint32_t s_frameCount      = 4;
+static const uint32_t s_markersPerBlock = 100;
+
+static FfxVersionNumber getSDKVersion(FfxInterface*)
+{
+    return FFX_SDK_MAKE_VERSION(1, 1, 2);
+}
+
+static FfxErrorCode createBackendContext(FfxInterface*, FfxEffect, FfxEffectBindlessConfig*, FfxUInt32* effectContextId)
+{
+    *effectContextId = 0;
+    return FFX_OK;
+}
+
+static FfxErrorCode destroyBackendContext(FfxInterface*, FfxUInt32)
+{
+    return FFX_OK;
+}
+
+static FfxErrorCode allocBlock(FfxInterface*, uint64_t blockBytes, FfxBreadcrumbsBlockData* blockData)
+{
+    *blockData             = {};
+    blockData->memory      = calloc(1, size_t(blockBytes));
+    blockData->buffer      = blockData->memory;
+    blockData->heap        = blockData->memory;
+    blockData->baseAddress = uint64_t(uintptr_t(blockData->memory));
+    return blockData->memory ? FFX_OK : FFX_ERROR_OUT_OF_MEMORY;
+}
+
+static void freeBlock(FfxInterface*, FfxBreadcrumbsBlockData* blockData)
+{
+    free(blockData->memory);
+    blockData->memory = blockData->buffer = blockData->heap = nullptr;
+}
+
+// Writes happen on the recording thread, which keeps track of its open markers
+struct MarkerWrite
+{
+    FfxCommandList commandList;
+    uint32_t*      location;
+    uint32_t       value;
+};
+
+static thread_local std::vector<MarkerWrite> s_writes;
+
+static void writeMarker(FfxInterface*, FfxCommandList commandList, uint32_t value, uint64_t gpuLocation, void*, bool)
+{
+    uint32_t* location = (uint32_t*)uintptr_t(gpuLocation);
+    *location          = value;
+    s_writes.push_back({ commandList, location, value });
+}
+
+struct ThreadResult
+{
+    uint32_t failedCalls   = 0;
+    uint32_t misplacedEnds = 0;
+    uint32_t markers       = 0;
+    // Begin marker slots, with the value their end marker wrote
+    std::vector<MarkerWrite> slots;
+};
+
+static FfxCommandList getListHandle(uint32_t thread, uint32_t list)
+{
+    return (FfxCommandList)uintptr_t(0x10000000 + 0x240 * uint64_t(thread * s_listsPerThread + list));
+}
+
+// Registers the lists of a thread one by one, recording nested markers on every list registered so far
+static void recordThread(FfxBreadcrumbsContext* context, uint32_t thread, uint32_t frame, ThreadResult& result)
+{
+    std::mt19937                 random(thread * 131 + frame);
+    const FfxBreadcrumbsNameTag  markerName = { "Draw", true };
+    std::vector<uint32_t>        markersLeft(s_listsPerThread, s_markersPerList);
+    std::vector<uint32_t>        depth(s_listsPerThread, 0);
+    std::vector<std::vector<MarkerWrite>> openMarkers(s_listsPerThread);
+
+    uint32_t registered = 0;
+    for (;;)
+    {
+        if (registered < s_listsPerThread && (registered == 0 || random() % 8 == 0))
+        {
+            FfxBreadcrumbsCommandListDescription listDescription = {};
+            listDescription.commandList                          = getListHandle(thread, registered);
+            listDescription.queueType                            = registered & 1;
+            listDescription.name                                 = { "List", true };
+            result.failedCalls += ffxBreadcrumbsRegisterCommandList(context, &listDescription) != FFX_OK;
+            ++registered;
+        }
+
+        // Pick a list which still has markers to record or to close
+        uint32_t list = random() % registered;
+        if (markersLeft[list] == 0 && depth[list] == 0)
+        {
+            list = 0;
+            while (list < registered && markersLeft[list] == 0 && depth[list] == 0)
+                ++list;
+            if (list == registered)
+            {
+                if (registered == s_listsPerThread)
+                    break;
+                continue;
+            }
+        }
+
+        const FfxCommandList commandList = getListHandle(thread, list);
+        if (markersLeft[list] && (depth[list] == 0 || random() % 2))
+        {
+            s_writes.clear();
+            result.failedCalls += ffxBreadcrumbsBeginMarker(context, commandList, FFX_BREADCRUMBS_MARKER_DRAW, &markerName) != FFX_OK;
+            if (s_writes.size() == 1 && s_writes[0].commandList == commandList)
+                openMarkers[list].push_back(s_writes[0]);
+            else
+                ++result.failedCalls;
+            --markersLeft[list];
+            ++depth[list];
+            ++result.markers;
+        }
+        else
+        {
+            s_writes.clear();
+            result.failedCalls += ffxBreadcrumbsEndMarker(context, commandList) != FFX_OK;
+            const MarkerWrite begin = openMarkers[list].back();
+            openMarkers[list].pop_back();
+            if (s_writes.size() == 1 && s_writes[0].location == begin.location && s_writes[0].value == begin.value + 1)
+                result.slots.push_back(s_writes[0]);
+            else
+                ++result.misplacedEnds;
+            --depth[list];
+        }
+    }
+}
+
+static void testThreads(uint32_t flags)
+{
+    uint32_t queues[] = { 0, 1 };
+
+    FfxBreadcrumbsContextDescription contextDescription = {};
+    contextDescription.flags                                     = flags | FFX_BREADCRUMBS_ENABLE_THREAD_SYNCHRONIZATION;
+    contextDescription.frameHistoryLength                        = 2;
+    contextDescription.maxMarkersPerMemoryBlock                  = s_markersPerBlock;
+    contextDescription.usedGpuQueuesCount                        = FFX_ARRAY_ELEMENTS(queues);
+    contextDescription.pUsedGpuQueues                            = queues;
+    contextDescription.allocCallbacks.fpAlloc                    = malloc;
+    contextDescription.allocCallbacks.fpRealloc                  = realloc;
+    contextDescription.allocCallbacks.fpFree                     = free;
+    contextDescription.backendInterface.fpGetSDKVersion          = getSDKVersion;
+    contextDescription.backendInterface.fpCreateBackendContext   = createBackendContext;
+    contextDescription.backendInterface.fpDestroyBackendContext  = destroyBackendContext;
+    contextDescription.backendInterface.fpBreadcrumbsAllocBlock  = allocBlock;
+    contextDescription.backendInterface.fpBreadcrumbsFreeBlock   = freeBlock;
+    contextDescription.backendInterface.fpBreadcrumbsWrite       = writeMarker;
+
+    FfxBreadcrumbsContext context;
+    FFX_TEST_CHECK(ffxBreadcrumbsContextCreate(&context, &contextDescription) == FFX_OK);
+
+    for (uint32_t frame = 0; frame < s_frameCount; ++frame)
+    {
+        FFX_TEST_CHECK(ffxBreadcrumbsStartFrame(&context) == FFX_OK);
+
+        std::vector<ThreadResult> results(s_threadCount);
+        std::vector<std::thread>  threads;
+        for (uint32_t thread = 0; thread < s_threadCount; ++thread)
+            threads.emplace_back(recordThread, &context, thread, frame, std::ref(results[thread]));
+        for (std::thread& thread : threads)
+            thread.join();
+
+        std::vector<MarkerWrite> slots;
+        uint32_t                 markers = 0;
+        for (const ThreadResult& result : results)
+        {
+            FFX_TEST_CHECK(result.failedCalls == 0);
+            FFX_TEST_CHECK(result.misplacedEnds == 0);
+            markers += result.markers;
+            slots.insert(slots.end(), result.slots.begin(), result.slots.end());
+        }
+        FFX_TEST_CHECK(markers == s_threadCount * s_listsPerThread * s_markersPerList);
+        FFX_TEST_CHECK(slots.size() == markers);
+
+        // no two markers share a slot, and no later write overwrote an end marker
+        std::sort(slots.begin(), slots.end(), [](const MarkerWrite& a, const MarkerWrite& b) { return a.location < b.location; });
+        uint32_t sharedSlots = 0;
+        uint32_t overwrittenSlots = 0;
+        for (size_t slot = 0; slot < slots.size(); ++slot)
+        {
+            sharedSlots += slot > 0 && slots[slot].location == slots[slot - 1].location;
+            overwrittenSlots += *slots[slot].location != ((frame + 1) << 1) + 1;
+        }
+        FFX_TEST_CHECK(sharedSlots == 0);
+        FFX_TEST_CHECK(overwrittenSlots == 0);
+    }
+
+    FfxBreadcrumbsMarkersStatus status = {};
+    FFX_TEST_CHECK(ffxBreadcrumbsPrintStatus(&context, &status) == FFX_OK);
+    FFX_TEST_CHECK(status.pBuffer && status.bufferSize > 0);
+    free(status.pBuffer);
+
+    FFX_TEST_CHECK(ffxBreadcrumbsContextDestroy(&context) == FFX_OK);
+}
+
+int main()
+{
+    testThreads(FFX_BREADCRUMBS_PRINT_SKIP_DEVICE_INFO);
+    testThreads(FFX_BREADCRUMBS_PRINT_SKIP_DEVICE_INFO | FFX_BREADCRUMBS_RESERVE_MARKERS_PER_LIST);
+
+    printf("%u threads recorded %u markers per frame on %u command lists\n",
+           s_threadCount,
+           s_threadCount * s_listsPerThread * s_markersPerList,
+           s_threadCount * s_listsPerThread);
+
+    return FFX_TEST_RESULT();
+}
@@ -0,0 +1,150 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// Benchmarks culling the static instances of a scrolling cascade, for instance counts from a thousand to a full
+// instance table and camera speeds from standing still to ten voxels a frame. Each frame is culled three ways:
+//
+//   scan:    every instance against the whole cascade, the way static instances were culled before the BVH
+//   full:    a BVH query of the whole cascade
+//   exposed: a BVH query of only the slabs the cascade scrolled into (bvhSubtract and bvhQueryAny), as
+//            ffxBrixelizerBakeUpdate does for static cascades after their first update
+//
+// The exposed query has to find every instance which overlaps the cascade but did not overlap it the frame before.
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include <brixelizer/ffx_brixelizer_bvh.h>
+#include "ffx_test.h"
+
+static const uint32_t s_frameCount   = 256;
+static const float    s_cascadeSize  = float(FFX_BRIXELIZER_CASCADE_RESOLUTION);  // in voxels of size 1
+static const float    s_worldSize    = 2048.0f;
+static const float    s_maxExtent    = 16.0f;
+
+struct CullResult
+{
+    double   microsecondsPerFrame;
+    uint64_t instancesFound;
+};
+
+template <typename Cull>
+static CullResult runCameraPath(float voxelsPerFrame, Cull cull)
+{
+    FfxBrixelizerAABB previous = { { 0.0f, 0.0f, 0.0f }, { s_cascadeSize, s_cascadeSize, s_cascadeSize } };
+    float             position = 0.0f;
+    CullResult        result   = {};
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (uint32_t frame = 0; frame < s_frameCount; ++frame)
+    {
+        // the camera moves diagonally and the cascade follows it in whole voxels
+        position += voxelsPerFrame;
+        float             offset  = float(int32_t(position));
+        FfxBrixelizerAABB current = { { offset, offset * 0.5f, 0.0f }, { offset + s_cascadeSize, offset * 0.5f + s_cascadeSize, s_cascadeSize } };
+        current.min[1] = float(int32_t(current.min[1]));
+        current.max[1] = current.min[1] + s_cascadeSize;
+
+        result.instancesFound += cull(current, previous);
+        previous = current;
+    }
+    result.microsecondsPerFrame = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / s_frameCount;
+    return result;
+}
+
+int main()
+{
+    const uint32_t instanceCounts[] = { 1000, 10000, FFX_BRIXELIZER_MAX_INSTANCES };
+    const float    cameraSpeeds[]   = { 0.0f, 0.1f, 1.0f, 10.0f };
+
+    FfxBrixelizerBVH* bvh = new FfxBrixelizerBVH;
+    std::vector<FfxBrixelizerAABB>       aabbs(FFX_BRIXELIZER_MAX_INSTANCES);
+    std::vector<FfxBrixelizerInstanceID> ids(FFX_BRIXELIZER_MAX_INSTANCES);
+    std::vector<FfxBrixelizerInstanceID> previousIDs(FFX_BRIXELIZER_MAX_INSTANCES);
+
+    printf("%-9s %-7s %12s %12s %12s %10s %10s\n", "instances", "voxels/", "scan", "full", "exposed", "full", "exposed");
+    printf("%-9s %-7s %12s %12s %12s %10s %10s\n", "", "frame", "us/frame", "us/frame", "us/frame", "found", "found");
+
+    for (uint32_t instanceCount : instanceCounts)
+    {
+        // instances are packed more densely around the camera path, like a level around its streaming origin
+        std::mt19937 random(instanceCount);
+        bvhInit(bvh);
+        for (uint32_t id = 0; id < instanceCount; ++id)
+        {
+            float spread = id % 2 ? s_worldSize : s_worldSize * 0.25f;
+            for (uint32_t i = 0; i < 3; ++i)
+            {
+                aabbs[id].min[i] = std::uniform_real_distribution<float>(-spread, spread)(random);
+                aabbs[id].max[i] = aabbs[id].min[i] + std::uniform_real_distribution<float>(0.0f, s_maxExtent)(random);
+            }
+            bvhInsert(bvh, id, aabbs[id]);
+        }
+
+        for (float voxelsPerFrame : cameraSpeeds)
+        {
+            CullResult scan = runCameraPath(voxelsPerFrame, [&](FfxBrixelizerAABB current, FfxBrixelizerAABB) {
+                uint32_t count = 0;
+                for (uint32_t id = 0; id < instanceCount; ++id)
+                {
+                    if (bvhOverlap(aabbs[id], current))
+                        ids[count++] = id;
+                }
+                return count;
+            });
+            CullResult full = runCameraPath(voxelsPerFrame, [&](FfxBrixelizerAABB current, FfxBrixelizerAABB) {
+                return bvhQuery(bvh, current, ids.data(), FFX_BRIXELIZER_MAX_INSTANCES);
+            });
+            CullResult exposed = runCameraPath(voxelsPerFrame, [&](FfxBrixelizerAABB current, FfxBrixelizerAABB previous) {
+                FfxBrixelizerAABB regions[6];
+                uint32_t          numRegions = bvhSubtract(current, previous, regions);
+                return bvhQueryAny(bvh, regions, numRegions, ids.data(), FFX_BRIXELIZER_MAX_INSTANCES);
+            });
+            FFX_TEST_CHECK(scan.instancesFound == full.instancesFound);
+            FFX_TEST_CHECK(exposed.instancesFound <= full.instancesFound);
+
+            printf("%-9u %-7.1f %12.2f %12.2f %12.2f %10.1f %10.1f\n", instanceCount, voxelsPerFrame, scan.microsecondsPerFrame,
+                   full.microsecondsPerFrame, exposed.microsecondsPerFrame, double(full.instancesFound) / s_frameCount,
+                   double(exposed.instancesFound) / s_frameCount);
+        }
+
+        // every instance newly overlapping the cascade is found by the exposed query along the fastest path
+        runCameraPath(cameraSpeeds[3], [&](FfxBrixelizerAABB current, FfxBrixelizerAABB previous) {
+            FfxBrixelizerAABB regions[6];
+            uint32_t          numRegions  = bvhSubtract(current, previous, regions);
+            uint32_t          numExposed  = bvhQueryAny(bvh, regions, numRegions, ids.data(), FFX_BRIXELIZER_MAX_INSTANCES);
+            uint32_t          numPrevious = bvhQuery(bvh, previous, previousIDs.data(), FFX_BRIXELIZER_MAX_INSTANCES);
+            std::sort(ids.begin(), ids.begin() + numExposed);
+            std::sort(previousIDs.begin(), previousIDs.begin() + numPrevious);
+            for (uint32_t id = 0; id < instanceCount; ++id)
+            {
+                if (bvhOverlap(aabbs[id], current) && !std::binary_search(previousIDs.begin(), previousIDs.begin() + numPrevious, id))
+                    FFX_TEST_CHECK(std::binary_search(ids.begin(), ids.begin() + numExposed, id));
+            }
+            return numExposed;
+        });
+    }
+
+    delete bvh;
+    return FFX_TEST_RESULT();
+}
@@ -0,0 +1,377 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Checks the static instance BVH of Brixelizer against a brute-force scan of every instance, the way static
+// instances were culled against cascades before the BVH, over random insertions, removals and overlap queries, and
+// the regions a scrolling cascade is queried with against the boxes they are cut from.
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <brixelizer/ffx_brixelizer_bvh.h>
+#include "ffx_test.h"
+
+static std::mt19937 s_random(12345);
+
+static float randomFloat(float minValue, float maxValue)
+{
+    return std::uniform_real_distribution<float>(minValue, maxValue)(s_random);
+}
+
+static FfxBrixelizerAABB randomAABB(float worldSize, float maxExtent)
+{
+    FfxBrixelizerAABB aabb;
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        aabb.min[i] = randomFloat(-worldSize, worldSize);
+        aabb.max[i] = aabb.min[i] + randomFloat(0.0f, maxExtent);
+    }
+    return aabb;
+}
+
+class BruteForceScan
+{
+public:
+    BruteForceScan()
+        : m_aabbs(FFX_BRIXELIZER_MAX_INSTANCES)
+        , m_present(FFX_BRIXELIZER_MAX_INSTANCES, false)
+    {
+    }
+
+    void insert(FfxBrixelizerInstanceID id, FfxBrixelizerAABB aabb)
+    {
+        m_aabbs[id]   = aabb;
+        m_present[id] = true;
+    }
+
+    void remove(FfxBrixelizerInstanceID id)
+    {
+        m_present[id] = false;
+    }
+
+    std::vector<FfxBrixelizerInstanceID> query(FfxBrixelizerAABB aabb) const
+    {
+        std::vector<FfxBrixelizerInstanceID> ids;
+        for (FfxBrixelizerInstanceID id = 0; id < FFX_BRIXELIZER_MAX_INSTANCES; ++id)
+        {
+            if (m_present[id] && bvhOverlap(m_aabbs[id], aabb))
+                ids.push_back(id);
+        }
+        return ids;
+    }
+
+private:
+    std::vector<FfxBrixelizerAABB> m_aabbs;
+    std::vector<bool>              m_present;
+};
+
+static bool sameAABB(FfxBrixelizerAABB x, FfxBrixelizerAABB y)
+{
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        if (x.min[i] != y.min[i] || x.max[i] != y.max[i])
+            return false;
+    }
+    return true;
+}
+
+// Verifies links and bounds of the subtree at index and returns its leaf count
+static uint32_t checkSubtree(const FfxBrixelizerBVH* bvh, uint32_t index, uint32_t parent)
+{
+    const FfxBrixelizerBVHNode* node = &bvh->nodes[index];
+    FFX_TEST_CHECK(node->parent == parent);
+    FFX_TEST_CHECK(node->height >= 0);
+
+    if (bvhIsLeaf(node))
+    {
+        FFX_TEST_CHECK(node->height == 0);
+        FFX_TEST_CHECK(node->instanceID < FFX_BRIXELIZER_MAX_INSTANCES && bvh->leaves[node->instanceID] == index);
+        return 1;
+    }
+
+    const FfxBrixelizerBVHNode* a = &bvh->nodes[node->children[0]];
+    const FfxBrixelizerBVHNode* b = &bvh->nodes[node->children[1]];
+    FFX_TEST_CHECK(sameAABB(node->aabb, bvhUnion(a->aabb, b->aabb)));
+    FFX_TEST_CHECK(node->height == 1 + std::max(a->height, b->height));
+
+    return checkSubtree(bvh, node->children[0], index) + checkSubtree(bvh, node->children[1], index);
+}
+
+static void checkTree(const FfxBrixelizerBVH* bvh, uint32_t instanceCount)
+{
+    if (bvh->root == FFX_BRIXELIZER_BVH_NULL_NODE)
+    {
+        FFX_TEST_CHECK(instanceCount == 0);
+        return;
+    }
+    FFX_TEST_CHECK(checkSubtree(bvh, bvh->root, FFX_BRIXELIZER_BVH_NULL_NODE) == instanceCount);
+
+    // rotations keep the tree within a small factor of a perfectly balanced one, and queries within their stack
+    int32_t height = bvh->nodes[bvh->root].height;
+    int32_t balancedHeight = 0;
+    while ((1u << balancedHeight) < instanceCount)
+        ++balancedHeight;
+    FFX_TEST_CHECK(height <= 2 * balancedHeight + 1);
+    FFX_TEST_CHECK(height + 1 <= FFX_BRIXELIZER_BVH_STACK_SIZE);
+}
+
+static void checkQuery(const FfxBrixelizerBVH* bvh, const BruteForceScan& scan, FfxBrixelizerAABB aabb)
+{
+    static std::vector<FfxBrixelizerInstanceID> ids(FFX_BRIXELIZER_MAX_INSTANCES);
+    uint32_t count = bvhQuery(bvh, aabb, ids.data(), FFX_BRIXELIZER_MAX_INSTANCES);
+
+    std::vector<FfxBrixelizerInstanceID> found(ids.begin(), ids.begin() + count);
+    std::sort(found.begin(), found.end());
+    FFX_TEST_CHECK(found == scan.query(aabb));
+}
+
+// Random churn of instances, with queries ranging from empty space to the whole world
+static void testRandomScene(uint32_t operationCount, float worldSize, float maxExtent)
+{
+    FfxBrixelizerBVH* bvh = new FfxBrixelizerBVH;
+    bvhInit(bvh);
+    BruteForceScan scan;
+
+    std::vector<FfxBrixelizerInstanceID> live;
+    std::vector<FfxBrixelizerInstanceID> freeIDs;
+    for (FfxBrixelizerInstanceID id = 0; id < FFX_BRIXELIZER_MAX_INSTANCES; ++id)
+        freeIDs.push_back(FFX_BRIXELIZER_MAX_INSTANCES - 1 - id);
+    std::shuffle(freeIDs.begin(), freeIDs.end(), s_random);
+
+    for (uint32_t operation = 0; operation < operationCount; ++operation)
+    {
+        if (!live.empty() && (freeIDs.empty() || s_random() % 10 < 3))
+        {
+            size_t index = s_random() % live.size();
+            FfxBrixelizerInstanceID id = live[index];
+            live[index] = live.back();
+            live.pop_back();
+            freeIDs.push_back(id);
+            bvhRemove(bvh, id);
+            scan.remove(id);
+        }
+        else
+        {
+            FfxBrixelizerInstanceID id = freeIDs.back();
+            freeIDs.pop_back();
+            live.push_back(id);
+            FfxBrixelizerAABB aabb = randomAABB(worldSize, maxExtent);
+            bvhInsert(bvh, id, aabb);
+            scan.insert(id, aabb);
+        }
+
+        if (operation % 512 == 0)
+        {
+            checkTree(bvh, uint32_t(live.size()));
+            checkQuery(bvh, scan, randomAABB(worldSize, 0.0f));
+            checkQuery(bvh, scan, randomAABB(worldSize, worldSize * 0.1f));
+            checkQuery(bvh, scan, randomAABB(worldSize, worldSize));
+            checkQuery(bvh, scan, randomAABB(4.0f * worldSize, 8.0f * worldSize));
+        }
+    }
+
+    checkTree(bvh, uint32_t(live.size()));
+
+    // removing everything leaves an empty tree which still accepts instances
+    for (FfxBrixelizerInstanceID id : live)
+        bvhRemove(bvh, id);
+    checkTree(bvh, 0);
+    FfxBrixelizerAABB everything = { { -FLT_MAX, -FLT_MAX, -FLT_MAX }, { FLT_MAX, FLT_MAX, FLT_MAX } };
+    FFX_TEST_CHECK(bvhQuery(bvh, everything, nullptr, 0) == 0);
+    bvhInsert(bvh, 7, everything);
+    checkTree(bvh, 1);
+
+    delete bvh;
+}
+
+// Identical, flat and touching bounds, and a full instance table
+static void testDegenerateScene()
+{
+    FfxBrixelizerBVH* bvh = new FfxBrixelizerBVH;
+    bvhInit(bvh);
+    BruteForceScan scan;
+
+    for (FfxBrixelizerInstanceID id = 0; id < FFX_BRIXELIZER_MAX_INSTANCES; ++id)
+    {
+        FfxBrixelizerAABB aabb;
+        switch (id % 3)
+        {
+        case 0:
+            aabb = { { 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f } };
+            break;
+        case 1:
+            aabb = { { float(id % 64), 0.0f, 2.0f }, { float(id % 64), 0.0f, 2.0f } };
+            break;
+        default:
+            aabb = { { float(id % 97), 1.0f, 0.0f }, { float(id % 97) + 1.0f, 2.0f, 1.0f } };
+            break;
+        }
+        bvhInsert(bvh, id, aabb);
+        scan.insert(id, aabb);
+    }
+    checkTree(bvh, FFX_BRIXELIZER_MAX_INSTANCES);
+
+    // bounds are closed, so boxes sharing only a face, edge or corner overlap
+    checkQuery(bvh, scan, { { 1.0f, 1.0f, 1.0f }, { 1.0f, 1.0f, 1.0f } });
+    checkQuery(bvh, scan, { { 5.0f, 0.0f, 2.0f }, { 5.0f, 0.0f, 2.0f } });
+    checkQuery(bvh, scan, { { 10.5f, 1.5f, -1.0f }, { 20.0f, 1.5f, 0.0f } });
+    checkQuery(bvh, scan, { { 200.0f, 200.0f, 200.0f }, { 300.0f, 300.0f, 300.0f } });
+
+    for (FfxBrixelizerInstanceID id = 0; id < FFX_BRIXELIZER_MAX_INSTANCES; id += 2)
+    {
+        bvhRemove(bvh, id);
+        scan.remove(id);
+    }
+    checkTree(bvh, FFX_BRIXELIZER_MAX_INSTANCES / 2);
+    checkQuery(bvh, scan, { { 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f } });
+    checkQuery(bvh, scan, { { 30.0f, 0.0f, 0.0f }, { 40.0f, 2.0f, 2.0f } });
+
+    delete bvh;
+}
+
+static bool containsPoint(FfxBrixelizerAABB aabb, const float point[3])
+{
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        if (point[i] < aabb.min[i] || point[i] > aabb.max[i])
+            return false;
+    }
+    return true;
+}
+
+// The regions of bvhSubtract cover all of current outside previous and nothing outside current
+static void checkSubtract(FfxBrixelizerAABB current, FfxBrixelizerAABB previous)
+{
+    FfxBrixelizerAABB regions[6];
+    uint32_t          numRegions = bvhSubtract(current, previous, regions);
+    FFX_TEST_CHECK(numRegions <= 6);
+
+    for (uint32_t sample = 0; sample < 256; ++sample)
+    {
+        float point[3];
+        for (uint32_t i = 0; i < 3; ++i)
+            point[i] = sample % 4 == 0 ? (s_random() % 2 ? current.min[i] : current.max[i]) : randomFloat(current.min[i], current.max[i]);
+
+        bool inRegion = false;
+        for (uint32_t r = 0; r < numRegions; ++r)
+            inRegion = inRegion || containsPoint(regions[r], point);
+        if (!containsPoint(previous, point))
+            FFX_TEST_CHECK(inRegion);
+    }
+    for (uint32_t r = 0; r < numRegions; ++r)
+    {
+        FFX_TEST_CHECK(sameAABB(bvhUnion(regions[r], current), current));
+        for (uint32_t i = 0; i < 3; ++i)
+            FFX_TEST_CHECK(regions[r].min[i] <= regions[r].max[i]);
+    }
+}
+
+// Scrolls a cascade sized box through a random scene, checking that querying the regions it scrolled into finds each
+// instance overlapping them once, including every instance which overlaps the new box but not the old one
+static void testScrollingQueries()
+{
+    FfxBrixelizerBVH* bvh = new FfxBrixelizerBVH;
+    bvhInit(bvh);
+    BruteForceScan scan;
+
+    for (FfxBrixelizerInstanceID id = 0; id < 8192; ++id)
+    {
+        FfxBrixelizerAABB aabb = randomAABB(200.0f, 8.0f);
+        bvhInsert(bvh, id, aabb);
+        scan.insert(id, aabb);
+    }
+
+    std::vector<FfxBrixelizerInstanceID> ids(FFX_BRIXELIZER_MAX_INSTANCES);
+    FfxBrixelizerAABB previous = { { -32.0f, -32.0f, -32.0f }, { 32.0f, 32.0f, 32.0f } };
+    for (uint32_t frame = 0; frame < 512; ++frame)
+    {
+        // steps from a fraction of a voxel to further than the box is wide
+        float step[3];
+        float maxStep = frame % 64 == 0 ? 100.0f : (frame % 8 == 0 ? 8.0f : 1.0f);
+        for (uint32_t i = 0; i < 3; ++i)
+            step[i] = std::round(randomFloat(-maxStep, maxStep));
+
+        FfxBrixelizerAABB current = previous;
+        for (uint32_t i = 0; i < 3; ++i)
+        {
+            current.min[i] += step[i];
+            current.max[i] += step[i];
+        }
+        checkSubtract(current, previous);
+
+        FfxBrixelizerAABB regions[6];
+        uint32_t          numRegions = bvhSubtract(current, previous, regions);
+        uint32_t          count      = bvhQueryAny(bvh, regions, numRegions, ids.data(), FFX_BRIXELIZER_MAX_INSTANCES);
+        std::vector<FfxBrixelizerInstanceID> found(ids.begin(), ids.begin() + count);
+        std::sort(found.begin(), found.end());
+        FFX_TEST_CHECK(std::adjacent_find(found.begin(), found.end()) == found.end());
+
+        std::vector<FfxBrixelizerInstanceID> expected;
+        for (uint32_t r = 0; r < numRegions; ++r)
+        {
+            std::vector<FfxBrixelizerInstanceID> regionIDs = scan.query(regions[r]);
+            expected.insert(expected.end(), regionIDs.begin(), regionIDs.end());
+        }
+        std::sort(expected.begin(), expected.end());
+        expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+        FFX_TEST_CHECK(found == expected);
+
+        std::vector<FfxBrixelizerInstanceID> inPrevious = scan.query(previous);
+        for (FfxBrixelizerInstanceID id : scan.query(current))
+        {
+            if (!std::binary_search(inPrevious.begin(), inPrevious.end(), id))
+                FFX_TEST_CHECK(std::binary_search(found.begin(), found.end(), id));
+        }
+
+        previous = current;
+    }
+
+    // a box which did not move exposes nothing, and one which jumped away exposes all of itself
+    FfxBrixelizerAABB regions[6];
+    FFX_TEST_CHECK(bvhSubtract(previous, previous, regions) == 0);
+    FfxBrixelizerAABB away = { { 1000.0f, 0.0f, 0.0f }, { 1064.0f, 64.0f, 64.0f } };
+    FFX_TEST_CHECK(bvhSubtract(away, previous, regions) == 1 && sameAABB(regions[0], away));
+    FFX_TEST_CHECK(bvhQueryAny(bvh, regions, 0, ids.data(), FFX_BRIXELIZER_MAX_INSTANCES) == 0);
+
+    // differently sized boxes, as after a cascade is resized, cut up to a slab per face
+    for (uint32_t i = 0; i < 1000; ++i)
+        checkSubtract(randomAABB(10.0f, 20.0f), randomAABB(10.0f, 20.0f));
+    FfxBrixelizerAABB outer = { { -2.0f, -2.0f, -2.0f }, { 2.0f, 2.0f, 2.0f } };
+    FfxBrixelizerAABB inner = { { -1.0f, -1.0f, -1.0f }, { 1.0f, 1.0f, 1.0f } };
+    FFX_TEST_CHECK(bvhSubtract(outer, inner, regions) == 6);
+    FFX_TEST_CHECK(bvhSubtract(inner, outer, regions) == 0);
+
+    delete bvh;
+}
+
+int main()
+{
+    testRandomScene(20000, 100.0f, 10.0f);
+    testRandomScene(200000, 1000.0f, 50.0f);
+    testDegenerateScene();
+    testScrollingQueries();
+
+    return FFX_TEST_RESULT();
+}
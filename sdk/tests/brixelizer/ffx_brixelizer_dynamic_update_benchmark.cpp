@@ -0,0 +1,153 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// Benchmarks the dynamic cascade updates of mostly static scenes: dynamic instances of which a share moves every frame.
+// Each scene runs with unkeyed instances, which rebuild the dynamic cascade on every update, and with keyed instances at
+// a zero and a small motion threshold, which only resubmit instances near regions that changed. Reports, per frame, the
+// jobs of the update, the voxels they cover (which the raw context clips every job to on the CPU), and the CPU time of
+// submitting the instances and baking the update.
+//
+// ffx_brixelizer.cpp is linked against the stand-in for the raw API of ffx_brixelizer_raw_stub.h, which only records
+// the jobs here.
+
+#include <chrono>
+#include <random>
+
+#include "brixelizer/ffx_brixelizer_raw_stub.h"
+
+static const uint32_t s_frameCount   = 300;
+static const uint32_t s_warmupFrames = 16;  // every cascade has been built once by then
+static const float    s_worldSize    = 12.0f;
+
+struct FrameCosts
+{
+    double jobs;
+    double jobVoxels;
+    double microseconds;
+};
+
+static FrameCosts runScene(uint32_t instanceCount, uint32_t movingPercent, bool keyed, float motionThreshold)
+{
+    FfxBrixelizerContextDescription contextDesc = {};
+    contextDesc.numCascades = 3;
+    for (uint32_t i = 0; i < contextDesc.numCascades; ++i)
+    {
+        contextDesc.cascadeDescs[i].flags     = FFX_BRIXELIZER_CASCADE_DYNAMIC;
+        contextDesc.cascadeDescs[i].voxelSize = 0.125f * float(1 << i);
+    }
+    contextDesc.dynamicInstanceMotionThreshold = motionThreshold;
+
+    FfxBrixelizerContext*                context   = new FfxBrixelizerContext;
+    FfxBrixelizerBakedUpdateDescription* bakedDesc = new FfxBrixelizerBakedUpdateDescription;
+    FFX_TEST_CHECK(ffxBrixelizerContextCreate(&contextDesc, context) == FFX_OK);
+
+    FfxBrixelizerRawContext* rawContext = nullptr;
+    ffxBrixelizerGetRawContext(context, &rawContext);
+    const StubContext& stub = s_stubContexts[rawContext];
+
+    std::mt19937                                  random(instanceCount + movingPercent);
+    std::uniform_real_distribution<float>         position(-s_worldSize, s_worldSize);
+    std::uniform_real_distribution<float>         extent(0.1f, 1.0f);
+    std::vector<FfxBrixelizerInstanceDescription> descs(instanceCount);
+    for (uint32_t instanceIndex = 0; instanceIndex < instanceCount; ++instanceIndex)
+    {
+        FfxBrixelizerInstanceDescription& desc = descs[instanceIndex];
+        desc = {};
+        for (uint32_t i = 0; i < 3; ++i)
+        {
+            desc.aabb.min[i]          = position(random);
+            desc.aabb.max[i]          = desc.aabb.min[i] + extent(random);
+            desc.transform[i * 4 + i] = 1.0f;
+            desc.transform[i * 4 + 3] = desc.aabb.min[i];
+        }
+        desc.indexBufferOffset  = instanceIndex;
+        desc.flags              = FFX_BRIXELIZER_INSTANCE_FLAG_DYNAMIC;
+        desc.dynamicInstanceKey = keyed ? instanceIndex + 1 : 0;
+    }
+
+    FrameCosts costs = {};
+    for (uint32_t frameIndex = 0; frameIndex < s_frameCount; ++frameIndex)
+    {
+        // the moving instances drift by 2 cm a frame
+        for (uint32_t instanceIndex = 0; instanceIndex < instanceCount * movingPercent / 100; ++instanceIndex)
+        {
+            FfxBrixelizerInstanceDescription& desc = descs[instanceIndex];
+            desc.aabb.min[0] += 0.02f;
+            desc.aabb.max[0] += 0.02f;
+            desc.transform[3] += 0.02f;
+        }
+
+        FfxBrixelizerUpdateDescription updateDesc = {};
+        updateDesc.frameIndex = frameIndex;
+
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        FFX_TEST_CHECK(ffxBrixelizerCreateInstances(context, descs.data(), instanceCount) == FFX_OK);
+        FFX_TEST_CHECK(ffxBrixelizerBakeUpdate(context, &updateDesc, bakedDesc) == FFX_OK);
+        const double microseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        FFX_TEST_CHECK(ffxBrixelizerUpdate(context, bakedDesc, FfxResource(), nullptr) == FFX_OK);
+
+        if (frameIndex >= s_warmupFrames)
+        {
+            costs.jobs += double(stub.updateJobs.size());
+            costs.jobVoxels += double(stub.updateJobVoxels);
+            costs.microseconds += microseconds;
+        }
+    }
+
+    const double measuredFrames = double(s_frameCount - s_warmupFrames);
+    costs.jobs /= measuredFrames;
+    costs.jobVoxels /= measuredFrames;
+    costs.microseconds /= measuredFrames;
+
+    FFX_TEST_CHECK(ffxBrixelizerContextDestroy(context) == FFX_OK);
+    delete bakedDesc;
+    delete context;
+    return costs;
+}
+
+int main()
+{
+    s_stubModelsVoxels = false;
+
+    printf("%-9s %-7s %-17s %10s %14s %12s\n", "instances", "moving", "instances", "jobs/frame", "voxels/frame", "us/frame");
+    for (uint32_t instanceCount : { 1000u, 4000u })
+    {
+        for (uint32_t movingPercent : { 0u, 1u, 5u, 100u })
+        {
+            FrameCosts rebuild   = runScene(instanceCount, movingPercent, false, 0.0f);
+            FrameCosts keyed     = runScene(instanceCount, movingPercent, true, 0.0f);
+            FrameCosts threshold = runScene(instanceCount, movingPercent, true, 0.05f);
+
+            printf("%-9u %6u%% %-17s %10.1f %14.0f %12.1f\n", instanceCount, movingPercent, "unkeyed", rebuild.jobs, rebuild.jobVoxels, rebuild.microseconds);
+            printf("%-9s %7s %-17s %10.1f %14.0f %12.1f\n", "", "", "keyed", keyed.jobs, keyed.jobVoxels, keyed.microseconds);
+            printf("%-9s %7s %-17s %10.1f %14.0f %12.1f\n", "", "", "keyed, 5 cm", threshold.jobs, threshold.jobVoxels, threshold.microseconds);
+
+            // still scenes stop producing jobs, and mostly static ones produce fewer than a rebuild
+            if (movingPercent == 0)
+                FFX_TEST_CHECK(keyed.jobs == 0.0 && threshold.jobs == 0.0);
+            if (movingPercent <= 5)
+                FFX_TEST_CHECK(keyed.jobs < rebuild.jobs && keyed.jobVoxels < rebuild.jobVoxels);
+            FFX_TEST_CHECK(threshold.jobs <= keyed.jobs);
+        }
+    }
+
+    return FFX_TEST_RESULT();
+}
@@ -0,0 +1,292 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Checks that incremental updates of dynamic cascades, which only resubmit keyed instances near regions changed since
+// the last update, leave the same voxels as voxelizing every instance from scratch, and that they submit exactly the
+// jobs of a rebuild which touch those regions.
+//
+// ffx_brixelizer.cpp is linked against the stand-in for the raw API of ffx_brixelizer_raw_stub.h.
+
+#include <random>
+
+#include "brixelizer/ffx_brixelizer_raw_stub.h"
+
+struct SceneObject
+{
+    bool              present;
+    uint32_t          pose;
+    FfxBrixelizerAABB aabb;
+};
+
+class Scene
+{
+public:
+    Scene(uint32_t objectCount, float worldSize)
+        : m_random(objectCount)
+        , m_worldSize(worldSize)
+        , m_objects(objectCount)
+    {
+        for (SceneObject& object : m_objects)
+        {
+            object.present = true;
+            object.pose    = 0;
+            place(object);
+        }
+    }
+
+    // Objects mostly stay put, or nudge by less than a voxel, otherwise they jump, vanish or reappear
+    void animate()
+    {
+        for (SceneObject& object : m_objects)
+        {
+            uint32_t event = m_random() % 100;
+            if (event < 70)
+                continue;
+
+            if (event < 90)
+            {
+                float offset[3];
+                for (uint32_t i = 0; i < 3; ++i)
+                    offset[i] = random(-0.1f, 0.1f);
+                for (uint32_t i = 0; i < 3; ++i)
+                {
+                    object.aabb.min[i] += offset[i];
+                    object.aabb.max[i] += offset[i];
+                }
+            }
+            else if (event < 95)
+                place(object);
+            else
+                object.present = !object.present;
+            ++object.pose;
+        }
+    }
+
+    void submit(FfxBrixelizerContext* context, bool keyed) const
+    {
+        std::vector<FfxBrixelizerInstanceDescription> descs;
+        for (uint32_t objectIndex = 0; objectIndex < uint32_t(m_objects.size()); ++objectIndex)
+        {
+            const SceneObject& object = m_objects[objectIndex];
+            if (!object.present)
+                continue;
+
+            FfxBrixelizerInstanceDescription desc = {};
+            desc.aabb = object.aabb;
+            for (uint32_t i = 0; i < 3; ++i)
+            {
+                desc.transform[i * 4 + i] = 1.0f;
+                desc.transform[i * 4 + 3] = 0.5f * (object.aabb.min[i] + object.aabb.max[i]);
+            }
+            desc.indexBufferOffset  = geometry(objectIndex);
+            desc.flags              = FFX_BRIXELIZER_INSTANCE_FLAG_DYNAMIC;
+            desc.dynamicInstanceKey = keyed ? objectIndex + 1 : 0;
+            descs.push_back(desc);
+        }
+        FFX_TEST_CHECK(ffxBrixelizerCreateInstances(context, descs.data(), uint32_t(descs.size())) == FFX_OK);
+    }
+
+    // The voxels of a cascade voxelized from scratch with every object present
+    VoxelContents voxelize(const float cascadeMin[3], float voxelSize) const
+    {
+        VoxelContents voxels(s_cascadeVoxelCount);
+        for (uint32_t objectIndex = 0; objectIndex < uint32_t(m_objects.size()); ++objectIndex)
+        {
+            const SceneObject& object = m_objects[objectIndex];
+            VoxelRange         range;
+            if (object.present && getJobVoxels(object.aabb.min, object.aabb.max, cascadeMin, voxelSize, &range))
+                forEachVoxel(range, [&](uint32_t voxel) { addToVoxel(voxels[voxel], geometry(objectIndex)); });
+        }
+        return voxels;
+    }
+
+private:
+    uint32_t geometry(uint32_t objectIndex) const
+    {
+        return (objectIndex << 16) | (m_objects[objectIndex].pose & 0xffff);
+    }
+
+    float random(float minValue, float maxValue)
+    {
+        return std::uniform_real_distribution<float>(minValue, maxValue)(m_random);
+    }
+
+    // Places an object anywhere in the world, sometimes flat along one axis
+    void place(SceneObject& object)
+    {
+        uint32_t flatAxis = m_random() % 8;
+        for (uint32_t i = 0; i < 3; ++i)
+        {
+            object.aabb.min[i] = random(-m_worldSize, m_worldSize);
+            object.aabb.max[i] = object.aabb.min[i] + (i == flatAxis ? 0.0f : random(0.05f, 2.0f));
+        }
+    }
+
+    std::mt19937             m_random;
+    float                    m_worldSize;
+    std::vector<SceneObject> m_objects;
+};
+
+static bool sameVoxels(const VoxelContents& x, const VoxelContents& y)
+{
+    for (uint32_t voxel = 0; voxel < s_cascadeVoxelCount; ++voxel)
+    {
+        std::vector<uint32_t> a = x[voxel], b = y[voxel];
+        std::sort(a.begin(), a.end());
+        std::sort(b.begin(), b.end());
+        if (a != b)
+            return false;
+    }
+    return true;
+}
+
+static FfxBrixelizerContext* createContext(const float sdfCenter[3], float motionThreshold)
+{
+    FfxBrixelizerContextDescription desc = {};
+    std::copy(sdfCenter, sdfCenter + 3, desc.sdfCenter);
+    desc.numCascades = 3;
+    for (uint32_t i = 0; i < desc.numCascades; ++i)
+    {
+        desc.cascadeDescs[i].flags     = FFX_BRIXELIZER_CASCADE_DYNAMIC;
+        desc.cascadeDescs[i].voxelSize = 0.125f * float(1 << i);
+    }
+    desc.dynamicInstanceMotionThreshold = motionThreshold;
+
+    FfxBrixelizerContext* context = new FfxBrixelizerContext;
+    FFX_TEST_CHECK(ffxBrixelizerContextCreate(&desc, context) == FFX_OK);
+    return context;
+}
+
+static void update(FfxBrixelizerContext* context, FfxBrixelizerBakedUpdateDescription* bakedDesc, uint32_t frameIndex, const float sdfCenter[3])
+{
+    FfxBrixelizerUpdateDescription desc = {};
+    desc.frameIndex = frameIndex;
+    std::copy(sdfCenter, sdfCenter + 3, desc.sdfCenter);
+    desc.cascadeSchedulingMode = FFX_BRIXELIZER_CASCADE_SCHEDULING_ROUND_ROBIN;
+
+    FFX_TEST_CHECK(ffxBrixelizerBakeUpdate(context, &desc, bakedDesc) == FFX_OK);
+    FFX_TEST_CHECK(ffxBrixelizerUpdate(context, bakedDesc, FfxResource(), nullptr) == FFX_OK);
+}
+
+static StubContext& getStub(FfxBrixelizerContext* context)
+{
+    FfxBrixelizerRawContext* rawContext = nullptr;
+    ffxBrixelizerGetRawContext(context, &rawContext);
+    return s_stubContexts[rawContext];
+}
+
+// At a zero threshold an update which does not rebuild the cascade submits, instead of every instance, invalidations of
+// the regions which changed and the instances overlapping them grown by the 3 voxels invalidations clear around them.
+// Checks its instance jobs are exactly those of the rebuild which overlap its invalidations, and that it has no more
+// jobs than the rebuild, as the cascade is rebuilt instead when that would take fewer.
+static void checkIncrementalJobs(const StubContext& keyed, const StubContext& unkeyed)
+{
+    const float margin = 3.0f * keyed.cascades.at(keyed.updatedCascade).voxelSize;
+
+    std::vector<RecordedJob> invalidations, instanceJobs, expectedInstanceJobs;
+    for (const RecordedJob& job : keyed.updateJobs)
+        ((job.flags & FFX_BRIXELIZER_RAW_JOB_FLAG_INVALIDATE) ? invalidations : instanceJobs).push_back(job);
+
+    for (const RecordedJob& job : unkeyed.updateJobs)
+    {
+        FFX_TEST_CHECK(!(job.flags & FFX_BRIXELIZER_RAW_JOB_FLAG_INVALIDATE));
+        bool dirty = false;
+        for (const RecordedJob& invalidation : invalidations)
+        {
+            bool overlap = true;
+            for (uint32_t i = 0; i < 3; ++i)
+                overlap = overlap && job.aabbMin[i] <= invalidation.aabbMax[i] + margin && invalidation.aabbMin[i] - margin <= job.aabbMax[i];
+            dirty = dirty || overlap;
+        }
+        if (dirty)
+            expectedInstanceJobs.push_back(job);
+    }
+
+    FFX_TEST_CHECK(instanceJobs == expectedInstanceJobs);
+    FFX_TEST_CHECK(keyed.updateJobs.size() <= unkeyed.updateJobs.size());
+}
+
+// Runs keyed instances with a zero motion threshold next to unkeyed instances, which rebuild the cascade every update
+static void testZeroThreshold(uint32_t frameCount)
+{
+    float sdfCenter[3] = { 0.0f, 0.0f, 0.0f };
+    Scene scene(64, 10.0f);
+
+    FfxBrixelizerContext* keyedContext   = createContext(sdfCenter, 0.0f);
+    FfxBrixelizerContext* unkeyedContext = createContext(sdfCenter, 0.0f);
+    FfxBrixelizerBakedUpdateDescription* bakedDesc = new FfxBrixelizerBakedUpdateDescription;
+
+    uint32_t incrementalUpdates = 0;
+    for (uint32_t frameIndex = 0; frameIndex < frameCount; ++frameIndex)
+    {
+        if (frameIndex % 97 == 96)
+            sdfCenter[frameIndex % 3] += 0.3f;
+        scene.animate();
+
+        scene.submit(keyedContext, true);
+        update(keyedContext, bakedDesc, frameIndex, sdfCenter);
+        scene.submit(unkeyedContext, false);
+        update(unkeyedContext, bakedDesc, frameIndex, sdfCenter);
+
+        StubContext& keyed   = getStub(keyedContext);
+        StubContext& unkeyed = getStub(unkeyedContext);
+        FFX_TEST_CHECK(keyed.updatedCascade == unkeyed.updatedCascade);
+        FFX_TEST_CHECK(unkeyed.updateFlags == FFX_BRIXELIZER_CASCADE_UPDATE_FLAG_RESET);
+
+        // rebuilding updates submit the same jobs either way, and the cascades end up the same as a rebuild
+        if (keyed.updateFlags & FFX_BRIXELIZER_CASCADE_UPDATE_FLAG_RESET)
+            FFX_TEST_CHECK(keyed.updateJobs == unkeyed.updateJobs);
+        else
+        {
+            checkIncrementalJobs(keyed, unkeyed);
+            ++incrementalUpdates;
+        }
+
+        StubCascade&  cascade   = keyed.cascades[keyed.updatedCascade];
+        VoxelContents reference = scene.voxelize(keyed.updatedCascadeMin, cascade.voxelSize);
+        FFX_TEST_CHECK(sameVoxels(cascade.voxels, reference));
+        FFX_TEST_CHECK(sameVoxels(unkeyed.cascades[unkeyed.updatedCascade].voxels, reference));
+    }
+    FFX_TEST_CHECK(incrementalUpdates > frameCount / 4);
+
+    // once every cascade has caught up with a still scene, updates have nothing left to do
+    for (uint32_t frameIndex = frameCount; frameIndex < frameCount + 16; ++frameIndex)
+    {
+        scene.submit(keyedContext, true);
+        update(keyedContext, bakedDesc, frameIndex, sdfCenter);
+        if (frameIndex >= frameCount + 8)
+            FFX_TEST_CHECK(getStub(keyedContext).updateJobs.empty());
+    }
+
+    FFX_TEST_CHECK(ffxBrixelizerContextDestroy(keyedContext) == FFX_OK);
+    FFX_TEST_CHECK(ffxBrixelizerContextDestroy(unkeyedContext) == FFX_OK);
+    delete bakedDesc;
+    delete unkeyedContext;
+    delete keyedContext;
+}
+
+int main()
+{
+    testZeroThreshold(600);
+
+    return FFX_TEST_RESULT();
+}
@@ -0,0 +1,137 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// Benchmarks flushing new Brixelizer instances (ffxBrixelizerRawContextFlushInstances) against the null backend, for
+// 1k, 10k and the maximum number of instances, and reports the CPU time and the jobs of each flush.
+//
+// Each count is flushed twice:
+//  - streamed: the instances are created in chunks, as a level streams in, and get consecutive IDs;
+//  - fragmented: a random third of them is destroyed and created again, which hands out IDs scattered over the whole
+//    range, so the flush has to bridge gaps to stay within its range budget.
+// Whatever the count, a flush must schedule at most 2 * FFX_BRIXELIZER_MAX_INSTANCE_FLUSH_RANGES copies (one per
+// range for the infos, one for the transforms) and execute them at once.
+
+#include <algorithm>
+#include <memory>
+#include <random>
+
+#include <FidelityFX/host/ffx_brixelizer_raw.h>
+#include <brixelizer/ffx_brixelizer_raw_private.h>
+#include "null_backend/ffx_null_test_backend.h"
+#include "ffx_test.h"
+
+static const uint32_t s_chunkSize = 256;
+
+struct Flush
+{
+    double   microseconds;
+    uint64_t jobs;
+    uint64_t copies;
+    uint64_t executeCalls;
+};
+
+static void createInstances(FfxBrixelizerRawContext* context, FfxBrixelizerInstanceID* outInstanceIDs, uint32_t count)
+{
+    std::vector<FfxBrixelizerRawInstanceDescription> descriptions(std::min(count, s_chunkSize));
+    for (uint32_t first = 0; first < count; first += s_chunkSize)
+    {
+        const uint32_t chunkCount = std::min(count - first, s_chunkSize);
+        for (uint32_t i = 0; i < chunkCount; ++i)
+        {
+            FfxBrixelizerRawInstanceDescription& description = descriptions[i];
+            description               = {};
+            description.aabbMax[0]    = 1.0f;
+            description.aabbMax[1]    = 1.0f;
+            description.aabbMax[2]    = 1.0f;
+            description.transform[0]  = 1.0f;
+            description.transform[5]  = 1.0f;
+            description.transform[10] = 1.0f;
+            description.indexFormat   = FFX_INDEX_TYPE_UINT32;
+            description.triangleCount = 12;
+            description.vertexStride  = 12;
+            description.vertexCount   = 8;
+            description.vertexFormat  = FFX_SURFACE_FORMAT_R32G32B32_FLOAT;
+            description.outInstanceID = &outInstanceIDs[first + i];
+        }
+        FFX_TEST_CHECK(ffxBrixelizerRawContextCreateInstances(context, descriptions.data(), chunkCount) == FFX_OK);
+    }
+}
+
+static Flush flushInstances(NullTestBackend& backend, FfxBrixelizerRawContext* context)
+{
+    resetNullTestCommands(backend);
+    FFX_TEST_CHECK(ffxResetStatisticsNull(&backend.backendInterface) == FFX_OK);
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    FFX_TEST_CHECK(ffxBrixelizerRawContextFlushInstances(context, backend.commandList) == FFX_OK);
+    const double microseconds = microsecondsSince(start);
+
+    uint64_t copies = 0;
+    for (uint32_t i = 0; i < backend.stream.commandCount; ++i)
+        copies += (backend.commands[i].type == FFX_NULL_COMMAND_COPY) ? 1 : 0;
+
+    const FfxNullBackendStatistics statistics = getNullTestStatistics(backend);
+    return {microseconds, statistics.jobsScheduled, copies, statistics.executeCalls};
+}
+
+static void checkFlush(const char* name, uint32_t instanceCount, const Flush& flush)
+{
+    printf("%-12s %10u %10.1f us %6llu %8llu %9llu\n", name, instanceCount, flush.microseconds,
+           (unsigned long long)flush.jobs, (unsigned long long)flush.copies, (unsigned long long)flush.executeCalls);
+
+    FFX_TEST_CHECK(flush.copies > 0);
+    FFX_TEST_CHECK(flush.copies <= 2 * FFX_BRIXELIZER_MAX_INSTANCE_FLUSH_RANGES);
+    FFX_TEST_CHECK(flush.jobs == flush.copies);
+    FFX_TEST_CHECK(flush.executeCalls == 1);
+}
+
+int main()
+{
+    NullTestBackend backend;
+    FFX_TEST_CHECK(createNullTestBackend(backend, FFX_BRIXELIZER_CONTEXT_COUNT));
+
+    std::mt19937 random(7);
+
+    printf("%-12s %10s %13s %6s %8s %9s\n", "flush", "instances", "time", "jobs", "copies", "executes");
+    for (uint32_t instanceCount : {1000u, 10000u, uint32_t(FFX_BRIXELIZER_MAX_INSTANCES)})
+    {
+        // the context holds host copies of every instance, too large for the stack
+        std::unique_ptr<FfxBrixelizerRawContext> context(new FfxBrixelizerRawContext());
+
+        FfxBrixelizerRawContextDescription description = {};
+        description.backendInterface                   = backend.backendInterface;
+        FFX_TEST_CHECK(ffxBrixelizerRawContextCreate(context.get(), &description) == FFX_OK);
+
+        std::vector<FfxBrixelizerInstanceID> instanceIDs(instanceCount);
+        createInstances(context.get(), instanceIDs.data(), instanceCount);
+        checkFlush("streamed", instanceCount, flushInstances(backend, context.get()));
+
+        std::shuffle(instanceIDs.begin(), instanceIDs.end(), random);
+        const uint32_t recreatedCount = instanceCount / 3;
+        FFX_TEST_CHECK(ffxBrixelizerRawContextDestroyInstances(context.get(), instanceIDs.data(), recreatedCount) == FFX_OK);
+        createInstances(context.get(), instanceIDs.data(), recreatedCount);
+        checkFlush("fragmented", recreatedCount, flushInstances(backend, context.get()));
+
+        FFX_TEST_CHECK(ffxBrixelizerRawContextDestroy(context.get()) == FFX_OK);
+    }
+
+    return FFX_TEST_RESULT();
+}
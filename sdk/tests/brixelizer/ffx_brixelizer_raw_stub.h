@@ -0,0 +1,283 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#pragma once
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#include <FidelityFX/host/ffx_brixelizer.h>
+#include "ffx_test.h"
+
+// A stand-in for the raw Brixelizer API, for tests linking ffx_brixelizer.cpp without a backend. It models a cascade as
+// the set of instances voxelized into each voxel, with the job inflation, snapping and clamping of
+// ffxBrixelizerRawContextUpdateCascade: invalidation jobs free voxels first, then instance jobs fill only voxels which
+// are free at that point, as voxels already holding a brick are not built again. Each update records its jobs.
+//
+// Include it in one translation unit of a test.
+
+static const uint32_t s_cascadeVoxelCount = FFX_BRIXELIZER_CASCADE_RESOLUTION * FFX_BRIXELIZER_CASCADE_RESOLUTION * FFX_BRIXELIZER_CASCADE_RESOLUTION;
+
+// Instances identify their geometry and pose with indexBufferOffset, as instance IDs change every frame
+typedef std::vector<std::vector<uint32_t>> VoxelContents;
+
+struct VoxelRange
+{
+    uint32_t min[3];
+    uint32_t max[3];
+};
+
+// Snaps a job to the voxels ffxBrixelizerRawContextUpdateCascade dispatches it over, false if it is skipped
+static bool getJobVoxels(const float aabbMin[3], const float aabbMax[3], const float cascadeMin[3], float voxelSize, VoxelRange* range)
+{
+    const float maxVoxel = (float)FFX_BRIXELIZER_CASCADE_RESOLUTION - 1;
+    float       inflationSize = voxelSize;
+
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        float gridMax = cascadeMin[i] + voxelSize * FFX_BRIXELIZER_CASCADE_RESOLUTION;
+        if (aabbMax[i] < cascadeMin[i] - inflationSize || aabbMin[i] > gridMax + inflationSize)
+            return false;
+    }
+    if (aabbMax[0] == aabbMin[0] && aabbMax[1] == aabbMin[1] && aabbMax[2] == aabbMin[2])
+        return false;
+
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        range->min[i] = uint32_t(std::max(0.0f, std::min((aabbMin[i] - inflationSize - cascadeMin[i]) / voxelSize, maxVoxel)));
+        range->max[i] = uint32_t(std::max(0.0f, std::min((aabbMax[i] + inflationSize - cascadeMin[i]) / voxelSize, maxVoxel))) + 1;
+    }
+    return true;
+}
+
+template <typename Function>
+static void forEachVoxel(const VoxelRange& range, Function function)
+{
+    for (uint32_t z = range.min[2]; z < range.max[2]; ++z)
+        for (uint32_t y = range.min[1]; y < range.max[1]; ++y)
+            for (uint32_t x = range.min[0]; x < range.max[0]; ++x)
+                function((z * FFX_BRIXELIZER_CASCADE_RESOLUTION + y) * FFX_BRIXELIZER_CASCADE_RESOLUTION + x);
+}
+
+static void addToVoxel(std::vector<uint32_t>& voxel, uint32_t geometry)
+{
+    if (std::find(voxel.begin(), voxel.end(), geometry) == voxel.end())
+        voxel.push_back(geometry);
+}
+
+struct RecordedJob
+{
+    float    aabbMin[3];
+    float    aabbMax[3];
+    uint32_t flags;
+    uint32_t geometry;
+
+    bool operator<(const RecordedJob& other) const
+    {
+        return std::lexicographical_compare(&aabbMin[0], &aabbMax[3], &other.aabbMin[0], &other.aabbMax[3]) ||
+               (std::equal(&aabbMin[0], &aabbMax[3], &other.aabbMin[0]) && (flags < other.flags || (flags == other.flags && geometry < other.geometry)));
+    }
+
+    bool operator==(const RecordedJob& other) const
+    {
+        return std::equal(&aabbMin[0], &aabbMax[3], &other.aabbMin[0]) && flags == other.flags && geometry == other.geometry;
+    }
+};
+
+struct StubCascade
+{
+    float         voxelSize = 0.0f;
+    VoxelContents voxels = VoxelContents(s_cascadeVoxelCount);
+};
+
+struct StubContext
+{
+    std::map<uint32_t, StubCascade> cascades;
+    std::map<uint32_t, uint32_t>    instanceGeometry;
+    std::vector<uint32_t>           freeInstanceIDs;
+
+    // the last cascade update
+    uint32_t                 updatedCascade = 0;
+    float                    updatedCascadeMin[3] = {};
+    uint32_t                 updateFlags = 0;
+    std::vector<RecordedJob> updateJobs;
+    uint64_t                 updateJobVoxels = 0;  // voxels covered by the jobs, which the raw context clips them to
+};
+
+// Benchmarks only need the jobs, and leave the voxels of cascades and the geometry of instances alone
+static bool s_stubModelsVoxels = true;
+
+static std::map<const FfxBrixelizerRawContext*, StubContext> s_stubContexts;
+
+FfxErrorCode ffxBrixelizerRawContextCreate(FfxBrixelizerRawContext* context, const FfxBrixelizerRawContextDescription*)
+{
+    StubContext& stub = s_stubContexts[context];
+    stub = StubContext();
+    for (uint32_t i = 0; i < FFX_BRIXELIZER_MAX_INSTANCES; ++i)
+        stub.freeInstanceIDs.push_back(FFX_BRIXELIZER_MAX_INSTANCES - 1 - i);
+    return FFX_OK;
+}
+
+FfxErrorCode ffxBrixelizerRawContextDestroy(FfxBrixelizerRawContext* context)
+{
+    s_stubContexts.erase(context);
+    return FFX_OK;
+}
+
+FfxErrorCode ffxBrixelizerRawContextCreateCascade(FfxBrixelizerRawContext* context, const FfxBrixelizerRawCascadeDescription* cascadeDescription)
+{
+    s_stubContexts[context].cascades[cascadeDescription->index].voxelSize = cascadeDescription->brickSize;
+    return FFX_OK;
+}
+
+FfxErrorCode ffxBrixelizerRawContextCreateInstances(FfxBrixelizerRawContext* context, const FfxBrixelizerRawInstanceDescription* instanceDescriptions, uint32_t numInstanceDescriptions)
+{
+    StubContext& stub = s_stubContexts[context];
+    for (uint32_t i = 0; i < numInstanceDescriptions; ++i)
+    {
+        if (!s_stubModelsVoxels)
+        {
+            *instanceDescriptions[i].outInstanceID = i;
+            continue;
+        }
+        FfxBrixelizerInstanceID id = stub.freeInstanceIDs.back();
+        stub.freeInstanceIDs.pop_back();
+        stub.instanceGeometry[id] = instanceDescriptions[i].indexBufferOffset;
+        *instanceDescriptions[i].outInstanceID = id;
+    }
+    return FFX_OK;
+}
+
+FfxErrorCode ffxBrixelizerRawContextDestroyInstances(FfxBrixelizerRawContext* context, const FfxBrixelizerInstanceID* instanceIDs, uint32_t numInstanceIDs)
+{
+    StubContext& stub = s_stubContexts[context];
+    for (uint32_t i = 0; i < numInstanceIDs && s_stubModelsVoxels; ++i)
+    {
+        FFX_TEST_CHECK(stub.instanceGeometry.erase(instanceIDs[i]) == 1);
+        stub.freeInstanceIDs.push_back(instanceIDs[i]);
+    }
+    return FFX_OK;
+}
+
+FfxErrorCode ffxBrixelizerRawContextUpdateCascade(FfxBrixelizerRawContext* context, const FfxBrixelizerRawCascadeUpdateDescription* cascadeUpdateDescription)
+{
+    StubContext& stub    = s_stubContexts[context];
+    StubCascade& cascade = stub.cascades[cascadeUpdateDescription->cascadeIndex];
+
+    stub.updatedCascade = cascadeUpdateDescription->cascadeIndex;
+    std::copy(cascadeUpdateDescription->cascadeMin, cascadeUpdateDescription->cascadeMin + 3, stub.updatedCascadeMin);
+    stub.updateFlags = cascadeUpdateDescription->flags;
+    stub.updateJobs.clear();
+    stub.updateJobVoxels = 0;
+
+    if (s_stubModelsVoxels && (cascadeUpdateDescription->flags & FFX_BRIXELIZER_CASCADE_UPDATE_FLAG_RESET))
+        cascade.voxels.assign(s_cascadeVoxelCount, std::vector<uint32_t>());
+
+    for (size_t i = 0; i < cascadeUpdateDescription->numJobs; ++i)
+    {
+        const FfxBrixelizerRawJobDescription& job = cascadeUpdateDescription->jobs[i];
+
+        RecordedJob recordedJob = {};
+        std::copy(job.aabbMin, job.aabbMin + 3, recordedJob.aabbMin);
+        std::copy(job.aabbMax, job.aabbMax + 3, recordedJob.aabbMax);
+        recordedJob.flags = job.flags;
+        if (s_stubModelsVoxels && !(job.flags & FFX_BRIXELIZER_RAW_JOB_FLAG_INVALIDATE))
+        {
+            FFX_TEST_CHECK(stub.instanceGeometry.count(job.instanceIdx) == 1);
+            recordedJob.geometry = stub.instanceGeometry[job.instanceIdx];
+        }
+        stub.updateJobs.push_back(recordedJob);
+
+        VoxelRange range;
+        if (getJobVoxels(job.aabbMin, job.aabbMax, stub.updatedCascadeMin, cascade.voxelSize, &range))
+            stub.updateJobVoxels += uint64_t(range.max[0] - range.min[0]) * (range.max[1] - range.min[1]) * (range.max[2] - range.min[2]);
+    }
+    if (!s_stubModelsVoxels)
+    {
+        std::sort(stub.updateJobs.begin(), stub.updateJobs.end());
+        return FFX_OK;
+    }
+
+    // free the voxels of invalidation jobs, then build every free voxel from all instance jobs covering it
+    std::vector<bool> buildable(s_cascadeVoxelCount);
+    for (const RecordedJob& job : stub.updateJobs)
+    {
+        VoxelRange range;
+        if ((job.flags & FFX_BRIXELIZER_RAW_JOB_FLAG_INVALIDATE) && getJobVoxels(job.aabbMin, job.aabbMax, stub.updatedCascadeMin, cascade.voxelSize, &range))
+            forEachVoxel(range, [&](uint32_t voxel) { cascade.voxels[voxel].clear(); });
+    }
+    for (uint32_t voxel = 0; voxel < s_cascadeVoxelCount; ++voxel)
+        buildable[voxel] = cascade.voxels[voxel].empty();
+    for (const RecordedJob& job : stub.updateJobs)
+    {
+        VoxelRange range;
+        if (!(job.flags & FFX_BRIXELIZER_RAW_JOB_FLAG_INVALIDATE) && getJobVoxels(job.aabbMin, job.aabbMax, stub.updatedCascadeMin, cascade.voxelSize, &range))
+        {
+            forEachVoxel(range, [&](uint32_t voxel) {
+                if (buildable[voxel])
+                    addToVoxel(cascade.voxels[voxel], job.geometry);
+            });
+        }
+    }
+
+    std::sort(stub.updateJobs.begin(), stub.updateJobs.end());
+    return FFX_OK;
+}
+
+uint32_t ffxBrixelizerRawGetCascadeToUpdate(uint32_t frameIndex, uint32_t maxCascades)
+{
+    uint32_t n = frameIndex & ((1 << maxCascades) - 1);
+    n = n - (n & (n - 1));
+    if (n == 0)
+        n = 1 << (maxCascades - 1);
+    uint32_t cascadeIndex = 0;
+    while (n >>= 1)
+        ++cascadeIndex;
+    return cascadeIndex;
+}
+
+uint32_t ffxBrixelizerRawGetCascadeToUpdateByCost(const FfxBrixelizerRawCascadeSchedulingInfo* cascadeInfos, uint32_t maxCascades, uint32_t)
+{
+    uint32_t stalestCascade = 0;
+    for (uint32_t i = 1; i < maxCascades; ++i)
+    {
+        if (cascadeInfos[i].framesSinceUpdate > cascadeInfos[stalestCascade].framesSinceUpdate)
+            stalestCascade = i;
+    }
+    return stalestCascade;
+}
+
+// The rest of the raw API has no effect on which voxels are built
+FfxErrorCode ffxBrixelizerRawContextGetInfo(FfxBrixelizerRawContext*, FfxBrixelizerContextInfo*) { return FFX_OK; }
+FfxErrorCode ffxBrixelizerRawContextBegin(FfxBrixelizerRawContext*, FfxBrixelizerResources) { return FFX_OK; }
+FfxErrorCode ffxBrixelizerRawContextEnd(FfxBrixelizerRawContext*) { return FFX_OK; }
+FfxErrorCode ffxBrixelizerRawContextSubmit(FfxBrixelizerRawContext*, FfxCommandList) { return FFX_OK; }
+FfxErrorCode ffxBrixelizerRawContextGetScratchMemorySize(FfxBrixelizerRawContext*, const FfxBrixelizerRawCascadeUpdateDescription*, size_t* size) { *size = 0; return FFX_OK; }
+FfxErrorCode ffxBrixelizerRawContextMergeCascades(FfxBrixelizerRawContext*, uint32_t, uint32_t, uint32_t) { return FFX_OK; }
+FfxErrorCode ffxBrixelizerRawContextBuildAABBTree(FfxBrixelizerRawContext*, uint32_t) { return FFX_OK; }
+FfxErrorCode ffxBrixelizerRawContextDebugVisualization(FfxBrixelizerRawContext*, const FfxBrixelizerDebugVisualizationDescription*) { return FFX_OK; }
+FfxErrorCode ffxBrixelizerRawContextGetDebugCounters(FfxBrixelizerRawContext*, FfxBrixelizerDebugCounters*) { return FFX_OK; }
+FfxErrorCode ffxBrixelizerRawContextGetCascadeCounters(FfxBrixelizerRawContext*, uint32_t, FfxBrixelizerScratchCounters*) { return FFX_OK; }
+FfxErrorCode ffxBrixelizerRawContextFlushInstances(FfxBrixelizerRawContext*, FfxCommandList) { return FFX_OK; }
+FfxErrorCode ffxBrixelizerRawContextRegisterBuffers(FfxBrixelizerRawContext*, const FfxBrixelizerBufferDescription*, uint32_t) { return FFX_OK; }
+FfxErrorCode ffxBrixelizerRawContextUnregisterBuffers(FfxBrixelizerRawContext*, const uint32_t*, uint32_t) { return FFX_OK; }
+FfxErrorCode ffxBrixelizerRawContextRegisterScratchBuffer(FfxBrixelizerRawContext*, FfxResource) { return FFX_OK; }
@@ -0,0 +1,311 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// Replays camera paths through a CPU model of Brixelizer's cascades and reports how stale the cascades get and how much
+// work each update does when cascades are picked in the round robin order of ffxBrixelizerRawGetCascadeToUpdate and by
+// ffxBrixelizerRawGetCascadeToUpdateByCost. The simulation is deterministic, so both policies replay the same frames.
+//
+// Cascades are tracked the way ffxBrixelizerBakeUpdate tracks them: each keeps the clipmap offset of its last update,
+// and an update rebuilds the voxels the cascade scrolled into and those under the invalidations which built up since
+// (an instance created near the camera every few frames). Work is counted in rebuilt voxels, which is also the cost
+// estimate given to the scheduler, and staleness as how far, in its own voxels, each cascade trails the camera.
+//
+// Neither policy may leave a cascade without an update for longer than its round robin period, which is also checked
+// for the cost aware scheduler with random scores and any number of cascades.
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <FidelityFX/host/ffx_brixelizer_raw.h>
+#include "ffx_test.h"
+
+static const uint32_t s_cascadeCount   = 8;
+static const float    s_baseVoxelSize  = 0.2f;
+static const uint32_t s_frameCount     = 1200;
+static const float    s_frameTime      = 1.0f / 60.0f;
+static const int32_t  s_resolution     = FFX_BRIXELIZER_CASCADE_RESOLUTION;
+static const float    s_invalidationSize = 2.0f;  // in metres
+
+enum Policy
+{
+    POLICY_ROUND_ROBIN,
+    POLICY_COST_AWARE,
+};
+
+static const char* s_policyNames[] = { "round robin", "cost aware" };
+
+struct CameraPath
+{
+    const char* name;
+    float       speed;           // metres per second
+    float       turnRate;        // radians per second, 0 for a straight line
+    uint32_t    teleportPeriod;  // frames between jumps of 500 metres, 0 for none
+};
+
+struct Cascade
+{
+    float    voxelSize;
+    int32_t  lastUpdateOffset[3];
+    uint32_t lastUpdateFrame;
+    bool     hasBeenUpdated;
+    std::vector<float> pendingInvalidations;  // centres of invalidated regions, 3 floats each
+};
+
+struct SimulationResult
+{
+    double   meanNearLag;         // voxels cascade 0 trails the camera, averaged over frames
+    uint32_t maxNearLag;
+    double   meanFarLag;          // the same for the least detailed cascade
+    double   meanWork;            // voxels rebuilt per frame
+    uint64_t maxWork;
+    uint32_t maxOverdue;          // most frames any cascade went past its round robin period
+    uint64_t scheduleHash;        // order of updated cascades, to check the replay is deterministic
+};
+
+static uint32_t roundRobinPeriod(uint32_t cascadeIndex)
+{
+    return 1u << std::min(cascadeIndex + 1, s_cascadeCount - 1);
+}
+
+static void getCameraPosition(const CameraPath& path, uint32_t frame, float position[3])
+{
+    float time = float(frame) * s_frameTime;
+    if (path.turnRate > 0.0f)
+    {
+        float radius = path.speed / path.turnRate;
+        position[0]  = radius * std::cos(path.turnRate * time);
+        position[1]  = radius * std::sin(path.turnRate * time);
+    }
+    else
+    {
+        position[0] = path.speed * time;
+        position[1] = 0.3f * path.speed * time;
+    }
+    position[2] = 1.7f;
+    if (path.teleportPeriod)
+        position[0] += 500.0f * float(frame / path.teleportPeriod);
+}
+
+static void getClipmapOffset(const Cascade& cascade, const float position[3], int32_t offset[3])
+{
+    for (uint32_t i = 0; i < 3; ++i)
+        offset[i] = int32_t(std::floor(position[i] / cascade.voxelSize));
+}
+
+static uint32_t getLag(const int32_t from[3], const int32_t to[3])
+{
+    uint32_t lag = 0;
+    for (uint32_t i = 0; i < 3; ++i)
+        lag = std::max(lag, uint32_t(std::abs(to[i] - from[i])));
+    return lag;
+}
+
+// Voxels of the cascade at offset which lie outside the cascade at previousOffset
+static uint64_t getScrolledVoxels(const int32_t previousOffset[3], const int32_t offset[3])
+{
+    uint64_t kept = 1;
+    for (uint32_t i = 0; i < 3; ++i)
+        kept *= uint64_t(std::max(0, s_resolution - std::abs(offset[i] - previousOffset[i])));
+    return uint64_t(s_resolution) * s_resolution * s_resolution - kept;
+}
+
+static bool cascadeContains(const Cascade& cascade, const int32_t offset[3], const float* point)
+{
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        float cascadeMin = (float(offset[i]) - 0.5f * float(s_resolution)) * cascade.voxelSize;
+        if (point[i] < cascadeMin || point[i] > cascadeMin + float(s_resolution) * cascade.voxelSize)
+            return false;
+    }
+    return true;
+}
+
+static uint64_t getInvalidatedVoxels(const Cascade& cascade)
+{
+    uint64_t side = std::min<uint64_t>(s_resolution, uint64_t(std::ceil(s_invalidationSize / cascade.voxelSize)) + 1);
+    return uint64_t(cascade.pendingInvalidations.size() / 3) * side * side * side;
+}
+
+static SimulationResult simulate(const CameraPath& path, Policy policy)
+{
+    std::mt19937     random(1234);
+    Cascade          cascades[s_cascadeCount];
+    SimulationResult result = {};
+    uint64_t         totalWork = 0, totalNearLag = 0, totalFarLag = 0;
+
+    for (uint32_t i = 0; i < s_cascadeCount; ++i)
+    {
+        cascades[i]           = {};
+        cascades[i].voxelSize = s_baseVoxelSize * float(1u << i);
+    }
+
+    for (uint32_t frame = 0; frame < s_frameCount; ++frame)
+    {
+        float position[3];
+        getCameraPosition(path, frame, position);
+
+        int32_t offsets[s_cascadeCount][3];
+        for (uint32_t i = 0; i < s_cascadeCount; ++i)
+            getClipmapOffset(cascades[i], position, offsets[i]);
+
+        // an instance appears next to the camera every few frames, invalidating the cascades around it
+        if (random() % 8 == 0)
+        {
+            float point[3];
+            for (uint32_t i = 0; i < 3; ++i)
+                point[i] = position[i] + std::uniform_real_distribution<float>(-8.0f, 8.0f)(random);
+            for (uint32_t i = 0; i < s_cascadeCount; ++i)
+            {
+                if (cascadeContains(cascades[i], offsets[i], point))
+                    cascades[i].pendingInvalidations.insert(cascades[i].pendingInvalidations.end(), point, point + 3);
+            }
+        }
+
+        uint32_t cascadeIndex = 0;
+        if (policy == POLICY_ROUND_ROBIN)
+        {
+            cascadeIndex = ffxBrixelizerRawGetCascadeToUpdate(frame, s_cascadeCount);
+        }
+        else
+        {
+            FfxBrixelizerRawCascadeSchedulingInfo infos[s_cascadeCount] = {};
+            for (uint32_t i = 0; i < s_cascadeCount; ++i)
+            {
+                const Cascade& cascade = cascades[i];
+                if (!cascade.hasBeenUpdated)
+                {
+                    infos[i].framesSinceUpdate = UINT32_MAX;
+                    continue;
+                }
+                infos[i].displacement         = float(getLag(cascade.lastUpdateOffset, offsets[i]));
+                infos[i].pendingInvalidations = uint32_t(cascade.pendingInvalidations.size() / 3);
+                infos[i].framesSinceUpdate    = frame - cascade.lastUpdateFrame;
+                infos[i].estimatedCost        = uint32_t(getScrolledVoxels(cascade.lastUpdateOffset, offsets[i]) + getInvalidatedVoxels(cascade));
+            }
+            // the budget lets an update rebuild an 8 voxel deep slab of a cascade
+            cascadeIndex = ffxBrixelizerRawGetCascadeToUpdateByCost(infos, s_cascadeCount, 8 * s_resolution * s_resolution);
+        }
+        FFX_TEST_CHECK(cascadeIndex < s_cascadeCount);
+
+        // first updates build every voxel under either policy, so they are left out of the work
+        Cascade& cascade = cascades[cascadeIndex];
+        uint64_t work    = cascade.hasBeenUpdated ? getScrolledVoxels(cascade.lastUpdateOffset, offsets[cascadeIndex]) + getInvalidatedVoxels(cascade) : 0;
+        if (cascade.hasBeenUpdated)
+        {
+            uint32_t framesSinceUpdate = frame - cascade.lastUpdateFrame;
+            uint32_t period            = roundRobinPeriod(cascadeIndex);
+            result.maxOverdue          = std::max(result.maxOverdue, framesSinceUpdate > period ? framesSinceUpdate - period : 0);
+        }
+        std::copy(offsets[cascadeIndex], offsets[cascadeIndex] + 3, cascade.lastUpdateOffset);
+        cascade.lastUpdateFrame = frame;
+        cascade.hasBeenUpdated  = true;
+        cascade.pendingInvalidations.clear();
+        result.scheduleHash = result.scheduleHash * 31 + cascadeIndex;
+
+        // cascades which are waiting for an update count as overdue too
+        for (uint32_t i = 0; i < s_cascadeCount; ++i)
+        {
+            uint32_t framesSinceUpdate = frame - cascades[i].lastUpdateFrame;
+            if (cascades[i].hasBeenUpdated && framesSinceUpdate > roundRobinPeriod(i))
+                result.maxOverdue = std::max(result.maxOverdue, framesSinceUpdate - roundRobinPeriod(i));
+        }
+
+        // staleness is measured once all cascades have been built
+        if (frame >= s_cascadeCount)
+        {
+            uint32_t nearLag = getLag(cascades[0].lastUpdateOffset, offsets[0]);
+            totalNearLag += nearLag;
+            totalFarLag += getLag(cascades[s_cascadeCount - 1].lastUpdateOffset, offsets[s_cascadeCount - 1]);
+            result.maxNearLag = std::max(result.maxNearLag, nearLag);
+            totalWork += work;
+            result.maxWork = std::max(result.maxWork, work);
+        }
+    }
+
+    const double measuredFrames = double(s_frameCount - s_cascadeCount);
+    result.meanNearLag          = double(totalNearLag) / measuredFrames;
+    result.meanFarLag           = double(totalFarLag) / measuredFrames;
+    result.meanWork             = double(totalWork) / measuredFrames;
+    return result;
+}
+
+// Whatever the scores, and for any number of cascades, the scheduler keeps every cascade within its round robin period
+static void testRandomScores()
+{
+    for (uint32_t cascadeCount = 1; cascadeCount <= 12; ++cascadeCount)
+    {
+        std::mt19937 random(cascadeCount);
+        uint32_t     lastUpdateFrames[12] = {};
+        bool         updated[12]          = {};
+
+        for (uint32_t frame = 0; frame < 100000; ++frame)
+        {
+            FfxBrixelizerRawCascadeSchedulingInfo infos[12] = {};
+            for (uint32_t i = 0; i < cascadeCount; ++i)
+            {
+                infos[i].displacement         = float(random() % 64);
+                infos[i].pendingInvalidations = random() % 4;
+                infos[i].framesSinceUpdate    = updated[i] ? frame - lastUpdateFrames[i] : UINT32_MAX;
+                infos[i].estimatedCost        = random() % 100;
+            }
+            uint32_t cascadeIndex = ffxBrixelizerRawGetCascadeToUpdateByCost(infos, cascadeCount, random() % 2 ? 50 : 0);
+            FFX_TEST_CHECK(cascadeIndex < cascadeCount);
+            lastUpdateFrames[cascadeIndex] = frame;
+            updated[cascadeIndex]          = true;
+
+            for (uint32_t i = 0; i < cascadeCount; ++i)
+                FFX_TEST_CHECK(!updated[i] || frame - lastUpdateFrames[i] <= (1u << std::min(i + 1, cascadeCount - 1)));
+        }
+    }
+}
+
+int main()
+{
+    const CameraPath paths[] = {
+        { "still", 0.0f, 0.0f, 0 },
+        { "walk", 1.5f, 0.0f, 0 },
+        { "sprint", 6.0f, 0.0f, 0 },
+        { "orbit", 6.0f, 1.0f, 0 },
+        { "vehicle", 30.0f, 0.0f, 0 },
+        { "teleport", 1.5f, 0.0f, 240 },
+    };
+
+    printf("%-9s %-12s %10s %10s %10s %12s %12s %8s\n", "path", "policy", "near lag", "near max", "far lag", "voxels/frame", "max voxels", "overdue");
+    for (const CameraPath& path : paths)
+    {
+        for (uint32_t policy = POLICY_ROUND_ROBIN; policy <= POLICY_COST_AWARE; ++policy)
+        {
+            const SimulationResult result = simulate(path, Policy(policy));
+            printf("%-9s %-12s %10.2f %10u %10.2f %12.0f %12llu %8u\n", path.name, s_policyNames[policy], result.meanNearLag, result.maxNearLag,
+                   result.meanFarLag, result.meanWork, (unsigned long long)result.maxWork, result.maxOverdue);
+
+            // the replay is deterministic, and no cascade waits longer than its round robin period
+            FFX_TEST_CHECK(simulate(path, Policy(policy)).scheduleHash == result.scheduleHash);
+            FFX_TEST_CHECK(result.maxOverdue == 0);
+        }
+    }
+
+    testRandomScores();
+
+    return FFX_TEST_RESULT();
+}
@@ -0,0 +1,228 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Stress test for FfxConstantRing, the fallback constant buffer suballocator of the DX12 and Vulkan backends.
+//
+// Every effect context records on its own thread against a simulated GPU timeline: a frame is complete once its
+// context has ended FFX_MAX_QUEUED_FRAMES further frames, or once the backend waited for the GPU after running out
+// of blocks. Each alignment unit of the ring remembers the context and frame that last wrote it, so any allocation
+// overlapping constants that may still be in flight is caught, independently of the ring's own bookkeeping.
+
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <ffx_constant_ring.h>
+#include "ffx_test.h"
+
+static const uint64_t s_alignment = 256;
+static const uint64_t s_minBlockSize = FFX_BUFFER_SIZE * FfxConstantRing::MIN_BLOCKS_PER_CONTEXT_FRAME;
+
+class SimulatedTimeline
+{
+public:
+    SimulatedTimeline(uint32_t contextCount, uint64_t capacity)
+        : m_endedFrames(contextCount)
+        , m_retiredFrames(contextCount)
+        , m_unitOwners(size_t(capacity / s_alignment))
+    {
+    }
+
+    // Owners pack the frame with the context biased by one, 0 means never written
+    static uint64_t makeOwner(uint32_t context, uint64_t frame)
+    {
+        return (frame << 16) | (context + 1);
+    }
+
+    uint64_t currentFrame(uint32_t context) const
+    {
+        return m_endedFrames[context].load();
+    }
+
+    // The timeline advances before the ring is told, so it never considers a frame complete later than the ring does
+    void endFrame(FfxConstantRing& ring, uint32_t context)
+    {
+        m_endedFrames[context].fetch_add(1);
+        ring.endFrame(context);
+    }
+
+    void waitForGpu(FfxConstantRing& ring)
+    {
+        for (size_t i = 0; i < m_endedFrames.size(); ++i)
+        {
+            uint64_t ended   = m_endedFrames[i].load();
+            uint64_t retired = m_retiredFrames[i].load();
+            while (retired < ended && !m_retiredFrames[i].compare_exchange_weak(retired, ended))
+                ;
+        }
+        ring.retireSubmittedFrames();
+    }
+
+    // Takes ownership of [offset, offset + size) and returns false if any of it may still be read by the GPU
+    bool claim(uint32_t context, uint64_t offset, uint64_t size)
+    {
+        const uint64_t owner = makeOwner(context, currentFrame(context));
+        bool           valid = (offset % s_alignment) == 0 && offset + size <= m_unitOwners.size() * s_alignment;
+        for (uint64_t unit = offset / s_alignment; valid && unit < (offset + size) / s_alignment; ++unit)
+        {
+            const uint64_t previous = m_unitOwners[unit].exchange(owner);
+            valid = previous == 0 || (previous != owner && isComplete(previous));
+        }
+        return valid;
+    }
+
+private:
+    bool isComplete(uint64_t owner) const
+    {
+        const uint32_t context = uint32_t(owner & 0xffff) - 1;
+        const uint64_t frame   = owner >> 16;
+        return frame + FFX_MAX_QUEUED_FRAMES <= m_endedFrames[context].load() || frame < m_retiredFrames[context].load();
+    }
+
+    std::vector<std::atomic<uint64_t>> m_endedFrames;
+    std::vector<std::atomic<uint64_t>> m_retiredFrames;
+    std::vector<std::atomic<uint64_t>> m_unitOwners;
+};
+
+// A single context taking a whole block per frame cycles through the blocks without stalling as long as there are
+// as many blocks as queued frames, and otherwise first runs out once every block has been written.
+static void testExhaustion(uint32_t blockCount)
+{
+    const uint64_t capacity = blockCount * s_minBlockSize;
+    std::vector<uint8_t> contextMemory(FfxConstantRing::getContextMemorySize(1));
+    FfxConstantRing*     ring = new FfxConstantRing();
+    ring->initialize(capacity, s_alignment, 1, contextMemory.data());
+    SimulatedTimeline timeline(1, capacity);
+
+    FfxConstantRingStatistics statistics;
+    ring->getStatistics(&statistics);
+    FFX_TEST_CHECK(statistics.blockCount == blockCount);
+    FFX_TEST_CHECK(statistics.blockSizeInBytes == s_minBlockSize);
+
+    uint32_t stalls     = 0;
+    uint32_t firstStall = 0;
+    for (uint32_t frame = 0; frame < 4 * FFX_MAX_QUEUED_FRAMES * blockCount; ++frame)
+    {
+        uint64_t offset = ring->allocate(0, statistics.blockSizeInBytes);
+        if (offset == FFX_CONSTANT_RING_INVALID_OFFSET)
+        {
+            firstStall = stalls++ ? firstStall : frame;
+            timeline.waitForGpu(*ring);
+            offset = ring->allocate(0, statistics.blockSizeInBytes);
+        }
+        FFX_TEST_CHECK(offset != FFX_CONSTANT_RING_INVALID_OFFSET && timeline.claim(0, offset, statistics.blockSizeInBytes));
+        timeline.endFrame(*ring, 0);
+    }
+
+    ring->getStatistics(&statistics);
+    FFX_TEST_CHECK(statistics.stallCount == stalls);
+    FFX_TEST_CHECK(statistics.failedAllocationCount == stalls);
+    FFX_TEST_CHECK(statistics.allocationCount == 4 * FFX_MAX_QUEUED_FRAMES * blockCount);
+    FFX_TEST_CHECK((stalls > 0) == (blockCount < FFX_MAX_QUEUED_FRAMES));
+    FFX_TEST_CHECK(stalls == 0 || firstStall == blockCount);
+    delete ring;
+}
+
+// Many contexts record frames with random constant buffer sizes concurrently, waiting for the GPU whenever the ring
+// runs out of retired blocks.
+static void testConcurrentContexts(uint32_t contextCount, uint32_t blocksPerContext, uint32_t frameCount)
+{
+    const uint64_t capacity = uint64_t(contextCount) * blocksPerContext * s_minBlockSize;
+    std::vector<uint8_t> contextMemory(FfxConstantRing::getContextMemorySize(contextCount));
+    FfxConstantRing*     ring = new FfxConstantRing();
+    ring->initialize(capacity, s_alignment, contextCount, contextMemory.data());
+    SimulatedTimeline timeline(contextCount, capacity);
+
+    std::atomic<uint64_t> allocations(0);
+    std::atomic<uint64_t> failedAllocations(0);
+    std::atomic<uint64_t> stalls(0);
+    std::atomic<uint64_t> overlaps(0);
+
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> threads;
+    for (uint32_t context = 0; context < contextCount; ++context)
+    {
+        threads.emplace_back([&, context]() {
+            std::mt19937 random(context);
+            for (uint32_t frame = 0; frame < frameCount; ++frame)
+            {
+                // at most a block per frame, so a context never holds more than two blocks of its current frame
+                const uint32_t passCount = FfxConstantRing::MIN_BLOCKS_PER_CONTEXT_FRAME / 2 + random() % (FfxConstantRing::MIN_BLOCKS_PER_CONTEXT_FRAME / 2 + 1);
+                for (uint32_t pass = 0; pass < passCount; ++pass)
+                {
+                    const uint64_t size   = 1 + random() % FFX_BUFFER_SIZE;
+                    uint64_t       offset = ring->allocate(context, size);
+                    while (offset == FFX_CONSTANT_RING_INVALID_OFFSET)
+                    {
+                        failedAllocations.fetch_add(1);
+                        stalls.fetch_add(1);
+                        timeline.waitForGpu(*ring);
+                        std::this_thread::yield();
+                        offset = ring->allocate(context, size);
+                    }
+                    allocations.fetch_add(1);
+                    if (!timeline.claim(context, offset, FFX_ALIGN_UP(size, s_alignment)))
+                        overlaps.fetch_add(1);
+                }
+                timeline.endFrame(*ring, context);
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    FfxConstantRingStatistics statistics;
+    ring->getStatistics(&statistics);
+    FFX_TEST_CHECK(overlaps.load() == 0);
+    FFX_TEST_CHECK(statistics.allocationCount == allocations.load());
+    FFX_TEST_CHECK(statistics.failedAllocationCount == failedAllocations.load());
+    FFX_TEST_CHECK(statistics.stallCount == stalls.load());
+    FFX_TEST_CHECK(statistics.blocksInFlight <= statistics.blockCount);
+
+    printf("%u contexts, %u blocks per context: %llu allocations, %llu stalls, %.1f M allocations/s\n",
+           contextCount,
+           blocksPerContext,
+           (unsigned long long)allocations.load(),
+           (unsigned long long)stalls.load(),
+           allocations.load() / seconds * 1e-6);
+    delete ring;
+}
+
+int main()
+{
+    testExhaustion(FFX_MAX_QUEUED_FRAMES - 1);
+    testExhaustion(FFX_MAX_QUEUED_FRAMES);
+    testExhaustion(3 * FFX_MAX_QUEUED_FRAMES);
+
+    const uint32_t threadCount = FFX_MAXIMUM(std::thread::hardware_concurrency(), 4u);
+    // two blocks per context is the least that guarantees progress
+    testConcurrentContexts(threadCount, 2, 4000);
+    testConcurrentContexts(threadCount, 4, 4000);
+    testConcurrentContexts(threadCount, 64, 4000);
+
+    return FFX_TEST_RESULT();
+}
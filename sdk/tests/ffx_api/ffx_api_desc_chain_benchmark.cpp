@@ -0,0 +1,132 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// Compares decoding a descriptor chain once with DescChain (ffx-api/src/ffx_desc_chain.h) with what the entry points
+// did before: walking the pNext chain again for each extension struct they look for, comparing types as
+// ffx::DynamicCast does. Context creation looks for three structs (the version override, the backend and the shared
+// backend desc), which are placed at the end of chains of unknown headers, so every walk runs the whole chain.
+//
+// Both have to find the same structs.
+
+#include <chrono>
+
+#include <ffx_desc_chain.h>
+#include "ffx_test.h"
+
+static const uint32_t s_decodeCount    = 200000;
+static const uint32_t s_roundCount     = 10;
+static const uint32_t s_chainLengths[] = {1, 2, 4, 8, 16, 32};
+
+static volatile uintptr_t s_sink = 0;
+
+// The lookup before DescChain, one walk per struct
+template<class T>
+static const T* findInChain(const ffxApiHeader* root)
+{
+    for (const ffxApiHeader* it = root; it; it = it->pNext)
+    {
+        if (const T* desc = ffx::DynamicCast<T>(it))
+            return desc;
+    }
+    return nullptr;
+}
+
+static uintptr_t lookUpByWalks(const ffxApiHeader* root)
+{
+    return uintptr_t(findInChain<ffxOverrideVersion>(root)) ^ uintptr_t(findInChain<ffxCreateContextDescSharedBackend>(root)) ^
+           uintptr_t(findInChain<ffxCreateContextDescFrameGenerationHudless>(root));
+}
+
+static uintptr_t readDecodedChain(const DescChain& chain)
+{
+    return uintptr_t(chain.Get<ffxOverrideVersion>()) ^ uintptr_t(chain.Get<ffxCreateContextDescSharedBackend>()) ^
+           uintptr_t(chain.Get<ffxCreateContextDescFrameGenerationHudless>());
+}
+
+// The entry points hand the decoded chain to functions in other translation units (GetDevice, CreateBackend), so
+// the decode can't be optimized down to the lookups. A call through a volatile pointer keeps that so here.
+static uintptr_t (*volatile s_readDecodedChain)(const DescChain&) = readDecodedChain;
+
+static uintptr_t lookUpByDecode(const ffxApiHeader* root)
+{
+    const DescChain chain{root};
+    return s_readDecodedChain(chain);
+}
+
+// Fastest of a few rounds, the decodes take nanoseconds and are easily disturbed
+template<typename LookUp>
+static double measure(const ffxApiHeader* root, LookUp lookUp)
+{
+    double fastest = 0.0;
+    for (uint32_t round = 0; round < s_roundCount; ++round)
+    {
+        const auto start = std::chrono::high_resolution_clock::now();
+        for (uint32_t i = 0; i < s_decodeCount; ++i)
+            s_sink = s_sink + lookUp(root);
+        const auto   end         = std::chrono::high_resolution_clock::now();
+        const double nanoseconds = std::chrono::duration<double, std::nano>(end - start).count() / s_decodeCount;
+        fastest                  = round == 0 || nanoseconds < fastest ? nanoseconds : fastest;
+    }
+    return fastest;
+}
+
+int main()
+{
+    ffxOverrideVersion                         overrideVersion = {};
+    ffxCreateContextDescSharedBackend          sharedBackend   = {};
+    ffxCreateContextDescFrameGenerationHudless hudless         = {};
+    overrideVersion.header.type = FFX_API_DESC_TYPE_OVERRIDE_VERSION;
+    sharedBackend.header.type   = FFX_API_CREATE_CONTEXT_DESC_TYPE_SHARED_BACKEND;
+    hudless.header.type         = FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATION_HUDLESS;
+
+    ffxApiHeader unknown[DescChain::MaxLength] = {};
+
+    printf("fastest of %u rounds of %u decodes, ns per decode with 3 lookups\n", s_roundCount, s_decodeCount);
+    printf("%8s %12s %12s\n", "length", "walks", "DescChain");
+
+    for (uint32_t length : s_chainLengths)
+    {
+        // unknown headers, then the three structs at the end of the chain
+        ffxApiHeader* known[] = {&overrideVersion.header, &sharedBackend.header, &hudless.header};
+        const uint32_t knownCount   = length < 3 ? length : 3;
+        const uint32_t unknownCount = length - knownCount;
+
+        ffxApiHeader* root = nullptr;
+        for (uint32_t index = knownCount; index-- > 0;)
+        {
+            known[index]->pNext = root;
+            root                = known[index];
+        }
+        for (uint32_t index = 0; index < unknownCount; ++index)
+        {
+            unknown[index].type  = 0x7fff0000u + index;
+            unknown[index].pNext = root;
+            root                 = &unknown[index];
+        }
+
+        FFX_TEST_CHECK(DescChain{root}.Length() == length && !DescChain{root}.IsTruncated());
+        FFX_TEST_CHECK(lookUpByWalks(root) == lookUpByDecode(root));
+
+        printf("%8u %12.1f %12.1f\n", length, measure(root, lookUpByWalks), measure(root, lookUpByDecode));
+    }
+
+    return FFX_TEST_RESULT();
+}
@@ -0,0 +1,149 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// Fuzzes DescChain (ffx-api/src/ffx_desc_chain.h) with malformed descriptor chains: random mixes of known, unknown
+// and repeated types, linked into chains that end early, run past MaxLength, or link back into themselves at any
+// point. Each decode is compared with a plain walk of the chain that stops after MaxLength headers.
+//
+// The decoder must never read past MaxLength headers, must report a chain as truncated exactly when the walk has a
+// header left, and must put the first occurrence of each known type in its slot.
+
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include <ffx_desc_chain.h>
+#include "ffx_test.h"
+
+static const uint32_t s_iterations = 20000;
+
+// Types a fuzzed header is drawn from: every type with a slot, and types the decoder doesn't know
+static const uint64_t s_types[] = {
+    FFX_API_DESC_TYPE_OVERRIDE_VERSION,
+    FFX_API_CREATE_CONTEXT_DESC_TYPE_SHARED_BACKEND,
+    FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATION_HUDLESS,
+    FFX_API_CONFIGURE_DESC_TYPE_FRAMEGENERATION_REGISTERDISTORTIONRESOURCE,
+    FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATION,
+    FFX_API_QUERY_DESC_TYPE_GET_VERSIONS,
+    0,
+    ~0ull,
+};
+
+// Checks a decode against a walk of the chain from root
+static void checkDecode(const ffxApiHeader* root)
+{
+    const DescChain chain{root};
+
+    std::vector<const ffxApiHeader*> walked;
+    const ffxApiHeader*              it = root;
+    for (; it && walked.size() < DescChain::MaxLength; it = it->pNext)
+        walked.push_back(it);
+
+    FFX_TEST_CHECK(chain.Length() == walked.size());
+    FFX_TEST_CHECK(chain.IsTruncated() == (it != nullptr));
+    FFX_TEST_CHECK(chain.Root() == (walked.empty() ? nullptr : walked[0]));
+
+    for (uint32_t index = 0; index < chain.Length() && index < walked.size(); ++index)
+        FFX_TEST_CHECK(chain[index] == walked[index]);
+
+    for (uint32_t slot = 0; slot < uint32_t(DescSlot::Count); ++slot)
+    {
+        const ffxApiHeader* first = nullptr;
+        uint32_t            count = 0;
+        for (const ffxApiHeader* header : walked)
+        {
+            if (GetDescSlot(header->type) == DescSlot(slot))
+            {
+                first = count ? first : header;
+                ++count;
+            }
+        }
+        FFX_TEST_CHECK(chain.Get(DescSlot(slot)) == first);
+        FFX_TEST_CHECK(chain.Count(DescSlot(slot)) == count);
+    }
+}
+
+static void testEdgeCases()
+{
+    checkDecode(nullptr);
+
+    ffxApiHeader headers[DescChain::MaxLength + 1] = {};
+
+    // a header linked to itself
+    headers[0].type  = FFX_API_DESC_TYPE_OVERRIDE_VERSION;
+    headers[0].pNext = &headers[0];
+    checkDecode(&headers[0]);
+    {
+        const DescChain chain{&headers[0]};
+        FFX_TEST_CHECK(chain.IsTruncated() && chain.Count(DescSlot::OverrideVersion) == DescChain::MaxLength);
+        FFX_TEST_CHECK(chain.Get<ffxOverrideVersion>() == reinterpret_cast<const ffxOverrideVersion*>(&headers[0]));
+    }
+
+    // chains of exactly MaxLength headers are complete, one more is cut short
+    for (uint32_t index = 0; index < DescChain::MaxLength + 1; ++index)
+    {
+        headers[index].type  = s_types[index % std::size(s_types)];
+        headers[index].pNext = index < DescChain::MaxLength ? &headers[index + 1] : nullptr;
+    }
+    checkDecode(&headers[1]);
+    FFX_TEST_CHECK(!DescChain{&headers[1]}.IsTruncated());
+    checkDecode(&headers[0]);
+    FFX_TEST_CHECK(DescChain{&headers[0]}.IsTruncated());
+
+    // a cycle back to the root after a few headers
+    headers[3].pNext = &headers[0];
+    checkDecode(&headers[0]);
+    FFX_TEST_CHECK(DescChain{&headers[0]}.IsTruncated());
+}
+
+static void testRandomChains()
+{
+    std::mt19937 random(20);
+
+    ffxApiHeader headers[2 * DescChain::MaxLength];
+    for (uint32_t iteration = 0; iteration < s_iterations; ++iteration)
+    {
+        const uint32_t headerCount = 1 + random() % std::size(headers);
+        for (uint32_t index = 0; index < headerCount; ++index)
+        {
+            headers[index].type = s_types[random() % std::size(s_types)];
+
+            // mostly a forward list, with early ends and links back to any header, itself included
+            const uint32_t link = random() % 16;
+            if (link == 0 || index + 1 == headerCount)
+                headers[index].pNext = link < 8 ? nullptr : &headers[random() % headerCount];
+            else if (link == 1)
+                headers[index].pNext = &headers[random() % (index + 1)];
+            else
+                headers[index].pNext = &headers[index + 1];
+        }
+
+        checkDecode(&headers[random() % headerCount]);
+    }
+}
+
+int main()
+{
+    testEdgeCases();
+    testRandomChains();
+
+    return FFX_TEST_RESULT();
+}
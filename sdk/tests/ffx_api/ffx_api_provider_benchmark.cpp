@@ -0,0 +1,186 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// Measures what the ffx-api entry points (ffx-api/src/ffx_api.cpp) add to a call into a provider, with mock providers
+// standing in for the effects: the providers of ffx_provider.cpp are defined here to count their calls and do nothing
+// else, so the timings are those of the entry points, the descriptor chain decoding and the provider lookup.
+//
+// Dispatch, configure and queries on a context reach the provider through the context header. Context-less queries
+// and context creation look the provider up by descriptor type, in the cache of GetffxProvider, which is compared with
+// the scan of every provider with CanProvide that the lookup did before the cache.
+//
+// Each descriptor type must resolve to the provider which would have been found without the cache.
+
+#include <chrono>
+
+#include <ffx_api/ffx_upscale.h>
+#include <ffx_api/ffx_framegeneration.h>
+#include <ffx_provider_fsr2.h>
+#include <ffx_provider_fsr3upscale.h>
+#include <ffx_provider_framegeneration.h>
+#include <backends.h>
+#include "ffx_test.h"
+
+static const uint32_t s_callCount = 1000000;
+
+static uint64_t s_providerCalls = 0;
+
+// A provider which serves every descriptor of one effect and counts the calls it gets.
+#define FFX_TEST_MOCK_PROVIDER(ProviderClass, effectId, id)                                                                  \
+    ProviderClass ProviderClass::Instance;                                                                                  \
+    bool ProviderClass::CanProvide(uint64_t type) const { return (type & FFX_API_EFFECT_MASK) == effectId; }               \
+    uint64_t ProviderClass::GetId() const { return id; }                                                                    \
+    const char* ProviderClass::GetVersionName() const { return #ProviderClass; }                                            \
+    ffxReturnCode_t ProviderClass::CreateContext(ffxContext* context, ffxCreateContextDescHeader*, Allocator& alloc) const  \
+    {                                                                                                                       \
+        InternalContextHeader* header = alloc.construct<InternalContextHeader>();                                           \
+        VERIFY(header, FFX_API_RETURN_ERROR_MEMORY);                                                                        \
+        header->provider = this;                                                                                            \
+        *context         = header;                                                                                          \
+        return FFX_API_RETURN_OK;                                                                                           \
+    }                                                                                                                       \
+    ffxReturnCode_t ProviderClass::DestroyContext(ffxContext* context, Allocator& alloc) const                              \
+    {                                                                                                                       \
+        alloc.dealloc(*context);                                                                                            \
+        *context = nullptr;                                                                                                 \
+        return FFX_API_RETURN_OK;                                                                                           \
+    }                                                                                                                       \
+    ffxReturnCode_t ProviderClass::Configure(ffxContext*, const ffxConfigureDescHeader*) const                              \
+    {                                                                                                                       \
+        ++s_providerCalls;                                                                                                  \
+        return FFX_API_RETURN_OK;                                                                                           \
+    }                                                                                                                       \
+    ffxReturnCode_t ProviderClass::Query(ffxContext*, ffxQueryDescHeader*) const                                            \
+    {                                                                                                                       \
+        ++s_providerCalls;                                                                                                  \
+        return FFX_API_RETURN_OK;                                                                                           \
+    }                                                                                                                       \
+    ffxReturnCode_t ProviderClass::Dispatch(ffxContext*, const ffxDispatchDescHeader*) const                                \
+    {                                                                                                                       \
+        ++s_providerCalls;                                                                                                  \
+        return FFX_API_RETURN_OK;                                                                                           \
+    }
+
+FFX_TEST_MOCK_PROVIDER(ffxProvider_FSR3Upscale, FFX_API_EFFECT_ID_UPSCALE, 1)
+FFX_TEST_MOCK_PROVIDER(ffxProvider_FSR2, FFX_API_EFFECT_ID_UPSCALE, 2)
+FFX_TEST_MOCK_PROVIDER(ffxProvider_FrameGeneration, FFX_API_EFFECT_ID_FRAMEGENERATION, 3)
+
+// backends.cpp, which creates real backends, is not linked. Lookups are only cached once a device has been seen, but
+// this one is never used: the driver extension is only created from it when the driver's module is loaded, which takes
+// a D3D12 device this process doesn't create.
+static int s_device = 0;
+
+void* GetDevice(const DescChain&)
+{
+    return &s_device;
+}
+
+// The providers in the order of ffx_provider.cpp
+static const ffxProvider* s_providers[] = {
+    &ffxProvider_FSR3Upscale::Instance,
+    &ffxProvider_FSR2::Instance,
+    &ffxProvider_FrameGeneration::Instance,
+};
+
+// The lookup of GetffxProvider before the cache: a scan with CanProvide on every call
+static const ffxProvider* findProviderUncached(ffxStructType_t descType, uint64_t overrideId)
+{
+    for (const ffxProvider* provider : s_providers)
+    {
+        if (provider->GetId() == overrideId || (overrideId == 0 && provider->CanProvide(descType)))
+            return provider;
+    }
+    return nullptr;
+}
+
+template<typename Call>
+static double measure(Call call)
+{
+    const auto start = std::chrono::high_resolution_clock::now();
+    for (uint32_t i = 0; i < s_callCount; ++i)
+        call();
+    const auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / s_callCount;
+}
+
+int main()
+{
+    // lookups resolve as they did without the cache, including with a version override
+    ffxOverrideVersion override = {};
+    override.header.type        = FFX_API_DESC_TYPE_OVERRIDE_VERSION;
+    override.versionId          = ffxProvider_FSR2::Instance.GetId();
+
+    const ffxStructType_t types[] = { FFX_API_CREATE_CONTEXT_DESC_TYPE_UPSCALE, FFX_API_QUERY_DESC_TYPE_UPSCALE_GETJITTEROFFSET,
+                                      FFX_API_CREATE_CONTEXT_DESC_TYPE_FRAMEGENERATION, 0x7fff0000u };
+    for (uint32_t repeat = 0; repeat < 2; ++repeat)
+    {
+        for (ffxStructType_t type : types)
+        {
+            FFX_TEST_CHECK(GetffxProvider(type, 0, &s_device) == findProviderUncached(type, 0));
+            FFX_TEST_CHECK(GetffxProvider(type, override.versionId, &s_device) == findProviderUncached(type, override.versionId));
+        }
+    }
+    FFX_TEST_CHECK(GetffxProvider(FFX_API_CREATE_CONTEXT_DESC_TYPE_UPSCALE, 0, &s_device) == &ffxProvider_FSR3Upscale::Instance);
+    FFX_TEST_CHECK(GetffxProvider(FFX_API_CREATE_CONTEXT_DESC_TYPE_UPSCALE, override.versionId, &s_device) == &ffxProvider_FSR2::Instance);
+
+    ffxCreateContextDescHeader createDesc = {};
+    createDesc.type                       = FFX_API_CREATE_CONTEXT_DESC_TYPE_UPSCALE;
+    ffxContext context                    = nullptr;
+    FFX_TEST_CHECK(ffxCreateContext(&context, &createDesc, nullptr) == FFX_API_RETURN_OK);
+    FFX_TEST_CHECK(GetAssociatedProvider(&context) == &ffxProvider_FSR3Upscale::Instance);
+
+    ffxDispatchDescHeader dispatchDesc = {};
+    dispatchDesc.type                  = FFX_API_DISPATCH_DESC_TYPE_UPSCALE;
+    ffxConfigureDescHeader configureDesc = {};
+    configureDesc.type                   = FFX_API_CONFIGURE_DESC_TYPE_UPSCALE_KEYVALUE;
+    ffxQueryDescHeader queryDesc = {};
+    queryDesc.type               = FFX_API_QUERY_DESC_TYPE_UPSCALE_GETJITTEROFFSET;
+    ffxQueryDescHeader overrideQueryDesc = {};
+    overrideQueryDesc.type               = FFX_API_QUERY_DESC_TYPE_UPSCALE_GETJITTEROFFSET;
+    overrideQueryDesc.pNext              = &override.header;
+    const ffxProvider* provider          = &ffxProvider_FSR3Upscale::Instance;
+
+    s_providerCalls = 0;
+    printf("%u calls each, ns per call\n", s_callCount);
+    printf("%-34s %10s\n", "call", "ns");
+    printf("%-34s %10.1f\n", "provider Dispatch, direct", measure([&]() { provider->Dispatch(&context, &dispatchDesc); }));
+    printf("%-34s %10.1f\n", "ffxDispatch", measure([&]() { ffxDispatch(&context, &dispatchDesc); }));
+    printf("%-34s %10.1f\n", "ffxConfigure", measure([&]() { ffxConfigure(&context, &configureDesc); }));
+    printf("%-34s %10.1f\n", "ffxQuery, context", measure([&]() { ffxQuery(&context, &queryDesc); }));
+    printf("%-34s %10.1f\n", "ffxQuery, no context, uncached", measure([&]() {
+        // as ffxQuery does it, but with the uncached lookup
+        const DescChain           chain{&queryDesc};
+        const ffxOverrideVersion* versionDesc = chain.Get<ffxOverrideVersion>();
+        findProviderUncached(queryDesc.type, versionDesc ? versionDesc->versionId : 0)->Query(nullptr, &queryDesc);
+    }));
+    printf("%-34s %10.1f\n", "ffxQuery, no context", measure([&]() { ffxQuery(nullptr, &queryDesc); }));
+    printf("%-34s %10.1f\n", "ffxQuery, no context, override", measure([&]() { ffxQuery(nullptr, &overrideQueryDesc); }));
+    FFX_TEST_CHECK(s_providerCalls == 7ull * s_callCount);
+
+    printf("%-34s %10.1f\n", "ffxCreateContext + ffxDestroyContext", measure([&]() {
+        ffxContext measuredContext = nullptr;
+        ffxCreateContext(&measuredContext, &createDesc, nullptr);
+        ffxDestroyContext(&measuredContext, nullptr);
+    }));
+
+    FFX_TEST_CHECK(ffxDestroyContext(&context, nullptr) == FFX_API_RETURN_OK);
+    return FFX_TEST_RESULT();
+}
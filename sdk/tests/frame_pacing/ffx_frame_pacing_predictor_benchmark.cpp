@@ -0,0 +1,139 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// Replays frame time traces through the frame interpolation pacing with each of the frame time predictors of
+// FfxFramePacer, and compares how evenly they pace the presents and how much latency they add to real frames. The
+// pacing runs in the simulator of ffx_frame_pacing_simulator.h with a spinning wait, so the comparison is exact and
+// only the predictions differ. Also measures what an update of each predictor costs.
+//
+// The synthetic traces are replayed by default, and the strengths and weaknesses the predictors are documented with are
+// checked on them. Recorded traces, one frame time in milliseconds per line, can be passed on the command line instead.
+
+#include <chrono>
+#include <string>
+
+#include <FidelityFX/host/ffx_util.h>
+
+#include "frame_pacing/ffx_frame_pacing_simulator.h"
+#include "ffx_test.h"
+
+static const uint32_t s_frameCount  = 2000;
+static const uint32_t s_updateCount = 1000000;
+
+static const FfxSwapchainFrameTimePredictor s_predictors[] = {
+    FFX_SWAPCHAIN_FRAMETIME_PREDICTOR_MOVING_AVERAGE,
+    FFX_SWAPCHAIN_FRAMETIME_PREDICTOR_EXPONENTIAL_AVERAGE,
+    FFX_SWAPCHAIN_FRAMETIME_PREDICTOR_MEDIAN,
+    FFX_SWAPCHAIN_FRAMETIME_PREDICTOR_PERCENTILE,
+};
+
+static const char* s_predictorNames[] = { "moving average", "exponential", "median", "percentile" };
+
+static FfxFramePacingSimulationResult replay(const std::vector<double>& frameTimesInMs, FfxSwapchainFrameTimePredictor predictor)
+{
+    FfxFramePacingSimulationConfig config;
+    config.predictor = predictor;
+    return FfxFramePacingSimulator(config).run(frameTimesInMs);
+}
+
+// nanoseconds per FfxFramePacer::update, over frame times alternating like those of the alternating trace
+static double measureUpdate(FfxSwapchainFrameTimePredictor predictor)
+{
+    const int64_t frequency = FfxFramePacingSimulator::frequency;
+    FfxFramePacer pacer{};
+    int64_t       count = 0;
+    int64_t       sum   = 0;
+
+    const auto start = std::chrono::high_resolution_clock::now();
+    for (uint32_t update = 0; update < s_updateCount; ++update)
+    {
+        count += (update & 1) ? 210000 : 120000;
+        sum += pacer.update(count, frequency, update == 0, 0.0001, 0.1, predictor);
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+
+    // keep the updates from being optimized away
+    FFX_TEST_CHECK(sum > 0);
+    return std::chrono::duration<double, std::nano>(end - start).count() / s_updateCount;
+}
+
+int main(int argc, char** argv)
+{
+    std::vector<FfxFrameTimeTrace> traces;
+    for (int arg = 1; arg < argc; ++arg)
+    {
+        FfxFrameTimeTrace trace = { argv[arg] };
+        if (!ffxLoadFrameTimeTrace(argv[arg], trace.frameTimesInMs))
+        {
+            fprintf(stderr, "can't read a frame time trace from %s\n", argv[arg]);
+            return 1;
+        }
+        traces.push_back(trace);
+    }
+    const bool synthetic = traces.empty();
+    if (synthetic)
+        traces = ffxCreateSyntheticFrameTimeTraces(s_frameCount);
+
+    printf("Frame time predictors, times in ms\n");
+    printf("%-22s %-15s %8s %8s %9s %9s\n", "trace", "predictor", "jitter", "p99 err", "latency", "max lat");
+    for (const FfxFrameTimeTrace& trace : traces)
+    {
+        FfxFramePacingSimulationResult results[FFX_ARRAY_ELEMENTS(s_predictors)];
+        for (size_t predictor = 0; predictor < FFX_ARRAY_ELEMENTS(s_predictors); ++predictor)
+        {
+            results[predictor] = replay(trace.frameTimesInMs, s_predictors[predictor]);
+            printf("%-22s %-15s %8.3f %8.3f %9.3f %9.3f\n", trace.name, s_predictorNames[predictor], results[predictor].jitterInMs,
+                   results[predictor].p99ErrorInMs, results[predictor].meanLatencyInMs, results[predictor].maxLatencyInMs);
+
+            // every predictor presents the real frame before the next one is handed over
+            FFX_TEST_CHECK(results[predictor].frameCount > 0);
+            FFX_TEST_CHECK(results[predictor].meanLatencyInMs < 2.0 * results[predictor].meanIntervalInMs);
+        }
+
+        if (!synthetic)
+            continue;
+
+        // what the documentation of FfxSwapchainFrameTimePredictor promises
+        const std::string name = trace.name;
+        if (name == "12/21 ms alternating")
+        {
+            FFX_TEST_CHECK(results[2].jitterInMs < 0.5 * results[0].jitterInMs);
+            FFX_TEST_CHECK(results[3].meanLatencyInMs < results[0].meanLatencyInMs);
+            FFX_TEST_CHECK(results[3].jitterInMs > results[0].jitterInMs);
+        }
+        else if (name == "60 fps, 40 ms spikes")
+        {
+            FFX_TEST_CHECK(results[2].maxLatencyInMs < results[0].maxLatencyInMs);
+        }
+        else if (name == "60 to 40 fps step")
+        {
+            FFX_TEST_CHECK(results[1].jitterInMs < results[0].jitterInMs);
+        }
+    }
+
+    printf("\n%-15s %12s\n", "predictor", "ns / update");
+    for (size_t predictor = 0; predictor < FFX_ARRAY_ELEMENTS(s_predictors); ++predictor)
+    {
+        printf("%-15s %12.1f\n", s_predictorNames[predictor], measureUpdate(s_predictors[predictor]));
+    }
+
+    return FFX_TEST_RESULT();
+}
@@ -0,0 +1,112 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// Runs the frame interpolation pacing of ffx_frame_pacing.h through the simulator of ffx_frame_pacing_simulator.h over
+// synthetic timelines, and reports the jitter of the present intervals, the latency the pacing adds to real frames and
+// the CPU time the pacer thread spends spinning, when it only spins and when it sleeps first (allowHybridSpin).
+//
+// A recorded timeline can be replayed instead by passing its path, see ffxLoadFrameTimeTrace.
+//
+// The simulation must replay exactly, steady frame rates must be paced evenly, and sleeping must cut the spinning
+// without making the presents late.
+
+#include <string.h>
+
+#include "frame_pacing/ffx_frame_pacing_simulator.h"
+#include "ffx_test.h"
+
+static const uint32_t s_frameCount = 2000;
+
+static FfxFramePacingSimulationResult simulate(const std::vector<double>& frameTimesInMs, bool allowHybridSpin)
+{
+    FfxFramePacingSimulationConfig config;
+    config.allowHybridSpin = allowHybridSpin;
+    return FfxFramePacingSimulator(config).run(frameTimesInMs);
+}
+
+static void printResult(const char* timelineName, const char* waitName, const FfxFramePacingSimulationResult& result)
+{
+    printf("%-22s %-7s %9.3f %8.3f %8.3f %9.3f %9.3f %7.1f %7.1f %8.1f\n", timelineName, waitName, result.meanIntervalInMs,
+           result.jitterInMs, result.p99ErrorInMs, result.meanLatencyInMs, result.maxLatencyInMs, result.spinPercent,
+           result.sleepPercent, result.meanLateInUs);
+}
+
+static void printHeader()
+{
+    printf("%-22s %-7s %9s %8s %8s %9s %9s %7s %7s %8s\n", "timeline", "wait", "interval", "jitter", "p99 err", "latency",
+           "max lat", "spin %", "sleep %", "late us");
+}
+
+int main(int argc, char** argv)
+{
+    if (argc > 1)
+    {
+        FfxFrameTimeTrace recorded = { argv[1] };
+        if (!ffxLoadFrameTimeTrace(argv[1], recorded.frameTimesInMs))
+        {
+            fprintf(stderr, "can't read a frame time trace from %s\n", argv[1]);
+            return 1;
+        }
+
+        printHeader();
+        printResult(recorded.name, "spin", simulate(recorded.frameTimesInMs, false));
+        printResult(recorded.name, "hybrid", simulate(recorded.frameTimesInMs, true));
+        return 0;
+    }
+
+    printf("Frame pacing over %u frames per timeline, times in ms\n", s_frameCount);
+    printHeader();
+
+    const std::vector<FfxFrameTimeTrace> timelines = ffxCreateSyntheticFrameTimeTraces(s_frameCount);
+    for (const FfxFrameTimeTrace& timeline : timelines)
+    {
+        const FfxFramePacingSimulationResult spin   = simulate(timeline.frameTimesInMs, false);
+        const FfxFramePacingSimulationResult hybrid = simulate(timeline.frameTimesInMs, true);
+        printResult(timeline.name, "spin", spin);
+        printResult(timeline.name, "hybrid", hybrid);
+
+        // the simulation replays exactly
+        const FfxFramePacingSimulationResult replay = simulate(timeline.frameTimesInMs, true);
+        FFX_TEST_CHECK(0 == memcmp(&replay, &hybrid, sizeof(replay)));
+
+        FFX_TEST_CHECK(spin.frameCount == s_frameCount - FfxFramePacingSimulationConfig().warmupFrames);
+        FFX_TEST_CHECK(spin.meanLatencyInMs < 2.0 * spin.meanIntervalInMs);
+
+        // sleeping leaves most of the wait to other threads, and only the sleeps which get preempted, 1 in 100 by 2 ms,
+        // overshoot past the spin budget
+        FFX_TEST_CHECK(hybrid.spinPercent < 0.5 * spin.spinPercent);
+        FFX_TEST_CHECK(hybrid.meanLateInUs < 25.0);
+    }
+
+    // steady frame rates are paced evenly, at half the frame time: the intervals only alternate by the safety margin
+    for (const FfxFrameTimeTrace* timeline : { &timelines[0], &timelines[5] })
+    {
+        const double frameTimeInMs = timeline->frameTimesInMs[0];
+        for (bool allowHybridSpin : { false, true })
+        {
+            const FfxFramePacingSimulationResult result = simulate(timeline->frameTimesInMs, allowHybridSpin);
+            FFX_TEST_CHECK(fabs(result.meanIntervalInMs - 0.5 * frameTimeInMs) < 0.01);
+            FFX_TEST_CHECK(result.jitterInMs < FfxFramePacingSimulationConfig().safetyMarginInMs + (allowHybridSpin ? 0.05 : 0.01));
+        }
+    }
+
+    return FFX_TEST_RESULT();
+}
@@ -0,0 +1,274 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#pragma once
+
+// Discrete event simulation of the frame interpolation pacing of the swapchains, on a simulated clock.
+//
+// A timeline gives the interval at which the game hands real frames to the swapchain. For each of them the
+// presenter thread calls FfxFramePacer::update once the interpolated frame is ready, and the pacer thread presents the
+// interpolated frame and then the real frame, each waiting with FfxPreciseWait until the previous present plus the
+// predicted delay, as the DX12 swapchain does. Sleeps on the simulated clock overshoot by a random amount and reading
+// the clock advances it a little, so spin loops progress. With the same seed a simulation replays exactly.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <ffx_frame_pacing.h>
+
+struct FfxFramePacingSimulationConfig
+{
+    FfxSwapchainFrameTimePredictor predictor         = FFX_SWAPCHAIN_FRAMETIME_PREDICTOR_MOVING_AVERAGE;
+    double                         safetyMarginInMs  = 0.1;   // FfxSwapchainFramePacingTuning defaults
+    double                         varianceFactor    = 0.1;
+    bool                           allowHybridSpin   = false;
+    uint32_t                       hybridSpinTime    = 2;
+    uint32_t                       timerResolution   = 1;     // in milliseconds, as granted by timeBeginPeriod
+    double                         interpolationInMs = 0.5;   // from a real frame being handed over to its interpolated frame being ready
+    double                         sleepOvershootInMs = 0.5;  // sleeps overshoot uniformly by up to this much...
+    double                         preemptionChance   = 0.01; // ...and now and then by a further scheduler quantum
+    double                         preemptionInMs     = 2.0;
+    double                         clockReadInUs      = 1.0;  // cost of reading the clock and pausing, per spin iteration
+    uint32_t                       warmupFrames       = 32;   // frames left out of the results
+    uint32_t                       seed               = 1;
+};
+
+struct FfxFramePacingSimulationResult
+{
+    uint32_t frameCount;         // real frames measured, each presented with its interpolated frame
+    double   meanIntervalInMs;   // between consecutive presents
+    double   jitterInMs;         // standard deviation of the difference between each present interval and half the
+                                 // interval at which its real frame was handed over, the ideal interval
+    double   p99ErrorInMs;       // 99th percentile of the absolute difference
+    double   meanLatencyInMs;    // from the interpolated frame being ready to the real frame being presented
+    double   maxLatencyInMs;
+    double   spinPercent;        // time spent spinning, in percent of one core
+    double   sleepPercent;       // time spent sleeping
+    double   meanLateInUs;       // how far past their targets the waits returned, for frames ready before their target
+};
+
+class FfxFramePacingSimulator
+{
+public:
+    static constexpr int64_t frequency = 10000000;  // ticks per second, that of QPC on most systems
+
+    explicit FfxFramePacingSimulator(const FfxFramePacingSimulationConfig& simulationConfig)
+        : config(simulationConfig), random(simulationConfig.seed)
+    {
+        timer.frequency = frequency;
+        timer.getCount  = getCount;
+        timer.sleep     = config.allowHybridSpin ? sleep : nullptr;
+        timer.userData  = this;
+    }
+
+    // Runs the pacing over a timeline of intervals, in milliseconds, between the real frames being handed over.
+    FfxFramePacingSimulationResult run(const std::vector<double>& frameTimesInMs)
+    {
+        FfxFramePacer  pacer{};
+        FfxPreciseWait preciseWait{};
+
+        const uint32_t timerResolution = config.allowHybridSpin ? config.timerResolution : FFX_FRAME_PACING_UNKNOWN_TIMER_RESOLUTION;
+
+        std::vector<double> errors;
+        std::vector<double> intervals;
+        double              latencySum = 0.0;
+        double              latencyMax = 0.0;
+        int64_t             spinCount  = 0;
+        int64_t             sleepCount = 0;
+        int64_t             lateCount  = 0;
+        int64_t             measureStart = 0;
+        uint32_t            waitCount  = 0;
+
+        int64_t handOverCount    = 0;
+        int64_t previousPresent  = 0;
+        int64_t pacerFreeCount   = 0;
+
+        for (uint32_t frame = 0; frame < frameTimesInMs.size(); ++frame)
+        {
+            const int64_t frameCount = toTicks(frameTimesInMs[frame] / 1000.0);
+            handOverCount += frameCount;
+            const int64_t interpolatedReadyCount = handOverCount + toTicks(config.interpolationInMs / 1000.0);
+            const bool    measured               = frame >= config.warmupFrames;
+
+            // the presenter thread predicts the delay as soon as the interpolated frame is ready
+            const int64_t delta = pacer.update(interpolatedReadyCount, frequency, frame == 0, config.safetyMarginInMs / 1000.0, config.varianceFactor, config.predictor);
+
+            // the pacer thread picks the frames up once it is done with the previous ones
+            currentCount = std::max(pacerFreeCount, interpolatedReadyCount);
+            if (measured && measureStart == 0)
+                measureStart = currentCount;
+
+            int64_t presents[2];
+            for (int64_t& present : presents)
+            {
+                const int64_t                 targetCount = previousPresent + delta;
+                const bool                    waits       = targetCount > currentCount;
+                const FfxFramePacingWaitStats stats       = preciseWait.waitForCount(timer, targetCount, timerResolution, config.hybridSpinTime);
+                present                                   = currentCount;
+                if (measured)
+                {
+                    spinCount += stats.spinCount;
+                    sleepCount += stats.sleepCount;
+                    lateCount += waits ? stats.lateCount : 0;
+                    waitCount += waits;
+
+                    const double interval = toMs(present - previousPresent);
+                    intervals.push_back(interval);
+                    errors.push_back(interval - 0.5 * frameTimesInMs[frame]);
+                }
+                previousPresent = present;
+            }
+            pacerFreeCount = currentCount;
+
+            if (measured)
+            {
+                const double latency = toMs(presents[1] - interpolatedReadyCount);
+                latencySum += latency;
+                latencyMax = std::max(latencyMax, latency);
+            }
+        }
+
+        FfxFramePacingSimulationResult result = {};
+        result.frameCount = uint32_t(intervals.size() / 2);
+        if (result.frameCount == 0)
+            return result;
+
+        const double totalInMs = toMs(currentCount - measureStart);
+        double       errorSum  = 0.0;
+        double       errorSquareSum = 0.0;
+        for (double error : errors)
+        {
+            errorSum += error;
+            errorSquareSum += error * error;
+        }
+        const double errorMean = errorSum / errors.size();
+
+        std::vector<double> absoluteErrors(errors.size());
+        std::transform(errors.begin(), errors.end(), absoluteErrors.begin(), [](double error) { return fabs(error); });
+        std::sort(absoluteErrors.begin(), absoluteErrors.end());
+
+        double intervalSum = 0.0;
+        for (double interval : intervals)
+            intervalSum += interval;
+
+        result.meanIntervalInMs = intervalSum / intervals.size();
+        result.jitterInMs       = sqrt(std::max(0.0, errorSquareSum / errors.size() - errorMean * errorMean));
+        result.p99ErrorInMs     = absoluteErrors[size_t(0.99 * (absoluteErrors.size() - 1))];
+        result.meanLatencyInMs  = latencySum / result.frameCount;
+        result.maxLatencyInMs   = latencyMax;
+        result.spinPercent      = totalInMs > 0.0 ? 100.0 * toMs(spinCount) / totalInMs : 0.0;
+        result.sleepPercent     = totalInMs > 0.0 ? 100.0 * toMs(sleepCount) / totalInMs : 0.0;
+        result.meanLateInUs     = waitCount ? 1000.0 * toMs(lateCount) / waitCount : 0.0;
+        return result;
+    }
+
+private:
+    static int64_t toTicks(double seconds)
+    {
+        return int64_t(seconds * frequency + 0.5);
+    }
+
+    static double toMs(int64_t ticks)
+    {
+        return 1000.0 * double(ticks) / frequency;
+    }
+
+    double uniform()
+    {
+        // scaled by hand rather than with std::uniform_real_distribution, whose output differs between standard libraries
+        return double(random()) / 4294967296.0;
+    }
+
+    static int64_t getCount(void* userData)
+    {
+        FfxFramePacingSimulator* simulator = static_cast<FfxFramePacingSimulator*>(userData);
+        simulator->currentCount += std::max<int64_t>(1, toTicks(simulator->config.clockReadInUs / 1000000.0));
+        return simulator->currentCount;
+    }
+
+    static bool sleep(void* userData, uint32_t milliseconds, uint32_t)
+    {
+        FfxFramePacingSimulator* simulator = static_cast<FfxFramePacingSimulator*>(userData);
+        double overshootInMs = simulator->uniform() * simulator->config.sleepOvershootInMs;
+        if (simulator->uniform() < simulator->config.preemptionChance)
+            overshootInMs += simulator->config.preemptionInMs;
+        simulator->currentCount += toTicks((milliseconds + overshootInMs) / 1000.0);
+        return true;
+    }
+
+    FfxFramePacingSimulationConfig config;
+    FfxFramePacingTimer            timer = {};
+    std::mt19937                   random;
+    int64_t                        currentCount = 0;
+};
+
+struct FfxFrameTimeTrace
+{
+    const char*         name;
+    std::vector<double> frameTimesInMs;
+};
+
+// Synthetic timelines of the patterns seen in games: steady rates, noise, frames alternating between two costs, isolated
+// spikes and a step in load.
+inline std::vector<FfxFrameTimeTrace> ffxCreateSyntheticFrameTimeTraces(uint32_t frameCount)
+{
+    std::mt19937 random(7);
+    auto         uniform = [&random]() { return double(random()) / 4294967296.0; };
+
+    std::vector<FfxFrameTimeTrace> traces = {
+        { "60 fps" }, { "60 fps +-1 ms" }, { "12/21 ms alternating" }, { "60 fps, 40 ms spikes" }, { "60 to 40 fps step" }, { "144 fps" },
+    };
+    for (uint32_t frame = 0; frame < frameCount; ++frame)
+    {
+        traces[0].frameTimesInMs.push_back(1000.0 / 60.0);
+        traces[1].frameTimesInMs.push_back(1000.0 / 60.0 + 2.0 * uniform() - 1.0);
+        traces[2].frameTimesInMs.push_back((frame & 1) ? 21.0 : 12.0);
+        traces[3].frameTimesInMs.push_back((frame % 60) == 59 ? 40.0 : 1000.0 / 60.0);
+        traces[4].frameTimesInMs.push_back(frame < frameCount / 2 ? 1000.0 / 60.0 : 25.0);
+        traces[5].frameTimesInMs.push_back(1000.0 / 144.0);
+    }
+    return traces;
+}
+
+// Loads a recorded timeline: one interval between frames, in milliseconds, per line. Lines which don't start with a
+// number, such as a header, are skipped, as is anything after the first number of a line, so the first column of a
+// CSV capture can be read as is.
+inline bool ffxLoadFrameTimeTrace(const char* path, std::vector<double>& frameTimesInMs)
+{
+    FILE* file = fopen(path, "r");
+    if (!file)
+        return false;
+
+    char line[256];
+    while (fgets(line, sizeof(line), file))
+    {
+        char*        end       = nullptr;
+        const double frameTime = strtod(line, &end);
+        if (end != line && frameTime > 0.0)
+            frameTimesInMs.push_back(frameTime);
+    }
+    fclose(file);
+    return !frameTimesInMs.empty();
+}
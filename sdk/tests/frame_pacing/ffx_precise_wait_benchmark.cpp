@@ -0,0 +1,144 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// Measures FfxPreciseWait (ffx_frame_pacing.h) on Linux, against the real clock and scheduler: how late waits of random
+// lengths wake up, in percentiles, and how much of a core they use, when the wait only spins, as the swapchains did
+// before and the Vulkan one still does, and when it sleeps first with its calibrated overshoot budget.
+//
+// The timer reads CLOCK_MONOTONIC and sleeps with nanosleep, and the CPU time is that of the waiting thread.
+//
+// Sleeping must use a fraction of the CPU time of spinning, and still wake up within a fraction of a millisecond
+// typically, and the wait statistics must account for the time waited.
+
+#include <time.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <FidelityFX/host/ffx_util.h>
+#include <ffx_frame_pacing.h>
+#include "ffx_test.h"
+
+static const uint32_t s_waitCount       = 300;
+static const uint32_t s_maxWaitInUs     = 16000;
+static const uint32_t s_timerResolution = 1;  // milliseconds, which nanosleep honours on any hrtimer kernel
+static const uint32_t s_hybridSpinTime  = 2;  // FfxSwapchainFramePacingTuning default
+
+struct WaitResult
+{
+    double errorPercentilesInUs[5];  // 50, 90, 99, 99.9 and 100
+    double cpuPercent;               // thread CPU time over wall time
+    double spinPercent;              // as reported by the wait statistics
+    double sleepPercent;
+};
+
+static const double s_percentiles[] = { 0.5, 0.9, 0.99, 0.999, 1.0 };
+
+static int64_t readClock(clockid_t clock)
+{
+    timespec time;
+    clock_gettime(clock, &time);
+    return int64_t(time.tv_sec) * 1000000000 + time.tv_nsec;
+}
+
+static int64_t getCount(void*)
+{
+    return readClock(CLOCK_MONOTONIC);
+}
+
+static bool sleepMilliseconds(void*, uint32_t milliseconds, uint32_t)
+{
+    timespec duration = { time_t(milliseconds / 1000), long(milliseconds % 1000) * 1000000 };
+    while (nanosleep(&duration, &duration) != 0)
+    {
+    }
+    return true;
+}
+
+static WaitResult measure(bool allowSleep)
+{
+    FfxFramePacingTimer timer = {};
+    timer.frequency           = 1000000000;
+    timer.getCount            = getCount;
+    timer.sleep               = sleepMilliseconds;
+
+    FfxPreciseWait      preciseWait{};
+    std::mt19937        random(3);
+    std::vector<double> errors;
+    int64_t             spinCount  = 0;
+    int64_t             sleepCount = 0;
+
+    const int64_t wallStart = readClock(CLOCK_MONOTONIC);
+    const int64_t cpuStart  = readClock(CLOCK_THREAD_CPUTIME_ID);
+    for (uint32_t wait = 0; wait < s_waitCount; ++wait)
+    {
+        const int64_t startCount  = getCount(nullptr);
+        const int64_t targetCount = startCount + int64_t(random() % s_maxWaitInUs) * 1000;
+        const FfxFramePacingWaitStats stats =
+            preciseWait.waitForCount(timer, targetCount, allowSleep ? s_timerResolution : FFX_FRAME_PACING_UNKNOWN_TIMER_RESOLUTION, s_hybridSpinTime);
+        const int64_t endCount = getCount(nullptr);
+
+        // the wait returned at or after the target, and the time it slept and spun adds up to the wait
+        FFX_TEST_CHECK(stats.lateCount >= 0);
+        FFX_TEST_CHECK(stats.sleepCount + stats.spinCount <= endCount - startCount);
+        FFX_TEST_CHECK(allowSleep || stats.sleepCount == 0);
+
+        errors.push_back(double(stats.lateCount) / 1000.0);
+        spinCount += stats.spinCount;
+        sleepCount += stats.sleepCount;
+    }
+    const double wallTime = double(readClock(CLOCK_MONOTONIC) - wallStart);
+    const double cpuTime  = double(readClock(CLOCK_THREAD_CPUTIME_ID) - cpuStart);
+
+    WaitResult result = {};
+    std::sort(errors.begin(), errors.end());
+    for (size_t percentile = 0; percentile < FFX_ARRAY_ELEMENTS(s_percentiles); ++percentile)
+    {
+        result.errorPercentilesInUs[percentile] = errors[size_t(s_percentiles[percentile] * (errors.size() - 1))];
+    }
+    result.cpuPercent   = 100.0 * cpuTime / wallTime;
+    result.spinPercent  = 100.0 * double(spinCount) / wallTime;
+    result.sleepPercent = 100.0 * double(sleepCount) / wallTime;
+    return result;
+}
+
+int main()
+{
+    printf("%u waits of 0 to %u ms, wake up error in us\n", s_waitCount, s_maxWaitInUs / 1000);
+    printf("%-8s %8s %8s %8s %8s %8s %7s %7s %8s\n", "wait", "p50", "p90", "p99", "p99.9", "max", "cpu %", "spin %", "sleep %");
+
+    const WaitResult spin   = measure(false);
+    const WaitResult hybrid = measure(true);
+    for (const WaitResult* result : { &spin, &hybrid })
+    {
+        printf("%-8s %8.1f %8.1f %8.1f %8.1f %8.1f %7.1f %7.1f %8.1f\n", result == &spin ? "spin" : "hybrid", result->errorPercentilesInUs[0],
+               result->errorPercentilesInUs[1], result->errorPercentilesInUs[2], result->errorPercentilesInUs[3], result->errorPercentilesInUs[4],
+               result->cpuPercent, result->spinPercent, result->sleepPercent);
+    }
+
+    // a spinning wait keeps its core busy, which sleeping mostly avoids; the typical wake up stays well under a
+    // millisecond, the tail depends on how loaded the machine is so it is only reported
+    FFX_TEST_CHECK(spin.cpuPercent > 50.0);
+    FFX_TEST_CHECK(hybrid.cpuPercent < 0.5 * spin.cpuPercent);
+    FFX_TEST_CHECK(hybrid.errorPercentilesInUs[0] < 200.0);
+
+    return FFX_TEST_RESULT();
+}
@@ -0,0 +1,164 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Benchmarks the host side cost of FSR2 frames with both forms of compute job: compact jobs referencing the pipeline
+// (FFX_GPU_JOB_COMPUTE_COMPACT), and full jobs carrying a copy of the pipeline state (FFX_GPU_JOB_COMPUTE), which FSR2
+// falls back to on backends that don't report compactComputeJobsSupported.
+//
+// Each form runs against its own null backend, and reports the CPU time of ffxFsr2ContextDispatch, which schedules and
+// executes all jobs of a frame. Both forms have to record the same commands.
+
+#include <cstring>
+#include <cwchar>
+
+#include <FidelityFX/host/ffx_fsr2.h>
+#include "null_backend/ffx_null_test_backend.h"
+#include "ffx_test.h"
+
+static const uint32_t s_renderWidth   = 1920;
+static const uint32_t s_renderHeight  = 1080;
+static const uint32_t s_displayWidth  = 2560;
+static const uint32_t s_displayHeight = 1440;
+static const uint32_t s_warmupFrames  = 16;
+static const uint32_t s_frameCount    = 2000;
+
+static FfxGetDeviceCapabilitiesFunc s_getDeviceCapabilitiesNull = nullptr;
+
+// Hides the null backend's compact job support, as a backend written before compact jobs would
+static FfxErrorCode getDeviceCapabilitiesWithoutCompactJobs(FfxInterface* backendInterface, FfxDeviceCapabilities* deviceCapabilities)
+{
+    const FfxErrorCode errorCode = s_getDeviceCapabilitiesNull(backendInterface, deviceCapabilities);
+    deviceCapabilities->compactComputeJobsSupported = false;
+    return errorCode;
+}
+
+struct FrameRecording
+{
+    double                      microsecondsPerFrame = 0.0;
+    uint64_t                    jobsPerFrame         = 0;
+    std::vector<FfxNullCommand> lastFrame;
+};
+
+static FrameRecording runFrames(bool compactJobs)
+{
+    FrameRecording recording;
+
+    NullTestBackend backend;
+    FFX_TEST_CHECK(createNullTestBackend(backend, FFX_FSR2_CONTEXT_COUNT));
+    if (!compactJobs)
+    {
+        s_getDeviceCapabilitiesNull = backend.backendInterface.fpGetDeviceCapabilities;
+        backend.backendInterface.fpGetDeviceCapabilities = getDeviceCapabilitiesWithoutCompactJobs;
+    }
+
+    FfxFsr2ContextDescription contextDescription = {};
+    contextDescription.flags            = FFX_FSR2_ENABLE_AUTO_EXPOSURE | FFX_FSR2_ENABLE_DEPTH_INVERTED;
+    contextDescription.maxRenderSize    = {s_renderWidth, s_renderHeight};
+    contextDescription.displaySize      = {s_displayWidth, s_displayHeight};
+    contextDescription.backendInterface = backend.backendInterface;
+
+    FfxFsr2Context context = {};
+    FFX_TEST_CHECK(ffxFsr2ContextCreate(&context, &contextDescription) == FFX_OK);
+
+    FfxFsr2DispatchDescription dispatchDescription = {};
+    dispatchDescription.commandList       = backend.commandList;
+    dispatchDescription.color             = nullTestTexture(1, s_renderWidth, s_renderHeight, FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT);
+    dispatchDescription.depth             = nullTestTexture(2, s_renderWidth, s_renderHeight, FFX_SURFACE_FORMAT_R32_FLOAT);
+    dispatchDescription.motionVectors     = nullTestTexture(3, s_renderWidth, s_renderHeight, FFX_SURFACE_FORMAT_R16G16_FLOAT);
+    dispatchDescription.reactive          = nullTestTexture(4, s_renderWidth, s_renderHeight, FFX_SURFACE_FORMAT_R8_UNORM);
+    dispatchDescription.output            = nullTestTexture(5, s_displayWidth, s_displayHeight, FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT,
+                                                            FFX_RESOURCE_STATE_UNORDERED_ACCESS, FFX_RESOURCE_USAGE_UAV);
+    dispatchDescription.motionVectorScale = {float(s_renderWidth), float(s_renderHeight)};
+    dispatchDescription.renderSize        = {s_renderWidth, s_renderHeight};
+    dispatchDescription.enableSharpening  = true;
+    dispatchDescription.sharpness         = 0.5f;
+    dispatchDescription.frameTimeDelta    = 16.6f;
+    dispatchDescription.preExposure       = 1.0f;
+    dispatchDescription.cameraNear        = 0.1f;
+    dispatchDescription.cameraFar         = 1000.0f;
+    dispatchDescription.cameraFovAngleVertical  = 1.0f;
+    dispatchDescription.viewSpaceToMetersFactor = 1.0f;
+
+    const int32_t phaseCount = ffxFsr2GetJitterPhaseCount(s_renderWidth, s_displayWidth);
+
+    double   microseconds = 0.0;
+    uint64_t jobsBefore   = 0;
+    for (uint32_t frame = 0; frame < s_warmupFrames + s_frameCount; ++frame)
+    {
+        if (frame == s_warmupFrames)
+            jobsBefore = getNullTestStatistics(backend).jobsScheduled;
+
+        ffxFsr2GetJitterOffset(&dispatchDescription.jitterOffset.x, &dispatchDescription.jitterOffset.y, int32_t(frame), phaseCount);
+        dispatchDescription.reset = frame == 0;
+        resetNullTestCommands(backend);
+
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        FFX_TEST_CHECK(ffxFsr2ContextDispatch(&context, &dispatchDescription) == FFX_OK);
+        if (frame >= s_warmupFrames)
+            microseconds += microsecondsSince(start);
+    }
+
+    recording.microsecondsPerFrame = microseconds / s_frameCount;
+    recording.jobsPerFrame         = (getNullTestStatistics(backend).jobsScheduled - jobsBefore) / s_frameCount;
+    recording.lastFrame.assign(backend.stream.commands, backend.stream.commands + backend.stream.commandCount);
+    FFX_TEST_CHECK(backend.stream.droppedCommandCount == 0);
+
+    FFX_TEST_CHECK(ffxFsr2ContextDestroy(&context) == FFX_OK);
+
+    return recording;
+}
+
+static bool sameCommand(const FfxNullCommand& a, const FfxNullCommand& b)
+{
+    if (a.type != b.type || wcsncmp(a.label, b.label, FFX_NULL_COMMAND_LABEL_LENGTH) != 0)
+        return false;
+
+    switch (a.type)
+    {
+    case FFX_NULL_COMMAND_DISPATCH:
+        return memcmp(a.dispatch.dimensions, b.dispatch.dimensions, sizeof(a.dispatch.dimensions)) == 0 &&
+               a.dispatch.srvCount == b.dispatch.srvCount && a.dispatch.uavCount == b.dispatch.uavCount &&
+               a.dispatch.constantBufferCount == b.dispatch.constantBufferCount &&
+               a.dispatch.constantBufferBytes == b.dispatch.constantBufferBytes;
+    case FFX_NULL_COMMAND_BARRIER:
+        return a.barrier.stateBefore == b.barrier.stateBefore && a.barrier.stateAfter == b.barrier.stateAfter;
+    default:
+        return true;
+    }
+}
+
+int main()
+{
+    const FrameRecording compact = runFrames(true);
+    const FrameRecording full    = runFrames(false);
+
+    printf("FSR2 %ux%u -> %ux%u, %u frames\n", s_renderWidth, s_renderHeight, s_displayWidth, s_displayHeight, s_frameCount);
+    printf("compact jobs: %8.2f us per frame, %llu jobs per frame\n", compact.microsecondsPerFrame, (unsigned long long)compact.jobsPerFrame);
+    printf("full jobs:    %8.2f us per frame, %llu jobs per frame\n", full.microsecondsPerFrame, (unsigned long long)full.jobsPerFrame);
+
+    FFX_TEST_CHECK(compact.jobsPerFrame > 0 && compact.jobsPerFrame == full.jobsPerFrame);
+    FFX_TEST_CHECK(!compact.lastFrame.empty() && compact.lastFrame.size() == full.lastFrame.size());
+    for (size_t i = 0; i < compact.lastFrame.size() && i < full.lastFrame.size(); ++i)
+        FFX_TEST_CHECK(sameCommand(compact.lastFrame[i], full.lastFrame[i]));
+
+    return FFX_TEST_RESULT();
+}
@@ -0,0 +1,167 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#pragma once
+
+#include <string.h>
+#include <vector>
+
+#include <FidelityFX/host/ffx_lpm.h>
+#include <FidelityFX/host/ffx_interface.h>
+
+// A stand-in backend for tests linking ffx_lpm.cpp without shaders. Pipelines get the bindings of the LPM filter, and
+// every constant upload is recorded for the effect context which staged it. It does nothing else, so dispatch timings
+// are those of the LPM component.
+//
+// A stub backend is not thread safe, like a real one: give each thread its own.
+
+struct LpmBackendStub
+{
+    FfxInterface                       backendInterface = {};
+    uint32_t                           contextCount     = 0;
+    std::vector<uint32_t>              staged;     // Constants staged since the last execution
+    std::vector<std::vector<uint32_t>> constants;  // The constants of the last execution, per effect context
+    uint64_t                           uploads          = 0;
+};
+
+static LpmBackendStub* getLpmBackendStub(FfxInterface* backendInterface)
+{
+    return static_cast<LpmBackendStub*>(backendInterface->scratchBuffer);
+}
+
+static FfxVersionNumber getSDKVersionLpmStub(FfxInterface*)
+{
+    return FFX_SDK_MAKE_VERSION(1, 1, 2);
+}
+
+static FfxErrorCode getDeviceCapabilitiesLpmStub(FfxInterface*, FfxDeviceCapabilities* deviceCapabilities)
+{
+    memset(deviceCapabilities, 0, sizeof(*deviceCapabilities));
+    deviceCapabilities->maximumSupportedShaderModel = FFX_SHADER_MODEL_6_6;
+    deviceCapabilities->waveLaneCountMin            = 32;
+    deviceCapabilities->waveLaneCountMax            = 64;
+    return FFX_OK;
+}
+
+static FfxErrorCode createBackendContextLpmStub(FfxInterface* backendInterface, FfxEffect, FfxEffectBindlessConfig*, FfxUInt32* effectContextId)
+{
+    LpmBackendStub* stub = getLpmBackendStub(backendInterface);
+    *effectContextId     = stub->contextCount++;
+    stub->constants.emplace_back();
+    return FFX_OK;
+}
+
+static FfxErrorCode destroyBackendContextLpmStub(FfxInterface*, FfxUInt32)
+{
+    return FFX_OK;
+}
+
+static void setLpmStubBinding(FfxResourceBinding& binding, const wchar_t* name)
+{
+    memset(&binding, 0, sizeof(binding));
+    wcscpy_s(binding.name, name);
+}
+
+static FfxErrorCode createPipelineLpmStub(FfxInterface*, FfxEffect, FfxPass, uint32_t, const FfxPipelineDescription* description, FfxUInt32, FfxPipelineState* outPipeline)
+{
+    memset(outPipeline, 0, sizeof(*outPipeline));
+    setLpmStubBinding(outPipeline->srvTextureBindings[0], L"r_input_color");
+    setLpmStubBinding(outPipeline->uavTextureBindings[0], L"rw_output_color");
+    setLpmStubBinding(outPipeline->constantBufferBindings[0], L"cbLPM");
+    outPipeline->srvTextureCount = 1;
+    outPipeline->uavTextureCount = 1;
+    outPipeline->constCount      = 1;
+    outPipeline->pipeline        = reinterpret_cast<FfxPipeline>(outPipeline);
+    wcscpy_s(outPipeline->name, description->name);
+    return FFX_OK;
+}
+
+static FfxErrorCode destroyPipelineLpmStub(FfxInterface*, FfxPipelineState* pipeline, FfxUInt32)
+{
+    pipeline->pipeline = nullptr;
+    return FFX_OK;
+}
+
+static FfxErrorCode registerResourceLpmStub(FfxInterface*, const FfxResource* resource, FfxUInt32, FfxResourceInternal* outResource)
+{
+    // the LPM filter only binds application resources, remember the width and height in the index
+    outResource->internalIndex = int32_t(resource->description.width << 16 | resource->description.height);
+    return FFX_OK;
+}
+
+static FfxResourceDescription getResourceDescriptionLpmStub(FfxInterface*, FfxResourceInternal resource)
+{
+    FfxResourceDescription description = {};
+    description.type   = FFX_RESOURCE_TYPE_TEXTURE2D;
+    description.width  = uint32_t(resource.internalIndex) >> 16;
+    description.height = uint32_t(resource.internalIndex) & 0xffff;
+    description.depth  = 1;
+    return description;
+}
+
+static FfxErrorCode unregisterResourcesLpmStub(FfxInterface*, FfxCommandList, FfxUInt32)
+{
+    return FFX_OK;
+}
+
+static FfxErrorCode stageConstantBufferDataLpmStub(FfxInterface* backendInterface, void* data, FfxUInt32 size, FfxConstantBuffer* constantBuffer)
+{
+    LpmBackendStub* stub = getLpmBackendStub(backendInterface);
+    stub->staged.assign(static_cast<const uint32_t*>(data), static_cast<const uint32_t*>(data) + size / sizeof(uint32_t));
+    ++stub->uploads;
+
+    constantBuffer->data            = stub->staged.data();
+    constantBuffer->num32BitEntries = size / sizeof(uint32_t);
+    return FFX_OK;
+}
+
+static FfxErrorCode scheduleGpuJobLpmStub(FfxInterface*, const FfxGpuJobDescription*)
+{
+    return FFX_OK;
+}
+
+// Staging has no effect context, the constants are filed under the context which executes them
+static FfxErrorCode executeGpuJobsLpmStub(FfxInterface* backendInterface, FfxCommandList, FfxUInt32 effectContextId)
+{
+    LpmBackendStub* stub = getLpmBackendStub(backendInterface);
+    stub->constants[effectContextId].swap(stub->staged);
+    stub->staged.clear();
+    return FFX_OK;
+}
+
+static void createLpmBackendStub(LpmBackendStub& stub)
+{
+    FfxInterface& backendInterface                = stub.backendInterface;
+    backendInterface.fpGetSDKVersion               = getSDKVersionLpmStub;
+    backendInterface.fpGetDeviceCapabilities       = getDeviceCapabilitiesLpmStub;
+    backendInterface.fpCreateBackendContext        = createBackendContextLpmStub;
+    backendInterface.fpDestroyBackendContext       = destroyBackendContextLpmStub;
+    backendInterface.fpCreatePipeline              = createPipelineLpmStub;
+    backendInterface.fpDestroyPipeline             = destroyPipelineLpmStub;
+    backendInterface.fpRegisterResource            = registerResourceLpmStub;
+    backendInterface.fpGetResourceDescription      = getResourceDescriptionLpmStub;
+    backendInterface.fpUnregisterResources         = unregisterResourcesLpmStub;
+    backendInterface.fpStageConstantBufferDataFunc = stageConstantBufferDataLpmStub;
+    backendInterface.fpScheduleGpuJob              = scheduleGpuJobLpmStub;
+    backendInterface.fpExecuteGpuJobs              = executeGpuJobsLpmStub;
+    backendInterface.scratchBuffer                 = &stub;
+    backendInterface.scratchBufferSize             = sizeof(stub);
+}
@@ -0,0 +1,159 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// Runs many LPM contexts on several threads at once, each thread with its own stand-in backend
+// (ffx_lpm_backend_stub.h), and checks that every dispatch uploads the constants ffxLpmCalculateCpuConstants sets up
+// for its inputs on a single thread. Contexts keep their inputs for a few frames and then switch to other inputs, so
+// dispatches alternate between reusing their cached constants and setting them up again. No context may ever see
+// constants of another context or stale constants of its own.
+
+#include <thread>
+
+#include "lpm/ffx_lpm_backend_stub.h"
+#include "ffx_test.h"
+
+static const uint32_t s_threadCount       = 8;
+static const uint32_t s_contextsPerThread = 4;
+static const uint32_t s_frameCount        = 300;
+static const uint32_t s_exposureCount     = 2;
+static const uint32_t s_colorSpaceCount   = 3;
+static const uint32_t s_displayModeCount  = 5;
+static const uint32_t s_inputCount        = s_exposureCount * s_colorSpaceCount * s_displayModeCount;
+
+// Every color space and display mode, at two exposures
+static FfxLpmDispatchDescription getInputs(uint32_t index)
+{
+    FfxLpmDispatchDescription description = {};
+    description.shoulder               = true;
+    description.softGap                = 0.0f;
+    description.hdrMax                 = 256.0f;
+    description.lpmExposure            = index % s_exposureCount ? 10.0f : 8.0f;
+    description.contrast               = 0.3f;
+    description.shoulderContrast       = 1.0f;
+    description.saturation[0]          = 0.0f;
+    description.saturation[1]          = 0.0f;
+    description.saturation[2]          = 0.0f;
+    description.crosstalk[0]           = 1.0f;
+    description.crosstalk[1]           = 1.0f / 2.0f;
+    description.crosstalk[2]           = 1.0f / 32.0f;
+    description.colorSpace             = FfxLpmColorSpace(index / s_exposureCount % s_colorSpaceCount);
+    description.displayMode            = FfxLpmDisplayMode(index / (s_exposureCount * s_colorSpaceCount));
+    description.displayRedPrimary[0]   = 0.64f;
+    description.displayRedPrimary[1]   = 0.33f;
+    description.displayGreenPrimary[0] = 0.30f;
+    description.displayGreenPrimary[1] = 0.60f;
+    description.displayBluePrimary[0]  = 0.15f;
+    description.displayBluePrimary[1]  = 0.06f;
+    description.displayWhitePoint[0]   = 0.3127f;
+    description.displayWhitePoint[1]   = 0.3290f;
+    description.displayMinLuminance    = 0.05f;
+    description.displayMaxLuminance    = 1000.0f;
+    return description;
+}
+
+// The inputs of a context at a frame: each context holds its inputs for its own number of frames
+static uint32_t getInputIndex(uint32_t thread, uint32_t context, uint32_t frame)
+{
+    const uint32_t holdFrames = 1 + (thread * s_contextsPerThread + context) % 7;
+    return (thread * 7 + context * 3 + frame / holdFrames) % s_inputCount;
+}
+
+struct ThreadResult
+{
+    uint32_t failedCalls         = 0;
+    uint32_t mismatchedConstants = 0;
+    uint32_t dispatches          = 0;
+};
+
+static void runContexts(uint32_t thread, const std::vector<FfxLpmCpuConstants>& expected, ThreadResult& result)
+{
+    LpmBackendStub stub;
+    createLpmBackendStub(stub);
+
+    FfxLpmContextDescription contextDescription = {};
+    contextDescription.backendInterface         = stub.backendInterface;
+
+    std::vector<FfxLpmContext> contexts(s_contextsPerThread);
+    for (FfxLpmContext& context : contexts)
+        result.failedCalls += ffxLpmContextCreate(&context, &contextDescription) != FFX_OK;
+
+    for (uint32_t frame = 0; frame < s_frameCount; ++frame)
+    {
+        for (uint32_t context = 0; context < s_contextsPerThread; ++context)
+        {
+            const uint32_t            inputIndex          = getInputIndex(thread, context, frame);
+            FfxLpmDispatchDescription dispatchDescription = getInputs(inputIndex);
+            dispatchDescription.inputColor.description.width   = 1920;
+            dispatchDescription.inputColor.description.height  = 1080;
+            dispatchDescription.outputColor.description.width  = 1920;
+            dispatchDescription.outputColor.description.height = 1080;
+
+            result.failedCalls += ffxLpmContextDispatch(&contexts[context], &dispatchDescription) != FFX_OK;
+            ++result.dispatches;
+
+            // the stub creates effect contexts in order
+            const std::vector<uint32_t>& constants = stub.constants[context];
+            result.mismatchedConstants += constants.size() * sizeof(uint32_t) != sizeof(FfxLpmCpuConstants) ||
+                                          memcmp(constants.data(), &expected[inputIndex], sizeof(FfxLpmCpuConstants)) != 0;
+        }
+    }
+
+    for (FfxLpmContext& context : contexts)
+        result.failedCalls += ffxLpmContextDestroy(&context) != FFX_OK;
+}
+
+int main()
+{
+    // the reference constants, set up on this thread alone
+    std::vector<FfxLpmCpuConstants> expected(s_inputCount);
+    for (uint32_t inputIndex = 0; inputIndex < s_inputCount; ++inputIndex)
+    {
+        const FfxLpmDispatchDescription description = getInputs(inputIndex);
+        FFX_TEST_CHECK(ffxLpmCalculateCpuConstants(&expected[inputIndex], &description) == FFX_OK);
+    }
+
+    // inputs which differ must give different constants, or a stale cache could go unnoticed
+    for (uint32_t inputIndex = 1; inputIndex < s_inputCount; ++inputIndex)
+        FFX_TEST_CHECK(memcmp(&expected[inputIndex], &expected[inputIndex - 1], sizeof(FfxLpmCpuConstants)) != 0);
+
+    std::vector<ThreadResult> results(s_threadCount);
+    std::vector<std::thread>  threads;
+    for (uint32_t thread = 0; thread < s_threadCount; ++thread)
+        threads.emplace_back(runContexts, thread, std::cref(expected), std::ref(results[thread]));
+    for (std::thread& thread : threads)
+        thread.join();
+
+    uint32_t dispatches = 0;
+    for (const ThreadResult& result : results)
+    {
+        FFX_TEST_CHECK(result.failedCalls == 0);
+        FFX_TEST_CHECK(result.mismatchedConstants == 0);
+        dispatches += result.dispatches;
+    }
+    FFX_TEST_CHECK(dispatches == s_threadCount * s_contextsPerThread * s_frameCount);
+
+    printf("%u contexts on %u threads, %u dispatches checked\n",
+           s_threadCount * s_contextsPerThread,
+           s_threadCount,
+           dispatches);
+
+    return FFX_TEST_RESULT();
+}
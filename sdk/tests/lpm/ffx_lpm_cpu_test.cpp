@@ -0,0 +1,240 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Compares the vector lanes ffxLpmFilterCpu is compiled with against the scalar lanes, which evaluate LpmMap() and the
+// output encoding with std::pow(), for every color space and display mode.
+//
+// The filter source is included rather than linked to reach its lanes. Mapping and encoding are compared separately:
+// the PQ curve is so steep near black that rounding differences the mapper's conversion matrices leave in dark pixels
+// would swamp any comparison of encoded output, while the encoding on its own is well conditioned.
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <lpm/ffx_lpm_cpu.cpp>
+#include "ffx_test.h"
+
+// Mapped colors lose a few ulp of the brightest channel, mostly to cancellation in the conversion matrices
+static const float s_mapTolerance = 1e-5f;
+
+// The polynomial log2() and exp2() of the vector lanes are accurate to a few ulp, which the exponent of the PQ curve
+// amplifies to around 1e-5. Their log2() is not accurate for denormals, which only matters for outputs far too dark
+// to display.
+static const float s_encodeTolerance         = 5e-5f;
+static const float s_encodeAbsoluteTolerance = 1e-6f;
+
+static const uint32_t s_width  = 67;   // not a multiple of any lane width, to filter row remainders too
+static const uint32_t s_height = 41;
+
+struct LpmSettings
+{
+    bool  shoulder;
+    float softGap;
+    float saturation[3];
+};
+
+// Linear colors from black up to well above hdrMax, including pure primaries, greys and a few exact zeros
+static std::vector<float> createImage()
+{
+    std::mt19937 random(2024);
+    std::uniform_real_distribution<float> stops(-14.0f, 14.0f);
+
+    std::vector<float> image(s_width * s_height * 4);
+    for (uint32_t pixel = 0; pixel < s_width * s_height; ++pixel)
+    {
+        float* color = &image[pixel * 4];
+        for (uint32_t i = 0; i < 3; ++i)
+            color[i] = std::exp2(stops(random));
+
+        switch (pixel % 7)
+        {
+        case 0:
+            color[1] = color[2] = color[0];
+            break;
+        case 1:
+            color[(pixel / 7) % 3] = 0.0f;
+            break;
+        case 2:
+            color[(pixel / 7) % 3] = color[(pixel / 7 + 1) % 3] = 0.0f;
+            break;
+        }
+        color[3] = float(pixel) / float(s_width * s_height);
+    }
+    image[0] = image[1] = image[2] = 0.0f;
+    return image;
+}
+
+static float maxMagnitude(const float* color)
+{
+    return FFX_MAXIMUM(std::fabs(color[0]), FFX_MAXIMUM(std::fabs(color[1]), std::fabs(color[2])));
+}
+
+template<typename L>
+static void mapPixels(const LpmCpuMapper& mapper, const float* input, float* output)
+{
+    typename L::Type r, g, b, a;
+    L::Load(input, r, g, b, a);
+    lpmCpuMap<L>(mapper, r, g, b);
+    L::Store(output, r, g, b, a);
+}
+
+template<typename L>
+static void encodePixels(const LpmCpuMapper& mapper, const float* input, float* output)
+{
+    typename L::Type r, g, b, a;
+    L::Load(input, r, g, b, a);
+    L::Store(output, lpmCpuEncode<L>(mapper, r), lpmCpuEncode<L>(mapper, g), lpmCpuEncode<L>(mapper, b), a);
+}
+
+static uint32_t s_mismatchReports = 0;
+
+static void reportMismatch(const char* stage, FfxLpmColorSpace colorSpace, FfxLpmDisplayMode displayMode, uint32_t index, float value, float expected)
+{
+    FFX_TEST_CHECK(!"lanes disagree");
+    if (s_mismatchReports++ < 16)
+        fprintf(stderr, "%s, color space %d, display mode %d, pixel %u channel %u: %.9g expected %.9g\n",
+                stage, int(colorSpace), int(displayMode), index / 4, index % 4, value, expected);
+}
+
+static void testLanes(FfxLpmColorSpace colorSpace, FfxLpmDisplayMode displayMode, const LpmSettings& settings, const std::vector<float>& image)
+{
+    FfxLpmDispatchDescription dispatchDescription = {};
+    dispatchDescription.shoulder         = settings.shoulder;
+    dispatchDescription.softGap          = settings.softGap;
+    dispatchDescription.hdrMax           = 1847.0f;
+    dispatchDescription.lpmExposure      = 8.0f;
+    dispatchDescription.contrast         = 0.3f;
+    dispatchDescription.shoulderContrast = 1.0f;
+    std::copy(settings.saturation, settings.saturation + 3, dispatchDescription.saturation);
+    dispatchDescription.crosstalk[0]     = 1.0f;
+    dispatchDescription.crosstalk[1]     = 1.0f / 2.0f;
+    dispatchDescription.crosstalk[2]     = 1.0f / 32.0f;
+    dispatchDescription.colorSpace       = colorSpace;
+    dispatchDescription.displayMode      = displayMode;
+
+    // a wide gamut panel for the display color space
+    dispatchDescription.displayRedPrimary[0]   = 0.68f;
+    dispatchDescription.displayRedPrimary[1]   = 0.32f;
+    dispatchDescription.displayGreenPrimary[0] = 0.265f;
+    dispatchDescription.displayGreenPrimary[1] = 0.69f;
+    dispatchDescription.displayBluePrimary[0]  = 0.15f;
+    dispatchDescription.displayBluePrimary[1]  = 0.06f;
+    dispatchDescription.displayWhitePoint[0]   = 0.3127f;
+    dispatchDescription.displayWhitePoint[1]   = 0.329f;
+    dispatchDescription.displayMinLuminance    = 0.05f;
+    dispatchDescription.displayMaxLuminance    = 1000.0f;
+
+    FfxLpmCpuConstants constants;
+    FFX_TEST_CHECK(ffxLpmCalculateCpuConstants(&constants, &dispatchDescription) == FFX_OK);
+
+    LpmCpuMapper mapper;
+    lpmCpuSetupMapper(&mapper, &constants);
+
+    // whole groups of pixels through both lanes, encoding the same mapped colors
+    const uint32_t     pixelCount = s_width * s_height / LpmCpuLanes::Width * LpmCpuLanes::Width;
+    std::vector<float> scalarMapped(pixelCount * 4), vectorMapped(pixelCount * 4);
+    std::vector<float> scalarEncoded(pixelCount * 4), vectorEncoded(pixelCount * 4);
+    for (uint32_t pixel = 0; pixel < pixelCount; ++pixel)
+    {
+        mapPixels<LpmCpuLanesScalar>(mapper, &image[pixel * 4], &scalarMapped[pixel * 4]);
+        encodePixels<LpmCpuLanesScalar>(mapper, &scalarMapped[pixel * 4], &scalarEncoded[pixel * 4]);
+    }
+    for (uint32_t pixel = 0; pixel < pixelCount; pixel += LpmCpuLanes::Width)
+    {
+        mapPixels<LpmCpuLanes>(mapper, &image[pixel * 4], &vectorMapped[pixel * 4]);
+        encodePixels<LpmCpuLanes>(mapper, &scalarMapped[pixel * 4], &vectorEncoded[pixel * 4]);
+    }
+
+    for (uint32_t i = 0; i < pixelCount * 4; ++i)
+    {
+        const float magnitude = maxMagnitude(&scalarMapped[i / 4 * 4]);
+        if (!(std::fabs(vectorMapped[i] - scalarMapped[i]) <= s_mapTolerance * magnitude))
+            reportMismatch("map", colorSpace, displayMode, i, vectorMapped[i], scalarMapped[i]);
+        if (!(std::fabs(vectorEncoded[i] - scalarEncoded[i]) <= FFX_MAXIMUM(s_encodeAbsoluteTolerance, s_encodeTolerance * std::fabs(scalarEncoded[i]))))
+            reportMismatch("encode", colorSpace, displayMode, i, vectorEncoded[i], scalarEncoded[i]);
+    }
+
+    // the filter matches filtering row by row, with padded rows on several threads and in place on one
+    std::vector<float> expected(image.size());
+    for (uint32_t row = 0; row < s_height; ++row)
+        lpmCpuFilterRow(mapper, &image[row * s_width * 4], &expected[row * s_width * 4], s_width);
+
+    const size_t       rowPitch = (s_width + 3) * 4 * sizeof(float);
+    const size_t       rowFloats = rowPitch / sizeof(float);
+    std::vector<float> input(rowFloats * s_height);
+    std::vector<float> output(input.size(), -1.0f);
+    for (uint32_t row = 0; row < s_height; ++row)
+        std::copy(&image[row * s_width * 4], &image[(row + 1) * s_width * 4], &input[row * rowFloats]);
+
+    FfxLpmCpuFilterDescription filterDescription = {};
+    filterDescription.constants      = &constants;
+    filterDescription.input          = input.data();
+    filterDescription.output         = output.data();
+    filterDescription.width          = s_width;
+    filterDescription.height         = s_height;
+    filterDescription.inputRowPitch  = rowPitch;
+    filterDescription.outputRowPitch = rowPitch;
+    filterDescription.threadCount    = 4;
+    FFX_TEST_CHECK(ffxLpmFilterCpu(&filterDescription) == FFX_OK);
+
+    filterDescription.output      = input.data();
+    filterDescription.threadCount = 1;
+    FFX_TEST_CHECK(ffxLpmFilterCpu(&filterDescription) == FFX_OK);
+
+    for (uint32_t row = 0; row < s_height; ++row)
+    {
+        const float* expectedRow = &expected[row * s_width * 4];
+        FFX_TEST_CHECK(memcmp(&output[row * rowFloats], expectedRow, s_width * 4 * sizeof(float)) == 0);
+        FFX_TEST_CHECK(memcmp(&input[row * rowFloats], expectedRow, s_width * 4 * sizeof(float)) == 0);
+        FFX_TEST_CHECK(output[row * rowFloats + s_width * 4] == -1.0f);
+    }
+}
+
+int main()
+{
+    const FfxLpmColorSpace colorSpaces[] = {
+        FfxLpmColorSpace::FFX_LPM_ColorSpace_REC709,
+        FfxLpmColorSpace::FFX_LPM_ColorSpace_P3,
+        FfxLpmColorSpace::FFX_LPM_ColorSpace_REC2020,
+        FfxLpmColorSpace::FFX_LPM_ColorSapce_Display,
+    };
+    const FfxLpmDisplayMode displayModes[] = {
+        FfxLpmDisplayMode::FFX_LPM_DISPLAYMODE_LDR,
+        FfxLpmDisplayMode::FFX_LPM_DISPLAYMODE_HDR10_2084,
+        FfxLpmDisplayMode::FFX_LPM_DISPLAYMODE_HDR10_SCRGB,
+        FfxLpmDisplayMode::FFX_LPM_DISPLAYMODE_FSHDR_2084,
+        FfxLpmDisplayMode::FFX_LPM_DISPLAYMODE_FSHDR_SCRGB,
+    };
+    const LpmSettings settings[] = {
+        { true, 0.0f, { 0.0f, 0.0f, 0.0f } },
+        { false, 0.1f, { -0.2f, 0.1f, 0.3f } },
+    };
+
+    const std::vector<float> image = createImage();
+    for (FfxLpmColorSpace colorSpace : colorSpaces)
+        for (FfxLpmDisplayMode displayMode : displayModes)
+            for (const LpmSettings& setting : settings)
+                testLanes(colorSpace, displayMode, setting, image);
+
+    return FFX_TEST_RESULT();
+}
@@ -0,0 +1,122 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// Measures the CPU cost of an LPM dispatch against a stand-in backend (ffx_lpm_backend_stub.h) which does no work, with
+// steady inputs, which reuse the constants the context cached, and with inputs changing on every dispatch, which set
+// them up again. Setting up the constants alone, with ffxLpmCalculateCpuConstants, is what every dispatch paid before
+// the cache.
+//
+// Steady dispatches have to be cheaper than changing ones.
+
+#include <chrono>
+
+#include "lpm/ffx_lpm_backend_stub.h"
+#include "ffx_test.h"
+
+static const uint32_t s_dispatchCount = 100000;
+static const uint32_t s_roundCount    = 5;
+
+static FfxLpmDispatchDescription getInputs(FfxLpmColorSpace colorSpace, FfxLpmDisplayMode displayMode, float exposure)
+{
+    FfxLpmDispatchDescription description = {};
+    description.inputColor.description.width   = 1920;
+    description.inputColor.description.height  = 1080;
+    description.outputColor.description.width  = 1920;
+    description.outputColor.description.height = 1080;
+    description.shoulder                       = true;
+    description.hdrMax                         = 256.0f;
+    description.lpmExposure                    = exposure;
+    description.contrast                       = 0.3f;
+    description.shoulderContrast               = 1.0f;
+    description.crosstalk[0]                   = 1.0f;
+    description.crosstalk[1]                   = 1.0f / 2.0f;
+    description.crosstalk[2]                   = 1.0f / 32.0f;
+    description.colorSpace                     = colorSpace;
+    description.displayMode                    = displayMode;
+    description.displayRedPrimary[0]           = 0.64f;
+    description.displayRedPrimary[1]           = 0.33f;
+    description.displayGreenPrimary[0]         = 0.30f;
+    description.displayGreenPrimary[1]         = 0.60f;
+    description.displayBluePrimary[0]          = 0.15f;
+    description.displayBluePrimary[1]          = 0.06f;
+    description.displayWhitePoint[0]           = 0.3127f;
+    description.displayWhitePoint[1]           = 0.3290f;
+    description.displayMinLuminance            = 0.05f;
+    description.displayMaxLuminance            = 1000.0f;
+    return description;
+}
+
+// Fastest of a few rounds, in ns per call
+template<typename Call>
+static double measure(Call call)
+{
+    double fastest = 0.0;
+    for (uint32_t round = 0; round < s_roundCount; ++round)
+    {
+        const auto start = std::chrono::high_resolution_clock::now();
+        for (uint32_t i = 0; i < s_dispatchCount; ++i)
+            call(i);
+        const auto   end         = std::chrono::high_resolution_clock::now();
+        const double nanoseconds = std::chrono::duration<double, std::nano>(end - start).count() / s_dispatchCount;
+        fastest                  = round == 0 || nanoseconds < fastest ? nanoseconds : fastest;
+    }
+    return fastest;
+}
+
+int main()
+{
+    LpmBackendStub stub;
+    createLpmBackendStub(stub);
+
+    FfxLpmContextDescription contextDescription = {};
+    contextDescription.backendInterface         = stub.backendInterface;
+
+    FfxLpmContext context;
+    FFX_TEST_CHECK(ffxLpmContextCreate(&context, &contextDescription) == FFX_OK);
+
+    // HDR10 output of a P3 image, and the same with only the exposure changed
+    const FfxLpmDispatchDescription inputs[] = {
+        getInputs(FfxLpmColorSpace::FFX_LPM_ColorSpace_P3, FfxLpmDisplayMode::FFX_LPM_DISPLAYMODE_HDR10_2084, 8.0f),
+        getInputs(FfxLpmColorSpace::FFX_LPM_ColorSpace_P3, FfxLpmDisplayMode::FFX_LPM_DISPLAYMODE_HDR10_2084, 8.5f),
+    };
+
+    FfxErrorCode errorCode = FFX_OK;
+    const double steady    = measure([&](uint32_t) { errorCode |= ffxLpmContextDispatch(&context, &inputs[0]); });
+    const double changing  = measure([&](uint32_t i) { errorCode |= ffxLpmContextDispatch(&context, &inputs[i & 1]); });
+
+    FfxLpmCpuConstants constants;
+    const double       setup = measure([&](uint32_t i) {
+        errorCode |= ffxLpmCalculateCpuConstants(&constants, &inputs[i & 1]);
+    });
+
+    FFX_TEST_CHECK(errorCode == FFX_OK);
+    FFX_TEST_CHECK(stub.uploads == 2 * s_roundCount * s_dispatchCount);
+    FFX_TEST_CHECK(steady < changing);
+
+    FFX_TEST_CHECK(ffxLpmContextDestroy(&context) == FFX_OK);
+
+    printf("fastest of %u rounds of %u calls, ns per call\n", s_roundCount, s_dispatchCount);
+    printf("%-28s %10.1f\n", "dispatch, steady inputs", steady);
+    printf("%-28s %10.1f\n", "dispatch, changing inputs", changing);
+    printf("%-28s %10.1f\n", "constant setup alone", setup);
+
+    return FFX_TEST_RESULT();
+}
@@ -0,0 +1,80 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Benchmarks context creation of every effect built into the SDK against the null backend. Creating a context
+// creates its pipelines, which reflects their bindings and resolves them through the effect's binding maps
+// (ffx_resource_binding_map.h), the cost ffx_resource_binding_map_benchmark measures in isolation.
+//
+// Every context has to be created and destroyed cleanly, and create at least one pipeline.
+
+#include "null_backend/ffx_null_test_effects.h"
+#include "ffx_test.h"
+
+static const uint32_t s_createCount = 50;
+
+int main()
+{
+    printf("%-20s %12s %12s %10s\n", "effect", "mean us", "min us", "pipelines");
+
+    for (const NullTestEffect& effect : s_nullTestEffects)
+    {
+        if (!effect.name)
+            break;
+
+        NullTestBackend backend;
+        FFX_TEST_CHECK(createNullTestBackend(backend, effect.maxContexts));
+
+        // The first creation also pays for loading the shader blobs, keep it out of the measurement
+        void* context = nullptr;
+        FFX_TEST_CHECK(effect.create(backend.backendInterface, &context) == FFX_OK);
+        FFX_TEST_CHECK(context && effect.destroy(context) == FFX_OK);
+        ffxResetStatisticsNull(&backend.backendInterface);
+
+        double totalMicroseconds = 0.0;
+        double minMicroseconds   = 0.0;
+        for (uint32_t create = 0; create < s_createCount; ++create)
+        {
+            const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            const FfxErrorCode errorCode = effect.create(backend.backendInterface, &context);
+            const double microseconds = microsecondsSince(start);
+
+            FFX_TEST_CHECK(errorCode == FFX_OK && context);
+            if (context)
+                FFX_TEST_CHECK(effect.destroy(context) == FFX_OK);
+
+            totalMicroseconds += microseconds;
+            if (create == 0 || microseconds < minMicroseconds)
+                minMicroseconds = microseconds;
+        }
+
+        const FfxNullBackendStatistics statistics = getNullTestStatistics(backend);
+        FFX_TEST_CHECK(statistics.pipelinesCreated > 0);
+
+        printf("%-20s %12.1f %12.1f %10llu\n",
+               effect.name,
+               totalMicroseconds / s_createCount,
+               minMicroseconds,
+               (unsigned long long)(statistics.pipelinesCreated / s_createCount));
+    }
+
+    return FFX_TEST_RESULT();
+}
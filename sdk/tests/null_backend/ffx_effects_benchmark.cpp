@@ -0,0 +1,129 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Benchmarks every effect built into the SDK against the null backend: each effect context is created, dispatched
+// for a number of frames and destroyed, reporting the CPU time of a dispatch, the heap allocations made by it and
+// the jobs, dispatches and barriers it records. The null backend does no GPU work, so the time is the effect's own
+// host side cost plus that of recording into a backend.
+//
+// Allocations are counted through the global operator new of this executable, which the effect libraries linked
+// into it share. Allocations made with malloc directly are not counted.
+//
+// Every effect has to be created, dispatched and destroyed cleanly, and record at least one dispatch per frame.
+
+#include <atomic>
+#include <new>
+#include <stdlib.h>
+
+#include "null_backend/ffx_null_test_effects.h"
+#include "ffx_test.h"
+
+static std::atomic<uint64_t> s_allocationCount(0);
+
+void* operator new(size_t size)
+{
+    ++s_allocationCount;
+    if (void* pointer = malloc(size ? size : 1))
+        return pointer;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept
+{
+    free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept
+{
+    free(pointer);
+}
+
+// The first frames create the effect's internal resources and load its shader blobs
+static const uint32_t s_warmupFrames = 8;
+static const uint32_t s_frameCount   = 200;
+
+int main()
+{
+    printf("%-20s %12s %12s %12s %10s %12s %10s\n", "effect", "mean us", "min us", "allocations", "jobs", "dispatches", "barriers");
+
+    for (const NullTestEffect& effect : s_nullTestEffects)
+    {
+        if (!effect.name)
+            break;
+
+        NullTestBackend backend;
+        FFX_TEST_CHECK(createNullTestBackend(backend, effect.maxContexts));
+
+        void* context = nullptr;
+        FFX_TEST_CHECK(effect.create(backend.backendInterface, &context) == FFX_OK && context);
+        if (!context)
+            continue;
+
+        double   totalMicroseconds = 0.0;
+        double   minMicroseconds   = 0.0;
+        uint64_t allocations       = 0;
+        bool     dispatchFailed    = false;
+        for (uint32_t frame = 0; frame < s_warmupFrames + s_frameCount && !dispatchFailed; ++frame)
+        {
+            if (frame == s_warmupFrames)
+                ffxResetStatisticsNull(&backend.backendInterface);
+
+            resetNullTestCommands(backend);
+
+            const uint64_t                              allocationsBefore = s_allocationCount;
+            const std::chrono::steady_clock::time_point start             = std::chrono::steady_clock::now();
+            const FfxErrorCode errorCode = effect.dispatch(context, backend.commandList, frame);
+            const double       microseconds = microsecondsSince(start);
+
+            dispatchFailed = errorCode != FFX_OK;
+            FFX_TEST_CHECK(errorCode == FFX_OK);
+            FFX_TEST_CHECK(backend.stream.droppedCommandCount == 0);
+            if (frame < s_warmupFrames)
+                continue;
+
+            allocations += s_allocationCount - allocationsBefore;
+            totalMicroseconds += microseconds;
+            if (frame == s_warmupFrames || microseconds < minMicroseconds)
+                minMicroseconds = microseconds;
+        }
+
+        const FfxNullBackendStatistics statistics = getNullTestStatistics(backend);
+        FFX_TEST_CHECK(effect.destroy(context) == FFX_OK);
+        if (dispatchFailed)
+        {
+            printf("%-20s dispatch failed\n", effect.name);
+            continue;
+        }
+        FFX_TEST_CHECK(statistics.dispatches >= s_frameCount);
+
+        printf("%-20s %12.1f %12.1f %12.2f %10.1f %12.1f %10.1f\n",
+               effect.name,
+               totalMicroseconds / s_frameCount,
+               minMicroseconds,
+               double(allocations) / s_frameCount,
+               double(statistics.jobsScheduled) / s_frameCount,
+               double(statistics.dispatches) / s_frameCount,
+               double(statistics.barriers) / s_frameCount);
+    }
+
+    return FFX_TEST_RESULT();
+}
@@ -0,0 +1,108 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <chrono>
+#include <vector>
+
+#include <FidelityFX/host/backends/null/ffx_null.h>
+
+// Helpers for the tests and benchmarks running effects against the null backend.
+
+// A null backend with its own scratch memory and command stream
+struct NullTestBackend
+{
+    std::vector<uint8_t>        scratch;
+    std::vector<FfxNullCommand> commands;
+    FfxNullCommandStream        stream           = {};
+    FfxInterface                backendInterface = {};
+    FfxCommandList              commandList      = nullptr;
+};
+
+static bool createNullTestBackend(NullTestBackend&             backend,
+                                  size_t                       maxContexts,
+                                  uint32_t                     commandCapacity    = 64 * 1024,
+                                  const FfxDeviceCapabilities* deviceCapabilities = nullptr)
+{
+    backend.scratch.assign(ffxGetScratchMemorySizeNull(maxContexts), 0);
+    backend.commands.resize(commandCapacity);
+    backend.stream.commands        = backend.commands.data();
+    backend.stream.commandCapacity = commandCapacity;
+    backend.commandList            = ffxGetCommandListNull(&backend.stream);
+
+    return ffxGetInterfaceNull(&backend.backendInterface, backend.scratch.data(), backend.scratch.size(), maxContexts, deviceCapabilities) == FFX_OK;
+}
+
+// Starts a new recording into the backend's command stream
+static void resetNullTestCommands(NullTestBackend& backend)
+{
+    backend.stream.commandCount        = 0;
+    backend.stream.droppedCommandCount = 0;
+}
+
+static FfxNullBackendStatistics getNullTestStatistics(const NullTestBackend& backend)
+{
+    FfxNullBackendStatistics statistics = {};
+    ffxGetStatisticsNull(&backend.backendInterface, &statistics);
+    return statistics;
+}
+
+// Application resources are identified by any non-null handle
+static FfxResource nullTestTexture(uintptr_t         handle,
+                                   uint32_t          width,
+                                   uint32_t          height,
+                                   FfxSurfaceFormat  format,
+                                   FfxResourceStates state = FFX_RESOURCE_STATE_COMPUTE_READ,
+                                   FfxResourceUsage  usage = FFX_RESOURCE_USAGE_READ_ONLY)
+{
+    FfxResourceDescription description = {};
+    description.type     = FFX_RESOURCE_TYPE_TEXTURE2D;
+    description.format   = format;
+    description.width    = width;
+    description.height   = height;
+    description.depth    = 1;
+    description.mipCount = 1;
+    description.flags    = FFX_RESOURCE_FLAGS_NONE;
+    description.usage    = usage;
+    return ffxGetResourceNull(reinterpret_cast<void*>(handle), description, state);
+}
+
+static FfxResource nullTestBuffer(uintptr_t         handle,
+                                  uint32_t          size,
+                                  uint32_t          stride,
+                                  FfxResourceStates state = FFX_RESOURCE_STATE_UNORDERED_ACCESS)
+{
+    FfxResourceDescription description = {};
+    description.type   = FFX_RESOURCE_TYPE_BUFFER;
+    description.format = FFX_SURFACE_FORMAT_UNKNOWN;
+    description.size   = size;
+    description.stride = stride;
+    description.flags  = FFX_RESOURCE_FLAGS_NONE;
+    description.usage  = FFX_RESOURCE_USAGE_UAV;
+    return ffxGetResourceNull(reinterpret_cast<void*>(handle), description, state);
+}
+
+static double microsecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
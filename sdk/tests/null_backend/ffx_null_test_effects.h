@@ -0,0 +1,929 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include "null_backend/ffx_null_test_backend.h"
+
+// Effect contexts created through a type-erased table, so tests and benchmarks can run every effect built into the
+// SDK against the null backend. The test's build defines FFX_TEST_EFFECT_<NAME> for every effect library it links.
+
+#ifdef FFX_TEST_EFFECT_FSR1
+#include <FidelityFX/host/ffx_fsr1.h>
+#endif
+#ifdef FFX_TEST_EFFECT_FSR2
+#include <FidelityFX/host/ffx_fsr2.h>
+#endif
+#ifdef FFX_TEST_EFFECT_FSR3UPSCALER
+#include <FidelityFX/host/ffx_fsr3upscaler.h>
+#endif
+#ifdef FFX_TEST_EFFECT_FRAMEINTERPOLATION
+#include <FidelityFX/host/ffx_frameinterpolation.h>
+#endif
+#ifdef FFX_TEST_EFFECT_OPTICALFLOW
+#include <FidelityFX/host/ffx_opticalflow.h>
+#endif
+#ifdef FFX_TEST_EFFECT_SPD
+#include <FidelityFX/host/ffx_spd.h>
+#endif
+#ifdef FFX_TEST_EFFECT_CACAO
+#include <FidelityFX/host/ffx_cacao.h>
+#endif
+#ifdef FFX_TEST_EFFECT_LPM
+#include <FidelityFX/host/ffx_lpm.h>
+#endif
+#ifdef FFX_TEST_EFFECT_BLUR
+#include <FidelityFX/host/ffx_blur.h>
+#endif
+#ifdef FFX_TEST_EFFECT_VRS
+#include <FidelityFX/host/ffx_vrs.h>
+#endif
+#ifdef FFX_TEST_EFFECT_CAS
+#include <FidelityFX/host/ffx_cas.h>
+#endif
+#ifdef FFX_TEST_EFFECT_DOF
+#include <FidelityFX/host/ffx_dof.h>
+#endif
+#ifdef FFX_TEST_EFFECT_LENS
+#include <FidelityFX/host/ffx_lens.h>
+#endif
+#ifdef FFX_TEST_EFFECT_PARALLELSORT
+#include <FidelityFX/host/ffx_parallelsort.h>
+#endif
+#ifdef FFX_TEST_EFFECT_DENOISER
+#include <FidelityFX/host/ffx_denoiser.h>
+#endif
+#ifdef FFX_TEST_EFFECT_CLASSIFIER
+#include <FidelityFX/host/ffx_classifier.h>
+#endif
+#ifdef FFX_TEST_EFFECT_SSSR
+#include <FidelityFX/host/ffx_sssr.h>
+#endif
+#if defined(FFX_TEST_EFFECT_BRIXELIZER) || defined(FFX_TEST_EFFECT_BRIXELIZERGI)
+#include <FidelityFX/host/ffx_brixelizer.h>
+#endif
+#ifdef FFX_TEST_EFFECT_BRIXELIZERGI
+#include <FidelityFX/host/ffx_brixelizergi.h>
+#endif
+
+static const FfxDimensions2D s_nullTestRenderSize  = {1920, 1080};
+static const FfxDimensions2D s_nullTestDisplaySize = {2560, 1440};
+
+struct NullTestEffect
+{
+    const char*  name;
+    size_t       maxContexts;                                                                   // Backend contexts used by one effect context
+    FfxErrorCode (*create)(const FfxInterface& backendInterface, void** outContext);
+    FfxErrorCode (*destroy)(void* context);
+    FfxErrorCode (*dispatch)(void* context, FfxCommandList commandList, uint32_t frameIndex);   // Records one frame of the effect
+};
+
+// Application textures the effects read, and write as UAVs
+static FfxResource nullTestInput(uintptr_t handle, FfxDimensions2D size, FfxSurfaceFormat format)
+{
+    return nullTestTexture(handle, size.width, size.height, format);
+}
+
+static FfxResource nullTestOutput(uintptr_t handle, FfxDimensions2D size, FfxSurfaceFormat format)
+{
+    return nullTestTexture(handle, size.width, size.height, format, FFX_RESOURCE_STATE_UNORDERED_ACCESS, FFX_RESOURCE_USAGE_UAV);
+}
+
+static void nullTestIdentity(float matrix[16])
+{
+    for (uint32_t i = 0; i < 16; ++i)
+        matrix[i] = (i % 5 == 0) ? 1.0f : 0.0f;
+}
+
+template <typename Context, typename Create>
+static FfxErrorCode createNullTestContext(void** outContext, Create create)
+{
+    Context*           context   = new Context();
+    const FfxErrorCode errorCode = create(context);
+    if (errorCode != FFX_OK)
+    {
+        delete context;
+        context = nullptr;
+    }
+    *outContext = context;
+    return errorCode;
+}
+
+template <typename Context, FfxErrorCode (*Destroy)(Context*)>
+static FfxErrorCode destroyNullTestContext(void* context)
+{
+    const FfxErrorCode errorCode = Destroy(static_cast<Context*>(context));
+    delete static_cast<Context*>(context);
+    return errorCode;
+}
+
+#ifdef FFX_TEST_EFFECT_FSR1
+static FfxErrorCode createNullTestFsr1(const FfxInterface& backendInterface, void** outContext)
+{
+    FfxFsr1ContextDescription description = {};
+    description.flags            = FFX_FSR1_ENABLE_RCAS;
+    description.outputFormat     = FFX_SURFACE_FORMAT_R8G8B8A8_UNORM;
+    description.maxRenderSize    = s_nullTestRenderSize;
+    description.displaySize      = s_nullTestDisplaySize;
+    description.backendInterface = backendInterface;
+    return createNullTestContext<FfxFsr1Context>(outContext, [&](FfxFsr1Context* context) { return ffxFsr1ContextCreate(context, &description); });
+}
+
+static FfxErrorCode dispatchNullTestFsr1(void* context, FfxCommandList commandList, uint32_t)
+{
+    FfxFsr1DispatchDescription description = {};
+    description.commandList      = commandList;
+    description.color            = nullTestInput(1, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R8G8B8A8_UNORM);
+    description.output           = nullTestOutput(2, s_nullTestDisplaySize, FFX_SURFACE_FORMAT_R8G8B8A8_UNORM);
+    description.renderSize       = s_nullTestRenderSize;
+    description.enableSharpening = true;
+    description.sharpness        = 0.2f;
+    return ffxFsr1ContextDispatch(static_cast<FfxFsr1Context*>(context), &description);
+}
+#endif
+
+#ifdef FFX_TEST_EFFECT_FSR2
+static FfxErrorCode createNullTestFsr2(const FfxInterface& backendInterface, void** outContext)
+{
+    FfxFsr2ContextDescription description = {};
+    description.flags            = FFX_FSR2_ENABLE_AUTO_EXPOSURE | FFX_FSR2_ENABLE_DEPTH_INVERTED;
+    description.maxRenderSize    = s_nullTestRenderSize;
+    description.displaySize      = s_nullTestDisplaySize;
+    description.backendInterface = backendInterface;
+    return createNullTestContext<FfxFsr2Context>(outContext, [&](FfxFsr2Context* context) { return ffxFsr2ContextCreate(context, &description); });
+}
+
+static FfxErrorCode dispatchNullTestFsr2(void* context, FfxCommandList commandList, uint32_t frameIndex)
+{
+    FfxFsr2DispatchDescription description = {};
+    description.commandList             = commandList;
+    description.color                   = nullTestInput(1, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT);
+    description.depth                   = nullTestInput(2, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R32_FLOAT);
+    description.motionVectors           = nullTestInput(3, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R16G16_FLOAT);
+    description.reactive                = nullTestInput(4, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R8_UNORM);
+    description.output                  = nullTestOutput(5, s_nullTestDisplaySize, FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT);
+    description.motionVectorScale       = {float(s_nullTestRenderSize.width), float(s_nullTestRenderSize.height)};
+    description.renderSize              = s_nullTestRenderSize;
+    description.enableSharpening        = true;
+    description.sharpness               = 0.5f;
+    description.frameTimeDelta          = 16.6f;
+    description.preExposure             = 1.0f;
+    description.reset                   = frameIndex == 0;
+    description.cameraNear              = 0.1f;
+    description.cameraFar               = 1000.0f;
+    description.cameraFovAngleVertical  = 1.0f;
+    description.viewSpaceToMetersFactor = 1.0f;
+    ffxFsr2GetJitterOffset(&description.jitterOffset.x, &description.jitterOffset.y, int32_t(frameIndex),
+                           ffxFsr2GetJitterPhaseCount(s_nullTestRenderSize.width, s_nullTestDisplaySize.width));
+    return ffxFsr2ContextDispatch(static_cast<FfxFsr2Context*>(context), &description);
+}
+#endif
+
+#ifdef FFX_TEST_EFFECT_FSR3UPSCALER
+static FfxErrorCode createNullTestFsr3Upscaler(const FfxInterface& backendInterface, void** outContext)
+{
+    FfxFsr3UpscalerContextDescription description = {};
+    description.flags            = FFX_FSR3UPSCALER_ENABLE_AUTO_EXPOSURE | FFX_FSR3UPSCALER_ENABLE_DEPTH_INVERTED;
+    description.maxRenderSize    = s_nullTestRenderSize;
+    description.maxUpscaleSize   = s_nullTestDisplaySize;
+    description.backendInterface = backendInterface;
+    return createNullTestContext<FfxFsr3UpscalerContext>(outContext, [&](FfxFsr3UpscalerContext* context) { return ffxFsr3UpscalerContextCreate(context, &description); });
+}
+
+static FfxErrorCode dispatchNullTestFsr3Upscaler(void* context, FfxCommandList commandList, uint32_t frameIndex)
+{
+    FfxFsr3UpscalerDispatchDescription description = {};
+    description.commandList                   = commandList;
+    description.color                         = nullTestInput(1, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT);
+    description.depth                         = nullTestInput(2, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R32_FLOAT);
+    description.motionVectors                 = nullTestInput(3, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R16G16_FLOAT);
+    description.reactive                      = nullTestInput(4, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R8_UNORM);
+    description.dilatedDepth                  = nullTestOutput(5, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R32_FLOAT);
+    description.dilatedMotionVectors          = nullTestOutput(6, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R16G16_FLOAT);
+    description.reconstructedPrevNearestDepth = nullTestOutput(7, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R32_UINT);
+    description.output                        = nullTestOutput(8, s_nullTestDisplaySize, FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT);
+    description.motionVectorScale             = {float(s_nullTestRenderSize.width), float(s_nullTestRenderSize.height)};
+    description.renderSize                    = s_nullTestRenderSize;
+    description.upscaleSize                   = s_nullTestDisplaySize;
+    description.enableSharpening              = true;
+    description.sharpness                     = 0.5f;
+    description.frameTimeDelta                = 16.6f;
+    description.preExposure                   = 1.0f;
+    description.reset                         = frameIndex == 0;
+    description.cameraNear                    = 0.1f;
+    description.cameraFar                     = 1000.0f;
+    description.cameraFovAngleVertical        = 1.0f;
+    description.viewSpaceToMetersFactor       = 1.0f;
+    ffxFsr3UpscalerGetJitterOffset(&description.jitterOffset.x, &description.jitterOffset.y, int32_t(frameIndex),
+                                   ffxFsr3UpscalerGetJitterPhaseCount(s_nullTestRenderSize.width, s_nullTestDisplaySize.width));
+    return ffxFsr3UpscalerContextDispatch(static_cast<FfxFsr3UpscalerContext*>(context), &description);
+}
+#endif
+
+#ifdef FFX_TEST_EFFECT_FRAMEINTERPOLATION
+static FfxErrorCode createNullTestFrameInterpolation(const FfxInterface& backendInterface, void** outContext)
+{
+    FfxFrameInterpolationContextDescription description = {};
+    description.flags                             = FFX_FRAMEINTERPOLATION_ENABLE_DEPTH_INVERTED;
+    description.maxRenderSize                     = s_nullTestRenderSize;
+    description.displaySize                       = s_nullTestDisplaySize;
+    description.backBufferFormat                  = FFX_SURFACE_FORMAT_R8G8B8A8_UNORM;
+    description.previousInterpolationSourceFormat = FFX_SURFACE_FORMAT_R8G8B8A8_UNORM;
+    description.backendInterface                  = backendInterface;
+    return createNullTestContext<FfxFrameInterpolationContext>(outContext, [&](FfxFrameInterpolationContext* context) { return ffxFrameInterpolationContextCreate(context, &description); });
+}
+
+static FfxErrorCode dispatchNullTestFrameInterpolation(void* context, FfxCommandList commandList, uint32_t frameIndex)
+{
+    FfxFrameInterpolationDispatchDescription description = {};
+    description.commandList                     = commandList;
+    description.displaySize                     = s_nullTestDisplaySize;
+    description.renderSize                      = s_nullTestRenderSize;
+    description.currentBackBuffer               = nullTestInput(1, s_nullTestDisplaySize, FFX_SURFACE_FORMAT_R8G8B8A8_UNORM);
+    description.output                          = nullTestOutput(2, s_nullTestDisplaySize, FFX_SURFACE_FORMAT_R8G8B8A8_UNORM);
+    description.interpolationRect               = {0, 0, int32_t(s_nullTestDisplaySize.width), int32_t(s_nullTestDisplaySize.height)};
+    description.opticalFlowVector               = nullTestInput(3, {s_nullTestDisplaySize.width / 8, s_nullTestDisplaySize.height / 8}, FFX_SURFACE_FORMAT_R16G16_SINT);
+    description.opticalFlowSceneChangeDetection = nullTestBuffer(4, 3 * sizeof(uint32_t), sizeof(uint32_t), FFX_RESOURCE_STATE_COMPUTE_READ);
+    description.opticalFlowBufferSize           = {s_nullTestDisplaySize.width / 8, s_nullTestDisplaySize.height / 8};
+    description.opticalFlowScale                = {1.0f / s_nullTestDisplaySize.width, 1.0f / s_nullTestDisplaySize.height};
+    description.opticalFlowBlockSize            = 8;
+    description.cameraNear                      = 0.1f;
+    description.cameraFar                       = 1000.0f;
+    description.cameraFovAngleVertical          = 1.0f;
+    description.viewSpaceToMetersFactor         = 1.0f;
+    description.frameTimeDelta                  = 16.6f;
+    description.reset                           = frameIndex == 0;
+    description.backBufferTransferFunction      = FFX_BACKBUFFER_TRANSFER_FUNCTION_SRGB;
+    description.minMaxLuminance[0]              = 0.0f;
+    description.minMaxLuminance[1]              = 1.0f;
+    description.frameID                         = frameIndex;
+    description.dilatedDepth                    = nullTestInput(5, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R32_FLOAT);
+    description.dilatedMotionVectors            = nullTestInput(6, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R16G16_FLOAT);
+    description.reconstructedPrevDepth          = nullTestInput(7, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R32_UINT);
+    return ffxFrameInterpolationDispatch(static_cast<FfxFrameInterpolationContext*>(context), &description);
+}
+#endif
+
+#ifdef FFX_TEST_EFFECT_OPTICALFLOW
+static FfxErrorCode createNullTestOpticalflow(const FfxInterface& backendInterface, void** outContext)
+{
+    FfxOpticalflowContextDescription description = {};
+    description.backendInterface = backendInterface;
+    description.resolution       = s_nullTestDisplaySize;
+    return createNullTestContext<FfxOpticalflowContext>(outContext, [&](FfxOpticalflowContext* context) { return ffxOpticalflowContextCreate(context, &description); });
+}
+
+static FfxErrorCode dispatchNullTestOpticalflow(void* context, FfxCommandList commandList, uint32_t frameIndex)
+{
+    FfxOpticalflowDispatchDescription description = {};
+    description.commandList                = commandList;
+    description.color                      = nullTestInput(1, s_nullTestDisplaySize, FFX_SURFACE_FORMAT_R8G8B8A8_UNORM);
+    description.opticalFlowVector          = nullTestOutput(2, {s_nullTestDisplaySize.width / 8, s_nullTestDisplaySize.height / 8}, FFX_SURFACE_FORMAT_R16G16_SINT);
+    description.opticalFlowSCD             = nullTestBuffer(3, 3 * sizeof(uint32_t), sizeof(uint32_t));
+    description.reset                      = frameIndex == 0;
+    description.backbufferTransferFunction = FFX_BACKBUFFER_TRANSFER_FUNCTION_SRGB;
+    description.minMaxLuminance            = {0.0f, 1.0f};
+    return ffxOpticalflowContextDispatch(static_cast<FfxOpticalflowContext*>(context), &description);
+}
+#endif
+
+#ifdef FFX_TEST_EFFECT_SPD
+static FfxErrorCode createNullTestSpd(const FfxInterface& backendInterface, void** outContext)
+{
+    FfxSpdContextDescription description = {};
+    description.flags            = FFX_SPD_SAMPLER_LOAD | FFX_SPD_WAVE_INTEROP_WAVE_OPS | FFX_SPD_MATH_NONPACKED;
+    description.downsampleFilter = FFX_SPD_DOWNSAMPLE_FILTER_MEAN;
+    description.backendInterface = backendInterface;
+    return createNullTestContext<FfxSpdContext>(outContext, [&](FfxSpdContext* context) { return ffxSpdContextCreate(context, &description); });
+}
+
+static FfxErrorCode dispatchNullTestSpd(void* context, FfxCommandList commandList, uint32_t)
+{
+    // A full mip chain, downsampled from its first mip
+    FfxResourceDescription resourceDescription = {};
+    resourceDescription.type     = FFX_RESOURCE_TYPE_TEXTURE2D;
+    resourceDescription.format   = FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT;
+    resourceDescription.width    = 4096;
+    resourceDescription.height   = 4096;
+    resourceDescription.depth    = 1;
+    resourceDescription.mipCount = 13;
+    resourceDescription.usage    = FFX_RESOURCE_USAGE_UAV;
+
+    FfxSpdDispatchDescription description = {};
+    description.commandList = commandList;
+    description.resource    = ffxGetResourceNull(reinterpret_cast<void*>(uintptr_t(1)), resourceDescription, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+    return ffxSpdContextDispatch(static_cast<FfxSpdContext*>(context), &description);
+}
+#endif
+
+#ifdef FFX_TEST_EFFECT_CACAO
+static FfxErrorCode createNullTestCacao(const FfxInterface& backendInterface, void** outContext)
+{
+    FfxCacaoContextDescription description = {};
+    description.width              = s_nullTestRenderSize.width;
+    description.height             = s_nullTestRenderSize.height;
+    description.useDownsampledSsao = true;
+    description.backendInterface   = backendInterface;
+    return createNullTestContext<FfxCacaoContext>(outContext, [&](FfxCacaoContext* context) { return ffxCacaoContextCreate(context, &description); });
+}
+
+static FfxErrorCode dispatchNullTestCacao(void* context, FfxCommandList commandList, uint32_t)
+{
+    FfxFloat32x4x4 projection;
+    FfxFloat32x4x4 normalsToView;
+    nullTestIdentity(projection);
+    nullTestIdentity(normalsToView);
+
+    FfxCacaoDispatchDescription description = {};
+    description.commandList     = commandList;
+    description.depthBuffer     = nullTestInput(1, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R32_FLOAT);
+    description.normalBuffer    = nullTestInput(2, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R10G10B10A2_UNORM);
+    description.outputBuffer    = nullTestOutput(3, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R8_UNORM);
+    description.proj            = &projection;
+    description.normalsToView   = &normalsToView;
+    description.normalUnpackMul = 2.0f;
+    description.normalUnpackAdd = -1.0f;
+    return ffxCacaoContextDispatch(static_cast<FfxCacaoContext*>(context), &description);
+}
+#endif
+
+#ifdef FFX_TEST_EFFECT_LPM
+static FfxErrorCode createNullTestLpm(const FfxInterface& backendInterface, void** outContext)
+{
+    FfxLpmContextDescription description = {};
+    description.backendInterface = backendInterface;
+    return createNullTestContext<FfxLpmContext>(outContext, [&](FfxLpmContext* context) { return ffxLpmContextCreate(context, &description); });
+}
+
+static FfxErrorCode dispatchNullTestLpm(void* context, FfxCommandList commandList, uint32_t)
+{
+    FfxLpmDispatchDescription description = {};
+    description.commandList            = commandList;
+    description.inputColor             = nullTestInput(1, s_nullTestDisplaySize, FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT);
+    description.outputColor            = nullTestOutput(2, s_nullTestDisplaySize, FFX_SURFACE_FORMAT_R8G8B8A8_UNORM);
+    description.shoulder               = true;
+    description.softGap                = 1.0f / 32.0f;
+    description.hdrMax                 = 1847.0f;
+    description.lpmExposure            = 8.0f;
+    description.contrast               = 0.3f;
+    description.shoulderContrast       = 1.0f;
+    description.crosstalk[0]           = 1.0f;
+    description.crosstalk[1]           = 1.0f / 2.0f;
+    description.crosstalk[2]           = 1.0f / 32.0f;
+    description.colorSpace             = FfxLpmColorSpace::FFX_LPM_ColorSpace_REC709;
+    description.displayMode            = FfxLpmDisplayMode::FFX_LPM_DISPLAYMODE_LDR;
+    description.displayRedPrimary[0]   = 0.64f;
+    description.displayRedPrimary[1]   = 0.33f;
+    description.displayGreenPrimary[0] = 0.30f;
+    description.displayGreenPrimary[1] = 0.60f;
+    description.displayBluePrimary[0]  = 0.15f;
+    description.displayBluePrimary[1]  = 0.06f;
+    description.displayWhitePoint[0]   = 0.3127f;
+    description.displayWhitePoint[1]   = 0.329f;
+    description.displayMinLuminance    = 0.0f;
+    description.displayMaxLuminance    = 300.0f;
+    return ffxLpmContextDispatch(static_cast<FfxLpmContext*>(context), &description);
+}
+#endif
+
+#ifdef FFX_TEST_EFFECT_BLUR
+static FfxErrorCode createNullTestBlur(const FfxInterface& backendInterface, void** outContext)
+{
+    FfxBlurContextDescription description = {};
+    description.kernelPermutations = FFX_BLUR_KERNEL_PERMUTATION_0;
+    description.kernelSizes        = FFX_BLUR_KERNEL_SIZE_3x3 | FFX_BLUR_KERNEL_SIZE_9x9 | FFX_BLUR_KERNEL_SIZE_21x21;
+    description.floatPrecision     = FFX_BLUR_FLOAT_PRECISION_32BIT;
+    description.backendInterface   = backendInterface;
+    return createNullTestContext<FfxBlurContext>(outContext, [&](FfxBlurContext* context) { return ffxBlurContextCreate(context, &description); });
+}
+
+static FfxErrorCode dispatchNullTestBlur(void* context, FfxCommandList commandList, uint32_t)
+{
+    FfxBlurDispatchDescription description = {};
+    description.commandList        = commandList;
+    description.kernelPermutation  = FFX_BLUR_KERNEL_PERMUTATION_0;
+    description.kernelSize         = FFX_BLUR_KERNEL_SIZE_9x9;
+    description.inputAndOutputSize = s_nullTestRenderSize;
+    description.input              = nullTestInput(1, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R8G8B8A8_UNORM);
+    description.output             = nullTestOutput(2, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R8G8B8A8_UNORM);
+    return ffxBlurContextDispatch(static_cast<FfxBlurContext*>(context), &description);
+}
+#endif
+
+#ifdef FFX_TEST_EFFECT_VRS
+static FfxErrorCode createNullTestVrs(const FfxInterface& backendInterface, void** outContext)
+{
+    FfxVrsContextDescription description = {};
+    description.flags                    = FFX_VRS_ALLOW_ADDITIONAL_SHADING_RATES;
+    description.shadingRateImageTileSize = 16;
+    description.backendInterface         = backendInterface;
+    return createNullTestContext<FfxVrsContext>(outContext, [&](FfxVrsContext* context) { return ffxVrsContextCreate(context, &description); });
+}
+
+static FfxErrorCode dispatchNullTestVrs(void* context, FfxCommandList commandList, uint32_t)
+{
+    FfxVrsDispatchDescription description = {};
+    description.commandList       = commandList;
+    description.historyColor      = nullTestInput(1, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R8G8B8A8_UNORM);
+    description.motionVectors     = nullTestInput(2, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R16G16_FLOAT);
+    description.output            = nullTestOutput(3, {s_nullTestRenderSize.width / 16, s_nullTestRenderSize.height / 16}, FFX_SURFACE_FORMAT_R8_UINT);
+    description.renderSize        = s_nullTestRenderSize;
+    description.varianceCutoff    = 0.05f;
+    description.motionFactor      = 0.1f;
+    description.tileSize          = 16;
+    description.motionVectorScale = {1.0f, 1.0f};
+    return ffxVrsContextDispatch(static_cast<FfxVrsContext*>(context), &description);
+}
+#endif
+
+#ifdef FFX_TEST_EFFECT_CAS
+static FfxErrorCode createNullTestCas(const FfxInterface& backendInterface, void** outContext)
+{
+    FfxCasContextDescription description = {};
+    description.flags                = FFX_CAS_SHARPEN_ONLY;
+    description.colorSpaceConversion = FFX_CAS_COLOR_SPACE_LINEAR;
+    description.maxRenderSize        = s_nullTestDisplaySize;
+    description.displaySize          = s_nullTestDisplaySize;
+    description.backendInterface     = backendInterface;
+    return createNullTestContext<FfxCasContext>(outContext, [&](FfxCasContext* context) { return ffxCasContextCreate(context, &description); });
+}
+
+static FfxErrorCode dispatchNullTestCas(void* context, FfxCommandList commandList, uint32_t)
+{
+    FfxCasDispatchDescription description = {};
+    description.commandList = commandList;
+    description.color       = nullTestInput(1, s_nullTestDisplaySize, FFX_SURFACE_FORMAT_R8G8B8A8_UNORM);
+    description.output      = nullTestOutput(2, s_nullTestDisplaySize, FFX_SURFACE_FORMAT_R8G8B8A8_UNORM);
+    description.renderSize  = s_nullTestDisplaySize;
+    description.sharpness   = 0.8f;
+    return ffxCasContextDispatch(static_cast<FfxCasContext*>(context), &description);
+}
+#endif
+
+#ifdef FFX_TEST_EFFECT_DOF
+static FfxErrorCode createNullTestDof(const FfxInterface& backendInterface, void** outContext)
+{
+    FfxDofContextDescription description = {};
+    description.flags            = FFX_DOF_REVERSE_DEPTH;
+    description.quality          = 10;
+    description.resolution       = s_nullTestRenderSize;
+    description.backendInterface = backendInterface;
+    description.cocLimitFactor   = 0.01f;
+    return createNullTestContext<FfxDofContext>(outContext, [&](FfxDofContext* context) { return ffxDofContextCreate(context, &description); });
+}
+
+static FfxErrorCode dispatchNullTestDof(void* context, FfxCommandList commandList, uint32_t)
+{
+    FfxDofDispatchDescription description = {};
+    description.commandList = commandList;
+    description.color       = nullTestInput(1, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT);
+    description.depth       = nullTestInput(2, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R32_FLOAT);
+    description.output      = nullTestOutput(3, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT);
+    description.cocScale    = 10.0f;
+    description.cocBias     = -1.0f;
+    return ffxDofContextDispatch(static_cast<FfxDofContext*>(context), &description);
+}
+#endif
+
+#ifdef FFX_TEST_EFFECT_LENS
+static FfxErrorCode createNullTestLens(const FfxInterface& backendInterface, void** outContext)
+{
+    FfxLensContextDescription description = {};
+    description.flags            = FFX_LENS_MATH_NONPACKED;
+    description.outputFormat     = FFX_SURFACE_FORMAT_R8G8B8A8_UNORM;
+    description.floatPrecision   = FFX_LENS_FLOAT_PRECISION_32BIT;
+    description.backendInterface = backendInterface;
+    return createNullTestContext<FfxLensContext>(outContext, [&](FfxLensContext* context) { return ffxLensContextCreate(context, &description); });
+}
+
+static FfxErrorCode dispatchNullTestLens(void* context, FfxCommandList commandList, uint32_t frameIndex)
+{
+    FfxLensDispatchDescription description = {};
+    description.commandList    = commandList;
+    description.resource       = nullTestInput(1, s_nullTestDisplaySize, FFX_SURFACE_FORMAT_R8G8B8A8_UNORM);
+    description.resourceOutput = nullTestOutput(2, s_nullTestDisplaySize, FFX_SURFACE_FORMAT_R8G8B8A8_UNORM);
+    description.renderSize     = s_nullTestDisplaySize;
+    description.grainScale     = 1.0f;
+    description.grainAmount    = 0.7f;
+    description.grainSeed      = frameIndex;
+    description.chromAb        = 1.65f;
+    description.vignette       = 0.6f;
+    return ffxLensContextDispatch(static_cast<FfxLensContext*>(context), &description);
+}
+#endif
+
+#ifdef FFX_TEST_EFFECT_PARALLELSORT
+static FfxErrorCode createNullTestParallelSort(const FfxInterface& backendInterface, void** outContext)
+{
+    FfxParallelSortContextDescription description = {};
+    description.flags            = FFX_PARALLELSORT_PAYLOAD_SORT;
+    description.maxEntries       = 1u << 20;
+    description.backendInterface = backendInterface;
+    return createNullTestContext<FfxParallelSortContext>(outContext, [&](FfxParallelSortContext* context) { return ffxParallelSortContextCreate(context, &description); });
+}
+
+static FfxErrorCode dispatchNullTestParallelSort(void* context, FfxCommandList commandList, uint32_t)
+{
+    const uint32_t keyCount = 1u << 20;
+
+    FfxParallelSortDispatchDescription description = {};
+    description.commandList   = commandList;
+    description.keyBuffer     = nullTestBuffer(1, keyCount * sizeof(uint32_t), sizeof(uint32_t));
+    description.payloadBuffer = nullTestBuffer(2, keyCount * sizeof(uint32_t), sizeof(uint32_t));
+    description.numKeysToSort = keyCount;
+    return ffxParallelSortContextDispatch(static_cast<FfxParallelSortContext*>(context), &description);
+}
+#endif
+
+#ifdef FFX_TEST_EFFECT_DENOISER
+static FfxErrorCode createNullTestDenoiser(const FfxInterface& backendInterface, void** outContext)
+{
+    FfxDenoiserContextDescription description = {};
+    description.flags                      = FFX_DENOISER_REFLECTIONS | FFX_DENOISER_ENABLE_DEPTH_INVERTED;
+    description.windowSize                 = s_nullTestRenderSize;
+    description.normalsHistoryBufferFormat = FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT;
+    description.backendInterface           = backendInterface;
+    return createNullTestContext<FfxDenoiserContext>(outContext, [&](FfxDenoiserContext* context) { return ffxDenoiserContextCreate(context, &description); });
+}
+
+static FfxErrorCode dispatchNullTestDenoiser(void* context, FfxCommandList commandList, uint32_t frameIndex)
+{
+    const uint32_t tileCount = ((s_nullTestRenderSize.width + 7) / 8) * ((s_nullTestRenderSize.height + 7) / 8);
+
+    FfxDenoiserReflectionsDispatchDescription description = {};
+    description.commandList             = commandList;
+    description.depthHierarchy          = nullTestInput(1, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R32_FLOAT);
+    description.motionVectors           = nullTestInput(2, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R16G16_FLOAT);
+    description.normal                  = nullTestInput(3, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R10G10B10A2_UNORM);
+    description.radianceA               = nullTestOutput(4, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT);
+    description.radianceB               = nullTestOutput(5, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT);
+    description.varianceA               = nullTestOutput(6, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R16_FLOAT);
+    description.varianceB               = nullTestOutput(7, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R16_FLOAT);
+    description.extractedRoughness      = nullTestInput(8, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R8_UNORM);
+    description.denoiserTileList        = nullTestBuffer(9, tileCount * sizeof(uint32_t), sizeof(uint32_t));
+    description.indirectArgumentsBuffer = nullTestBuffer(10, 6 * sizeof(uint32_t), sizeof(uint32_t), FFX_RESOURCE_STATE_INDIRECT_ARGUMENT);
+    description.output                  = nullTestOutput(11, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT);
+    description.renderSize              = s_nullTestRenderSize;
+    description.motionVectorScale       = {1.0f, 1.0f};
+    nullTestIdentity(description.invProjection);
+    nullTestIdentity(description.invView);
+    nullTestIdentity(description.prevViewProjection);
+    description.normalsUnpackMul        = 2.0f;
+    description.normalsUnpackAdd        = -1.0f;
+    description.isRoughnessPerceptual   = true;
+    description.temporalStabilityFactor = 0.7f;
+    description.roughnessThreshold      = 0.2f;
+    description.frameIndex              = frameIndex;
+    description.reset                   = frameIndex == 0;
+    return ffxDenoiserContextDispatchReflections(static_cast<FfxDenoiserContext*>(context), &description);
+}
+#endif
+
+#ifdef FFX_TEST_EFFECT_CLASSIFIER
+static FfxErrorCode createNullTestClassifier(const FfxInterface& backendInterface, void** outContext)
+{
+    FfxClassifierContextDescription description = {};
+    description.flags            = FFX_CLASSIFIER_SHADOW | FFX_CLASSIFIER_CLASSIFY_BY_CASCADES | FFX_CLASSIFIER_ENABLE_DEPTH_INVERTED;
+    description.resolution       = s_nullTestRenderSize;
+    description.backendInterface = backendInterface;
+    return createNullTestContext<FfxClassifierContext>(outContext, [&](FfxClassifierContext* context) { return ffxClassifierContextCreate(context, &description); });
+}
+
+static FfxErrorCode dispatchNullTestClassifier(void* context, FfxCommandList commandList, uint32_t)
+{
+    const uint32_t tileCount = ((s_nullTestRenderSize.width + 7) / 8) * ((s_nullTestRenderSize.height + 3) / 4);
+
+    FfxClassifierShadowDispatchDescription description = {};
+    description.commandList = commandList;
+    description.depth       = nullTestInput(1, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R32_FLOAT);
+    description.normals     = nullTestInput(2, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R10G10B10A2_UNORM);
+    for (uint32_t cascade = 0; cascade < FFX_CLASSIFIER_MAX_SHADOW_MAP_TEXTURES_COUNT; ++cascade)
+        description.shadowMaps[cascade] = nullTestInput(3 + cascade, {2048, 2048}, FFX_SURFACE_FORMAT_R32_FLOAT);
+    description.workQueue         = nullTestBuffer(8, tileCount * 4 * sizeof(uint32_t), 4 * sizeof(uint32_t));
+    description.workQueueCount    = nullTestBuffer(9, 4 * sizeof(uint32_t), sizeof(uint32_t));
+    description.rayHitTexture     = nullTestOutput(10, {(s_nullTestRenderSize.width + 7) / 8, (s_nullTestRenderSize.height + 3) / 4}, FFX_SURFACE_FORMAT_R32_UINT);
+    description.normalsUnPackMul  = 2.0f;
+    description.normalsUnPackAdd  = -1.0f;
+    description.lightDir[1]       = -1.0f;
+    description.sunSizeLightSpace = 0.01f;
+    description.tileCutOff        = 16;
+    description.cascadeCount      = FFX_CLASSIFIER_MAX_SHADOW_MAP_TEXTURES_COUNT;
+    description.blockerOffset     = 0.002f;
+    description.cascadeSize       = 2048.0f;
+    for (uint32_t cascade = 0; cascade < FFX_CLASSIFIER_MAX_SHADOW_MAP_TEXTURES_COUNT; ++cascade)
+    {
+        for (uint32_t i = 0; i < 3; ++i)
+            description.cascadeScale[cascade][i] = 1.0f / float(1u << cascade);
+    }
+    nullTestIdentity(description.viewToWorld);
+    nullTestIdentity(description.lightView);
+    nullTestIdentity(description.inverseLightView);
+    return ffxClassifierContextShadowDispatch(static_cast<FfxClassifierContext*>(context), &description);
+}
+#endif
+
+#ifdef FFX_TEST_EFFECT_SSSR
+static FfxErrorCode createNullTestSssr(const FfxInterface& backendInterface, void** outContext)
+{
+    FfxSssrContextDescription description = {};
+    description.flags                      = FFX_SSSR_ENABLE_DEPTH_INVERTED;
+    description.renderSize                 = s_nullTestRenderSize;
+    description.normalsHistoryBufferFormat = FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT;
+    description.backendInterface           = backendInterface;
+    return createNullTestContext<FfxSssrContext>(outContext, [&](FfxSssrContext* context) { return ffxSssrContextCreate(context, &description); });
+}
+
+static FfxErrorCode dispatchNullTestSssr(void* context, FfxCommandList commandList, uint32_t)
+{
+    FfxResourceDescription environmentMapDescription = {};
+    environmentMapDescription.type     = FFX_RESOURCE_TYPE_TEXTURE_CUBE;
+    environmentMapDescription.format   = FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT;
+    environmentMapDescription.width    = 256;
+    environmentMapDescription.height   = 256;
+    environmentMapDescription.depth    = 6;
+    environmentMapDescription.mipCount = 9;
+    environmentMapDescription.usage    = FFX_RESOURCE_USAGE_READ_ONLY;
+
+    FfxSssrDispatchDescription description = {};
+    description.commandList                          = commandList;
+    description.color                                = nullTestInput(1, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT);
+    description.depth                                = nullTestInput(2, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R32_FLOAT);
+    description.motionVectors                        = nullTestInput(3, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R16G16_FLOAT);
+    description.normal                               = nullTestInput(4, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R10G10B10A2_UNORM);
+    description.materialParameters                   = nullTestInput(5, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R8G8B8A8_UNORM);
+    description.environmentMap                       = ffxGetResourceNull(reinterpret_cast<void*>(uintptr_t(6)), environmentMapDescription, FFX_RESOURCE_STATE_COMPUTE_READ);
+    description.brdfTexture                          = nullTestInput(7, {128, 128}, FFX_SURFACE_FORMAT_R16G16_FLOAT);
+    description.output                               = nullTestOutput(8, s_nullTestRenderSize, FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT);
+    nullTestIdentity(description.invViewProjection);
+    nullTestIdentity(description.projection);
+    nullTestIdentity(description.invProjection);
+    nullTestIdentity(description.view);
+    nullTestIdentity(description.invView);
+    nullTestIdentity(description.prevViewProjection);
+    description.renderSize                           = s_nullTestRenderSize;
+    description.motionVectorScale                    = {1.0f, 1.0f};
+    description.iblFactor                            = 0.5f;
+    description.normalUnPackMul                      = 2.0f;
+    description.normalUnPackAdd                      = -1.0f;
+    description.roughnessChannel                     = 1;
+    description.isRoughnessPerceptual                = true;
+    description.temporalStabilityFactor              = 0.7f;
+    description.depthBufferThickness                 = 0.015f;
+    description.roughnessThreshold                   = 0.2f;
+    description.varianceThreshold                    = 0.0f;
+    description.maxTraversalIntersections            = 128;
+    description.minTraversalOccupancy                = 4;
+    description.mostDetailedMip                      = 0;
+    description.samplesPerQuad                       = 1;
+    description.temporalVarianceGuidedTracingEnabled = 1;
+    return ffxSssrContextDispatch(static_cast<FfxSssrContext*>(context), &description);
+}
+#endif
+
+// Brixelizer GI traces the distance fields of a Brixelizer context, so its tests need Brixelizer as well
+#if defined(FFX_TEST_EFFECT_BRIXELIZER) || defined(FFX_TEST_EFFECT_BRIXELIZERGI)
+static FfxErrorCode createNullTestBrixelizerContext(const FfxInterface& backendInterface, FfxBrixelizerContext* context)
+{
+    FfxBrixelizerContextDescription description = {};
+    description.numCascades = 4;
+    for (uint32_t cascade = 0; cascade < description.numCascades; ++cascade)
+    {
+        description.cascadeDescs[cascade].flags     = FfxBrixelizerCascadeFlag(FFX_BRIXELIZER_CASCADE_STATIC | FFX_BRIXELIZER_CASCADE_DYNAMIC);
+        description.cascadeDescs[cascade].voxelSize = 0.2f * float(1u << cascade);
+    }
+    description.backendInterface = backendInterface;
+    return ffxBrixelizerContextCreate(&description, context);
+}
+
+// The application resources of a Brixelizer context, with room for every cascade
+static FfxBrixelizerResources nullTestBrixelizerResources()
+{
+    FfxResourceDescription sdfAtlasDescription = {};
+    sdfAtlasDescription.type     = FFX_RESOURCE_TYPE_TEXTURE3D;
+    sdfAtlasDescription.format   = FFX_SURFACE_FORMAT_R8_UNORM;
+    sdfAtlasDescription.width    = FFX_BRIXELIZER_STATIC_CONFIG_SDF_ATLAS_SIZE;
+    sdfAtlasDescription.height   = FFX_BRIXELIZER_STATIC_CONFIG_SDF_ATLAS_SIZE;
+    sdfAtlasDescription.depth    = FFX_BRIXELIZER_STATIC_CONFIG_SDF_ATLAS_SIZE;
+    sdfAtlasDescription.mipCount = 1;
+    sdfAtlasDescription.usage    = FFX_RESOURCE_USAGE_UAV;
+
+    FfxBrixelizerResources resources = {};
+    resources.sdfAtlas   = ffxGetResourceNull(reinterpret_cast<void*>(uintptr_t(100)), sdfAtlasDescription, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+    resources.brickAABBs = nullTestBuffer(101, FFX_BRIXELIZER_BRICK_AABBS_SIZE, FFX_BRIXELIZER_BRICK_AABBS_STRIDE);
+    for (uint32_t cascade = 0; cascade < FFX_BRIXELIZER_MAX_CASCADES; ++cascade)
+    {
+        resources.cascadeResources[cascade].aabbTree = nullTestBuffer(102 + 2 * cascade, FFX_BRIXELIZER_CASCADE_AABB_TREE_SIZE, FFX_BRIXELIZER_CASCADE_AABB_TREE_STRIDE);
+        resources.cascadeResources[cascade].brickMap = nullTestBuffer(103 + 2 * cascade, FFX_BRIXELIZER_CASCADE_BRICK_MAP_SIZE, FFX_BRIXELIZER_CASCADE_BRICK_MAP_STRIDE);
+    }
+    return resources;
+}
+
+// Updates one cascade of an empty scene, which still clears, schedules and merges the cascade
+static FfxErrorCode updateNullTestBrixelizer(FfxBrixelizerContext* context, FfxCommandList commandList, uint32_t frameIndex)
+{
+    FfxBrixelizerUpdateDescription description = {};
+    description.resources        = nullTestBrixelizerResources();
+    description.frameIndex       = frameIndex;
+    description.maxReferences    = 32 * (1 << 20);
+    description.triangleSwapSize = 300 * (1 << 20);
+    description.maxBricksPerBake = 1 << 14;
+
+    FfxBrixelizerBakedUpdateDescription bakedDescription = {};
+    const FfxErrorCode                  errorCode = ffxBrixelizerBakeUpdate(context, &description, &bakedDescription);
+    if (errorCode != FFX_OK)
+        return errorCode;
+    return ffxBrixelizerUpdate(context, &bakedDescription, nullTestBuffer(99, 1u << 30, sizeof(uint32_t)), commandList);
+}
+
+#endif
+
+#ifdef FFX_TEST_EFFECT_BRIXELIZER
+static FfxErrorCode createNullTestBrixelizer(const FfxInterface& backendInterface, void** outContext)
+{
+    return createNullTestContext<FfxBrixelizerContext>(outContext, [&](FfxBrixelizerContext* context) { return createNullTestBrixelizerContext(backendInterface, context); });
+}
+
+static FfxErrorCode dispatchNullTestBrixelizer(void* context, FfxCommandList commandList, uint32_t frameIndex)
+{
+    return updateNullTestBrixelizer(static_cast<FfxBrixelizerContext*>(context), commandList, frameIndex);
+}
+#endif
+
+#ifdef FFX_TEST_EFFECT_BRIXELIZERGI
+// A Brixelizer GI context with the Brixelizer context it traces
+struct NullTestBrixelizerGI
+{
+    FfxBrixelizerContext   brixelizer;
+    FfxBrixelizerGIContext gi;
+};
+
+static FfxErrorCode createNullTestBrixelizerGI(const FfxInterface& backendInterface, void** outContext)
+{
+    FfxBrixelizerGIContextDescription description = {};
+    description.flags              = FFX_BRIXELIZER_GI_FLAG_DEPTH_INVERTED;
+    description.internalResolution = FFX_BRIXELIZER_GI_INTERNAL_RESOLUTION_50_PERCENT;
+    description.displaySize        = s_nullTestDisplaySize;
+    description.backendInterface   = backendInterface;
+    return createNullTestContext<NullTestBrixelizerGI>(outContext, [&](NullTestBrixelizerGI* contexts) {
+        FfxErrorCode errorCode = createNullTestBrixelizerContext(backendInterface, &contexts->brixelizer);
+        if (errorCode != FFX_OK)
+            return errorCode;
+        errorCode = ffxBrixelizerGIContextCreate(&contexts->gi, &description);
+        if (errorCode != FFX_OK)
+            ffxBrixelizerContextDestroy(&contexts->brixelizer);
+        return errorCode;
+    });
+}
+
+static FfxErrorCode destroyNullTestBrixelizerGIContexts(NullTestBrixelizerGI* contexts)
+{
+    const FfxErrorCode errorCode = ffxBrixelizerGIContextDestroy(&contexts->gi);
+    return ffxBrixelizerContextDestroy(&contexts->brixelizer) == FFX_OK ? errorCode : FFX_ERROR_BACKEND_API_ERROR;
+}
+
+static FfxErrorCode dispatchNullTestBrixelizerGI(void* context, FfxCommandList commandList, uint32_t frameIndex)
+{
+    NullTestBrixelizerGI* contexts  = static_cast<NullTestBrixelizerGI*>(context);
+    FfxErrorCode          errorCode = updateNullTestBrixelizer(&contexts->brixelizer, commandList, frameIndex);
+    if (errorCode != FFX_OK)
+        return errorCode;
+
+    const FfxDimensions2D internalSize = {s_nullTestDisplaySize.width / 2, s_nullTestDisplaySize.height / 2};
+
+    FfxResourceDescription environmentMapDescription = {};
+    environmentMapDescription.type     = FFX_RESOURCE_TYPE_TEXTURE_CUBE;
+    environmentMapDescription.format   = FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT;
+    environmentMapDescription.width    = 256;
+    environmentMapDescription.height   = 256;
+    environmentMapDescription.depth    = 6;
+    environmentMapDescription.mipCount = 9;
+    environmentMapDescription.usage    = FFX_RESOURCE_USAGE_READ_ONLY;
+
+    FfxBrixelizerGIDispatchDescription description = {};
+    nullTestIdentity(description.view);
+    nullTestIdentity(description.projection);
+    nullTestIdentity(description.prevView);
+    nullTestIdentity(description.prevProjection);
+    description.startCascade            = 0;
+    description.endCascade              = 3;
+    description.rayPushoff              = 0.25f;
+    description.sdfSolveEps             = 0.5f;
+    description.specularRayPushoff      = 0.25f;
+    description.specularSDFSolveEps     = 0.5f;
+    description.tMin                    = 0.0f;
+    description.tMax                    = 10000.0f;
+    description.environmentMap          = ffxGetResourceNull(reinterpret_cast<void*>(uintptr_t(1)), environmentMapDescription, FFX_RESOURCE_STATE_COMPUTE_READ);
+    description.prevLitOutput           = nullTestInput(2, s_nullTestDisplaySize, FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT);
+    description.depth                   = nullTestInput(3, s_nullTestDisplaySize, FFX_SURFACE_FORMAT_R32_FLOAT);
+    description.historyDepth            = nullTestInput(4, s_nullTestDisplaySize, FFX_SURFACE_FORMAT_R32_FLOAT);
+    description.normal                  = nullTestInput(5, s_nullTestDisplaySize, FFX_SURFACE_FORMAT_R10G10B10A2_UNORM);
+    description.historyNormal           = nullTestInput(6, s_nullTestDisplaySize, FFX_SURFACE_FORMAT_R10G10B10A2_UNORM);
+    description.roughness               = nullTestInput(7, s_nullTestDisplaySize, FFX_SURFACE_FORMAT_R8G8B8A8_UNORM);
+    description.motionVectors           = nullTestInput(8, s_nullTestDisplaySize, FFX_SURFACE_FORMAT_R16G16_FLOAT);
+    description.noiseTexture            = nullTestInput(9, {128, 128}, FFX_SURFACE_FORMAT_R8G8_UNORM);
+    description.normalsUnpackMul        = 2.0f;
+    description.normalsUnpackAdd        = -1.0f;
+    description.isRoughnessPerceptual   = true;
+    description.roughnessChannel        = 1;
+    description.roughnessThreshold      = 0.9f;
+    description.environmentMapIntensity = 0.1f;
+    description.motionVectorScale       = {1.0f, 1.0f};
+
+    const FfxBrixelizerResources resources = nullTestBrixelizerResources();
+    description.sdfAtlas    = resources.sdfAtlas;
+    description.bricksAABBs = resources.brickAABBs;
+    for (uint32_t cascade = 0; cascade < FFX_BRIXELIZER_MAX_CASCADES; ++cascade)
+    {
+        description.cascadeAABBTrees[cascade] = resources.cascadeResources[cascade].aabbTree;
+        description.cascadeBrickMaps[cascade] = resources.cascadeResources[cascade].brickMap;
+    }
+    description.outputDiffuseGI  = nullTestOutput(10, internalSize, FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT);
+    description.outputSpecularGI = nullTestOutput(11, internalSize, FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT);
+    errorCode = ffxBrixelizerGetRawContext(&contexts->brixelizer, &description.brixelizerContext);
+    if (errorCode != FFX_OK)
+        return errorCode;
+
+    return ffxBrixelizerGIContextDispatch(&contexts->gi, &description, commandList);
+}
+#endif
+
+// Every effect the test was built with
+static const NullTestEffect s_nullTestEffects[] = {
+#ifdef FFX_TEST_EFFECT_FSR1
+    {"FSR1", FFX_FSR1_CONTEXT_COUNT, createNullTestFsr1, destroyNullTestContext<FfxFsr1Context, ffxFsr1ContextDestroy>, dispatchNullTestFsr1},
+#endif
+#ifdef FFX_TEST_EFFECT_FSR2
+    {"FSR2", FFX_FSR2_CONTEXT_COUNT, createNullTestFsr2, destroyNullTestContext<FfxFsr2Context, ffxFsr2ContextDestroy>, dispatchNullTestFsr2},
+#endif
+#ifdef FFX_TEST_EFFECT_FSR3UPSCALER
+    {"FSR3 upscaler", FFX_FSR3UPSCALER_CONTEXT_COUNT, createNullTestFsr3Upscaler, destroyNullTestContext<FfxFsr3UpscalerContext, ffxFsr3UpscalerContextDestroy>, dispatchNullTestFsr3Upscaler},
+#endif
+#ifdef FFX_TEST_EFFECT_FRAMEINTERPOLATION
+    {"Frame interpolation", FFX_FRAMEINTERPOLATION_CONTEXT_COUNT, createNullTestFrameInterpolation, destroyNullTestContext<FfxFrameInterpolationContext, ffxFrameInterpolationContextDestroy>, dispatchNullTestFrameInterpolation},
+#endif
+#ifdef FFX_TEST_EFFECT_OPTICALFLOW
+    {"Optical flow", FFX_OPTICALFLOW_CONTEXT_COUNT, createNullTestOpticalflow, destroyNullTestContext<FfxOpticalflowContext, ffxOpticalflowContextDestroy>, dispatchNullTestOpticalflow},
+#endif
+#ifdef FFX_TEST_EFFECT_SPD
+    {"SPD", FFX_SPD_CONTEXT_COUNT, createNullTestSpd, destroyNullTestContext<FfxSpdContext, ffxSpdContextDestroy>, dispatchNullTestSpd},
+#endif
+#ifdef FFX_TEST_EFFECT_CACAO
+    {"CACAO", FFX_CACAO_CONTEXT_COUNT, createNullTestCacao, destroyNullTestContext<FfxCacaoContext, ffxCacaoContextDestroy>, dispatchNullTestCacao},
+#endif
+#ifdef FFX_TEST_EFFECT_LPM
+    {"LPM", FFX_LPM_CONTEXT_COUNT, createNullTestLpm, destroyNullTestContext<FfxLpmContext, ffxLpmContextDestroy>, dispatchNullTestLpm},
+#endif
+#ifdef FFX_TEST_EFFECT_BLUR
+    {"Blur", FFX_BLUR_CONTEXT_COUNT, createNullTestBlur, destroyNullTestContext<FfxBlurContext, ffxBlurContextDestroy>, dispatchNullTestBlur},
+#endif
+#ifdef FFX_TEST_EFFECT_VRS
+    {"VRS", FFX_VRS_CONTEXT_COUNT, createNullTestVrs, destroyNullTestContext<FfxVrsContext, ffxVrsContextDestroy>, dispatchNullTestVrs},
+#endif
+#ifdef FFX_TEST_EFFECT_CAS
+    {"CAS", FFX_CAS_CONTEXT_COUNT, createNullTestCas, destroyNullTestContext<FfxCasContext, ffxCasContextDestroy>, dispatchNullTestCas},
+#endif
+#ifdef FFX_TEST_EFFECT_DOF
+    {"DoF", FFX_DOF_CONTEXT_COUNT, createNullTestDof, destroyNullTestContext<FfxDofContext, ffxDofContextDestroy>, dispatchNullTestDof},
+#endif
+#ifdef FFX_TEST_EFFECT_LENS
+    {"Lens", FFX_LENS_CONTEXT_COUNT, createNullTestLens, destroyNullTestContext<FfxLensContext, ffxLensContextDestroy>, dispatchNullTestLens},
+#endif
+#ifdef FFX_TEST_EFFECT_PARALLELSORT
+    {"Parallel sort", FFX_PARALLELSORT_CONTEXT_COUNT, createNullTestParallelSort, destroyNullTestContext<FfxParallelSortContext, ffxParallelSortContextDestroy>, dispatchNullTestParallelSort},
+#endif
+#ifdef FFX_TEST_EFFECT_DENOISER
+    {"Denoiser", FFX_DENOISER_CONTEXT_COUNT, createNullTestDenoiser, destroyNullTestContext<FfxDenoiserContext, ffxDenoiserContextDestroy>, dispatchNullTestDenoiser},
+#endif
+#ifdef FFX_TEST_EFFECT_CLASSIFIER
+    {"Classifier", FFX_CLASSIFIER_CONTEXT_COUNT, createNullTestClassifier, destroyNullTestContext<FfxClassifierContext, ffxClassifierContextDestroy>, dispatchNullTestClassifier},
+#endif
+#ifdef FFX_TEST_EFFECT_SSSR
+    {"SSSR", FFX_SSSR_CONTEXT_COUNT, createNullTestSssr, destroyNullTestContext<FfxSssrContext, ffxSssrContextDestroy>, dispatchNullTestSssr},
+#endif
+#ifdef FFX_TEST_EFFECT_BRIXELIZER
+    {"Brixelizer", FFX_BRIXELIZER_CONTEXT_COUNT, createNullTestBrixelizer, destroyNullTestContext<FfxBrixelizerContext, ffxBrixelizerContextDestroy>, dispatchNullTestBrixelizer},
+#endif
+#ifdef FFX_TEST_EFFECT_BRIXELIZERGI
+    {"Brixelizer GI", FFX_BRIXELIZER_GI_CONTEXT_COUNT + FFX_BRIXELIZER_CONTEXT_COUNT, createNullTestBrixelizerGI, destroyNullTestContext<NullTestBrixelizerGI, destroyNullTestBrixelizerGIContexts>, dispatchNullTestBrixelizerGI},
+#endif
+    {nullptr, 0, nullptr, nullptr, nullptr}
+};
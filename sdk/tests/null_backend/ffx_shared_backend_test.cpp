@@ -0,0 +1,216 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// Creates N FSR2 contexts on one null backend, as the ffx-api contexts chaining ffxCreateContextDescSharedBackend
+// do, and on N private backends, and compares what they cost.
+//
+// On the shared backend the contexts compile each pipeline once (FfxSharedPipelineCache). Every context still
+// reflects its own pipeline states and creates its own resources, which carry per context history. So compiles and
+// backend scratch memory grow sublinearly with N, while pipeline states and resources grow linearly on both. The null
+// backend compiles nothing, so the time it saves per context is only the backend setup; on DX12 the compiles it
+// skips (CreateRootSignature, CreateComputePipelineState) dominate context creation.
+//
+// The contexts on the shared backend have to keep dispatching while others are destroyed, and the backend has to
+// compile again once all of them are gone.
+
+#include <algorithm>
+#include <memory>
+
+#include <FidelityFX/host/ffx_fsr2.h>
+#define FFX_TEST_EFFECT_FSR2
+#include "null_backend/ffx_null_test_effects.h"
+#include "ffx_test.h"
+
+static const uint32_t s_contextCounts[] = {1, 2, 4, 8, 16};
+static const uint32_t s_repetitions     = 5;
+
+struct CreationCost
+{
+    double   microseconds      = 0.0;   // Fastest of the repetitions, including the creation of private backends
+    size_t   scratchBytes      = 0;
+    uint64_t pipelinesCreated  = 0;
+    uint64_t pipelinesCompiled = 0;
+    uint64_t resourcesCreated  = 0;
+};
+
+static FfxErrorCode destroyFsr2(void* context)
+{
+    return destroyNullTestContext<FfxFsr2Context, ffxFsr2ContextDestroy>(context);
+}
+
+static void addStatistics(CreationCost& cost, const NullTestBackend& backend)
+{
+    const FfxNullBackendStatistics statistics = getNullTestStatistics(backend);
+    cost.scratchBytes      += backend.scratch.size();
+    cost.pipelinesCreated  += statistics.pipelinesCreated;
+    cost.pipelinesCompiled += statistics.pipelinesCompiled;
+    cost.resourcesCreated  += statistics.resourcesCreated;
+}
+
+static void destroyContexts(std::vector<void*>& contexts)
+{
+    for (void* context : contexts)
+        FFX_TEST_CHECK(context && destroyFsr2(context) == FFX_OK);
+    contexts.clear();
+}
+
+static CreationCost createShared(uint32_t contextCount)
+{
+    CreationCost cost;
+    for (uint32_t repetition = 0; repetition < s_repetitions; ++repetition)
+    {
+        std::vector<void*> contexts(contextCount, nullptr);
+
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        NullTestBackend backend;
+        FFX_TEST_CHECK(createNullTestBackend(backend, contextCount * FFX_FSR2_CONTEXT_COUNT));
+        for (void*& context : contexts)
+            FFX_TEST_CHECK(createNullTestFsr2(backend.backendInterface, &context) == FFX_OK);
+        const double microseconds = microsecondsSince(start);
+
+        if (repetition == 0 || microseconds < cost.microseconds)
+            cost.microseconds = microseconds;
+        if (repetition == 0)
+            addStatistics(cost, backend);
+
+        destroyContexts(contexts);
+    }
+    return cost;
+}
+
+static CreationCost createPrivate(uint32_t contextCount)
+{
+    CreationCost cost;
+    for (uint32_t repetition = 0; repetition < s_repetitions; ++repetition)
+    {
+        std::vector<std::unique_ptr<NullTestBackend>> backends;
+        std::vector<void*>                            contexts(contextCount, nullptr);
+
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (void*& context : contexts)
+        {
+            backends.emplace_back(new NullTestBackend());
+            FFX_TEST_CHECK(createNullTestBackend(*backends.back(), FFX_FSR2_CONTEXT_COUNT));
+            FFX_TEST_CHECK(createNullTestFsr2(backends.back()->backendInterface, &context) == FFX_OK);
+        }
+        const double microseconds = microsecondsSince(start);
+
+        if (repetition == 0 || microseconds < cost.microseconds)
+            cost.microseconds = microseconds;
+        if (repetition == 0)
+        {
+            for (const std::unique_ptr<NullTestBackend>& backend : backends)
+                addStatistics(cost, *backend);
+        }
+
+        destroyContexts(contexts);
+    }
+    return cost;
+}
+
+// Contexts on a shared backend keep working while the others are destroyed, and their pipelines are compiled again
+// once the backend has been released by all of them
+static void testSharedLifetime()
+{
+    const uint32_t contextCount = 4;
+
+    NullTestBackend backend;
+    FFX_TEST_CHECK(createNullTestBackend(backend, contextCount * FFX_FSR2_CONTEXT_COUNT));
+
+    std::vector<void*> contexts(contextCount, nullptr);
+    for (void*& context : contexts)
+        FFX_TEST_CHECK(createNullTestFsr2(backend.backendInterface, &context) == FFX_OK);
+    const uint64_t compiles = getNullTestStatistics(backend).pipelinesCompiled;
+
+    for (uint32_t frame = 0; frame < 2; ++frame)
+    {
+        for (void* context : contexts)
+            FFX_TEST_CHECK(dispatchNullTestFsr2(context, backend.commandList, frame) == FFX_OK);
+    }
+
+    // Drop the context which compiled the pipelines, the others still dispatch with them
+    FFX_TEST_CHECK(destroyFsr2(contexts[0]) == FFX_OK);
+    contexts.erase(contexts.begin());
+    resetNullTestCommands(backend);
+    for (void* context : contexts)
+        FFX_TEST_CHECK(dispatchNullTestFsr2(context, backend.commandList, 2) == FFX_OK);
+    FFX_TEST_CHECK(backend.stream.commandCount > 0 && backend.stream.droppedCommandCount == 0);
+
+    destroyContexts(contexts);
+
+    void* context = nullptr;
+    FFX_TEST_CHECK(createNullTestFsr2(backend.backendInterface, &context) == FFX_OK);
+    FFX_TEST_CHECK(getNullTestStatistics(backend).pipelinesCompiled == 2 * compiles);
+    FFX_TEST_CHECK(context && destroyFsr2(context) == FFX_OK);
+}
+
+int main()
+{
+    // The first creation also pays for loading the shader blobs, keep it out of the measurement
+    createPrivate(1);
+
+    printf("%8s %8s %12s %12s %14s %10s %10s %10s\n", "contexts", "backend", "total us", "us/context", "scratch KiB", "pipelines",
+           "compiles", "resources");
+
+    CreationCost sharedSingle;
+    CreationCost privateSingle;
+    for (uint32_t contextCount : s_contextCounts)
+    {
+        const CreationCost shared   = createShared(contextCount);
+        const CreationCost private_ = createPrivate(contextCount);
+        if (contextCount == 1)
+        {
+            sharedSingle  = shared;
+            privateSingle = private_;
+        }
+
+        const CreationCost* costs[] = {&shared, &private_};
+        for (const CreationCost* cost : costs)
+        {
+            printf("%8u %8s %12.1f %12.1f %14.1f %10llu %10llu %10llu\n",
+                   contextCount,
+                   cost == &shared ? "shared" : "private",
+                   cost->microseconds,
+                   cost->microseconds / contextCount,
+                   cost->scratchBytes / 1024.0,
+                   (unsigned long long)cost->pipelinesCreated,
+                   (unsigned long long)cost->pipelinesCompiled,
+                   (unsigned long long)cost->resourcesCreated);
+        }
+
+        // Every context reflects its pipelines and creates its resources, wherever it lives
+        FFX_TEST_CHECK(shared.pipelinesCreated == contextCount * sharedSingle.pipelinesCreated);
+        FFX_TEST_CHECK(shared.resourcesCreated == private_.resourcesCreated);
+
+        // Compiles don't grow with the contexts on a shared backend
+        FFX_TEST_CHECK(sharedSingle.pipelinesCompiled > 0);
+        FFX_TEST_CHECK(shared.pipelinesCompiled == sharedSingle.pipelinesCompiled);
+        FFX_TEST_CHECK(private_.pipelinesCompiled == contextCount * privateSingle.pipelinesCompiled);
+
+        // Backend state is paid once
+        if (contextCount > 1)
+            FFX_TEST_CHECK(shared.scratchBytes < private_.scratchBytes);
+    }
+
+    testSharedLifetime();
+
+    return FFX_TEST_RESULT();
+}
@@ -0,0 +1,270 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Benchmarks the shader blob archive reader (ffx_shader_blob_archive.cpp) against embedded blob arrays.
+//
+// The archive holds the 4 variants (base, wave64, 16bit, wave64_16bit) of a set of passes, with LZ4 compressed blobs
+// of SPIR-V like data, built here the way FidelityFX-SC -archive lays it out. An application using one effect at one
+// wave size looks up a single variant of a few passes. The benchmark reports first lookup latency (decompression
+// into the cache), warm lookup latency (cache hits) and the peak resident blob memory of both paths: the embedded
+// path keeps every variant of every pass resident, the archive only its compressed image plus what the cache holds.
+//
+// Every blob handed out has to match its source data, and the archive path has to stay well below the embedded one.
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <ffx_shader_blob_archive.h>
+#include <ffx_shader_blob_archive_format.h>
+#include <ffx_shader_blob_lz.h>
+#include "ffx_test.h"
+
+static const uint32_t s_passCount      = 64;
+static const uint32_t s_variantCount   = 4;
+static const uint32_t s_blobWordCount  = 8 * 1024;
+static const uint32_t s_usedPassCount  = 8;
+static const uint32_t s_warmLookupRuns = 1000;
+
+static std::string sectionName(uint32_t pass)
+{
+    return "ffx_benchmark_pass_" + std::to_string(pass);
+}
+
+// SPIR-V like data: a stream of instructions drawn from a small per blob vocabulary, which LZ4 compresses about as
+// well as real blobs
+static std::vector<uint8_t> makeBlob(uint32_t pass, uint32_t variant)
+{
+    uint32_t seed = (pass * s_variantCount + variant) * 2654435761u + 1;
+    auto     next = [&seed]() {
+        seed = seed * 1664525u + 1013904223u;
+        return seed >> 8;
+    };
+
+    const uint32_t instructionWords = 4;
+    const uint32_t vocabularySize   = 256;
+
+    std::vector<uint32_t> vocabulary(vocabularySize * instructionWords);
+    for (uint32_t& word : vocabulary)
+        word = next();
+
+    std::vector<uint32_t> words;
+    while (words.size() < s_blobWordCount)
+    {
+        const uint32_t instruction = next() % vocabularySize;
+        words.insert(words.end(), vocabulary.begin() + instruction * instructionWords, vocabulary.begin() + (instruction + 1) * instructionWords);
+        if (next() % 2)
+            words.push_back(next() % 1024);
+    }
+    words.resize(s_blobWordCount);
+
+    std::vector<uint8_t> blob(words.size() * sizeof(uint32_t));
+    memcpy(blob.data(), words.data(), blob.size());
+    return blob;
+}
+
+static uint32_t alignUp(uint32_t value, uint32_t alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+// One section per pass, each with one permutation per variant keyed by the variant index. No reflection tables.
+static std::vector<uint32_t> buildArchive(const std::vector<std::vector<uint8_t>>& blobs)
+{
+    const uint32_t blobCount = uint32_t(blobs.size());
+
+    std::vector<std::vector<uint8_t>> storedBlobs(blobCount);
+    for (uint32_t i = 0; i < blobCount; ++i)
+    {
+        std::vector<uint8_t> compressed(ffxShaderBlobLzCompressBound(uint32_t(blobs[i].size())));
+        const uint32_t       compressedSize = ffxShaderBlobLzCompress(blobs[i].data(), uint32_t(blobs[i].size()), compressed.data(), uint32_t(compressed.size()));
+        if (compressedSize > 0 && compressedSize < blobs[i].size())
+        {
+            compressed.resize(compressedSize);
+            storedBlobs[i] = std::move(compressed);
+        }
+        else
+        {
+            storedBlobs[i] = blobs[i];
+        }
+    }
+
+    std::string strings;
+    std::vector<uint32_t> nameOffsets;
+    for (uint32_t pass = 0; pass < s_passCount; ++pass)
+    {
+        nameOffsets.push_back(uint32_t(strings.size()));
+        strings += sectionName(pass);
+        strings.push_back('\0');
+    }
+
+    FfxShaderBlobArchiveHeader header = {};
+    header.magic              = FFX_SHADER_BLOB_ARCHIVE_MAGIC;
+    header.version            = FFX_SHADER_BLOB_ARCHIVE_VERSION;
+    header.sectionCount       = s_passCount;
+    header.sectionsOffset     = sizeof(FfxShaderBlobArchiveHeader);
+    header.permutationCount   = blobCount;
+    header.permutationsOffset = header.sectionsOffset + s_passCount * sizeof(FfxShaderBlobArchiveSection);
+    header.blobCount          = blobCount;
+    header.blobsOffset        = header.permutationsOffset + blobCount * sizeof(FfxShaderBlobArchivePermutation);
+    header.tablePoolOffset    = header.blobsOffset + blobCount * sizeof(FfxShaderBlobArchiveBlob);
+    header.tablePoolSize      = s_passCount * s_variantCount * sizeof(uint32_t);
+    header.stringTableOffset  = header.tablePoolOffset + header.tablePoolSize;
+    header.stringTableSize    = uint32_t(strings.size());
+
+    uint32_t blobDataOffset = alignUp(header.stringTableOffset + header.stringTableSize, FFX_SHADER_BLOB_ARCHIVE_BLOB_ALIGNMENT);
+    std::vector<FfxShaderBlobArchiveBlob> blobTable(blobCount);
+    for (uint32_t i = 0; i < blobCount; ++i)
+    {
+        blobTable[i].offset     = blobDataOffset;
+        blobTable[i].size       = uint32_t(blobs[i].size());
+        blobTable[i].storedSize = uint32_t(storedBlobs[i].size());
+        blobDataOffset          = alignUp(blobDataOffset + blobTable[i].storedSize, FFX_SHADER_BLOB_ARCHIVE_BLOB_ALIGNMENT);
+    }
+    header.totalSize = blobDataOffset;
+
+    // Backed by uint32_t so the archive is suitably aligned for mounting
+    std::vector<uint32_t> archive(header.totalSize / sizeof(uint32_t));
+    uint8_t*              data = reinterpret_cast<uint8_t*>(archive.data());
+
+    memcpy(data, &header, sizeof(header));
+    for (uint32_t pass = 0; pass < s_passCount; ++pass)
+    {
+        FfxShaderBlobArchiveSection section = {};
+        section.nameOffset             = header.stringTableOffset + nameOffsets[pass];
+        section.keyCount               = s_variantCount;
+        section.indirectionTableOffset = header.tablePoolOffset + pass * s_variantCount * sizeof(uint32_t);
+        section.firstPermutation       = pass * s_variantCount;
+        section.permutationCount       = s_variantCount;
+        memcpy(data + header.sectionsOffset + pass * sizeof(section), &section, sizeof(section));
+
+        for (uint32_t variant = 0; variant < s_variantCount; ++variant)
+            memcpy(data + section.indirectionTableOffset + variant * sizeof(uint32_t), &variant, sizeof(uint32_t));
+    }
+    for (uint32_t i = 0; i < blobCount; ++i)
+    {
+        FfxShaderBlobArchivePermutation permutation = {};
+        permutation.blobIndex = i;
+        memcpy(data + header.permutationsOffset + i * sizeof(permutation), &permutation, sizeof(permutation));
+        memcpy(data + header.blobsOffset + i * sizeof(FfxShaderBlobArchiveBlob), &blobTable[i], sizeof(FfxShaderBlobArchiveBlob));
+        memcpy(data + blobTable[i].offset, storedBlobs[i].data(), storedBlobs[i].size());
+    }
+    memcpy(data + header.stringTableOffset, strings.data(), strings.size());
+
+    return archive;
+}
+
+static double nanosecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+    std::vector<std::vector<uint8_t>> blobs;
+    for (uint32_t pass = 0; pass < s_passCount; ++pass)
+    {
+        for (uint32_t variant = 0; variant < s_variantCount; ++variant)
+            blobs.push_back(makeBlob(pass, variant));
+    }
+
+    // The embedded path: every variant of every pass lives in the image, looked up through an indirection table
+    std::vector<uint8_t>        embedded;
+    std::vector<const uint8_t*> embeddedTable;
+    for (const std::vector<uint8_t>& blob : blobs)
+        embedded.insert(embedded.end(), blob.begin(), blob.end());
+    for (size_t i = 0, offset = 0; i < blobs.size(); offset += blobs[i].size(), ++i)
+        embeddedTable.push_back(embedded.data() + offset);
+
+    const std::vector<uint32_t> archive     = buildArchive(blobs);
+    const size_t                archiveSize = archive.size() * sizeof(uint32_t);
+    FFX_TEST_CHECK(ffxShaderBlobArchiveMount(archive.data(), archiveSize) == FFX_OK);
+
+    // The application uses one variant (wave64) of a few passes
+    const uint32_t usedVariant = 1;
+
+    double embeddedNanoseconds = 0.0;
+    size_t embeddedChecksum    = 0;
+    for (uint32_t run = 0; run < s_warmLookupRuns; ++run)
+    {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (uint32_t pass = 0; pass < s_usedPassCount; ++pass)
+            embeddedChecksum += embeddedTable[pass * s_variantCount + usedVariant][run % s_blobWordCount];
+        embeddedNanoseconds += nanosecondsSince(start);
+    }
+
+    double firstNanoseconds = 0.0;
+    for (uint32_t pass = 0; pass < s_usedPassCount; ++pass)
+    {
+        const std::string name = sectionName(pass);
+
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        FfxShaderBlob blob = ffxShaderBlobArchiveGetPermutationBlob(name.c_str(), usedVariant);
+        firstNanoseconds += nanosecondsSince(start);
+
+        const std::vector<uint8_t>& expected = blobs[pass * s_variantCount + usedVariant];
+        FFX_TEST_CHECK(blob.data && blob.size == expected.size() && memcmp(blob.data, expected.data(), blob.size) == 0);
+        ffxShaderBlobArchiveReleasePermutationBlob(blob.data);
+    }
+
+    double warmNanoseconds = 0.0;
+    for (uint32_t run = 0; run < s_warmLookupRuns; ++run)
+    {
+        for (uint32_t pass = 0; pass < s_usedPassCount; ++pass)
+        {
+            const std::string name = sectionName(pass);
+
+            const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            FfxShaderBlob blob = ffxShaderBlobArchiveGetPermutationBlob(name.c_str(), usedVariant);
+            warmNanoseconds += nanosecondsSince(start);
+
+            FFX_TEST_CHECK(blob.data && blob.data[run % blob.size] == blobs[pass * s_variantCount + usedVariant][run % blob.size]);
+            ffxShaderBlobArchiveReleasePermutationBlob(blob.data);
+        }
+    }
+
+    FfxShaderBlobArchiveCacheStats stats = {};
+    ffxShaderBlobArchiveGetCacheStats(&stats);
+    FFX_TEST_CHECK(stats.misses == s_usedPassCount);
+    FFX_TEST_CHECK(stats.hits == uint64_t(s_usedPassCount) * s_warmLookupRuns);
+
+    const size_t embeddedResident = embedded.size();
+    const size_t archiveResident  = archiveSize + stats.peakResidentBytes;
+
+    printf("%u passes x %u variants of %u bytes, %u passes used\n", s_passCount, s_variantCount, s_blobWordCount * 4, s_usedPassCount);
+    printf("embedded: lookup %10.1f ns, resident %10zu bytes (checksum %zu)\n",
+           embeddedNanoseconds / (double(s_warmLookupRuns) * s_usedPassCount), embeddedResident, embeddedChecksum);
+    printf("archive:  first  %10.1f ns, warm %10.1f ns, resident %10zu bytes (%zu archive + %zu cache peak)\n",
+           firstNanoseconds / s_usedPassCount, warmNanoseconds / (double(s_warmLookupRuns) * s_usedPassCount),
+           archiveResident, archiveSize, stats.peakResidentBytes);
+
+    // The blobs compress, and only the used ones are ever decompressed
+    FFX_TEST_CHECK(archiveSize < embeddedResident / 2);
+    FFX_TEST_CHECK(stats.peakResidentBytes == size_t(s_usedPassCount) * s_blobWordCount * 4);
+    FFX_TEST_CHECK(archiveResident < embeddedResident);
+
+    ffxShaderBlobArchiveUnmountAll();
+
+    return FFX_TEST_RESULT();
+}
@@ -0,0 +1,177 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Benchmarks the two output modes of ffx_sc, built from source, against a stand-in compiler which writes binaries of a
+// realistic size (ffx_sc_fake_compiler.cpp): hex C headers, one per permutation, and a single binary archive (-archive).
+//
+// For each mode the benchmark reports the generator wall time, the bytes written, and the time it takes the compiler
+// building this test to compile a translation unit including the generated permutations header, as the blob accessors
+// do. The archive has to come out smaller than the headers, and hold every permutation binary.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "ffx_test.h"
+
+namespace fs = std::filesystem;
+
+// 3 quality levels, 2 fast path settings, 4 modes and 2 lane counts
+static const size_t s_permutationCount = 48;
+static const size_t s_binarySize       = 24 * 1024;
+static const int    s_runCount         = 3;
+
+struct Workspace
+{
+    fs::path root;
+    fs::path shader;
+    fs::path output;
+    fs::path log;
+};
+
+struct Measurement
+{
+    double generateSeconds = 0.0;
+    double compileSeconds  = 0.0;
+    size_t bytesWritten    = 0;
+};
+
+static void writeFile(const fs::path& path, const std::string& contents)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << contents;
+}
+
+static double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Runs a command line through the shell, which needs the whole line quoted once more on Windows
+static double runTimed(const std::string& commandLine)
+{
+    const std::string command = "\"" + commandLine + "\"";
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    FFX_TEST_CHECK(std::system(command.c_str()) == 0);
+    return secondsSince(start);
+}
+
+static size_t directorySize(const fs::path& path)
+{
+    size_t size = 0;
+    for (const fs::directory_entry& entry : fs::recursive_directory_iterator(path))
+    {
+        if (entry.is_regular_file())
+            size += size_t(entry.file_size());
+    }
+    return size;
+}
+
+static Measurement measure(const Workspace& workspace, const std::string& extraArguments)
+{
+    Measurement best;
+    for (int run = 0; run < s_runCount; ++run)
+    {
+        fs::remove_all(workspace.output);
+        fs::create_directories(workspace.output);
+
+        std::string generate = "\"" FFX_SC_PATH "\"";
+        generate += " -compiler=glslang";
+        generate += " -glslangexe=\"" FFX_SC_FAKE_COMPILER_PATH "\"";
+        generate += " -output=\"" + workspace.output.string() + "\"";
+        generate += " -name=ffx_test_pass -num-threads=4 " + extraArguments;
+        generate += " -DQUALITY={0,1,2} -DFAST_PATH={-,1} -DMODE={0,1,2,3} -DLANES={32,64}";
+        generate += " \"" + workspace.shader.string() + "\"";
+        const double generateSeconds = runTimed(generate);
+
+        // The permutations header pulls in the per permutation headers, if there are any
+        const fs::path translationUnit = workspace.output / "ffx_test_pass_accessor.cpp";
+        writeFile(translationUnit, "#include <stdint.h>\n#include \"ffx_test_pass_permutations.h\"\n");
+        const size_t bytesWritten = directorySize(workspace.output) - size_t(fs::file_size(translationUnit));
+
+        std::string compile = "\"" FFX_TEST_CXX_COMPILER "\" /nologo /c";
+        compile += " /I\"" + workspace.output.string() + "\"";
+        compile += " /Fo\"" + (workspace.root / "ffx_test_pass_accessor.obj").string() + "\"";
+        compile += " \"" + translationUnit.string() + "\" > nul";
+        const double compileSeconds = runTimed(compile);
+
+        if (run == 0 || generateSeconds < best.generateSeconds)
+            best.generateSeconds = generateSeconds;
+        if (run == 0 || compileSeconds < best.compileSeconds)
+            best.compileSeconds = compileSeconds;
+        best.bytesWritten = bytesWritten;
+    }
+    return best;
+}
+
+static void report(const char* mode, const Measurement& measurement)
+{
+    printf("%-8s generate %8.3f s, %10zu bytes written, accessor compile %8.3f s\n",
+           mode,
+           measurement.generateSeconds,
+           measurement.bytesWritten,
+           measurement.compileSeconds);
+}
+
+int main()
+{
+    Workspace workspace;
+    workspace.root   = fs::temp_directory_path() / "ffx_sc_archive_benchmark";
+    workspace.shader = workspace.root / "ffx_test_pass.glsl";
+    workspace.output = workspace.root / "output";
+    workspace.log    = workspace.root / "compiler.log";
+
+    fs::remove_all(workspace.root);
+    fs::create_directories(workspace.root);
+    writeFile(workspace.log, "");
+    writeFile(workspace.shader,
+              "#if QUALITY > 1 && defined(FAST_PATH) && MODE > 2 && LANES > 32\n"
+              "#endif\n"
+              "void main() {}\n");
+
+    const std::string logVariable = "FFX_SC_FAKE_COMPILER_LOG=" + workspace.log.string();
+    const std::string sizeVariable = "FFX_SC_FAKE_COMPILER_BINARY_SIZE=" + std::to_string(s_binarySize);
+    _putenv(logVariable.c_str());
+    _putenv(sizeVariable.c_str());
+
+    printf("%zu permutations of %zu bytes, best of %d runs\n", s_permutationCount, s_binarySize, s_runCount);
+
+    const Measurement headers = measure(workspace, "");
+    report("headers", headers);
+
+    const Measurement archive = measure(workspace, "-archive");
+    report("archive", archive);
+
+    // Hex arrays spell every byte out in several characters, the archive stores the (incompressible) binaries as is
+    FFX_TEST_CHECK(headers.bytesWritten > s_permutationCount * s_binarySize * 4);
+    FFX_TEST_CHECK(archive.bytesWritten >= s_permutationCount * s_binarySize);
+    FFX_TEST_CHECK(archive.bytesWritten < headers.bytesWritten / 4);
+    FFX_TEST_CHECK(fs::exists(workspace.output / "ffx_test_pass_permutations.ffxpak"));
+
+    fs::remove_all(workspace.root);
+
+    return FFX_TEST_RESULT();
+}
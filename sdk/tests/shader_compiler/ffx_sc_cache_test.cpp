@@ -0,0 +1,182 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Runs ffx_sc, built from source, with its persistent compile cache against a stand-in compiler which logs every
+// invocation (ffx_sc_fake_compiler.cpp).
+//
+// A second run over an unchanged tree has to restore every permutation from the cache without a single compiler
+// invocation, and write the same headers as the first run. Editing an include, or changing the compiler arguments,
+// has to recompile every permutation again.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "ffx_test.h"
+
+namespace fs = std::filesystem;
+
+// 3 quality levels times 2 fast path settings
+static const size_t s_permutationCount = 6;
+
+static std::string readFile(const fs::path& path)
+{
+    std::ifstream     file(path, std::ios::binary);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+static void writeFile(const fs::path& path, const std::string& contents)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << contents;
+}
+
+static size_t countCompilerInvocations(const fs::path& logPath)
+{
+    const std::string log = readFile(logPath);
+    size_t            invocations = 0;
+    for (char c : log)
+        invocations += c == '\n';
+    return invocations;
+}
+
+// Headers written by a run, by file name. Permutations are indexed in the order threads finish them, so the lines of
+// the permutations header are compared in sorted order.
+static std::map<std::string, std::string> readOutputs(const fs::path& outputPath)
+{
+    std::map<std::string, std::string> outputs;
+    for (const fs::directory_entry& entry : fs::directory_iterator(outputPath))
+    {
+        if (!entry.is_regular_file())
+            continue;
+
+        const std::string fileName = entry.path().filename().string();
+        std::string       contents = readFile(entry.path());
+        if (fileName.find("_permutations.h") != std::string::npos)
+        {
+            std::istringstream       stream(contents);
+            std::vector<std::string> lines;
+            for (std::string line; std::getline(stream, line);)
+                lines.push_back(line);
+            std::sort(lines.begin(), lines.end());
+
+            contents.clear();
+            for (const std::string& line : lines)
+                contents += line + "\n";
+        }
+        outputs[fileName] = contents;
+    }
+    return outputs;
+}
+
+struct Workspace
+{
+    fs::path root;
+    fs::path shader;
+    fs::path include;
+    fs::path output;
+    fs::path cache;
+    fs::path log;
+};
+
+// Runs ffx_sc over the workspace and returns the number of compiler invocations it caused
+static size_t runShaderCompiler(const Workspace& workspace, const std::string& extraArguments)
+{
+    const size_t invocationsBefore = countCompilerInvocations(workspace.log);
+
+    fs::remove_all(workspace.output);
+    fs::create_directories(workspace.output);
+
+    std::string command = "\"";
+    command += "\"" FFX_SC_PATH "\"";
+    command += " -I\"" + workspace.include.string() + "\"";
+    command += " -compiler=glslang";
+    command += " -glslangexe=\"" FFX_SC_FAKE_COMPILER_PATH "\"";
+    command += " -output=\"" + workspace.output.string() + "\"";
+    command += " -cache=\"" + workspace.cache.string() + "\"";
+    command += " -num-threads=4 " + extraArguments;
+    command += " -DQUALITY={0,1,2} -DFAST_PATH={-,1}";
+    command += " \"" + workspace.shader.string() + "\"";
+    command += "\"";
+
+    FFX_TEST_CHECK(std::system(command.c_str()) == 0);
+
+    return countCompilerInvocations(workspace.log) - invocationsBefore;
+}
+
+int main()
+{
+    Workspace workspace;
+    workspace.root    = fs::temp_directory_path() / "ffx_sc_cache_test";
+    workspace.shader  = workspace.root / "ffx_test_pass.glsl";
+    workspace.include = workspace.root / "include";
+    workspace.output  = workspace.root / "output";
+    workspace.cache   = workspace.root / "cache";
+    workspace.log     = workspace.root / "compiler.log";
+
+    fs::remove_all(workspace.root);
+    fs::create_directories(workspace.include);
+    writeFile(workspace.log, "");
+    writeFile(workspace.shader,
+              "#include \"ffx_test_common.h\"\n"
+              "#if QUALITY > 1 && defined(FAST_PATH)\n"
+              "#endif\n"
+              "void main() {}\n");
+    writeFile(workspace.include / "ffx_test_common.h", "#define FFX_TEST_COMMON 1\n");
+
+    const std::string logVariable = "FFX_SC_FAKE_COMPILER_LOG=" + workspace.log.string();
+    _putenv(logVariable.c_str());
+
+    // A cold cache compiles every permutation
+    FFX_TEST_CHECK(runShaderCompiler(workspace, "") == s_permutationCount);
+    const std::map<std::string, std::string> coldOutputs = readOutputs(workspace.output);
+    FFX_TEST_CHECK(coldOutputs.size() > s_permutationCount);
+
+    // An unchanged tree compiles nothing and writes the same headers
+    FFX_TEST_CHECK(runShaderCompiler(workspace, "") == 0);
+    FFX_TEST_CHECK(readOutputs(workspace.output) == coldOutputs);
+
+    // So does a run from a fresh process with a different thread count
+    FFX_TEST_CHECK(runShaderCompiler(workspace, "-num-threads=1") == 0);
+    FFX_TEST_CHECK(readOutputs(workspace.output) == coldOutputs);
+
+    // Editing an include invalidates every permutation including it
+    writeFile(workspace.include / "ffx_test_common.h", "#define FFX_TEST_COMMON 2\n");
+    FFX_TEST_CHECK(runShaderCompiler(workspace, "") == s_permutationCount);
+    FFX_TEST_CHECK(runShaderCompiler(workspace, "") == 0);
+
+    // Different compiler arguments are different cache entries
+    FFX_TEST_CHECK(runShaderCompiler(workspace, "-DFFX_TEST_EXTRA=1") == s_permutationCount);
+    FFX_TEST_CHECK(runShaderCompiler(workspace, "-DFFX_TEST_EXTRA=1") == 0);
+
+    fs::remove_all(workspace.root);
+
+    return FFX_TEST_RESULT();
+}
@@ -0,0 +1,80 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Stands in for glslangValidator in the ffx_sc tests. Every invocation appends its defines to the log file named by
+// FFX_SC_FAKE_COMPILER_LOG, and writes a binary derived from those defines to the -o path, so distinct permutations
+// get distinct binaries. FFX_SC_FAKE_COMPILER_BINARY_SIZE pads the binaries to the given size in bytes with noise seeded
+// by the defines, to give benchmarks binaries of a realistic size which don't compress away.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    const char* outputPath = nullptr;
+    std::string defines;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if (arg == "-o" && i + 1 < argc)
+            outputPath = argv[++i];
+        else if (arg.compare(0, 2, "-D") == 0)
+            defines += arg + " ";
+    }
+
+    const char* logPath = getenv("FFX_SC_FAKE_COMPILER_LOG");
+    if (!outputPath || !logPath)
+        return 1;
+
+    FILE* log = fopen(logPath, "a");
+    if (!log)
+        return 1;
+    fprintf(log, "%s\n", defines.c_str());
+    fclose(log);
+
+    FILE* output = fopen(outputPath, "wb");
+    if (!output)
+        return 1;
+    std::string binary = "FAKESPIRV " + defines;
+
+    const char* binarySize = getenv("FFX_SC_FAKE_COMPILER_BINARY_SIZE");
+    if (binarySize)
+    {
+        uint32_t seed = 2166136261u;
+        for (char c : defines)
+            seed = (seed ^ uint8_t(c)) * 16777619u;
+
+        const size_t size = strtoul(binarySize, nullptr, 10);
+        while (binary.size() < size)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            binary.push_back(char(seed >> 24));
+        }
+    }
+    fwrite(binary.data(), 1, binary.size(), output);
+    fclose(output);
+
+    return 0;
+}
@@ -0,0 +1,144 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Benchmarks ffxResolveResourceBindings (ffx_resource_binding_map.h), which the effects use to resolve the reflected
+// bindings of their pipelines on context creation, against the wcscmp scan each effect used to carry.
+//
+// The map is FSR2's texture SRV table, and every pipeline binds a spread of its names. Both resolvers have to produce
+// the same identifiers, and reject a name missing from the map.
+
+#include <chrono>
+#include <cwchar>
+#include <vector>
+
+#include <ffx_resource_binding_map.h>
+#include "ffx_test.h"
+
+static const FfxResourceBindingMapEntry s_srvTextureBindingTable[] =
+{
+    {0,  L"r_input_color_jittered"},
+    {1,  L"r_input_opaque_only"},
+    {2,  L"r_input_motion_vectors"},
+    {3,  L"r_input_depth"},
+    {4,  L"r_input_exposure"},
+    {5,  L"r_auto_exposure"},
+    {6,  L"r_reactive_mask"},
+    {7,  L"r_transparency_and_composition_mask"},
+    {8,  L"r_reconstructed_previous_nearest_depth"},
+    {9,  L"r_dilated_motion_vectors"},
+    {10, L"r_previous_dilated_motion_vectors"},
+    {11, L"r_dilatedDepth"},
+    {12, L"r_internal_upscaled_color"},
+    {13, L"r_lock_status"},
+    {14, L"r_prepared_input_color"},
+    {15, L"r_luma_history"},
+    {16, L"r_rcas_input"},
+    {17, L"r_lanczos_lut"},
+    {18, L"r_imgMips"},
+    {19, L"r_img_mip_shading_change"},
+    {20, L"r_img_mip_5"},
+    {21, L"r_upsample_maximum_bias_lut"},
+    {22, L"r_dilated_reactive_masks"},
+    {23, L"r_new_locks"},
+    {24, L"r_lock_input_luma"},
+    {25, L"r_input_prev_color_pre_alpha"},
+    {26, L"r_input_prev_color_post_alpha"},
+};
+
+static const size_t   s_mapSize             = sizeof(s_srvTextureBindingTable) / sizeof(s_srvTextureBindingTable[0]);
+static const uint32_t s_pipelineCount       = 12;
+static const uint32_t s_bindingsPerPipeline = 8;
+static const uint32_t s_runCount            = 20000;
+
+// The loop the effects carried before the shared helper
+static FfxErrorCode resolveByNameScan(FfxResourceBinding* bindings, uint32_t bindingCount, const FfxResourceBindingMapEntry* map, size_t mapSize)
+{
+    for (uint32_t bindingIndex = 0; bindingIndex < bindingCount; ++bindingIndex)
+    {
+        size_t mapIndex = 0;
+        for (; mapIndex < mapSize; ++mapIndex)
+        {
+            if (0 == wcscmp(map[mapIndex].name, bindings[bindingIndex].name))
+                break;
+        }
+        if (mapIndex == mapSize)
+            return FFX_ERROR_INVALID_ARGUMENT;
+
+        bindings[bindingIndex].resourceIdentifier = map[mapIndex].index;
+    }
+    return FFX_OK;
+}
+
+static std::vector<FfxResourceBinding> makePipelineBindings()
+{
+    std::vector<FfxResourceBinding> bindings(s_pipelineCount * s_bindingsPerPipeline);
+    for (uint32_t pipeline = 0; pipeline < s_pipelineCount; ++pipeline)
+    {
+        for (uint32_t binding = 0; binding < s_bindingsPerPipeline; ++binding)
+        {
+            FfxResourceBinding& resourceBinding = bindings[pipeline * s_bindingsPerPipeline + binding];
+            resourceBinding                     = {};
+            resourceBinding.slotIndex           = binding;
+            wcsncpy(resourceBinding.name, s_srvTextureBindingTable[(pipeline * 5 + binding * 3) % s_mapSize].name, FFX_RESOURCE_NAME_SIZE - 1);
+        }
+    }
+    return bindings;
+}
+
+template <typename Resolve>
+static double nanosecondsPerBinding(std::vector<FfxResourceBinding>& bindings, Resolve resolve)
+{
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (uint32_t run = 0; run < s_runCount; ++run)
+    {
+        for (uint32_t pipeline = 0; pipeline < s_pipelineCount; ++pipeline)
+            FFX_TEST_CHECK(resolve(bindings.data() + pipeline * s_bindingsPerPipeline, s_bindingsPerPipeline) == FFX_OK);
+    }
+    const double nanoseconds = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    return nanoseconds / (double(s_runCount) * bindings.size());
+}
+
+int main()
+{
+    std::vector<FfxResourceBinding> scanned = makePipelineBindings();
+    std::vector<FfxResourceBinding> hashed  = makePipelineBindings();
+
+    const double scanNanoseconds = nanosecondsPerBinding(scanned, [](FfxResourceBinding* bindings, uint32_t count) {
+        return resolveByNameScan(bindings, count, s_srvTextureBindingTable, s_mapSize);
+    });
+    const double hashNanoseconds = nanosecondsPerBinding(hashed, [](FfxResourceBinding* bindings, uint32_t count) {
+        return ffxResolveResourceBindings(bindings, count, s_srvTextureBindingTable);
+    });
+
+    printf("%zu map entries, %u pipelines of %u bindings\n", s_mapSize, s_pipelineCount, s_bindingsPerPipeline);
+    printf("wcscmp scan:  %8.2f ns per binding\n", scanNanoseconds);
+    printf("hashed map:   %8.2f ns per binding\n", hashNanoseconds);
+
+    for (size_t i = 0; i < scanned.size(); ++i)
+        FFX_TEST_CHECK(scanned[i].resourceIdentifier == hashed[i].resourceIdentifier);
+
+    FfxResourceBinding unknown = {};
+    wcsncpy(unknown.name, L"r_not_in_the_map", FFX_RESOURCE_NAME_SIZE - 1);
+    FFX_TEST_CHECK(ffxResolveResourceBindings(&unknown, 1, s_srvTextureBindingTable) == FFX_ERROR_INVALID_ARGUMENT);
+
+    return FFX_TEST_RESULT();
+}
@@ -0,0 +1,142 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Tests the barriers the Vulkan backend records against the stub driver (ffx_vk_stub_driver.h), which checks every
+// image barrier against the layout of each mip it covers, and that the barriers of one vkCmdPipelineBarrier don't
+// overlap.
+//
+// Each frame is shaped like a downsampler: a barrier job leaves the whole texture pending in the read state, then one
+// dispatch writes each mip, and the texture is read again. The first dispatch overlaps the pending barrier, which the
+// backend must split rather than record a second barrier for the same mips. The test prints the transitions the
+// frame asks for (the barriers recorded when every transition got its own) against the barriers actually recorded.
+
+#include <cwchar>
+
+#include <FidelityFX/host/ffx_fsr2.h>
+#include "vk/ffx_vk_stub_driver.h"
+#include "ffx_test.h"
+
+static const uint32_t s_mipCount   = 9;
+static const uint32_t s_frameCount = 4;
+
+static FfxGpuJobDescription s_job;
+
+static void scheduleBarrier(FfxInterface& backendInterface, FfxResourceInternal resource, FfxResourceStates newState)
+{
+    s_job                            = {};
+    s_job.jobType                    = FFX_GPU_JOB_BARRIER;
+    s_job.barrierDescriptor.resource = resource;
+    s_job.barrierDescriptor.newState = newState;
+    FFX_TEST_CHECK(backendInterface.fpScheduleGpuJob(&backendInterface, &s_job) == FFX_OK);
+}
+
+static void scheduleDispatch(FfxInterface& backendInterface, const FfxPipelineState& pipeline, FfxResourceInternal resource, uint32_t mip, uint32_t* constants)
+{
+    s_job         = {};
+    s_job.jobType = FFX_GPU_JOB_COMPUTE;
+
+    // the texture is bound to the first UAV slot, the other slots are left null
+    FfxComputeJobDescription& compute = s_job.computeJobDescriptor;
+    compute.pipeline                  = pipeline;
+    compute.dimensions[0]             = 1;
+    compute.dimensions[1]             = 1;
+    compute.dimensions[2]             = 1;
+    compute.uavTextures[0].resource   = resource;
+    compute.uavTextures[0].mip        = mip;
+    for (uint32_t i = 0; i < pipeline.constCount; ++i)
+        compute.cbs[i] = {64, constants};
+
+    FFX_TEST_CHECK(backendInterface.fpScheduleGpuJob(&backendInterface, &s_job) == FFX_OK);
+}
+
+int main()
+{
+    const size_t      maxContexts = 1;
+    const size_t      scratchSize = ffxGetScratchMemorySizeVK(getStubPhysicalDeviceVK(), maxContexts);
+    std::vector<char> scratch(scratchSize);
+
+    FfxInterface backendInterface = {};
+    FFX_TEST_CHECK(ffxGetInterfaceVK(&backendInterface, getStubDeviceVK(), scratch.data(), scratchSize, maxContexts) == FFX_OK);
+
+    FfxUInt32 effectContextId = 0;
+    FFX_TEST_CHECK(backendInterface.fpCreateBackendContext(&backendInterface, FFX_EFFECT_FSR2, nullptr, &effectContextId) == FFX_OK);
+
+    // any pipeline writing a texture will do, the test decides what is bound to it
+    FfxPipelineDescription pipelineDescription = {};
+    wcscpy(pipelineDescription.name, L"FSR2-LUMINANCE-PYRAMID");
+    pipelineDescription.stage = FFX_BIND_COMPUTE_SHADER_STAGE;
+
+    FfxPipelineState                   pipeline    = {};
+    const FfxPipelineCreateDescription description = {FFX_FSR2_PASS_COMPUTE_LUMINANCE_PYRAMID, 0, &pipelineDescription, &pipeline};
+    FFX_TEST_CHECK(backendInterface.fpCreatePipelines(&backendInterface, FFX_EFFECT_FSR2, &description, 1, effectContextId) == FFX_OK);
+    FFX_TEST_CHECK(pipeline.uavTextureCount > 0);
+
+    FfxCreateResourceDescription textureDescription = {};
+    textureDescription.heapType                     = FFX_HEAP_TYPE_DEFAULT;
+    textureDescription.resourceDescription.type     = FFX_RESOURCE_TYPE_TEXTURE2D;
+    textureDescription.resourceDescription.format   = FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT;
+    textureDescription.resourceDescription.width    = 1 << (s_mipCount - 1);
+    textureDescription.resourceDescription.height   = 1 << (s_mipCount - 1);
+    textureDescription.resourceDescription.depth    = 1;
+    textureDescription.resourceDescription.mipCount = s_mipCount;
+    textureDescription.resourceDescription.usage    = FFX_RESOURCE_USAGE_UAV;
+    textureDescription.initialState                 = FFX_RESOURCE_STATE_UNORDERED_ACCESS;
+    textureDescription.name                         = L"BARRIER_TEST_TEXTURE";
+    textureDescription.initData.type                = FFX_RESOURCE_INIT_DATA_TYPE_UNINITIALIZED;
+
+    FfxResourceInternal texture = {};
+    FFX_TEST_CHECK(backendInterface.fpCreateResource(&backendInterface, &textureDescription, effectContextId, &texture) == FFX_OK);
+
+    uint32_t constants[64] = {};
+
+    printf("%-6s %12s %16s %14s\n", "frame", "transitions", "barrier calls", "image barriers");
+    for (uint32_t frame = 0; frame < s_frameCount && pipeline.uavTextureCount > 0; ++frame)
+    {
+        s_pipelineBarrierCount = 0;
+        s_imageBarrierCount    = 0;
+
+        // the texture is read as a whole, then each mip is written, and it is read again
+        scheduleBarrier(backendInterface, texture, FFX_RESOURCE_STATE_COMPUTE_READ);
+        for (uint32_t mip = 0; mip < s_mipCount; ++mip)
+            scheduleDispatch(backendInterface, pipeline, texture, mip, constants);
+        scheduleBarrier(backendInterface, texture, FFX_RESOURCE_STATE_COMPUTE_READ);
+
+        FFX_TEST_CHECK(backendInterface.fpExecuteGpuJobs(&backendInterface, getStubCommandListVK(), effectContextId) == FFX_OK);
+
+        // the texture is written and read back once per mip, and read as a whole once
+        const uint32_t transitions = 2 * s_mipCount + 1;
+        printf("%-6u %12u %16u %14u\n", frame, transitions, s_pipelineBarrierCount, s_imageBarrierCount);
+
+        FFX_TEST_CHECK(s_imageBarrierCount <= transitions);
+        FFX_TEST_CHECK(s_pipelineBarrierCount <= s_mipCount + 1);
+    }
+
+    FFX_TEST_CHECK(s_overlappingImageBarriers == 0);
+    FFX_TEST_CHECK(s_mismatchedImageBarriers == 0);
+    FFX_TEST_CHECK(s_dispatchCount == s_frameCount * s_mipCount);
+
+    FFX_TEST_CHECK(backendInterface.fpDestroyResource(&backendInterface, texture, effectContextId) == FFX_OK);
+    FFX_TEST_CHECK(backendInterface.fpDestroyPipeline(&backendInterface, &pipeline, effectContextId) == FFX_OK);
+    FFX_TEST_CHECK(backendInterface.fpDestroyBackendContext(&backendInterface, effectContextId) == FFX_OK);
+
+    return FFX_TEST_RESULT();
+}
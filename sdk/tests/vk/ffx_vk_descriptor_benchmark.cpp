@@ -0,0 +1,235 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Counts the descriptors the Vulkan backend writes per FSR2 frame against the stub driver (ffx_vk_stub_driver.h).
+//
+// A frame dispatches every FSR2 pass once, with all of its slots bound so no descriptor is left null (a set holding
+// a null descriptor is never reused). Two kinds of frames are run:
+//  - internal: every slot is bound to a resource created by the backend, so after the first frame every dispatch
+//    finds a set already holding its descriptors and nothing is written;
+//  - registered: the texture SRV slots are bound to a texture registered every frame, as an application's inputs
+//    are. A registration creates new views and a new generation (see RegisterResourceVK), so the sets of the passes
+//    reading it are written every frame and only those.
+
+#include <cwchar>
+
+#include <FidelityFX/host/ffx_fsr2.h>
+#include "vk/ffx_vk_stub_driver.h"
+#include "ffx_test.h"
+
+static const uint32_t s_frameCount = 8;
+
+struct FrameResources
+{
+    FfxResourceInternal uavTexture;
+    FfxResourceInternal srvTexture;
+    FfxResourceInternal buffer;
+};
+
+struct FrameCounts
+{
+    uint32_t descriptorWrites;
+    uint32_t setUpdates;
+    double   microseconds;
+};
+
+static FfxGpuJobDescription s_job;
+
+static FfxResourceInternal createTexture(FfxInterface& backendInterface, FfxUInt32 effectContextId, FfxResourceUsage usage, FfxResourceStates state, const wchar_t* name)
+{
+    FfxCreateResourceDescription description  = {};
+    description.heapType                      = FFX_HEAP_TYPE_DEFAULT;
+    description.resourceDescription.type      = FFX_RESOURCE_TYPE_TEXTURE2D;
+    description.resourceDescription.format    = FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT;
+    description.resourceDescription.width     = 64;
+    description.resourceDescription.height    = 64;
+    description.resourceDescription.depth     = 1;
+    description.resourceDescription.mipCount  = 1;
+    description.resourceDescription.usage     = usage;
+    description.initialState                  = state;
+    description.name                          = name;
+    description.initData.type                 = FFX_RESOURCE_INIT_DATA_TYPE_UNINITIALIZED;
+
+    FfxResourceInternal texture = {};
+    FFX_TEST_CHECK(backendInterface.fpCreateResource(&backendInterface, &description, effectContextId, &texture) == FFX_OK);
+    return texture;
+}
+
+static FfxResourceInternal createBuffer(FfxInterface& backendInterface, FfxUInt32 effectContextId)
+{
+    FfxCreateResourceDescription description  = {};
+    description.heapType                      = FFX_HEAP_TYPE_DEFAULT;
+    description.resourceDescription.type      = FFX_RESOURCE_TYPE_BUFFER;
+    description.resourceDescription.format    = FFX_SURFACE_FORMAT_UNKNOWN;
+    description.resourceDescription.size      = 1024;
+    description.resourceDescription.stride    = 4;
+    description.resourceDescription.mipCount  = 1;
+    description.resourceDescription.usage     = FFX_RESOURCE_USAGE_UAV;
+    description.initialState                  = FFX_RESOURCE_STATE_UNORDERED_ACCESS;
+    description.name                          = L"DESCRIPTOR_BENCHMARK_BUFFER";
+    description.initData.type                 = FFX_RESOURCE_INIT_DATA_TYPE_UNINITIALIZED;
+
+    FfxResourceInternal buffer = {};
+    FFX_TEST_CHECK(backendInterface.fpCreateResource(&backendInterface, &description, effectContextId, &buffer) == FFX_OK);
+    return buffer;
+}
+
+static void scheduleDispatch(FfxInterface& backendInterface, const FfxPipelineState& pipeline, const FrameResources& resources, FfxResourceInternal srvTexture, uint32_t* constants)
+{
+    s_job         = {};
+    s_job.jobType = FFX_GPU_JOB_COMPUTE;
+
+    // buffers are both read and written here, which only costs barriers: the descriptors are what is counted
+    FfxComputeJobDescription& compute = s_job.computeJobDescriptor;
+    compute.pipeline                  = pipeline;
+    compute.dimensions[0]             = 1;
+    compute.dimensions[1]             = 1;
+    compute.dimensions[2]             = 1;
+    for (uint32_t i = 0; i < pipeline.uavTextureCount; ++i)
+        compute.uavTextures[i].resource = resources.uavTexture;
+    for (uint32_t i = 0; i < pipeline.srvTextureCount; ++i)
+        compute.srvTextures[i].resource = srvTexture;
+    for (uint32_t i = 0; i < pipeline.uavBufferCount; ++i)
+        compute.uavBuffers[i].resource = resources.buffer;
+    for (uint32_t i = 0; i < pipeline.srvBufferCount; ++i)
+        compute.srvBuffers[i].resource = resources.buffer;
+    for (uint32_t i = 0; i < pipeline.constCount; ++i)
+        compute.cbs[i] = {64, constants};
+
+    FFX_TEST_CHECK(backendInterface.fpScheduleGpuJob(&backendInterface, &s_job) == FFX_OK);
+}
+
+// Dispatches every pass once, reading either the internal SRV texture or one registered for the frame
+static FrameCounts runFrame(FfxInterface& backendInterface, FfxUInt32 effectContextId, const FfxPipelineState* pipelines, const FrameResources& resources, const FfxResource* registeredTexture)
+{
+    uint32_t constants[64] = {};
+
+    s_descriptorWriteCount      = 0;
+    s_descriptorSetUpdates      = 0;
+    s_descriptorTemplateUpdates = 0;
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    FfxResourceInternal srvTexture = resources.srvTexture;
+    if (registeredTexture)
+        FFX_TEST_CHECK(backendInterface.fpRegisterResource(&backendInterface, registeredTexture, effectContextId, &srvTexture) == FFX_OK);
+
+    for (uint32_t pass = 0; pass < FFX_FSR2_PASS_COUNT; ++pass)
+        scheduleDispatch(backendInterface, pipelines[pass], resources, srvTexture, constants);
+
+    FFX_TEST_CHECK(backendInterface.fpExecuteGpuJobs(&backendInterface, getStubCommandListVK(), effectContextId) == FFX_OK);
+    FFX_TEST_CHECK(backendInterface.fpUnregisterResources(&backendInterface, getStubCommandListVK(), effectContextId) == FFX_OK);
+
+    const double microseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    return {s_descriptorWriteCount, s_descriptorSetUpdates + s_descriptorTemplateUpdates, microseconds};
+}
+
+int main()
+{
+    const size_t      maxContexts = 1;
+    const size_t      scratchSize = ffxGetScratchMemorySizeVK(getStubPhysicalDeviceVK(), maxContexts);
+    std::vector<char> scratch(scratchSize);
+
+    FfxInterface backendInterface = {};
+    FFX_TEST_CHECK(ffxGetInterfaceVK(&backendInterface, getStubDeviceVK(), scratch.data(), scratchSize, maxContexts) == FFX_OK);
+
+    FfxUInt32 effectContextId = 0;
+    FFX_TEST_CHECK(backendInterface.fpCreateBackendContext(&backendInterface, FFX_EFFECT_FSR2, nullptr, &effectContextId) == FFX_OK);
+
+    FfxPipelineDescription pipelineDescription = {};
+    wcscpy(pipelineDescription.name, L"FSR2-DESCRIPTORS");
+    pipelineDescription.stage = FFX_BIND_COMPUTE_SHADER_STAGE;
+
+    FfxPipelineState             pipelines[FFX_FSR2_PASS_COUNT] = {};
+    FfxPipelineCreateDescription descriptions[FFX_FSR2_PASS_COUNT];
+    for (uint32_t pass = 0; pass < FFX_FSR2_PASS_COUNT; ++pass)
+        descriptions[pass] = {FfxPass(pass), 0, &pipelineDescription, &pipelines[pass]};
+    FFX_TEST_CHECK(backendInterface.fpCreatePipelines(&backendInterface, FFX_EFFECT_FSR2, descriptions, FFX_FSR2_PASS_COUNT, effectContextId) == FFX_OK);
+
+    // the passes reading a texture are the ones a registered input rewrites
+    uint32_t srvPassCount = 0;
+    for (const FfxPipelineState& pipeline : pipelines)
+        srvPassCount += (pipeline.srvTextureCount > 0) ? 1 : 0;
+
+    FrameResources resources;
+    resources.uavTexture = createTexture(backendInterface, effectContextId, FFX_RESOURCE_USAGE_UAV, FFX_RESOURCE_STATE_UNORDERED_ACCESS, L"DESCRIPTOR_BENCHMARK_UAV");
+    resources.srvTexture = createTexture(backendInterface, effectContextId, FFX_RESOURCE_USAGE_READ_ONLY, FFX_RESOURCE_STATE_COMPUTE_READ, L"DESCRIPTOR_BENCHMARK_SRV");
+    resources.buffer     = createBuffer(backendInterface, effectContextId);
+
+    // the application's input, created behind the backend's back and registered every frame
+    VkImageCreateInfo imageCreateInfo = {};
+    imageCreateInfo.sType             = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    imageCreateInfo.mipLevels         = 1;
+    imageCreateInfo.initialLayout     = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    VkImage image                     = VK_NULL_HANDLE;
+    FFX_TEST_CHECK(stubCreateImage(nullptr, &imageCreateInfo, nullptr, &image) == VK_SUCCESS);
+
+    FfxResourceDescription inputDescription = {};
+    inputDescription.type                   = FFX_RESOURCE_TYPE_TEXTURE2D;
+    inputDescription.format                 = FFX_SURFACE_FORMAT_R16G16B16A16_FLOAT;
+    inputDescription.width                  = 64;
+    inputDescription.height                 = 64;
+    inputDescription.depth                  = 1;
+    inputDescription.mipCount               = 1;
+    inputDescription.usage                  = FFX_RESOURCE_USAGE_READ_ONLY;
+    const FfxResource input                 = ffxGetResourceVK(image, inputDescription, L"DESCRIPTOR_BENCHMARK_INPUT");
+
+    printf("%d FSR2 passes, %u reading a texture\n", int(FFX_FSR2_PASS_COUNT), srvPassCount);
+    printf("%-12s %6s %18s %12s %10s\n", "frames", "frame", "descriptor writes", "set updates", "time");
+
+    for (const FfxResource* registeredTexture : {(const FfxResource*)nullptr, &input})
+    {
+        const char* name = registeredTexture ? "registered" : "internal";
+
+        uint32_t steadyWrites  = 0;
+        uint32_t steadyUpdates = 0;
+        for (uint32_t frame = 0; frame < s_frameCount; ++frame)
+        {
+            const FrameCounts counts = runFrame(backendInterface, effectContextId, pipelines, resources, registeredTexture);
+            if (frame == 0 || frame == s_frameCount - 1)
+                printf("%-12s %6u %18u %12u %7.1f us\n", name, frame, counts.descriptorWrites, counts.setUpdates, counts.microseconds);
+
+            if (frame > 0)
+            {
+                steadyWrites  = std::max(steadyWrites, counts.descriptorWrites);
+                steadyUpdates = std::max(steadyUpdates, counts.setUpdates);
+            }
+        }
+
+        // internal frames find all their sets from the second frame on, registered ones rewrite the reading passes
+        if (registeredTexture)
+            FFX_TEST_CHECK(steadyUpdates <= srvPassCount);
+        else
+            FFX_TEST_CHECK(steadyWrites == 0 && steadyUpdates == 0);
+    }
+
+    FFX_TEST_CHECK(s_dispatchCount == 2 * s_frameCount * FFX_FSR2_PASS_COUNT);
+
+    stubDestroyImage(nullptr, image, nullptr);
+    FFX_TEST_CHECK(backendInterface.fpDestroyResource(&backendInterface, resources.buffer, effectContextId) == FFX_OK);
+    FFX_TEST_CHECK(backendInterface.fpDestroyResource(&backendInterface, resources.srvTexture, effectContextId) == FFX_OK);
+    FFX_TEST_CHECK(backendInterface.fpDestroyResource(&backendInterface, resources.uavTexture, effectContextId) == FFX_OK);
+    for (FfxPipelineState& pipeline : pipelines)
+        FFX_TEST_CHECK(backendInterface.fpDestroyPipeline(&backendInterface, &pipeline, effectContextId) == FFX_OK);
+    FFX_TEST_CHECK(backendInterface.fpDestroyBackendContext(&backendInterface, effectContextId) == FFX_OK);
+
+    return FFX_TEST_RESULT();
+}
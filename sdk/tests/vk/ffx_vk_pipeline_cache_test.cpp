@@ -0,0 +1,145 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Tests pipeline creation in the Vulkan backend against the stub driver (ffx_vk_stub_driver.h), which takes a couple
+// of milliseconds to compile a shader its pipeline cache doesn't hold yet and a fraction of that for one it holds, so
+// the test can tell cache reuse and concurrent compilation apart and time them.
+//
+// The pipelines are FSR2's, compiled in batches through fpCreatePipelines, which must:
+//  - compile a batch on several threads at once, and on the same worker threads from one batch to the next;
+//  - not miss the cache for pipelines a previous batch compiled, within the same backend context, after the last
+//    effect context was destroyed (ffxSetPipelineCacheStorageVK), and on a new backend interface seeded with
+//    ffxGetPipelineCacheDataVK/ffxSetPipelineCacheDataVK.
+
+#include <cwchar>
+
+#include <FidelityFX/host/ffx_fsr2.h>
+#include "vk/ffx_vk_stub_driver.h"
+#include "ffx_test.h"
+
+struct Batch
+{
+    double   milliseconds;
+    uint32_t cacheMisses;
+    uint32_t maxConcurrency;
+};
+
+// Creates an effect context, compiles FSR2's passes on it in one batch and destroys it all again
+static Batch compileBatch(FfxInterface& backendInterface)
+{
+    FfxPipelineDescription pipelineDescription = {};
+    wcscpy(pipelineDescription.name, L"FSR2-BATCH");
+    pipelineDescription.stage = FFX_BIND_COMPUTE_SHADER_STAGE;
+
+    FfxPipelineState             pipelines[FFX_FSR2_PASS_COUNT] = {};
+    FfxPipelineCreateDescription descriptions[FFX_FSR2_PASS_COUNT];
+    for (uint32_t pass = 0; pass < FFX_FSR2_PASS_COUNT; ++pass)
+        descriptions[pass] = {FfxPass(pass), 0, &pipelineDescription, &pipelines[pass]};
+
+    FfxUInt32 effectContextId = 0;
+    FFX_TEST_CHECK(backendInterface.fpCreateBackendContext(&backendInterface, FFX_EFFECT_FSR2, nullptr, &effectContextId) == FFX_OK);
+
+    s_cacheMisses         = 0;
+    s_maxCompilesInFlight = 0;
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    FFX_TEST_CHECK(backendInterface.fpCreatePipelines(&backendInterface, FFX_EFFECT_FSR2, descriptions, FFX_FSR2_PASS_COUNT, effectContextId) == FFX_OK);
+    const Batch batch = {std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count(), s_cacheMisses.load(), s_maxCompilesInFlight.load()};
+
+    for (FfxPipelineState& pipeline : pipelines)
+        FFX_TEST_CHECK(backendInterface.fpDestroyPipeline(&backendInterface, &pipeline, effectContextId) == FFX_OK);
+    FFX_TEST_CHECK(backendInterface.fpDestroyBackendContext(&backendInterface, effectContextId) == FFX_OK);
+
+    return batch;
+}
+
+static void printBatch(const char* name, const Batch& batch)
+{
+    printf("%-28s %8.2f ms %8u %12u\n", name, batch.milliseconds, batch.cacheMisses, batch.maxConcurrency);
+}
+
+int main()
+{
+    const FfxDevice   device      = getStubDeviceVK();
+    const size_t      maxContexts = 2;
+    const size_t      scratchSize = ffxGetScratchMemorySizeVK(getStubPhysicalDeviceVK(), maxContexts);
+    std::vector<char> scratch(scratchSize);
+    std::vector<char> cacheStorage(64 * 1024);
+
+    FfxInterface backendInterface = {};
+    FFX_TEST_CHECK(ffxGetInterfaceVK(&backendInterface, device, scratch.data(), scratchSize, maxContexts) == FFX_OK);
+    FFX_TEST_CHECK(ffxSetPipelineCacheStorageVK(&backendInterface, cacheStorage.data(), cacheStorage.size()) == FFX_OK);
+
+    printf("%-28s %11s %8s %12s\n", "batch of FSR2 pipelines", "time", "misses", "concurrency");
+
+    // keep one effect context alive, so the backend context (and with it the pipeline cache and the workers) outlives
+    // the batches
+    FfxUInt32 holderContextId = 0;
+    FFX_TEST_CHECK(backendInterface.fpCreateBackendContext(&backendInterface, FFX_EFFECT_FSR2, nullptr, &holderContextId) == FFX_OK);
+
+    const Batch cold = compileBatch(backendInterface);
+    printBatch("cold", cold);
+    FFX_TEST_CHECK(cold.cacheMisses > 0);
+    if (std::thread::hardware_concurrency() > 1)
+        FFX_TEST_CHECK(cold.maxConcurrency > 1);
+
+    const std::set<std::thread::id> coldThreads = s_compileThreads;
+    s_compileThreads.clear();
+
+    const Batch warm = compileBatch(backendInterface);
+    printBatch("warm, same backend context", warm);
+    FFX_TEST_CHECK(warm.cacheMisses == 0);
+
+    // the workers of the first batch did the second one
+    for (const std::thread::id& thread : s_compileThreads)
+        FFX_TEST_CHECK(coldThreads.count(thread) == 1);
+
+    FFX_TEST_CHECK(backendInterface.fpDestroyBackendContext(&backendInterface, holderContextId) == FFX_OK);
+
+    // the last effect context is gone: the cache survives in the storage
+    const Batch retained = compileBatch(backendInterface);
+    printBatch("warm, retained in storage", retained);
+    FFX_TEST_CHECK(retained.cacheMisses == 0);
+
+    // and carries over to a new backend interface through the application
+    size_t cacheDataSize = 0;
+    FFX_TEST_CHECK(ffxGetPipelineCacheDataVK(&backendInterface, nullptr, &cacheDataSize) == FFX_OK);
+    FFX_TEST_CHECK(cacheDataSize > sizeof(VkPipelineCacheHeaderVersionOne));
+    std::vector<char> cacheData(cacheDataSize);
+    FFX_TEST_CHECK(ffxGetPipelineCacheDataVK(&backendInterface, cacheData.data(), &cacheDataSize) == FFX_OK);
+
+    std::vector<char> otherScratch(scratchSize);
+    FfxInterface      otherInterface = {};
+    FFX_TEST_CHECK(ffxGetInterfaceVK(&otherInterface, device, otherScratch.data(), scratchSize, maxContexts) == FFX_OK);
+
+    const Batch uncached = compileBatch(otherInterface);
+    printBatch("cold, new interface", uncached);
+    FFX_TEST_CHECK(uncached.cacheMisses == cold.cacheMisses);
+
+    FFX_TEST_CHECK(ffxGetInterfaceVK(&otherInterface, device, otherScratch.data(), scratchSize, maxContexts) == FFX_OK);
+    FFX_TEST_CHECK(ffxSetPipelineCacheDataVK(&otherInterface, cacheData.data(), cacheData.size()) == FFX_OK);
+
+    const Batch restored = compileBatch(otherInterface);
+    printBatch("warm, new interface", restored);
+    FFX_TEST_CHECK(restored.cacheMisses == 0);
+
+    return FFX_TEST_RESULT();
+}
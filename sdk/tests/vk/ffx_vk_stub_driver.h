@@ -0,0 +1,658 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+// A stand-in for the Vulkan driver, to run the Vulkan backend without a device. The loader entry points the backend
+// calls directly are defined here, the device function table is filled from stubGetDeviceProcAddr (set it as
+// VkDeviceContext::vkDeviceProcAddr). Include it in a single source file of a test linking the backend statically.
+//
+// Handles are unique numbers, memory is host memory, and commands are only counted, except for:
+//  - pipeline caches, which hold the hashes of the shaders compiled against them and serialize them behind a valid
+//    VkPipelineCacheHeaderVersionOne. Compiling a shader the cache doesn't hold takes s_stubMissLatency, one it holds
+//    s_stubHitLatency;
+//  - image barriers, which are checked against the layout of every mip of their image: a barrier must transition from
+//    the current layout (or VK_IMAGE_LAYOUT_UNDEFINED), and the barriers of one vkCmdPipelineBarrier must not overlap.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <set>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+#include <FidelityFX/host/backends/vk/ffx_vk.h>
+
+static const std::chrono::microseconds s_stubMissLatency(2000);
+static const std::chrono::microseconds s_stubHitLatency(100);
+static const uint8_t                   s_pipelineCacheUUID[VK_UUID_SIZE] = {'f', 'f', 'x', '-', 's', 't', 'u', 'b'};
+
+//////////////////////////////////////////////////////////////////////////
+// Stub driver
+
+struct StubPipelineCache
+{
+    std::mutex         mutex;
+    std::set<uint64_t> shaders;  // hashes of the shader code compiled against the cache
+};
+
+static std::atomic<uint64_t>        s_nextHandle(1);
+static std::mutex                   s_stubMutex;
+static std::map<uint64_t, uint64_t> s_shaderModuleHashes;  // shader module handle to code hash
+static std::set<std::thread::id>    s_compileThreads;
+static std::atomic<uint32_t>        s_cacheMisses(0);
+static std::atomic<uint32_t>        s_compilesInFlight(0);
+static std::atomic<uint32_t>        s_maxCompilesInFlight(0);
+
+// image handle to the layout of each of its mips
+static std::map<uint64_t, std::vector<VkImageLayout>> s_imageLayouts;
+static std::map<uint64_t, uint32_t>                   s_templateDescriptorCounts;  // update template handle to descriptor count
+
+// command and descriptor counters, reset by the tests as they see fit
+static uint32_t s_pipelineBarrierCount      = 0;  // vkCmdPipelineBarrier calls
+static uint32_t s_imageBarrierCount         = 0;  // image barriers in them
+static uint32_t s_overlappingImageBarriers  = 0;  // image barriers overlapping another of the same call
+static uint32_t s_mismatchedImageBarriers   = 0;  // image barriers transitioning from a layout a mip isn't in
+static uint32_t s_descriptorWriteCount      = 0;  // descriptors written by vkUpdateDescriptorSets(WithTemplate)
+static uint32_t s_descriptorSetUpdates      = 0;  // vkUpdateDescriptorSets calls
+static uint32_t s_descriptorTemplateUpdates = 0;  // vkUpdateDescriptorSetWithTemplate calls
+static uint32_t s_dispatchCount             = 0;
+
+template <typename Handle>
+static Handle newHandle()
+{
+    return (Handle)(uintptr_t)s_nextHandle++;
+}
+
+static uint64_t hashCode(const void* data, size_t size)
+{
+    // FNV-1a
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < size; ++i)
+        hash = (hash ^ static_cast<const uint8_t*>(data)[i]) * 1099511628211ull;
+    return hash;
+}
+
+static void fillPhysicalDeviceProperties(VkPhysicalDeviceProperties* properties)
+{
+    memset(properties, 0, sizeof(*properties));
+    properties->apiVersion                             = VK_API_VERSION_1_3;
+    properties->vendorID                               = 0x1002;
+    properties->deviceID                               = 0x1234;
+    properties->limits.minUniformBufferOffsetAlignment = 256;
+    memcpy(properties->pipelineCacheUUID, s_pipelineCacheUUID, VK_UUID_SIZE);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceProperties(VkPhysicalDevice, VkPhysicalDeviceProperties* pProperties)
+{
+    fillPhysicalDeviceProperties(pProperties);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceProperties2(VkPhysicalDevice, VkPhysicalDeviceProperties2* pProperties)
+{
+    fillPhysicalDeviceProperties(&pProperties->properties);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceFeatures(VkPhysicalDevice, VkPhysicalDeviceFeatures* pFeatures)
+{
+    memset(pFeatures, 0, sizeof(*pFeatures));
+}
+
+VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceFeatures2(VkPhysicalDevice, VkPhysicalDeviceFeatures2* pFeatures)
+{
+    memset(&pFeatures->features, 0, sizeof(pFeatures->features));
+}
+
+VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceMemoryProperties(VkPhysicalDevice, VkPhysicalDeviceMemoryProperties* pMemoryProperties)
+{
+    memset(pMemoryProperties, 0, sizeof(*pMemoryProperties));
+    pMemoryProperties->memoryTypeCount             = 1;
+    pMemoryProperties->memoryTypes[0].propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                                                      VK_MEMORY_PROPERTY_HOST_COHERENT_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+    pMemoryProperties->memoryHeapCount             = 1;
+    pMemoryProperties->memoryHeaps[0].size         = 1ull << 30;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateDeviceExtensionProperties(VkPhysicalDevice, const char*, uint32_t* pPropertyCount, VkExtensionProperties*)
+{
+    *pPropertyCount = 0;
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkCreateBuffer(VkDevice, const VkBufferCreateInfo*, const VkAllocationCallbacks*, VkBuffer* pBuffer)
+{
+    *pBuffer = newHandle<VkBuffer>();
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubDestroyBuffer(VkDevice, VkBuffer, const VkAllocationCallbacks*)
+{
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubGetBufferMemoryRequirements(VkDevice, VkBuffer, VkMemoryRequirements* pMemoryRequirements)
+{
+    pMemoryRequirements->size           = 0;
+    pMemoryRequirements->alignment      = 256;
+    pMemoryRequirements->memoryTypeBits = 1;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL stubAllocateMemory(VkDevice, const VkMemoryAllocateInfo* pAllocateInfo, const VkAllocationCallbacks*, VkDeviceMemory* pMemory)
+{
+    // the uniform buffer is mapped and written through, so back allocations with host memory
+    void* memory = malloc(std::max(size_t(pAllocateInfo->allocationSize), size_t(1)));
+    if (!memory)
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    *pMemory = (VkDeviceMemory)(uintptr_t)memory;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubFreeMemory(VkDevice, VkDeviceMemory memory, const VkAllocationCallbacks*)
+{
+    free((void*)(uintptr_t)memory);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL stubMapMemory(VkDevice, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize, VkMemoryMapFlags, void** ppData)
+{
+    *ppData = (uint8_t*)(uintptr_t)memory + offset;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubUnmapMemory(VkDevice, VkDeviceMemory)
+{
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL stubBindBufferMemory(VkDevice, VkBuffer, VkDeviceMemory, VkDeviceSize)
+{
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL stubCreateDescriptorPool(VkDevice, const VkDescriptorPoolCreateInfo*, const VkAllocationCallbacks*, VkDescriptorPool* pDescriptorPool)
+{
+    *pDescriptorPool = newHandle<VkDescriptorPool>();
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubDestroyDescriptorPool(VkDevice, VkDescriptorPool, const VkAllocationCallbacks*)
+{
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL stubCreateDescriptorSetLayout(VkDevice, const VkDescriptorSetLayoutCreateInfo*, const VkAllocationCallbacks*, VkDescriptorSetLayout* pSetLayout)
+{
+    *pSetLayout = newHandle<VkDescriptorSetLayout>();
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubDestroyDescriptorSetLayout(VkDevice, VkDescriptorSetLayout, const VkAllocationCallbacks*)
+{
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL stubAllocateDescriptorSets(VkDevice, const VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pDescriptorSets)
+{
+    for (uint32_t i = 0; i < pAllocateInfo->descriptorSetCount; ++i)
+        pDescriptorSets[i] = newHandle<VkDescriptorSet>();
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL stubFreeDescriptorSets(VkDevice, VkDescriptorPool, uint32_t, const VkDescriptorSet*)
+{
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL stubCreateSampler(VkDevice, const VkSamplerCreateInfo*, const VkAllocationCallbacks*, VkSampler* pSampler)
+{
+    *pSampler = newHandle<VkSampler>();
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubDestroySampler(VkDevice, VkSampler, const VkAllocationCallbacks*)
+{
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL stubCreatePipelineLayout(VkDevice, const VkPipelineLayoutCreateInfo*, const VkAllocationCallbacks*, VkPipelineLayout* pPipelineLayout)
+{
+    *pPipelineLayout = newHandle<VkPipelineLayout>();
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubDestroyPipelineLayout(VkDevice, VkPipelineLayout, const VkAllocationCallbacks*)
+{
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL stubCreateDescriptorUpdateTemplate(VkDevice, const VkDescriptorUpdateTemplateCreateInfo* pCreateInfo, const VkAllocationCallbacks*, VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate)
+{
+    *pDescriptorUpdateTemplate = newHandle<VkDescriptorUpdateTemplate>();
+
+    uint32_t descriptorCount = 0;
+    for (uint32_t i = 0; i < pCreateInfo->descriptorUpdateEntryCount; ++i)
+        descriptorCount += pCreateInfo->pDescriptorUpdateEntries[i].descriptorCount;
+
+    std::lock_guard<std::mutex> lock(s_stubMutex);
+    s_templateDescriptorCounts[(uint64_t)(uintptr_t)*pDescriptorUpdateTemplate] = descriptorCount;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubDestroyDescriptorUpdateTemplate(VkDevice, VkDescriptorUpdateTemplate descriptorUpdateTemplate, const VkAllocationCallbacks*)
+{
+    std::lock_guard<std::mutex> lock(s_stubMutex);
+    s_templateDescriptorCounts.erase((uint64_t)(uintptr_t)descriptorUpdateTemplate);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL stubCreateShaderModule(VkDevice, const VkShaderModuleCreateInfo* pCreateInfo, const VkAllocationCallbacks*, VkShaderModule* pShaderModule)
+{
+    *pShaderModule = newHandle<VkShaderModule>();
+
+    std::lock_guard<std::mutex> lock(s_stubMutex);
+    s_shaderModuleHashes[(uint64_t)(uintptr_t)*pShaderModule] = hashCode(pCreateInfo->pCode, pCreateInfo->codeSize);
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubDestroyShaderModule(VkDevice, VkShaderModule shaderModule, const VkAllocationCallbacks*)
+{
+    std::lock_guard<std::mutex> lock(s_stubMutex);
+    s_shaderModuleHashes.erase((uint64_t)(uintptr_t)shaderModule);
+}
+
+// A pipeline cache is serialized as a VkPipelineCacheHeaderVersionOne, followed by the number of shaders it holds and
+// their hashes
+static VKAPI_ATTR VkResult VKAPI_CALL stubCreatePipelineCache(VkDevice, const VkPipelineCacheCreateInfo* pCreateInfo, const VkAllocationCallbacks*, VkPipelineCache* pPipelineCache)
+{
+    StubPipelineCache* cache = new StubPipelineCache();
+
+    const size_t headerSize = sizeof(VkPipelineCacheHeaderVersionOne);
+    if (pCreateInfo->pInitialData && pCreateInfo->initialDataSize >= headerSize + sizeof(uint32_t))
+    {
+        const uint8_t* data = static_cast<const uint8_t*>(pCreateInfo->pInitialData);
+
+        uint32_t shaderCount = 0;
+        memcpy(&shaderCount, data + headerSize, sizeof(shaderCount));
+        for (uint32_t i = 0; i < shaderCount && headerSize + sizeof(uint32_t) + (i + 1) * sizeof(uint64_t) <= pCreateInfo->initialDataSize; ++i)
+        {
+            uint64_t shader = 0;
+            memcpy(&shader, data + headerSize + sizeof(uint32_t) + i * sizeof(uint64_t), sizeof(shader));
+            cache->shaders.insert(shader);
+        }
+    }
+
+    *pPipelineCache = (VkPipelineCache)(uintptr_t)cache;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubDestroyPipelineCache(VkDevice, VkPipelineCache pipelineCache, const VkAllocationCallbacks*)
+{
+    delete (StubPipelineCache*)(uintptr_t)pipelineCache;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL stubGetPipelineCacheData(VkDevice, VkPipelineCache pipelineCache, size_t* pDataSize, void* pData)
+{
+    StubPipelineCache*          cache = (StubPipelineCache*)(uintptr_t)pipelineCache;
+    std::lock_guard<std::mutex> lock(cache->mutex);
+
+    const size_t headerSize = sizeof(VkPipelineCacheHeaderVersionOne) + sizeof(uint32_t);
+    const size_t fullSize   = headerSize + cache->shaders.size() * sizeof(uint64_t);
+    if (!pData)
+    {
+        *pDataSize = fullSize;
+        return VK_SUCCESS;
+    }
+    if (*pDataSize < headerSize)
+    {
+        *pDataSize = 0;
+        return VK_INCOMPLETE;
+    }
+
+    // like a driver, write as many whole entries as fit
+    const uint32_t shaderCount = uint32_t(std::min((*pDataSize - headerSize) / sizeof(uint64_t), cache->shaders.size()));
+
+    VkPipelineCacheHeaderVersionOne header = {};
+    header.headerSize                      = sizeof(header);
+    header.headerVersion                   = VK_PIPELINE_CACHE_HEADER_VERSION_ONE;
+    header.vendorID                        = 0x1002;
+    header.deviceID                        = 0x1234;
+    memcpy(header.pipelineCacheUUID, s_pipelineCacheUUID, VK_UUID_SIZE);
+
+    uint8_t* data = static_cast<uint8_t*>(pData);
+    memcpy(data, &header, sizeof(header));
+    memcpy(data + sizeof(header), &shaderCount, sizeof(shaderCount));
+
+    std::set<uint64_t>::const_iterator shader = cache->shaders.begin();
+    for (uint32_t i = 0; i < shaderCount; ++i, ++shader)
+        memcpy(data + headerSize + i * sizeof(uint64_t), &*shader, sizeof(uint64_t));
+
+    *pDataSize = headerSize + shaderCount * sizeof(uint64_t);
+    return shaderCount == cache->shaders.size() ? VK_SUCCESS : VK_INCOMPLETE;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL stubMergePipelineCaches(VkDevice, VkPipelineCache dstCache, uint32_t srcCacheCount, const VkPipelineCache* pSrcCaches)
+{
+    StubPipelineCache*          destination = (StubPipelineCache*)(uintptr_t)dstCache;
+    std::lock_guard<std::mutex> lock(destination->mutex);
+    for (uint32_t i = 0; i < srcCacheCount; ++i)
+    {
+        const StubPipelineCache* source = (const StubPipelineCache*)(uintptr_t)pSrcCaches[i];
+        destination->shaders.insert(source->shaders.begin(), source->shaders.end());
+    }
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL stubCreateComputePipelines(VkDevice, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks*, VkPipeline* pPipelines)
+{
+    const uint32_t inFlight = ++s_compilesInFlight;
+    for (uint32_t maxInFlight = s_maxCompilesInFlight; inFlight > maxInFlight && !s_maxCompilesInFlight.compare_exchange_weak(maxInFlight, inFlight);)
+    {
+    }
+
+    for (uint32_t i = 0; i < createInfoCount; ++i)
+    {
+        uint64_t shader = 0;
+        {
+            std::lock_guard<std::mutex> lock(s_stubMutex);
+            shader = s_shaderModuleHashes[(uint64_t)(uintptr_t)pCreateInfos[i].stage.module];
+            s_compileThreads.insert(std::this_thread::get_id());
+        }
+
+        bool hit = false;
+        if (pipelineCache != VK_NULL_HANDLE)
+        {
+            StubPipelineCache*          cache = (StubPipelineCache*)(uintptr_t)pipelineCache;
+            std::lock_guard<std::mutex> lock(cache->mutex);
+            hit = !cache->shaders.insert(shader).second;
+        }
+
+        if (!hit)
+            ++s_cacheMisses;
+        std::this_thread::sleep_for(hit ? s_stubHitLatency : s_stubMissLatency);
+
+        pPipelines[i] = newHandle<VkPipeline>();
+    }
+
+    --s_compilesInFlight;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubDestroyPipeline(VkDevice, VkPipeline, const VkAllocationCallbacks*)
+{
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL stubCreateImage(VkDevice, const VkImageCreateInfo* pCreateInfo, const VkAllocationCallbacks*, VkImage* pImage)
+{
+    *pImage = newHandle<VkImage>();
+
+    std::lock_guard<std::mutex> lock(s_stubMutex);
+    s_imageLayouts[(uint64_t)(uintptr_t)*pImage].assign(pCreateInfo->mipLevels, pCreateInfo->initialLayout);
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubDestroyImage(VkDevice, VkImage image, const VkAllocationCallbacks*)
+{
+    std::lock_guard<std::mutex> lock(s_stubMutex);
+    s_imageLayouts.erase((uint64_t)(uintptr_t)image);
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubGetImageMemoryRequirements(VkDevice, VkImage, VkMemoryRequirements* pMemoryRequirements)
+{
+    pMemoryRequirements->size           = 0;
+    pMemoryRequirements->alignment      = 256;
+    pMemoryRequirements->memoryTypeBits = 1;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL stubBindImageMemory(VkDevice, VkImage, VkDeviceMemory, VkDeviceSize)
+{
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL stubCreateImageView(VkDevice, const VkImageViewCreateInfo*, const VkAllocationCallbacks*, VkImageView* pView)
+{
+    *pView = newHandle<VkImageView>();
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubDestroyImageView(VkDevice, VkImageView, const VkAllocationCallbacks*)
+{
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL stubFlushMappedMemoryRanges(VkDevice, uint32_t, const VkMappedMemoryRange*)
+{
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubUpdateDescriptorSets(VkDevice, uint32_t descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites, uint32_t, const VkCopyDescriptorSet*)
+{
+    ++s_descriptorSetUpdates;
+    for (uint32_t i = 0; i < descriptorWriteCount; ++i)
+        s_descriptorWriteCount += pDescriptorWrites[i].descriptorCount;
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubUpdateDescriptorSetWithTemplate(VkDevice, VkDescriptorSet, VkDescriptorUpdateTemplate descriptorUpdateTemplate, const void*)
+{
+    std::lock_guard<std::mutex> lock(s_stubMutex);
+    ++s_descriptorTemplateUpdates;
+    s_descriptorWriteCount += s_templateDescriptorCounts[(uint64_t)(uintptr_t)descriptorUpdateTemplate];
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL stubDeviceWaitIdle(VkDevice)
+{
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL stubSetDebugUtilsObjectName(VkDevice, const VkDebugUtilsObjectNameInfoEXT*)
+{
+    return VK_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Commands
+
+static VKAPI_ATTR void VKAPI_CALL stubCmdPipelineBarrier(VkCommandBuffer, VkPipelineStageFlags, VkPipelineStageFlags, VkDependencyFlags, uint32_t, const VkMemoryBarrier*, uint32_t, const VkBufferMemoryBarrier*,
+                                                        uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers)
+{
+    std::lock_guard<std::mutex> lock(s_stubMutex);
+    ++s_pipelineBarrierCount;
+    s_imageBarrierCount += imageMemoryBarrierCount;
+
+    // all barriers of the call are checked against the layouts before it, then applied
+    std::vector<std::pair<uint32_t, uint32_t>> ranges(imageMemoryBarrierCount);
+    for (uint32_t i = 0; i < imageMemoryBarrierCount; ++i)
+    {
+        const VkImageMemoryBarrier&       barrier = pImageMemoryBarriers[i];
+        const std::vector<VkImageLayout>& layouts = s_imageLayouts[(uint64_t)(uintptr_t)barrier.image];
+
+        const uint32_t mipCount   = uint32_t(layouts.size());
+        const uint32_t baseMip    = barrier.subresourceRange.baseMipLevel;
+        const uint32_t levelCount = barrier.subresourceRange.levelCount;
+        ranges[i] = {baseMip, std::min(mipCount, levelCount == VK_REMAINING_MIP_LEVELS ? mipCount : baseMip + levelCount)};
+
+        for (uint32_t mip = ranges[i].first; mip < ranges[i].second; ++mip)
+        {
+            if (barrier.oldLayout != VK_IMAGE_LAYOUT_UNDEFINED && barrier.oldLayout != layouts[mip])
+            {
+                ++s_mismatchedImageBarriers;
+                break;
+            }
+        }
+
+        for (uint32_t j = 0; j < i; ++j)
+        {
+            if (pImageMemoryBarriers[j].image == barrier.image && ranges[j].first < ranges[i].second && ranges[i].first < ranges[j].second)
+            {
+                ++s_overlappingImageBarriers;
+                break;
+            }
+        }
+    }
+
+    for (uint32_t i = 0; i < imageMemoryBarrierCount; ++i)
+    {
+        std::vector<VkImageLayout>& layouts = s_imageLayouts[(uint64_t)(uintptr_t)pImageMemoryBarriers[i].image];
+        for (uint32_t mip = ranges[i].first; mip < ranges[i].second; ++mip)
+            layouts[mip] = pImageMemoryBarriers[i].newLayout;
+    }
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubCmdBindPipeline(VkCommandBuffer, VkPipelineBindPoint, VkPipeline)
+{
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubCmdBindDescriptorSets(VkCommandBuffer, VkPipelineBindPoint, VkPipelineLayout, uint32_t, uint32_t, const VkDescriptorSet*, uint32_t, const uint32_t*)
+{
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubCmdDispatch(VkCommandBuffer, uint32_t, uint32_t, uint32_t)
+{
+    ++s_dispatchCount;
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubCmdDispatchIndirect(VkCommandBuffer, VkBuffer, VkDeviceSize)
+{
+    ++s_dispatchCount;
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubCmdCopyBuffer(VkCommandBuffer, VkBuffer, VkBuffer, uint32_t, const VkBufferCopy*)
+{
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubCmdCopyImage(VkCommandBuffer, VkImage, VkImageLayout, VkImage, VkImageLayout, uint32_t, const VkImageCopy*)
+{
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubCmdCopyBufferToImage(VkCommandBuffer, VkBuffer, VkImage, VkImageLayout, uint32_t, const VkBufferImageCopy*)
+{
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubCmdClearColorImage(VkCommandBuffer, VkImage, VkImageLayout, const VkClearColorValue*, uint32_t, const VkImageSubresourceRange*)
+{
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubCmdFillBuffer(VkCommandBuffer, VkBuffer, VkDeviceSize, VkDeviceSize, uint32_t)
+{
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubCmdBeginDebugUtilsLabel(VkCommandBuffer, const VkDebugUtilsLabelEXT*)
+{
+}
+
+static VKAPI_ATTR void VKAPI_CALL stubCmdEndDebugUtilsLabel(VkCommandBuffer)
+{
+}
+
+// Entry points no test needed yet are left out, so calling one fails loudly
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL stubGetDeviceProcAddr(VkDevice, const char* pName)
+{
+    static const struct
+    {
+        const char*        name;
+        PFN_vkVoidFunction function;
+    } s_entryPoints[] = {
+        {"vkCreateBuffer", (PFN_vkVoidFunction)vkCreateBuffer},
+        {"vkDestroyBuffer", (PFN_vkVoidFunction)stubDestroyBuffer},
+        {"vkGetBufferMemoryRequirements", (PFN_vkVoidFunction)stubGetBufferMemoryRequirements},
+        {"vkAllocateMemory", (PFN_vkVoidFunction)stubAllocateMemory},
+        {"vkFreeMemory", (PFN_vkVoidFunction)stubFreeMemory},
+        {"vkMapMemory", (PFN_vkVoidFunction)stubMapMemory},
+        {"vkUnmapMemory", (PFN_vkVoidFunction)stubUnmapMemory},
+        {"vkBindBufferMemory", (PFN_vkVoidFunction)stubBindBufferMemory},
+        {"vkCreateDescriptorPool", (PFN_vkVoidFunction)stubCreateDescriptorPool},
+        {"vkDestroyDescriptorPool", (PFN_vkVoidFunction)stubDestroyDescriptorPool},
+        {"vkCreateDescriptorSetLayout", (PFN_vkVoidFunction)stubCreateDescriptorSetLayout},
+        {"vkDestroyDescriptorSetLayout", (PFN_vkVoidFunction)stubDestroyDescriptorSetLayout},
+        {"vkAllocateDescriptorSets", (PFN_vkVoidFunction)stubAllocateDescriptorSets},
+        {"vkFreeDescriptorSets", (PFN_vkVoidFunction)stubFreeDescriptorSets},
+        {"vkCreateSampler", (PFN_vkVoidFunction)stubCreateSampler},
+        {"vkDestroySampler", (PFN_vkVoidFunction)stubDestroySampler},
+        {"vkCreatePipelineLayout", (PFN_vkVoidFunction)stubCreatePipelineLayout},
+        {"vkDestroyPipelineLayout", (PFN_vkVoidFunction)stubDestroyPipelineLayout},
+        {"vkCreateDescriptorUpdateTemplate", (PFN_vkVoidFunction)stubCreateDescriptorUpdateTemplate},
+        {"vkDestroyDescriptorUpdateTemplate", (PFN_vkVoidFunction)stubDestroyDescriptorUpdateTemplate},
+        {"vkCreateShaderModule", (PFN_vkVoidFunction)stubCreateShaderModule},
+        {"vkDestroyShaderModule", (PFN_vkVoidFunction)stubDestroyShaderModule},
+        {"vkCreatePipelineCache", (PFN_vkVoidFunction)stubCreatePipelineCache},
+        {"vkDestroyPipelineCache", (PFN_vkVoidFunction)stubDestroyPipelineCache},
+        {"vkGetPipelineCacheData", (PFN_vkVoidFunction)stubGetPipelineCacheData},
+        {"vkMergePipelineCaches", (PFN_vkVoidFunction)stubMergePipelineCaches},
+        {"vkCreateComputePipelines", (PFN_vkVoidFunction)stubCreateComputePipelines},
+        {"vkDestroyPipeline", (PFN_vkVoidFunction)stubDestroyPipeline},
+        {"vkDeviceWaitIdle", (PFN_vkVoidFunction)stubDeviceWaitIdle},
+        {"vkSetDebugUtilsObjectNameEXT", (PFN_vkVoidFunction)stubSetDebugUtilsObjectName},
+        {"vkCreateImage", (PFN_vkVoidFunction)stubCreateImage},
+        {"vkDestroyImage", (PFN_vkVoidFunction)stubDestroyImage},
+        {"vkGetImageMemoryRequirements", (PFN_vkVoidFunction)stubGetImageMemoryRequirements},
+        {"vkBindImageMemory", (PFN_vkVoidFunction)stubBindImageMemory},
+        {"vkCreateImageView", (PFN_vkVoidFunction)stubCreateImageView},
+        {"vkDestroyImageView", (PFN_vkVoidFunction)stubDestroyImageView},
+        {"vkFlushMappedMemoryRanges", (PFN_vkVoidFunction)stubFlushMappedMemoryRanges},
+        {"vkUpdateDescriptorSets", (PFN_vkVoidFunction)stubUpdateDescriptorSets},
+        {"vkUpdateDescriptorSetWithTemplate", (PFN_vkVoidFunction)stubUpdateDescriptorSetWithTemplate},
+        {"vkCmdPipelineBarrier", (PFN_vkVoidFunction)stubCmdPipelineBarrier},
+        {"vkCmdBindPipeline", (PFN_vkVoidFunction)stubCmdBindPipeline},
+        {"vkCmdBindDescriptorSets", (PFN_vkVoidFunction)stubCmdBindDescriptorSets},
+        {"vkCmdDispatch", (PFN_vkVoidFunction)stubCmdDispatch},
+        {"vkCmdDispatchIndirect", (PFN_vkVoidFunction)stubCmdDispatchIndirect},
+        {"vkCmdCopyBuffer", (PFN_vkVoidFunction)stubCmdCopyBuffer},
+        {"vkCmdCopyImage", (PFN_vkVoidFunction)stubCmdCopyImage},
+        {"vkCmdCopyBufferToImage", (PFN_vkVoidFunction)stubCmdCopyBufferToImage},
+        {"vkCmdClearColorImage", (PFN_vkVoidFunction)stubCmdClearColorImage},
+        {"vkCmdFillBuffer", (PFN_vkVoidFunction)stubCmdFillBuffer},
+        {"vkCmdBeginDebugUtilsLabelEXT", (PFN_vkVoidFunction)stubCmdBeginDebugUtilsLabel},
+        {"vkCmdEndDebugUtilsLabelEXT", (PFN_vkVoidFunction)stubCmdEndDebugUtilsLabel},
+    };
+
+    for (const auto& entryPoint : s_entryPoints)
+    {
+        if (strcmp(entryPoint.name, pName) == 0)
+            return entryPoint.function;
+    }
+    return nullptr;
+}
+
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetDeviceProcAddr(VkDevice device, const char* pName)
+{
+    return stubGetDeviceProcAddr(device, pName);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Device
+
+static int s_stubPhysicalDevice;
+static int s_stubDevice;
+static int s_stubCommandBuffer;
+
+static FfxDevice getStubDeviceVK()
+{
+    VkDeviceContext deviceContext  = {};
+    deviceContext.vkDevice         = (VkDevice)&s_stubDevice;
+    deviceContext.vkPhysicalDevice = (VkPhysicalDevice)&s_stubPhysicalDevice;
+    deviceContext.vkDeviceProcAddr = stubGetDeviceProcAddr;
+    return ffxGetDeviceVK(&deviceContext);
+}
+
+static VkPhysicalDevice getStubPhysicalDeviceVK()
+{
+    return (VkPhysicalDevice)&s_stubPhysicalDevice;
+}
+
+static FfxCommandList getStubCommandListVK()
+{
+    return ffxGetCommandListVK((VkCommandBuffer)&s_stubCommandBuffer);
+}
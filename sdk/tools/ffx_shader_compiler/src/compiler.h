@@ -238,4 +238,16 @@ public:
     ///
     /// @ingroup ShaderCompiler
     virtual void WritePermutationHeaderReflectionData(FILE* fp, const Permutation& permutation)                    = 0;
+
+    /// Queries a string uniquely identifying the compiler binary and backend in use. Must be
+    /// overridden for each language supported (i.e. HLSL, GLSL, etc.)
+    ///
+    /// Used to key the persistent shader cache, so that switching or updating the compiler
+    /// invalidates previously cached permutations.
+    ///
+    /// @returns
+    /// The compiler identity string.
+    ///
+    /// @ingroup ShaderCompiler
+    virtual std::string GetCompilerIdentity()                                                                       = 0;
 };
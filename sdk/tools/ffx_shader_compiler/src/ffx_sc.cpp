@@ -22,6 +22,8 @@
 
 #include "hlsl_compiler.h"
 #include "glsl_compiler.h"
+#include "shader_cache.h"
+#include "shader_archive.h"
 #include "utils.h"
 
 #include <Windows.h>
@@ -32,6 +34,8 @@
 #include <unordered_set>
 #include <locale>
 #include <stdexcept>
+#include <atomic>
+#include <chrono>
 
 
 #pragma comment(lib, "pathcch.lib")
@@ -104,18 +108,23 @@ struct LaunchParameters
     std::vector<std::wstring>      compilerArgs;
     std::wstring                   ouputPath;
     std::wstring                   inputFile;
+    std::vector<std::wstring>      inputFiles;
     std::wstring                   shaderName;
     std::wstring                   compiler;
     std::wstring                   dxcDll;
     std::wstring                   d3dDll;
     std::wstring                   glslangExe;
     std::wstring                   deps;
+    std::wstring                   cacheDir;
+    uint64_t                       cacheSizeMB        = 2048;
     int                            numThreads         = 0;
     bool                           generateReflection = false;
     bool                           embedArguments     = false;
     bool                           printArguments     = false;
     bool                           disableLogs        = false;
     bool                           debugCompile       = false;
+    bool                           generateArchive    = false;
+    bool                           packArchives       = false;
 
     static void PrintCommandLineSyntax();
     void        ParseCommandLine(int argCount, const wchar_t* const* args);
@@ -124,6 +133,7 @@ private:
     static void ParsePermutationOption(PermutationOption& outPermutationOption, const std::wstring arg);
     static void ParseString(std::wstring& outCompilerArg, const wchar_t* arg);
     static void ParseNumThreads(int& outNumThreads, const wchar_t* arg);
+    static void ParseCacheSize(uint64_t& outCacheSizeMB, const wchar_t* arg);
     static void EnsureOutputPathExistsAndMakeCanonical(std::wstring & inoutOutputPath);
 };
 
@@ -132,6 +142,8 @@ class Application
 private:
     LaunchParameters                     m_Params;
     std::unique_ptr<ICompiler>           m_Compiler;
+    std::unique_ptr<ShaderCache>         m_Cache;
+    std::string                          m_CompilerIdentity;
     std::deque<Permutation>              m_MacroPermutations;
     std::vector<Permutation>             m_UniquePermutations;
     std::mutex                           m_ReadMutex;
@@ -141,6 +153,7 @@ private:
     std::unordered_map<std::string, int> m_HashToIndexMap;
     std::wstring                         m_ShaderFileName;
     std::wstring                         m_ShaderName;
+    std::atomic<size_t>                  m_BytesWritten = 0;
 
 public:
     Application(const LaunchParameters& params);
@@ -148,6 +161,7 @@ public:
     {
     }
     void Process();
+    static void PackArchives(const LaunchParameters& params);
 
 private:
     static std::wstring MakeFullPath(const std::wstring& outputPath, const std::wstring& fileName);
@@ -159,6 +173,7 @@ private:
     void WriteShaderBinaryHeader(Permutation& permutation);
     void PrintPermutationArguments(Permutation& permutation);
     void WriteShaderPermutationsHeader();
+    void WriteShaderPermutationsArchive();
     void DumpDepfileGCC();
     void DumpDepfileMSVC();
 };
@@ -205,6 +220,18 @@ void LaunchParameters::PrintCommandLineSyntax()
         L"  Dump depfile which recorded the include file dependencies in format of (gcc or msvc).\n"
         L"-debugcompile\n"
         L"  Compile shader with debug information.\n"
+        L"-cache=<Path>\n"
+        L"  Directory of a persistent compile cache. Permutations whose source, includes, defines, compiler\n"
+        L"  and arguments are unchanged are restored from the cache instead of being recompiled.\n"
+        L"-cache-size=<MB>\n"
+        L"  Size budget of the compile cache in megabytes (default 2048, 0 for unbounded).\n"
+        L"  Least recently used entries are evicted once exceeded.\n"
+        L"-archive\n"
+        L"  Write all permutations and their reflection data into a single binary archive (<Name>_permutations.ffxpak)\n"
+        L"  instead of one header per permutation. The generated permutations header then only declares the option\n"
+        L"  enums and the permutation key.\n"
+        L"-pack\n"
+        L"  Merge the archives given as input files into <Output>/<Name>.ffxpak instead of compiling a shader.\n"
         L"-debugcmdline\n"
         L"  Print all the input arguments.\n"
     );
@@ -275,6 +302,10 @@ void LaunchParameters::ParseCommandLine(int argCount, const wchar_t* const* args
             ParseString(glslangExe, args[i]);
         else if (StartsWith(args[i], L"-deps"))
             ParseString(deps, args[i]);
+        else if (StartsWith(args[i], L"-cache-size"))
+            ParseCacheSize(cacheSizeMB, args[i]);
+        else if (StartsWith(args[i], L"-cache"))
+            ParseString(cacheDir, args[i]);
         else if (std::wstring(args[i]) == L"-reflection")
             generateReflection = true;
         else if (std::wstring(args[i]) == L"-embed-arguments")
@@ -285,6 +316,10 @@ void LaunchParameters::ParseCommandLine(int argCount, const wchar_t* const* args
             disableLogs = true;
         else if (std::wstring(args[i]) == L"-debugcompile")
             debugCompile = true;
+        else if (std::wstring(args[i]) == L"-archive")
+            generateArchive = true;
+        else if (std::wstring(args[i]) == L"-pack")
+            packArchives = true;
         else if (args[i][0] == L'-')
         {
             compilerArgs.push_back(args[i++]);
@@ -302,7 +337,10 @@ void LaunchParameters::ParseCommandLine(int argCount, const wchar_t* const* args
             }
         }
         else
+        {
             inputFile = args[i];
+            inputFiles.push_back(args[i]);
+        }
     }
     EnsureOutputPathExistsAndMakeCanonical(ouputPath);
 }
@@ -387,13 +425,28 @@ void LaunchParameters::ParseNumThreads(int& outNumThreads, const wchar_t* arg)
     outNumThreads         = std::stoi(argStr.substr(equalPos + 1, argStr.length() - equalPos));
 }
 
+void LaunchParameters::ParseCacheSize(uint64_t& outCacheSizeMB, const wchar_t* arg)
+{
+    std::wstring argStr   = std::wstring(arg);
+    size_t       equalPos = argStr.find_first_of(L"=", 0);
+    outCacheSizeMB        = std::stoull(argStr.substr(equalPos + 1, argStr.length() - equalPos));
+}
+
 Application::Application(const LaunchParameters& params)
     : m_Params(params) {}
 
 void Application::Process()
 {
+    auto startTime = std::chrono::steady_clock::now();
+
     OpenSourceFile();
 
+    if (!m_Params.cacheDir.empty())
+    {
+        m_Cache            = std::make_unique<ShaderCache>(fs::path(m_Params.cacheDir), m_Params.cacheSizeMB * 1024 * 1024);
+        m_CompilerIdentity = m_Compiler->GetCompilerIdentity();
+    }
+
     GenerateMacroPermutations(m_MacroPermutations);
 
     size_t predictedDuplicates = std::count_if(m_MacroPermutations.begin(), m_MacroPermutations.end(), [](const Permutation& p) { return p.identicalTo.has_value(); });
@@ -418,6 +471,9 @@ void Application::Process()
 
     WriteShaderPermutationsHeader();
 
+    if (m_Params.generateArchive)
+        WriteShaderPermutationsArchive();
+
     // dump dependencies file if needed
     if (m_Params.deps == L"gcc")
         DumpDepfileGCC();
@@ -433,6 +489,27 @@ void Application::Process()
     {
         printf("\nERROR: Predicted %llu duplicates\n\n\n", predictedDuplicates);
     }
+
+    double elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    printf("%s: Wrote %.2f KB of %s in %.2f s.\n",
+           WCharToUTF8(m_ShaderFileName).c_str(),
+           static_cast<double>(m_BytesWritten.load()) / 1024.0,
+           m_Params.generateArchive ? "headers and archive" : "headers",
+           elapsedSeconds);
+
+    if (m_Cache)
+    {
+        m_Cache->Trim();
+
+        ShaderCacheStats stats = m_Cache->GetStats();
+        printf("%s: Compile cache %llu hits, %llu misses, %llu stored, %llu evicted (%.2f MB in cache).\n",
+               WCharToUTF8(m_ShaderFileName).c_str(),
+               stats.hits,
+               stats.misses,
+               stats.stores,
+               stats.evictions,
+               static_cast<double>(stats.sizeInBytes) / (1024.0 * 1024.0));
+    }
 }
 
 std::wstring Application::MakeFullPath(const std::wstring & outputPath, const std::wstring & fileName)
@@ -725,20 +802,37 @@ void Application::CompilePermutation(Permutation& permutation)
         PrintPermutationArguments(permutation);
 
     // ------------------------------------------------------------------------------------------------
-    // Compile it with specified arguments.
+    // Try to restore it from the compile cache.
     // ------------------------------------------------------------------------------------------------
-    if (!m_Compiler->Compile(permutation, args, m_WriteMutex))
-    {   
-        fprintf(stderr, "failed to compile shader : %s\n", permutation.sourcePath.generic_string().c_str());
-        throw std::runtime_error("failed to compile shader: " + permutation.sourcePath.generic_string());
+    std::string cacheKey;
+    bool        cacheHit = false;
+
+    if (m_Cache)
+    {
+        cacheKey = m_Cache->ComputeKey(m_CompilerIdentity, permutation.sourcePath, args, m_Params.generateReflection);
+        cacheHit = m_Cache->Lookup(cacheKey, permutation);
     }
-        
 
-    // ------------------------------------------------------------------------------------------------
-    // Retrieve reflection data
-    // ------------------------------------------------------------------------------------------------
-    if (m_Params.generateReflection)
-        m_Compiler->ExtractReflectionData(permutation);
+    if (!cacheHit)
+    {
+        // ------------------------------------------------------------------------------------------------
+        // Compile it with specified arguments.
+        // ------------------------------------------------------------------------------------------------
+        if (!m_Compiler->Compile(permutation, args, m_WriteMutex))
+        {   
+            fprintf(stderr, "failed to compile shader : %s\n", permutation.sourcePath.generic_string().c_str());
+            throw std::runtime_error("failed to compile shader: " + permutation.sourcePath.generic_string());
+        }
+
+        // ------------------------------------------------------------------------------------------------
+        // Retrieve reflection data
+        // ------------------------------------------------------------------------------------------------
+        if (m_Params.generateReflection)
+            m_Compiler->ExtractReflectionData(permutation);
+
+        if (m_Cache)
+            m_Cache->Store(cacheKey, permutation);
+    }
 
     bool shouldWrite = false;
 
@@ -755,7 +849,9 @@ void Application::CompilePermutation(Permutation& permutation)
         // Add the unique permutations to a vector to make writing the permutations header easier.
         m_UniquePermutations.push_back(permutation);
 
-        m_UniquePermutations.back().shaderBinary.reset();
+        // The archive is written in one go at the end, so keep the binary around in that case.
+        if (!m_Params.generateArchive)
+            m_UniquePermutations.back().shaderBinary.reset();
     }
 
     // An extra map to make looking up the index of a permutation with its' shader key much easier.
@@ -766,7 +862,7 @@ void Application::CompilePermutation(Permutation& permutation)
     // ------------------------------------------------------------------------------------------------
     // Write shader binary
     // ------------------------------------------------------------------------------------------------
-    if (shouldWrite)
+    if (shouldWrite && !m_Params.generateArchive)
         WriteShaderBinaryHeader(permutation);
 
     permutation.shaderBinary.reset();
@@ -855,6 +951,8 @@ void Application::WriteShaderBinaryHeader(Permutation& permutation)
 
     fprintf(fp, "\n};\n\n");
 
+    m_BytesWritten += static_cast<size_t>(ftell(fp));
+
     fclose(fp);
 }
 
@@ -922,16 +1020,19 @@ void Application::WriteShaderPermutationsHeader()
     _wfopen_s(&fp, outputPath.c_str(), L"wb");
 
     // ------------------------------------------------------------------------------------------------
-    // Write header includes
+    // Write header includes (archives carry the binaries themselves)
     // ------------------------------------------------------------------------------------------------
-    for (int i = 0; i < m_UniquePermutations.size(); i++)
+    if (!m_Params.generateArchive)
     {
-        const Permutation& permutation = m_UniquePermutations[i];
+        for (int i = 0; i < m_UniquePermutations.size(); i++)
+        {
+            const Permutation& permutation = m_UniquePermutations[i];
 
-        fprintf(fp, "#include \"%s\"\n", permutation.headerFileName.c_str());
-    }
+            fprintf(fp, "#include \"%s\"\n", permutation.headerFileName.c_str());
+        }
 
-    fprintf(fp, "\n");
+        fprintf(fp, "\n");
+    }
 
     // ------------------------------------------------------------------------------------------------
     // Write shader option enums
@@ -986,6 +1087,14 @@ void Application::WriteShaderPermutationsHeader()
     fprintf(fp, "    uint32_t index;\n");
     fprintf(fp, "} %s;\n\n", unionName.c_str());
 
+    // The permutation tables live in the archive.
+    if (m_Params.generateArchive)
+    {
+        m_BytesWritten += static_cast<size_t>(ftell(fp));
+        fclose(fp);
+        return;
+    }
+
     // ------------------------------------------------------------------------------------------------
     // Write permutation info struct
     // ------------------------------------------------------------------------------------------------
@@ -1039,9 +1148,98 @@ void Application::WriteShaderPermutationsHeader()
         fprintf(fp, "};\n\n");
     }
 
+    m_BytesWritten += static_cast<size_t>(ftell(fp));
+
     fclose(fp);
 }
 
+void Application::WriteShaderPermutationsArchive()
+{
+    ArchiveSection section;
+    section.name = WCharToUTF8(m_ShaderName);
+
+    // ------------------------------------------------------------------------------------------------
+    // Indirection table
+    // ------------------------------------------------------------------------------------------------
+    uint32_t usedBits = 0;
+
+    for (const auto& option : m_Params.permutationOptions)
+        usedBits += option.numBits;
+
+    uint32_t totalPossiblePermutations = 1u << usedBits;
+
+    section.indirectionTable.resize(totalPossiblePermutations, 0);
+    for (const auto& [key, index] : m_KeyToIndexMap)
+        if (static_cast<uint32_t>(key) < totalPossiblePermutations)
+            section.indirectionTable[key] = index;
+
+    // ------------------------------------------------------------------------------------------------
+    // Permutation binaries and reflection data
+    // ------------------------------------------------------------------------------------------------
+    for (Permutation& permutation : m_UniquePermutations)
+    {
+        ArchivePermutation archivePermutation;
+
+        uint8_t* shaderBinary = permutation.shaderBinary->BufferPointer();
+        archivePermutation.binary.assign(shaderBinary, shaderBinary + permutation.shaderBinary->BufferSize());
+
+        if (m_Params.generateReflection && permutation.reflectionData)
+        {
+            const IReflectionData& reflection = *permutation.reflectionData;
+
+            archivePermutation.resources[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_CBV]                       = reflection.constantBuffers;
+            archivePermutation.resources[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_TEXTURE_SRV]               = reflection.srvTextures;
+            archivePermutation.resources[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_TEXTURE_UAV]               = reflection.uavTextures;
+            archivePermutation.resources[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_BUFFER_SRV]                = reflection.srvBuffers;
+            archivePermutation.resources[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_BUFFER_UAV]                = reflection.uavBuffers;
+            archivePermutation.resources[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_SAMPLER]                   = reflection.samplers;
+            archivePermutation.resources[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_RT_ACCELERATION_STRUCTURE] = reflection.rtAccelerationStructures;
+        }
+
+        section.permutations.push_back(std::move(archivePermutation));
+        permutation.shaderBinary.reset();
+    }
+
+    ShaderArchiveBuilder builder;
+    builder.AddSection(std::move(section));
+
+    std::wstring outputPath = MakeFullPath(m_Params.ouputPath, m_ShaderName + L"_permutations.ffxpak");
+
+    size_t archiveSize = builder.Write(outputPath);
+    if (archiveSize == 0)
+        throw std::runtime_error("Failed to write shader archive: " + WCharToUTF8(outputPath));
+
+    m_BytesWritten += archiveSize;
+}
+
+void Application::PackArchives(const LaunchParameters& params)
+{
+    if (params.shaderName.empty())
+        throw std::runtime_error("-pack requires -name to be set.");
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    ShaderArchiveBuilder builder;
+    for (const std::wstring& inputFile : params.inputFiles)
+    {
+        if (!builder.AddArchive(fs::path(inputFile)))
+            throw std::runtime_error("Failed to read shader archive: " + WCharToUTF8(inputFile));
+    }
+
+    std::wstring outputPath  = MakeFullPath(params.ouputPath, params.shaderName + L".ffxpak");
+    size_t       archiveSize = builder.Write(outputPath);
+    if (archiveSize == 0)
+        throw std::runtime_error("Failed to write shader archive: " + WCharToUTF8(outputPath));
+
+    double elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    printf("%s: Packed %zu shaders from %zu archives, %.2f KB in %.2f s.\n",
+           WCharToUTF8(params.shaderName).c_str(),
+           builder.GetSectionCount(),
+           params.inputFiles.size(),
+           static_cast<double>(archiveSize) / 1024.0,
+           elapsedSeconds);
+}
+
 void Application::DumpDepfileGCC()
 {
     if (m_UniquePermutations.empty())
@@ -1097,6 +1295,12 @@ int wmain(int argc, wchar_t** argv)
         LaunchParameters params;
         params.ParseCommandLine(argc - 1, argv + 1);
 
+        if (params.packArchives)
+        {
+            Application::PackArchives(params);
+            return 0;
+        }
+
         Application app(params);
         app.Process();
 
@@ -23,39 +23,8 @@
 #include "glsl_compiler.h"
 #include "utils.h"
 
-#include <md5.h>
 #include <spirv_reflect.h>
 
-std::string MD5HashString(unsigned char* sig)
-{
-    char out[33];
-    out[32] = '\0';
-
-    char* out_ptr = out;
-    std::stringstream ss;
-
-    for (int i = 0; i < MD5_SIZE; i++)
-    {
-        std::snprintf(out_ptr, 32, "%02x", sig[i]);
-        out_ptr += 2;
-    }
-
-    return std::string(out);
-}
-
-std::string GetMD5HashDigest(void* buffer, size_t size)
-{
-    unsigned char sig[MD5_SIZE];
-
-    md5::md5_t md5;
-
-    md5.process(buffer, size);
-
-    md5.finish(sig);
-
-    return MD5HashString(sig);
-}
-
 uint8_t* GLSLShaderBinary::BufferPointer()
 {
     return spirv.data();
@@ -541,3 +510,8 @@ void GLSLCompiler::WritePermutationHeaderReflectionData(FILE* fp, const Permutat
     WriteResourceInfo(fp, glslReflectionData->samplers.size(), permutation.name, "Sampler");
     WriteResourceInfo(fp, glslReflectionData->rtAccelerationStructures.size(), permutation.name, "RTAccelerationStructure");
 }
+
+std::string GLSLCompiler::GetCompilerIdentity()
+{
+    return "glslang|" + GetFileIdentity(m_GlslangExe);
+}
@@ -146,6 +146,14 @@ public:
     /// @ingroup ShaderCompiler
     void WritePermutationHeaderReflectionData(FILE* fp, const Permutation& permutation) override;
 
+    /// Queries a string uniquely identifying the GLSL compiler binary and backend in use.
+    ///
+    /// @returns
+    /// The compiler identity string.
+    ///
+    /// @ingroup ShaderCompiler
+    std::string GetCompilerIdentity() override;
+
 private:
     std::string m_GlslangExe;
     std::unordered_set<std::string> m_ShaderDependencies;
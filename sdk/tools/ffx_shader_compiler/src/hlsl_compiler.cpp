@@ -1100,3 +1100,15 @@ void HLSLCompiler::WritePermutationHeaderReflectionData(FILE* fp, const Permutat
     WriteResourceInfo(fp, hlslReflectionData->samplers.size(), permutation.name, "Sampler");
     WriteResourceInfo(fp, hlslReflectionData->rtAccelerationStructures.size(), permutation.name, "RTAccelerationStructure");
 }
+
+std::string HLSLCompiler::GetCompilerIdentity()
+{
+    std::string identity = "hlsl|" + std::to_string(static_cast<uint32_t>(m_backend));
+
+    // Identify the compiler by the dll that was actually loaded rather than the requested name
+    wchar_t modulePath[MAX_PATH] = {};
+    if (m_DllHandle != nullptr && GetModuleFileNameW(m_DllHandle, modulePath, MAX_PATH) != 0)
+        identity += "|" + GetFileIdentity(modulePath);
+
+    return identity;
+}
@@ -200,6 +200,14 @@ public:
     /// @ingroup ShaderCompiler
     void WritePermutationHeaderReflectionData(FILE* fp, const Permutation& permutation) override;
 
+    /// Queries a string uniquely identifying the HLSL compiler binary and backend in use.
+    ///
+    /// @returns
+    /// The compiler identity string.
+    ///
+    /// @ingroup ShaderCompiler
+    std::string GetCompilerIdentity() override;
+
 private:
     bool CompileDXC(Permutation&                    permutation,
                     const std::vector<std::string>& arguments,
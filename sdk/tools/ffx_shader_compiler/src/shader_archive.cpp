@@ -0,0 +1,322 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include "shader_archive.h"
+
+#include <ffx_shader_blob_lz.h>
+
+namespace
+{
+    uint32_t AlignUp(uint32_t value, uint32_t alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    template <typename T>
+    bool ReadStruct(const std::vector<uint8_t>& data, uint32_t offset, T& out)
+    {
+        if (uint64_t(offset) + sizeof(T) > data.size())
+            return false;
+        memcpy(&out, data.data() + offset, sizeof(T));
+        return true;
+    }
+
+    bool ReadU32Array(const std::vector<uint8_t>& data, uint32_t offset, uint32_t count, std::vector<uint32_t>& out)
+    {
+        if (uint64_t(offset) + uint64_t(count) * sizeof(uint32_t) > data.size())
+            return false;
+        out.resize(count);
+        if (count > 0)
+            memcpy(out.data(), data.data() + offset, count * sizeof(uint32_t));
+        return true;
+    }
+
+    bool ReadString(const std::vector<uint8_t>& data, uint32_t offset, std::string& out)
+    {
+        if (offset >= data.size())
+            return false;
+        const char* str = reinterpret_cast<const char*>(data.data() + offset);
+        size_t      len = strnlen(str, data.size() - offset);
+        if (offset + len >= data.size())
+            return false;
+        out.assign(str, len);
+        return true;
+    }
+}  // namespace
+
+void ShaderArchiveBuilder::AddSection(ArchiveSection section)
+{
+    for (ArchiveSection& existing : m_Sections)
+    {
+        if (existing.name == section.name)
+        {
+            existing = std::move(section);
+            return;
+        }
+    }
+    m_Sections.push_back(std::move(section));
+}
+
+bool ShaderArchiveBuilder::AddArchive(const fs::path& path)
+{
+    std::ifstream file(path, std::ios::ate | std::ios::binary);
+    if (!file.is_open())
+        return false;
+
+    std::vector<uint8_t> data(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(data.data()), data.size());
+    if (file.fail())
+        return false;
+
+    FfxShaderBlobArchiveHeader header;
+    if (!ReadStruct(data, 0, header) || header.magic != FFX_SHADER_BLOB_ARCHIVE_MAGIC || header.version != FFX_SHADER_BLOB_ARCHIVE_VERSION)
+        return false;
+
+    for (uint32_t s = 0; s < header.sectionCount; ++s)
+    {
+        FfxShaderBlobArchiveSection sectionHeader;
+        if (!ReadStruct(data, header.sectionsOffset + s * sizeof(FfxShaderBlobArchiveSection), sectionHeader))
+            return false;
+
+        ArchiveSection section;
+        if (!ReadString(data, sectionHeader.nameOffset, section.name) ||
+            !ReadU32Array(data, sectionHeader.indirectionTableOffset, sectionHeader.keyCount, section.indirectionTable))
+            return false;
+
+        for (uint32_t p = 0; p < sectionHeader.permutationCount; ++p)
+        {
+            FfxShaderBlobArchivePermutation permutationHeader;
+            FfxShaderBlobArchiveBlob        blob;
+            uint32_t permutationOffset = header.permutationsOffset + (sectionHeader.firstPermutation + p) * sizeof(FfxShaderBlobArchivePermutation);
+            if (!ReadStruct(data, permutationOffset, permutationHeader) ||
+                !ReadStruct(data, header.blobsOffset + permutationHeader.blobIndex * sizeof(FfxShaderBlobArchiveBlob), blob) ||
+                uint64_t(blob.offset) + blob.storedSize > data.size())
+                return false;
+
+            ArchivePermutation permutation;
+            if (blob.storedSize == blob.size)
+                permutation.binary.assign(data.begin() + blob.offset, data.begin() + blob.offset + blob.size);
+            else
+            {
+                permutation.binary.resize(blob.size);
+                if (!ffxShaderBlobLzDecompress(data.data() + blob.offset, blob.storedSize, permutation.binary.data(), blob.size))
+                    return false;
+            }
+
+            for (uint32_t type = 0; type < FFX_SHADER_BLOB_ARCHIVE_RESOURCE_TYPE_COUNT; ++type)
+            {
+                const FfxShaderBlobArchiveResourceTable& table = permutationHeader.resources[type];
+                std::vector<uint32_t> names, bindings, counts, spaces;
+                if (!ReadU32Array(data, table.namesOffset, table.count, names) || !ReadU32Array(data, table.bindingsOffset, table.count, bindings) ||
+                    !ReadU32Array(data, table.countsOffset, table.count, counts) || !ReadU32Array(data, table.spacesOffset, table.count, spaces))
+                    return false;
+
+                for (uint32_t r = 0; r < table.count; ++r)
+                {
+                    ShaderResourceInfo info = {"", bindings[r], counts[r], spaces[r]};
+                    if (!ReadString(data, names[r], info.name))
+                        return false;
+                    permutation.resources[type].push_back(info);
+                }
+            }
+
+            section.permutations.push_back(std::move(permutation));
+        }
+
+        AddSection(std::move(section));
+    }
+
+    return true;
+}
+
+size_t ShaderArchiveBuilder::Write(const fs::path& path) const
+{
+    // ------------------------------------------------------------------------------------------------
+    // Deduplicate blobs and strings, and lay out the uint32_t table pool.
+    // Offsets into the pool and string table are relative until the final layout is known.
+    // ------------------------------------------------------------------------------------------------
+    std::vector<FfxShaderBlobArchiveSection>      sections;
+    std::vector<FfxShaderBlobArchivePermutation>  permutations;
+    std::vector<const std::vector<uint8_t>*>      blobs;
+    std::unordered_map<std::string, uint32_t>     blobIndices;
+    std::vector<uint32_t>                         tablePool;
+    std::vector<size_t>                           stringReferences;     // pool entries holding string offsets
+    std::string                                   stringTable;
+    std::unordered_map<std::string, uint32_t>     stringOffsets;
+
+    const auto AddString = [&](const std::string& str) -> uint32_t {
+        auto it = stringOffsets.find(str);
+        if (it != stringOffsets.end())
+            return it->second;
+
+        uint32_t offset = static_cast<uint32_t>(stringTable.size());
+        stringTable.append(str);
+        stringTable.push_back('\0');
+        stringOffsets[str] = offset;
+        return offset;
+    };
+
+    for (const ArchiveSection& section : m_Sections)
+    {
+        FfxShaderBlobArchiveSection sectionHeader = {};
+        sectionHeader.nameOffset             = AddString(section.name);
+        sectionHeader.keyCount               = static_cast<uint32_t>(section.indirectionTable.size());
+        sectionHeader.indirectionTableOffset = static_cast<uint32_t>(tablePool.size() * sizeof(uint32_t));
+        sectionHeader.firstPermutation       = static_cast<uint32_t>(permutations.size());
+        sectionHeader.permutationCount       = static_cast<uint32_t>(section.permutations.size());
+        tablePool.insert(tablePool.end(), section.indirectionTable.begin(), section.indirectionTable.end());
+        sections.push_back(sectionHeader);
+
+        for (const ArchivePermutation& permutation : section.permutations)
+        {
+            FfxShaderBlobArchivePermutation permutationHeader = {};
+
+            std::string blobKey(permutation.binary.begin(), permutation.binary.end());
+            auto        blobIt = blobIndices.find(blobKey);
+            if (blobIt == blobIndices.end())
+            {
+                blobIt = blobIndices.emplace(std::move(blobKey), static_cast<uint32_t>(blobs.size())).first;
+                blobs.push_back(&permutation.binary);
+            }
+            permutationHeader.blobIndex = blobIt->second;
+
+            for (uint32_t type = 0; type < FFX_SHADER_BLOB_ARCHIVE_RESOURCE_TYPE_COUNT; ++type)
+            {
+                const std::vector<ShaderResourceInfo>& resources = permutation.resources[type];
+                FfxShaderBlobArchiveResourceTable&     table     = permutationHeader.resources[type];
+                table.count = static_cast<uint32_t>(resources.size());
+                if (table.count == 0)
+                    continue;
+
+                table.namesOffset = static_cast<uint32_t>(tablePool.size() * sizeof(uint32_t));
+                for (const ShaderResourceInfo& info : resources)
+                {
+                    stringReferences.push_back(tablePool.size());
+                    tablePool.push_back(AddString(info.name));
+                }
+
+                table.bindingsOffset = static_cast<uint32_t>(tablePool.size() * sizeof(uint32_t));
+                for (const ShaderResourceInfo& info : resources)
+                    tablePool.push_back(info.binding);
+
+                table.countsOffset = static_cast<uint32_t>(tablePool.size() * sizeof(uint32_t));
+                for (const ShaderResourceInfo& info : resources)
+                    tablePool.push_back(info.count);
+
+                table.spacesOffset = static_cast<uint32_t>(tablePool.size() * sizeof(uint32_t));
+                for (const ShaderResourceInfo& info : resources)
+                    tablePool.push_back(info.space);
+            }
+
+            permutations.push_back(permutationHeader);
+        }
+    }
+
+    // ------------------------------------------------------------------------------------------------
+    // Final layout
+    // ------------------------------------------------------------------------------------------------
+    FfxShaderBlobArchiveHeader header = {};
+    header.magic              = FFX_SHADER_BLOB_ARCHIVE_MAGIC;
+    header.version            = FFX_SHADER_BLOB_ARCHIVE_VERSION;
+    header.sectionCount       = static_cast<uint32_t>(sections.size());
+    header.sectionsOffset     = sizeof(FfxShaderBlobArchiveHeader);
+    header.permutationCount   = static_cast<uint32_t>(permutations.size());
+    header.permutationsOffset = header.sectionsOffset + header.sectionCount * sizeof(FfxShaderBlobArchiveSection);
+    header.blobCount          = static_cast<uint32_t>(blobs.size());
+    header.blobsOffset        = header.permutationsOffset + header.permutationCount * sizeof(FfxShaderBlobArchivePermutation);
+    header.tablePoolOffset    = header.blobsOffset + header.blobCount * sizeof(FfxShaderBlobArchiveBlob);
+    header.tablePoolSize      = static_cast<uint32_t>(tablePool.size() * sizeof(uint32_t));
+    header.stringTableOffset  = header.tablePoolOffset + header.tablePoolSize;
+    header.stringTableSize    = static_cast<uint32_t>(stringTable.size());
+
+    for (size_t index : stringReferences)
+        tablePool[index] += header.stringTableOffset;
+
+    for (FfxShaderBlobArchiveSection& section : sections)
+    {
+        section.nameOffset += header.stringTableOffset;
+        section.indirectionTableOffset += header.tablePoolOffset;
+    }
+
+    for (FfxShaderBlobArchivePermutation& permutation : permutations)
+    {
+        for (FfxShaderBlobArchiveResourceTable& table : permutation.resources)
+        {
+            if (table.count == 0)
+                continue;
+            table.namesOffset += header.tablePoolOffset;
+            table.bindingsOffset += header.tablePoolOffset;
+            table.countsOffset += header.tablePoolOffset;
+            table.spacesOffset += header.tablePoolOffset;
+        }
+    }
+
+    // Blobs are compressed whenever that makes them smaller, otherwise they are stored as is.
+    std::vector<FfxShaderBlobArchiveBlob> blobHeaders;
+    std::vector<std::vector<uint8_t>>     storedBlobs(blobs.size());
+    uint32_t                              blobOffset = header.stringTableOffset + header.stringTableSize;
+    for (size_t i = 0; i < blobs.size(); ++i)
+    {
+        const std::vector<uint8_t>& blob     = *blobs[i];
+        const uint32_t              blobSize = static_cast<uint32_t>(blob.size());
+
+        std::vector<uint8_t>& stored = storedBlobs[i];
+        stored.resize(ffxShaderBlobLzCompressBound(blobSize));
+        uint32_t storedSize = ffxShaderBlobLzCompress(blob.data(), blobSize, stored.data(), static_cast<uint32_t>(stored.size()));
+        if (storedSize == 0 || storedSize >= blobSize)
+            stored = blob;
+        else
+            stored.resize(storedSize);
+
+        blobOffset = AlignUp(blobOffset, FFX_SHADER_BLOB_ARCHIVE_BLOB_ALIGNMENT);
+        blobHeaders.push_back({blobOffset, blobSize, static_cast<uint32_t>(stored.size())});
+        blobOffset += static_cast<uint32_t>(stored.size());
+    }
+    header.totalSize = blobOffset;
+
+    // ------------------------------------------------------------------------------------------------
+    // Serialize
+    // ------------------------------------------------------------------------------------------------
+    std::vector<uint8_t> output(header.totalSize, 0);
+    const auto Copy = [&output](uint32_t offset, const void* data, size_t size) {
+        if (size > 0)
+            memcpy(output.data() + offset, data, size);
+    };
+
+    Copy(0, &header, sizeof(header));
+    Copy(header.sectionsOffset, sections.data(), sections.size() * sizeof(FfxShaderBlobArchiveSection));
+    Copy(header.permutationsOffset, permutations.data(), permutations.size() * sizeof(FfxShaderBlobArchivePermutation));
+    Copy(header.blobsOffset, blobHeaders.data(), blobHeaders.size() * sizeof(FfxShaderBlobArchiveBlob));
+    Copy(header.tablePoolOffset, tablePool.data(), header.tablePoolSize);
+    Copy(header.stringTableOffset, stringTable.data(), header.stringTableSize);
+    for (size_t i = 0; i < storedBlobs.size(); ++i)
+        Copy(blobHeaders[i].offset, storedBlobs[i].data(), storedBlobs[i].size());
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+        return 0;
+
+    file.write(reinterpret_cast<const char*>(output.data()), output.size());
+    return file.fail() ? 0 : output.size();
+}
@@ -0,0 +1,90 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#pragma once
+
+#include "compiler.h"
+#include <ffx_shader_blob_archive_format.h>
+
+/// A shader permutation as stored in a shader blob archive.
+///
+/// @ingroup ShaderCompiler
+struct ArchivePermutation
+{
+    std::vector<uint8_t>            binary;             ///< Compiled shader binary.
+    std::vector<ShaderResourceInfo> resources[FFX_SHADER_BLOB_ARCHIVE_RESOURCE_TYPE_COUNT];  ///< Reflection tables, in <c><i>FfxShaderBlobArchiveResourceType</i></c> order.
+};
+
+/// A shader (one permutation space) as stored in a shader blob archive.
+///
+/// @ingroup ShaderCompiler
+struct ArchiveSection
+{
+    std::string                     name;               ///< Shader name, used by the runtime to find the section.
+    std::vector<uint32_t>           indirectionTable;   ///< Permutation key to permutation index.
+    std::vector<ArchivePermutation> permutations;       ///< Unique permutations of the shader.
+};
+
+/// Builds binary shader blob archives (see ffx_shader_blob_archive_format.h) out of one or more
+/// shader sections. Shader blobs and reflection strings are deduplicated across all sections, and
+/// blobs are LZ4 compressed where that saves space.
+///
+/// @ingroup ShaderCompiler
+class ShaderArchiveBuilder
+{
+public:
+    /// Adds a section to the archive. Sections with the same name replace earlier ones.
+    ///
+    /// @param [in]  section                The section to add
+    ///
+    /// @ingroup ShaderCompiler
+    void AddSection(ArchiveSection section);
+
+    /// Adds all sections of an existing archive.
+    ///
+    /// @param [in]  path                   Path to the archive to merge in
+    ///
+    /// @returns
+    /// true if the archive could be read, false otherwise.
+    ///
+    /// @ingroup ShaderCompiler
+    bool AddArchive(const fs::path& path);
+
+    /// Serializes all sections into an archive on disk.
+    ///
+    /// @param [in]  path                   Output path of the archive
+    ///
+    /// @returns
+    /// Size of the archive written in bytes, 0 on failure.
+    ///
+    /// @ingroup ShaderCompiler
+    size_t Write(const fs::path& path) const;
+
+    /// Queries the number of sections added so far.
+    ///
+    /// @ingroup ShaderCompiler
+    size_t GetSectionCount() const { return m_Sections.size(); }
+
+private:
+    std::vector<ArchiveSection> m_Sections;
+};
@@ -0,0 +1,408 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include "shader_cache.h"
+#include "utils.h"
+
+#include <md5.h>
+
+static const uint32_t SHADER_CACHE_MAGIC   = 0x43584646;  // 'FFXC'
+static const uint32_t SHADER_CACHE_VERSION = 1;
+
+namespace
+{
+    class EntryWriter
+    {
+    public:
+        void Write(const void* data, size_t size)
+        {
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+            m_Buffer.insert(m_Buffer.end(), bytes, bytes + size);
+        }
+
+        void WriteU32(uint32_t value) { Write(&value, sizeof(value)); }
+        void WriteU64(uint64_t value) { Write(&value, sizeof(value)); }
+
+        void WriteString(const std::string& str)
+        {
+            WriteU32(static_cast<uint32_t>(str.size()));
+            Write(str.data(), str.size());
+        }
+
+        void WriteResourceInfo(const std::vector<ShaderResourceInfo>& resources)
+        {
+            WriteU32(static_cast<uint32_t>(resources.size()));
+            for (const ShaderResourceInfo& info : resources)
+            {
+                WriteString(info.name);
+                WriteU32(info.binding);
+                WriteU32(info.count);
+                WriteU32(info.space);
+            }
+        }
+
+        const std::vector<uint8_t>& GetBuffer() const { return m_Buffer; }
+
+    private:
+        std::vector<uint8_t> m_Buffer;
+    };
+
+    class EntryReader
+    {
+    public:
+        EntryReader(const std::vector<uint8_t>& buffer)
+            : m_Buffer(buffer)
+        {
+        }
+
+        bool Read(void* data, size_t size)
+        {
+            if (m_Offset + size > m_Buffer.size())
+                return false;
+            memcpy(data, m_Buffer.data() + m_Offset, size);
+            m_Offset += size;
+            return true;
+        }
+
+        bool ReadU32(uint32_t& value) { return Read(&value, sizeof(value)); }
+        bool ReadU64(uint64_t& value) { return Read(&value, sizeof(value)); }
+
+        bool ReadString(std::string& str)
+        {
+            uint32_t size = 0;
+            if (!ReadU32(size) || m_Offset + size > m_Buffer.size())
+                return false;
+            str.assign(reinterpret_cast<const char*>(m_Buffer.data() + m_Offset), size);
+            m_Offset += size;
+            return true;
+        }
+
+        bool ReadResourceInfo(std::vector<ShaderResourceInfo>& resources)
+        {
+            uint32_t count = 0;
+            if (!ReadU32(count))
+                return false;
+
+            resources.resize(count);
+            for (ShaderResourceInfo& info : resources)
+            {
+                if (!ReadString(info.name) || !ReadU32(info.binding) || !ReadU32(info.count) || !ReadU32(info.space))
+                    return false;
+            }
+            return true;
+        }
+
+        bool ReadBytes(std::vector<uint8_t>& bytes, size_t size)
+        {
+            if (m_Offset + size > m_Buffer.size())
+                return false;
+            bytes.assign(m_Buffer.begin() + m_Offset, m_Buffer.begin() + m_Offset + size);
+            m_Offset += size;
+            return true;
+        }
+
+    private:
+        const std::vector<uint8_t>& m_Buffer;
+        size_t                      m_Offset = 0;
+    };
+
+    bool ReadFileContents(const fs::path& path, std::vector<uint8_t>& contents)
+    {
+        std::ifstream file(path, std::ios::ate | std::ios::binary);
+        if (!file.is_open())
+            return false;
+
+        size_t fileSize = static_cast<size_t>(file.tellg());
+        contents.resize(fileSize);
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(contents.data()), fileSize);
+        return !file.fail();
+    }
+}  // namespace
+
+ShaderCache::ShaderCache(const fs::path& cacheDirectory, uint64_t maxSizeInBytes)
+    : m_CacheDirectory(cacheDirectory)
+    , m_MaxSizeInBytes(maxSizeInBytes)
+{
+    std::error_code ec;
+    fs::create_directories(m_CacheDirectory, ec);
+    if (ec)
+        throw std::runtime_error("Failed to create shader cache directory: " + m_CacheDirectory.generic_string());
+}
+
+std::string ShaderCache::ComputeKey(const std::string& compilerIdentity, const fs::path& sourcePath, const std::vector<std::string>& arguments, bool withReflection)
+{
+    std::string keySource;
+    keySource.reserve(1024);
+
+    keySource += "version=" + std::to_string(SHADER_CACHE_VERSION) + "\n";
+    keySource += "compiler=" + compilerIdentity + "\n";
+    keySource += "reflection=" + std::to_string(withReflection ? 1 : 0) + "\n";
+    keySource += "source=" + GetFileDigest(sourcePath.generic_string()) + "\n";
+
+    // The separator can't appear in a command line argument, so the joined
+    // arguments map to a unique key.
+    for (const std::string& arg : arguments)
+    {
+        keySource += arg;
+        keySource += '\0';
+    }
+
+    return GetMD5HashDigest(keySource.data(), keySource.size());
+}
+
+bool ShaderCache::Lookup(const std::string& key, Permutation& permutation)
+{
+    fs::path             entryPath = GetEntryPath(key);
+    std::vector<uint8_t> contents;
+
+    if (!ReadFileContents(entryPath, contents))
+    {
+        m_Misses++;
+        return false;
+    }
+
+    EntryReader reader(contents);
+
+    uint32_t magic = 0, version = 0;
+    if (!reader.ReadU32(magic) || !reader.ReadU32(version) || magic != SHADER_CACHE_MAGIC || version != SHADER_CACHE_VERSION)
+    {
+        m_Misses++;
+        return false;
+    }
+
+    // ------------------------------------------------------------------------------------------------
+    // Validate dependencies, any changed include invalidates the entry.
+    // ------------------------------------------------------------------------------------------------
+    uint32_t numDependencies = 0;
+    if (!reader.ReadU32(numDependencies))
+    {
+        m_Misses++;
+        return false;
+    }
+
+    std::unordered_set<std::string> dependencies;
+    for (uint32_t i = 0; i < numDependencies; ++i)
+    {
+        std::string path, digest;
+        if (!reader.ReadString(path) || !reader.ReadString(digest) || digest.empty() || GetFileDigest(path) != digest)
+        {
+            m_Misses++;
+            return false;
+        }
+        dependencies.insert(path);
+    }
+
+    // ------------------------------------------------------------------------------------------------
+    // Restore permutation data.
+    // ------------------------------------------------------------------------------------------------
+    std::string hashDigest, name, headerFileName;
+    uint32_t    hasReflection = 0;
+    if (!reader.ReadString(hashDigest) || !reader.ReadString(name) || !reader.ReadString(headerFileName) || !reader.ReadU32(hasReflection))
+    {
+        m_Misses++;
+        return false;
+    }
+
+    std::shared_ptr<IReflectionData> reflectionData = nullptr;
+    if (hasReflection)
+    {
+        reflectionData = std::make_shared<IReflectionData>();
+        if (!reader.ReadResourceInfo(reflectionData->constantBuffers) || !reader.ReadResourceInfo(reflectionData->srvTextures) ||
+            !reader.ReadResourceInfo(reflectionData->uavTextures) || !reader.ReadResourceInfo(reflectionData->srvBuffers) ||
+            !reader.ReadResourceInfo(reflectionData->uavBuffers) || !reader.ReadResourceInfo(reflectionData->samplers) ||
+            !reader.ReadResourceInfo(reflectionData->rtAccelerationStructures))
+        {
+            m_Misses++;
+            return false;
+        }
+    }
+
+    uint64_t                            binarySize   = 0;
+    std::shared_ptr<CachedShaderBinary> shaderBinary = std::make_shared<CachedShaderBinary>();
+    if (!reader.ReadU64(binarySize) || !reader.ReadBytes(shaderBinary->data, binarySize))
+    {
+        m_Misses++;
+        return false;
+    }
+
+    permutation.hashDigest     = std::move(hashDigest);
+    permutation.name           = std::move(name);
+    permutation.headerFileName = std::move(headerFileName);
+    permutation.dependencies   = std::move(dependencies);
+    permutation.reflectionData = reflectionData;
+    permutation.shaderBinary   = shaderBinary;
+
+    // Refresh the entry's timestamp so eviction is least-recently-used rather than least-recently-written.
+    std::error_code ec;
+    fs::last_write_time(entryPath, fs::file_time_type::clock::now(), ec);
+
+    m_Hits++;
+    return true;
+}
+
+void ShaderCache::Store(const std::string& key, const Permutation& permutation)
+{
+    if (permutation.shaderBinary == nullptr)
+        return;
+
+    EntryWriter writer;
+    writer.WriteU32(SHADER_CACHE_MAGIC);
+    writer.WriteU32(SHADER_CACHE_VERSION);
+
+    writer.WriteU32(static_cast<uint32_t>(permutation.dependencies.size()));
+    for (const std::string& dependency : permutation.dependencies)
+    {
+        writer.WriteString(dependency);
+        writer.WriteString(GetFileDigest(dependency));
+    }
+
+    writer.WriteString(permutation.hashDigest);
+    writer.WriteString(permutation.name);
+    writer.WriteString(permutation.headerFileName);
+
+    const IReflectionData* reflectionData = permutation.reflectionData.get();
+    writer.WriteU32(reflectionData != nullptr ? 1 : 0);
+    if (reflectionData != nullptr)
+    {
+        writer.WriteResourceInfo(reflectionData->constantBuffers);
+        writer.WriteResourceInfo(reflectionData->srvTextures);
+        writer.WriteResourceInfo(reflectionData->uavTextures);
+        writer.WriteResourceInfo(reflectionData->srvBuffers);
+        writer.WriteResourceInfo(reflectionData->uavBuffers);
+        writer.WriteResourceInfo(reflectionData->samplers);
+        writer.WriteResourceInfo(reflectionData->rtAccelerationStructures);
+    }
+
+    size_t binarySize = permutation.shaderBinary->BufferSize();
+    writer.WriteU64(binarySize);
+    writer.Write(permutation.shaderBinary->BufferPointer(), binarySize);
+
+    // Write to a temporary file first and rename it, so concurrent invocations
+    // sharing the cache never observe a partially written entry.
+    fs::path entryPath = GetEntryPath(key);
+    fs::path tempPath  = entryPath;
+    tempPath += "." + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + ".tmp";
+
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+            return;
+
+        const std::vector<uint8_t>& buffer = writer.GetBuffer();
+        file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+        if (file.fail())
+        {
+            file.close();
+            std::error_code ec;
+            fs::remove(tempPath, ec);
+            return;
+        }
+    }
+
+    std::error_code ec;
+    fs::rename(tempPath, entryPath, ec);
+    if (ec)
+        fs::remove(tempPath, ec);
+    else
+        m_Stores++;
+}
+
+void ShaderCache::Trim()
+{
+    struct EntryInfo
+    {
+        fs::path            path;
+        uint64_t            size;
+        fs::file_time_type  lastWriteTime;
+    };
+
+    std::vector<EntryInfo> entries;
+    uint64_t               totalSize = 0;
+
+    std::error_code ec;
+    for (const fs::directory_entry& entry : fs::directory_iterator(m_CacheDirectory, ec))
+    {
+        if (!entry.is_regular_file(ec) || entry.path().extension() != ".ffxsc")
+            continue;
+
+        EntryInfo info = { entry.path(), entry.file_size(ec), entry.last_write_time(ec) };
+        totalSize += info.size;
+        entries.push_back(info);
+    }
+
+    if (m_MaxSizeInBytes != 0 && totalSize > m_MaxSizeInBytes)
+    {
+        // Oldest entries first
+        std::sort(entries.begin(), entries.end(), [](const EntryInfo& a, const EntryInfo& b) { return a.lastWriteTime < b.lastWriteTime; });
+
+        for (const EntryInfo& info : entries)
+        {
+            if (totalSize <= m_MaxSizeInBytes)
+                break;
+
+            if (fs::remove(info.path, ec))
+            {
+                totalSize -= info.size;
+                m_Evictions++;
+            }
+        }
+    }
+
+    m_SizeInBytes = totalSize;
+}
+
+ShaderCacheStats ShaderCache::GetStats() const
+{
+    ShaderCacheStats stats;
+    stats.hits        = m_Hits;
+    stats.misses      = m_Misses;
+    stats.stores      = m_Stores;
+    stats.evictions   = m_Evictions;
+    stats.sizeInBytes = m_SizeInBytes;
+    return stats;
+}
+
+std::string ShaderCache::GetFileDigest(const std::string& path)
+{
+    {
+        std::lock_guard<std::mutex> guard(m_FileDigestMutex);
+        if (auto it = m_FileDigests.find(path); it != m_FileDigests.end())
+            return it->second;
+    }
+
+    // Missing files get an empty digest, which Lookup never treats as a match.
+    std::string          digest;
+    std::vector<uint8_t> contents;
+    if (ReadFileContents(path, contents))
+        digest = GetMD5HashDigest(contents.data(), contents.size());
+
+    std::lock_guard<std::mutex> guard(m_FileDigestMutex);
+    m_FileDigests[path] = digest;
+    return digest;
+}
+
+fs::path ShaderCache::GetEntryPath(const std::string& key) const
+{
+    return m_CacheDirectory / (key + ".ffxsc");
+}
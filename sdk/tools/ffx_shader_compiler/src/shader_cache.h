@@ -0,0 +1,152 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#pragma once
+
+#include "compiler.h"
+#include <atomic>
+
+/// A <c><i>IShaderBinary</i></c> implementation backed by a plain byte buffer.
+/// Used to hand shader binaries restored from the <c><i>ShaderCache</i></c>
+/// back to the application without going through a compiler.
+///
+/// @ingroup ShaderCompiler
+struct CachedShaderBinary : public IShaderBinary
+{
+    std::vector<uint8_t> data;          ///< The cached shader binary data
+
+    /// Cached shader binary buffer accessor.
+    ///
+    /// @returns
+    /// Pointer to the cached buffer.
+    ///
+    /// @ingroup ShaderCompiler
+    uint8_t* BufferPointer() override { return data.data(); }
+
+    /// Queries the cached shader binary size.
+    ///
+    /// @returns
+    /// Size of the cached shader binary
+    ///
+    /// @ingroup ShaderCompiler
+    size_t   BufferSize() override { return data.size(); }
+};
+
+/// Statistics gathered by the <c><i>ShaderCache</i></c> during a run.
+///
+/// @ingroup ShaderCompiler
+struct ShaderCacheStats
+{
+    uint64_t hits           = 0;    ///< Number of permutations restored from the cache.
+    uint64_t misses         = 0;    ///< Number of permutations that had to be compiled.
+    uint64_t stores         = 0;    ///< Number of entries written to the cache.
+    uint64_t evictions      = 0;    ///< Number of entries removed to honor the size budget.
+    uint64_t sizeInBytes    = 0;    ///< Total size of the cache after trimming.
+};
+
+/// A persistent, content-addressed cache of compiled shader permutations.
+///
+/// Entries are keyed by a digest of the compiler identity, the full argument list
+/// (including the permutation defines) and the contents of the input shader file.
+/// Each entry records the content digest of every file the permutation included,
+/// which is re-validated on lookup so that an edit to any include invalidates the
+/// entry. A hit restores the shader binary, its reflection data and its dependency
+/// list without calling <c><i>ICompiler::Compile</i></c>.
+///
+/// The cache is bounded in size; entries are evicted in least-recently-used order
+/// (based on the last time they were written or hit) once the budget is exceeded.
+///
+/// @ingroup ShaderCompiler
+class ShaderCache
+{
+public:
+    /// ShaderCache construction function
+    ///
+    /// @param [in]  cacheDirectory         Directory holding the cache entries (created if it doesn't exist)
+    /// @param [in]  maxSizeInBytes         Size budget for the cache directory, 0 for unbounded
+    ///
+    /// @ingroup ShaderCompiler
+    ShaderCache(const fs::path& cacheDirectory, uint64_t maxSizeInBytes);
+
+    /// Computes the cache key for a permutation.
+    ///
+    /// @param [in]  compilerIdentity       String uniquely identifying the compiler binary and backend
+    /// @param [in]  sourcePath             Path to the permutation's input shader file
+    /// @param [in]  arguments              Full list of compiler arguments, including the permutation defines
+    /// @param [in]  withReflection         Whether reflection data is required for this permutation
+    ///
+    /// @returns
+    /// The hex digest used to address the permutation in the cache.
+    ///
+    /// @ingroup ShaderCompiler
+    std::string ComputeKey(const std::string& compilerIdentity, const fs::path& sourcePath, const std::vector<std::string>& arguments, bool withReflection);
+
+    /// Restores a permutation from the cache.
+    ///
+    /// @param [in]  key                    Key computed with <c><i>ComputeKey</i></c>
+    /// @param [out] permutation            Permutation to fill with the cached binary, reflection and dependency data
+    ///
+    /// @returns
+    /// true on a valid hit, false otherwise (permutation is left untouched).
+    ///
+    /// @ingroup ShaderCompiler
+    bool Lookup(const std::string& key, Permutation& permutation);
+
+    /// Stores a freshly compiled permutation into the cache.
+    ///
+    /// @param [in]  key                    Key computed with <c><i>ComputeKey</i></c>
+    /// @param [in]  permutation            Compiled permutation (must still hold its shader binary)
+    ///
+    /// @ingroup ShaderCompiler
+    void Store(const std::string& key, const Permutation& permutation);
+
+    /// Evicts least recently used entries until the cache fits its size budget.
+    ///
+    /// @ingroup ShaderCompiler
+    void Trim();
+
+    /// Queries the statistics gathered so far.
+    ///
+    /// @returns
+    /// A snapshot of the cache statistics.
+    ///
+    /// @ingroup ShaderCompiler
+    ShaderCacheStats GetStats() const;
+
+private:
+    std::string GetFileDigest(const std::string& path);
+    fs::path    GetEntryPath(const std::string& key) const;
+
+private:
+    fs::path                                     m_CacheDirectory;
+    uint64_t                                     m_MaxSizeInBytes;
+
+    std::mutex                                   m_FileDigestMutex;
+    std::unordered_map<std::string, std::string> m_FileDigests;
+
+    std::atomic<uint64_t>                        m_Hits      = 0;
+    std::atomic<uint64_t>                        m_Misses    = 0;
+    std::atomic<uint64_t>                        m_Stores    = 0;
+    std::atomic<uint64_t>                        m_Evictions = 0;
+    uint64_t                                     m_SizeInBytes = 0;
+};
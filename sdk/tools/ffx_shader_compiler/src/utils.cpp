@@ -22,6 +22,8 @@
 
 #include "utils.h"
 
+#include <md5.h>
+
 std::string WCharToUTF8(const std::wstring& wstr)
 {
     if (wstr.empty())
@@ -49,3 +51,51 @@ std::wstring UTF8ToWChar(const std::string& str)
 
     return wstr;
 }
+
+std::string MD5HashString(unsigned char* sig)
+{
+    char out[33];
+    out[32] = '\0';
+
+    char* out_ptr = out;
+    std::stringstream ss;
+
+    for (int i = 0; i < MD5_SIZE; i++)
+    {
+        std::snprintf(out_ptr, 32, "%02x", sig[i]);
+        out_ptr += 2;
+    }
+
+    return std::string(out);
+}
+
+std::string GetMD5HashDigest(void* buffer, size_t size)
+{
+    unsigned char sig[MD5_SIZE];
+
+    md5::md5_t md5;
+
+    md5.process(buffer, size);
+
+    md5.finish(sig);
+
+    return MD5HashString(sig);
+}
+
+std::string GetFileIdentity(const fs::path& path)
+{
+    std::error_code ec;
+    fs::path        absolutePath = fs::absolute(path, ec);
+
+    std::string identity = absolutePath.generic_string();
+
+    uintmax_t fileSize = fs::file_size(absolutePath, ec);
+    if (!ec)
+        identity += "|" + std::to_string(fileSize);
+
+    fs::file_time_type writeTime = fs::last_write_time(absolutePath, ec);
+    if (!ec)
+        identity += "|" + std::to_string(writeTime.time_since_epoch().count());
+
+    return identity;
+}
@@ -27,3 +27,6 @@
 
 std::string WCharToUTF8(const std::wstring& wstr);
 std::wstring UTF8ToWChar(const std::string& str);
+std::string MD5HashString(unsigned char* sig);
+std::string GetMD5HashDigest(void* buffer, size_t size);
+std::string GetFileIdentity(const fs::path& path);